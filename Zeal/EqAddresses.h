@@ -32,6 +32,8 @@ namespace Zeal
 		static int* ptr_AlternateKeyMap = (int*)0x7CDC4C;
 		static BYTE* strafe_direction = (BYTE*)0x7985EB;
 		static float* strafe_speed = (float*)0x799780;
+		static BYTE* auto_attack_on = (BYTE*)0x7f6ffe;
+		static BYTE* ranged_ready = (BYTE*)0x7cd844; //range attack timer elapsed, cleared when a shot is taken
 		static EqStructures::Entity* _ControlledPlayer = (EqStructures::Entity*)0x7f94e0;
 		static int* Display = (int*)0x7F9510;
 		static EqStructures::Cam* camera = (EqStructures::Cam*)0x799688;// 0x7996C0;
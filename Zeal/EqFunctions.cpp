@@ -2,6 +2,10 @@
 #include "EqFunctions.h"
 #include "EqAddresses.h"
 #include "Zeal.h"
+#include "profiler.h"
+#include <algorithm>
+#include <array>
+#include <unordered_map>
 namespace Zeal
 {
 	namespace EqGame
@@ -102,7 +106,7 @@ namespace Zeal
 		}
 		float encum_factor()
 		{
-			if (*(int*)EqGame::_ControlledPlayer == *(int*)EqGame::Self)
+			if (get_controlled() == get_self())
 				return get_char_info()->encum_factor();
 			else
 				return 1.0f;
@@ -113,6 +117,8 @@ namespace Zeal
 		}
 		Zeal::EqStructures::EQCHARINFO* get_char_info()
 		{
+			if (state_view* view = active_view())
+				return view->char_info;
 			return (Zeal::EqStructures::EQCHARINFO*)(*(int*)0x7F94E8);
 		}
 		void do_autoattack(bool enabled)
@@ -171,25 +177,46 @@ namespace Zeal
 			return false;
 		}
 
-		std::vector<Zeal::EqStructures::RaidMember*> get_raid_list()
-		{
-			short raid_size = *(short*)0x794F9C;
-			std::vector<Zeal::EqStructures::RaidMember*> raid_member_list;
-
+		const std::vector<Zeal::EqStructures::RaidMember*>& get_raid_list()
+		{
+			ZealService* zeal = ZealService::get_instance();
+			if (zeal && zeal->raid_hook)
+				return zeal->raid_hook->get_roster();
+			static std::vector<Zeal::EqStructures::RaidMember*> raid_member_list;
+			raid_member_list.clear();
+			short raid_size = get_raid_size();
 			if (raid_size <= 0) {
 				return raid_member_list;
 			}
 
 			for (int i = 0; i < 72; i++) // 12 groups x 6 members per group = 72 slots, sometimes gaps so need to check all
 			{
-				Zeal::EqStructures::RaidMember* raid_member = (Zeal::EqStructures::RaidMember*)(RaidMemberList + (0x0000D0 * i));
+				Zeal::EqStructures::RaidMember* raid_member = get_raid_slot(i);
 				if (raid_member->Name[0] != '\0') {
 					raid_member_list.push_back(raid_member);
 				}
 			}
-
 			return raid_member_list;
 		}
+		Zeal::EqStructures::RaidMember* get_raid_slot(int i)
+		{
+			if (state_view* view = active_view())
+				return view->raid + i;
+			return (Zeal::EqStructures::RaidMember*)(RaidMemberList + (0x0000D0 * i));
+		}
+		short get_raid_size()
+		{
+			if (state_view* view = active_view())
+				return view->raid_size;
+			return *(short*)0x794F9C;
+		}
+		state_view* installed_view = nullptr;
+		void set_state_view(state_view* view)
+		{
+			if (view)
+				view->thread = GetCurrentThreadId();
+			installed_view = view;
+		}
 
 
 		Vec3 get_view_actor_head_pos()
@@ -223,27 +250,148 @@ namespace Zeal
 		{
 			return *(int*)0x63d5d8!=0;
 		}
+		// a handful of recent one unit cells, a stationary camera or one moving inside a region answers from here
+		struct region_cell
+		{
+			int world;
+			int x, y, z;
+			int region;
+		};
+		static constexpr int region_cache_size = 8;
+		static region_cell region_cache[region_cache_size];
+		static int region_cache_count = 0;
+		static int region_cache_next = 0;
+		static bool region_fn_resolved = false;
+
+		void reset_region_cache()
+		{
+			region_cache_count = 0;
+			region_cache_next = 0;
+			region_fn_resolved = false;
+		}
+
 		int get_region_from_pos(Vec3* pos)
 		{
 			static int last_good_region = 0;
-			EqGameInternal::t3dGetRegionNumberFromWorldAndXYZ = mem::function<int __cdecl(int, Vec3*)>(*(int*)0x07f9a30);
-			int rval = EqGameInternal::t3dGetRegionNumberFromWorldAndXYZ(*(int*)((*(int*)Zeal::EqGame::Display)+0x4), pos);
+			int world = *(int*)((*(int*)Zeal::EqGame::Display) + 0x4);
+			int x = static_cast<int>(floorf(pos->x));
+			int y = static_cast<int>(floorf(pos->y));
+			int z = static_cast<int>(floorf(pos->z));
+			for (int i = 0; i < region_cache_count; i++)
+			{
+				const region_cell& cell = region_cache[i];
+				if (cell.x == x && cell.y == y && cell.z == z && cell.world == world)
+					return cell.region;
+			}
+			if (!region_fn_resolved)
+			{
+				EqGameInternal::t3dGetRegionNumberFromWorldAndXYZ = mem::function<int __cdecl(int, Vec3*)>(*(int*)0x07f9a30);
+				region_fn_resolved = true;
+			}
+			int rval = EqGameInternal::t3dGetRegionNumberFromWorldAndXYZ(world, pos);
 			if (rval == -1)
-				rval = last_good_region;
-			else
-				last_good_region = rval;
+				return last_good_region; //outside the bsp, not cached so the next query inside it walks again
+			last_good_region = rval;
+			region_cache[region_cache_next] = { world, x, y, z, rval };
+			region_cache_next = (region_cache_next + 1) % region_cache_size;
+			if (region_cache_count < region_cache_size)
+				region_cache_count++;
 			return rval;
 		}
-		bool collide_with_world(Vec3 start, Vec3 end, Vec3& result, char collision_type, bool debug)
+		// every world raycast of a frame goes through here: endpoints are quantized to raycast_quantum and a query that
+		// repeats one already made this frame (the camera's zoom passes, los rays shared between targets) is answered
+		// from the memo, which is dropped when the next frame starts
+		static constexpr float raycast_quantum = 0.125f;
+		static constexpr size_t raycast_memo_limit = 2048;
+		struct raycast_key
+		{
+			int start[3];
+			int end[3];
+			char collision_type;
+			bool operator==(const raycast_key& o) const
+			{
+				return start[0] == o.start[0] && start[1] == o.start[1] && start[2] == o.start[2]
+					&& end[0] == o.end[0] && end[1] == o.end[1] && end[2] == o.end[2] && collision_type == o.collision_type;
+			}
+		};
+		struct raycast_key_hash
+		{
+			size_t operator()(const raycast_key& k) const
+			{
+				size_t h = static_cast<size_t>(k.collision_type);
+				for (int i = 0; i < 3; ++i)
+					h = (h * 31 + k.start[i] * 73856093) ^ (k.end[i] * 19349663);
+				return h;
+			}
+		};
+		struct raycast_memo
+		{
+			Vec3 result;
+			bool hit;
+		};
+		static std::unordered_map<raycast_key, raycast_memo, raycast_key_hash> raycast_memos;
+
+		static int quantize_ray(float v)
+		{
+			return static_cast<int>(floorf(v / raycast_quantum + 0.5f));
+		}
+
+		void reset_raycasts()
 		{
+			raycast_memos.clear();
+		}
+
+		static bool raycast_engine(const Vec3& start, const Vec3& end, Vec3& result, char collision_type)
+		{
+			ZEAL_PROFILE_SCOPE("world raycast"); //the ones that reached the engine, the query scope counts them all
 			DWORD disp = *(int*)Zeal::EqGame::Display;
-			char x = EqGameInternal::s3dCollideSphereWithWorld(disp, 0, start.x, start.y, start.z, end.x, end.y, end.z, (float*)&result.x, (float*)&result.y, (float*)&result.z, collision_type);
+			EqGameInternal::s3dCollideSphereWithWorld(disp, 0, start.x, start.y, start.z, end.x, end.y, end.z, (float*)&result.x, (float*)&result.y, (float*)&result.z, collision_type);
+			return result.Dist2(end) > 0.1f * 0.1f; //return true if there was a collision
+		}
 
+		bool collide_with_world(Vec3 start, Vec3 end, Vec3& result, char collision_type, bool debug)
+		{
+			ZEAL_PROFILE_SCOPE("world raycast query");
 			if (debug)
 			{
-				print_chat("start: %s  end: %s dist: %f result: %i", start.toString().c_str(), end.toString().c_str(), result.Dist(end), x);
+				bool hit = raycast_engine(start, end, result, collision_type);
+				print_chat("start: %s  end: %s dist: %f result: %i", start.toString().c_str(), end.toString().c_str(), result.Dist(end), hit);
+				return hit;
+			}
+			raycast_key key = { { quantize_ray(start.x), quantize_ray(start.y), quantize_ray(start.z) },
+				{ quantize_ray(end.x), quantize_ray(end.y), quantize_ray(end.z) }, collision_type };
+			auto it = raycast_memos.find(key);
+			if (it != raycast_memos.end())
+			{
+				result = it->second.result;
+				return it->second.hit;
+			}
+			bool hit = raycast_engine(start, end, result, collision_type);
+			if (raycast_memos.size() >= raycast_memo_limit)
+				raycast_memos.clear();
+			raycast_memos.emplace(key, raycast_memo{ result, hit });
+			return hit;
+		}
+
+		// rays grouped by direction and then by origin, neighbours in the run walk mostly the same bsp nodes
+		void collide_batch(std::vector<raycast_query>& queries, char collision_type)
+		{
+			static std::vector<std::pair<UINT64, UINT>> order;
+			order.clear();
+			for (UINT i = 0; i < queries.size(); ++i)
+			{
+				const raycast_query& q = queries[i];
+				float angle = atan2f(q.end.y - q.start.y, q.end.x - q.start.x); //-pi..pi
+				UINT64 sector = static_cast<UINT64>((angle + 3.14159265f) * (64 / 6.2831853f)) & 63;
+				UINT64 origin = (static_cast<UINT64>(quantize_ray(q.start.x) & 0xFFFFFF) << 24) | (quantize_ray(q.start.y) & 0xFFFFFF);
+				order.push_back({ (sector << 48) | origin, i });
+			}
+			std::sort(order.begin(), order.end());
+			for (auto& [key, i] : order)
+			{
+				raycast_query& q = queries[i];
+				q.hit = collide_with_world(q.start, q.end, q.result, collision_type, false);
 			}
-			return result.Dist(end)>0.1; //return true if there was a collision
 		}
 
 		bool can_move()
@@ -260,9 +408,12 @@ namespace Zeal
 			return false;
 		}
 
-		std::vector<Zeal::EqStructures::Entity*> get_world_visible_actor_list(float max_dist, bool only_targetable)
+		void query_world_visible_actors(float max_dist, std::vector<Zeal::EqStructures::Entity*>& out)
 		{
+			out.clear();
 			Zeal::EqStructures::Entity* self = Zeal::EqGame::get_self();
+			if (!self)
+				return;
 			get_camera_location();
 			DWORD disp = *(int*)Zeal::EqGame::Display;
 			int ent_count = 0;
@@ -270,7 +421,7 @@ namespace Zeal
 			int a1 = *(int*)(disp + 0x4);
 			int a2 = *(int*)(disp + 0x8);
 			int a3 = (disp + 0x2CD0);
-			float mdist=max_dist;
+			float mdist2=max_dist*max_dist;
 			__asm
 			{
 				push ecx
@@ -289,46 +440,90 @@ namespace Zeal
 			}
 			int* cObject = *(int**)(disp + 0x2CDC);
 			Zeal::EqStructures::Entity* current_ent;
-			
-			std::vector<Zeal::EqStructures::Entity*> rEnts;
 			for (int i = 0; i < ent_count; i++)
 			{
 				if (*cObject)
 				{
-					bool add_to_list = !only_targetable;
 					current_ent = *(Zeal::EqStructures::Entity**)(*cObject + 0x60);
-					if (current_ent && current_ent->Position.Dist2D(Zeal::EqGame::get_self()->Position)<= mdist)
-					{
-						if (only_targetable)
-						{
-							Vec3 result;
-							Vec3 ent_head = get_ent_head_pos(current_ent);
-							Vec3 my_head = self->Position;
-							my_head.z += self->Height;
-							std::vector<std::pair<Vec3, Vec3>> collision_checks =
-							{
-								{my_head, ent_head}, //face to face
-								{my_head, current_ent->Position}, //your face to their feet
-								{self->Position, current_ent->Position}, //your feet to their feet
-								{self->Position, ent_head}, //your feet to their face
-							};
-						
-							for (int i = 0; auto& [pos1, pos2] : collision_checks)
-							{
-								if (!collide_with_world(pos1, pos2, result, 0x3, false)) //had no collision
-								{
-									add_to_list = true;
-									break; //we don't really care which version of this had no world collision so break the for loop
-								}
-								i++;
-							}
-						}
-						if (current_ent != EqGame::get_self() && !current_ent->IsHidden && add_to_list)
-							rEnts.push_back(current_ent);
-					}
+					if (current_ent && current_ent != self && !current_ent->IsHidden && current_ent->Position.Dist2D2(self->Position) <= mdist2)
+						out.push_back(current_ent);
 				}
 				cObject += 1;
 			}
+		}
+
+		// the four rays tried between two actors, in the order that usually finds a clear one first
+		static void los_rays(Zeal::EqStructures::Entity* self, Zeal::EqStructures::Entity* target, std::pair<Vec3, Vec3>* rays)
+		{
+			Vec3 ent_head = get_ent_head_pos(target);
+			Vec3 my_head = self->Position;
+			my_head.z += self->Height;
+			rays[0] = { my_head, ent_head }; //face to face
+			rays[1] = { my_head, target->Position }; //your face to their feet
+			rays[2] = { self->Position, target->Position }; //your feet to their feet
+			rays[3] = { self->Position, ent_head }; //your feet to their face
+		}
+
+		bool has_line_of_sight(Zeal::EqStructures::Entity* self, Zeal::EqStructures::Entity* target)
+		{
+			Vec3 result;
+			std::pair<Vec3, Vec3> collision_checks[4];
+			los_rays(self, target, collision_checks);
+			for (auto& [pos1, pos2] : collision_checks)
+			{
+				if (!collide_with_world(pos1, pos2, result, 0x3, false)) //had no collision
+					return true; //we don't really care which version of this had no world collision
+			}
+			return false;
+		}
+
+		// one pass per ray kind, each pass a batch over the targets that are still blocked
+		void has_line_of_sight(Zeal::EqStructures::Entity* self, const std::vector<Zeal::EqStructures::Entity*>& targets, std::vector<char>& out)
+		{
+			static std::vector<raycast_query> queries;
+			static std::vector<UINT> pending;
+			static std::vector<std::array<std::pair<Vec3, Vec3>, 4>> rays;
+			out.assign(targets.size(), 0);
+			rays.resize(targets.size());
+			pending.clear();
+			for (UINT i = 0; i < targets.size(); ++i)
+			{
+				los_rays(self, targets[i], rays[i].data());
+				pending.push_back(i);
+			}
+			for (int pass = 0; pass < 4 && !pending.empty(); ++pass)
+			{
+				queries.clear();
+				for (UINT i : pending)
+					queries.push_back({ rays[i][pass].first, rays[i][pass].second });
+				collide_batch(queries, 0x3);
+				size_t kept = 0;
+				for (size_t q = 0; q < queries.size(); ++q)
+				{
+					if (queries[q].hit)
+						pending[kept++] = pending[q];
+					else
+						out[pending[q]] = 1;
+				}
+				pending.resize(kept);
+			}
+		}
+
+		std::vector<Zeal::EqStructures::Entity*> get_world_visible_actor_list(float max_dist, bool only_targetable)
+		{
+			std::vector<Zeal::EqStructures::Entity*> rEnts;
+			ZealService* zeal = ZealService::get_instance();
+			if (zeal && zeal->entity_manager)
+			{
+				zeal->entity_manager->get_visible_actors(max_dist, only_targetable, rEnts);
+				return rEnts;
+			}
+			query_world_visible_actors(max_dist, rEnts);
+			if (only_targetable)
+			{
+				Zeal::EqStructures::Entity* self = Zeal::EqGame::get_self();
+				std::erase_if(rEnts, [self](Zeal::EqStructures::Entity* ent) { return !has_line_of_sight(self, ent); });
+			}
 			return rEnts;
 		}
 
@@ -397,7 +592,7 @@ namespace Zeal
 		}
 		void print_chat(std::string data)
 		{
-			if (!is_in_game())
+			if (!is_in_game() || active_view()) //fixture runs replay zeal's handlers, their output isn't real chat
 				return;
 			std::vector<std::string> vd = splitStringByNewLine(data);
 			for (auto& d : vd)
@@ -405,7 +600,7 @@ namespace Zeal
 		}
 		void print_chat(const char* format, ...)
 		{
-			if (!is_in_game())
+			if (!is_in_game() || active_view())
 				return;
 			va_list argptr;
 			char buffer[512];
@@ -415,10 +610,9 @@ namespace Zeal
 			va_end(argptr);
 			EqGameInternal::print_chat(*(int*)0x809478, 0, buffer, 0, true);
 		}
-		void __fastcall PrintChat(int t, int unused, const char* data, short color_index, bool u) {};
 		void print_chat_hook(const char* format, ...)
 		{
-			if (!is_in_game())
+			if (!is_in_game() || active_view())
 				return;
 			va_list argptr;
 			char buffer[512];
@@ -427,13 +621,11 @@ namespace Zeal
 			vsnprintf(buffer, 511, format, argptr);
 			va_end(argptr);
 
-			ZealService::get_instance()->hooks->hook_map["PrintChat"]->original(PrintChat)(*(int*)0x809478, 0, buffer, 0, true);
+			if (hook_ref<::PrintChat>::ptr) //unresolved on this client build
+				hook_ref<::PrintChat>::original()(*(int*)0x809478, 0, buffer, 0, true);
 		}
 		void print_debug(const char* format, ...)
 		{
-			if (!is_in_game())
-				return;
-
 			va_list argptr;
 			char buffer[512];
 			char buffer_with_newline[514]; // Additional space for the newline and null terminator
@@ -441,6 +633,9 @@ namespace Zeal
 			va_start(argptr, format);
 			vsnprintf(buffer, sizeof(buffer), format, argptr);
 			va_end(argptr);
+			ZEAL_LOG_DEBUG("debug", "%s", buffer); //kept when not in game
+			if (!is_in_game())
+				return;
 
 			// Append newline character to the formatted string
 			snprintf(buffer_with_newline, sizeof(buffer_with_newline), "%s\n", buffer);
@@ -449,7 +644,7 @@ namespace Zeal
 		}
 		void print_chat(short color, const char* format, ...)
 		{
-			if (!is_in_game())
+			if (!is_in_game() || active_view())
 				return;
 			va_list argptr;
 			char buffer[512];
@@ -474,6 +669,15 @@ namespace Zeal
 		{
 			reinterpret_cast<void(__thiscall*)(EqStructures::Everquest*, Zeal::EqStructures::Entity*)>(0x54390E)(get_eq(), player);
 		}
+		void interpret_command(const char* text)
+		{
+			Zeal::EqStructures::Entity* self = get_self();
+			if (!self || !get_eq())
+				return;
+			char buffer[256]; //the game may write into the line while parsing it
+			strncpy_s(buffer, sizeof(buffer), text, _TRUNCATE);
+			reinterpret_cast<void(__thiscall*)(EqStructures::Everquest*, Zeal::EqStructures::Entity*, char*)>(EqGameInternal::fn_interpretcmd)(get_eq(), self, buffer);
+		}
 		void pet_command(int cmd, short spawn_id)
 		{
 			reinterpret_cast<void(__thiscall*)(EqStructures::Everquest*, int, short)>(0x547749)(get_eq(), cmd, spawn_id);
@@ -498,16 +702,23 @@ namespace Zeal
 		}
 		Zeal::EqStructures::Entity* get_target()
 		{
+			if (state_view* view = active_view())
+				return view->target;
 			return *(Zeal::EqStructures::Entity**)Zeal::EqGame::Target;
 		}
 		void set_target(Zeal::EqStructures::Entity* target)
 		{
 			if (!target)
 				print_chat(get_string(0x3057)); //you no longer have a target
-			*(Zeal::EqStructures::Entity**)Zeal::EqGame::Target = target;
+			if (state_view* view = active_view())
+				view->target = target;
+			else
+				*(Zeal::EqStructures::Entity**)Zeal::EqGame::Target = target;
 		}
 		Zeal::EqStructures::Entity* get_entity_list()
 		{
+			if (state_view* view = active_view())
+				return view->entity_list;
 			return *(Zeal::EqStructures::Entity**)Zeal::EqGame::EntListPtr;
 		}
 
@@ -520,27 +731,133 @@ namespace Zeal
 			return (_param_1 & 0xff00 | _param_1 >> 0x10 & 0xff | (_param_1 | 0xffffff00) << 0x10);
 		}
 
+		static constexpr int user_color_count = 128;
+		static DWORD user_palette[user_color_count];
+		static BYTE user_palette_generation[user_color_count]; //entries are filled on first use, only indices the client asks for are read
+		static BYTE user_palette_current = 1;
+
+		DWORD user_color(int index)
+		{
+			if (index < 0 || index >= user_color_count)
+				return static_cast<DWORD>(get_user_color(index));
+			if (user_palette_generation[index] != user_palette_current)
+			{
+				user_palette[index] = static_cast<DWORD>(get_user_color(index));
+				user_palette_generation[index] = user_palette_current;
+			}
+			return user_palette[index];
+		}
+
+		void refresh_user_colors()
+		{
+			if (++user_palette_current == 0) //wrapped, clear so no stale entry matches
+			{
+				memset(user_palette_generation, 0, sizeof(user_palette_generation));
+				user_palette_current = 1;
+			}
+		}
+
+		// green and light blue cut offs by player level, diff <= green is green, diff <= light_blue light blue, otherwise blue
+		struct con_thresholds
+		{
+			int max_level;
+			int green;
+			int light_blue;
+		};
+		static constexpr con_thresholds con_ladder[] = {
+			{ 7, -4, -4 }, { 8, -5, -4 }, { 12, -6, -4 }, { 16, -7, -5 }, { 20, -8, -6 }, { 24, -9, -7 }, { 28, -10, -8 }, { 30, -11, -9 },
+			{ 32, -12, -9 }, { 36, -13, -10 }, { 40, -14, -11 }, { 44, -16, -12 }, { 48, -17, -13 }, { 52, -18, -14 }, { 54, -19, -15 },
+			{ 56, -20, -15 }, { 60, -21, -16 }, { 61, -19, -14 }, { 62, -17, -12 }, { 255, -16, -11 }
+		};
+		static constexpr int con_max_level = 65;
+		static constexpr int con_min_diff = -64; //anything further below is green at every level
+		static constexpr con_class con_for(int my_level, int diff)
+		{
+			if (diff == 0)
+				return con_class::white;
+			if (diff > 0)
+				return diff <= 2 ? con_class::yellow : con_class::red;
+			const con_thresholds* row = con_ladder;
+			while (my_level > row->max_level)
+				row++;
+			if (diff <= row->green)
+				return con_class::green;
+			if (my_level <= 7)
+				return con_class::low_blue;
+			return diff <= row->light_blue ? con_class::light_blue : con_class::blue;
+		}
+		struct con_table
+		{
+			con_class classes[con_max_level + 1][-con_min_diff + 3]; //diff con_min_diff..2, red past that
+			constexpr con_table() : classes{}
+			{
+				for (int level = 0; level <= con_max_level; level++)
+					for (int diff = con_min_diff; diff <= 2; diff++)
+						classes[level][diff - con_min_diff] = con_for(level, diff);
+			}
+		};
+		static constexpr con_table cons;
+
+		con_class get_con_class(int my_level, int level)
+		{
+			int diff = level - my_level;
+			if (diff > 2)
+				return con_class::red;
+			if (diff < con_min_diff)
+				diff = con_min_diff;
+			if (my_level < 0)
+				my_level = 0;
+			else if (my_level > con_max_level)
+				my_level = con_max_level;
+			return cons.classes[my_level][diff - con_min_diff];
+		}
+
+		// the last answer is kept, the target ring asks for the same spawn every frame
+		DWORD con_color(Zeal::EqStructures::Entity* ent)
+		{
+			static Zeal::EqStructures::Entity* cached_ent = nullptr;
+			static int cached_level = -1;
+			static int cached_my_level = -1;
+			static DWORD cached_color = 0;
+			Zeal::EqStructures::Entity* self = get_self();
+			if (!ent || !self)
+				return 0;
+			if (ent == cached_ent && ent->Level == cached_level && self->Level == cached_my_level)
+				return cached_color;
+			static constexpr DWORD colors[] = { 0x5500f000, 0x5500f0f0, 0x550000f0, 0, 0x55f0f0f0, 0x55f0f000, 0x55f00000 };
+			con_class con = get_con_class(self->Level, ent->Level);
+			cached_color = con == con_class::low_blue ? user_color(70) : colors[static_cast<int>(con)];
+			cached_ent = ent;
+			cached_level = ent->Level;
+			cached_my_level = self->Level;
+			return cached_color;
+		}
+
 		Zeal::EqStructures::Entity* get_entity_by_id(short id)
 		{
-			if (id == get_controlled()->SpawnId)
+			if (get_controlled() && id == get_controlled()->SpawnId)
 				return get_controlled();
-			Zeal::EqStructures::Entity* current_ent = get_entity_list();
-			while (current_ent->Next)
+			ZealService* zeal = ZealService::get_instance();
+			if (zeal && zeal->entity_manager)
+				return zeal->entity_manager->get(static_cast<WORD>(id));
+			for (Zeal::EqStructures::Entity* current_ent = get_entity_list(); current_ent; current_ent = current_ent->Next)
 			{
 				if (current_ent->SpawnId == id)
 					return current_ent;
-				current_ent = current_ent->Next;
 			}
 			return 0;
 		}
 		Zeal::EqStructures::Entity* get_entity_by_parent_id(short parent_id)
 		{
-			Zeal::EqStructures::Entity* current_ent = get_entity_list();
-			while (current_ent->Next)
+			ZealService* zeal = ZealService::get_instance();
+			if (zeal && zeal->pet_tracker)
+				return zeal->pet_tracker->pet(static_cast<WORD>(parent_id));
+			if (zeal && zeal->entity_manager)
+				return zeal->entity_manager->get_pet(static_cast<WORD>(parent_id));
+			for (Zeal::EqStructures::Entity* current_ent = get_entity_list(); current_ent; current_ent = current_ent->Next)
 			{
 				if (current_ent->PetOwnerSpawnId == parent_id)
 					return current_ent;
-				current_ent = current_ent->Next;
 			}
 			return 0;
 		}
@@ -550,10 +867,14 @@ namespace Zeal
 		}
 		Zeal::EqStructures::Entity* get_self()
 		{
+			if (state_view* view = active_view())
+				return view->self;
 			return *(Zeal::EqStructures::Entity**)Zeal::EqGame::Self;
 		}
 		Zeal::EqStructures::Entity* get_controlled()
 		{
+			if (state_view* view = active_view())
+				return view->controlled;
 			return *(Zeal::EqStructures::Entity**)Zeal::EqGame::_ControlledPlayer;
 		}
 		Zeal::EqStructures::CameraInfo* get_camera()
@@ -585,142 +906,43 @@ namespace Zeal
 				vsnprintf(buffer, 511, format, argptr);
 				va_end(argptr);
 
-				EqGameInternal::CXStr_PrintString(str, buffer);
+				EqGameInternal::CXStr_PrintString(str, "%s", buffer); //the formatted text is never a format itself
 		}
 
+		// by class id, 17 to 31 are the guildmaster ids of 1 to 15 (and banker), 32 is merchant
+		static constexpr int class_table_size = Zeal::EqEnums::ClassTypes::Merchant + 1;
+		static constexpr std::string_view class_names[class_table_size] = {
+			"Unknown", "Warrior", "Cleric", "Paladin", "Ranger", "Shadowknight", "Druid", "Monk", "Bard", "Rogue", "Shaman", "Necromancer",
+			"Wizard", "Magician", "Enchanter", "Beastlord", "Banker", "Warrior GuildMaster", "Cleric GuildMaster", "Paladin GuildMaster",
+			"Ranger GuildMaster", "Shadowknight GuildMaster", "Druid GuildMaster", "Monk GuildMaster", "Bard GuildMaster",
+			"Rogue GuildMaster", "Shaman GuildMaster", "Necromancer GuildMaster", "Wizard GuildMaster", "Magician GuildMaster",
+			"Enchanter GuildMaster", "Beastlord GuildMaster", "Merchant"
+		};
+		static constexpr std::string_view class_names_short[class_table_size] = {
+			"Unknown", "War", "Clr", "Pal", "Rng", "Sk", "Dru", "Mnk", "Brd", "Rog", "Sha", "Nec", "Wiz", "Mag", "Enc", "Bst", "Banker",
+			"War GuildMaster", "Clr GuildMaster", "Pal GuildMaster", "Rng GuildMaster", "Sk GuildMaster", "Dru GuildMaster",
+			"Mnk GuildMaster", "Brd GuildMaster", "Rog GuildMaster", "Sha GuildMaster", "Nec GuildMaster", "Wiz GuildMaster",
+			"Mag GuildMaster", "Enc GuildMaster", "Bst GuildMaster", "Merchant"
+		};
+		const char* guild_name(int guild_id)
+		{
+			return guild_id >= 0 && guild_id < max_guilds ? guild_names->name[guild_id] : "";
+		}
+		std::string_view class_name_view(int class_id)
+		{
+			return class_id > 0 && class_id < class_table_size ? class_names[class_id] : class_names[0];
+		}
+		std::string_view class_name_short_view(int class_id)
+		{
+			return class_id > 0 && class_id < class_table_size ? class_names_short[class_id] : class_names_short[0];
+		}
 		std::string class_name(int class_id)
 		{
-			std::string class_string = "";
-			int modified_class_id = class_id;
-			if (modified_class_id > 16 && modified_class_id < 32)
-				modified_class_id -= 16;
-			switch (modified_class_id)
-			{
-			case Zeal::EqEnums::ClassTypes::Warrior:
-				class_string = "Warrior";
-				break;
-			case Zeal::EqEnums::ClassTypes::Cleric:
-				class_string = "Cleric";
-				break;
-			case Zeal::EqEnums::ClassTypes::Paladin:
-				class_string = "Paladin";
-				break;
-			case Zeal::EqEnums::ClassTypes::Ranger:
-				class_string = "Ranger";
-				break;
-			case Zeal::EqEnums::ClassTypes::Shadowknight:
-				class_string = "Shadowknight";
-				break;
-			case Zeal::EqEnums::ClassTypes::Druid:
-				class_string = "Druid";
-				break;
-			case Zeal::EqEnums::ClassTypes::Monk:
-				class_string = "Monk";
-				break;
-			case Zeal::EqEnums::ClassTypes::Bard:
-				class_string = "Bard";
-				break;
-			case Zeal::EqEnums::ClassTypes::Rogue:
-				class_string = "Rogue";
-				break;
-			case Zeal::EqEnums::ClassTypes::Shaman:
-				class_string = "Shaman";
-				break;
-			case Zeal::EqEnums::ClassTypes::Necromancer:
-				class_string = "Necromancer";
-				break;
-			case Zeal::EqEnums::ClassTypes::Wizard:
-				class_string = "Wizard";
-				break;
-			case Zeal::EqEnums::ClassTypes::Magician:
-				class_string = "Magician";
-				break;
-			case Zeal::EqEnums::ClassTypes::Enchanter:
-				class_string = "Enchanter";
-				break;
-			case Zeal::EqEnums::ClassTypes::Beastlord:
-				class_string = "Beastlord";
-				break;
-			case Zeal::EqEnums::ClassTypes::Banker:
-				class_string = "Banker";
-				break;
-			case Zeal::EqEnums::ClassTypes::Merchant:
-				class_string = "Merchant";
-				break;
-			default:
-				class_string = "Unknown";
-				break;
-			}
-			if (class_id > 16 && class_id < 32)
-				class_string += " GuildMaster";
-			return class_string;
+			return std::string(class_name_view(class_id));
 		}
 		std::string class_name_short(int class_id)
 		{
-			std::string class_string = "";
-			int modified_class_id = class_id;
-			if (modified_class_id > 16 && modified_class_id < 32)
-				modified_class_id -= 16;
-			switch (modified_class_id)
-			{
-			case Zeal::EqEnums::ClassTypes::Warrior:
-				class_string = "War";
-				break;
-			case Zeal::EqEnums::ClassTypes::Cleric:
-				class_string = "Clr";
-				break;
-			case Zeal::EqEnums::ClassTypes::Paladin:
-				class_string = "Pal";
-				break;
-			case Zeal::EqEnums::ClassTypes::Ranger:
-				class_string = "Rng";
-				break;
-			case Zeal::EqEnums::ClassTypes::Shadowknight:
-				class_string = "Sk";
-				break;
-			case Zeal::EqEnums::ClassTypes::Druid:
-				class_string = "Dru";
-				break;
-			case Zeal::EqEnums::ClassTypes::Monk:
-				class_string = "Mnk";
-				break;
-			case Zeal::EqEnums::ClassTypes::Bard:
-				class_string = "Brd";
-				break;
-			case Zeal::EqEnums::ClassTypes::Rogue:
-				class_string = "Rog";
-				break;
-			case Zeal::EqEnums::ClassTypes::Shaman:
-				class_string = "Sha";
-				break;
-			case Zeal::EqEnums::ClassTypes::Necromancer:
-				class_string = "Nec";
-				break;
-			case Zeal::EqEnums::ClassTypes::Wizard:
-				class_string = "Wiz";
-				break;
-			case Zeal::EqEnums::ClassTypes::Magician:
-				class_string = "Mag";
-				break;
-			case Zeal::EqEnums::ClassTypes::Enchanter:
-				class_string = "Enc";
-				break;
-			case Zeal::EqEnums::ClassTypes::Beastlord:
-				class_string = "Bst";
-				break;
-			case Zeal::EqEnums::ClassTypes::Banker:
-				class_string = "Banker";
-				break;
-			case Zeal::EqEnums::ClassTypes::Merchant:
-				class_string = "Merchant";
-				break;
-			default:
-				class_string = "Unknown";
-				break;
-			}
-			if (class_id > 16 && class_id < 32)
-				class_string += " GuildMaster";
-			return class_string;
+			return std::string(class_name_short_view(class_id));
 		}
 
 		bool is_targetable(Zeal::EqStructures::Entity* ent)
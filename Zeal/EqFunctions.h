@@ -3,6 +3,7 @@
 #include "EqStructures.h"
 #include "EqUI.h"
 #include <cstdarg>
+#include <string_view>
 
 enum Stance
 {
@@ -54,7 +55,7 @@ namespace Zeal
 			static mem::function<void __fastcall(DWORD, int unused, DWORD)> proc_mouse = 0x537707;
 			static mem::function<void __fastcall(DWORD, int unused, int cmd , int str_id, int category)> InitKeyBind = 0x42B21D; //arguments coptionswnd ptr, cmd, string_id, category
 			static mem::function<void __fastcall(DWORD, int unused, char* str)> InitKeyBindStr = 0x576190; //arguments coptionswnd ptr, cmd, string_id, category
-			static mem::function<int __cdecl(Zeal::EqUI::CXSTR*, const char* format)> CXStr_PrintString = 0x578110;
+			static int(__cdecl* const CXStr_PrintString)(Zeal::EqUI::CXSTR*, const char* format, ...) = reinterpret_cast<int(__cdecl*)(Zeal::EqUI::CXSTR*, const char*, ...)>(0x578110); //variadic, which mem::function can't wrap
 			static mem::function<int __stdcall()> LoadOptions = 0x536CE0;
 			static mem::function<int __fastcall(int t, int unk, int key, int type)> readKeyMapFromIni = 0x525520;
 			static mem::function<void __cdecl(Zeal::EqStructures::EQCHARINFO* _char, Zeal::EqStructures::_EQITEMINFO** Item, int)> auto_inventory = 0x4F0EEB;
@@ -89,6 +90,7 @@ namespace Zeal
 		bool CanIHitTarget(float dist);
 		bool do_attack(uint8_t type, uint8_t p2);
 		void do_inspect(Zeal::EqStructures::Entity* player);
+		void interpret_command(const char* text); //as if typed, through the hooked entry point so zeal commands run too
 		void execute_cmd(UINT cmd, bool isdown, int unk2);
 		EqStructures::Everquest* get_eq();
 		int get_gamestate();
@@ -105,8 +107,22 @@ namespace Zeal
 		float encum_factor();
 		Zeal::EqStructures::Entity* get_view_actor_entity();
 		inline Zeal::EqStructures::GuildName* guild_names = (Zeal::EqStructures::GuildName*)0x7F9C94;
-		bool collide_with_world(Vec3 start, Vec3 end, Vec3& result, char collision_type = 0x3, bool debug = false);
+		static constexpr int max_guilds = 512;
+		const char* guild_name(int guild_id); //"" for no guild, name to id is GuildRoster::guild_id
+		bool collide_with_world(Vec3 start, Vec3 end, Vec3& result, char collision_type = 0x3, bool debug = false); //memoized for the frame, debug bypasses it
+		struct raycast_query
+		{
+			Vec3 start;
+			Vec3 end;
+			Vec3 result;
+			bool hit;
+		};
+		void collide_batch(std::vector<raycast_query>& queries, char collision_type = 0x3); //answered in place, run in direction order
+		void reset_raycasts(); //start of a frame and zone in
 		void get_camera_location();
+		void query_world_visible_actors(float max_dist, std::vector<Zeal::EqStructures::Entity*>& out); //engine visible set, uncached
+		bool has_line_of_sight(Zeal::EqStructures::Entity* self, Zeal::EqStructures::Entity* target); //up to four world raycasts
+		void has_line_of_sight(Zeal::EqStructures::Entity* self, const std::vector<Zeal::EqStructures::Entity*>& targets, std::vector<char>& out); //batched, 1 where visible
 		std::vector<Zeal::EqStructures::Entity*> get_world_visible_actor_list(float max_dist, bool only_targetable = true);
 		Zeal::EqStructures::ActorLocation get_actor_location(int actor);
 		bool can_target(Zeal::EqStructures::Entity* ent);
@@ -116,6 +132,20 @@ namespace Zeal
 		void print_chat(const char* format, ...);
 		void print_chat(short color, const char* format, ...);
 		long get_user_color(int index);
+		DWORD user_color(int index); //get_user_color from a palette snapshot, each entry is read from the game once per refresh
+		void refresh_user_colors(); //InitUI and once a second, so edits in the options window show up
+		enum struct con_class : BYTE
+		{
+			green,
+			light_blue,
+			blue,
+			low_blue, //blue under level 8, drawn in the player's con color option (user color 70)
+			white,
+			yellow,
+			red
+		};
+		con_class get_con_class(int my_level, int level); //table lookup, no game calls
+		DWORD con_color(Zeal::EqStructures::Entity* ent); //translucent argb of ent's con from self, 0 without self
 		void set_target(Zeal::EqStructures::Entity* target);
 		bool can_move();
 		bool is_on_ground(Zeal::EqStructures::Entity* ent);
@@ -138,14 +168,38 @@ namespace Zeal
 		bool is_mouse_hovering_window();
 		std::string class_name_short(int class_id);
 		std::string class_name(int class_id);
+		std::string_view class_name_view(int class_id); //static and zero terminated, no allocation
+		std::string_view class_name_short_view(int class_id);
 		bool is_game_ui_window_hovered();
 		bool is_targetable(Zeal::EqStructures::Entity* ent);
 		bool is_in_game();
 		void do_say(bool hide_local, const char* format, ...);
 		void do_say(bool hide_local, std::string data);
-		int get_region_from_pos(Vec3* pos);
+		int get_region_from_pos(Vec3* pos); //the last few cells queried are cached, within a cell the bsp isn't walked again
+		void reset_region_cache(); //zone in, the world and its bsp changed
 		EqUI::CXWndManager* get_wnd_manager();
-		std::vector<Zeal::EqStructures::RaidMember*> get_raid_list();
+		const std::vector<Zeal::EqStructures::RaidMember*>& get_raid_list(); //cached by the raid module
+		Zeal::EqStructures::RaidMember* get_raid_slot(int i); //0 to 71, slots can have gaps
+		short get_raid_size();
+		// stand in for the client's globals, seen by the accessors above only on the thread that installed it. the game's
+		// memory is never written, so the client and zeal's other threads keep reading the real state meanwhile
+		struct state_view
+		{
+			Zeal::EqStructures::Entity* self;
+			Zeal::EqStructures::Entity* target;
+			Zeal::EqStructures::Entity* controlled;
+			Zeal::EqStructures::Entity* entity_list;
+			Zeal::EqStructures::EQCHARINFO* char_info;
+			Zeal::EqStructures::RaidMember* raid; //72 slots
+			short raid_size;
+			DWORD thread;
+		};
+		void set_state_view(state_view* view); //nullptr goes back to the client's globals
+		extern state_view* installed_view;
+		inline state_view* active_view()
+		{
+			return installed_view && installed_view->thread == GetCurrentThreadId() ? installed_view : nullptr;
+		}
 		std::string generateTimestamp();
 	}
 }
@@ -12,13 +12,44 @@ namespace Zeal
             PrintNonMeleeDamage = 0x4236,
             CorpseDrag = 0x4114,
             CorpseDrop = 0x1337,
-            RequestTrade = 0x40D1
+            RequestTrade = 0x40D1,
+            Consider = 0x4137,
+            BeginCast = 0x40A9,
+            ZoneSpawns = 0x5F41,
+            NewSpawn = 0x4146,
+            DeleteSpawn = 0x2A20,
+            RaidUpdate = 0x4140
         };
         struct TradeRequest_Struct {
             /*000*/	UINT16 to_id;
             /*002*/	UINT16 from_id;
             /*004*/
         };
+        struct Consider_Struct
+        {
+            /*000*/	UINT16 playerid;
+            /*002*/	UINT16 targetid;
+            /*004*/	UINT32 faction; //1 ally through 9 scowls
+            /*008*/	UINT32 level; //con color
+            /*012*/	INT32 cur_hp;
+            /*016*/	INT32 max_hp;
+            /*020*/	UINT8 pvpcon;
+            /*021*/	UINT8 unknown021[3];
+            /*024*/
+        };
+        struct BeginCast_Struct
+        {
+            /*000*/	UINT16 caster_id;
+            /*002*/	UINT16 spell_id;
+            /*004*/	UINT16 cast_time; //ms, after focus and haste
+            /*006*/	UINT16 unknown006;
+            /*008*/
+        };
+        struct DeleteSpawn_Struct
+        {
+            /*000*/	UINT16 spawn_id;
+            /*002*/
+        };
         struct CorpseDrag_Struct
         {
             /*000*/ char CorpseName[64];
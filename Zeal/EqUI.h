@@ -174,13 +174,6 @@ namespace Zeal
 			{
 				reinterpret_cast<void(__thiscall*)(const BasicWnd*)>(0x572290)(this);
 			}
-			void SetupCustomVTable()
-			{
-				BaseVTable* newtbl = new BaseVTable();
-				mem::copy((int)newtbl, (int)vtbl, sizeof(BaseVTable));
-				vtbl = newtbl;
-				mem::unprotect_memory(vtbl, sizeof(BaseVTable));
-			}
 			void show(bool unkown, bool visible)
 			{
 				reinterpret_cast<void(__thiscall*)(const BasicWnd*, bool, bool)>(0x572310)(this, unkown, visible);
@@ -342,14 +335,6 @@ namespace Zeal
 		struct ItemDisplayWnd : EQWND
 		{
 			ItemDisplayWnd() {};
-			void SetupCustomVTable()
-			{
-				ItemDisplayVtable* newtbl = new ItemDisplayVtable();
-				mem::copy((int)newtbl, (int)vtbl, sizeof(ItemDisplayVtable));
-				vtbl = (BaseVTable*)newtbl;
-				mem::unprotect_memory(vtbl, sizeof(ItemDisplayVtable));
-				
-			}
 			void Activate()
 			{
 				reinterpret_cast<void(__thiscall*)(const ItemDisplayWnd*)>(0x423606)(this);
@@ -381,14 +366,6 @@ namespace Zeal
 		struct SliderWnd : EQWND
 		{
 			SliderWnd() {};
-			void SetupCustomVTable()
-			{
-				BaseVTable* newtbl = new BaseVTable();
-				mem::copy((int)newtbl, (int)vtbl, sizeof(BaseVTable));
-				vtbl = (BaseVTable*)newtbl;
-				mem::unprotect_memory(vtbl, sizeof(BaseVTable));
-
-			}
 			/* 0x0134 */ int current_val;
 			/* 0x0138 */ BYTE Unknown0138[4];
 			/* 0x013C */ int max_val; 
@@ -490,7 +467,6 @@ namespace Zeal
 			ContextMenu(int cxwnd, int a1, CXRect r)
 			{
 				reinterpret_cast<void(__thiscall*)(const ContextMenu*, int, int, CXRect)>(0x417785)(this, cxwnd, a1, r);
-				SetupCustomVTable();
 			}
 			void AddSeparator() const {
 				reinterpret_cast<void(__thiscall*)(const ContextMenu*)>(0x417A41)(this);
@@ -516,13 +492,6 @@ namespace Zeal
 			{
 				return; //handle the deconstruction in our code
 			}
-			void SetupCustomVTable()
-			{
-				ContextMenuVTable* newtbl = new ContextMenuVTable();
-				mem::copy((int)newtbl, (int)fnTable, sizeof(ContextMenuVTable));
-				fnTable = newtbl;
-				//fnTable->basic.Deconstructor = Deconstructor;//if you can make visual studio use a class member here or get the address of it without it complaining, go ahead
-			}
 			void RemoveAllMenuItems()
 			{
 				reinterpret_cast<void(__thiscall*)(const ContextMenu*)>(0x417a7f)(this);
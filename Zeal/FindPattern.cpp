@@ -1,33 +1,206 @@
 #include "FindPattern.h"
+#include <emmintrin.h>
+#include <intrin.h>
+#include <climits>
 namespace Zeal
 {
 	namespace Memory
 	{
+		//rough frequency of bytes in x86 code, an anchor on one of these would produce a hit every few bytes
+		static int byte_weight(BYTE b)
+		{
+			switch (b)
+			{
+			case 0x00: return 100;
+			case 0xFF: return 60;
+			case 0xCC: return 50;
+			case 0x8B: return 45;
+			case 0x89: return 30;
+			case 0x90: return 25;
+			case 0x24: case 0x45: case 0x04: case 0x08: return 20;
+			case 0xE8: case 0x0F: case 0x83: case 0x01: case 0x10: return 15;
+			case 0x85: case 0x74: case 0x75: case 0xC3: case 0x50: case 0x55: case 0x56: case 0x57: case 0x8D: return 10;
+			default: return 1;
+			}
+		}
 
-		BOOLEAN MaskCompare(PVOID buffer, LPCSTR pattern, LPCSTR mask) {
-			for (auto b = reinterpret_cast<PBYTE>(buffer); *mask; ++pattern, ++mask, ++b) {
-				if (*mask == 'x' && *reinterpret_cast<LPCBYTE>(pattern) != *b) {
-					return FALSE;
+		static int hex_value(char c)
+		{
+			if (c >= '0' && c <= '9')
+				return c - '0';
+			if (c >= 'a' && c <= 'f')
+				return c - 'a' + 10;
+			if (c >= 'A' && c <= 'F')
+				return c - 'A' + 10;
+			return -1;
+		}
+
+		Pattern::Pattern(const char* ida)
+		{
+			for (const char* p = ida; p && *p; )
+			{
+				if (*p == ' ')
+				{
+					p++;
+					continue;
+				}
+				if (*p == '?')
+				{
+					bytes.push_back(0);
+					mask.push_back(0);
+					while (*p == '?')
+						p++;
+					continue;
 				}
+				int hi = hex_value(p[0]);
+				int lo = hi >= 0 ? hex_value(p[1]) : -1;
+				if (lo < 0) //malformed, keep what parsed so far
+					break;
+				bytes.push_back(static_cast<BYTE>(hi << 4 | lo));
+				mask.push_back(1);
+				p += 2;
 			}
+			choose_anchor();
+		}
 
-			return TRUE;
+		Pattern::Pattern(LPCSTR pattern, LPCSTR _mask)
+		{
+			for (size_t i = 0; _mask[i]; i++)
+			{
+				bytes.push_back(static_cast<BYTE>(pattern[i]));
+				mask.push_back(_mask[i] == 'x' ? 1 : 0);
+			}
+			choose_anchor();
 		}
 
-		DWORD FindPattern(LPCSTR pattern, LPCSTR mask, HMODULE target_module) {
+		void Pattern::choose_anchor()
+		{
+			int best = INT_MAX;
+			anchor = 0;
+			for (size_t i = 0; i < bytes.size(); i++)
+			{
+				if (mask[i] && byte_weight(bytes[i]) < best)
+				{
+					best = byte_weight(bytes[i]);
+					anchor = i;
+				}
+			}
+		}
+
+		bool Pattern::matches(const BYTE* p) const
+		{
+			for (size_t i = 0; i < bytes.size(); i++)
+				if (mask[i] && p[i] != bytes[i])
+					return false;
+			return true;
+		}
+
+		//checks the 16 candidate starts p..p+15, the caller guarantees they all fit before end
+		static const BYTE* scan_block(const BYTE* p, const Pattern& pattern, __m128i needle)
+		{
+			__m128i block = _mm_loadu_si128(reinterpret_cast<const __m128i*>(p + pattern.anchor));
+			unsigned int bits = _mm_movemask_epi8(_mm_cmpeq_epi8(block, needle));
+			while (bits)
+			{
+				unsigned long i;
+				_BitScanForward(&i, bits);
+				if (pattern.matches(p + i))
+					return p + i;
+				bits &= bits - 1;
+			}
+			return nullptr;
+		}
+
+		static const BYTE* scan_tail(const BYTE* p, const BYTE* last, const Pattern& pattern)
+		{
+			for (; p <= last; p++)
+				if (p[pattern.anchor] == pattern.bytes[pattern.anchor] && pattern.matches(p))
+					return p;
+			return nullptr;
+		}
+
+		const BYTE* Scan(const BYTE* begin, const BYTE* end, const Pattern& pattern)
+		{
+			if (!pattern.size() || end - begin < (ptrdiff_t)pattern.size())
+				return nullptr;
+			const BYTE* last = end - pattern.size(); //last possible start
+			if (!pattern.mask[pattern.anchor]) //nothing but wildcards
+				return begin;
+			__m128i needle = _mm_set1_epi8(static_cast<char>(pattern.bytes[pattern.anchor]));
+			const BYTE* p = begin;
+			for (; p + 15 <= last; p += 16)
+				if (const BYTE* hit = scan_block(p, pattern, needle))
+					return hit;
+			return scan_tail(p, last, pattern);
+		}
+
+		void ScanMany(const BYTE* begin, const BYTE* end, const Pattern* const* patterns, size_t count, const BYTE** results)
+		{
+			std::vector<__m128i> needles(count);
+			size_t remaining = 0;
+			for (size_t j = 0; j < count; j++)
+			{
+				results[j] = nullptr;
+				const Pattern& pt = *patterns[j];
+				if (!pt.size() || end - begin < (ptrdiff_t)pt.size())
+					continue;
+				if (!pt.mask[pt.anchor])
+				{
+					results[j] = begin;
+					continue;
+				}
+				needles[j] = _mm_set1_epi8(static_cast<char>(pt.bytes[pt.anchor]));
+				remaining++;
+			}
+			//the block loop walks memory once, every pattern still missing checks the same 16 starts while they are in cache
+			for (const BYTE* p = begin; remaining && p < end; p += 16)
+			{
+				for (size_t j = 0; j < count; j++)
+				{
+					const Pattern& pt = *patterns[j];
+					if (results[j] || !pt.size() || end - begin < (ptrdiff_t)pt.size())
+						continue;
+					const BYTE* last = end - pt.size();
+					if (p > last)
+						continue;
+					const BYTE* hit = p + 15 <= last ? scan_block(p, pt, needles[j]) : scan_tail(p, last, pt);
+					if (hit)
+					{
+						results[j] = hit;
+						remaining--;
+					}
+				}
+			}
+		}
+
+		bool ModuleRange(HMODULE target_module, const BYTE*& begin, const BYTE*& end)
+		{
 			MODULEINFO info = { 0 };
 			if (target_module == 0)
 				target_module = GetModuleHandle(0);
-			GetModuleInformation(GetCurrentProcess(), target_module, &info, sizeof(info));
-
-			info.SizeOfImage -= static_cast<DWORD>(strlen(mask));
+			if (!GetModuleInformation(GetCurrentProcess(), target_module, &info, sizeof(info)))
+				return false;
+			begin = reinterpret_cast<const BYTE*>(info.lpBaseOfDll);
+			end = begin + info.SizeOfImage;
+			return true;
+		}
 
-			for (auto i = 0UL; i < info.SizeOfImage; ++i) {
-				auto addr = reinterpret_cast<PBYTE>(info.lpBaseOfDll) + i;
-				if (MaskCompare(addr, pattern, mask)) {
-					return (DWORD)addr;
+		BOOLEAN MaskCompare(PVOID buffer, LPCSTR pattern, LPCSTR mask) {
+			for (auto b = reinterpret_cast<PBYTE>(buffer); *mask; ++pattern, ++mask, ++b) {
+				if (*mask == 'x' && *reinterpret_cast<LPCBYTE>(pattern) != *b) {
+					return FALSE;
 				}
 			}
+
+			return TRUE;
+		}
+
+		DWORD FindPattern(LPCSTR pattern, LPCSTR mask, HMODULE target_module) {
+			const BYTE* begin;
+			const BYTE* end;
+			if (!ModuleRange(target_module, begin, end))
+				return 0;
+			return (DWORD)Scan(begin, end, Pattern(pattern, mask));
 		}
 	}
-}
\ No newline at end of file
+}
@@ -2,11 +2,30 @@
 #include <Windows.h>
 #include <psapi.h>
 #include <iostream>
+#include <vector>
 namespace Zeal
 {
 	namespace Memory
 	{
+		// a byte signature parsed once, scans only verify the bytes around hits of its rarest fixed byte
+		struct Pattern
+		{
+			std::vector<BYTE> bytes;
+			std::vector<BYTE> mask; //1 where the byte has to match
+			size_t anchor = 0; //index of the fixed byte the scanner searches for
+			Pattern() {}
+			explicit Pattern(const char* ida); //"8B 0D ?? ?? 45", ? and ?? are wildcards
+			Pattern(LPCSTR pattern, LPCSTR mask); //raw bytes with an 'x' / '?' mask of the same length
+			size_t size() const { return bytes.size(); }
+			bool matches(const BYTE* p) const;
+		private:
+			void choose_anchor();
+		};
+		const BYTE* Scan(const BYTE* begin, const BYTE* end, const Pattern& pattern); //first match or nullptr
+		void ScanMany(const BYTE* begin, const BYTE* end, const Pattern* const* patterns, size_t count, const BYTE** results); //one pass, first match of each or nullptr
+		bool ModuleRange(HMODULE target_module, const BYTE*& begin, const BYTE*& end);
+
 		BOOLEAN MaskCompare(PVOID buffer, LPCSTR pattern, LPCSTR mask);
-		DWORD FindPattern(LPCSTR pattern, LPCSTR mask, HMODULE target_module);
+		DWORD FindPattern(LPCSTR pattern, LPCSTR mask, HMODULE target_module); //0 when not found
 	}
-}
\ No newline at end of file
+}
@@ -1,94 +1,223 @@
 #pragma once
-#include <iostream>
-#include <fstream>
-#include <string>
-#include <map>
-#include <stdexcept>
-
 #include <iostream>
 #include <fstream>
 #include <sstream>
 #include <string>
 #include <map>
+#include <vector>
+#include <mutex>
+#include <charconv>
+#include <algorithm>
 #include <stdexcept>
 #include "EqFunctions.h"
+#include "profiler.h"
+
+// the file is parsed once into memory, reads never touch the disk
+// writes update the cache and queue a WritePrivateProfileString that flush() applies (periodically and at destruction)
+// flush() also reloads the cache when something else has modified the file since it was last read
 class IO_ini {
 private:
+    struct insensitive_less {
+        bool operator()(const std::string& a, const std::string& b) const { return _stricmp(a.c_str(), b.c_str()) < 0; }
+    };
+    using section_map = std::map<std::string, std::string, insensitive_less>;
+    struct pending_write {
+        std::string section;
+        std::string key; //empty when the whole section is deleted
+        std::string value;
+    };
     std::string filename;
-public:
-    IO_ini(const std::string& filename) : filename(filename) {   };
+    std::map<std::string, section_map, insensitive_less> sections;
+    std::vector<std::string> section_order; //file order for getSectionNames
+    std::vector<pending_write> pending;
+    FILETIME last_write = {};
+    mutable std::recursive_mutex lock;
 
-    void set(std::string path)
-    {
-        filename = path;
+    static std::string trim(const std::string& s) {
+        size_t start = s.find_first_not_of(" \t\r\n");
+        if (start == std::string::npos)
+            return "";
+        size_t end = s.find_last_not_of(" \t\r\n");
+        return s.substr(start, end - start + 1);
     }
 
-    bool exists(const std::string& section, const std::string& key) const {
-        char buffer[256];
-        DWORD bytesRead = GetPrivateProfileStringA(section.c_str(), key.c_str(), "", buffer, sizeof(buffer), filename.c_str());
-
-        if (bytesRead == 0) {
+    bool file_time(FILETIME& time) const {
+        WIN32_FILE_ATTRIBUTE_DATA data;
+        if (!GetFileAttributesExA(filename.c_str(), GetFileExInfoStandard, &data))
+        {
+            time = {};
             return false;
         }
+        time = data.ftLastWriteTime;
         return true;
     }
 
-    std::vector<std::string> getSectionNames() {
-        std::vector<std::string> sectionNames;
-        const DWORD bufferSize = 4096; // Adjust buffer size as needed
-        char buffer[bufferSize];
-
-        DWORD result = GetPrivateProfileSectionNamesA(buffer, bufferSize, filename.c_str());
-        if (result == 0) {
-            std::cerr << "Failed to read INI file: " << filename << std::endl;
-            return sectionNames;
+    void load() {
+        sections.clear();
+        section_order.clear();
+        file_time(last_write);
+        std::ifstream file(filename);
+        if (!file.is_open())
+            return;
+        std::string line;
+        section_map* current = nullptr;
+        while (std::getline(file, line))
+        {
+            line = trim(line);
+            if (line.empty() || line[0] == ';')
+                continue;
+            if (line[0] == '[')
+            {
+                size_t close = line.find(']');
+                std::string name = trim(line.substr(1, close == std::string::npos ? std::string::npos : close - 1));
+                if (!sections.count(name))
+                    section_order.push_back(name);
+                current = &sections[name];
+                continue;
+            }
+            size_t eq = line.find('=');
+            if (!current || eq == std::string::npos)
+                continue;
+            std::string key = trim(line.substr(0, eq));
+            std::string value = trim(line.substr(eq + 1));
+            if (value.length() >= 2 && (value.front() == '"' || value.front() == '\'') && value.back() == value.front())
+                value = value.substr(1, value.length() - 2); //same unquoting GetPrivateProfileString does
+            if (!current->count(key)) //the first occurrence wins, like the profile api
+                (*current)[key] = value;
         }
+    }
 
-        for (char* p = buffer; *p != '\0'; p += strlen(p) + 1) {
-            sectionNames.push_back(p);
-        }
+    const std::string* find(const std::string& section, const std::string& key) const {
+        auto s = sections.find(section);
+        if (s == sections.end())
+            return nullptr;
+        auto k = s->second.find(key);
+        if (k == s->second.end())
+            return nullptr;
+        return &k->second;
+    }
+public:
+    IO_ini(const std::string& filename) : filename(filename) { load(); };
+    ~IO_ini() { flush(true); }
 
-        return sectionNames;
+    void set(std::string path)
+    {
+        std::lock_guard<std::recursive_mutex> guard(lock);
+        flush();
+        filename = path;
+        load();
     }
 
-    bool deleteSection(const std::string& sectionName) {
-        // Delete the section and its contents by writing an empty string to it
-        if (!WritePrivateProfileSectionA(sectionName.c_str(), nullptr, filename.c_str())) 
+    // applies queued writes and picks up external edits, returns true when the cache was reloaded. the file time is
+    // checked before writing: an edit made since the last read (the client's own profile writes, a text editor) would
+    // otherwise carry the same new time as ours and never be noticed. when it moved, the file is read back and the
+    // writes are applied to the cache again, so it holds both
+    bool flush(bool quiet = false)
+    {
+        ZEAL_PROFILE_SCOPE("ini flush");
+        std::lock_guard<std::recursive_mutex> guard(lock);
+        FILETIME before;
+        file_time(before);
+        bool changed = CompareFileTime(&before, &last_write) != 0;
+        bool failed = false;
+        for (const pending_write& w : pending)
         {
-            return false;
+            BOOL result = w.key.empty() ? WritePrivateProfileSectionA(w.section.c_str(), nullptr, filename.c_str())
+                : WritePrivateProfileStringA(w.section.c_str(), w.key.c_str(), w.value.c_str(), filename.c_str());
+            failed |= !result;
         }
-        else 
+        bool wrote = pending.size() > 0;
+        std::vector<pending_write> written;
+        written.swap(pending);
+        if (failed && !quiet)
+            Zeal::EqGame::print_chat("Error writing value to INI file.");
+        if (changed)
         {
+            load();
+            for (const pending_write& w : written) //zeal's values win over the reload, even a write that failed
+            {
+                if (w.key.empty())
+                    sections.erase(w.section);
+                else
+                {
+                    if (!sections.count(w.section))
+                        section_order.push_back(w.section);
+                    sections[w.section][w.key] = w.value;
+                }
+            }
             return true;
         }
+        if (wrote)
+            file_time(last_write); //only our own writes, already in the cache
+        return false;
+    }
+
+    bool exists(const std::string& section, const std::string& key) const {
+        std::lock_guard<std::recursive_mutex> guard(lock);
+        const std::string* value = find(section, key);
+        return value && value->length() > 0;
+    }
+
+    std::vector<std::string> getSectionNames() {
+        std::lock_guard<std::recursive_mutex> guard(lock);
+        std::vector<std::string> sectionNames;
+        for (const auto& name : section_order)
+            if (sections.count(name))
+                sectionNames.push_back(name);
+        return sectionNames;
+    }
+
+    // every key and value of a section in one locked copy, for callers that apply a whole section at once
+    std::vector<std::pair<std::string, std::string>> getSection(const std::string& sectionName) const {
+        std::lock_guard<std::recursive_mutex> guard(lock);
+        std::vector<std::pair<std::string, std::string>> entries;
+        auto s = sections.find(sectionName);
+        if (s != sections.end())
+            entries.assign(s->second.begin(), s->second.end());
+        return entries;
+    }
+
+    bool deleteSection(const std::string& sectionName) {
+        std::lock_guard<std::recursive_mutex> guard(lock);
+        sections.erase(sectionName);
+        pending.push_back({ sectionName, "", "" });
+        return true;
     }
 
     template<typename T>
     T getValue(std::string section, std::string key) const {
-        char buffer[256];
-        DWORD bytesRead = GetPrivateProfileStringA(section.c_str(), key.c_str(), "", buffer, sizeof(buffer), filename.c_str());
-
-        if (bytesRead == 0) {
+        std::lock_guard<std::recursive_mutex> guard(lock);
+        const std::string* value = find(section, key);
+        if (!value || value->empty()) {
             return T{};
         }
-
-        return convertFromString<T>(std::string(buffer));
+        return convertFromString<T>(*value);
     }
 
     template<typename T>
     void setValue(const std::string& section, const std::string& key, const T& value) {
 
-        std::string valueStr = std::to_string(value);
-         if constexpr (std::is_same_v<T, bool>) {
+        std::string valueStr;
+        if constexpr (std::is_same_v<T, bool>) {
              if (value)
                  valueStr = "TRUE";
             else
                  valueStr = "FALSE";
         }
-        BOOL result = WritePrivateProfileStringA(section.c_str(), key.c_str(), valueStr.c_str(), filename.c_str());
-        if (!result) {
-            Zeal::EqGame::print_chat("Error writing value to INI file.");
+        else if constexpr (std::is_same_v<T, std::string>) {
+            valueStr = value;
+        }
+        else {
+            valueStr = std::to_string(value);
         }
+        std::lock_guard<std::recursive_mutex> guard(lock);
+        const std::string* current = find(section, key);
+        if (current && *current == valueStr)
+            return; //unchanged, nothing to write
+        if (std::find_if(section_order.begin(), section_order.end(), [&](const std::string& name) { return !_stricmp(name.c_str(), section.c_str()); }) == section_order.end())
+            section_order.push_back(section);
+        sections[section][key] = valueStr;
+        pending.push_back({ section, key, valueStr });
     }
 private:
     template<typename T>
@@ -100,9 +229,19 @@ private:
             else
                 return false;
         }
-        std::istringstream iss(str);
-        T value;
-        iss >> std::boolalpha >> value;
-        return value;
+        else if constexpr (std::is_same_v<T, std::string>) {
+            return str;
+        }
+        else if constexpr (std::is_arithmetic_v<T>) {
+            T value{};
+            std::from_chars(str.data(), str.data() + str.length(), value);
+            return value;
+        }
+        else {
+            std::istringstream iss(str);
+            T value;
+            iss >> std::boolalpha >> value;
+            return value;
+        }
     }
 };
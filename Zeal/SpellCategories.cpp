@@ -0,0 +1,4146 @@
+#include "SpellCategories.h"
+#include <array>
+
+//original credits for this go to mmofry
+namespace
+{
+	struct spell_category_entry
+	{
+		WORD spell_id;
+		BYTE category;
+		BYTE subcategory;
+	};
+
+	// sorted by spell id, a category past the name table (two ids list 39008/39079) is stored as 0 and reads back as Unknown
+	constexpr spell_category_entry spell_category_entries[] =
+	{
+		{ 3, 125, 64 }, //Summon Corpse
+		{ 4, 18, 109 }, //Summon Waterstone
+		{ 6, 20, 38 }, //Ignite Blood
+		{ 7, 79, 43 }, //Hymn of Restoration
+		{ 9, 42, 42 }, //Superior Healing
+		{ 10, 125, 41 }, //Augmentation
+		{ 11, 95, 6 }, //Holy Armor
+		{ 12, 42, 42 }, //Healing
+		{ 13, 42, 42 }, //Complete Healing
+		{ 14, 25, 58 }, //Strike
+		{ 15, 42, 42 }, //Greater Healing
+		{ 16, 25, 58 }, //Smite
+		{ 17, 42, 42 }, //Light Healing
+		{ 18, 95, 6 }, //Guard
+		{ 19, 95, 6 }, //Armor of Faith
+		{ 20, 95, 6 }, //Shield of Words
+		{ 21, 95, 96 }, //Berserker Strength
+		{ 22, 25, 58 }, //Force Snap
+		{ 23, 25, 58 }, //Force Strike
+		{ 24, 126, 31 }, //Strip Enchantment
+		{ 25, 126, 31 }, //Pillage Enchantment
+		{ 26, 45, 46 }, //Skin like Wood
+		{ 27, 25, 14 }, //Pogonip
+		{ 28, 25, 14 }, //Avalanche
+		{ 29, 25, 14 }, //Ice
+		{ 31, 20, 29 }, //Scourge
+		{ 32, 20, 29 }, //Plague
+		{ 33, 95, 130 }, //Brilliance
+		{ 34, 125, 51 }, //Superior Camouflage
+		{ 35, 125, 64 }, //Bind Affinity
+		{ 36, 123, 64 }, //Gate
+		{ 37, 18, 110 }, //Hammer of Striking
+		{ 38, 25, 58 }, //Lightning Bolt
+		{ 39, 125, 41 }, //Quickness
+		{ 40, 95, 96 }, //Strengthen
+		{ 41, 126, 30 }, //Weaken
+		{ 42, 125, 51 }, //Invisibility
+		{ 43, 95, 7 }, //Yaulp II
+		{ 44, 95, 7 }, //Yaulp III
+		{ 45, 126, 11 }, //Pacify
+		{ 46, 125, 129 }, //Ultravision
+		{ 47, 126, 11 }, //Calm
+		{ 48, 126, 31 }, //Cancel Magic
+		{ 49, 126, 31 }, //Nullify Magic
+		{ 50, 18, 108 }, //Summon Food
+		{ 51, 125, 129 }, //Glimpse
+		{ 52, 18, 108 }, //Abundant Drink
+		{ 53, 18, 108 }, //Abundant Food
+		{ 54, 25, 14 }, //Frost Bolt
+		{ 55, 18, 108 }, //Cornucopia
+		{ 56, 18, 108 }, //Everfount
+		{ 57, 25, 38 }, //Firestrike
+		{ 58, 69, 100 }, //Elementalkin: Earth
+		{ 59, 126, 37 }, //Panic the Dead
+		{ 60, 95, 80 }, //Resist Fire
+		{ 61, 95, 80 }, //Resist Cold
+		{ 62, 95, 80 }, //Resist Poison
+		{ 63, 95, 80 }, //Resist Disease
+		{ 64, 95, 80 }, //Resist Magic
+		{ 65, 45, 87 }, //Major Shielding
+		{ 66, 45, 87 }, //Greater Shielding
+		{ 67, 45, 87 }, //Arch Shielding
+		{ 68, 25, 38 }, //Bolt of Flame
+		{ 69, 25, 38 }, //Cinder Bolt
+		{ 70, 25, 38 }, //Lava Bolt
+		{ 71, 25, 58 }, //Anarchy
+		{ 72, 95, 80 }, //Group Resist Magic
+		{ 73, 25, 58 }, //Gravity Flux
+		{ 74, 126, 60 }, //Mana Sieve
+		{ 75, 20, 29 }, //Sicken
+		{ 76, 126, 83 }, //Ensnaring Roots
+		{ 77, 126, 83 }, //Engulfing Roots
+		{ 78, 20, 38 }, //Immolate
+		{ 79, 125, 129 }, //Spirit Sight
+		{ 80, 125, 129 }, //See Invisible
+		{ 81, 79, 43 }, //Phantom Chain
+		{ 82, 79, 43 }, //Phantom Plate
+		{ 83, 25, 38 }, //Rain of Fire
+		{ 84, 125, 129 }, //Shifting Sight
+		{ 85, 25, 38 }, //Firestorm
+		{ 86, 125, 64 }, //Enduring Breath
+		{ 88, 25, 58 }, //Harm Touch
+		{ 89, 45, 46 }, //Daring
+		{ 90, 125, 129 }, //Shadow Sight
+		{ 91, 25, 38 }, //Ignite
+		{ 92, 25, 38 }, //Burst of Fire
+		{ 93, 25, 38 }, //Burst of Flame
+		{ 94, 25, 38 }, //Burn
+		{ 95, 42, 19 }, //Counteract Poison
+		{ 96, 42, 19 }, //Counteract Disease
+		{ 97, 42, 19 }, //Abolish Poison
+		{ 98, 42, 19 }, //Abolish Disease
+		{ 99, 20, 58 }, //Creeping Crud
+		{ 100, 18, 110 }, //Summon Throwing Dagger
+		{ 101, 18, 110 }, //Summon Arrows
+		{ 102, 18, 110 }, //Spear of Warding
+		{ 103, 18, 109 }, //Summon Coldstone
+		{ 104, 18, 110 }, //Dagger of Symbols
+		{ 105, 18, 109 }, //Summon Ring of Flight
+		{ 106, 69, 70 }, //Burnout II
+		{ 107, 69, 70 }, //Burnout III
+		{ 108, 95, 80 }, //Elemental Shield
+		{ 109, 95, 80 }, //Elemental Armor
+		{ 110, 126, 81 }, //Malaise
+		{ 111, 126, 81 }, //Malaisement
+		{ 112, 126, 81 }, //Malosi
+		{ 113, 25, 58 }, //Shock of Spikes
+		{ 114, 25, 58 }, //Shock of Swords
+		{ 115, 25, 111 }, //Dismiss Summoned
+		{ 116, 25, 111 }, //Banish Summoned
+		{ 117, 25, 124 }, //Dismiss Undead
+		{ 118, 25, 124 }, //Banish Undead
+		{ 120, 25, 38 }, //Blaze
+		{ 121, 25, 38 }, //Rain of Lava
+		{ 122, 25, 38 }, //Flame Arc
+		{ 123, 25, 97 }, //Holy Might
+		{ 124, 25, 97 }, //Force
+		{ 125, 25, 97 }, //Sound of Force
+		{ 126, 126, 37 }, //Inspire Fear
+		{ 127, 126, 37 }, //Invoke Fear
+		{ 128, 126, 37 }, //Wave of Fear
+		{ 129, 125, 21 }, //Shield of Brambles
+		{ 130, 125, 52 }, //Divine Barrier
+		{ 131, 126, 83 }, //Instill
+		{ 132, 126, 83 }, //Immobilize
+		{ 133, 126, 83 }, //Paralyzing Earth
+		{ 134, 126, 9 }, //Blinding Luminance
+		{ 135, 42, 42 }, //Word of Health
+		{ 136, 42, 42 }, //Word of Healing
+		{ 137, 79, 43 }, //Pack Regeneration
+		{ 138, 79, 43 }, //Pack Chloroplast
+		{ 139, 69, 70 }, //Feral Spirit
+		{ 140, 69, 70 }, //Savage Spirit
+		{ 141, 126, 13 }, //Beguile Animals
+		{ 142, 126, 13 }, //Allure of the Wild
+		{ 143, 126, 9 }, //Sunbeam
+		{ 144, 79, 43 }, //Regeneration
+		{ 145, 79, 43 }, //Chloroplast
+		{ 146, 95, 24 }, //Spirit of Monkey
+		{ 147, 95, 96 }, //Spirit Strength
+		{ 148, 95, 2 }, //Spirit of Cat
+		{ 149, 95, 94 }, //Spirit of Ox
+		{ 150, 95, 12 }, //Alluring Aura
+		{ 151, 95, 96 }, //Raging Strength
+		{ 152, 95, 24 }, //Deftness
+		{ 153, 95, 96 }, //Furious Strength
+		{ 154, 95, 2 }, //Agility
+		{ 155, 95, 12 }, //Glamour
+		{ 156, 95, 12 }, //Charisma
+		{ 157, 95, 24 }, //Dexterity
+		{ 158, 95, 94 }, //Stamina
+		{ 159, 95, 96 }, //Strength
+		{ 160, 95, 2 }, //Nimble
+		{ 161, 95, 94 }, //Health
+		{ 162, 126, 30 }, //Listless Power
+		{ 163, 126, 30 }, //Incapacitate
+		{ 164, 69, 104 }, //Companion Spirit
+		{ 165, 69, 104 }, //Guardian Spirit
+		{ 166, 69, 104 }, //Frenzied Spirit
+		{ 167, 45, 87 }, //Talisman of Tnarg
+		{ 168, 45, 87 }, //Talisman of Altuna
+		{ 169, 125, 65 }, //Pack Spirit
+		{ 170, 125, 41 }, //Alacrity
+		{ 171, 125, 41 }, //Celerity
+		{ 172, 125, 41 }, //Swift like the Wind
+		{ 173, 125, 3 }, //Benevolence
+		{ 174, 79, 59 }, //Clarity
+		{ 175, 95, 130 }, //Insight
+		{ 176, 125, 84 }, //Berserker Spirit
+		{ 177, 25, 97 }, //Color Shift
+		{ 178, 25, 97 }, //Color Skew
+		{ 179, 126, 30 }, //Feckless Might
+		{ 180, 126, 30 }, //Insipid Weakness
+		{ 181, 126, 30 }, //Weakness
+		{ 182, 126, 13 }, //Beguile
+		{ 183, 126, 13 }, //Cajoling Whispers
+		{ 184, 126, 13 }, //Allure
+		{ 185, 126, 88 }, //Tepid Deeds
+		{ 186, 126, 88 }, //Shiftless Deeds
+		{ 187, 126, 35 }, //Enthrall
+		{ 188, 126, 35 }, //Entrance
+		{ 189, 25, 38 }, //Flame Flux
+		{ 190, 126, 35 }, //Dazzle
+		{ 191, 125, 21 }, //Feedback
+		{ 192, 126, 63 }, //Mind Wipe
+		{ 193, 126, 63 }, //Blanket of Forgetfulness
+		{ 194, 126, 63 }, //Reoccurring Amnesia
+		{ 195, 20, 58 }, //Gasping Embrace
+		{ 196, 126, 13 }, //Dominate Undead
+		{ 197, 126, 13 }, //Beguile Undead
+		{ 198, 126, 13 }, //Cajole Undead
+		{ 199, 125, 52 }, //Harmshield
+		{ 200, 42, 42 }, //Minor Healing
+		{ 201, 126, 9 }, //Flash of Light
+		{ 202, 45, 46 }, //Courage
+		{ 203, 42, 19 }, //Cure Poison
+		{ 204, 25, 75 }, //Shock of Poison
+		{ 205, 125, 64 }, //True North
+		{ 207, 125, 52 }, //Divine Aura
+		{ 208, 126, 11 }, //Lull
+		{ 209, 126, 37 }, //Spook the Dead
+		{ 210, 95, 7 }, //Yaulp
+		{ 211, 18, 108 }, //Summon Drink
+		{ 212, 42, 19 }, //Cure Blindness
+		{ 213, 42, 19 }, //Cure Disease
+		{ 215, 95, 96 }, //Reckless Strength
+		{ 216, 25, 97 }, //Stun
+		{ 217, 25, 38 }, //Combust
+		{ 218, 25, 124 }, //Ward Undead
+		{ 219, 45, 46 }, //Center
+		{ 220, 125, 65 }, //Spirit of Cheetah
+		{ 221, 125, 64 }, //Sense the Dead
+		{ 222, 42, 94 }, //Invigor
+		{ 223, 18, 110 }, //Hammer of Wrath
+		{ 224, 95, 80 }, //Endure Fire
+		{ 225, 95, 80 }, //Endure Cold
+		{ 226, 95, 80 }, //Endure Disease
+		{ 227, 95, 80 }, //Endure Poison
+		{ 228, 95, 80 }, //Endure Magic
+		{ 229, 126, 37 }, //Fear
+		{ 230, 126, 83 }, //Root
+		{ 231, 25, 58 }, //Word of Pain
+		{ 232, 125, 111 }, //Sense Summoned
+		{ 233, 25, 124 }, //Expulse Undead
+		{ 234, 18, 109 }, //Halo of Light
+		{ 235, 125, 51 }, //Invisibility versus Undead
+		{ 236, 125, 84 }, //Shieldskin
+		{ 237, 18, 109 }, //Dance of the Fireflies
+		{ 238, 125, 4 }, //Sense Animals
+		{ 239, 20, 38 }, //Flame Lick
+		{ 240, 126, 11 }, //Lull Animal
+		{ 241, 126, 37 }, //Panic Animal
+		{ 242, 126, 89 }, //Snare
+		{ 243, 125, 49 }, //Illusion: Iksar
+		{ 244, 45, 46 }, //Bravery
+		{ 245, 126, 13 }, //Befriend Animal
+		{ 246, 45, 87 }, //Lesser Shielding
+		{ 247, 125, 51 }, //Camouflage
+		{ 248, 25, 111 }, //Ward Summoned
+		{ 249, 126, 83 }, //Grasping Roots
+		{ 250, 126, 11 }, //Harmony
+		{ 252, 25, 58 }, //Invoke Lightning
+		{ 253, 25, 58 }, //Whirling Wind
+		{ 254, 95, 7 }, //Firefist
+		{ 255, 125, 51 }, //Invisibility versus Animals
+		{ 256, 125, 21 }, //Shield of Thistles
+		{ 257, 18, 109 }, //Starshine
+		{ 258, 125, 48 }, //Treeform
+		{ 259, 20, 58 }, //Drones of Doom
+		{ 260, 126, 13 }, //Charm Animals
+		{ 261, 125, 55 }, //Levitate
+		{ 262, 25, 14 }, //Cascade of Hail
+		{ 263, 45, 46 }, //Skin like Rock
+		{ 264, 20, 58 }, //Stinging Swarm
+		{ 265, 125, 17 }, //Cannibalize
+		{ 266, 95, 24 }, //Dexterous Aura
+		{ 267, 45, 46 }, //Inner Fire
+		{ 268, 95, 96 }, //Strength of Earth
+		{ 269, 95, 2 }, //Feet like Cat
+		{ 270, 126, 88 }, //Drowsy
+		{ 271, 95, 96 }, //Fleeting Fury
+		{ 272, 18, 109 }, //Spirit Pouch
+		{ 273, 125, 21 }, //Shield of Barbs
+		{ 274, 95, 6 }, //Scale Skin
+		{ 275, 25, 14 }, //Frost Rift
+		{ 276, 125, 129 }, //Serpent Sight
+		{ 277, 20, 75 }, //Tainted Breath
+		{ 278, 125, 65 }, //Spirit of Wolf
+		{ 279, 95, 94 }, //Spirit of Bear
+		{ 280, 95, 96 }, //Burst of Strength
+		{ 281, 126, 30 }, //Disempower
+		{ 282, 25, 14 }, //Spirit Strike
+		{ 283, 95, 6 }, //Turtle Skin
+		{ 284, 95, 12 }, //Spirit of Snake
+		{ 285, 69, 99 }, //Pendril's Animation
+		{ 286, 20, 58 }, //Shallow Breath
+		{ 287, 125, 48 }, //Minor Illusion
+		{ 288, 45, 87 }, //Minor Shielding
+		{ 289, 126, 31 }, //Taper Enchantment
+		{ 290, 25, 97 }, //Color Flux
+		{ 291, 126, 30 }, //Enfeeblement
+		{ 292, 126, 35 }, //Mesmerize
+		{ 293, 95, 6 }, //Haze
+		{ 294, 20, 58 }, //Suffocating Sphere
+		{ 295, 69, 99 }, //Mircyl's Animation
+		{ 296, 25, 58 }, //Chaotic Feedback
+		{ 297, 126, 9 }, //Eye of Confusion
+		{ 298, 125, 3 }, //Alliance
+		{ 299, 125, 64 }, //Sentinel
+		{ 300, 126, 13 }, //Charm
+		{ 301, 126, 63 }, //Memory Blur
+		{ 302, 126, 88 }, //Languid Pace
+		{ 303, 25, 97 }, //Whirl till you hurl
+		{ 304, 126, 37 }, //Chase the Moon
+		{ 305, 125, 64 }, //Identify
+		{ 306, 25, 58 }, //Sanity Warp
+		{ 307, 126, 35 }, //Mesmerization
+		{ 308, 95, 96 }, //Frenzy
+		{ 309, 45, 87 }, //Shielding
+		{ 310, 125, 64 }, //Flare
+		{ 311, 18, 110 }, //Summon Dagger
+		{ 312, 45, 46 }, //Valor
+		{ 313, 25, 38 }, //Fire Flux
+		{ 314, 45, 46 }, //Resolution
+		{ 315, 69, 105 }, //Elementalkin: Water
+		{ 316, 69, 102 }, //Elementalkin: Fire
+		{ 317, 69, 98 }, //Elementalkin: Air
+		{ 318, 18, 109 }, //Summon Bandages
+		{ 319, 18, 110 }, //Summon Fang
+		{ 320, 18, 109 }, //Summon Heatstone
+		{ 321, 18, 109 }, //Summon Wisp
+		{ 322, 25, 38 }, //Flame Bolt
+		{ 323, 125, 129 }, //Eye of Zomm
+		{ 324, 25, 58 }, //Shock of Blades
+		{ 325, 18, 109 }, //Dimensional Pocket
+		{ 326, 95, 96 }, //Fury
+		{ 327, 69, 70 }, //Burnout
+		{ 328, 25, 38 }, //Column of Fire
+		{ 329, 25, 58 }, //Wrath
+		{ 330, 25, 58 }, //Rain of Blades
+		{ 331, 69, 64 }, //Reclaim Energy
+		{ 332, 125, 21 }, //Shield of Fire
+		{ 333, 79, 43 }, //Phantom Leather
+		{ 334, 25, 38 }, //Shock of Flame
+		{ 335, 69, 100 }, //Minor Summoning: Earth
+		{ 336, 69, 105 }, //Minor Summoning: Water
+		{ 337, 95, 96 }, //Rage
+		{ 338, 69, 103 }, //Cavorting Bones
+		{ 339, 18, 109 }, //Coldlight
+		{ 340, 20, 29 }, //Disease Cloud
+		{ 341, 114, 43 }, //Lifetap
+		{ 342, 125, 64 }, //Locate Corpse
+		{ 343, 114, 76 }, //Siphon Strength
+		{ 344, 20, 58 }, //Clinging Darkness
+		{ 345, 125, 64 }, //Shrink
+		{ 346, 95, 7 }, //Grim Aura
+		{ 347, 126, 11 }, //Numb the Dead
+		{ 348, 20, 75 }, //Poison Bolt
+		{ 349, 95, 24 }, //Rising Dexterity
+		{ 350, 25, 58 }, //Chaos Flux
+		{ 351, 69, 103 }, //Bone Walk
+		{ 352, 125, 129 }, //Deadeye
+		{ 353, 69, 42 }, //Mend Bones
+		{ 354, 125, 86 }, //Shadow Step
+		{ 355, 20, 58 }, //Engulfing Darkness
+		{ 356, 125, 21 }, //Shield of Thorns
+		{ 357, 42, 56 }, //Dark Empathy
+		{ 358, 95, 96 }, //Impart Strength
+		{ 359, 125, 16 }, //Vampiric Embrace
+		{ 360, 20, 38 }, //Heat Blood
+		{ 361, 125, 129 }, //Sight Graft
+		{ 362, 69, 103 }, //Convoke Shadow
+		{ 363, 126, 30 }, //Wave of Enfeeblement
+		{ 364, 125, 21 }, //Banshee Aura
+		{ 365, 20, 29 }, //Infectious Cloud
+		{ 366, 125, 64 }, //Feign Death
+		{ 367, 20, 29 }, //Heart Flutter
+		{ 368, 95, 6 }, //Spirit Armor
+		{ 369, 126, 83 }, //Hungry Earth
+		{ 370, 126, 30 }, //Shadow Vortex
+		{ 371, 125, 64 }, //Voice Graft
+		{ 372, 25, 14 }, //Blast of Cold
+		{ 373, 18, 109 }, //Sphere of Light
+		{ 374, 25, 14 }, //Numbing Cold
+		{ 375, 125, 86 }, //Fade
+		{ 376, 25, 38 }, //Shock of Fire
+		{ 377, 25, 14 }, //Icestrike
+		{ 378, 125, 21 }, //O'Keils Radiation
+		{ 379, 25, 38 }, //Fingers of Fire
+		{ 380, 25, 14 }, //Column of Frost
+		{ 381, 95, 80 }, //Resistant Skin
+		{ 382, 25, 14 }, //Frost Spiral of Al'Kabor
+		{ 383, 25, 58 }, //Shock of Lightning
+		{ 384, 125, 129 }, //Assiduous Vision
+		{ 385, 25, 58 }, //Project Lightning
+		{ 386, 25, 38 }, //Pillar of Fire
+		{ 387, 125, 84 }, //Leatherskin
+		{ 388, 42, 82 }, //Resuscitate
+		{ 389, 95, 6 }, //Guardian
+		{ 390, 18, 64 }, //Thicken Mana
+		{ 391, 42, 82 }, //Revive
+		{ 392, 42, 82 }, //Resurrection
+		{ 393, 125, 84 }, //Steelskin
+		{ 394, 125, 84 }, //Diamondskin
+		{ 395, 69, 102 }, //Minor Summoning: Fire
+		{ 396, 69, 98 }, //Minor Summoning: Air
+		{ 397, 69, 100 }, //Elementaling: Earth
+		{ 398, 69, 105 }, //Elementaling: Water
+		{ 399, 69, 102 }, //Elementaling: Fire
+		{ 400, 69, 98 }, //Elementaling: Air
+		{ 401, 69, 100 }, //Elemental: Earth
+		{ 402, 69, 105 }, //Elemental: Water
+		{ 403, 69, 102 }, //Elemental: Fire
+		{ 404, 69, 98 }, //Elemental: Air
+		{ 405, 25, 58 }, //Tremor
+		{ 406, 25, 58 }, //Earthquake
+		{ 407, 125, 129 }, //Cast Sight
+		{ 408, 126, 30 }, //Curse of the Simple Mind
+		{ 409, 25, 58 }, //Rain of Spikes
+		{ 410, 25, 58 }, //Rain of Swords
+		{ 411, 125, 21 }, //Shield of Flame
+		{ 412, 125, 21 }, //Shield of Lava
+		{ 413, 25, 58 }, //Word of Shadow
+		{ 414, 25, 58 }, //Word of Spirit
+		{ 415, 25, 58 }, //Word of Souls
+		{ 416, 25, 58 }, //Word Divine
+		{ 417, 42, 94 }, //Extinguish Fatigue
+		{ 418, 25, 58 }, //Lightning Strike
+		{ 419, 25, 58 }, //Careless Lightning
+		{ 420, 25, 58 }, //Lightning Blast
+		{ 421, 45, 46 }, //Skin like Steel
+		{ 422, 45, 46 }, //Skin like Diamond
+		{ 423, 45, 46 }, //Skin like Nature
+		{ 424, 125, 65 }, //Scale of Wolf
+		{ 425, 125, 65 }, //Wolf Form
+		{ 426, 125, 65 }, //Greater Wolf Form
+		{ 427, 125, 65 }, //Form of the Great Wolf
+		{ 428, 125, 65 }, //Share Wolf Form
+		{ 429, 95, 96 }, //Strength of Stone
+		{ 430, 95, 96 }, //Storm Strength
+		{ 431, 95, 6 }, //Shifting Shield
+		{ 432, 125, 21 }, //Shield of Spikes
+		{ 433, 25, 38 }, //Fire
+		{ 434, 20, 75 }, //Envenomed Breath
+		{ 435, 20, 75 }, //Venom of the Snake
+		{ 436, 20, 75 }, //Envenomed Bolt
+		{ 437, 25, 75 }, //Poison Storm
+		{ 438, 25, 75 }, //Gale of Poison
+		{ 439, 18, 64 }, //Crystallize Mana
+		{ 440, 69, 103 }, //Animate Dead
+		{ 441, 69, 103 }, //Summon Dead
+		{ 442, 69, 103 }, //Malignant Dead
+		{ 443, 69, 103 }, //Invoke Death
+		{ 444, 69, 42 }, //Renew Bones
+		{ 445, 114, 43 }, //Lifedraw
+		{ 446, 114, 43 }, //Siphon Life
+		{ 447, 114, 43 }, //Drain Soul
+		{ 448, 126, 11 }, //Rest the Dead
+		{ 449, 69, 70 }, //Intensify Death
+		{ 450, 20, 58 }, //Suffocate
+		{ 451, 20, 38 }, //Boil Blood
+		{ 452, 20, 58 }, //Dooming Darkness
+		{ 453, 20, 58 }, //Cascading Darkness
+		{ 454, 114, 33 }, //Vampiric Curse
+		{ 455, 126, 30 }, //Surge of Enfeeblement
+		{ 456, 114, 33 }, //Bond of Death
+		{ 457, 125, 55 }, //Dead Man Floating
+		{ 458, 25, 38 }, //Fire Spiral of Al'Kabor
+		{ 459, 25, 58 }, //Shock Spiral of Al'Kabor
+		{ 460, 25, 58 }, //Force Spiral of Al'Kabor
+		{ 461, 25, 58 }, //Cast Force
+		{ 462, 25, 38 }, //Column of Lightning
+		{ 463, 25, 38 }, //Circle of Force
+		{ 464, 25, 14 }, //Frost Shock
+		{ 465, 25, 38 }, //Inferno Shock
+		{ 466, 25, 58 }, //Lightning Shock
+		{ 467, 25, 58 }, //Lightning Storm
+		{ 468, 25, 58 }, //Energy Storm
+		{ 469, 25, 38 }, //Lava Storm
+		{ 470, 25, 58 }, //Thunder Strike
+		{ 471, 25, 58 }, //Thunderclap
+		{ 472, 126, 37 }, //Inspire Fear2
+		{ 473, 126, 37 }, //Invoke Fear II
+		{ 474, 126, 37 }, //Radius of Fear2
+		{ 475, 126, 37 }, //Fear2
+		{ 477, 25, 38 }, //Fire Bolt
+		{ 478, 125, 64 }, //Breath of the Dead
+		{ 479, 125, 21 }, //Inferno Shield
+		{ 480, 126, 63 }, //Atone
+		{ 481, 125, 84 }, //Rune I
+		{ 482, 125, 84 }, //Rune II
+		{ 483, 125, 84 }, //Rune III
+		{ 484, 125, 84 }, //Rune IV
+		{ 485, 45, 112 }, //Symbol of Transal
+		{ 486, 45, 112 }, //Symbol of Ryltan
+		{ 487, 45, 112 }, //Symbol of Pinzarn
+		{ 488, 45, 112 }, //Symbol of Naltron
+		{ 489, 95, 12 }, //Sympathetic Aura
+		{ 490, 126, 83 }, //Enveloping Roots
+		{ 491, 69, 103 }, //Leering Corpse
+		{ 492, 69, 103 }, //Restless Bones
+		{ 493, 69, 103 }, //Haunting Corpse
+		{ 494, 69, 103 }, //Invoke Shadow
+		{ 495, 69, 103 }, //Cackling Bones
+		{ 496, 69, 100 }, //Lesser Summoning: Earth
+		{ 497, 69, 105 }, //Lesser Summoning: Water
+		{ 498, 69, 102 }, //Lesser Summoning: Fire
+		{ 499, 69, 98 }, //Lesser Summoning: Air
+		{ 500, 125, 129 }, //Bind Sight
+		{ 501, 126, 11 }, //Soothe
+		{ 502, 114, 43 }, //Lifespike
+		{ 503, 25, 97 }, //Tishan's Clash
+		{ 504, 95, 96 }, //Frenzied Strength
+		{ 505, 126, 88 }, //Walking Sleep
+		{ 506, 126, 88 }, //Tagar's Insects
+		{ 507, 126, 88 }, //Togor's Insects
+		{ 508, 25, 14 }, //Frost Strike
+		{ 509, 25, 14 }, //Winter's Roar
+		{ 510, 25, 14 }, //Blizzard Blast
+		{ 511, 20, 29 }, //Affliction
+		{ 512, 126, 89 }, //Ensnare
+		{ 513, 126, 11 }, //Calm Animal
+		{ 514, 126, 37 }, //Terrorize Animal
+		{ 515, 125, 21 }, //Thistlecoat
+		{ 516, 125, 21 }, //Barbcoat
+		{ 517, 125, 21 }, //Bramblecoat
+		{ 518, 125, 21 }, //Spikecoat
+		{ 519, 125, 21 }, //Thorncoat
+		{ 520, 25, 58 }, //Dizzying Wind
+		{ 521, 20, 58 }, //Choke
+		{ 522, 125, 51 }, //Gather Shadows
+		{ 524, 114, 43 }, //Spirit Tap
+		{ 525, 114, 43 }, //Drain Spirit
+		{ 526, 126, 81 }, //Insidious Fever
+		{ 527, 126, 81 }, //Insidious Malady
+		{ 528, 125, 86 }, //Yonder
+		{ 529, 125, 129 }, //Gaze
+		{ 530, 123, 5 }, //Ring of Karana
+		{ 531, 123, 5 }, //Ring of Commons
+		{ 532, 123, 36 }, //Ring of Butcher
+		{ 533, 123, 67 }, //Ring of Toxxulia
+		{ 534, 123, 5 }, //Ring of Lavastorm
+		{ 535, 123, 5 }, //Ring of Ro
+		{ 536, 123, 5 }, //Ring of Feerrott
+		{ 537, 123, 36 }, //Ring of Steamfont
+		{ 538, 123, 5 }, //Ring of Misty
+		{ 539, 125, 129 }, //Chill Sight
+		{ 540, 18, 64 }, //Clarify Mana
+		{ 541, 123, 67 }, //Tox Gate
+		{ 542, 123, 5 }, //North Gate
+		{ 543, 123, 36 }, //Fay Gate
+		{ 544, 123, 5 }, //Common Gate
+		{ 545, 123, 5 }, //Nek Gate
+		{ 546, 123, 5 }, //Cazic Gate
+		{ 547, 123, 5 }, //Ro Gate
+		{ 548, 123, 5 }, //West Gate
+		{ 549, 126, 35 }, //Screaming Terror
+		{ 550, 123, 5 }, //Circle of Karana
+		{ 551, 123, 5 }, //Circle of Commons
+		{ 552, 123, 67 }, //Circle of Toxxulia
+		{ 553, 123, 36 }, //Circle of Butcher
+		{ 554, 123, 5 }, //Circle of Lavastorm
+		{ 555, 123, 5 }, //Circle of Ro
+		{ 556, 123, 5 }, //Circle of Feerrott
+		{ 557, 123, 36 }, //Circle of Steamfont
+		{ 558, 123, 5 }, //Circle of Misty
+		{ 559, 25, 38 }, //Ignite Bones
+		{ 560, 25, 58 }, //Furor
+		{ 561, 123, 67 }, //Tox Portal
+		{ 562, 123, 5 }, //North Portal
+		{ 563, 123, 36 }, //Fay Portal
+		{ 564, 123, 5 }, //Nek Portal
+		{ 565, 123, 5 }, //Cazic Portal
+		{ 566, 123, 5 }, //Common Portal
+		{ 567, 123, 5 }, //Ro Portal
+		{ 568, 123, 5 }, //West Portal
+		{ 569, 69, 100 }, //Summoning: Earth
+		{ 570, 69, 105 }, //Summoning: Water
+		{ 571, 69, 102 }, //Summoning: Fire
+		{ 572, 69, 98 }, //Summoning: Air
+		{ 573, 69, 100 }, //Greater Summoning: Earth
+		{ 574, 69, 105 }, //Greater Summoning: Water
+		{ 575, 69, 102 }, //Greater Summoning: Fire
+		{ 576, 69, 98 }, //Greater Summoning: Air
+		{ 577, 69, 104 }, //Vigilant Spirit
+		{ 578, 125, 129 }, //Sight
+		{ 579, 125, 129 }, //Magnify
+		{ 580, 125, 129 }, //Vision
+		{ 581, 125, 48 }, //Illusion: Skeleton
+		{ 582, 125, 49 }, //Illusion: Human
+		{ 583, 125, 49 }, //Illusion: Half-Elf
+		{ 584, 125, 48 }, //Illusion: Earth Elemental
+		{ 585, 125, 48 }, //Illusion: Werewolf
+		{ 586, 125, 49 }, //Illusion: Barbarian
+		{ 587, 125, 49 }, //Illusion: Erudite
+		{ 588, 125, 49 }, //Illusion: Wood Elf
+		{ 589, 125, 49 }, //Illusion: High Elf
+		{ 590, 125, 49 }, //Illusion: Dark Elf
+		{ 591, 125, 49 }, //Illusion: Dwarf
+		{ 592, 125, 49 }, //Illusion: Troll
+		{ 593, 125, 49 }, //Illusion: Ogre
+		{ 594, 125, 49 }, //Illusion: Halfling
+		{ 595, 125, 49 }, //Illusion: Gnome
+		{ 596, 125, 48 }, //Illusion: Dry Bone
+		{ 597, 125, 48 }, //Illusion: Air Elemental
+		{ 598, 125, 48 }, //Illusion: Fire Elemental
+		{ 599, 125, 48 }, //Illusion: Water Elemental
+		{ 600, 125, 48 }, //Illusion: Spirit Wolf
+		{ 601, 125, 48 }, //Illusion: Tree
+		{ 602, 123, 5 }, //Evacuate: North
+		{ 603, 123, 36 }, //Evacuate: Fay
+		{ 604, 123, 5 }, //Evacuate: Ro
+		{ 605, 123, 5 }, //Evacuate: Nek
+		{ 606, 123, 5 }, //Evacuate: West
+		{ 607, 123, 5 }, //Succor: East
+		{ 608, 123, 36 }, //Succor: Butcher
+		{ 609, 123, 5 }, //Succor: Ro
+		{ 610, 123, 5 }, //Succor: Lavastorm
+		{ 611, 123, 5 }, //Succor: North
+		{ 612, 25, 97 }, //Markar's Clash
+		{ 613, 18, 110 }, //Staff of Tracing
+		{ 614, 18, 110 }, //Staff of Warding
+		{ 615, 18, 110 }, //Staff of Runes
+		{ 616, 18, 110 }, //Staff of Symbols
+		{ 617, 18, 110 }, //Sword of Runes
+		{ 618, 18, 109 }, //Dimensional Hole
+		{ 619, 25, 97 }, //Dyn`s Dizzying Draught
+		{ 620, 69, 100 }, //Minor Conjuration: Earth
+		{ 621, 69, 105 }, //Minor Conjuration: Water
+		{ 622, 69, 102 }, //Minor Conjuration: Fire
+		{ 623, 69, 98 }, //Minor Conjuration: Air
+		{ 624, 69, 100 }, //Lesser Conjuration: Earth
+		{ 625, 69, 105 }, //Lesser Conjuration: Water
+		{ 626, 69, 102 }, //Lesser Conjuration: Fire
+		{ 627, 69, 98 }, //Lesser Conjuration: Air
+		{ 628, 69, 100 }, //Conjuration: Earth
+		{ 629, 69, 105 }, //Conjuration: Water
+		{ 630, 69, 102 }, //Conjuration: Fire
+		{ 631, 69, 98 }, //Conjuration: Air
+		{ 632, 69, 100 }, //Greater Conjuration: Earth
+		{ 633, 69, 105 }, //Greater Conjuration: Water
+		{ 634, 69, 102 }, //Greater Conjuration: Fire
+		{ 635, 69, 98 }, //Greater Conjuration: Air
+		{ 636, 126, 89 }, //Bonds of Force
+		{ 640, 125, 129 }, //Creeping Vision
+		{ 641, 125, 17 }, //Dark Pact
+		{ 642, 125, 17 }, //Allure of Death
+		{ 643, 125, 17 }, //Call of Bones
+		{ 644, 125, 17 }, //Lich
+		{ 645, 126, 30 }, //Ebbing Strength
+		{ 646, 95, 12 }, //Radiant Visage
+		{ 647, 95, 12 }, //Adorning Grace
+		{ 648, 125, 84 }, //Rampage
+		{ 649, 95, 6 }, //Protect
+		{ 650, 95, 6 }, //Mist
+		{ 651, 95, 6 }, //Cloud
+		{ 652, 95, 6 }, //Obscure
+		{ 653, 95, 6 }, //Shade
+		{ 654, 95, 6 }, //Shadow
+		{ 655, 125, 129 }, //Eyes of the Cat
+		{ 656, 25, 14 }, //Shock of Ice
+		{ 657, 25, 38 }, //Flame Shock
+		{ 658, 25, 14 }, //Ice Shock
+		{ 659, 25, 38 }, //Conflagration
+		{ 660, 25, 14 }, //Frost Storm
+		{ 661, 69, 70 }, //Augment Death
+		{ 662, 25, 124 }, //Expel Undead
+		{ 663, 25, 111 }, //Expulse Summoned
+		{ 664, 25, 111 }, //Expel Summoned
+		{ 665, 20, 58 }, //Drifting Death
+		{ 666, 123, 116 }, //Alter Plane: Hate
+		{ 667, 18, 34 }, //Enchant Silver
+		{ 668, 18, 34 }, //Enchant Electrum
+		{ 669, 18, 34 }, //Enchant Gold
+		{ 670, 18, 34 }, //Enchant Platinum
+		{ 671, 25, 38 }, //Starfire
+		{ 672, 25, 58 }, //Retribution
+		{ 673, 25, 58 }, //Discordant Mind
+		{ 674, 123, 116 }, //Alter Plane: Sky
+		{ 675, 18, 110 }, //Hammer of Requital
+		{ 676, 126, 81 }, //Tashan
+		{ 677, 126, 81 }, //Tashani
+		{ 678, 126, 81 }, //Tashania
+		{ 679, 125, 129 }, //Heat Sight
+		{ 680, 125, 21 }, //Barrier of Combustion
+		{ 681, 69, 99 }, //Juli`s Animation
+		{ 682, 69, 99 }, //Kilan`s Animation
+		{ 683, 69, 99 }, //Shalee`s Animation
+		{ 684, 69, 99 }, //Sisna`s Animation
+		{ 685, 69, 99 }, //Sagar`s Animation
+		{ 686, 69, 99 }, //Uleen`s Animation
+		{ 687, 69, 99 }, //Boltran`s Animation
+		{ 688, 69, 99 }, //Aanya's Animation
+		{ 689, 69, 99 }, //Yegoreff`s Animation
+		{ 690, 69, 99 }, //Kintaz`s Animation
+		{ 691, 25, 38 }, //Call of Flame
+		{ 692, 114, 43 }, //Life Leech
+		{ 693, 125, 16 }, //Divine Might
+		{ 694, 42, 56 }, //Pact of Shadow
+		{ 695, 18, 64 }, //Distill Mana
+		{ 696, 18, 64 }, //Purify Mana
+		{ 697, 79, 59 }, //Breeze
+		{ 698, 125, 64 }, //Track Corpse
+		{ 699, 25, 74 }, //Defoliate
+		{ 700, 125, 41 }, //Chant of Battle
+		{ 701, 125, 41 }, //Anthem de Arms
+		{ 702, 125, 41 }, //McVaxius` Berserker Crescendo
+		{ 703, 20, 58 }, //Chords of Dissonance
+		{ 704, 25, 58 }, //Brusco`s Boastful Bellow
+		{ 705, 126, 88 }, //Largo's Melodic Binding
+		{ 706, 126, 37 }, //Angstlich`s Appalling Screech
+		{ 707, 20, 58 }, //Fufil`s Curtailing Chant
+		{ 708, 125, 3 }, //Cinda`s Charismatic Carillon
+		{ 709, 95, 80 }, //Guardian Rhythms
+		{ 710, 95, 80 }, //Elemental Rhythms
+		{ 711, 95, 80 }, //Purifying Rhythms
+		{ 712, 125, 21 }, //Psalm of Warmth
+		{ 713, 125, 21 }, //Psalm of Cooling
+		{ 714, 95, 80 }, //Psalm of Mystic Shielding
+		{ 715, 125, 21 }, //Psalm of Vitality
+		{ 716, 125, 21 }, //Psalm of Purity
+		{ 717, 125, 65 }, //Selo`s Accelerando
+		{ 718, 125, 55 }, //Agilmente`s Aria of Eagles
+		{ 719, 125, 51 }, //Shauri`s Sonorous Clouding
+		{ 720, 125, 64 }, //Lyssa`s Locating Lyric
+		{ 721, 125, 129 }, //Lyssa`s Solidarity of Vision
+		{ 722, 42, 94 }, //Jaxan`s Jig o` Vigor
+		{ 723, 79, 59 }, //Cassindra's Chorus of Clarity
+		{ 724, 126, 35 }, //Kelin`s Lucid Lullaby
+		{ 725, 126, 13 }, //Solon's Song of the Sirens
+		{ 726, 126, 31 }, //Syvelian`s Anti-Magic Aria
+		{ 727, 126, 31 }, //Alenia`s Disenchanting Melody
+		{ 728, 126, 11 }, //Kelin`s Lugubrious Lament
+		{ 729, 125, 64 }, //Tarew`s Aquatic Ayre
+		{ 730, 20, 58 }, //Denon`s Disruptive Discord
+		{ 731, 25, 14 }, //Wrath of Al'Kabor
+		{ 732, 25, 14 }, //Ice Comet
+		{ 733, 25, 38 }, //Supernova
+		{ 734, 125, 41 }, //Jonthan's Whistling Warsong
+		{ 735, 125, 129 }, //Lyssa`s Veracious Concord
+		{ 736, 126, 60 }, //Denon`s Dissension
+		{ 737, 125, 64 }, //Lyssa`s Cataloging Libretto
+		{ 738, 126, 88 }, //Selo`s Consonant Chain
+		{ 739, 125, 86 }, //Melanie`s Mellifluous Motion
+		{ 740, 125, 41 }, //Vilia`s Verses of Celerity
+		{ 741, 126, 35 }, //Crission`s Pixie Strike
+		{ 742, 25, 58 }, //Denon`s Desperate Dirge
+		{ 743, 20, 38 }, //Tuyen`s Chant of Flame
+		{ 744, 20, 14 }, //Tuyen`s Chant of Frost
+		{ 745, 95, 130 }, //Cassindra`s Elegy
+		{ 746, 126, 88 }, //Selo`s Chords of Cessation
+		{ 747, 125, 41 }, //Verses of Victory
+		{ 748, 125, 64 }, //Niv`s Melody of Preservation
+		{ 749, 125, 41 }, //Jonthan's Provocation
+		{ 750, 126, 13 }, //Solon's Bewitching Bravura
+		{ 752, 126, 53 }, //Concussion
+		{ 753, 126, 13 }, //Beguile Plants
+		{ 754, 125, 17 }, //Cannibalize II
+		{ 755, 25, 58 }, //Rend
+		{ 761, 25, 75 }, //Contact Poison I
+		{ 763, 25, 75 }, //System Shock I
+		{ 767, 25, 124 }, //Liquid Silver I
+		{ 786, 25, 38 }, //Wurm Blaze
+		{ 792, 25, 38 }, //Fist of Fire
+		{ 793, 25, 58 }, //Fist of Air
+		{ 794, 25, 58 }, //Fist of Earth
+		{ 804, 25, 0 }, //Magi Bolt
+		{ 805, 25, 38 }, //Magi Strike
+		{ 807, 25, 58 }, //Magi Circle
+		{ 808, 25, 0 }, //Avatar Power
+		{ 812, 25, 58 }, //SumMonsterAttack
+		{ 817, 25, 0 }, //Guide Bolt
+		{ 823, 25, 58 }, //Divine Might Effect
+		{ 829, 25, 38 }, //FireHornet
+		{ 831, 25, 0 }, //Sathir's Gaze
+		{ 832, 25, 38 }, //WurmBreath
+		{ 834, 25, 0 }, //Sathir's Mesmerization
+		{ 835, 25, 58 }, //Chaos Breath
+		{ 837, 25, 58 }, //Stun Breath
+		{ 839, 25, 58 }, //Lightning Breath
+		{ 848, 25, 58 }, //Elemental Mastery Strike
+		{ 849, 25, 14 }, //ElementalMasteryBlast
+		{ 851, 25, 14 }, //Shardwurm Breath
+		{ 859, 25, 38 }, //Lava Breath - Test
+		{ 860, 25, 38 }, //DrakeBreath
+		{ 861, 25, 38 }, //Lava Breath
+		{ 862, 25, 14 }, //Frost Breath
+		{ 863, 25, 58 }, //Telekinesis
+		{ 868, 126, 35 }, //Sionachie`s Dreams
+		{ 893, 25, 58 }, //FireElementalAttack2
+		{ 904, 25, 58 }, //Knockback
+		{ 907, 25, 38 }, //DryBoneFireBurst
+		{ 908, 25, 14 }, //IceBoneFrostBurst
+		{ 910, 25, 38 }, //SnakeEleFireBurst
+		{ 917, 25, 38 }, //Smolder
+		{ 922, 25, 58 }, //Sonic
+		{ 929, 25, 58 }, //Harm Touch NPC
+		{ 931, 25, 58 }, //Life Drain
+		{ 945, 25, 58 }, //Ykesha
+		{ 951, 25, 38 }, //Fiery Death
+		{ 952, 25, 14 }, //Frosty Death
+		{ 966, 25, 38 }, //FireElementalAttack
+		{ 968, 25, 14 }, //WaterElementalAttack
+		{ 978, 25, 14 }, //FrostAOE
+		{ 982, 25, 0 }, //Cazic Touch
+		{ 985, 25, 0 }, //Efreeti Fire
+		{ 987, 25, 58 }, //Spiroc Thunder
+		{ 988, 25, 0 }, //Greater Spiroc Thunder
+		{ 989, 25, 0 }, //Entomb in Ice
+		{ 995, 25, 0 }, //Soul Devour
+		{ 1009, 25, 38 }, //FireBeetleSpit
+		{ 1017, 25, 38 }, //Fishnova
+		{ 1020, 25, 58 }, //Air Elemental Strike
+		{ 1021, 25, 14 }, //Water Elemental Strike
+		{ 1024, 25, 58 }, //Thunderclap
+		{ 1026, 25, 58 }, //Thunder Call
+		{ 1027, 25, 58 }, //Thunder Storm
+		{ 1028, 25, 58 }, //Static Storm
+		{ 1030, 25, 0 }, //Sand Storm
+		{ 1031, 25, 0 }, //Stone Gale
+		{ 1032, 25, 58 }, //Hail Storm
+		{ 1036, 25, 0 }, //Storm Flame
+		{ 1043, 25, 58 }, //Manastorm
+		{ 1045, 25, 58 }, //Chain Lightning
+		{ 1047, 25, 14 }, //Deluge
+		{ 1048, 25, 14 }, //Monsoons
+		{ 1049, 25, 58 }, //Tempest Wind
+		{ 1050, 25, 14 }, //Raging Blizzard
+		{ 1071, 25, 58 }, //Punishing Blow
+		{ 1074, 25, 38 }, //Steam Blast
+		{ 1075, 25, 58 }, //Electrical Short
+		{ 1077, 25, 0 }, //Mana Beam
+		{ 1078, 25, 58 }, //Gyrosonic Disruption
+		{ 1084, 25, 0 }, //Barrage of Debris
+		{ 1100, 126, 35 }, //Dreams of Ayonae
+		{ 1106, 20, 38 }, //Sear
+		{ 1107, 25, 58 }, //Tremor of Judgment
+		{ 1142, 25, 58 }, //Pain Harvest
+		{ 1144, 25, 58 }, //Jagged Rain
+		{ 1145, 25, 14 }, //Touch of Pain
+		{ 1151, 25, 0 }, //Raven Screech
+		{ 1155, 25, 58 }, //Black Symbol of Agony
+		{ 1167, 25, 38 }, //Draconic Rage Strike
+		{ 1168, 25, 38 }, //Draconic Rage Strike
+		{ 1172, 25, 75 }, //Sting of the Shissar
+		{ 1173, 25, 75 }, //Bite of the Shissar
+		{ 1180, 25, 124 }, //Zombie Bane
+		{ 1181, 25, 124 }, //Mayong's Bane
+		{ 1188, 25, 75 }, //Bixie Sting
+		{ 1189, 25, 75 }, //Scoriae Bite
+		{ 1194, 125, 49 }, //Illusion: Fier`dal
+		{ 1196, 79, 44 }, //Ancient: Lcea's Lament
+		{ 1197, 126, 35 }, //Ancient: Lullaby of Shadow
+		{ 1216, 25, 0 }, //Guide Bolt
+		{ 1221, 126, 53 }, //Terror of Darkness
+		{ 1222, 126, 53 }, //Terror of Shadows
+		{ 1223, 126, 53 }, //Terror of Death
+		{ 1224, 126, 53 }, //Terror of Terris
+		{ 1225, 125, 128 }, //Voice of Darkness
+		{ 1226, 125, 128 }, //Voice of Shadows
+		{ 1227, 125, 128 }, //Voice of Death
+		{ 1228, 125, 128 }, //Voice of Terris
+		{ 1244, 25, 0 }, //Magi Bolt
+		{ 1245, 25, 38 }, //Magi Strike
+		{ 1247, 25, 58 }, //Magi Circle
+		{ 1269, 25, 75 }, //Fangol's Breath
+		{ 1279, 25, 14 }, //Velium Chill of Al`Kabor
+		{ 1283, 42, 32 }, //Celestial Cleansing
+		{ 1284, 69, 71 }, //Valiant Companion
+		{ 1285, 69, 64 }, //Summon Companion
+		{ 1286, 69, 71 }, //Expedience
+		{ 1287, 79, 59 }, //Cassindra`s Chant of Clarity
+		{ 1288, 45, 47 }, //Divine Glory
+		{ 1289, 69, 70 }, //Strengthen Death
+		{ 1290, 42, 42 }, //Chloroblast
+		{ 1291, 42, 42 }, //Nature's Touch
+		{ 1296, 126, 53 }, //Cinder Jolt
+		{ 1310, 25, 8 }, //Porlos' Fury
+		{ 1311, 25, 8 }, //Hsagra's Wrath
+		{ 1314, 25, 58 }, //SpectraStun
+		{ 1317, 25, 58 }, //Repulse
+		{ 1325, 123, 54 }, //Combine Gate
+		{ 1326, 123, 54 }, //Ring of the Combines
+		{ 1332, 125, 17 }, //Cannibalize IV
+		{ 1334, 123, 64 }, //Translocate: Group
+		{ 1336, 123, 36 }, //Translocate: Fay
+		{ 1337, 123, 67 }, //Translocate: Tox
+		{ 1338, 123, 5 }, //Translocate: North
+		{ 1339, 123, 54 }, //Translocate: Combine
+		{ 1356, 25, 14 }, //Frosty Death2
+		{ 1359, 18, 34 }, //Enchant Clay
+		{ 1366, 25, 0 }, //Rage of the Sky
+		{ 1369, 25, 75 }, //Poisonous Chill
+		{ 1371, 123, 5 }, //Translocate: Nek
+		{ 1372, 123, 5 }, //Translocate: Common
+		{ 1373, 123, 5 }, //Translocate: Ro
+		{ 1374, 123, 5 }, //Translocate: West
+		{ 1375, 123, 5 }, //Translocate: Cazic
+		{ 1376, 125, 64 }, //Shroud of Undeath
+		{ 1377, 95, 7 }, //Primal Avatar
+		{ 1382, 18, 109 }, //Summon Holy Ale of Brell
+		{ 1391, 125, 55 }, //Dead Men Floating
+		{ 1392, 25, 58 }, //Fireburst
+		{ 1393, 114, 43 }, //Gangrenous Touch of Zum`uul
+		{ 1394, 25, 58 }, //Maelstrom of Electricity
+		{ 1397, 45, 47 }, //Strength of Nature
+		{ 1398, 123, 127 }, //Circle of Wakening Lands
+		{ 1399, 123, 127 }, //Wakening Lands Portal
+		{ 1400, 69, 64 }, //Monster Summoning I
+		{ 1401, 18, 109 }, //Summon Shard of the Core
+		{ 1402, 69, 64 }, //Monster Summoning II
+		{ 1403, 20, 58 }, //Elemental Maelstrom
+		{ 1404, 69, 64 }, //Monster Summoning III
+		{ 1405, 20, 58 }, //Wrath of the Elements
+		{ 1406, 125, 51 }, //Improved Invisibility
+		{ 1407, 126, 60 }, //Wandering Mind
+		{ 1408, 95, 59 }, //Gift of Magic
+		{ 1409, 95, 59 }, //Gift of Insight
+		{ 1410, 95, 59 }, //Gift of Brilliance
+		{ 1411, 125, 51 }, //Improved Invis to Undead
+		{ 1412, 20, 75 }, //Chilling Embrace
+		{ 1413, 42, 56 }, //Corporeal Empathy
+		{ 1414, 69, 70 }, //Augmentation of Death
+		{ 1415, 25, 75 }, //Torbas' Acid Blast
+		{ 1416, 125, 17 }, //Arch Lich
+		{ 1417, 123, 127 }, //Iceclad Gate
+		{ 1418, 123, 127 }, //Iceclad Portal
+		{ 1419, 125, 21 }, //O'Keils Flickering Flame
+		{ 1420, 125, 51 }, //Invisibility to Undead
+		{ 1421, 25, 38 }, //Enticement of Flame
+		{ 1422, 123, 64 }, //Translocate
+		{ 1423, 123, 127 }, //Great Divide Portal
+		{ 1425, 123, 127 }, //Cobalt Scar Portal
+		{ 1426, 25, 14 }, //Ice Spear of Solist
+		{ 1427, 25, 75 }, //Shock of the Tainted
+		{ 1428, 95, 96 }, //Tumultuous Strength
+		{ 1429, 25, 75 }, //Blast of Poison
+		{ 1430, 69, 70 }, //Spirit Quickening
+		{ 1431, 125, 48 }, //Form of the Great Bear
+		{ 1432, 45, 87 }, //Focus of Spirit
+		{ 1433, 123, 127 }, //Ring of Iceclad
+		{ 1434, 123, 127 }, //Circle of Iceclad
+		{ 1435, 125, 51 }, //Improved Superior Camouflage
+		{ 1436, 126, 81 }, //Fixation of Ro
+		{ 1437, 126, 81 }, //Ro's Fiery Sundering
+		{ 1438, 123, 127 }, //Circle of Great Divide
+		{ 1439, 25, 58 }, //Fury of Air
+		{ 1440, 123, 127 }, //Circle of Cobalt Scar
+		{ 1442, 45, 46 }, //Protection of the Glades
+		{ 1443, 20, 124 }, //Turning of the Unnatural
+		{ 1444, 42, 32 }, //Celestial Healing
+		{ 1445, 45, 87 }, //Armor of Protection
+		{ 1446, 25, 97 }, //Stun Command
+		{ 1447, 45, 1 }, //Aegolism
+		{ 1448, 79, 44 }, //Cantata of Soothing
+		{ 1449, 125, 41 }, //Melody of Ervaj
+		{ 1450, 125, 84 }, //Shield of Songs
+		{ 1451, 126, 81 }, //Occlusion of Sound
+		{ 1452, 125, 41 }, //Composition of Ervaj
+		{ 1453, 125, 17 }, //Divine Purpose
+		{ 1454, 25, 58 }, //Flame of Light
+		{ 1455, 42, 42 }, //Wave of Healing
+		{ 1456, 45, 47 }, //Divine Strength
+		{ 1457, 114, 76 }, //Shroud of Hate
+		{ 1458, 114, 76 }, //Shroud of Pain
+		{ 1459, 125, 16 }, //Shroud of Death
+		{ 1460, 125, 64 }, //Death Peace
+		{ 1461, 125, 16 }, //Call of Sky
+		{ 1462, 125, 21 }, //Call of Earth
+		{ 1463, 125, 16 }, //Call of Fire
+		{ 1464, 95, 7 }, //Call of the Predator
+		{ 1465, 25, 58 }, //Call of Sky Strike
+		{ 1467, 25, 38 }, //Call of Fire Strike
+		{ 1472, 69, 70 }, //Burnout IV
+		{ 1474, 125, 16 }, //Boon of the Garou
+		{ 1475, 69, 104 }, //Nature Walkers Behest
+		{ 1479, 25, 14 }, //Wave of Flame
+		{ 1480, 25, 0 }, //Silver Breath
+		{ 1481, 25, 58 }, //Scream of Chaos
+		{ 1482, 25, 58 }, //Electric Blast
+		{ 1484, 25, 14 }, //Tsunami
+		{ 1487, 25, 14 }, //Rain of Cold
+		{ 1488, 25, 38 }, //Rain of Molten Lava
+		{ 1489, 25, 14 }, //Wave of Cold
+		{ 1490, 25, 38 }, //Wave of Heat
+		{ 1494, 25, 38 }, //Flame Jet
+		{ 1498, 25, 14 }, //Doljons Rage
+		{ 1503, 18, 109 }, //Modulating Rod
+		{ 1504, 69, 42 }, //Renew Elements
+		{ 1505, 69, 42 }, //Renew Summoning
+		{ 1508, 20, 29 }, //Asystole
+		{ 1509, 114, 33 }, //Leach
+		{ 1510, 42, 56 }, //Shadow Compact
+		{ 1511, 126, 81 }, //Scent of Dusk
+		{ 1512, 126, 81 }, //Scent of Shadow
+		{ 1513, 126, 81 }, //Scent of Darkness
+		{ 1514, 42, 61 }, //Rapacious Subvention
+		{ 1515, 42, 61 }, //Covetous Subversion
+		{ 1516, 123, 54 }, //Combine Portal
+		{ 1517, 123, 54 }, //Circle of the Combines
+		{ 1518, 42, 42 }, //Remedy
+		{ 1519, 42, 42 }, //Divine Light
+		{ 1520, 42, 42 }, //Word of Vigor
+		{ 1521, 42, 42 }, //Word of Restoration
+		{ 1522, 42, 32 }, //Celestial Elixir
+		{ 1523, 42, 42 }, //Word of Redemption
+		{ 1524, 42, 82 }, //Reviviscence
+		{ 1525, 42, 19 }, //Antidote
+		{ 1526, 126, 31 }, //Annul Magic
+		{ 1527, 126, 37 }, //Trepidation
+		{ 1528, 25, 124 }, //Exile Undead
+		{ 1529, 25, 111 }, //Exile Summoned
+		{ 1530, 25, 23 }, //Banishment of Shadows
+		{ 1531, 25, 23 }, //Banishment
+		{ 1532, 126, 37 }, //Dread of Night
+		{ 1533, 45, 46 }, //Heroism
+		{ 1534, 95, 7 }, //Yaulp IV
+		{ 1535, 45, 112 }, //Symbol of Marzin
+		{ 1536, 45, 46 }, //Heroic Bond
+		{ 1537, 95, 6 }, //Bulwark of Faith
+		{ 1538, 45, 46 }, //Heroic Bond
+		{ 1539, 45, 46 }, //Fortitude
+		{ 1540, 95, 6 }, //Aegis
+		{ 1541, 126, 11 }, //Wake of Tranquility
+		{ 1542, 25, 58 }, //Upheaval
+		{ 1543, 25, 58 }, //Reckoning
+		{ 1544, 25, 97 }, //Enforced Reverence
+		{ 1545, 25, 97 }, //The Unspoken Word
+		{ 1546, 125, 64 }, //Divine Intervention
+		{ 1547, 125, 64 }, //Death Pact
+		{ 1548, 125, 64 }, //Mark of Karn
+		{ 1550, 126, 37 }, //Repulse Animal
+		{ 1551, 95, 80 }, //Circle of Winter
+		{ 1552, 95, 80 }, //Circle of Summer
+		{ 1553, 126, 13 }, //Call of Karana
+		{ 1554, 125, 65 }, //Spirit of Scale
+		{ 1555, 126, 81 }, //Glamour of Tunare
+		{ 1556, 126, 13 }, //Tunare's Request
+		{ 1557, 95, 96 }, //Girdle of Karana
+		{ 1558, 125, 21 }, //Bladecoat
+		{ 1559, 45, 46 }, //Natureskin
+		{ 1560, 125, 21 }, //Shield of Blades
+		{ 1561, 125, 21 }, //Legacy of Thorn
+		{ 1562, 125, 65 }, //Form of the Howler
+		{ 1563, 125, 65 }, //Form of the Hunter
+		{ 1564, 125, 48 }, //Spirit of Oak
+		{ 1565, 79, 59 }, //Mask of the Hunter
+		{ 1566, 123, 64 }, //Egress
+		{ 1567, 123, 64 }, //Succor
+		{ 1568, 79, 43 }, //Regrowth
+		{ 1569, 79, 43 }, //Regrowth of the Grove
+		{ 1570, 95, 80 }, //Talisman of Jasinth
+		{ 1571, 95, 80 }, //Talisman of Shadoo
+		{ 1572, 125, 17 }, //Cannibalize III
+		{ 1573, 126, 81 }, //Insidious Decay
+		{ 1574, 69, 104 }, //Spirit of the Howler
+		{ 1575, 125, 129 }, //Acumen
+		{ 1576, 42, 32 }, //Torpor
+		{ 1577, 126, 81 }, //Malosini
+		{ 1578, 126, 81 }, //Malo
+		{ 1579, 95, 2 }, //Talisman of the Cat
+		{ 1580, 95, 94 }, //Talisman of the Brute
+		{ 1581, 95, 96 }, //Talisman of the Rhino
+		{ 1582, 95, 12 }, //Talisman of the Serpent
+		{ 1583, 95, 24 }, //Talisman of the Raptor
+		{ 1584, 95, 6 }, //Shroud of the Spirits
+		{ 1585, 45, 87 }, //Talisman of Kragg
+		{ 1586, 25, 14 }, //Ice Strike
+		{ 1587, 25, 75 }, //Torrent of Poison
+		{ 1588, 126, 88 }, //Turgur's Insects
+		{ 1589, 126, 88 }, //Tigir's Insects
+		{ 1590, 20, 75 }, //Bane of Nife
+		{ 1591, 20, 29 }, //Pox of Bertoxxulous
+		{ 1592, 126, 30 }, //Cripple
+		{ 1593, 95, 96 }, //Maniacal Strength
+		{ 1594, 95, 2 }, //Deliriously Nimble
+		{ 1595, 95, 94 }, //Riotous Health
+		{ 1596, 95, 24 }, //Mortal Deftness
+		{ 1597, 95, 12 }, //Unfailing Reverence
+		{ 1598, 95, 7 }, //Avatar
+		{ 1599, 95, 96 }, //Voice of the Berserker
+		{ 1600, 20, 38 }, //Breath of Ro
+		{ 1601, 20, 58 }, //Winged Death
+		{ 1602, 25, 14 }, //Blizzard
+		{ 1603, 25, 38 }, //Scoriae
+		{ 1604, 25, 58 }, //Breath of Karana
+		{ 1605, 25, 14 }, //Frost
+		{ 1606, 25, 58 }, //Fist of Karana
+		{ 1607, 25, 38 }, //Wildfire
+		{ 1608, 126, 83 }, //Entrapping Roots
+		{ 1609, 125, 84 }, //Manaskin
+		{ 1610, 45, 87 }, //Shield of the Magi
+		{ 1611, 125, 17 }, //Demi Lich
+		{ 1612, 125, 52 }, //Quivering Veil of Xarn
+		{ 1613, 114, 43 }, //Deflux
+		{ 1614, 25, 14 }, //Chill Bones
+		{ 1615, 20, 29 }, //Cessation of Cor
+		{ 1616, 114, 33 }, //Vexing Mordinia
+		{ 1617, 20, 38 }, //Pyrocruor
+		{ 1618, 114, 43 }, //Touch of Night
+		{ 1619, 20, 58 }, //Devouring Darkness
+		{ 1620, 20, 58 }, //Splurt
+		{ 1621, 69, 103 }, //Minion of Shadows
+		{ 1622, 69, 103 }, //Servant of Bones
+		{ 1623, 69, 103 }, //Emissary of Thule
+		{ 1624, 126, 13 }, //Thrall of Bones
+		{ 1625, 125, 51 }, //Skin of the Shadow
+		{ 1626, 123, 64 }, //Levant
+		{ 1627, 123, 64 }, //Abscond
+		{ 1628, 123, 64 }, //Evacuate
+		{ 1629, 126, 13 }, //Enslave Death
+		{ 1630, 25, 74 }, //Defoliation
+		{ 1631, 126, 89 }, //Atol's Spectral Shackles
+		{ 1632, 125, 129 }, //Plainsight
+		{ 1633, 126, 83 }, //Fetter
+		{ 1634, 25, 97 }, //Tishan's Discord
+		{ 1635, 25, 97 }, //Markar's Discord
+		{ 1636, 25, 58 }, //Invert Gravity
+		{ 1637, 25, 38 }, //Draught of Fire
+		{ 1638, 25, 38 }, //Lure of Flame
+		{ 1639, 25, 58 }, //Voltaic Draught
+		{ 1640, 25, 58 }, //Lure of Lightning
+		{ 1641, 25, 14 }, //Draught of Ice
+		{ 1642, 25, 14 }, //Lure of Frost
+		{ 1643, 25, 58 }, //Draught of Jiva
+		{ 1644, 25, 38 }, //Pillar of Flame
+		{ 1645, 25, 58 }, //Pillar of Lightning
+		{ 1646, 25, 14 }, //Pillar of Frost
+		{ 1647, 25, 14 }, //Tears of Prexus
+		{ 1648, 25, 38 }, //Tears of Solusek
+		{ 1649, 25, 58 }, //Tears of Druzzil
+		{ 1650, 25, 38 }, //Inferno of Al'Kabor
+		{ 1651, 25, 14 }, //Retribution of Al'Kabor
+		{ 1652, 25, 58 }, //Vengeance of Al'Kabor
+		{ 1653, 25, 58 }, //Jyll's Static Pulse
+		{ 1654, 25, 14 }, //Jyll's Zephyr of Ice
+		{ 1655, 25, 38 }, //Jyll's Wave of Heat
+		{ 1656, 25, 58 }, //Thunderbold
+		{ 1657, 25, 14 }, //Winds of Gelid
+		{ 1658, 25, 38 }, //Sunstrike
+		{ 1659, 25, 38 }, //Scintillation
+		{ 1660, 25, 38 }, //Char
+		{ 1661, 25, 38 }, //Scars of Sigil
+		{ 1662, 25, 38 }, //Sirocco
+		{ 1663, 25, 58 }, //Shock of Steel
+		{ 1664, 25, 38 }, //Seeking Flame of Seukor
+		{ 1665, 25, 58 }, //Manastorm
+		{ 1666, 79, 43 }, //Phantom Armor
+		{ 1667, 125, 21 }, //Cadeau of Flame
+		{ 1668, 125, 21 }, //Boon of Immolation
+		{ 1669, 125, 21 }, //Aegis of Ro
+		{ 1670, 69, 71 }, //Velocity
+		{ 1671, 69, 100 }, //Vocarate: Earth
+		{ 1672, 69, 105 }, //Vocarate: Water
+		{ 1673, 69, 102 }, //Vocarate: Fire
+		{ 1674, 69, 98 }, //Vocarate: Air
+		{ 1675, 69, 100 }, //Greater Vocaration: Earth
+		{ 1676, 69, 105 }, //Greater Vocaration: Water
+		{ 1677, 69, 102 }, //Greater Vocaration: Fire
+		{ 1678, 69, 98 }, //Greater Vocaration: Air
+		{ 1679, 69, 64 }, //Dyzil's Deafening Decoy
+		{ 1680, 18, 108 }, //Gift of Xev
+		{ 1681, 18, 109 }, //Bristlebane's Bundle
+		{ 1682, 18, 110 }, //Quiver of Marr
+		{ 1683, 18, 110 }, //Bandoleer of Luclin
+		{ 1684, 18, 110 }, //Pouch of Quellious
+		{ 1685, 18, 64 }, //Muzzle of Mardu
+		{ 1686, 126, 60 }, //Theft of Thought
+		{ 1687, 125, 3 }, //Collaboration
+		{ 1688, 95, 130 }, //Enlightenment
+		{ 1689, 125, 84 }, //Rune V
+		{ 1690, 126, 35 }, //Fascination
+		{ 1691, 126, 35 }, //Glamour of Kintaz
+		{ 1692, 126, 35 }, //Rapture
+		{ 1693, 79, 59 }, //Clarity II
+		{ 1694, 79, 59 }, //Boon of the Clear Mind
+		{ 1695, 79, 59 }, //Gift of Pure Thought
+		{ 1696, 25, 97 }, //Color Slant
+		{ 1697, 126, 31 }, //Recant Magic
+		{ 1698, 25, 58 }, //Dementia
+		{ 1699, 126, 81 }, //Wind of Tashani
+		{ 1700, 20, 58 }, //Torment of Argli
+		{ 1701, 95, 12 }, //Overwhelming Splendor
+		{ 1702, 126, 81 }, //Tashanian
+		{ 1703, 20, 58 }, //Asphyxiate
+		{ 1704, 126, 81 }, //Wind of Tashanian
+		{ 1705, 126, 13 }, //Boltran`s Agacerie
+		{ 1707, 126, 13 }, //Dictate
+		{ 1708, 125, 41 }, //Aanya's Quickening
+		{ 1709, 125, 41 }, //Wonderous Rapidity
+		{ 1710, 125, 41 }, //Visions of Grandeur
+		{ 1711, 95, 6 }, //Umbra
+		{ 1712, 126, 88 }, //Forlorn Deeds
+		{ 1713, 125, 84 }, //Bedlam
+		{ 1714, 126, 63 }, //Memory Flux
+		{ 1715, 126, 60 }, //Largarn's Lamentation
+		{ 1716, 126, 81 }, //Scent of Terris
+		{ 1717, 42, 56 }, //Shadowbond
+		{ 1718, 42, 61 }, //Sedulous Subversion
+		{ 1719, 126, 83 }, //Engorging Roots
+		{ 1720, 125, 129 }, //Eye of Tallon
+		{ 1721, 69, 99 }, //Unswerving Hammer of Faith
+		{ 1722, 69, 99 }, //Flaming Sword of Xuzl
+		{ 1723, 69, 99 }, //Zumaik`s Animation
+		{ 1724, 25, 23 }, //Disintegrate
+		{ 1725, 125, 64 }, //Wake of Karana
+		{ 1726, 125, 51 }, //Sunskin
+		{ 1727, 125, 21 }, //Legacy of Spike
+		{ 1728, 125, 93 }, //Manasink
+		{ 1729, 125, 41 }, //Augment
+		{ 1733, 42, 82 }, //Convergence
+		{ 1734, 42, 61 }, //Infusion
+		{ 1735, 114, 43 }, //Trucidation
+		{ 1736, 123, 54 }, //Wind of the North
+		{ 1737, 123, 54 }, //Wind of the South
+		{ 1738, 123, 54 }, //Tishan's Relocation
+		{ 1739, 123, 54 }, //Markar's Relocation
+		{ 1740, 25, 58 }, //Dustdevil
+		{ 1741, 126, 53 }, //Jolt
+		{ 1742, 125, 55 }, //Bobbing Corpse
+		{ 1743, 45, 47 }, //Divine Favor
+		{ 1744, 42, 61 }, //Harvest
+		{ 1747, 25, 58 }, //Brusco`s Bombastic Bellow
+		{ 1748, 20, 58 }, //Angstlich's Assonance
+		{ 1749, 125, 52 }, //Kazumi's Note of Preservation
+		{ 1750, 125, 65 }, //Selo`s Song of Travel
+		{ 1751, 126, 88 }, //Largo`s Absonant Binding
+		{ 1752, 125, 84 }, //Nillipus` March of the Wee
+		{ 1753, 126, 35 }, //Song of Twilight
+		{ 1754, 126, 35 }, //Song of Dawn
+		{ 1755, 125, 86 }, //Song of Highsun
+		{ 1756, 126, 37 }, //Song of Midnight
+		{ 1757, 125, 41 }, //Vilia`s Chorus of Celerity
+		{ 1758, 126, 88 }, //Selo`s Assonant Strane
+		{ 1759, 79, 44 }, //Cantata of Replenishment
+		{ 1760, 125, 21 }, //McVaxius` Rousing Rondo
+		{ 1761, 126, 60 }, //Cassindra's Insipid Ditty
+		{ 1762, 125, 41 }, //Jonthan's Inspiration
+		{ 1763, 95, 6 }, //Niv`s Harmonic
+		{ 1764, 20, 75 }, //Denon`s Bereavement
+		{ 1765, 95, 12 }, //Solon's Charismatic Concord
+		{ 1767, 126, 89 }, //Bonds of Tunare
+		{ 1768, 18, 50 }, //Sacrifice
+		{ 1769, 25, 14 }, //Lure of Ice
+		{ 1770, 69, 64 }, //Rage of Zomm
+		{ 1771, 125, 64 }, //Call of the Hero
+		{ 1772, 126, 81 }, //Mala
+		{ 1773, 125, 64 }, //Conjure Corpse
+		{ 1774, 45, 112 }, //Naltron's Mark
+		{ 1776, 125, 65 }, //Spirit of Wolf
+		{ 1784, 25, 14 }, //Velium Shards
+		{ 1785, 25, 38 }, //Flamesong
+		{ 1793, 25, 14 }, //Judgment of Ice
+		{ 1794, 25, 14 }, //Shards of Sorrow
+		{ 1797, 18, 34 }, //Enchant Velium
+		{ 1798, 18, 50 }, //Imbue Opal
+		{ 1799, 18, 50 }, //Imbue Topaz
+		{ 1800, 18, 50 }, //Imbue Plains Pebble
+		{ 1802, 25, 0 }, //Storm Strike
+		{ 1803, 25, 58 }, //Shrieking Howl
+		{ 1807, 25, 58 }, //Stunning Blow
+		{ 1812, 25, 0 }, //Nature's Wrath
+		{ 1815, 25, 38 }, //Flames of Ro
+		{ 1819, 95, 96 }, //Primal Essence
+		{ 1820, 25, 58 }, //Divine Wrath
+		{ 1827, 25, 14 }, //Frost Shards
+		{ 1831, 125, 64 }, //Diminution
+		{ 1834, 25, 75 }, //Poison Animal I
+		{ 1835, 25, 75 }, //Poison Summoned I
+		{ 1843, 25, 75 }, //Poison Animal II
+		{ 1844, 25, 75 }, //Poison Animal III
+		{ 1845, 25, 75 }, //Poison Summoned II
+		{ 1846, 25, 75 }, //Poison Summoned III
+		{ 1853, 25, 75 }, //Contact Poison II
+		{ 1854, 25, 75 }, //Contact Poison III
+		{ 1855, 25, 75 }, //Contact Poison IV
+		{ 1860, 25, 75 }, //System Shock II
+		{ 1861, 25, 75 }, //System Shock III
+		{ 1862, 25, 75 }, //System Shock IV
+		{ 1870, 25, 124 }, //Liquid Silver II
+		{ 1871, 25, 124 }, //Liquid Silver III
+		{ 1874, 125, 64 }, //Ant Legs
+		{ 1881, 25, 75 }, //System Shock V
+		{ 1884, 18, 50 }, //Imbue Ivory
+		{ 1885, 18, 50 }, //Imbue Amber
+		{ 1886, 18, 50 }, //Imbue Sapphire
+		{ 1887, 18, 50 }, //Imbue Ruby
+		{ 1888, 18, 50 }, //Imbue Emerald
+		{ 1889, 18, 34 }, //Enchant Mithril
+		{ 1890, 18, 34 }, //Enchant Adamantite
+		{ 1891, 18, 50 }, //Imbue Jade
+		{ 1892, 18, 34 }, //Enchant Steel
+		{ 1893, 18, 34 }, //Enchant Brellium
+		{ 1894, 18, 50 }, //Imbue Black Pearl
+		{ 1895, 18, 50 }, //Imbue Diamond
+		{ 1896, 18, 50 }, //Imbue Rose Quartz
+		{ 1897, 18, 50 }, //Imbue Black Sapphire
+		{ 1898, 18, 50 }, //Imbue Peridot
+		{ 1899, 18, 50 }, //Imbue Fire Opal
+		{ 1941, 25, 38 }, //Lava Breath
+		{ 1942, 25, 14 }, //Frost Breath
+		{ 1943, 25, 38 }, //Molten Breath
+		{ 1944, 18, 110 }, //Summon Orb
+		{ 1947, 25, 14 }, //Ice Rend
+		{ 1948, 25, 0 }, //Destroy
+		{ 1953, 25, 58 }, //Mastodon Stomp
+		{ 1954, 25, 0 }, //Devour Soul
+		{ 1955, 25, 38 }, //DrakeBreathBig
+		{ 1957, 25, 58 }, //Holy Shock
+		{ 1968, 25, 58 }, //Stunning Strike
+		{ 1969, 25, 38 }, //Flame of the Efreeti
+		{ 1970, 25, 58 }, //Verlekarnorm's Disaster
+		{ 1971, 25, 58 }, //Rocksmash
+		{ 2005, 25, 58 }, //Nature's Holy Wrath
+		{ 2006, 25, 58 }, //Static
+		{ 2014, 25, 38 }, //Incinerate Bones
+		{ 2015, 25, 14 }, //Conglaciation of Bone
+		{ 2016, 25, 58 }, //Dementing Visions
+		{ 2019, 25, 58 }, //Thunder Strike
+		{ 2020, 123, 5 }, //Circle of Surefall Glade
+		{ 2021, 123, 5 }, //Ring of Surefall Glade
+		{ 2022, 123, 127 }, //Translocate: Iceclad
+		{ 2023, 123, 127 }, //Translocate: Great Divide
+		{ 2024, 123, 127 }, //Translocate: Wakening Lands
+		{ 2025, 123, 127 }, //Translocate: Cobalt Scar
+		{ 2026, 123, 127 }, //Great Divide Gate
+		{ 2027, 123, 127 }, //Wakening Lands Gate
+		{ 2028, 123, 127 }, //Cobalt Scar Gate
+		{ 2029, 123, 127 }, //Ring of Great Divide
+		{ 2030, 123, 127 }, //Ring of Wakening Lands
+		{ 2031, 123, 127 }, //Ring of Cobalt Scar
+		{ 2035, 25, 75 }, //Tentacle Sting
+		{ 2036, 25, 0 }, //Rain of the Arch Mage
+		{ 2040, 25, 58 }, //Winds of the Archmage
+		{ 2043, 25, 75 }, //Kambooz's Touch
+		{ 2047, 25, 0 }, //Death Shackles
+		{ 2048, 25, 58 }, //Ssraeshza's Command
+		{ 2054, 25, 14 }, //Icy Claws
+		{ 2068, 25, 14 }, //Blast of Frost
+		{ 2070, 25, 38 }, //Marauder's Wrath
+		{ 2075, 25, 29 }, //Umbral Rot
+		{ 2076, 25, 0 }, //Presence of Ssraeshza
+		{ 2085, 25, 0 }, //Lesser Infusion
+		{ 2086, 25, 0 }, //Infusion
+		{ 2087, 25, 0 }, //Greater Infusion
+		{ 2091, 25, 0 }, //Lesser Rejuvenation
+		{ 2092, 25, 0 }, //Rejuvination
+		{ 2093, 25, 0 }, //Greater Rejuvenation
+		{ 2094, 25, 0 }, //Zruk Breath
+		{ 2101, 25, 0 }, //Pain and Suffering
+		{ 2102, 25, 75 }, //Drake Breath
+		{ 2103, 25, 38 }, //Drake Breath
+		{ 2104, 25, 14 }, //Drake Breath
+		{ 2105, 25, 29 }, //Drake Breath
+		{ 2106, 25, 0 }, //Gift of A'err
+		{ 2109, 45, 87 }, //Ancient: High Priest's Bulwark
+		{ 2110, 45, 46 }, //Skin like Wood
+		{ 2111, 25, 38 }, //Burst of Flame
+		{ 2112, 95, 7 }, //Ancient: Feral Avatar
+		{ 2113, 20, 75 }, //Ancient: Scourge of Nife
+		{ 2114, 125, 17 }, //Ancient: Master of Death
+		{ 2115, 25, 75 }, //Ancient: Lifebane
+		{ 2116, 25, 14 }, //Ancient: Destruction of Ice
+		{ 2117, 126, 53 }, //Ancient: Greater Concussion
+		{ 2118, 25, 38 }, //Ancient: Shock of Sun
+		{ 2119, 69, 70 }, //Ancient: Burnout Blaze
+		{ 2120, 126, 35 }, //Ancient: Eternal Rapture
+		{ 2121, 25, 58 }, //Ancient: Chaotic Visions
+		{ 2122, 45, 1 }, //Ancient: Gift of Aegolism
+		{ 2125, 125, 21 }, //Ancient: Legacy of Blades
+		{ 2126, 25, 38 }, //Ancient: Starfire of Ro
+		{ 2127, 25, 0 }, //Tragedy at Cazic Thule
+		{ 2130, 25, 58 }, //Horrific Force
+		{ 2131, 25, 58 }, //Vortex of Horror
+		{ 2137, 25, 75 }, //Rain of Terror
+		{ 2139, 125, 64 }, //Corpse Breath
+		{ 2156, 25, 0 }, //Deadly Curse of Noqufiel
+		{ 2157, 25, 58 }, //Word of Command
+		{ 2161, 25, 58 }, //Shock of Shadows
+		{ 2162, 25, 58 }, //Black Winds
+		{ 2163, 25, 58 }, //Lure of Shadows
+		{ 2167, 25, 0 }, //Fling
+		{ 2168, 42, 82 }, //Reanimation
+		{ 2169, 42, 82 }, //Reconstitution
+		{ 2170, 42, 82 }, //Reparation
+		{ 2171, 42, 82 }, //Renewal
+		{ 2172, 42, 82 }, //Restoration
+		{ 2173, 25, 0 }, //Hand of the Gods
+		{ 2175, 42, 32 }, //Celestial Health
+		{ 2176, 79, 44 }, //Spiritual Light
+		{ 2177, 79, 44 }, //Spiritual Radiance
+		{ 2178, 45, 47 }, //Spiritual Brawn
+		{ 2179, 42, 42 }, //Tunare's Renewal
+		{ 2180, 42, 32 }, //Ethereal Elixir
+		{ 2181, 18, 110 }, //Hammer of Judgment
+		{ 2182, 42, 42 }, //Ethereal Light
+		{ 2183, 123, 64 }, //Lesser Succor
+		{ 2184, 123, 64 }, //Lesser Evacuate
+		{ 2188, 45, 46 }, //Protection of the Cabbage
+		{ 2190, 25, 97 }, //Divine Stun
+		{ 2202, 125, 93 }, //Mana Shield
+		{ 2203, 125, 64 }, //Donlo's Dementia
+		{ 2206, 25, 38 }, //Tortured Memory
+		{ 2213, 125, 64 }, //Lesser Summon Corpse
+		{ 2230, 18, 107 }, //Summon Brass Choker
+		{ 2231, 18, 107 }, //Summon Silver Choker
+		{ 2232, 18, 107 }, //Summon Golden Choker
+		{ 2233, 18, 107 }, //Summon Linen Mantle
+		{ 2234, 18, 107 }, //Summon Leather Mantle
+		{ 2235, 18, 107 }, //Summon Silken Mantle
+		{ 2236, 18, 107 }, //Summon Jade Bracelet
+		{ 2237, 18, 107 }, //Summon Opal Bracelet
+		{ 2238, 18, 107 }, //Summon Ruby Bracelet
+		{ 2239, 18, 107 }, //Summon Tiny Ring
+		{ 2240, 18, 107 }, //Summon Twisted Ring
+		{ 2241, 18, 107 }, //Summon Studded Ring
+		{ 2242, 18, 107 }, //Summon Tarnished Bauble
+		{ 2243, 18, 107 }, //Summon Shiny Bauble
+		{ 2244, 18, 107 }, //Summon Brilliant Bauble
+		{ 2248, 125, 129 }, //Acumen
+		{ 2249, 25, 58 }, //River's Rancor
+		{ 2250, 25, 38 }, //Fiery Retribution
+		{ 2251, 25, 14 }, //Furor of the Wild
+		{ 2255, 25, 14 }, //Wrath of the Wild
+		{ 2258, 25, 14 }, //Frigid Dominion
+		{ 2261, 25, 14 }, //Frozen Torrent
+		{ 2264, 25, 14 }, //Hail of Ice
+		{ 2268, 25, 0 }, //Touch of the Void
+		{ 2312, 79, 43 }, //Life Bind
+		{ 2321, 25, 0 }, //Energy Burst
+		{ 2326, 95, 7 }, //Yaulp V
+		{ 2375, 25, 0 }, //Spectral Essence
+		{ 2377, 25, 58 }, //Screeching Ricochet
+		{ 2378, 25, 14 }, //Drakeen Breath
+		{ 2379, 25, 14 }, //Drakeen Monsoon
+		{ 2380, 25, 14 }, //Drakeen Vortex
+		{ 2381, 25, 58 }, //Wing Draft
+		{ 2382, 25, 58 }, //Wing Gust
+		{ 2383, 25, 58 }, //Wing Squall
+		{ 2384, 25, 58 }, //Wing Tempest
+		{ 2385, 25, 14 }, //Frost Pummel
+		{ 2386, 25, 14 }, //Ice Pummel
+		{ 2387, 25, 14 }, //Frigid Shard Pummel
+		{ 2392, 25, 0 }, //Sweltering Carcass
+		{ 2417, 123, 57 }, //Ring of Grimling
+		{ 2418, 123, 57 }, //Grimling Gate
+		{ 2419, 123, 57 }, //Circle of Grimling
+		{ 2420, 123, 57 }, //Grimling Portal
+		{ 2421, 123, 57 }, //Translocate: Grimling
+		{ 2422, 123, 57 }, //Ring of Twilight
+		{ 2423, 123, 57 }, //Twilight Gate
+		{ 2424, 123, 57 }, //Circle of Twilight
+		{ 2425, 123, 57 }, //Twilight Portal
+		{ 2426, 123, 57 }, //Translocate: Twilight
+		{ 2427, 123, 57 }, //Ring of Dawnshroud
+		{ 2428, 123, 57 }, //Dawnshroud Gate
+		{ 2429, 123, 57 }, //Circle of Dawnshroud
+		{ 2430, 123, 57 }, //Dawnshroud Portal
+		{ 2431, 123, 57 }, //Translocate: Dawnshroud
+		{ 2432, 123, 57 }, //Circle of the Nexus
+		{ 2433, 123, 57 }, //Ring of the Nexus
+		{ 2434, 95, 7 }, //Avatar
+		{ 2435, 42, 42 }, //Kragg's Mending
+		{ 2436, 25, 58 }, //War Arrows
+		{ 2437, 25, 0 }, //Hendin Arrow
+		{ 2443, 25, 58 }, //Blade of Vallon
+		{ 2450, 25, 38 }, //Barb of Tallon
+		{ 2452, 25, 75 }, //Barb of Tallon
+		{ 2453, 25, 0 }, //Thorns of Drunder
+		{ 2462, 42, 77 }, //Ethereal Remedy
+		{ 2501, 125, 64 }, //Sanctuary
+		{ 2502, 42, 32 }, //Celestial Remedy
+		{ 2503, 20, 124 }, //Sermon of the Righteous
+		{ 2504, 25, 58 }, //Sacred Word
+		{ 2505, 45, 87 }, //Armor of the Faithful
+		{ 2506, 20, 124 }, //Epitaph of Life
+		{ 2507, 125, 21 }, //Mark of Retribution
+		{ 2508, 25, 58 }, //Judgment
+		{ 2509, 45, 87 }, //Blessed Armor of the Risen
+		{ 2510, 45, 1 }, //Blessing of Aegolism
+		{ 2511, 45, 46 }, //Protection of Wood
+		{ 2512, 45, 46 }, //Protection of Rock
+		{ 2513, 45, 46 }, //Protection of Steel
+		{ 2514, 45, 46 }, //Protection of Diamond
+		{ 2515, 45, 46 }, //Protection of Nature
+		{ 2516, 125, 51 }, //Foliage Shield
+		{ 2517, 125, 65 }, //Spirit of Eagle
+		{ 2518, 126, 81 }, //Ro's Smoldering Disjunction
+		{ 2519, 95, 80 }, //Circle of Seasons
+		{ 2520, 42, 32 }, //Nature's Recovery
+		{ 2521, 95, 96 }, //Talisman of the Beast
+		{ 2522, 125, 64 }, //Grow
+		{ 2523, 125, 48 }, //Form of the Bear
+		{ 2524, 125, 65 }, //Spirit of Bih`Li
+		{ 2525, 45, 87 }, //Harnessing of Spirit
+		{ 2526, 42, 19 }, //Disinfecting Aura
+		{ 2527, 126, 88 }, //Plague of Insects
+		{ 2528, 79, 43 }, //Regrowth of Dar Khura
+		{ 2529, 95, 80 }, //Talisman of Epuration
+		{ 2530, 45, 87 }, //Khura's Focusing
+		{ 2531, 18, 106 }, //Summon Elemental Defender
+		{ 2532, 18, 106 }, //Summon Phantom Leather
+		{ 2533, 18, 106 }, //Summon Phantom Chain
+		{ 2534, 18, 106 }, //Summon Phantom Plate
+		{ 2535, 18, 106 }, //Summon Elemental Blanket
+		{ 2536, 69, 42 }, //Transon's Elemental Infusion
+		{ 2537, 125, 51 }, //Veil of Elements
+		{ 2538, 18, 109 }, //Mass Mystical Transvergance
+		{ 2539, 45, 44 }, //Transon's Phantasmal Protection
+		{ 2540, 25, 38 }, //Shock of Fiery Blades
+		{ 2541, 69, 70 }, //Focus Death
+		{ 2542, 126, 124 }, //Shackle of Bone
+		{ 2543, 20, 124 }, //Eternities Torment
+		{ 2544, 126, 124 }, //Shackle of Spirit
+		{ 2545, 126, 89 }, //Insidious Retrogression
+		{ 2546, 114, 76 }, //Degeneration
+		{ 2547, 114, 76 }, //Succussion of Shadows
+		{ 2548, 114, 76 }, //Crippling Claudication
+		{ 2549, 126, 60 }, //Mind Wrack
+		{ 2550, 114, 33 }, //Zevfeer's Theft of Vitae
+		{ 2551, 125, 21 }, //O'Keils Embers
+		{ 2552, 25, 58 }, //Garrisons Mighty Mana Shock
+		{ 2553, 69, 101 }, //Minor Familiar
+		{ 2554, 126, 83 }, //Elnerick's Entombment of Ice
+		{ 2555, 69, 101 }, //Lesser Familiar
+		{ 2556, 69, 71 }, //Firetree's Familiar Augment
+		{ 2557, 69, 101 }, //Familiar
+		{ 2558, 123, 64 }, //Decession
+		{ 2559, 125, 93 }, //Spellshield
+		{ 2560, 69, 101 }, //Greater Familiar
+		{ 2561, 95, 39 }, //Intellectual Advancement
+		{ 2562, 95, 39 }, //Intellectual Superiority
+		{ 2563, 125, 128 }, //Haunting Visage
+		{ 2564, 125, 128 }, //Calming Visage
+		{ 2565, 125, 48 }, //Illusion: Imp
+		{ 2566, 125, 16 }, //Trickster's Augmentation
+		{ 2567, 125, 128 }, //Beguiling Visage
+		{ 2568, 125, 128 }, //Horrifying Visage
+		{ 2569, 125, 128 }, //Glamorous Visage
+		{ 2570, 79, 59 }, //Koadic's Endless Intellect
+		{ 2571, 114, 76 }, //Despair
+		{ 2572, 114, 76 }, //Scream of Hate
+		{ 2573, 114, 76 }, //Scream of Pain
+		{ 2574, 125, 16 }, //Scream of Death
+		{ 2575, 114, 76 }, //Abduction of Strength
+		{ 2576, 125, 16 }, //Mental Corruption
+		{ 2577, 114, 76 }, //Torrent of Hate
+		{ 2578, 114, 76 }, //Torrent of Pain
+		{ 2579, 114, 76 }, //Torrent of Fatigue
+		{ 2580, 45, 87 }, //Cloak of the Akheva
+		{ 2581, 25, 97 }, //Cease
+		{ 2582, 25, 97 }, //Desist
+		{ 2583, 125, 16 }, //Instrument of Nife
+		{ 2584, 45, 47 }, //Divine Vigor
+		{ 2585, 125, 41 }, //Valor of Marr
+		{ 2586, 126, 60 }, //Thunder of Karana
+		{ 2587, 25, 97 }, //Quellious' Word of Tranquility
+		{ 2588, 125, 17 }, //Breath of Tunare
+		{ 2589, 42, 42 }, //Healing Wave of Prexus
+		{ 2590, 45, 47 }, //Brell's Mountainous Barrier
+		{ 2591, 126, 89 }, //Tangling Weeds
+		{ 2592, 125, 129 }, //Hawk Eye
+		{ 2593, 125, 21 }, //Riftwind's Protection
+		{ 2594, 95, 7 }, //Nature's Precision
+		{ 2595, 125, 21 }, //Force of Nature
+		{ 2596, 125, 129 }, //Falcon Eye
+		{ 2597, 126, 53 }, //Jolting Blades
+		{ 2598, 95, 7 }, //Mark of the Predator
+		{ 2599, 125, 129 }, //Eagle Eye
+		{ 2600, 45, 47 }, //Warder's Protection
+		{ 2601, 125, 64 }, //Magical Monologue
+		{ 2602, 125, 64 }, //Song of Sustenance
+		{ 2603, 125, 64 }, //Amplification
+		{ 2604, 125, 16 }, //Katta's Song of Sword Dancing
+		{ 2605, 125, 65 }, //Selo`s Accelerating Chorus
+		{ 2606, 125, 41 }, //Battlecry of the Vah Shir
+		{ 2607, 95, 80 }, //Elemental Chorus
+		{ 2608, 95, 80 }, //Purifying Chorus
+		{ 2609, 79, 44 }, //Chorus of Replenishment
+		{ 2610, 125, 41 }, //Warsong of the Vah Shir
+		{ 2611, 69, 42 }, //Sharik's Replenishing
+		{ 2612, 69, 104 }, //Spirit of Sharik
+		{ 2613, 69, 42 }, //Keshuval's Rejuvenation
+		{ 2614, 69, 104 }, //Spirit of Keshuval
+		{ 2615, 69, 42 }, //Herikol's Soothing
+		{ 2616, 69, 104 }, //Spirit of Herikol
+		{ 2617, 69, 42 }, //Yekan's Recovery
+		{ 2618, 69, 104 }, //Spirit of Yekan
+		{ 2619, 69, 70 }, //Yekan's Quickening
+		{ 2620, 69, 42 }, //Vigor of Zehkes
+		{ 2621, 69, 104 }, //Spirit of Kashek
+		{ 2622, 69, 42 }, //Aid of Khurenz
+		{ 2623, 69, 104 }, //Spirit of Omakin
+		{ 2624, 69, 42 }, //Sha's Restoration
+		{ 2625, 69, 70 }, //Omakin's Alacrity
+		{ 2626, 69, 104 }, //Spirit of Zehkes
+		{ 2627, 69, 104 }, //Spirit of Khurenz
+		{ 2628, 69, 70 }, //Sha's Ferocity
+		{ 2629, 79, 44 }, //Spiritual Purity
+		{ 2630, 45, 47 }, //Spiritual Strength
+		{ 2631, 69, 104 }, //Spirit of Khati Sha
+		{ 2632, 69, 104 }, //Summon Warder
+		{ 2633, 69, 104 }, //Spirit of Khaliz
+		{ 2634, 126, 88 }, //Sha's Lethargy
+		{ 2635, 69, 71 }, //Spirit of Lightning
+		{ 2636, 69, 71 }, //Spirit of the Blizzard
+		{ 2637, 69, 71 }, //Spirit of Inferno
+		{ 2638, 69, 71 }, //Spirit of the Scorpion
+		{ 2639, 69, 71 }, //Spirit of Vermin
+		{ 2640, 69, 71 }, //Spirit of Wind
+		{ 2641, 69, 71 }, //Spirit of the Storm
+		{ 2642, 25, 38 }, //Claw of Khati Sha
+		{ 2650, 25, 38 }, //Blazing Heat
+		{ 2651, 25, 58 }, //Vibrant Might
+		{ 2652, 25, 58 }, //Descending Might
+		{ 2654, 25, 38 }, //Fireblast
+		{ 2656, 25, 58 }, //Wrathful Strike
+		{ 2657, 25, 58 }, //Terrifying Darkness
+		{ 2658, 25, 58 }, //Lightning Surge
+		{ 2662, 25, 58 }, //Storm of Lightning
+		{ 2663, 25, 58 }, //Clash of Will
+		{ 2664, 25, 14 }, //Frostcall
+		{ 2665, 25, 14 }, //Wintercall
+		{ 2669, 25, 14 }, //Storm of Ice
+		{ 2670, 25, 124 }, //Rebuke the Dead
+		{ 2678, 25, 75 }, //Fungal Vengeance
+		{ 2710, 25, 38 }, //Trickster's Torment
+		{ 2711, 25, 38 }, //Trickster's TormentSK
+		{ 2717, 25, 29 }, //Mental Corruption Strike
+		{ 2720, 25, 58 }, //Spirit of Lightning Strike
+		{ 2721, 25, 14 }, //Spirit of Blizzard Strike
+		{ 2722, 25, 38 }, //Spirit of Inferno Strike
+		{ 2723, 25, 75 }, //Spirit of Scorpion Strike
+		{ 2724, 25, 29 }, //Spirit of Vermin Strike
+		{ 2725, 25, 58 }, //Spirit of Wind Strike
+		{ 2726, 25, 38 }, //Spirit of Storm Strike
+		{ 2729, 25, 124 }, //Condemnation of Nife
+		{ 2732, 25, 38 }, //Molten Fist
+		{ 2734, 123, 57 }, //The Nexus
+		{ 2736, 126, 31 }, //SpellTheft1
+		{ 2742, 42, 19 }, //Purify Soul
+		{ 2750, 125, 48 }, //Rabid Bear
+		{ 2752, 69, 42 }, //Restore Companion
+		{ 2754, 69, 70 }, //Frenzied Burnout
+		{ 2757, 126, 37 }, //Wave of Revulsion
+		{ 2758, 69, 101 }, //Improved Familiar
+		{ 2759, 126, 13 }, //Undead Pact
+		{ 2761, 126, 13 }, //Dominating Gaze
+		{ 2762, 25, 29 }, //Disease Touch
+		{ 2763, 25, 75 }, //Poison Touch
+		{ 2764, 125, 64 }, //Call to Corpse
+		{ 2766, 114, 43 }, //Life Curse
+		{ 2767, 25, 58 }, //Dragon Force
+		{ 2768, 25, 58 }, //Grimling LT 30
+		{ 2770, 25, 75 }, //Rain of Spores
+		{ 2802, 25, 0 }, //Flurry of Pebbles
+		{ 2809, 25, 14 }, //Wave of Death
+		{ 2816, 25, 58 }, //Storm Tremor
+		{ 2822, 25, 58 }, //Upheaval
+		{ 2826, 125, 49 }, //Illusion: Vah Shir
+		{ 2833, 25, 38 }, //AdvisorNova
+		{ 2836, 25, 14 }, //Grimling Comet
+		{ 2842, 25, 29 }, //Shrieker Stun
+		{ 2858, 25, 0 }, //AcryliaKB
+		{ 2859, 25, 0 }, //Touch of Vinitras
+		{ 2877, 25, 14 }, //Moonfire
+		{ 2878, 25, 38 }, //Fireclaw
+		{ 2879, 79, 43 }, //Phantasmal Armor
+		{ 2880, 42, 19 }, //Remove Greater Curse
+		{ 2881, 125, 64 }, //Everlasting Breath
+		{ 2882, 69, 71 }, //Firetree's Familiar Enhancement
+		{ 2883, 25, 58 }, //Elnerick's Electrical Rending
+		{ 2884, 25, 38 }, //Garrison's Superior Sundering
+		{ 2885, 20, 38 }, //Funeral Pyre of Kelador
+		{ 2886, 125, 129 }, //Acumen of Dar Khura
+		{ 2887, 79, 59 }, //Mask of the Stalker
+		{ 2888, 69, 71 }, //Spirit of Flame
+		{ 2889, 25, 38 }, //Spirit of Flame Strike
+		{ 2890, 69, 71 }, //Spirit of Snow
+		{ 2891, 25, 14 }, //Spirit of Snow Strike
+		{ 2892, 125, 17 }, //Deathly Temptation
+		{ 2893, 45, 112 }, //Marzin's Mark
+		{ 2894, 125, 55 }, //Levitation
+		{ 2895, 125, 41 }, //Speed of the Brood
+		{ 2896, 69, 42 }, //Transon's Elemental Renewal
+		{ 2901, 25, 0 }, //Illumination
+		{ 2902, 25, 75 }, //Shissar Broodling Poison
+		{ 2908, 25, 58 }, //Banshee Wail
+		{ 2927, 25, 58 }, //Storm Tremor
+		{ 2936, 126, 60 }, //Ervaj's Lost Composition
+		{ 2941, 95, 7 }, //Savagery
+		{ 2942, 126, 88 }, //Sha's Advantage
+		{ 2943, 123, 57 }, //Translocate: Nexus
+		{ 2944, 123, 57 }, //Nexus Portal
+		{ 2945, 123, 57 }, //Nexus Gate
+		{ 2946, 42, 19 }, //Remove Curse
+		{ 2950, 25, 58 }, //Grol Baku Strike
+		{ 2951, 25, 58 }, //Grol Baku Strike
+		{ 2952, 25, 58 }, //Strike of the Grol Baku
+		{ 2956, 25, 38 }, //Fire Blast
+		{ 2957, 25, 14 }, //Water Blast
+		{ 2969, 114, 76 }, //Shadow Creep
+		{ 2973, 25, 38 }, //Ember Strike
+		{ 2984, 25, 29 }, //Lotus Spines
+		{ 2988, 25, 75 }, //Wave of Toxicity
+		{ 2991, 25, 14 }, //Deathly Ice
+		{ 2992, 25, 38 }, //Deathly Fire
+		{ 2993, 25, 75 }, //Deathly Spores
+		{ 2994, 25, 29 }, //Deathly Fever
+		{ 2995, 25, 75 }, //Deep Spores
+		{ 2996, 25, 58 }, //Claw of the Hunter
+		{ 2997, 25, 38 }, //Claw of the Beast
+		{ 2999, 25, 58 }, //Claw of Bestial Fury
+		{ 3000, 25, 0 }, //Devouring Nightmare
+		{ 3004, 25, 38 }, //Fist of Lava
+		{ 3005, 25, 38 }, //Ball of Lava
+		{ 3013, 25, 38 }, //Fiery Strike
+		{ 3017, 25, 38 }, //Mighty Bellow of Fire
+		{ 3018, 25, 38 }, //Nova Inferno
+		{ 3020, 25, 38 }, //Rain of Burning Fire
+		{ 3030, 126, 35 }, //Dreams of Thule
+		{ 3031, 79, 44 }, //Xegony's Phantasmal Guard
+		{ 3032, 114, 43 }, //Touch of Mujaki
+		{ 3034, 69, 99 }, //Aeldorb's Animation
+		{ 3035, 25, 75 }, //Neurotoxin
+		{ 3036, 25, 14 }, //Wrath of Ice
+		{ 3037, 25, 38 }, //Wrath of Fire
+		{ 3038, 25, 58 }, //Wrath of Wind
+		{ 3039, 125, 21 }, //Protection of the Wild
+		{ 3040, 18, 64 }, //Belt of Magi'Kot
+		{ 3041, 18, 64 }, //Blade of Walnan
+		{ 3042, 18, 64 }, //Fist of Ixiblat
+		{ 3043, 18, 64 }, //Blade of The Kedge
+		{ 3044, 18, 64 }, //Girdle of Magi'Kot
+		{ 3045, 18, 109 }, //Talisman of Return
+		{ 3047, 45, 112 }, //Kazad`s Mark
+		{ 3051, 25, 38 }, //Fiery Assault
+		{ 3057, 25, 14 }, //Tidal Freeze
+		{ 3063, 125, 49 }, //Illusion: Froglok
+		{ 3066, 126, 88 }, //Requiem of Time
+		{ 3069, 25, 58 }, //Seething Hatred
+		{ 3071, 25, 38 }, //Insipid Dreams
+		{ 3100, 125, 64 }, //Mark of Retaliation
+		{ 3107, 125, 16 }, //Cry of Fire
+		{ 3129, 25, 58 }, //Call of Sky Strike
+		{ 3130, 25, 58 }, //Call of Sky Strike
+		{ 3131, 25, 38 }, //Call of Fire Strike
+		{ 3132, 25, 38 }, //Call of Fire Strike
+		{ 3133, 25, 38 }, //Cry of Fire Strike
+		{ 3134, 123, 116 }, //Portal of Knowledge
+		{ 3135, 18, 110 }, //Hammer of Divinity
+		{ 3136, 18, 110 }, //Hammer of Souls
+		{ 3156, 25, 58 }, //Torrent of Brambles
+		{ 3162, 25, 58 }, //Wind Strike
+		{ 3163, 25, 58 }, //Storm Avalanche
+		{ 3164, 25, 29 }, //Froglok Misery
+		{ 3167, 25, 58 }, //Strike of Marr
+		{ 3172, 25, 58 }, //Denial
+		{ 3176, 25, 0 }, //Butchery
+		{ 3177, 25, 58 }, //Prayer of Pain
+		{ 3178, 125, 41 }, //Vallon's Quickening
+		{ 3179, 25, 58 }, //Spirit of Rellic Strike
+		{ 3180, 123, 116 }, //Knowledge Portal
+		{ 3181, 123, 116 }, //Translocate: Knowledge
+		{ 3182, 123, 116 }, //Ring of Knowledge
+		{ 3183, 123, 116 }, //Knowledge Gate
+		{ 3184, 123, 116 }, //Circle of Knowledge
+		{ 3185, 125, 65 }, //Flight of Eagles
+		{ 3186, 95, 7 }, //Yaulp VI
+		{ 3187, 20, 124 }, //Sermon of Penitence
+		{ 3188, 18, 109 }, //Rod of Mystical Transvergance
+		{ 3189, 25, 38 }, //Tears of Arlyxir
+		{ 3190, 42, 19 }, //Crusader`s Touch
+		{ 3191, 25, 58 }, //Shock of Magic
+		{ 3192, 126, 83 }, //Earthen Roots
+		{ 3194, 126, 83 }, //Greater Fetter
+		{ 3195, 126, 83 }, //Greater Immobilize
+		{ 3196, 126, 83 }, //Petrifying Earth
+		{ 3197, 126, 11 }, //Pacification
+		{ 3198, 125, 21 }, //Flameshield of Ro
+		{ 3199, 125, 84 }, //Arcane Rune
+		{ 3205, 18, 107 }, //Summon Platinum Choker
+		{ 3206, 18, 107 }, //Summon Runed Mantle
+		{ 3207, 18, 107 }, //Summon Sapphire Bracelet
+		{ 3208, 18, 107 }, //Summon Spiked Ring
+		{ 3209, 18, 107 }, //Summon Glowing Bauble
+		{ 3210, 18, 107 }, //Summon Jewelry Bag
+		{ 3221, 25, 58 }, //Shattering Glass
+		{ 3222, 25, 58 }, //Web of Glass
+		{ 3223, 25, 58 }, //Shards of Glass
+		{ 3227, 125, 16 }, //Shroud of Chaos
+		{ 3229, 126, 53 }, //Boggle
+		{ 3232, 42, 42 }, //Karana's Renewal
+		{ 3233, 42, 42 }, //Tnarg`s Mending
+		{ 3234, 45, 46 }, //Protection of the Nine
+		{ 3235, 45, 87 }, //Focus of Soul
+		{ 3236, 25, 75 }, //no spell
+		{ 3237, 69, 70 }, //Burnout V
+		{ 3238, 25, 111 }, //Destroy Summoned
+		{ 3239, 69, 42 }, //Planar Renewal
+		{ 3240, 125, 41 }, //Speed of Vallon
+		{ 3241, 125, 16 }, //Night`s Dark Terror
+		{ 3242, 95, 80 }, //Guard of Druzzil
+		{ 3243, 123, 64 }, //Teleport
+		{ 3244, 123, 64 }, //Greater Decession
+		{ 3245, 25, 97 }, //Force of Akilae
+		{ 3246, 126, 83 }, //Shackles of Tunare
+		{ 3247, 45, 87 }, //Aura of the Crusader
+		{ 3255, 125, 21 }, //Wrath of the Wild
+		{ 3256, 125, 21 }, //Wrath of the Wild
+		{ 3257, 125, 21 }, //Wrath of the Wild
+		{ 3258, 125, 84 }, //Eldritch Rune
+		{ 3259, 125, 84 }, //Eldritch Rune
+		{ 3260, 125, 84 }, //Eldritch Rune
+		{ 3264, 69, 101 }, //Allegiant Familiar
+		{ 3265, 69, 102 }, //Servant of Ro
+		{ 3266, 69, 102 }, //Servant of Ro
+		{ 3267, 69, 102 }, //Servant of Ro
+		{ 3271, 125, 48 }, //Guardian of the Forest
+		{ 3272, 125, 48 }, //Guardian of the Forest
+		{ 3273, 125, 48 }, //Guardian of the Forest
+		{ 3274, 126, 83 }, //Virulent Paralysis
+		{ 3275, 126, 83 }, //Virulent Paralysis
+		{ 3276, 126, 83 }, //Virulent Paralysis
+		{ 3281, 25, 38 }, //Servant's Bolt
+		{ 3282, 25, 58 }, //Boastful Bellow
+		{ 3289, 125, 48 }, //Frenzy of Spirit
+		{ 3290, 69, 71 }, //Hobble of Spirits
+		{ 3291, 79, 59 }, //Paragon of Spirit
+		{ 3295, 125, 21 }, //Legacy of Bracken
+		{ 3296, 45, 46 }, //Faith
+		{ 3297, 42, 19 }, //Radiant Cure1
+		{ 3298, 42, 19 }, //Radiant Cure2
+		{ 3299, 42, 19 }, //Radiant Cure3
+		{ 3300, 45, 87 }, //Shield of the Arcane
+		{ 3301, 125, 84 }, //Force Shield
+		{ 3302, 45, 87 }, //Shield of Maelin
+		{ 3303, 20, 75 }, //Blood of Thule
+		{ 3304, 69, 103 }, //Legacy of Zek
+		{ 3305, 69, 70 }, //Rune of Death
+		{ 3306, 114, 33 }, //Saryrn's Kiss
+		{ 3308, 126, 35 }, //Death's Silence
+		{ 3309, 20, 58 }, //Embracing Darkness
+		{ 3310, 69, 103 }, //Saryrn's Companion
+		{ 3311, 125, 17 }, //Seduction of Saryrn
+		{ 3312, 69, 42 }, //Touch of Death
+		{ 3314, 69, 103 }, //Child of Bertoxxulous
+		{ 3315, 20, 29 }, //Dark Plague
+		{ 3316, 126, 13 }, //Word of Terris
+		{ 3317, 69, 98 }, //Ward of Xegony
+		{ 3318, 25, 38 }, //Firebolt of Tallon
+		{ 3319, 25, 38 }, //Sun Storm
+		{ 3320, 69, 105 }, //Servant of Marr
+		{ 3321, 25, 58 }, //Black Steel
+		{ 3322, 69, 102 }, //Child of Ro
+		{ 3323, 25, 58 }, //Maelstrom of Thunder
+		{ 3324, 69, 100 }, //Rathe's Son
+		{ 3325, 25, 38 }, //Sun Vortex
+		{ 3326, 95, 80 }, //Resistant Armor
+		{ 3327, 25, 38 }, //Tears of Ro
+		{ 3328, 25, 58 }, //Lure of Thunder
+		{ 3329, 95, 80 }, //Elemental Barrier
+		{ 3330, 25, 38 }, //Draught of Ro
+		{ 3331, 25, 38 }, //Lure of Ro
+		{ 3332, 25, 14 }, //Tears of Marr
+		{ 3333, 25, 97 }, //Telekin
+		{ 3334, 25, 58 }, //Draught of Thunder
+		{ 3335, 25, 58 }, //Agnarr's Thunder
+		{ 3336, 25, 14 }, //Draught of E`ci
+		{ 3337, 125, 64 }, //Iceflame of E`ci
+		{ 3338, 42, 61 }, //Harvest of Druzzil
+		{ 3339, 25, 38 }, //Strike of Solusek
+		{ 3341, 126, 35 }, //Apathy
+		{ 3342, 126, 81 }, //Howl of Tashan
+		{ 3343, 125, 84 }, //Rune of Zebuxoruk
+		{ 3344, 18, 50 }, //Imbue Nightmare
+		{ 3345, 20, 58 }, //Strangle
+		{ 3346, 18, 50 }, //Imbue Storm
+		{ 3347, 126, 13 }, //Beckon
+		{ 3348, 20, 58 }, //Torment of Scio
+		{ 3349, 25, 58 }, //Insanity
+		{ 3350, 79, 59 }, //Tranquility
+		{ 3351, 125, 84 }, //Uproar
+		{ 3352, 18, 50 }, //Imbue Earth
+		{ 3353, 18, 50 }, //Imbue Air
+		{ 3354, 126, 35 }, //Sleep
+		{ 3355, 126, 13 }, //Command of Druzzil
+		{ 3356, 18, 50 }, //Imbue Fire
+		{ 3357, 18, 50 }, //Imbue Water
+		{ 3358, 126, 35 }, //Bliss
+		{ 3359, 126, 35 }, //Word of Morell
+		{ 3360, 79, 59 }, //Voice of Quellious
+		{ 3361, 126, 11 }, //Silent Song of Quellious
+		{ 3362, 125, 41 }, //Rizlona's Call of Flame
+		{ 3363, 20, 29 }, //Tuyen`s Chant of the Plague
+		{ 3364, 126, 31 }, //Druzzil's Disillusionment
+		{ 3365, 126, 88 }, //Melody of Mischief
+		{ 3366, 25, 58 }, //Saryrn's Scream of Pain
+		{ 3367, 20, 38 }, //Tuyen`s Chant of Fire
+		{ 3368, 125, 21 }, //Psalm of Veeshan
+		{ 3369, 126, 35 }, //Dreams of Terris
+		{ 3370, 20, 75 }, //Tuyen`s Chant of Venom
+		{ 3371, 126, 13 }, //Call of the Banshee
+		{ 3372, 79, 44 }, //Chorus of Marr
+		{ 3373, 20, 14 }, //Tuyen`s Chant of Ice
+		{ 3374, 125, 41 }, //Warsong of Zek
+		{ 3375, 126, 81 }, //Harmony of Sound
+		{ 3376, 126, 35 }, //Lullaby of Morell
+		{ 3377, 69, 104 }, //True Spirit
+		{ 3378, 95, 2 }, //Agility of the Wrulan
+		{ 3379, 25, 75 }, //Spear of Torment
+		{ 3380, 126, 88 }, //Cloud of Grummus
+		{ 3381, 95, 6 }, //Ancestral Guard
+		{ 3382, 95, 94 }, //Endurance of the Boar
+		{ 3383, 95, 2 }, //Talisman of the Wrulan
+		{ 3384, 95, 80 }, //Talisman of the Tribunal
+		{ 3385, 25, 75 }, //Tears of Saryrn
+		{ 3386, 126, 81 }, //Malicious Decay
+		{ 3387, 126, 81 }, //Malosinia
+		{ 3388, 95, 96 }, //Strength of the Diaku
+		{ 3389, 95, 94 }, //Talisman of the Boar
+		{ 3390, 25, 14 }, //Velium Strike
+		{ 3391, 125, 41 }, //Talisman of Alacrity
+		{ 3392, 95, 96 }, //Talisman of the Diaku
+		{ 3393, 125, 64 }, //Tiny Terror
+		{ 3394, 20, 29 }, //Breath of Ultor
+		{ 3395, 126, 81 }, //Malos
+		{ 3396, 20, 75 }, //Blood of Saryrn
+		{ 3397, 45, 87 }, //Focus of the Seventh
+		{ 3398, 42, 32 }, //Quiescence
+		{ 3399, 95, 7 }, //Ferine Avatar
+		{ 3400, 20, 58 }, //Festering Darkness
+		{ 3401, 114, 43 }, //Touch of Volatis
+		{ 3403, 114, 76 }, //Aura of Pain
+		{ 3405, 126, 53 }, //Terror of Thule
+		{ 3406, 114, 76 }, //Aura of Darkness
+		{ 3408, 114, 33 }, //Zevfeer's Bite
+		{ 3410, 125, 128 }, //Voice of Thule
+		{ 3411, 114, 76 }, //Aura of Hate
+		{ 3413, 114, 43 }, //Touch of Innoruuk
+		{ 3415, 125, 16 }, //Nature's Rebuke
+		{ 3416, 25, 111 }, //Nature's Rebuke Strike
+		{ 3417, 95, 7 }, //Spirit of the Predator
+		{ 3418, 25, 14 }, //Frozen Wind
+		{ 3419, 125, 21 }, //Call of the Rathe
+		{ 3420, 125, 16 }, //Cry of Thunder
+		{ 3421, 25, 58 }, //Cry of Thunder Strike
+		{ 3422, 125, 16 }, //Ward of Nife
+		{ 3423, 25, 124 }, //Ward of Nife Strike
+		{ 3424, 125, 16 }, //Pious Might
+		{ 3425, 25, 58 }, //Pious Might Strike
+		{ 3426, 25, 97 }, //Quellious' Word of Serenity
+		{ 3427, 42, 42 }, //Wave of Marr
+		{ 3428, 25, 124 }, //Deny Undead
+		{ 3429, 42, 42 }, //Touch of Nife
+		{ 3430, 42, 77 }, //Light of Nife
+		{ 3431, 25, 38 }, //Brushfire
+		{ 3432, 45, 47 }, //Brell's Stalwart Shield
+		{ 3433, 79, 43 }, //Replenishment
+		{ 3434, 25, 58 }, //Storm's Fury
+		{ 3435, 126, 81 }, //Hand of Ro
+		{ 3436, 25, 14 }, //Winter's Storm
+		{ 3437, 20, 38 }, //Immolation of Ro
+		{ 3438, 25, 58 }, //Karana's Rage
+		{ 3439, 95, 96 }, //Nature's Might
+		{ 3440, 126, 81 }, //Ro's Illumination
+		{ 3441, 79, 43 }, //Blessing of Replenishment
+		{ 3442, 126, 81 }, //E'ci's Frosty Breath
+		{ 3443, 42, 42 }, //Nature's Infusion
+		{ 3444, 95, 80 }, //Protection of Seasons
+		{ 3445, 126, 13 }, //Command of Tunare
+		{ 3446, 20, 58 }, //Swarming Death
+		{ 3447, 126, 83 }, //Savage Roots
+		{ 3448, 125, 21 }, //Shield of Bracken
+		{ 3449, 25, 38 }, //Summer's Flame
+		{ 3450, 125, 21 }, //Brackencoat
+		{ 3451, 45, 46 }, //Blessing of the Nine
+		{ 3452, 25, 14 }, //Winter's Frost
+		{ 3453, 79, 59 }, //Mask of the Forest
+		{ 3454, 45, 96 }, //Infusion of Spirit
+		{ 3455, 69, 42 }, //Healing of Sorsha
+		{ 3456, 45, 47 }, //Spiritual Vigor
+		{ 3457, 69, 104 }, //Spirit of Arag
+		{ 3458, 69, 70 }, //Arag`s Celerity
+		{ 3459, 69, 71 }, //Spirit of Rellic
+		{ 3460, 79, 44 }, //Spiritual Dominion
+		{ 3461, 69, 104 }, //Spirit of Sorsha
+		{ 3462, 126, 88 }, //Sha's Revenge
+		{ 3463, 95, 7 }, //Ferocity
+		{ 3464, 25, 97 }, //The Silent Command
+		{ 3465, 42, 77 }, //Supernal Remedy
+		{ 3466, 45, 112 }, //Symbol of Kazad
+		{ 3467, 45, 1 }, //Virtue
+		{ 3468, 25, 124 }, //Destroy Undead
+		{ 3469, 125, 64 }, //Mark of Kings
+		{ 3470, 95, 6 }, //Ward of Gallantry
+		{ 3471, 42, 42 }, //Word of Replenishment
+		{ 3472, 125, 91 }, //Blessing of Reverence
+		{ 3473, 25, 58 }, //Catastrophe
+		{ 3474, 45, 87 }, //Armor of the Zealot
+		{ 3475, 42, 32 }, //Supernal Elixir
+		{ 3476, 25, 58 }, //Condemnation
+		{ 3477, 125, 21 }, //Mark of the Righteous
+		{ 3478, 18, 110 }, //Hammer of Damnation
+		{ 3479, 45, 1 }, //Hand of Virtue
+		{ 3480, 42, 42 }, //Supernal Light
+		{ 3481, 25, 97 }, //Tarnation
+		{ 3482, 25, 97 }, //Sound of Might
+		{ 3483, 126, 35 }, //Elemental Silence
+		{ 3484, 126, 13 }, //Call of the Arch Mage
+		{ 3485, 42, 32 }, //Supernal Cleansing
+		{ 3486, 125, 21 }, //Maelstrom of Ro
+		{ 3487, 45, 47 }, //Strength of Tunare
+		{ 3488, 125, 17 }, //Pact of Hate
+		{ 3489, 20, 75 }, //Blood of Hate
+		{ 3490, 45, 87 }, //Cloak of Luclin
+		{ 3491, 25, 29 }, //Spear of Decay
+		{ 3492, 20, 75 }, //Scorpion Venom
+		{ 3493, 25, 14 }, //Frost Spear
+		{ 3494, 18, 109 }, //Luggald Blood
+		{ 3498, 25, 58 }, //Gallenite's Lifetap Test
+		{ 3560, 25, 29 }, //Spear of Pain
+		{ 3561, 25, 29 }, //Spear of Disease
+		{ 3562, 25, 29 }, //Spear of Plague
+		{ 3564, 25, 38 }, //Burning Arrow
+		{ 3565, 25, 38 }, //Flaming Arrow
+		{ 3566, 20, 75 }, //Tuyen`s Chant of Poison
+		{ 3567, 20, 29 }, //Tuyen`s Chant of Disease
+		{ 3568, 25, 14 }, //Ice Spear
+		{ 3569, 25, 14 }, //Frost Shard
+		{ 3570, 25, 14 }, //Ice Shard
+		{ 3571, 25, 75 }, //Torbas' Poison Blast
+		{ 3572, 25, 75 }, //Torbas' Venom Blast
+		{ 3573, 25, 75 }, //Shock of Venom
+		{ 3574, 25, 75 }, //Blast of Venom
+		{ 3575, 125, 91 }, //Blessing of Piety
+		{ 3576, 125, 91 }, //Blessing of Faith
+		{ 3577, 42, 42 }, //Wave of Life
+		{ 3578, 45, 47 }, //Brell's Steadfast Aegis
+		{ 3579, 125, 65 }, //Share Form of the Great Wolf
+		{ 3580, 125, 48 }, //Spirit of Ash
+		{ 3581, 125, 55 }, //O`Keils Levity
+		{ 3582, 95, 80 }, //Elemental Cloak
+		{ 3583, 69, 64 }, //Tiny Companion
+		{ 3584, 69, 42 }, //Refresh Summoning
+		{ 3585, 126, 35 }, //Entrancing Lights
+		{ 3586, 125, 65 }, //Illusion: Scaled Wolf
+		{ 3587, 25, 58 }, //Planar Strike
+		{ 3589, 25, 58 }, //Ethereal Strike
+		{ 3591, 18, 50 }, //Imbue Disease
+		{ 3592, 18, 50 }, //Imbue Valor
+		{ 3593, 18, 50 }, //Imbue War
+		{ 3594, 18, 50 }, //Imbue Torment
+		{ 3595, 18, 50 }, //Imbue Justice
+		{ 3601, 126, 11 }, //Harmony of Nature
+		{ 3618, 25, 58 }, //Eclipse Aura Strike
+		{ 3619, 25, 58 }, //Eclipse Aura Strike
+		{ 3621, 25, 14 }, //Frost Claw
+		{ 3623, 25, 38 }, //Burning Barb
+		{ 3624, 25, 0 }, //Anger
+		{ 3626, 25, 38 }, //Tendrils of Fire
+		{ 3630, 25, 58 }, //Time Lapse
+		{ 3645, 25, 58 }, //Sting of Ayonae
+		{ 3646, 25, 29 }, //Bite of Bertoxxulous
+		{ 3648, 25, 58 }, //Time Snap
+		{ 3650, 25, 0 }, //Dark Empathy Recourse
+		{ 3651, 79, 44 }, //Wind of Marr
+		{ 3665, 25, 38 }, //Curtain Call
+		{ 3668, 20, 29 }, //Pawn's Plight
+		{ 3670, 25, 14 }, //Queen's Checkmate
+		{ 3681, 42, 19 }, //Aria of Innocence
+		{ 3682, 42, 19 }, //Aria of Asceticism
+		{ 3683, 42, 32 }, //Ethereal Cleansing
+		{ 3684, 42, 77 }, //Light of Life
+		{ 3685, 125, 64 }, //Comatose
+		{ 3686, 20, 75 }, //Blood of Pain
+		{ 3687, 20, 58 }, //Swarm of Pain
+		{ 3688, 25, 14 }, //Icewind
+		{ 3689, 20, 29 }, //Malaria
+		{ 3690, 69, 70 }, //Bond of the Wild
+		{ 3691, 45, 0 }, //Bond of the Wild R.
+		{ 3692, 45, 1 }, //Temperance
+		{ 3693, 42, 19 }, //Pure Blood
+		{ 3694, 42, 32 }, //Stoicism
+		{ 3695, 126, 81 }, //Frost Zephyr
+		{ 3696, 125, 129 }, //Leviathan Eyes
+		{ 3697, 126, 60 }, //Scryer's Trespass
+		{ 3699, 69, 42 }, //Primal Remedy
+		{ 3700, 69, 70 }, //Elemental Empathy
+		{ 3702, 114, 33 }, //Auspice
+		{ 3704, 69, 0 }, //Soul Empathy
+		{ 3706, 25, 14 }, //Frozen Harpoon
+		{ 3748, 25, 29 }, //Insipid Decay
+		{ 3753, 114, 76 }, //Torrent of Agony
+		{ 3764, 25, 75 }, //Rain of Bile
+		{ 3785, 25, 58 }, //Hate's Fury
+		{ 3792, 123, 67 }, //Circle of Stonebrunt
+		{ 3793, 123, 67 }, //Stonebrunt Portal
+		{ 3794, 123, 67 }, //Ring of Stonebrunt
+		{ 3795, 123, 67 }, //Stonebrunt Gate
+		{ 3796, 126, 60 }, //Mind Tap
+		{ 3799, 25, 97 }, //Dismal Wind
+		{ 3803, 25, 58 }, //Pique
+		{ 3806, 126, 53 }, //Distraction
+		{ 3809, 79, 43 }, //Reclamation
+		{ 3810, 25, 38 }, //Eruption
+		{ 3811, 125, 129 }, //Vision Shift
+		{ 3833, 123, 67 }, //Translocate: Stonebrunt
+		{ 3834, 42, 42 }, //Healing Water
+		{ 3842, 42, 19 }, //Blood of Nadox
+		{ 3847, 125, 48 }, //Cloak of Khala Dun
+		{ 3848, 25, 38 }, //Tortured Memory II
+		{ 3849, 123, 116 }, //Alter Plane: Hate II
+		{ 3854, 125, 48 }, //Form of Protection
+		{ 3855, 125, 48 }, //Form of Defense
+		{ 3856, 125, 48 }, //Form of Endurance
+		{ 3857, 125, 48 }, //Form of Rejuvenation
+		{ 3861, 125, 16 }, //Pestilence Shock
+		{ 3864, 125, 16 }, //Soul Claw
+		{ 3876, 25, 14 }, //Frozen Shards
+		{ 3877, 20, 58 }, //Nightmares
+		{ 3878, 25, 58 }, //Time Rend
+		{ 3881, 25, 0 }, //Hand of Retribution
+		{ 3909, 126, 88 }, //Clinging Clay
+		{ 3910, 25, 38 }, //Flames of Condemnation
+		{ 3921, 123, 64 }, //Guide Evacuation
+		{ 3975, 25, 97 }, //Force of Akera
+		{ 3976, 25, 58 }, //Draught of Lightning
+		{ 3981, 18, 64 }, //Mass Clarify Mana
+		{ 3982, 18, 64 }, //Mass Crystallize Mana
+		{ 3983, 18, 64 }, //Mass Distill Mana
+		{ 3984, 18, 34 }, //Mass Enchant Adamantite
+		{ 3985, 18, 34 }, //Mass Enchant Brellium
+		{ 3986, 18, 34 }, //Mass Enchant Clay
+		{ 3987, 18, 34 }, //Mass Enchant Electrum
+		{ 3988, 18, 34 }, //Mass Enchant Gold
+		{ 3989, 18, 34 }, //Mass Enchant Mithril
+		{ 3990, 18, 34 }, //Mass Enchant Platinum
+		{ 3991, 18, 34 }, //Mass Enchant Silver
+		{ 3992, 18, 34 }, //Mass Enchant Steel
+		{ 3993, 18, 34 }, //Mass Enchant Velium
+		{ 3994, 18, 50 }, //Mass Imbue Amber
+		{ 3995, 18, 50 }, //Mass Imbue Black Pearl
+		{ 3996, 18, 50 }, //Mass Imbue Black Sapphire
+		{ 3997, 18, 50 }, //Mass Imbue Diamond
+		{ 3998, 18, 50 }, //Mass Imbue Emerald
+		{ 3999, 18, 50 }, //Mass Imbue Fire Opal
+		{ 4000, 18, 50 }, //Mass Imbue Ivory
+		{ 4001, 18, 50 }, //Mass Imbue Jade
+		{ 4002, 18, 50 }, //Mass Imbue Opal
+		{ 4003, 18, 50 }, //Mass Imbue Peridot
+		{ 4004, 18, 50 }, //Mass Imbue Plains Pebble
+		{ 4005, 18, 50 }, //Mass Imbue Rose Quartz
+		{ 4006, 18, 50 }, //Mass Imbue Ruby
+		{ 4007, 18, 50 }, //Mass Imbue Sapphire
+		{ 4008, 18, 50 }, //Mass Imbue Topaz
+		{ 4009, 18, 64 }, //Mass Purify Mana
+		{ 4010, 18, 64 }, //Mass Thicken Mana
+		{ 4011, 69, 70 }, //Kindle
+		{ 4017, 125, 49 }, //Illusion: Guktan
+		{ 4018, 69, 10 }, //RytanGuard1
+		{ 4019, 69, 10 }, //RytanGuard2
+		{ 4020, 69, 10 }, //RytanGuard3
+		{ 4021, 69, 10 }, //RytanGuard4
+		{ 4022, 25, 38 }, //RytanBoltTest
+		{ 4027, 18, 107 }, //Summon Wooden Bracelet
+		{ 4028, 18, 107 }, //Summon Stone Bracelet
+		{ 4029, 18, 107 }, //Summon Iron Bracelet
+		{ 4030, 18, 107 }, //Summon Steel Bracelet
+		{ 4049, 95, 80 }, //Circle of Cooling
+		{ 4050, 95, 80 }, //Circle of Warmth
+		{ 4051, 95, 80 }, //Talisman of Purity
+		{ 4052, 95, 80 }, //Talisman of Vitality
+		{ 4053, 45, 1 }, //Blessing of Temperance
+		{ 4054, 125, 65 }, //Spirit of the Shrew
+		{ 4055, 125, 65 }, //Pack Shrew
+		{ 4056, 42, 19 }, //Remove Minor Curse
+		{ 4057, 42, 19 }, //Remove Lesser Curse
+		{ 4058, 125, 65 }, //Feral Pack
+		{ 4059, 125, 16 }, //Call of Ice
+		{ 4062, 125, 17 }, //Dark Temptation
+		{ 4063, 125, 17 }, //Call of Darkness
+		{ 4064, 45, 1 }, //Austerity
+		{ 4065, 45, 1 }, //Blessing of Austerity
+		{ 4066, 25, 14 }, //Ice Meteor
+		{ 4067, 125, 92 }, //Ward of Calrena
+		{ 4068, 125, 92 }, //Guard of Calrena
+		{ 4069, 125, 92 }, //Protection of Calrena
+		{ 4070, 125, 92 }, //Magi Ward
+		{ 4071, 125, 92 }, //Mana Ward
+		{ 4072, 125, 49 }, //Deception
+		{ 4073, 125, 92 }, //Ward of Alendar
+		{ 4074, 125, 92 }, //Guard of Alendar
+		{ 4075, 125, 92 }, //Protection of Alendar
+		{ 4076, 125, 92 }, //Bulwark of Alendar
+		{ 4077, 126, 13 }, //Ordinance
+		{ 4078, 25, 38 }, //Wind of the Desert
+		{ 4079, 69, 10 }, //Ward of Calliav
+		{ 4080, 69, 10 }, //Guard of Calliav
+		{ 4081, 69, 10 }, //Protection of Calliav
+		{ 4082, 18, 109 }, //Summon: Orb of Exploration
+		{ 4083, 125, 91 }, //Rizlona's Embers
+		{ 4084, 125, 91 }, //Rizlona's Fire
+		{ 4085, 125, 91 }, //Forpar's Aria of Affliction
+		{ 4086, 125, 91 }, //Forpar's Psalm of Pain
+		{ 4087, 125, 91 }, //Forpar's Verse of Venom
+		{ 4088, 125, 62 }, //Ward of Vie
+		{ 4089, 125, 62 }, //Guard of Vie
+		{ 4090, 125, 62 }, //Protection of Vie
+		{ 4091, 125, 62 }, //Bulwark of Vie
+		{ 4092, 20, 58 }, //Curse
+		{ 4093, 20, 58 }, //Odium
+		{ 4094, 20, 58 }, //Anathema
+		{ 4095, 20, 58 }, //Bane
+		{ 4096, 20, 58 }, //Dark Soul
+		{ 4097, 20, 58 }, //Imprecation
+		{ 4098, 20, 58 }, //Horror
+		{ 4099, 125, 78 }, //Bounce
+		{ 4100, 125, 78 }, //Reflect
+		{ 4101, 25, 124 }, //Scythe of Innoruuk
+		{ 4102, 25, 124 }, //Scythe of Darkness
+		{ 4103, 25, 124 }, //Scythe of Death
+		{ 4104, 20, 38 }, //Vengeance of the Wild
+		{ 4105, 20, 38 }, //Vengeance of Nature
+		{ 4106, 20, 38 }, //Vengeance of Tunare
+		{ 4107, 125, 65 }, //Feral Form
+		{ 4108, 125, 91 }, //Aura of Reverence
+		{ 4109, 45, 1 }, //Guidance
+		{ 4110, 25, 38 }, //Burning Sand
+		{ 4111, 20, 58 }, //Fire Swarm
+		{ 4112, 125, 91 }, //Call of the Muse
+		{ 4210, 20, 58 }, //Fufil`s Diminishing Dirge
+		{ 4239, 125, 64 }, //Breathless Mist
+		{ 4240, 125, 51 }, //Essence of Concealment
+		{ 4241, 125, 55 }, //Weightless Mist
+		{ 4242, 125, 65 }, //Mist of the Wolf
+		{ 4252, 66, 85 }, //Xalirilan's Lesser Appraisal
+		{ 4253, 66, 85 }, //Xalirilan's Appraisal
+		{ 4254, 66, 85 }, //Xalirilan's Greater Appraisal
+		{ 4255, 66, 85 }, //Wuggan's Lesser Appraisal
+		{ 4256, 66, 85 }, //Wuggan's Appraisal
+		{ 4257, 66, 85 }, //Wuggan's Greater Appraisal
+		{ 4258, 66, 85 }, //Iony's Lesser Augury
+		{ 4259, 66, 85 }, //Iony's Augury
+		{ 4260, 66, 85 }, //Iony's Greater Augury
+		{ 4261, 66, 85 }, //Reebo's Lesser Augury
+		{ 4262, 66, 85 }, //Reebo's Augury
+		{ 4263, 66, 85 }, //Reebo's Greater Augury
+		{ 4264, 66, 26 }, //Xalirilan's Lesser Discombobulation
+		{ 4265, 66, 26 }, //Xalirilan's Discombobulation
+		{ 4266, 66, 26 }, //Xalirilan's Greater Discombobulation
+		{ 4267, 66, 26 }, //Wuggan's Lesser Discombobulation
+		{ 4268, 66, 26 }, //Wuggan's Discombobulation
+		{ 4269, 66, 26 }, //Wuggan's Greater Discombobulation
+		{ 4270, 66, 26 }, //Iony's Lesser Exorcism
+		{ 4271, 66, 26 }, //Iony's Exorcism
+		{ 4272, 66, 26 }, //Iony's Greater Exorcism
+		{ 4273, 66, 26 }, //Reebo's Lesser Exorcism
+		{ 4274, 66, 26 }, //Reebo's Exorcism
+		{ 4275, 66, 26 }, //Reebo's Greater Exorcism
+		{ 4276, 66, 73 }, //Xalirilan's Lesser Extrication
+		{ 4277, 66, 73 }, //Xalirilan's Extrication
+		{ 4278, 66, 73 }, //Xalirilan's Greater Extrication
+		{ 4279, 66, 73 }, //Wuggan's Lesser Extrication
+		{ 4280, 66, 73 }, //Wuggan's Extrication
+		{ 4281, 66, 73 }, //Wuggan's Greater Extrication
+		{ 4282, 66, 73 }, //Iony's Lesser Cleansing
+		{ 4283, 66, 73 }, //Iony's Cleansing
+		{ 4284, 66, 73 }, //Iony's Greater Cleansing
+		{ 4285, 66, 73 }, //Reebo's Lesser Cleansing
+		{ 4286, 66, 73 }, //Reebo's Cleansing
+		{ 4287, 66, 73 }, //Reebo's Greater Cleansing
+		{ 4291, 79, 59 }, //Aura of Quellious
+		{ 4350, 18, 110 }, //Transmute Hunter's Dagger
+		{ 4351, 18, 110 }, //Transmute Hunter's Barbs
+		{ 4352, 18, 110 }, //Transmute Wayfarer's Bread
+		{ 4353, 18, 110 }, //Transmute Wayfarer's Tonic
+		{ 4354, 18, 110 }, //Transmute Traveler's Bandage
+		{ 4355, 18, 110 }, //Transmute Wayfarer's Wine
+		{ 4356, 25, 58 }, //Bite of Ykesha
+		{ 4357, 25, 58 }, //Strike of Ykesha
+		{ 4358, 25, 58 }, //Force of Ykesha
+		{ 4359, 25, 58 }, //Wrath of Ykesha
+		{ 4360, 25, 58 }, //Rujarkian Breath
+		{ 4361, 25, 58 }, //Rujarkian Mist
+		{ 4362, 25, 58 }, //Rujarkian Poison
+		{ 4363, 25, 58 }, //Rujarkian Bile
+		{ 4364, 25, 58 }, //Rujarkian Venom
+		{ 4365, 25, 58 }, //Heated Blade
+		{ 4366, 25, 58 }, //Burning Blade
+		{ 4367, 25, 58 }, //Blazing Blade
+		{ 4368, 25, 58 }, //Flaming Blade
+		{ 4369, 25, 58 }, //Inferno Blade
+		{ 4370, 25, 58 }, //Vampire Touch
+		{ 4371, 25, 58 }, //Vampire Claw
+		{ 4372, 25, 58 }, //Vampire Talon
+		{ 4373, 25, 58 }, //Vampire Fangs
+		{ 4374, 25, 58 }, //Vampire Kiss
+		{ 4375, 25, 58 }, //Chill
+		{ 4376, 25, 58 }, //Icicle Strike
+		{ 4377, 25, 58 }, //Icicle Claw
+		{ 4378, 25, 58 }, //Vox' Bite
+		{ 4379, 25, 58 }, //Permafrost
+		{ 4380, 125, 78 }, //Mirror I
+		{ 4381, 125, 78 }, //Mirror II
+		{ 4382, 125, 78 }, //Mirror III
+		{ 4383, 125, 78 }, //Mirror IV
+		{ 4384, 125, 62 }, //Guard I
+		{ 4385, 125, 62 }, //Guard II
+		{ 4386, 125, 62 }, //Guard III
+		{ 4387, 125, 62 }, //Guard IV
+		{ 4388, 125, 62 }, //Spell Guard I
+		{ 4389, 125, 62 }, //Spell Guard II
+		{ 4390, 125, 62 }, //Spell Guard III
+		{ 4391, 125, 62 }, //Spell Guard IV
+		{ 4395, 125, 65 }, //Selo's Rhythm of Speed
+		{ 4408, 25, 97 }, //Color Cloud
+		{ 4413, 25, 58 }, //Golem Pulverize
+		{ 4414, 25, 14 }, //Rimebone Frost Burst
+		{ 4418, 125, 48 }, //Illusion: Frost Bone
+		{ 4489, 126, 88 }, //Taelosian Vengeance
+		{ 4492, 25, 14 }, //Geostrike
+		{ 4493, 25, 38 }, //Earth Wave
+		{ 4496, 25, 38 }, //Rock Storm
+		{ 4497, 25, 14 }, //Earth Shards
+		{ 4498, 27, 119 }, //Aggressive Discipline
+		{ 4499, 27, 117 }, //Defensive Discipline
+		{ 4500, 27, 117 }, //Holyforge Discipline
+		{ 4501, 27, 119 }, //Precision Discipline
+		{ 4502, 27, 117 }, //Voiddance Discipline
+		{ 4503, 27, 117 }, //Evasive Discipline
+		{ 4504, 27, 118 }, //Leechcurse Discipline
+		{ 4505, 27, 119 }, //Deadeye Discipline
+		{ 4506, 27, 117 }, //Trueshot Discipline
+		{ 4507, 27, 119 }, //Silentfist Discipline
+		{ 4508, 27, 119 }, //Ashenhand Discipline
+		{ 4509, 27, 117 }, //Whirlwind Discipline
+		{ 4510, 27, 117 }, //Stonestance Discipline
+		{ 4511, 27, 119 }, //Thunderkick Discipline
+		{ 4512, 27, 118 }, //Innerflame Discipline
+		{ 4513, 27, 118 }, //Hundred Fists Discipline
+		{ 4514, 27, 119 }, //Mighty Strike Discipline
+		{ 4515, 27, 117 }, //Nimble Discipline
+		{ 4516, 27, 117 }, //Deftdance Discipline
+		{ 4517, 27, 118 }, //Kinesthetics Discipline
+		{ 4518, 27, 118 }, //Sanctification Discipline
+		{ 4519, 27, 118 }, //Weapon Shield Discipline
+		{ 4520, 27, 117 }, //Unholy Aura Discipline
+		{ 4521, 95, 7 }, //Bestial Alignment I
+		{ 4522, 95, 7 }, //Bestial Alignment II
+		{ 4523, 95, 7 }, //Bestial Alignment III
+		{ 4524, 95, 7 }, //Bestial Alignment I
+		{ 4525, 95, 7 }, //Bestial Alignment II
+		{ 4526, 95, 7 }, //Bestial Alignment III
+		{ 4527, 95, 7 }, //Bestial Alignment I
+		{ 4528, 95, 7 }, //Bestial Alignment II
+		{ 4529, 95, 7 }, //Bestial Alignment III
+		{ 4530, 95, 7 }, //Bestial Alignment I
+		{ 4531, 95, 7 }, //Bestial Alignment II
+		{ 4532, 95, 7 }, //Bestial Alignment III
+		{ 4533, 95, 7 }, //Bestial Alignment I
+		{ 4534, 95, 7 }, //Bestial Alignment II
+		{ 4535, 95, 7 }, //Bestial Alignment III
+		{ 4536, 125, 48 }, //Frenzied Aura
+		{ 4537, 69, 71 }, //Icy Grasp
+		{ 4538, 25, 58 }, //Icy Grasp Strike
+		{ 4549, 95, 7 }, //Divine Avatar I
+		{ 4550, 95, 7 }, //Divine Avatar II
+		{ 4551, 95, 7 }, //Divine Avatar III
+		{ 4555, 126, 13 }, //Elemental Domination
+		{ 4567, 20, 58 }, //Aneuk Grasp
+		{ 4574, 20, 58 }, //Hynid Snap
+		{ 4578, 25, 58 }, //Turepta Crush
+		{ 4579, 20, 58 }, //Ukun Chains
+		{ 4585, 27, 120 }, //Resistant Discipline
+		{ 4586, 27, 118 }, //Puretone Discipline
+		{ 4587, 27, 120 }, //Fearless Discipline
+		{ 4588, 115, 68 }, //Infuriate
+		{ 4589, 115, 22 }, //Barrier
+		{ 4590, 115, 22 }, //Cover
+		{ 4591, 115, 22 }, //Guard
+		{ 4592, 115, 22 }, //Infallible
+		{ 4593, 115, 90 }, //Crippling Strike
+		{ 4595, 115, 68 }, //Muscle Shock
+		{ 4596, 115, 90 }, //Armor Slice
+		{ 4597, 115, 68 }, //Gauntlet Strike
+		{ 4598, 115, 68 }, //Head Bash
+		{ 4599, 115, 40 }, //Rally Cry
+		{ 4600, 115, 68 }, //Shin Kick
+		{ 4601, 115, 40 }, //Rage
+		{ 4602, 115, 90 }, //Power Slam
+		{ 4603, 115, 68 }, //Stomp
+		{ 4604, 115, 68 }, //Back Swing
+		{ 4605, 115, 68 }, //Slice
+		{ 4607, 115, 68 }, //Flurry
+		{ 4608, 15, 115 }, //Provoke
+		{ 4612, 113, 118 }, //Enrage
+		{ 4614, 15, 115 }, //Phantom Zephyr
+		{ 4615, 115, 22 }, //Fortitude
+		{ 4616, 115, 22 }, //Pain Tolerance
+		{ 4618, 115, 90 }, //Fortune
+		{ 4619, 115, 22 }, //Quick Feet
+		{ 4620, 115, 22 }, //Ton Po's Defense
+		{ 4621, 115, 22 }, //Focused Aura
+		{ 4622, 115, 68 }, //Overwhelm
+		{ 4623, 115, 22 }, //Tranquil Force
+		{ 4624, 115, 90 }, //Grapple
+		{ 4625, 115, 90 }, //Armor Crush
+		{ 4626, 115, 68 }, //Leg Sweep
+		{ 4627, 115, 90 }, //Nerve Strike
+		{ 4628, 115, 90 }, //Nerve Spasm
+		{ 4629, 115, 68 }, //Thunderkick
+		{ 4630, 115, 40 }, //Master's Fury
+		{ 4631, 115, 68 }, //Ashenhand
+		{ 4632, 115, 40 }, //Aura of Speed
+		{ 4633, 115, 68 }, //Whirlwind Kick
+		{ 4634, 115, 68 }, //Dragon Strike
+		{ 4635, 115, 90 }, //Tranquil Focus
+		{ 4636, 115, 68 }, //Rapid Jab
+		{ 4637, 115, 68 }, //Wind of Force
+		{ 4638, 115, 90 }, //Pain Strike
+		{ 4639, 115, 90 }, //Indirection
+		{ 4640, 115, 90 }, //Focus
+		{ 4641, 115, 22 }, //Reflexes
+		{ 4642, 115, 22 }, //Mental Block
+		{ 4643, 115, 68 }, //Proficiency
+		{ 4644, 115, 90 }, //Bind
+		{ 4645, 115, 90 }, //Armor Pierce
+		{ 4646, 115, 90 }, //Eye Gouge
+		{ 4647, 115, 68 }, //Tendon Slice
+		{ 4648, 115, 90 }, //Wrist Slice
+		{ 4649, 115, 40 }, //Assassin's Focus
+		{ 4650, 115, 68 }, //Lunge
+		{ 4651, 115, 40 }, //Direct Assault
+		{ 4652, 115, 68 }, //Vital Cut
+		{ 4653, 115, 40 }, //Blood Feast
+		{ 4654, 115, 68 }, //Blood Slice
+		{ 4655, 115, 68 }, //Energy Sap
+		{ 4656, 115, 90 }, //Mind Snap
+		{ 4657, 115, 90 }, //Burning Spasm
+		{ 4658, 115, 68 }, //Double Stab
+		{ 4659, 15, 115 }, //Sneak Attack
+		{ 4670, 27, 118 }, //Fortitude Discipline
+		{ 4671, 27, 117 }, //Protective Spirit Discipline
+		{ 4672, 27, 119 }, //Charge Discipline
+		{ 4673, 27, 117 }, //Counterattack Discipline
+		{ 4674, 27, 118 }, //Furious Discipline
+		{ 4675, 27, 119 }, //Fellstrike Discipline
+		{ 4676, 27, 118 }, //Duelist Discipline
+		{ 4677, 27, 119 }, //Blinding Speed Discipline
+		{ 4678, 27, 118 }, //Bestial Fury Discipline
+		{ 4679, 115, 68 }, //Energy Sap Recourse
+		{ 4680, 115, 22 }, //Cover Recourse
+		{ 4681, 15, 115 }, //Bellow
+		{ 4682, 15, 115 }, //Berate
+		{ 4683, 15, 115 }, //Phantom Wind
+		{ 4684, 15, 115 }, //Phantom Echo
+		{ 4685, 15, 115 }, //Thief's Vengeance
+		{ 4686, 15, 115 }, //Assassin's Strike
+		{ 4687, 27, 120 }, //Healing Will Discipline
+		{ 4688, 27, 117 }, //Stonewall Discipline
+		{ 4689, 27, 120 }, //Spirit of Rage Discipline
+		{ 4690, 27, 117 }, //Earthwalk Discipline
+		{ 4691, 27, 118 }, //Speed Focus Discipline
+		{ 4692, 27, 120 }, //Planeswalk Discipline
+		{ 4693, 27, 117 }, //Concentration Discipline
+		{ 4694, 27, 119 }, //Deadly Precision Discipline
+		{ 4695, 27, 118 }, //Twisted Chance Discipline
+		{ 4696, 27, 120 }, //Weapon Affinity Discipline
+		{ 4697, 15, 115 }, //Incite
+		{ 4698, 15, 115 }, //Phantom Call
+		{ 4699, 25, 58 }, //Bite of the Hounds
+		{ 4700, 25, 58 }, //Claw of the Beast
+		{ 4701, 25, 58 }, //Warhound's Affliction
+		{ 4704, 42, 19 }, //Blood Scream
+		{ 4706, 115, 40 }, //Mindless Rage
+		{ 4716, 126, 13 }, //Call of Rav
+		{ 4717, 126, 88 }, //Diseased Maw
+		{ 4721, 27, 120 }, //Focused Will Discipline
+		{ 4724, 79, 44 }, //Abysmal Replenishment
+		{ 4726, 25, 58 }, //Bite of Keras
+		{ 4741, 125, 78 }, //Reflection of Discord I
+		{ 4742, 125, 78 }, //Reflection of Discord II
+		{ 4743, 125, 78 }, //Reflection of Discord III
+		{ 4786, 69, 71 }, //Icy Grasp
+		{ 4788, 115, 68 }, //Feral Swipe
+		{ 4789, 125, 52 }, //Touch of the Divine
+		{ 4795, 79, 43 }, //Aura of Restoration
+		{ 4801, 125, 86 }, //Doppelganger Recourse
+		{ 4802, 69, 71 }, //Flames of Kesh`yk I
+		{ 4803, 69, 71 }, //Flames of Kesh`yk II
+		{ 4804, 69, 71 }, //Flames of Kesh`yk III
+		{ 4805, 69, 71 }, //Frost of Kesh`yk I
+		{ 4806, 69, 71 }, //Frost of Kesh`yk II
+		{ 4807, 69, 71 }, //Frost of Kesh`yk III
+		{ 4808, 69, 71 }, //Lightning of Kesh`yk I
+		{ 4809, 69, 71 }, //Lightning of Kesh`yk II
+		{ 4810, 69, 71 }, //Lightning of Kesh`yk III
+		{ 4811, 69, 71 }, //Flames of Kesh`yk Effect I
+		{ 4812, 69, 71 }, //Flames of Kesh`yk Effect II
+		{ 4813, 69, 71 }, //Flames of Kesh`yk Effect III
+		{ 4814, 69, 71 }, //Frost of Kesh`yk Effect I
+		{ 4815, 69, 71 }, //Frost of Kesh`yk Effect II
+		{ 4816, 69, 71 }, //Frost of Kesh`yk Effect III
+		{ 4817, 69, 71 }, //Lightning of Kesh`yk Effect I
+		{ 4818, 69, 71 }, //Lightning of Kesh`yk Effect II
+		{ 4819, 69, 71 }, //Lightning of Kesh`yk Effect III
+		{ 4820, 69, 71 }, //Rabid Companion I
+		{ 4821, 69, 71 }, //Rabid Companion II
+		{ 4822, 69, 71 }, //Rabid Companion III
+		{ 4841, 79, 43 }, //Aura of Fire
+		{ 4842, 25, 58 }, //Exultant Bellow I
+		{ 4843, 25, 58 }, //Exultant Bellow II
+		{ 4844, 25, 58 }, //Exultant Bellow III
+		{ 4845, 25, 58 }, //Exultant Bellow IV
+		{ 4846, 25, 58 }, //Exultant Bellow V
+		{ 4849, 126, 88 }, //Heartstopper
+		{ 4853, 126, 30 }, //Listless Strength
+		{ 4871, 125, 41 }, //War March of the Mastruq
+		{ 4872, 125, 91 }, //Echo of the Trusik
+		{ 4873, 125, 78 }, //Dark Echo
+		{ 4874, 20, 75 }, //Turepta Blood
+		{ 4875, 42, 42 }, //Trushar's Mending
+		{ 4876, 25, 14 }, //Trushar's Frost
+		{ 4877, 126, 35 }, //Apathy of the Nihil
+		{ 4878, 126, 35 }, //Bliss of the Nihil
+		{ 4879, 25, 58 }, //Madness of Ikkibi
+		{ 4880, 42, 42 }, //Holy Light
+		{ 4881, 25, 58 }, //Order
+		{ 4882, 42, 32 }, //Holy Elixir
+		{ 4883, 42, 42 }, //Sylvan Infusion
+		{ 4884, 25, 38 }, //Sylvan Fire
+		{ 4885, 20, 38 }, //Sylvan Embers
+		{ 4886, 69, 17 }, //Elemental Siphon
+		{ 4887, 25, 58 }, //Rock of Taelosia
+		{ 4888, 69, 64 }, //Monster Summoning IV
+		{ 4889, 114, 33 }, //Night Stalker
+		{ 4890, 20, 38 }, //Night Fire
+		{ 4891, 114, 33 }, //Night's Beckon
+		{ 4893, 42, 42 }, //Wave of Trushar
+		{ 4894, 42, 77 }, //Light of Order
+		{ 4895, 125, 16 }, //Holy Order
+		{ 4896, 42, 42 }, //Sylvan Light
+		{ 4897, 25, 38 }, //Sylvan Burn
+		{ 4898, 125, 16 }, //Sylvan Call
+		{ 4899, 42, 32 }, //Breath of Trushar
+		{ 4900, 126, 88 }, //Balance of the Nihil
+		{ 4901, 42, 42 }, //Daluda's Mending
+		{ 4902, 125, 16 }, //Mental Horror
+		{ 4903, 125, 16 }, //Black Shroud
+		{ 4904, 25, 29 }, //Miasmic spear
+		{ 4905, 25, 14 }, //Black Ice
+		{ 4906, 25, 38 }, //White Fire
+		{ 4907, 25, 97 }, //Telaka
+		{ 4908, 25, 29 }, //Mental Horror Strike
+		{ 4912, 25, 38 }, //Sylvan Call Strike
+		{ 4913, 25, 58 }, //Holy Order Strike
+		{ 4928, 126, 89 }, //Leg Strike
+		{ 4929, 126, 89 }, //Leg Cut
+		{ 4930, 126, 89 }, //Leg Slice
+		{ 4931, 25, 97 }, //Head Strike
+		{ 4932, 25, 97 }, //Head Pummel
+		{ 4933, 25, 97 }, //Head Crush
+		{ 4934, 126, 53 }, //Diversive Strike
+		{ 4935, 126, 53 }, //Distracting Strike
+		{ 4936, 126, 53 }, //Confusing Strike
+		{ 4937, 18, 110 }, //Corroded Axe
+		{ 4938, 18, 110 }, //Blunt Axe
+		{ 4939, 18, 110 }, //Steel Axe
+		{ 4940, 18, 110 }, //Bearded Axe
+		{ 4941, 18, 110 }, //Mithril Axe
+		{ 4942, 18, 110 }, //Balanced War Axe
+		{ 4943, 18, 110 }, //Bonesplicer Axe
+		{ 4944, 18, 110 }, //Fleshtear Axe
+		{ 4945, 18, 110 }, //Cold Steel Cleaving Axe
+		{ 4946, 18, 110 }, //Mithril Bloodaxe
+		{ 4947, 18, 110 }, //Rage Axe
+		{ 4948, 18, 110 }, //Bloodseekers Axe
+		{ 4949, 18, 110 }, //Battlerage Axe
+		{ 4950, 18, 110 }, //Deathfury Axe
+		{ 4957, 125, 16 }, //Shock of Discord
+		{ 4960, 15, 115 }, //Simmering Rage
+		{ 4961, 15, 115 }, //Bubbling Rage
+		{ 4962, 15, 115 }, //Boiling Rage
+		{ 4963, 123, 113 }, //Natimbi Gate
+		{ 4964, 123, 113 }, //Translocate: Natimbi
+		{ 4965, 123, 113 }, //Natimbi Portal
+		{ 4966, 123, 113 }, //Circle of Natimbi
+		{ 4967, 123, 113 }, //Ring of Natimbi
+		{ 4968, 25, 38 }, //Dark Arrow
+		{ 4970, 25, 14 }, //Prism Strike
+		{ 4971, 20, 29 }, //Ancient: Chaos Chant
+		{ 4972, 25, 14 }, //Ancient: Frozen Chaos
+		{ 4973, 25, 58 }, //Ancient: Chaos Censure
+		{ 4974, 25, 14 }, //Ancient: Chaos Frost
+		{ 4975, 25, 58 }, //Ancient: Chaos Madness
+		{ 4976, 25, 38 }, //Ancient: Chaos Vortex
+		{ 4977, 25, 97 }, //Ancient: Force of Chaos
+		{ 4978, 125, 17 }, //Ancient: Seduction of Chaos
+		{ 4979, 125, 17 }, //Ancient: Chaotic Pain
+		{ 4980, 25, 38 }, //Ancient: Burning Chaos
+		{ 4981, 25, 38 }, //Ancient: Strike of Chaos
+		{ 4982, 114, 33 }, //Ancient: Bite of Chaos
+		{ 4991, 25, 0 }, //Coordinated Strike
+		{ 4992, 20, 58 }, //Malevolent Assault
+		{ 4993, 25, 0 }, //Malevolent Vex
+		{ 4994, 126, 88 }, //Searing Blood Arrow I
+		{ 4995, 126, 88 }, //Searing Blood Arrow II
+		{ 4996, 126, 88 }, //Searing Blood Arrow III
+		{ 4997, 42, 42 }, //Arrow of Renewal
+		{ 5000, 25, 0 }, //Righteous Assault
+		{ 5001, 25, 0 }, //Bury
+		{ 5002, 25, 0 }, //Mana Blast
+		{ 5003, 25, 0 }, //Impoverished Lifeblood
+		{ 5004, 25, 0 }, //Tamuik's Suggestion
+		{ 5005, 25, 0 }, //Tamuik's Ghastly Presence
+		{ 5006, 25, 0 }, //Tamuik's Spectral Step
+		{ 5007, 25, 0 }, //Curse of Tunik Tamuik
+		{ 5008, 25, 0 }, //Bane of Tunik Tamuik
+		{ 5009, 25, 0 }, //Unholy Barrage
+		{ 5010, 25, 0 }, //Strike of Glory
+		{ 5011, 42, 42 }, //Salve
+		{ 5012, 25, 29 }, //Spike of Disease
+		{ 5013, 126, 31 }, //SpellTheft2
+		{ 5014, 126, 31 }, //SpellTheft3
+		{ 5015, 15, 115 }, //Bellow of the Mastruq
+		{ 5016, 15, 115 }, //Ancient: Chaos Cry
+		{ 5017, 15, 115 }, //Kyv Strike
+		{ 5018, 15, 115 }, //Ancient: Chaos Strike
+		{ 5019, 15, 115 }, //Phantom Shadow
+		{ 5020, 15, 115 }, //Ancient: Phantom Chaos
+		{ 5022, 25, 0 }, //Dark Balance
+		{ 5023, 25, 0 }, //Chaos Epidemic
+		{ 5024, 25, 0 }, //Chaos Epidemic
+		{ 5027, 95, 7 }, //Battle Cry
+		{ 5028, 95, 7 }, //War Cry
+		{ 5029, 95, 7 }, //Battle Cry of Dravel
+		{ 5030, 95, 7 }, //War Cry of Dravel
+		{ 5031, 95, 7 }, //Battle Cry of the Mastruq
+		{ 5032, 95, 7 }, //Ancient: Cry of Chaos
+		{ 5033, 95, 7 }, //Berserker Rage
+		{ 5034, 27, 119 }, //Burning Rage Discipline
+		{ 5035, 27, 119 }, //Focused Fury Discipline
+		{ 5036, 27, 117 }, //Battle Sense Discipline
+		{ 5037, 27, 119 }, //Cleaving Rage Discipline
+		{ 5038, 27, 118 }, //Battle Focus Discipline
+		{ 5039, 27, 119 }, //Inspired Anger Discipline
+		{ 5040, 27, 118 }, //Reckless Discipline
+		{ 5041, 27, 119 }, //Blind Rage Discipline
+		{ 5042, 27, 118 }, //Indomitable Discipline
+		{ 5043, 27, 118 }, //Cleaving Anger Discipline
+		{ 5044, 27, 120 }, //Sprint Discipline
+		{ 5045, 27, 118 }, //Test1
+		{ 5046, 15, 115 }, //Test2
+		{ 5047, 15, 115 }, //Test3
+		{ 5048, 15, 115 }, //Test4
+		{ 5049, 15, 115 }, //Test5
+		{ 5050, 27, 118 }, //Test6
+		{ 5051, 25, 0 }, //Aura of Destruction
+		{ 5052, 25, 0 }, //Spirit's Touch
+		{ 5053, 25, 0 }, //Destructive Crush
+		{ 5054, 25, 0 }, //Wave of Destruction
+		{ 5055, 25, 0 }, //Creeping Fury
+		{ 5056, 25, 0 }, //Rampaging Force
+		{ 5057, 25, 0 }, //Barxt's Destructive Touch
+		{ 5058, 25, 0 }, //Barxt's Mental Corruption
+		{ 5059, 25, 0 }, //Wave of Absolute Power
+		{ 5060, 42, 42 }, //Discordant Light
+		{ 5063, 115, 68 }, //Mug
+		{ 5064, 125, 64 }, //Hastened Thoughts
+		{ 5070, 25, 0 }, //Armor Shatter
+		{ 5071, 25, 0 }, //Energy Siphon
+		{ 5073, 25, 0 }, //Soul Vortex
+		{ 5074, 25, 0 }, //Black Pox
+		{ 5094, 27, 118 }, //test ac
+		{ 5095, 69, 99 }, //Item Pet I
+		{ 5096, 69, 99 }, //Item Pet II
+		{ 5101, 18, 64 }, //Fire Shard
+		{ 5102, 18, 64 }, //Frost Hammer
+		{ 5103, 25, 58 }, //Flame Strike
+		{ 5104, 25, 58 }, //Frost Strike
+		{ 5105, 125, 92 }, //Geomantra
+		{ 5107, 18, 110 }, //Tainted Axe of Hatred
+		{ 5118, 25, 0 }, //Intoxicating Fury
+		{ 5119, 25, 0 }, //Force of Trusik's Rage
+		{ 5120, 25, 0 }, //Withering Destruction
+		{ 5125, 25, 38 }, //Venom Claw
+		{ 5127, 25, 14 }, //Prism Skin
+		{ 5133, 69, 17 }, //Elemental Draw
+		{ 5135, 69, 10 }, //SpellTheft4
+		{ 5148, 25, 0 }, //Massive Explosion
+		{ 5150, 45, 46 }, //Gloomingdeep Guard
+		{ 5190, 25, 97 }, //PvPSilTest1
+		{ 5191, 25, 97 }, //PvPSilTest2
+		{ 5192, 25, 97 }, //PvPSilTest3
+		{ 5193, 25, 97 }, //PvPSilTest4
+		{ 5194, 25, 97 }, //PvPSilTest5
+		{ 5195, 25, 97 }, //PvPSil2Test1
+		{ 5196, 25, 97 }, //PvPSil2Test2
+		{ 5197, 25, 97 }, //PvPSil2Test3
+		{ 5198, 25, 97 }, //PvPSil2Test4
+		{ 5199, 25, 97 }, //PvPSil2Test5
+		{ 5200, 69, 71 }, //PvPStunTest1
+		{ 5201, 69, 71 }, //PvPStunTest2
+		{ 5202, 69, 71 }, //PvPStunTest3
+		{ 5203, 69, 71 }, //PvPStunTest4
+		{ 5204, 69, 71 }, //PvPStunTest5
+		{ 5205, 69, 71 }, //5200 Strike
+		{ 5206, 69, 71 }, //5201 Strike
+		{ 5207, 69, 71 }, //5202 Strike
+		{ 5208, 69, 71 }, //5203 Strike
+		{ 5209, 69, 71 }, //5204 Strike
+		{ 5210, 69, 71 }, //PvPSnareTest1
+		{ 5211, 69, 71 }, //PvPSnareTest2
+		{ 5212, 69, 71 }, //PvPSnareTest3
+		{ 5213, 69, 71 }, //PvPSnareTest4
+		{ 5214, 69, 71 }, //PvPSnareTest5
+		{ 5215, 69, 71 }, //5210 Strike
+		{ 5216, 69, 71 }, //5211 Strike
+		{ 5217, 69, 71 }, //5212 Strike
+		{ 5218, 69, 71 }, //5213 Strike
+		{ 5219, 69, 71 }, //5214 Strike
+		{ 5220, 95, 96 }, //Jarsath Frenzy
+		{ 5221, 25, 58 }, //Rage of Xyzith
+		{ 5222, 114, 33 }, //Morternum
+		{ 5226, 79, 43 }, //Arias' Guard
+		{ 5250, 45, 46 }, //Confidence
+		{ 5251, 42, 77 }, //Pious Remedy
+		{ 5252, 45, 112 }, //Symbol of Balikor
+		{ 5253, 95, 6 }, //Ward of Valiance
+		{ 5254, 25, 97 }, //Shock of Wonder
+		{ 5255, 20, 124 }, //Sermon of Reproach
+		{ 5256, 69, 99 }, //Unswerving Hammer of Retribution
+		{ 5257, 45, 1 }, //Conviction
+		{ 5258, 125, 91 }, //Blessing of Devotion
+		{ 5259, 42, 32 }, //Pious Elixir
+		{ 5260, 25, 58 }, //Reproach
+		{ 5261, 125, 62 }, //Panoply of Vie
+		{ 5262, 125, 91 }, //Omen-Cleric-PH
+		{ 5263, 125, 64 }, //Omen-Cleric-PH
+		{ 5264, 18, 110 }, //Hammer of Reproach
+		{ 5265, 42, 42 }, //Pious Light
+		{ 5266, 25, 97 }, //Sound of Divinity
+		{ 5267, 126, 83 }, //Omen-Cleric-PH
+		{ 5268, 25, 124 }, //Desolate Undead
+		{ 5269, 125, 21 }, //Mark of the Blameless
+		{ 5270, 42, 42 }, //Word of Vivification
+		{ 5271, 25, 58 }, //Calamity
+		{ 5272, 125, 91 }, //Aura of Devotion
+		{ 5273, 95, 7 }, //Yaulp VII
+		{ 5274, 126, 11 }, //Placate
+		{ 5275, 25, 97 }, //Silent Dictation
+		{ 5276, 45, 87 }, //Armor of the Pious
+		{ 5277, 45, 112 }, //Balikor's Mark
+		{ 5278, 45, 1 }, //Hand of Conviction
+		{ 5279, 25, 58 }, //Ancient: Pious Conscience
+		{ 5280, 45, 46 }, //Direction
+		{ 5281, 126, 83 }, //Omen-Paladin-PH
+		{ 5282, 42, 42 }, //Touch of Piety
+		{ 5283, 42, 19 }, //Crusader's Purity
+		{ 5284, 25, 97 }, //Force of Piety
+		{ 5285, 125, 16 }, //Silvered Fury
+		{ 5286, 25, 124 }, //Spurn Undead
+		{ 5287, 45, 112 }, //Symbol of Jeron
+		{ 5288, 125, 16 }, //Pious Fury
+		{ 5289, 42, 77 }, //Light of Piety
+		{ 5290, 45, 46 }, //Hand of Direction
+		{ 5291, 45, 87 }, //Armor of the Champion
+		{ 5292, 25, 97 }, //Serene Command
+		{ 5293, 42, 32 }, //Pious Cleansing
+		{ 5294, 95, 6 }, //Bulwark of Piety
+		{ 5295, 45, 112 }, //Jeron's Mark
+		{ 5296, 42, 42 }, //Wave of Piety
+		{ 5297, 45, 47 }, //Brell's Brawny Bulwark
+		{ 5298, 45, 1 }, //Affirmation
+		{ 5299, 25, 97 }, //Ancient: Force of Jeron
+		{ 5300, 126, 16 }, //Nature Veil
+		{ 5301, 25, 111 }, //Displace Summoned
+		{ 5302, 125, 21 }, //Shield of Briar
+		{ 5303, 20, 58 }, //Locust Swarm
+		{ 5304, 42, 42 }, //Sylvan Water
+		{ 5305, 125, 21 }, //Guard of the Earth
+		{ 5306, 45, 47 }, //Strength of the Hunter
+		{ 5307, 125, 21 }, //Briarcoat
+		{ 5308, 126, 83 }, //Nature's Veil Parry
+		{ 5309, 25, 14 }, //Frost Wind
+		{ 5310, 79, 43 }, //Hunter's Vigor
+		{ 5311, 125, 16 }, //Nature's Denial
+		{ 5312, 95, 7 }, //Howl of the Predator
+		{ 5313, 25, 38 }, //Hearth Embers
+		{ 5314, 126, 31 }, //Nature's Balance
+		{ 5315, 45, 46 }, //Onyx Skin
+		{ 5316, 126, 11 }, //Tranquility of the Glade
+		{ 5317, 125, 21 }, //Ward of the Hunter
+		{ 5318, 125, 16 }, //Call of Lightning
+		{ 5319, 25, 14 }, //Ancient: North Wind
+		{ 5320, 20, 38 }, //Blood of Discord
+		{ 5321, 20, 58 }, //Dark Tendrils
+		{ 5322, 20, 29 }, //Dark Constriction
+		{ 5323, 114, 33 }, //Bond of Inruku
+		{ 5324, 114, 43 }, //Touch of Inruku
+		{ 5325, 114, 33 }, //Inruku's Bite
+		{ 5326, 25, 124 }, //Omen-SK-PH
+		{ 5327, 125, 16 }, //Shroud of Discord
+		{ 5328, 114, 76 }, //Theft of Pain
+		{ 5329, 126, 53 }, //Terror of Discord
+		{ 5330, 20, 75 }, //Blood of Inruku
+		{ 5331, 69, 103 }, //Son of Decay
+		{ 5332, 69, 70 }, //Rune of Decay
+		{ 5333, 125, 17 }, //Pact of Decay
+		{ 5334, 25, 29 }, //Spear of Muram
+		{ 5335, 25, 124 }, //Scythe of Inruku
+		{ 5336, 126, 53 }, //Dread Gaze
+		{ 5337, 114, 76 }, //Theft of Hate
+		{ 5338, 114, 43 }, //Touch of the Devourer
+		{ 5339, 45, 87 }, //Cloak of Discord
+		{ 5340, 114, 33 }, //Ancient: Bite of Muram
+		{ 5341, 126, 83 }, //Omen-Druid-PH
+		{ 5342, 79, 43 }, //Oaken Vigor
+		{ 5343, 25, 58 }, //Stormwatch
+		{ 5344, 126, 81 }, //Hand of the Sun
+		{ 5345, 25, 14 }, //Tempest Wind
+		{ 5346, 25, 58 }, //Earth Shiver
+		{ 5347, 126, 11 }, //Nature's Serenity
+		{ 5348, 20, 38 }, //Immolation of the Sun
+		{ 5349, 126, 89 }, //Hungry Vines
+		{ 5350, 95, 96 }, //Lion's Strength
+		{ 5351, 126, 81 }, //Sun's Corona
+		{ 5352, 45, 46 }, //Steeloak Skin
+		{ 5353, 79, 43 }, //Blessing of Oak
+		{ 5354, 126, 81 }, //Glacier Breath
+		{ 5355, 42, 42 }, //Chlorotrope
+		{ 5356, 125, 62 }, //Oaken Guard
+		{ 5357, 20, 58 }, //Wasp Swarm
+		{ 5358, 125, 21 }, //Nettle Shield
+		{ 5359, 126, 13 }, //Nature's Beckon
+		{ 5360, 126, 83 }, //Omen-Druid-PH
+		{ 5361, 25, 38 }, //Solstice Strike
+		{ 5362, 125, 21 }, //Nettlecoat
+		{ 5363, 20, 38 }, //Vengeance of the Sun
+		{ 5364, 25, 111 }, //Desolate Summoned
+		{ 5365, 125, 21 }, //Circle of Nettles
+		{ 5366, 45, 46 }, //Blessing of Steeloak
+		{ 5367, 25, 14 }, //Glitterfrost
+		{ 5368, 79, 59 }, //Mask of the Wild
+		{ 5369, 25, 14 }, //Ancient: Glacier Frost
+		{ 5370, 126, 11 }, //Luvwen's Aria of Serenity
+		{ 5371, 20, 29 }, //Vulka's Chant of Disease
+		{ 5372, 25, 58 }, //Bellow of Chaos
+		{ 5373, 126, 35 }, //Luvwen's Lullaby
+		{ 5374, 95, 6 }, //Verse of Vesagran
+		{ 5375, 126, 88 }, //Zuriki's Song of Shenanigans
+		{ 5376, 125, 41 }, //War March of Muram
+		{ 5377, 79, 44 }, //Cantata of Life
+		{ 5378, 20, 75 }, //Vulka's Chant of Poison
+		{ 5379, 20, 14 }, //Vulka's Chant of Frost
+		{ 5380, 125, 91 }, //Yelhun's Mystic Call
+		{ 5381, 126, 89 }, //Dirge of Metala
+		{ 5382, 125, 41 }, //Eriki's Psalm of Power
+		{ 5383, 126, 13 }, //Voice of the Vampire
+		{ 5384, 79, 44 }, //Chorus of Life
+		{ 5385, 20, 38 }, //Vulka's Chant of Flame
+		{ 5386, 126, 81 }, //Omen-Bard-PH
+		{ 5387, 126, 35 }, //Vulka's Lullaby
+		{ 5388, 125, 41 }, //Ancient: Call of Power
+		{ 5389, 69, 104 }, //Farrel's Companion
+		{ 5390, 95, 2 }, //Spirit of Sense
+		{ 5391, 25, 75 }, //Yoppa's Spear of Venom
+		{ 5392, 126, 81 }, //Putrid Decay
+		{ 5393, 79, 43 }, //Spirit of Perseverance
+		{ 5394, 126, 30 }, //Crippling Spasm
+		{ 5395, 42, 42 }, //Yoppa's Mending
+		{ 5396, 45, 87 }, //Wunshi's Focusing
+		{ 5397, 95, 6 }, //Ancestral Bulwark
+		{ 5398, 95, 94 }, //Spirit of Fortitude
+		{ 5399, 95, 2 }, //Talisman of Sense
+		{ 5400, 126, 88 }, //Vindictive Spirit
+		{ 5401, 25, 75 }, //Yoppa's Rain of Venom
+		{ 5402, 125, 51 }, //Spirit Veil
+		{ 5403, 125, 17 }, //Pained Memory
+		{ 5404, 95, 96 }, //Spirit of Might
+		{ 5405, 95, 94 }, //Talisman of Fortitude
+		{ 5406, 79, 43 }, //Talisman of Perseverance
+		{ 5407, 126, 0 }, //Shroud of Erana
+		{ 5408, 25, 14 }, //Ice Age
+		{ 5409, 95, 96 }, //Talisman of Might
+		{ 5410, 42, 19 }, //Pure Spirit
+		{ 5411, 20, 29 }, //Breath of Wunshi
+		{ 5412, 20, 58 }, //Curse of Sisslak
+		{ 5413, 126, 81 }, //Shroud of Erana Parry
+		{ 5414, 20, 75 }, //Blood of Yoppa
+		{ 5415, 45, 87 }, //Talisman of Wunshi
+		{ 5416, 42, 32 }, //Spiritual Serenity
+		{ 5417, 95, 7 }, //Champion
+		{ 5418, 125, 17 }, //Ancient: Ancestral Calling
+		{ 5419, 114, 43 }, //Soulspike
+		{ 5420, 25, 75 }, //Acikin
+		{ 5421, 45, 87 }, //Shadow Guard
+		{ 5422, 69, 103 }, //Omen-Nec-PH
+		{ 5423, 20, 29 }, //Chaos Plague
+		{ 5424, 20, 29 }, //Grip of Mori
+		{ 5425, 69, 70 }, //Glyph of Darkness
+		{ 5426, 114, 33 }, //Fang of Death
+		{ 5427, 126, 81 }, //Scent of Midnight
+		{ 5428, 125, 84 }, //Dull Pain
+		{ 5429, 126, 35 }, //Dark Hold
+		{ 5430, 20, 58 }, //Desecrating Darkness
+		{ 5431, 69, 103 }, //Lost Soul
+		{ 5432, 20, 58 }, //Dark Nightmare
+		{ 5433, 20, 75 }, //Chaos Venom
+		{ 5434, 125, 17 }, //Dark Possession
+		{ 5435, 69, 42 }, //Dark Salve
+		{ 5436, 69, 10 }, //Bulwark of Calliav
+		{ 5437, 20, 38 }, //Pyre of Mori
+		{ 5438, 69, 103 }, //Dark Assassin
+		{ 5439, 126, 13 }, //Word of Chaos
+		{ 5440, 25, 124 }, //Desolate Undead
+		{ 5441, 20, 58 }, //Ancient: Curse of Mori
+		{ 5442, 25, 14 }, //Icebane
+		{ 5443, 45, 87 }, //Ether Shield
+		{ 5444, 25, 38 }, //Tears of the Sun
+		{ 5445, 25, 58 }, //Lightningbane
+		{ 5446, 25, 38 }, //Spark of Fire
+		{ 5447, 25, 38 }, //Firebane
+		{ 5448, 125, 84 }, //Ether Skin
+		{ 5449, 25, 58 }, //Spark of Thunder
+		{ 5450, 25, 58 }, //Thundaka
+		{ 5451, 25, 58 }, //Circle of Thunder
+		{ 5452, 25, 58 }, //Spark of Lightning
+		{ 5453, 125, 92 }, //Ether Ward
+		{ 5454, 25, 38 }, //Meteor Storm
+		{ 5455, 25, 38 }, //Circle of Fire
+		{ 5456, 25, 97 }, //Telekara
+		{ 5457, 25, 14 }, //Spark of Ice
+		{ 5458, 25, 14 }, //Gelidin Comet
+		{ 5459, 125, 92 }, //Bulwark of Calrena
+		{ 5460, 69, 99 }, //Solist's Frozen Sword
+		{ 5461, 25, 14 }, //Gelid Rains
+		{ 5462, 25, 38 }, //Corona Flare
+		{ 5463, 25, 38 }, //Ancient: Core Fire
+		{ 5464, 18, 107 }, //Summon Calliav's Runed Mantle
+		{ 5465, 18, 64 }, //Summon Staff of the North Wind
+		{ 5466, 125, 21 }, //Fireskin
+		{ 5467, 18, 64 }, //Summon Fireblade
+		{ 5468, 18, 107 }, //Summon Calliav's Jeweled Bracelet
+		{ 5469, 18, 107 }, //Summon Calliav's Spiked Ring
+		{ 5470, 18, 107 }, //Summon Calliav's Glowing Bauble
+		{ 5471, 18, 107 }, //Summon Calliav's Steel Bracelet
+		{ 5472, 45, 87 }, //Elemental Aura
+		{ 5473, 69, 98 }, //Child of Wind
+		{ 5474, 25, 38 }, //Bolt of Jerikor
+		{ 5475, 18, 107 }, //Summon Calliav's Platinum Choker
+		{ 5476, 79, 44 }, //Phantom Shield
+		{ 5477, 18, 64 }, //Summon Dagger of the Deep
+		{ 5478, 69, 70 }, //Elemental Fury
+		{ 5479, 25, 38 }, //Rain of Jerikor
+		{ 5480, 69, 105 }, //Child of Water
+		{ 5481, 25, 38 }, //Burning Earth
+		{ 5482, 18, 64 }, //Omen-Mage-PH
+		{ 5483, 18, 107 }, //Summon Pouch of Jerikor
+		{ 5484, 25, 58 }, //Blade Strike
+		{ 5485, 69, 102 }, //Child of Fire
+		{ 5486, 18, 109 }, //Summon Sphere of Air
+		{ 5487, 126, 35 }, //Omen-Mage-PH
+		{ 5488, 125, 21 }, //Circle of Fireskin
+		{ 5489, 18, 64 }, //Summon Crystal Belt
+		{ 5490, 25, 111 }, //Desolate Summoned
+		{ 5491, 69, 42 }, //Renewal of Jerikor
+		{ 5492, 125, 21 }, //Pyrilen Skin
+		{ 5493, 25, 58 }, //Star Scream
+		{ 5494, 69, 10 }, //Bulwark of Calliav
+		{ 5495, 69, 100 }, //Child of Earth
+		{ 5496, 25, 38 }, //Star Strike
+		{ 5497, 69, 17 }, //Elemental Simulcram
+		{ 5498, 25, 38 }, //Ancient: Nova Strike
+		{ 5499, 126, 30 }, //Synapsis Spasm
+		{ 5500, 125, 84 }, //Ethereal Rune
+		{ 5501, 126, 53 }, //Omen-Enc-PH
+		{ 5502, 45, 87 }, //Mystic Shield
+		{ 5503, 126, 35 }, //Felicity
+		{ 5504, 125, 84 }, //Rune of Salik
+		{ 5505, 69, 99 }, //Salik's Animation
+		{ 5506, 126, 11 }, //Placate
+		{ 5507, 125, 41 }, //Speed of Salik
+		{ 5508, 95, 80 }, //Omen-Enc-PH
+		{ 5509, 20, 58 }, //Arcane Noose
+		{ 5510, 126, 13 }, //Compel
+		{ 5511, 126, 35 }, //Wake of Felicity
+		{ 5512, 20, 58 }, //Omen-Enc-PH
+		{ 5513, 79, 59 }, //Clairvoyance
+		{ 5514, 125, 84 }, //Mayhem
+		{ 5515, 125, 92 }, //Wall of Alendar
+		{ 5516, 25, 97 }, //Color Snap
+		{ 5517, 125, 92 }, //Circle of Alendar
+		{ 5518, 25, 58 }, //Psychosis
+		{ 5519, 126, 13 }, //True Name
+		{ 5520, 126, 35 }, //Euphoria
+		{ 5521, 125, 41 }, //Hastening of Salik
+		{ 5522, 79, 59 }, //Voice of Clairvoyance
+		{ 5523, 25, 58 }, //Ancient: Neurosis
+		{ 5524, 126, 31 }, //Omen-Bst-PH
+		{ 5525, 45, 96 }, //Omen-Bst-PH
+		{ 5526, 69, 42 }, //Healing of Mikkily
+		{ 5527, 20, 75 }, //Chimera Blood
+		{ 5528, 42, 42 }, //Muada's Mending
+		{ 5529, 45, 87 }, //Focus of Alladnu
+		{ 5530, 45, 47 }, //Spiritual Vitality
+		{ 5531, 69, 104 }, //Spirit of Alladnu
+		{ 5532, 125, 41 }, //Omen-Bst-PH
+		{ 5533, 69, 70 }, //Growl of the Beast
+		{ 5534, 69, 71 }, //Spirit of Irionu
+		{ 5535, 25, 14 }, //Glacier Spear
+		{ 5536, 79, 43 }, //Feral Vigor
+		{ 5537, 79, 44 }, //Spiritual Ascendance
+		{ 5538, 69, 104 }, //Spirit of Rashara
+		{ 5539, 69, 10 }, //Feral Guard
+		{ 5540, 20, 29 }, //Festering Malady
+		{ 5541, 126, 88 }, //Omen-Bst-PH
+		{ 5542, 95, 7 }, //Ferocity of Irionu
+		{ 5543, 25, 14 }, //Ancient: Savage Ice
+		{ 5554, 25, 0 }, //Cloud of Discord
+		{ 5555, 25, 0 }, //Bellow of Tunat'Muram
+		{ 5556, 25, 0 }, //Whirling Smash
+		{ 5560, 15, 115 }, //Blistering Rage
+		{ 5570, 126, 31 }, //Pillage Magic
+		{ 5571, 126, 89 }, //Tangle
+		{ 5572, 126, 89 }, //Entangle
+		{ 5573, 42, 56 }, //Corporeal Empathy Recourse
+		{ 5605, 79, 59 }, //test mana
+		{ 5731, 123, 113 }, //Circle of Barindu
+		{ 5732, 123, 113 }, //Barindu Portal
+		{ 5733, 123, 113 }, //Ring of Barindu
+		{ 5734, 123, 113 }, //Barindu Gate
+		{ 5735, 123, 113 }, //Translocate: Barindu
+		{ 5741, 25, 0 }, //Pyrilen Bolt
+		{ 5744, 25, 0 }, //Kiss of the Pyrilen
+		{ 5745, 25, 0 }, //Pyrilonis' Vengeance
+		{ 5760, 25, 0 }, //Gelaqua's Embrace
+		{ 5761, 25, 0 }, //Heart of Frost
+		{ 5874, 126, 13 }, //Advanced Dire Charm
+		{ 5875, 126, 13 }, //Advanced Dire Charm Animal
+		{ 5876, 126, 13 }, //Advanced Dire Charm Undead
+		{ 5919, 125, 64 }, //Death Peace
+		{ 5924, 25, 97 }, //Celestial Stun
+		{ 5931, 125, 51 }, //Embrace of Shadows
+		{ 5976, 25, 0 }, //Plagued Filth
+		{ 5979, 25, 0 }, //Infection of Pain
+		{ 5980, 25, 0 }, //Orb's Curse
+		{ 5989, 25, 0 }, //Gloom Toxin
+		{ 5990, 25, 0 }, //Shade Mantle
+		{ 5992, 25, 0 }, //Numbing Touch
+		{ 5993, 25, 0 }, //Girplan Chatter
+		{ 5994, 25, 0 }, //Body Slam
+		{ 5996, 25, 0 }, //Bazu Grip
+		{ 5997, 25, 0 }, //Pyrilen Ember
+		{ 5998, 25, 0 }, //Pyrilen Charm
+		{ 5999, 25, 0 }, //Pyronic Lash
+		{ 6000, 25, 0 }, //Pyrilen Fury
+		{ 6001, 25, 0 }, //Pyronic Assault
+		{ 6003, 25, 0 }, //Chimeran Laceration
+		{ 6004, 25, 0 }, //Chimeran Breath
+		{ 6005, 25, 0 }, //Infected Bite
+		{ 6006, 25, 0 }, //Gelidran Sleet
+		{ 6007, 25, 0 }, //Frostcicle
+		{ 6008, 25, 0 }, //Gelidran Hail
+		{ 6009, 25, 0 }, //Gelidran Stalagmite
+		{ 6010, 25, 0 }, //Freezing Touch
+		{ 6012, 25, 0 }, //Crushing Ice
+		{ 6013, 25, 0 }, //Ice Shards
+		{ 6014, 25, 0 }, //Feranic Grasp
+		{ 6016, 25, 0 }, //Feran Tentacle
+		{ 6017, 25, 0 }, //Darkbreath
+		{ 6019, 25, 0 }, //Clinging Apathy
+		{ 6020, 25, 0 }, //Wing Strike
+		{ 6021, 25, 0 }, //Deep Gouge
+		{ 6023, 25, 0 }, //Dragornian Malady
+		{ 6024, 25, 0 }, //Dragornian Venom
+		{ 6025, 25, 0 }, //Discordling Leap
+		{ 6026, 25, 0 }, //Discordling Ruin
+		{ 6027, 25, 0 }, //Chaotica
+		{ 6028, 25, 0 }, //Seething Bite
+		{ 6029, 25, 0 }, //Sinking Fangs
+		{ 6049, 25, 0 }, //Lightning Strike
+		{ 6050, 25, 0 }, //Static Pulse
+		{ 6051, 25, 0 }, //Fire Strike
+		{ 6052, 25, 0 }, //Ice Strike
+		{ 6053, 25, 0 }, //Bane of Dranik
+		{ 6054, 25, 0 }, //Bane of Dranik
+		{ 6055, 25, 0 }, //Bane of Dranik
+		{ 6065, 25, 0 }, //Murk Acid
+		{ 6066, 25, 0 }, //Murk Acid
+		{ 6103, 25, 111 }, //Nature's Denial Strike
+		{ 6105, 25, 124 }, //Silvered Fury Strike
+		{ 6120, 125, 51 }, //Phase Walk
+		{ 6121, 125, 51 }, //Shroud of Air
+		{ 6122, 125, 51 }, //Cloud of Indifference
+		{ 6123, 125, 51 }, //Cloak of Nature
+		{ 6124, 125, 51 }, //Shadow of Death
+		{ 6125, 125, 51 }, //Sun Cloak
+		{ 6126, 25, 0 }, //Hand of Order
+		{ 6128, 125, 51 }, //Gelidran Aura
+		{ 6140, 42, 42 }, //Ancient: Hallowed Light
+		{ 6141, 42, 42 }, //Ancient: Chlorobon
+		{ 6142, 42, 42 }, //Ancient: Wilslik's Mending
+		{ 6143, 114, 43 }, //Ancient: Touch of Orshilak
+		{ 6144, 126, 13 }, //Ancient: Voice of Muram
+		{ 6145, 125, 21 }, //Ancient: Veil of Pyrilonus
+		{ 6146, 25, 14 }, //Ancient: Spear of Gelaqua
+		{ 6152, 125, 62 }, //Vindictive Spirit Recourse
+		{ 6153, 45, 87 }, //Elemental Simulcram Recourse
+		{ 6154, 125, 62 }, //Hungry Vines Recourse
+		{ 6156, 126, 53 }, //Oaken Guard Parry
+		{ 6169, 126, 89 }, //Crippling Strike
+		{ 6170, 25, 97 }, //Mind Strike
+		{ 6171, 126, 53 }, //Baffling Strike
+		{ 6172, 18, 110 }, //Axe of the Destroyer
+		{ 6173, 15, 115 }, //Bazu Bellow
+		{ 6174, 15, 115 }, //Daggerfall
+		{ 6175, 15, 115 }, //Phantom Cry
+		{ 6176, 123, 28 }, //Slaughter Gate
+		{ 6177, 123, 28 }, //Translocate: Slaughter
+		{ 6178, 123, 28 }, //Slaughter Portal
+		{ 6179, 123, 28 }, //Circle of Slaughter
+		{ 6180, 123, 28 }, //Ring of Slaughter
+		{ 6181, 123, 28 }, //Bloodfields Gate
+		{ 6182, 123, 28 }, //Translocate: Bloodfields
+		{ 6183, 123, 28 }, //Bloodfields Portal
+		{ 6184, 123, 28 }, //Circle of Bloodfields
+		{ 6185, 123, 28 }, //Ring of Bloodfields
+		{ 6187, 114, 43 }, //Limit Test Hit
+		{ 6190, 27, 122 }, //Shocking Defense Discipline
+		{ 6191, 27, 120 }, //Aura of Runes Discipline
+		{ 6192, 27, 121 }, //Savage Onslaught Discipline
+		{ 6193, 27, 120 }, //Dreamwalk Discipline
+		{ 6194, 27, 121 }, //Rapid Kick Discipline
+		{ 6195, 27, 122 }, //Counterforce Discipline
+		{ 6196, 27, 122 }, //Deadly Aim Discipline
+		{ 6197, 27, 121 }, //Frenzied Stabbing Discipline
+		{ 6198, 27, 120 }, //Imperceptible Discipline
+		{ 6199, 27, 121 }, //Vengeful Flurry Discipline
+		{ 6200, 27, 122 }, //Unpredictable Rage Discipline
+		{ 6201, 27, 120 }, //Unflinching Will Discipline
+		{ 6202, 27, 118 }, //Stun Effect
+		{ 6203, 27, 118 }, //Rune Effect
+		{ 6204, 27, 118 }, //Slow Effect
+		{ 6205, 27, 118 }, //Poison DD Effect
+		{ 6206, 27, 118 }, //Lower Hate Effect
+		{ 6207, 27, 118 }, //Increase Damage Effect
+		{ 6209, 125, 84 }, //Test Doom Rune
+		{ 6233, 95, 7 }, //Harmonic Balance
+		{ 6265, 95, 7 }, //Divine Balance
+		{ 6330, 25, 58 }, //Chaotic Strike I
+		{ 6331, 25, 58 }, //Chaotic Strike II
+		{ 6332, 25, 58 }, //Chaotic Strike III
+		{ 6333, 25, 58 }, //Chaotic Strike IV
+		{ 6334, 25, 58 }, //Chaotic Strike V
+		{ 6335, 25, 58 }, //Chaotic Strike VI
+		{ 6336, 25, 58 }, //Chaotic Strike VII
+		{ 6337, 25, 58 }, //Life Sap I
+		{ 6338, 25, 58 }, //Life Sap II
+		{ 6339, 25, 58 }, //Life Sap III
+		{ 6340, 25, 58 }, //Life Sap IV
+		{ 6341, 25, 58 }, //Freezing Strike I
+		{ 6342, 25, 58 }, //Freezing Strike II
+		{ 6343, 25, 58 }, //Freezing Strike III
+		{ 6344, 25, 58 }, //Freezing Strike IV
+		{ 6345, 25, 58 }, //Freezing Strike V
+		{ 6346, 25, 58 }, //Freezing Strike VI
+		{ 6347, 25, 58 }, //Freezing Strike VII
+		{ 6348, 25, 58 }, //Freezing Strike VIII
+		{ 6349, 25, 58 }, //Freezing Strike IX
+		{ 6350, 25, 58 }, //Fiery Strike I
+		{ 6351, 25, 58 }, //Fiery Strike II
+		{ 6352, 25, 58 }, //Fiery Strike III
+		{ 6353, 25, 58 }, //Fiery Strike IV
+		{ 6354, 25, 58 }, //Fiery Strike V
+		{ 6355, 25, 58 }, //Fiery Strike VI
+		{ 6356, 25, 58 }, //Fiery Strike VII
+		{ 6357, 25, 58 }, //Fiery Strike VIII
+		{ 6358, 25, 58 }, //Fiery Strike IX
+		{ 6359, 125, 48 }, //Form of Defense I
+		{ 6360, 125, 48 }, //Form of Defense III
+		{ 6361, 125, 48 }, //Form of Protection I
+		{ 6362, 125, 48 }, //Form of Protection III
+		{ 6363, 125, 48 }, //Form of Endurance I
+		{ 6364, 125, 48 }, //Form of Endurance III
+		{ 6365, 125, 48 }, //Form of Rejuvenation I
+		{ 6366, 125, 48 }, //Form of Rejuvenation III
+		{ 6499, 25, 14 }, //Gelid Claw
+		{ 6500, 25, 97 }, //Stunning Strike
+		{ 6502, 18, 108 }, //Unpack Brewer's Still
+		{ 6505, 25, 38 }, //Blood Dream
+		{ 6512, 25, 58 }, //Lupine Rage
+		{ 6513, 126, 31 }, //Devour Enchantment
+		{ 6514, 18, 34 }, //Blessing of Rallos Zek
+		{ 6515, 18, 34 }, //Blessing of The Tribunal
+		{ 6516, 18, 34 }, //Blessing of Cazic Thule
+		{ 6517, 18, 34 }, //Blessing of Brell Serilis
+		{ 6518, 18, 34 }, //Blessing of Tunare
+		{ 6519, 18, 34 }, //Blessing of Innoruuk
+		{ 6520, 18, 34 }, //Blessing of Prexus
+		{ 6521, 18, 34 }, //Blessing of Mithaniel Marr
+		{ 6522, 18, 34 }, //Blessing of Erollisi Marr
+		{ 6523, 18, 34 }, //Blessing of Bertoxxulous
+		{ 6524, 18, 34 }, //Blessing of Solusek Ro
+		{ 6525, 18, 34 }, //Blessing of Karana
+		{ 6526, 18, 34 }, //Blessing of Bristlebane
+		{ 6527, 18, 34 }, //Blessing of Quellious
+		{ 6528, 18, 34 }, //Blessing of Rodcet Nife
+		{ 6529, 18, 34 }, //Blessing of Veeshan
+		{ 6530, 18, 34 }, //Words of the Sceptic
+		{ 6532, 125, 16 }, //Makural's Curse
+		{ 6533, 125, 78 }, //RB_reflect_test
+		{ 6534, 25, 38 }, //Makural's Torment
+		{ 6535, 25, 38 }, //Makural's TormentSK
+		{ 6563, 125, 49 }, //Mass Illusion: Human
+		{ 6564, 125, 49 }, //Mass Illusion: Barbarian
+		{ 6565, 125, 49 }, //Mass Illusion: Erudite
+		{ 6566, 125, 49 }, //Mass Illusion: Wood Elf
+		{ 6567, 125, 49 }, //Mass Illusion: Fier`dal
+		{ 6568, 125, 49 }, //Mass Illusion: High Elf
+		{ 6569, 125, 49 }, //Mass Illusion: Dark Elf
+		{ 6570, 125, 49 }, //Mass Illusion: Half-Elf
+		{ 6571, 125, 49 }, //Mass Illusion: Dwarf
+		{ 6572, 125, 49 }, //Mass Illusion: Troll
+		{ 6573, 125, 49 }, //Mass Illusion: Ogre
+		{ 6574, 125, 49 }, //Mass Illusion: Halfling
+		{ 6575, 125, 49 }, //Mass Illusion: Gnome
+		{ 6576, 125, 49 }, //Mass Illusion: Werewolf
+		{ 6577, 125, 49 }, //Mass Illusion: Froglok
+		{ 6578, 125, 49 }, //Mass Illusion: Imp
+		{ 6579, 125, 49 }, //Mass Illusion: Earth Elemental
+		{ 6580, 125, 49 }, //Mass Illusion: Air Elemental
+		{ 6581, 125, 49 }, //Mass Illusion: Fire Elemental
+		{ 6582, 125, 49 }, //Mass Illusion: Water Elemental
+		{ 6583, 125, 49 }, //Mass Illusion: Scarecrow
+		{ 6584, 125, 49 }, //Mass Illusion: Spirit Wolf
+		{ 6585, 125, 49 }, //Mass Illusion: Iksar
+		{ 6586, 125, 49 }, //Mass Illusion: Vah Shir
+		{ 6587, 125, 49 }, //Mass Illusion: Guktan
+		{ 6588, 125, 49 }, //Mass Illusion: Scaled Wolf
+		{ 6589, 125, 49 }, //Mass Illusion: Skeleton
+		{ 6590, 125, 49 }, //Mass Illusion: Dry Bone
+		{ 6591, 125, 49 }, //Mass Illusion: Frost Bone
+		{ 6592, 125, 129 }, //GM Bind Sight
+		{ 6656, 25, 75 }, //Spray of Venom
+		{ 6662, 125, 16 }, //Ward of Retribution
+		{ 6663, 27, 120 }, //Guard of Righteousness
+		{ 6664, 126, 89 }, //Earthen Shackles
+		{ 6665, 126, 89 }, //Serpent Vines
+		{ 6666, 125, 16 }, //Storm Blade
+		{ 6667, 125, 16 }, //Spirit of the Panther
+		{ 6668, 114, 18 }, //Shadow Orb
+		{ 6669, 25, 14 }, //Claw of Vox
+		{ 6670, 18, 109 }, //Summon: Molten Orb
+		{ 6671, 125, 84 }, //Rune of Rikkukin
+		{ 6672, 69, 71 }, //Growl of the Panther
+		{ 6673, 27, 120 }, //Soul Shield
+		{ 6674, 25, 38 }, //Storm Blade Strike
+		{ 6675, 25, 38 }, //Storm Blade Strike SK
+		{ 6676, 25, 38 }, //Magma Jet
+		{ 6677, 18, 109 }, //Shadow Orb Recourse
+		{ 6717, 95, 7 }, //Growl of the Panther
+		{ 6719, 126, 88 }, //Ward of Retribution Parry
+		{ 6724, 25, 38 }, //Panther Maw
+		{ 6725, 126, 53 }, //Cyclone Blade
+		{ 6726, 15, 35 }, //Assassin's Feint
+		{ 6727, 15, 25 }, //Dragon Fang
+		{ 6728, 15, 72 }, //Dragon Fang Strike
+		{ 6729, 15, 72 }, //Destroyer's Volley
+		{ 6730, 125, 16 }, //Ward of Vengeance
+		{ 6731, 27, 120 }, //Guard of Humility
+		{ 6732, 126, 89 }, //Earthen Embrace
+		{ 6733, 126, 89 }, //Mire Thorns
+		{ 6734, 125, 16 }, //Song of the Storm
+		{ 6735, 95, 7 }, //Spirit of the Leopard
+		{ 6736, 114, 18 }, //Soul Orb
+		{ 6737, 25, 14 }, //Claw of Frost
+		{ 6738, 18, 109 }, //Summon: Lava Orb
+		{ 6739, 125, 84 }, //Rune of the Scale
+		{ 6740, 69, 71 }, //Growl of the Leopard
+		{ 6741, 27, 120 }, //Soul Guard
+		{ 6742, 25, 38 }, //Song of the Storm Strike
+		{ 6743, 25, 38 }, //Song of the Storm Strike SK
+		{ 6744, 25, 38 }, //Lava Jet
+		{ 6745, 18, 109 }, //Soul Orb Recourse
+		{ 6747, 95, 7 }, //Growl of the Leopard
+		{ 6748, 126, 35 }, //Ward of Vengeance Parry
+		{ 6749, 25, 38 }, //Leopard Maw
+		{ 6750, 126, 53 }, //Whirlwind Blade
+		{ 6751, 15, 35 }, //Rogue's Ploy
+		{ 6752, 15, 25 }, //Leopard Claw
+		{ 6753, 15, 72 }, //Leopard Claw Strike
+		{ 6754, 15, 72 }, //Rage Volley
+		{ 6771, 125, 92 }, //Geomantra II
+		{ 6777, 25, 38 }, //Leopard Maw
+		{ 6778, 25, 38 }, //Leopard Maw SK
+		{ 6779, 25, 38 }, //Panther Maw
+		{ 6780, 25, 38 }, //Panther Maw SK
+		{ 6782, 25, 0 }, //Magma Blast
+		{ 6826, 126, 88 }, //Desolate Deeds
+		{ 6827, 126, 88 }, //Balance of Discord
+		{ 6828, 126, 88 }, //Sha's Legacy
+		{ 6839, 25, 58 }, //Static Strike
+		{ 6840, 25, 38 }, //Firestrike
+		{ 6841, 25, 38 }, //Bolt of Flame
+		{ 6842, 25, 38 }, //Cinder Bolt
+		{ 6843, 25, 58 }, //Anarchy
+		{ 6844, 25, 58 }, //Shock of Spikes
+		{ 6845, 25, 111 }, //Dismiss Summoned
+		{ 6846, 25, 124 }, //Dismiss Undead
+		{ 6847, 25, 38 }, //Blaze
+		{ 6848, 25, 75 }, //Shock of Poison
+		{ 6849, 25, 38 }, //Shock of Flame
+		{ 6850, 25, 58 }, //Chaos Flux
+		{ 6851, 25, 14 }, //Icestrike
+		{ 6852, 25, 14 }, //Icicle Shock
+		{ 6853, 114, 43 }, //Lifedraw
+		{ 6854, 114, 43 }, //Drain Soul
+		{ 6855, 25, 14 }, //Frost Shock
+		{ 6856, 25, 38 }, //Inferno Shock
+		{ 6857, 25, 58 }, //Lightning Shock
+		{ 6858, 25, 14 }, //Winter's Roar
+		{ 6859, 114, 43 }, //Spirit Tap
+		{ 6860, 114, 43 }, //Drain Spirit
+		{ 6861, 25, 14 }, //Shock of Ice
+		{ 6862, 25, 38 }, //Flame Shock
+		{ 6863, 25, 14 }, //Ice Shock
+		{ 6864, 25, 38 }, //Conflagration
+		{ 6865, 25, 124 }, //Expel Undead
+		{ 6866, 25, 58 }, //Rend
+		{ 6867, 25, 75 }, //Torbas' Acid Blast
+		{ 6868, 25, 14 }, //Frost
+		{ 6869, 25, 38 }, //Sunstrike
+		{ 6870, 25, 14 }, //Blast of Frost
+		{ 6871, 25, 38 }, //Shock of Fiery Blades
+		{ 6872, 25, 38 }, //Burning Arrow
+		{ 6873, 42, 42 }, //Nature's Renewal
+		{ 6874, 42, 42 }, //Spirit Salve
+		{ 6875, 42, 42 }, //Healing Light
+		{ 6876, 42, 42 }, //Forest's Renewal
+		{ 6877, 42, 42 }, //Kragg's Salve
+		{ 6878, 42, 42 }, //Greater Healing Light
+		{ 6899, 25, 38 }, //Flash Powder Explosion
+		{ 6902, 125, 16 }, //Ward of the Divine
+		{ 6903, 125, 16 }, //Ward of Rebuke
+		{ 6904, 126, 88 }, //Ward of the Divine Parry
+		{ 6905, 126, 88 }, //Ward of Rebuke Parry
+		{ 6906, 125, 16 }, //Spirit of the Puma
+		{ 6907, 125, 16 }, //Spirit of the Jaguar
+		{ 6908, 25, 38 }, //Puma Maw
+		{ 6909, 25, 38 }, //Puma Maw SK
+		{ 6910, 42, 32 }, //Elixir of Healing I
+		{ 6911, 42, 32 }, //Elixir of Healing II
+		{ 6912, 42, 32 }, //Elixir of Healing III
+		{ 6913, 42, 32 }, //Elixir of Healing IV
+		{ 6914, 42, 32 }, //Elixir of Healing V
+		{ 6915, 42, 32 }, //Elixir of Healing VI
+		{ 6916, 42, 32 }, //Elixir of Healing VII
+		{ 6917, 42, 32 }, //Elixir of Healing VIII
+		{ 6918, 42, 32 }, //Elixir of Healing IX
+		{ 6919, 42, 32 }, //Elixir of Healing X
+		{ 6920, 42, 32 }, //Healing Potion I
+		{ 6921, 42, 32 }, //Healing Potion II
+		{ 6922, 42, 32 }, //Healing Potion III
+		{ 6923, 42, 32 }, //Healing Potion IV
+		{ 6924, 42, 32 }, //Healing Potion V
+		{ 6925, 42, 32 }, //Healing Potion VI
+		{ 6926, 42, 32 }, //Healing Potion VII
+		{ 6927, 42, 32 }, //Healing Potion VIII
+		{ 6928, 42, 32 }, //Healing Potion IX
+		{ 6929, 42, 32 }, //Healing Potion X
+		{ 6930, 45, 46 }, //Elixir of Health I
+		{ 6931, 45, 46 }, //Elixir of Health II
+		{ 6932, 45, 46 }, //Elixir of Health III
+		{ 6933, 45, 46 }, //Elixir of Health IV
+		{ 6934, 45, 46 }, //Elixir of Health V
+		{ 6935, 45, 46 }, //Elixir of Health VI
+		{ 6936, 45, 46 }, //Elixir of Health VII
+		{ 6937, 45, 46 }, //Elixir of Health VIII
+		{ 6938, 45, 46 }, //Elixir of Health IX
+		{ 6939, 45, 46 }, //Elixir of Health X
+		{ 6940, 125, 41 }, //Elixir of Speed I
+		{ 6941, 125, 41 }, //Elixir of Speed II
+		{ 6942, 125, 41 }, //Elixir of Speed III
+		{ 6943, 125, 41 }, //Elixir of Speed IV
+		{ 6944, 125, 41 }, //Elixir of Speed V
+		{ 6945, 125, 41 }, //Elixir of Speed VI
+		{ 6946, 125, 41 }, //Elixir of Speed VII
+		{ 6947, 125, 41 }, //Elixir of Speed VIII
+		{ 6948, 125, 41 }, //Elixir of Speed IX
+		{ 6949, 125, 41 }, //Elixir of Speed X
+		{ 6950, 79, 59 }, //Elixir of Clarity I
+		{ 6951, 79, 59 }, //Elixir of Clarity II
+		{ 6952, 79, 59 }, //Elixir of Clarity III
+		{ 6953, 79, 59 }, //Elixir of Clarity IV
+		{ 6954, 79, 59 }, //Elixir of Clarity V
+		{ 6955, 79, 59 }, //Elixir of Clarity VI
+		{ 6956, 79, 59 }, //Elixir of Clarity VII
+		{ 6957, 79, 59 }, //Elixir of Clarity VIII
+		{ 6958, 79, 59 }, //Elixir of Clarity IX
+		{ 6959, 79, 59 }, //Elixir of Clarity X
+		{ 6960, 20, 29 }, //Grip of Zanivar
+		{ 6961, 114, 43 }, //Zanivar's Lifedraw
+		{ 6962, 20, 75 }, //Zanivar's Poison Bolt
+		{ 6963, 69, 103 }, //Minion of Zanivar
+		{ 6965, 25, 0 }, //Rampage of Rathkan
+		{ 6966, 25, 58 }, //Hurl of Rathkan
+		{ 6967, 25, 97 }, //Shock of Rathkan
+		{ 6968, 25, 38 }, //Lantern Bomb
+		{ 6969, 25, 58 }, //Flashpowder Bomb
+		{ 6973, 125, 52 }, //Intangibility
+		{ 6976, 20, 58 }, //Retch Weed
+		{ 6977, 126, 37 }, //Deistic Voice
+		{ 6978, 126, 37 }, //Deistic Bellow
+		{ 6979, 126, 37 }, //Deistic Howl
+		{ 6980, 126, 37 }, //Unholy Voice
+		{ 6981, 126, 37 }, //Unholy Bellow
+		{ 6982, 126, 37 }, //Unholy Howl
+		{ 6983, 126, 37 }, //Phobia
+		{ 6984, 126, 37 }, //Jitterskin
+		{ 6985, 126, 37 }, //Anxiety Attack
+		{ 6986, 126, 37 }, //Shadow Voice
+		{ 6987, 126, 37 }, //Shadow Bellow
+		{ 6988, 126, 37 }, //Shadow Howl
+		{ 6989, 126, 37 }, //Cower the Dead
+		{ 6990, 126, 37 }, //Death's Despair
+		{ 6991, 126, 37 }, //Revulsion of Death
+		{ 6992, 126, 37 }, //Eidolon Voice
+		{ 6993, 126, 37 }, //Eidolon Bellow
+		{ 6994, 126, 37 }, //Eidolon Howl
+		{ 6995, 126, 37 }, //Soulless Fear
+		{ 6996, 126, 37 }, //Soulless Panic
+		{ 6997, 126, 37 }, //Soulless Terror
+		{ 6998, 126, 37 }, //Instinctual Fear
+		{ 6999, 126, 37 }, //Instinctual Panic
+		{ 7000, 126, 37 }, //Instinctual Terror
+		{ 7001, 126, 37 }, //Angstlich's Echo of Terror
+		{ 7002, 126, 37 }, //Angstlich's Wail of Panic
+		{ 7003, 126, 35 }, //Circle of Dreams
+		{ 7004, 27, 120 }, //Guard of Piety
+		{ 7005, 27, 120 }, //Ichor Guard
+		{ 7168, 125, 51 }, //Obscuring Sporecloud
+		{ 7169, 126, 83 }, //Root of Weakness
+		{ 7170, 125, 95 }, //Rage of the Root
+		{ 7171, 42, 42 }, //Fungal Refreshment
+		{ 7172, 126, 35 }, //Spore Snooze
+		{ 7173, 95, 0 }, //Fungal Sheen
+		{ 7177, 125, 95 }, //Blind Fury I
+		{ 7178, 125, 95 }, //Blind Fury II
+		{ 7179, 125, 95 }, //Blind Fury III
+		{ 7180, 25, 97 }, //Orc Smash I
+		{ 7181, 25, 97 }, //Orc Smash II
+		{ 7182, 25, 97 }, //Orc Smash III
+		{ 7183, 125, 95 }, //Blood Rage I
+		{ 7184, 125, 95 }, //Blood Rage II
+		{ 7185, 125, 95 }, //Blood Rage III
+		{ 7186, 126, 30 }, //Dark Bellow I
+		{ 7187, 126, 30 }, //Dark Bellow II
+		{ 7188, 126, 30 }, //Dark Bellow III
+		{ 7189, 25, 38 }, //Wave of Fire
+		{ 7190, 126, 88 }, //Tide of Sloth I
+		{ 7191, 126, 88 }, //Tide of Sloth II
+		{ 7192, 126, 88 }, //Tide of Sloth III
+		{ 7193, 25, 38 }, //Fiery Surge I
+		{ 7194, 25, 38 }, //Fiery Surge II
+		{ 7195, 25, 38 }, //Fiery Surge III
+		{ 7199, 42, 32 }, //Soothing Remedy
+		{ 7200, 125, 79 }, //Orcish Regeneration I
+		{ 7201, 125, 79 }, //Orcish Regeneration II
+		{ 7202, 125, 79 }, //Orcish Regeneration III
+		{ 7203, 126, 89 }, //Weak Knees
+		{ 7204, 42, 42 }, //Complete Refreshment
+		{ 7205, 125, 95 }, //Hand of Darkness
+		{ 7206, 42, 42 }, //Shadowmend
+		{ 7207, 82, 0 }, //Soulmend
+		{ 7208, 126, 97 }, //Arachnae Scream
+		{ 7209, 95, 61 }, //Voice of Vule
+		{ 7210, 125, 95 }, //Speed of the Spider
+		{ 7211, 126, 35 }, //Skinwalker's Mindwave
+		{ 7212, 126, 88 }, //Dire Musings
+		{ 7213, 25, 58 }, //Thoughtraze
+		{ 7214, 69, 103 }, //Dark Messenger
+		{ 7215, 20, 75 }, //Bite of Night
+		{ 7216, 20, 58 }, //Chanted Doom
+		{ 7217, 114, 43 }, //Vile Spirit
+		{ 7218, 20, 58 }, //Spiteful Hex
+		{ 7219, 25, 58 }, //Eboncall
+		{ 7220, 25, 58 }, //Stormreaver
+		{ 7221, 125, 84 }, //Ethereal Carapace
+		{ 7222, 125, 92 }, //Master's Shadow
+		{ 7223, 25, 14 }, //Ice Spray
+		{ 7224, 125, 53 }, //Needling Annoyance
+		{ 7232, 25, 38 }, //Jaguar Maw
+		{ 7233, 25, 38 }, //Jaguar Maw SK
+		{ 7400, 42, 42 }, //Heal Wounds I
+		{ 7401, 42, 42 }, //Heal Wounds II
+		{ 7402, 42, 42 }, //Heal Wounds III
+		{ 7403, 42, 42 }, //Heal Wounds IV
+		{ 7404, 42, 42 }, //Heal Wounds V
+		{ 7405, 42, 42 }, //Heal Wounds VI
+		{ 7406, 42, 42 }, //Heal Wounds VII
+		{ 7407, 42, 42 }, //Heal Wounds VIII
+		{ 7408, 42, 42 }, //Heal Wounds IX
+		{ 7409, 42, 42 }, //Heal Wounds X
+		{ 7410, 42, 42 }, //Heal Wounds XI
+		{ 7411, 42, 42 }, //Heal Wounds XII
+		{ 7412, 42, 42 }, //Heal Wounds XIII
+		{ 7413, 42, 42 }, //Heal Wounds XIV
+		{ 7414, 25, 38 }, //Fire I
+		{ 7415, 25, 38 }, //Fire II
+		{ 7416, 25, 38 }, //Fire III
+		{ 7417, 25, 38 }, //Fire IV
+		{ 7418, 25, 38 }, //Fire V
+		{ 7419, 25, 38 }, //Fire VI
+		{ 7420, 25, 38 }, //Fire VII
+		{ 7421, 25, 38 }, //Fire VIII
+		{ 7422, 25, 38 }, //Fire IX
+		{ 7423, 25, 38 }, //Fire X
+		{ 7424, 25, 38 }, //Fire XI
+		{ 7425, 25, 38 }, //Fire XII
+		{ 7426, 25, 38 }, //Fire XIII
+		{ 7427, 25, 38 }, //Fire XIV
+		{ 7428, 25, 38 }, //Frost I
+		{ 7429, 25, 38 }, //Frost II
+		{ 7430, 25, 38 }, //Frost III
+		{ 7431, 25, 38 }, //Frost IV
+		{ 7432, 25, 38 }, //Frost V
+		{ 7433, 25, 38 }, //Frost VI
+		{ 7434, 25, 38 }, //Frost VII
+		{ 7435, 25, 38 }, //Frost VIII
+		{ 7436, 25, 38 }, //Frost IX
+		{ 7437, 25, 38 }, //Frost X
+		{ 7438, 25, 38 }, //Frost XI
+		{ 7439, 25, 38 }, //Frost XII
+		{ 7440, 25, 38 }, //Frost XIII
+		{ 7441, 25, 38 }, //Frost XIV
+		{ 7442, 25, 38 }, //Thunder I
+		{ 7443, 25, 38 }, //Thunder II
+		{ 7444, 25, 38 }, //Thunder III
+		{ 7445, 25, 38 }, //Thunder IV
+		{ 7446, 25, 38 }, //Thunder V
+		{ 7447, 25, 38 }, //Thunder VI
+		{ 7448, 25, 38 }, //Thunder VII
+		{ 7449, 25, 38 }, //Thunder VIII
+		{ 7450, 25, 38 }, //Thunder IX
+		{ 7451, 25, 38 }, //Thunder X
+		{ 7452, 25, 38 }, //Thunder XI
+		{ 7453, 25, 38 }, //Thunder XII
+		{ 7454, 25, 38 }, //Thunder XIII
+		{ 7455, 25, 38 }, //Thunder XIV
+		{ 7465, 15, 115 }, //Smoke Bomb I
+		{ 7466, 15, 115 }, //Smoke Bomb II
+		{ 7467, 15, 115 }, //Smoke Bomb III
+		{ 7468, 15, 115 }, //Smoke Bomb IV
+		{ 7469, 15, 115 }, //Smoke Bomb V
+		{ 7470, 15, 115 }, //Smoke Bomb VI
+		{ 7471, 15, 115 }, //Smoke Bomb VII
+		{ 7472, 15, 115 }, //Smoke Bomb VIII
+		{ 7473, 15, 115 }, //Smoke Bomb IX
+		{ 7474, 15, 115 }, //Smoke Bomb X
+		{ 7475, 15, 115 }, //Smoke Screen
+		{ 7476, 27, 117 }, //Pain Tolerance
+		{ 7477, 25, 0 }, //Cazic Touch II
+		{ 7478, 25, 0 }, //Destroy II
+		{ 7481, 126, 89 }, //Hamstring I
+		{ 7482, 126, 89 }, //Hamstring II
+		{ 7483, 20, 75 }, //Lesion I
+		{ 7484, 20, 75 }, //Lesion II
+		{ 7485, 20, 75 }, //Lesion III
+		{ 7486, 20, 75 }, //Lesion IV
+		{ 7487, 20, 75 }, //Lesion V
+		{ 7488, 20, 75 }, //Lesion VI
+		{ 7489, 20, 75 }, //Lesion VII
+		{ 7490, 20, 75 }, //Lesion VIII
+		{ 7491, 20, 75 }, //Lesion IX
+		{ 7492, 20, 75 }, //Lesion X
+		{ 7496, 20, 75 }, //Frost of the Ancients I
+		{ 7497, 20, 75 }, //Frost of the Ancients II
+		{ 7498, 20, 75 }, //Frost of the Ancients III
+		{ 7499, 20, 75 }, //Frost of the Ancients IV
+		{ 7500, 20, 75 }, //Frost of the Ancients V
+		{ 7501, 20, 75 }, //Frost of the Ancients VI
+		{ 7502, 20, 75 }, //Frost of the Ancients VII
+		{ 7503, 20, 75 }, //Frost of the Ancients VIII
+		{ 7504, 20, 75 }, //Frost of the Ancients IX
+		{ 7505, 20, 75 }, //Frost of the Ancients X
+		{ 7506, 42, 19 }, //Cure Poison I
+		{ 7507, 42, 19 }, //Cure Poison II
+		{ 7508, 42, 19 }, //Cure Poison III
+		{ 7509, 42, 19 }, //Cure Poison IV
+		{ 7510, 42, 19 }, //Cure Disease I
+		{ 7511, 42, 19 }, //Cure Disease II
+		{ 7512, 42, 19 }, //Cure Disease III
+		{ 7513, 42, 19 }, //Cure Disease IV
+		{ 7514, 42, 19 }, //Remove Curse I
+		{ 7515, 42, 19 }, //Remove Curse II
+		{ 7516, 42, 19 }, //Remove Curse III
+		{ 7517, 42, 19 }, //Remove Curse IV
+		{ 7518, 125, 64 }, //Play Dead I
+		{ 7519, 125, 64 }, //Play Dead II
+		{ 7520, 125, 64 }, //Play Dead III
+		{ 7521, 125, 64 }, //Play Dead IV
+		{ 7522, 25, 97 }, //Gore I
+		{ 7523, 25, 97 }, //Gore II
+		{ 7524, 25, 97 }, //Gore III
+		{ 7525, 25, 97 }, //Gore IV
+		{ 7526, 25, 97 }, //Gore V
+		{ 7527, 25, 97 }, //Gore VI
+		{ 7528, 126, 88 }, //War Bellow
+		{ 7529, 95, 7 }, //War Bellow Recourse
+		{ 7531, 126, 35 }, //Sleep I
+		{ 7532, 126, 35 }, //Sleep II
+		{ 7533, 126, 35 }, //Sleep III
+		{ 7534, 126, 35 }, //Sleep IV
+		{ 7535, 126, 35 }, //Sleep V
+		{ 7536, 126, 88 }, //Lethargy I
+		{ 7537, 126, 88 }, //Lethargy II
+		{ 7538, 126, 88 }, //Lethargy III
+		{ 7539, 126, 88 }, //Lethargy IV
+		{ 7540, 126, 88 }, //Lethargy V
+		{ 7541, 27, 117 }, //Plane Shift: Ethereal
+		{ 7542, 27, 118 }, //Plane Shift: Material
+		{ 7543, 27, 118 }, //Blink
+		{ 7545, 20, 75 }, //Swarm of Pain I
+		{ 7546, 20, 75 }, //Swarm of Pain II
+		{ 7547, 20, 75 }, //Swarm of Pain III
+		{ 7548, 20, 75 }, //Swarm of Pain IV
+		{ 7549, 20, 75 }, //Swarm of Pain V
+		{ 7550, 20, 75 }, //Swarm of Pain VI
+		{ 7551, 20, 75 }, //Swarm of Pain VII
+		{ 7552, 20, 75 }, //Swarm of Pain VIII
+		{ 7553, 20, 75 }, //Swarm of Pain IX
+		{ 7554, 20, 75 }, //Swarm of Pain X
+		{ 7555, 20, 75 }, //Fungal Malady I
+		{ 7556, 20, 75 }, //Fungal Malady II
+		{ 7557, 20, 75 }, //Fungal Malady III
+		{ 7558, 20, 75 }, //Fungal Malady IV
+		{ 7559, 20, 75 }, //Fungal Malady V
+		{ 7560, 20, 75 }, //Fungal Malady VI
+		{ 7561, 20, 75 }, //Fungal Malady VII
+		{ 7562, 20, 75 }, //Fungal Malady VIII
+		{ 7563, 20, 75 }, //Fungal Malady IX
+		{ 7564, 20, 75 }, //Fungal Malady X
+		{ 7565, 45, 47 }, //Ward of the Bear I
+		{ 7566, 45, 47 }, //Ward of the Bear II
+		{ 7567, 45, 47 }, //Ward of the Bear III
+		{ 7568, 125, 65 }, //Ward of the Wolf I
+		{ 7569, 95, 2 }, //Ward of the Wolf II
+		{ 7570, 95, 2 }, //Ward of the Wolf III
+		{ 7571, 0, 0 }, //Ward of the Tiger I
+		{ 7572, 0, 0 }, //Ward of the Tiger II
+		{ 7573, 95, 64 }, //Ward of the Tiger III
+		{ 7574, 125, 79 }, //Ward of the Crocodile I
+		{ 7575, 125, 79 }, //Ward of the Crocodile II
+		{ 7576, 125, 79 }, //Ward of the Crocodile III
+		{ 7577, 95, 2 }, //Ward of the Scaled Wolf I
+		{ 7578, 95, 2 }, //Ward of the Scaled Wolf II
+		{ 7579, 95, 2 }, //Ward of the Scaled Wolf III
+		{ 7580, 125, 41 }, //Ward of the Raptor I
+		{ 7581, 95, 2 }, //Ward of the Raptor II
+		{ 7582, 95, 2 }, //Ward of the Raptor III
+		{ 7583, 95, 2 }, //Ward of the Garou I
+		{ 7584, 95, 2 }, //Ward of the Garou II
+		{ 7585, 95, 2 }, //Ward of the Garou III
+		{ 7589, 125, 21 }, //Fire Skin I
+		{ 7590, 125, 21 }, //Fire Skin II
+		{ 7591, 125, 21 }, //Fire Skin III
+		{ 7592, 125, 21 }, //Fire Skin IV
+		{ 7593, 125, 21 }, //Fire Skin V
+		{ 7594, 125, 21 }, //Fire Skin VI
+		{ 7595, 125, 21 }, //Fire Skin VII
+		{ 7596, 125, 21 }, //Fire Skin VIII
+		{ 7597, 125, 21 }, //Fire Skin IX
+		{ 7598, 125, 21 }, //Fire Skin X
+		{ 7599, 25, 0 }, //Gargoyle Glance
+		{ 7701, 126, 83 }, //Weakening Roots
+		{ 7729, 125, 51 }, //Stealth
+		{ 7745, 25, 97 }, //Stunning Roar
+		{ 7746, 27, 117 }, //Whirlwind
+		{ 7762, 15, 72 }, //Maul I
+		{ 7763, 15, 72 }, //Maul II
+		{ 7764, 15, 72 }, //Maul III
+		{ 7765, 15, 72 }, //Maul IV
+		{ 7766, 15, 72 }, //Maul V
+		{ 7767, 15, 72 }, //Maul VI
+		{ 7768, 15, 72 }, //Maul VII
+		{ 7769, 15, 72 }, //Maul VIII
+		{ 7770, 15, 72 }, //Maul IX
+		{ 7771, 15, 72 }, //Maul X
+		{ 7772, 15, 72 }, //Maul XI
+		{ 7773, 15, 72 }, //Maul XII
+		{ 7774, 15, 72 }, //Maul XIII
+		{ 7775, 15, 72 }, //Maul XIV
+		{ 7776, 25, 38 }, //Mana Bolt I
+		{ 7777, 25, 38 }, //Mana Bolt II
+		{ 7778, 25, 38 }, //Mana Bolt III
+		{ 7779, 25, 38 }, //Mana Bolt IV
+		{ 7780, 25, 38 }, //Mana Bolt V
+		{ 7781, 25, 38 }, //Mana Bolt VI
+		{ 7782, 25, 38 }, //Mana Bolt VII
+		{ 7783, 25, 38 }, //Mana Bolt VIII
+		{ 7784, 25, 38 }, //Mana Bolt IX
+		{ 7785, 25, 38 }, //Mana Bolt X
+		{ 7786, 25, 38 }, //Mana Bolt XI
+		{ 7787, 25, 38 }, //Mana Bolt XII
+		{ 7788, 25, 38 }, //Mana Bolt XIII
+		{ 7789, 25, 38 }, //Mana Bolt XIV
+		{ 7790, 123, 64 }, //Spirit Sending
+		{ 7800, 20, 75 }, //Draygun's Touch
+		{ 7801, 20, 75 }, //Draygun's Touch
+		{ 7802, 20, 75 }, //Draygun's Touch
+		{ 7803, 20, 75 }, //Draygun's Touch
+		{ 7804, 20, 75 }, //Draygun's Touch
+		{ 7805, 20, 75 }, //Curse of the Nine
+		{ 7806, 20, 75 }, //Curse of the Nine
+		{ 7807, 20, 75 }, //Curse of the Nine
+		{ 7808, 20, 75 }, //Curse of the Nine
+		{ 7809, 20, 75 }, //Curse of the Nine
+		{ 7810, 20, 75 }, //Blood of the Shadowmane
+		{ 7811, 20, 75 }, //Blood of the Shadowmane
+		{ 7812, 20, 75 }, //Blood of the Shadowmane
+		{ 7813, 20, 75 }, //Blood of the Shadowmane
+		{ 7814, 20, 75 }, //Blood of the Shadowmane
+		{ 7815, 20, 75 }, //Theft of Rage
+		{ 7816, 20, 75 }, //Theft of Rage
+		{ 7817, 20, 75 }, //Theft of Rage
+		{ 7818, 20, 75 }, //Theft of Rage
+		{ 7819, 20, 75 }, //Theft of Rage
+		{ 7820, 20, 75 }, //Curse of the Hivequeen
+		{ 7821, 20, 75 }, //Curse of the Hivequeen
+		{ 7822, 20, 75 }, //Curse of the Hivequeen
+		{ 7823, 20, 75 }, //Curse of the Hivequeen
+		{ 7824, 20, 75 }, //Curse of the Hivequeen
+		{ 7838, 125, 48 }, //Form of Defense IV
+		{ 7839, 125, 48 }, //Form of Protection IV
+		{ 7840, 125, 48 }, //Form of Endurance IV
+		{ 7841, 125, 48 }, //Form of Rejuvenation IV
+		{ 7994, 20, 38 }, //Dread Pyre
+		{ 7995, 25, 75 }, //Call for Blood
+		{ 7996, 25, 38 }, //Call for Blood Recourse
+		{ 7999, 20, 75 }, //Corath Venom
+		{ 8000, 95, 64 }, //Commanding Voice
+		{ 8001, 95, 64 }, //Thief's eyes
+		{ 8002, 95, 64 }, //Fists of Wu
+		{ 8003, 95, 64 }, //Cry Havoc
+		{ 8004, 25, 124 }, //Death's Regret
+		{ 8005, 25, 124 }, //Bind Death
+		{ 8006, 25, 72 }, //Chromastrike
+		{ 8007, 42, 42 }, //Desperate Renewal
+		{ 8008, 125, 16 }, //Skin of the Reptile
+		{ 8009, 42, 42 }, //Skin of the Rep. Trigger
+		{ 8010, 126, 83 }, //Spore Spiral
+		{ 8011, 25, 38 }, //Dawnstrike
+		{ 8012, 20, 38 }, //Blessing of the Dawn
+		{ 8015, 125, 16 }, //Lingering Sloth
+		{ 8016, 125, 16 }, //Lingering Sloth Trigger
+		{ 8017, 126, 88 }, //Hungry Plague
+		{ 8018, 25, 75 }, //Breath of Antraygus
+		{ 8019, 27, 117 }, //Warder's Wrath
+		{ 8020, 25, 72 }, //Hail of Arrows
+		{ 8021, 69, 104 }, //Bestial Empathy
+		{ 8022, 25, 124 }, //Fickle Shadows
+		{ 8023, 20, 38 }, //Fickle Shadows Recourse
+		{ 8025, 114, 43 }, //Touch of Draygun
+		{ 8026, 45, 47 }, //Gift of Draygun
+		{ 8027, 25, 124 }, //Last Rites
+		{ 8028, 25, 124 }, //Last Rites Trigger
+		{ 8029, 95, 64 }, //Silent Piety
+		{ 8030, 27, 118 }, //Thousand Blades
+		{ 8031, 126, 35 }, //Creeping Dreams
+		{ 8032, 125, 16 }, //Mana Flare
+		{ 8033, 69, 71 }, //Mana Flare Strike
+		{ 8034, 25, 58 }, //Colored Chaos
+		{ 8035, 126, 35 }, //Echoing Madness
+		{ 8036, 125, 48 }, //Illusion: Orc
+		{ 8037, 69, 102 }, //Raging Servant
+		{ 8038, 125, 16 }, //Burning Aura
+		{ 8039, 125, 16 }, //Burning Vengeance
+		{ 8040, 25, 38 }, //Fickle Fire
+		{ 8041, 25, 14 }, //Clinging Frost
+		{ 8042, 25, 14 }, //Clinging Frost Trigger
+		{ 8043, 25, 38 }, //Ether Flame
+		{ 8044, 25, 58 }, //Mana Weave
+		{ 8045, 25, 38 }, //Mana Weave Recourse
+		{ 8075, 25, 38 }, //Fickle Fire Recourse
+		{ 8090, 126, 81 }, //Armor Cleave I
+		{ 8091, 126, 81 }, //Armor Cleave II
+		{ 8092, 126, 81 }, //Armor Cleave III
+		{ 8093, 126, 81 }, //Armor Cleave IV
+		{ 8094, 126, 81 }, //Armor Cleave V
+		{ 8095, 126, 81 }, //Armor Cleave VI
+		{ 8096, 126, 81 }, //Armor Cleave VII
+		{ 8097, 126, 81 }, //Armor Cleave VIII
+		{ 8098, 126, 81 }, //Armor Cleave IX
+		{ 8099, 126, 81 }, //Armor Cleave X
+		{ 8106, 42, 42 }, //Perfected Heal
+		{ 8114, 25, 38 }, //Shrieker Sonic Wave
+		{ 8115, 25, 38 }, //Shrieker Sonic Wave
+		{ 8116, 25, 38 }, //Shrieker Sonic Wave
+		{ 8117, 25, 38 }, //Nimbus Shrieker Wave
+		{ 8118, 25, 38 }, //Nimbus Shrieker Wave
+		{ 8119, 25, 38 }, //Nimbus Shrieker Wave
+		{ 8120, 25, 58 }, //Retch Spore
+		{ 8121, 25, 58 }, //Retch Spore
+		{ 8122, 25, 58 }, //Retch Spore
+		{ 8123, 25, 58 }, //Hammer Time
+		{ 8144, 126, 89 }, //Net
+		{ 8145, 126, 89 }, //Clinging Net
+		{ 8149, 123, 64 }, //Stealthy Getaway
+		{ 8153, 79, 59 }, //Eternal Thought
+		{ 8171, 79, 59 }, //Pure Thought I
+		{ 8172, 79, 59 }, //Pure Thought II
+		{ 8173, 79, 59 }, //Pure Thought III
+		{ 8174, 79, 59 }, //Pure Thought IV
+		{ 8175, 79, 59 }, //Pure Thought V
+		{ 8176, 79, 59 }, //Pure Thought VI
+		{ 8177, 79, 59 }, //Pure Thought VII
+		{ 8178, 79, 59 }, //Pure Thought VIII
+		{ 8179, 79, 59 }, //Pure Thought IX
+		{ 8180, 79, 59 }, //Pure Thought X
+		{ 8200, 79, 59 }, //Gift of Illsalin
+		{ 8201, 69, 102 }, //Guardian of Ro
+		{ 8202, 69, 102 }, //Guardian of Ro
+		{ 8203, 69, 102 }, //Guardian of Ro
+		{ 8204, 25, 38 }, //Guardian's Bolt I
+		{ 8210, 15, 115 }, //Feral Roar I
+		{ 8211, 15, 115 }, //Feral Roar II
+		{ 8212, 15, 115 }, //Feral Roar III
+		{ 8213, 15, 115 }, //Feral Roar IV
+		{ 8214, 125, 48 }, //Greater Rabid Bear
+		{ 8215, 125, 48 }, //Greater Rabid Bear
+		{ 8216, 125, 48 }, //Greater Rabid Bear
+		{ 8218, 125, 62 }, //Ancestral Guard
+		{ 8219, 125, 62 }, //Ancestral Guard
+		{ 8220, 125, 62 }, //Ancestral Guard
+		{ 8233, 27, 118 }, //Empathic Fury
+		{ 8234, 27, 118 }, //Empathic Fury
+		{ 8235, 123, 5 }, //Circle of Undershore
+		{ 8236, 123, 5 }, //Undershore Portal
+		{ 8237, 123, 5 }, //Ring of Undershore
+		{ 8238, 123, 5 }, //Undershore Gate
+		{ 8239, 123, 5 }, //Translocate: Undershore
+		{ 8267, 15, 115 }, //Feral Roar V
+		{ 8268, 15, 115 }, //Feral Roar VI
+		{ 8275, 126, 35 }, //Infection Test 1
+		{ 8276, 126, 35 }, //Infection Test 2
+		{ 8277, 25, 58 }, //Fling
+		{ 8278, 69, 71 }, //Fetter of Spirits
+		{ 8280, 45, 46 }, //Boon of Vitality I
+		{ 8281, 45, 46 }, //Boon of Vitality II
+		{ 8282, 45, 46 }, //Boon of Vitality III
+		{ 8283, 45, 46 }, //Boon of Vitality IV
+		{ 8284, 45, 46 }, //Boon of Vitality V
+		{ 8285, 45, 46 }, //Boon of Vitality VI
+		{ 8286, 45, 46 }, //Boon of Vitality VII
+		{ 8287, 45, 46 }, //Boon of Vitality VIII
+		{ 8288, 45, 46 }, //Boon of Vitality IX
+		{ 8289, 45, 46 }, //Boon of Vitality X
+		{ 8290, 125, 41 }, //Gift of Speed I
+		{ 8291, 125, 41 }, //Gift of Speed II
+		{ 8292, 125, 41 }, //Gift of Speed III
+		{ 8293, 125, 41 }, //Gift of Speed IV
+		{ 8294, 125, 41 }, //Gift of Speed V
+		{ 8295, 125, 41 }, //Gift of Speed VI
+		{ 8296, 125, 41 }, //Gift of Speed VII
+		{ 8297, 125, 41 }, //Gift of Speed VIII
+		{ 8298, 125, 41 }, //Gift of Speed IX
+		{ 8299, 125, 41 }, //Gift of Speed X
+		{ 8300, 126, 81 }, //Malaise I
+		{ 8301, 126, 81 }, //Malaise II
+		{ 8302, 126, 81 }, //Malaise III
+		{ 8303, 126, 81 }, //Malaise IV
+		{ 8304, 126, 81 }, //Malaise V
+		{ 8305, 25, 97 }, //Stun I
+		{ 8306, 25, 97 }, //Stun II
+		{ 8307, 25, 97 }, //Stun III
+		{ 8308, 25, 97 }, //Stun IV
+		{ 8309, 25, 97 }, //Stun V
+		{ 8310, 126, 13 }, //Gaze of the Beholder I
+		{ 8311, 126, 13 }, //Gaze of the Beholder II
+		{ 8312, 126, 13 }, //Gaze of the Beholder III
+		{ 8313, 126, 13 }, //Gaze of the Beholder IV
+		{ 8314, 126, 13 }, //Gaze of the Beholder V
+		{ 8315, 126, 13 }, //Gaze of the Beholder VI
+		{ 8316, 126, 13 }, //Gaze of the Beholder VII
+		{ 8317, 126, 13 }, //Gaze of the Beholder VIII
+		{ 8318, 126, 13 }, //Gaze of the Beholder IX
+		{ 8319, 126, 13 }, //Gaze of the Beholder X
+		{ 8320, 126, 13 }, //Gaze of the Beholder XI
+		{ 8321, 126, 13 }, //Gaze of the Beholder XII
+		{ 8322, 126, 13 }, //Gaze of the Beholder XIII
+		{ 8323, 126, 13 }, //Gaze of the Beholder XIV
+		{ 8324, 42, 19 }, //Pure Water I
+		{ 8325, 42, 19 }, //Pure Water II
+		{ 8326, 42, 19 }, //Pure Water III
+		{ 8327, 42, 19 }, //Pure Water IV
+		{ 8328, 25, 97 }, //Gale Force
+		{ 8329, 42, 32 }, //Fungal Regrowth I
+		{ 8330, 42, 32 }, //Fungal Regrowth II
+		{ 8331, 42, 32 }, //Fungal Regrowth III
+		{ 8332, 42, 32 }, //Fungal Regrowth IV
+		{ 8333, 42, 32 }, //Fungal Regrowth V
+		{ 8334, 125, 16 }, //Creeping Plague
+		{ 8335, 125, 16 }, //Creeping Plague Trigger
+		{ 8336, 25, 97 }, //Stunning Blow I
+		{ 8337, 25, 97 }, //Stunning Blow II
+		{ 8338, 25, 97 }, //Stunning Blow III
+		{ 8339, 25, 97 }, //Stunning Blow IV
+		{ 8340, 25, 97 }, //Stunning Blow V
+		{ 8341, 125, 17 }, //Dark Gift I
+		{ 8342, 125, 17 }, //Dark Gift II
+		{ 8343, 125, 17 }, //Dark Gift III
+		{ 8344, 125, 17 }, //Dark Gift IV
+		{ 8345, 125, 17 }, //Dark Gift V
+		{ 8346, 125, 17 }, //Dark Gift VI
+		{ 8347, 125, 17 }, //Dark Gift VII
+		{ 8348, 114, 43 }, //Dark Siphon I
+		{ 8349, 114, 43 }, //Dark Siphon II
+		{ 8350, 114, 43 }, //Dark Siphon III
+		{ 8351, 114, 43 }, //Dark Siphon IV
+		{ 8352, 114, 43 }, //Dark Siphon V
+		{ 8353, 114, 43 }, //Dark Siphon VI
+		{ 8354, 114, 43 }, //Dark Siphon VII
+		{ 8372, 125, 84 }, //Stone Skin I
+		{ 8373, 125, 84 }, //Stone Skin II
+		{ 8374, 125, 84 }, //Stone Skin III
+		{ 8375, 125, 84 }, //Stone Skin IV
+		{ 8376, 125, 84 }, //Stone Skin V
+		{ 8377, 125, 84 }, //Stone Skin VI
+		{ 8378, 126, 35 }, //Shadowed Dark Hold
+		{ 8379, 126, 13 }, //Shadowed Word of Chaos
+		{ 8380, 20, 58 }, //Shadowed Curse of Mori
+		{ 8381, 25, 38 }, //Shadowed Meteor Storm
+		{ 8382, 25, 38 }, //Shadowed Corona Flare
+		{ 8383, 25, 38 }, //Shadowed Core Fire
+		{ 8400, 25, 38 }, //Guardian's Bolt II
+		{ 8401, 25, 38 }, //Guardian's Bolt III
+		{ 8410, 25, 0 }, //Hand of Holy Vengeance I
+		{ 8411, 25, 0 }, //Hand of Holy Vengeance II
+		{ 8412, 25, 0 }, //Hand of Holy Vengeance III
+		{ 8413, 25, 0 }, //Hand of Holy Vengeance IV
+		{ 8414, 25, 0 }, //Hand of Holy Vengeance V
+		{ 8421, 25, 58 }, //Jailor's Fury
+		{ 8444, 15, 72 }, //Blinding Dust
+	};
+
+	constexpr DWORD max_spell_id = 8444;
+
+	// direct indexed by spell id, built at compile time so a lookup is a single load
+	constexpr std::array<BYTE, max_spell_id + 1> build_table(bool subcategory)
+	{
+		std::array<BYTE, max_spell_id + 1> table = {};
+		for (const spell_category_entry& entry : spell_category_entries)
+			table[entry.spell_id] = subcategory ? entry.subcategory : entry.category;
+		return table;
+	}
+	constexpr std::array<BYTE, max_spell_id + 1> category_table = build_table(false);
+	constexpr std::array<BYTE, max_spell_id + 1> subcategory_table = build_table(true);
+
+	// categories and subcategories share one name list
+	constexpr const char* category_names[] =
+	{
+		"Unknown",
+		"Aegolism", //1
+		"Agility", //2
+		"Alliance", //3
+		"Animal", //4
+		"Antonica", //5
+		"Armor Class", //6
+		"Attack", //7
+		"Bane", //8
+		"Blind", //9
+		"Block", //10
+		"Calm", //11
+		"Charisma", //12
+		"Charm", //13
+		"Cold", //14
+		"Combat Abilities", //15
+		"Combat Innates", //16
+		"Conversions", //17
+		"Create Item", //18
+		"Cure", //19
+		"Damage Over Time", //20
+		"Damage Shield", //21
+		"Defensive", //22
+		"Destroy", //23
+		"Dexterity", //24
+		"Direct Damage ", //25
+		"Disarm Traps", //26
+		"Disciplines", //27
+		"Discord", //28
+		"Disease", //29
+		"Disempowering", //30
+		"Dispel", //31
+		"Duration Heals", //32
+		"Duration Tap", //33
+		"Enchant Metal", //34
+		"Enthrall", //35
+		"Faydwer", //36
+		"Fear", //37
+		"Fire", //38
+		"Fizzle Rate", //39
+		"Fumble", //40
+		"Haste", //41
+		"Heals", //42
+		"Health", //43
+		"Health/Mana", //44
+		"HP Buffs", //45
+		"HP type one", //46
+		"HP type two", //47
+		"Illusion: Other", //48
+		"Illusion: Player", //49
+		"Imbue Gem", //50
+		"Invisibility", //51
+		"Invulnerability", //52
+		"Jolt", //53
+		"Kunark", //54
+		"Levitate", //55
+		"Life Flow", //56
+		"Luclin", //57
+		"Magic", //58
+		"Mana", //59
+		"Mana Drain", //60
+		"Mana Flow", //61
+		"Melee Guard", //62
+		"Memory Blur", //63
+		"Misc", //64
+		"Movement", //65
+		"Objects", //66
+		"Odus", //67
+		"Offensive", //68
+		"Pet", //69
+		"Pet Haste", //70
+		"Pet Misc Buffs", //71
+		"Physical", //72
+		"Picklock", //73
+		"Plant", //74
+		"Poison", //75
+		"Power Tap", //76
+		"Quick Heal", //77
+		"Reflection", //78
+		"Regen", //79
+		"Resist Buff", //80
+		"Resist Debuffs", //81
+		"Resurrection", //82
+		"Root", //83
+		"Rune", //84
+		"Sense Trap", //85
+		"Shadowstep", //86
+		"Shielding", //87
+		"Slow", //88
+		"Snare", //89
+		"Special", //90
+		"Spell Focus", //91
+		"Spell Guard", //92
+		"Spellshield", //93
+		"Stamina", //94
+		"Statistic Buffs", //95
+		"Strength", //96
+		"Stun", //97
+		"Sum: Air", //98
+		"Sum: Animation", //99
+		"Sum: Earth", //100
+		"Sum: Familiar", //101
+		"Sum: Fire", //102
+		"Sum: Undead", //103
+		"Sum: Warder", //104
+		"Sum: Water", //105
+		"Summon Armor", //106
+		"Summon Focus", //107
+		"Summon Food/Water", //108
+		"Summon Utility", //109
+		"Summon Weapon", //110
+		"Summoned", //111
+		"Symbol", //112
+		"Taelosia", //113
+		"Taps", //114
+		"Techniques", //115
+		"The Planes", //116
+		"Timer 1", //117
+		"Timer 2", //118
+		"Timer 3", //119
+		"Timer 4", //120
+		"Timer 5", //121
+		"Timer 6", //122
+		"Transport", //123
+		"Undead", //124
+		"Utility Beneficial", //125
+		"Utility Detrimental", //126
+		"Velious", //127
+		"Visages", //128
+		"Vision", //129
+		"Wisdom/Intelligence", //130
+		"Traps", //131
+		"Auras", //132
+		"Endurance", //133
+		"Serpent's Spine", //134
+		"Corruption", //135
+		"Learning", //136
+		"Chromatic", //137
+		"Prismatic", //138
+		"Sum: Swarm", //139
+		"Delayed", //140
+		"Temporary", //141
+		"Twincast", //142
+		"Sum: Bodyguard", //143
+		"Humanoid", //144
+		"Haste/Spell Focus", //145
+		"Timer 7", //146
+		"Timer 8", //147
+		"Timer 9", //148
+		"Timer 10", //149
+		"Timer 11", //150
+		"Timer 12", //151
+		"Hatred", //152
+		"Fast", //153
+		"Illusion: Special", //154
+		"Timer 13", //155
+		"Timer 14", //156
+		"Timer 15", //157
+		"Timer 16", //158
+		"Timer 17", //159
+		"Timer 18", //160
+		"Timer 19", //161
+		"Timer 20", //162
+		"Alaris", //163
+	};
+	constexpr DWORD category_name_count = sizeof(category_names) / sizeof(category_names[0]);
+}
+
+DWORD GetSpellCategory(DWORD spellID)
+{
+	return spellID <= max_spell_id ? category_table[spellID] : 0;
+}
+
+DWORD GetSpellSubCategory(DWORD spellID)
+{
+	return spellID <= max_spell_id ? subcategory_table[spellID] : 0;
+}
+
+std::string GetSpellCategoryName(DWORD categoryID)
+{
+	return categoryID < category_name_count ? category_names[categoryID] : category_names[0];
+}
+
+std::string GetSpellSubCategoryName(DWORD subcategoryID)
+{
+	return subcategoryID < category_name_count ? category_names[subcategoryID] : category_names[0];
+}
@@ -2,6 +2,23 @@
 #include "EqAddresses.h"
 
 ZealService* ZealService::ptr_service = nullptr;
+
+namespace Shutdown
+{
+	static std::atomic<bool> requested_flag = false;
+	static std::atomic<bool> exit_flag = false;
+	static HANDLE shutdown_event = CreateEvent(NULL, TRUE, FALSE, NULL);
+	void request(bool process_exit)
+	{
+		if (process_exit)
+			exit_flag.store(true, std::memory_order_release);
+		requested_flag.store(true, std::memory_order_release);
+		SetEvent(shutdown_event);
+	}
+	bool requested() { return requested_flag.load(std::memory_order_acquire); }
+	bool process_exiting() { return exit_flag.load(std::memory_order_acquire); }
+	HANDLE event() { return shutdown_event; }
+}
 //
 //LPTOP_LEVEL_EXCEPTION_FILTER WINAPI SetUnhandledExceptionFilter_Hook(LPTOP_LEVEL_EXCEPTION_FILTER lpTopLevelExceptionFilter)
 //{
@@ -14,20 +31,51 @@ ZealService::ZealService()
 	//since the hooked functions are called back via a different thread, make sure the service ptr is available immediately
 	ZealService::ptr_service = this; //this setup makes it not unit testable but since the caller functions of the hooks don't know the pointers I had to make a method to retrieve the base atleast
 	crash_handler = std::make_shared<CrashHandler>();
+	addresses = std::make_shared<AddressTable>(); //reads the game code before anything is hooked
 	hooks = std::make_shared<HookWrapper>();
+	hooks->begin_batch(); //every hook and patch below is applied at once by commit()
 	//hooks->Add("SetUnhandledExceptionFilter", (int)SetUnhandledExceptionFilter, SetUnhandledExceptionFilter_Hook, hook_type_detour);
 	ini = std::make_shared<IO_ini>(".\\eqclient.ini"); //other functions rely on this hook
+	Settings::bind(ini.get()); //declared settings read their values from here on
 	dx = std::make_shared<directx>();
 //initialize the hooked function classes
 	commands_hook = std::make_shared<ChatCommands>(this); //other classes below rely on this class on initialize
 	callbacks = std::make_shared<CallbackManager>(this); //other functions rely on this hook
+	tasks = std::make_shared<TaskPool>(); //off thread work, continuations come back through main_loop_hk
+	debug_log = std::make_shared<DebugLog>(this);
+	memory_report = std::make_shared<MemoryReport>(this); //modules below register their probes with it
+	config_watch = std::make_shared<ConfigWatch>(this, ".", "eqclient.ini"); //before the modules that register reload callbacks
+	character_store = std::make_shared<CharacterStore>(this); //per character state, loaded when a character first asks for it
+	callbacks->add_work([this](int) {
+		tasks->post([this]() { if (ini->flush(true)) tasks->post_to_main([this]() { if (config_watch) config_watch->apply(); }); });
+		return false;
+	}, 1000, work_priority::low); //write behind for eqclient.ini and the fallback edit pickup when the folder can't be watched, the profile api calls run off the game thread
+	callbacks->add_work([](int) { if (Zeal::Profiler::enabled) Zeal::Profiler::decay(); return false; }, 5000, work_priority::low); //keeps the profiler histograms to the last few seconds
+	callbacks->add_work([](int) { Zeal::EqGame::refresh_user_colors(); return false; }, 1000, work_priority::low); //picks up color edits in the options window
+	callbacks->add_generic([this]() { fast_login->defer([]() { Zeal::EqGame::refresh_user_colors(); }); }, callback_type::InitUI); //a skin reload
+	callbacks->add_generic([]() { Zeal::EqGame::reset_region_cache(); }, callback_type::Zone);
+	callbacks->add_generic([]() { Zeal::EqGame::reset_raycasts(); }, callback_type::Zone);
+	callbacks->add_generic([]() { Zeal::EqGame::reset_raycasts(); }); //the memo only holds within a frame, registered first so it drops before anyone casts
+	callbacks->add_generic([]() {
+		if ((GetAsyncKeyState(VK_PAUSE) & 0x8000) && (GetAsyncKeyState(VK_SHIFT) & 0x8000) && GetForegroundWindow() == Zeal::EqGame::get_game_window())
+			Shutdown::request();
+	}, callback_type::EndScene); //shift+pause unloads, checked once a rendered frame in every game state, only for the focused client
+	entity_manager = std::make_shared<EntityManager>(this); //entity lookups in EqFunctions go through this
+	packets = std::make_shared<PacketGovernor>(this); //every packet zeal sends on its own goes through this
+	spell_index = std::make_shared<SpellIndex>(this);
+	guild_roster = std::make_shared<GuildRoster>(this);
+	item_index = std::make_shared<ItemIndex>(this);
+	input = std::make_shared<InputEvents>(this); //consumes key transitions at the start of each frame, before the modules below
 	looting_hook = std::make_shared<looting>(this);
 	labels_hook = std::make_shared<labels>(this);
+	pet_tracker = std::make_shared<PetTracker>(this); //pet lookups in EqFunctions go through this once it exists
 	pipe = std::make_shared<named_pipe>(this, ini.get()); //other classes below rely on this class on initialize
+	shared_state = std::make_shared<SharedState>(this, ini.get());
+	command_bus = std::make_shared<CommandBus>(this);
 	binds_hook = std::make_shared<Binds>(this);
 	raid_hook = std::make_shared<raid>(this);
 	eqstr_hook = std::make_shared<eqstr>(this);
-	spell_sets = std::make_shared<SpellSets>(this);
+	window_stack = std::make_shared<WindowStack>(this); //escape closes zeal's windows from the top of this
 	item_displays = std::make_shared<ItemDisplay>(this, ini.get());
 	tooltips = std::make_shared<tooltip>(this, ini.get());
 	floating_damage = std::make_shared<FloatingDamage>(this, ini.get());
@@ -37,18 +85,52 @@ ZealService::ZealService()
 	camera_mods = std::make_shared<CameraMods>(this, ini.get());
 	cycle_target = std::make_shared<CycleTarget>(this);
 	experience = std::make_shared<Experience>(this);
+	chat_log = std::make_shared<ChatLog>(this, ini.get());
+	audio = std::make_shared<AudioCues>(this); //triggers, tells, buff warnings and the alarm play through it
+	chat_triggers = std::make_shared<ChatTriggers>(this, ini.get());
+	chat_router = std::make_shared<ChatRouter>(this, ini.get());
+	chat_history = std::make_shared<ChatHistory>(this, ini.get());
 	chat_hook = std::make_shared<chat>(this, ini.get());
-	outputfile = std::make_shared<OutputFile>(this);
 	buff_timers = std::make_shared<BuffTimers>(this);
+	cast_tracker = std::make_shared<CastTracker>(this); //the melody and hotbutton macros schedule on it
+	buff_stacking = std::make_shared<BuffStacking>(this);
 	movement = std::make_shared<PlayerMovement>(this, binds_hook.get(), ini.get());
+	navigation = std::make_shared<Navigation>(this);
 	alarm = std::make_shared<Alarm>(this);
-	netstat = std::make_shared<Netstat>(this, ini.get());
 	ui = std::make_shared<ui_manager>(this, ini.get());
 	melody = std::make_shared<Melody>(this, ini.get());
 	autofire = std::make_shared<AutoFire>(this, ini.get());
 	physics = std::make_shared<Physics>(this, ini.get());
 	target_ring = std::make_shared<TargetRing>(this, ini.get());
+	nameplates = std::make_shared<Nameplates>(this);
+	radar = std::make_shared<Radar>(this);
+	frame_profiler = std::make_shared<FrameProfiler>(this);
+	screenshot = std::make_shared<Screenshot>(this);
+	frame_pacer = std::make_shared<FramePacer>(this);
+	zone_warmup = std::make_shared<ZoneWarmup>(this);
+	fast_login = std::make_shared<FastLogin>(this); //InitUI work defers through it, every module is built before the first InitUI
+	benchmark = std::make_shared<Benchmark>(this);
+	plugins = std::make_shared<PluginHost>(this, ".\\zeal_plugins"); //last, a plugin's callbacks run after zeal's own
 	this->basic_binds();
+	hooks->commit();
+	callbacks->add_delayed([this]() { deferred_init(); }, 0); //first main loop, once the client is responsive
+}
+
+// modules nothing else depends on during startup and whose hooks are not needed before the first frame
+void ZealService::deferred_init()
+{
+	hooks->begin_batch();
+	spell_sets = std::make_shared<SpellSets>(this);
+	outputfile = std::make_shared<OutputFile>(this);
+	netstat = std::make_shared<Netstat>(this, ini.get());
+	packet_capture = std::make_shared<PacketCapture>(this);
+	session_stats = std::make_shared<SessionStats>(this);
+	damage_meter = std::make_shared<DamageMeter>(this);
+	corpse_drag = std::make_shared<CorpseDrag>(this);
+	spawn_tracker = std::make_shared<SpawnTracker>(this);
+	con_cache = std::make_shared<ConCache>(this);
+	input_history = std::make_shared<InputHistory>(this);
+	hooks->commit();
 }
 
 void ZealService::basic_binds()
@@ -87,21 +169,20 @@ void ZealService::basic_binds()
 
 	binds_hook->replace_cmd(5, [this](int state) 
 	{
-		camera_mods->handle_camera_motion_binds(5, state);
 		movement->handle_movement_binds(5, state);
 		return false;
 	}); //turn right
 
 	binds_hook->replace_cmd(6, [this](int state) 
 	{
-		camera_mods->handle_camera_motion_binds(6, state);
 		movement->handle_movement_binds(6, state);
 		return false;
 	}); //turn left
 
 	binds_hook->replace_cmd(30, [this](int state) 
 	{
-			netstat->toggle_netstat(state);
+			if (netstat)
+				netstat->toggle_netstat(state);
 			return false;
 	});
 
@@ -128,18 +209,10 @@ void ZealService::basic_binds()
 			return true;
 		}
 
-		if (ini->getValue<bool>("Zeal", "Escape"))//toggle is set to not close any windows
+		if (escape_keeps_windows)//toggle is set to not close any windows
 			return true;
 
-		for (auto rit = item_displays->windows.rbegin(); rit != item_displays->windows.rend(); ++rit) {
-			Zeal::EqUI::ItemDisplayWnd* wnd = *rit;
-			if (wnd->IsVisible)
-			{
-				wnd->IsVisible = false;
-				return true;
-			}
-		}
-		return false;
+		return window_stack->close_top();
 	}); //handle escape
 }
 
@@ -162,28 +235,76 @@ ZealService* ZealService::get_instance()
 }
 ZealService::~ZealService()
 {
-	hooks.reset();
+	hooks->begin_batch();
+	hooks->restore(); //no new calls into zeal after this
+	hooks->commit();
+	Sleep(100); //a thread that took a jmp just before the restore is through the thunk's first instructions by now
+	while (Zeal::Hooks::in_flight.load(std::memory_order_acquire)) //the unload chord itself is one of these, from EndScene
+		Sleep(1);
+	hooks.reset(); //frees the trampolines, nothing can be inside one now
+	pipe.reset(); //its thread reads module state, stop it before the modules go
+	config_watch.reset(); //its thread posts to the pool and the game thread
+	tasks.reset(); //same for queued background jobs
+	plugins.reset(); //unloads the dlls, their callbacks are unreachable once the hooks are gone
+	benchmark.reset();
+	fast_login.reset();
+	zone_warmup.reset();
+	frame_pacer.reset();
+	screenshot.reset();
+	frame_profiler.reset();
+	radar.reset();
+	nameplates.reset();
 	autofire.reset();
 	melody.reset();
 	ui.reset();
+	input_history.reset();
+	con_cache.reset();
+	spawn_tracker.reset();
+	corpse_drag.reset();
+	damage_meter.reset();
+	session_stats.reset();
+	packet_capture.reset();
 	netstat.reset();
 	alarm.reset();
+	navigation.reset();
 	movement.reset();
+	buff_stacking.reset();
+	cast_tracker.reset();
 	buff_timers.reset();
 	outputfile.reset();
 	chat_hook.reset();
+	chat_history.reset();
+	chat_router.reset();
+	chat_triggers.reset();
+	audio.reset();
+	chat_log.reset();
 	experience.reset();
 	cycle_target.reset();
 	camera_mods.reset();
 	item_displays.reset();
+	window_stack.reset();
 	spell_sets.reset();
 	eqstr_hook.reset();
 	raid_hook.reset();
 	binds_hook.reset();
+	pet_tracker.reset();
 	labels_hook.reset();
 	looting_hook.reset();
+	command_bus.reset();
+	shared_state.reset();
+	item_index.reset();
+	guild_roster.reset();
+	spell_index.reset();
+	packets.reset();
+	entity_manager.reset();
+	input.reset();
+	character_store.reset();
+	memory_report.reset();
 	callbacks.reset();
 	commands_hook.reset();
+	debug_log.reset(); //last, so the modules above can still log on the way out
+	Settings::bind(nullptr);
 	ini.reset();
+	addresses.reset();
 	
 }
@@ -1,26 +1,49 @@
 #pragma once
 #include "framework.h"
 #define ZEAL_VERSION "0.2.10"
-static std::atomic<bool> exitFlag(false);
+// one token for the whole process: the unload chord or process detach signals it, init() in dllmain waits on it
+namespace Shutdown
+{
+	void request(bool process_exit = false);
+	bool requested();
+	bool process_exiting(); //set when the process is going away, nothing should be torn down then
+	HANDLE event(); //manual reset, signaled once requested
+}
 class ZealService
 {
 public:
 	//hooks
 	std::shared_ptr<CrashHandler> crash_handler = nullptr;
+	std::shared_ptr<AddressTable> addresses = nullptr;
 	std::shared_ptr<IO_ini> ini = nullptr;
 	std::shared_ptr<HookWrapper> hooks = nullptr;
 	std::shared_ptr<named_pipe> pipe = nullptr;
+	std::shared_ptr<SharedState> shared_state = nullptr;
+	std::shared_ptr<CommandBus> command_bus = nullptr;
 	std::shared_ptr<looting> looting_hook = nullptr;
 	std::shared_ptr<labels> labels_hook = nullptr;
+	std::shared_ptr<PetTracker> pet_tracker = nullptr;
 	std::shared_ptr<Binds> binds_hook = nullptr;
 	std::shared_ptr<ChatCommands> commands_hook = nullptr;
 	std::shared_ptr<CallbackManager> callbacks = nullptr;
+	std::shared_ptr<TaskPool> tasks = nullptr;
+	std::shared_ptr<DebugLog> debug_log = nullptr;
+	std::shared_ptr<CharacterStore> character_store = nullptr;
+	std::shared_ptr<ConfigWatch> config_watch = nullptr;
+	std::shared_ptr<MemoryReport> memory_report = nullptr;
+	std::shared_ptr<EntityManager> entity_manager = nullptr;
+	std::shared_ptr<PacketGovernor> packets = nullptr;
+	std::shared_ptr<SpellIndex> spell_index = nullptr;
+	std::shared_ptr<GuildRoster> guild_roster = nullptr;
+	std::shared_ptr<ItemIndex> item_index = nullptr;
+	std::shared_ptr<InputEvents> input = nullptr;
 	std::shared_ptr<CameraMods> camera_mods = nullptr;
 	std::shared_ptr<raid> raid_hook = nullptr;
 	std::shared_ptr<eqstr> eqstr_hook = nullptr;
 	std::shared_ptr<chat> chat_hook = nullptr;
 	std::shared_ptr<SpellSets> spell_sets = nullptr;
 	std::shared_ptr<ItemDisplay> item_displays = nullptr;
+	std::shared_ptr<WindowStack> window_stack = nullptr;
 	std::shared_ptr<tooltip> tooltips = nullptr;
 	std::shared_ptr<Physics> physics = nullptr;
 	std::shared_ptr<FloatingDamage> floating_damage = nullptr;
@@ -28,16 +51,43 @@ public:
 
 	//other features
 	std::shared_ptr<OutputFile> outputfile = nullptr;
+	std::shared_ptr<ChatLog> chat_log = nullptr;
+	std::shared_ptr<AudioCues> audio = nullptr;
+	std::shared_ptr<ChatTriggers> chat_triggers = nullptr;
+	std::shared_ptr<ChatRouter> chat_router = nullptr;
+	std::shared_ptr<ChatHistory> chat_history = nullptr;
 	std::shared_ptr<Experience> experience = nullptr;
 	std::shared_ptr<CycleTarget> cycle_target = nullptr;
 	std::shared_ptr<BuffTimers> buff_timers = nullptr;
+	std::shared_ptr<CastTracker> cast_tracker = nullptr;
+	std::shared_ptr<BuffStacking> buff_stacking = nullptr;
 	std::shared_ptr<PlayerMovement> movement = nullptr;
+	std::shared_ptr<Navigation> navigation = nullptr;
 	std::shared_ptr<Alarm> alarm = nullptr;
 	std::shared_ptr<Netstat> netstat = nullptr;
+	std::shared_ptr<PacketCapture> packet_capture = nullptr;
+	std::shared_ptr<SessionStats> session_stats = nullptr;
+	std::shared_ptr<DamageMeter> damage_meter = nullptr;
+	std::shared_ptr<CorpseDrag> corpse_drag = nullptr;
+	std::shared_ptr<SpawnTracker> spawn_tracker = nullptr;
+	std::shared_ptr<ConCache> con_cache = nullptr;
+	std::shared_ptr<InputHistory> input_history = nullptr;
 	std::shared_ptr<ui_manager> ui = nullptr;
 	std::shared_ptr<Melody> melody = nullptr;
 	std::shared_ptr<AutoFire> autofire = nullptr;
 	std::shared_ptr<TargetRing> target_ring = nullptr;
+	std::shared_ptr<Nameplates> nameplates = nullptr;
+	std::shared_ptr<Radar> radar = nullptr;
+	std::shared_ptr<FrameProfiler> frame_profiler = nullptr;
+	std::shared_ptr<Screenshot> screenshot = nullptr;
+	std::shared_ptr<FramePacer> frame_pacer = nullptr;
+	std::shared_ptr<ZoneWarmup> zone_warmup = nullptr;
+	std::shared_ptr<FastLogin> fast_login = nullptr;
+	std::shared_ptr<Benchmark> benchmark = nullptr;
+	std::shared_ptr<PluginHost> plugins = nullptr;
+
+	//settings owned by the service itself
+	Setting<bool> escape_keeps_windows{ "Zeal", "Escape", false }; //escape only clears the target, windows stay open
 	
 	ZealService();
 	~ZealService();
@@ -47,10 +97,9 @@ public:
 
 	bool exit = false;
 private:
-	std::thread render_thread;
 	BYTE orig_render_data[11];
 	void basic_binds();
+	void deferred_init();
 	void apply_patches();
-	void RenderThread();
 };
 
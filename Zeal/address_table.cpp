@@ -0,0 +1,216 @@
+#include "address_table.h"
+#include "FindPattern.h"
+#include "InstructionLength.h"
+#include "debug_log.h"
+#include <stdio.h>
+#include <string>
+
+static const char* cache_path = ".\\zeal_addresses.bin";
+static constexpr DWORD cache_magic = 'RDAZ';
+static constexpr DWORD cache_version = 1;
+
+const DWORD AddressTable::defaults[static_cast<size_t>(game_address::_count)] = {
+	0x5473c3, //main_loop
+	0x4AA8BC, //render
+	0x54050c, //execute_cmd
+	0x53D2C4, //enter_zone
+	0x53b9cf, //character_select
+	0x4e829f, //handle_world_message
+	0x54e51a, //send_message
+	0x4e25a1, //msg_new_text
+	0x537f99, //print_chat
+	0x5240dc, //log_chat_text
+};
+
+module_key AddressTable::read_key(HMODULE module)
+{
+	module_key key = {};
+	if (!module)
+		return key;
+	auto dos = reinterpret_cast<const IMAGE_DOS_HEADER*>(module);
+	auto nt = reinterpret_cast<const IMAGE_NT_HEADERS*>(reinterpret_cast<const BYTE*>(module) + dos->e_lfanew);
+	key.timestamp = nt->FileHeader.TimeDateStamp;
+	key.checksum = nt->OptionalHeader.CheckSum;
+	key.image_size = nt->OptionalHeader.SizeOfImage;
+	return key;
+}
+
+bool AddressTable::load(module_key& game, module_key& gfx)
+{
+	FILE* f = nullptr;
+	if (fopen_s(&f, cache_path, "rb") || !f)
+		return false;
+	DWORD magic = 0, version = 0, count = 0;
+	bool ok = fread(&magic, sizeof(magic), 1, f) == 1 && magic == cache_magic
+		&& fread(&version, sizeof(version), 1, f) == 1 && version == cache_version
+		&& fread(&game, sizeof(game), 1, f) == 1 && fread(&gfx, sizeof(gfx), 1, f) == 1
+		&& fread(&count, sizeof(count), 1, f) == 1 && count == static_cast<DWORD>(game_address::_count)
+		&& fread(addresses, sizeof(addresses), 1, f) == 1
+		&& fread(signatures, sizeof(signatures), 1, f) == 1;
+	fclose(f);
+	return ok;
+}
+
+void AddressTable::save()
+{
+	FILE* f = nullptr;
+	if (fopen_s(&f, cache_path, "wb") || !f)
+		return;
+	DWORD count = static_cast<DWORD>(game_address::_count);
+	fwrite(&cache_magic, sizeof(cache_magic), 1, f);
+	fwrite(&cache_version, sizeof(cache_version), 1, f);
+	fwrite(&game_key, sizeof(game_key), 1, f);
+	fwrite(&gfx_key, sizeof(gfx_key), 1, f);
+	fwrite(&count, sizeof(count), 1, f);
+	fwrite(addresses, sizeof(addresses), 1, f);
+	fwrite(signatures, sizeof(signatures), 1, f);
+	fclose(f);
+}
+
+static Zeal::Memory::Pattern to_pattern(const BYTE* bytes, const BYTE* mask, size_t length)
+{
+	std::string raw(reinterpret_cast<const char*>(bytes), length);
+	std::string mask_str;
+	for (size_t b = 0; b < length; b++)
+		mask_str += mask[b] ? 'x' : '?';
+	return Zeal::Memory::Pattern(raw.c_str(), mask_str.c_str());
+}
+
+//reads the code at a resolved address into a signature, wildcarding the trailing four bytes of long instructions
+//since those are the displacements and immediates that move between builds
+void AddressTable::learn(size_t i)
+{
+	const BYTE* begin;
+	const BYTE* end;
+	signature& sig = signatures[i];
+	sig = {};
+	if (!Zeal::Memory::ModuleRange(nullptr, begin, end))
+		return;
+	BYTE* code = reinterpret_cast<BYTE*>(addresses[i]);
+	if (code < begin || code + signature_length > end || *code == 0xE9) //outside the image or already detoured by something else
+		return;
+	size_t length = 0;
+	while (length < signature_length)
+	{
+		size_t op = Zeal::InstructionLength(code + length);
+		if (!op || length + op > signature_length)
+			break;
+		for (size_t b = 0; b < op; b++)
+		{
+			sig.bytes[length + b] = code[length + b];
+			sig.mask[length + b] = !(op >= 5 && b >= op - 4);
+		}
+		length += op;
+	}
+	if (length < 8)
+		return;
+	//a signature only helps if it is unique in the image
+	Zeal::Memory::Pattern pattern = to_pattern(sig.bytes, sig.mask, length);
+	if (Zeal::Memory::Scan(begin, end, pattern) != code || Zeal::Memory::Scan(code + 1, end, pattern))
+		return;
+	sig.length = static_cast<BYTE>(length);
+}
+
+//finds every learned signature in one pass, returns which symbols were found
+std::vector<bool> AddressTable::relocate()
+{
+	std::vector<bool> found(static_cast<size_t>(game_address::_count), false);
+	const BYTE* begin;
+	const BYTE* end;
+	if (!Zeal::Memory::ModuleRange(nullptr, begin, end))
+		return found;
+	std::vector<Zeal::Memory::Pattern> patterns;
+	std::vector<size_t> symbols;
+	for (size_t i = 0; i < static_cast<size_t>(game_address::_count); i++)
+	{
+		if (!signatures[i].length)
+			continue;
+		patterns.push_back(to_pattern(signatures[i].bytes, signatures[i].mask, signatures[i].length));
+		symbols.push_back(i);
+	}
+	std::vector<const Zeal::Memory::Pattern*> list;
+	for (auto& p : patterns)
+		list.push_back(&p);
+	std::vector<const BYTE*> hits(list.size());
+	Zeal::Memory::ScanMany(begin, end, list.data(), list.size(), hits.data());
+	for (size_t j = 0; j < symbols.size(); j++)
+	{
+		if (!hits[j])
+			continue;
+		addresses[symbols[j]] = reinterpret_cast<DWORD>(hits[j]);
+		found[symbols[j]] = true;
+	}
+	return found;
+}
+
+//which built in addresses the image calls, jumps to or holds as a pointer. a function entry of the build the defaults
+//were taken from always is, on another build the same address most likely lands inside some other code
+std::vector<bool> AddressTable::referenced_defaults()
+{
+	std::vector<bool> seen(static_cast<size_t>(game_address::_count), false);
+	const BYTE* begin;
+	const BYTE* end;
+	if (!Zeal::Memory::ModuleRange(nullptr, begin, end))
+		return seen;
+	for (const BYTE* p = begin; p + 5 <= end; p++)
+	{
+		DWORD absolute = *reinterpret_cast<const DWORD*>(p);
+		DWORD target = (*p == 0xE8 || *p == 0xE9) ? reinterpret_cast<DWORD>(p) + 5 + *reinterpret_cast<const DWORD*>(p + 1) : 0;
+		for (size_t i = 0; i < seen.size(); i++)
+		{
+			if (absolute == defaults[i] || target == defaults[i])
+				seen[i] = true;
+		}
+	}
+	return seen;
+}
+
+AddressTable::AddressTable()
+{
+	memcpy(addresses, defaults, sizeof(addresses));
+	game_key = read_key(GetModuleHandleA(nullptr));
+	gfx_key = read_key(GetModuleHandleA("eqgfx_dx8.dll"));
+
+	module_key cached_game = {}, cached_gfx = {};
+	bool cached = load(cached_game, cached_gfx);
+	bool gfx_matches = !cached_gfx.timestamp || !gfx_key.timestamp || cached_gfx == gfx_key; //the dll may not be loaded yet
+	if (cached && cached_game == game_key && gfx_matches)
+		return; //same build, nothing to scan
+	memcpy(addresses, defaults, sizeof(addresses));
+	if (cached)
+	{
+		//the client changed, find the learned code again; symbols that were not found keep their old signature for the
+		//next build and are unresolved on this one, cached as 0 so nothing hooks or relearns from a guessed address
+		std::vector<bool> found = relocate();
+		for (size_t i = 0; i < found.size(); i++)
+		{
+			if (found[i])
+				learn(i);
+			else
+			{
+				addresses[i] = 0;
+				ZEAL_LOG_WARN("addresses", "symbol %u not found on this client build, its hooks are skipped", static_cast<UINT>(i));
+			}
+		}
+	}
+	else
+	{
+		//no cache says which build this is, a default is only taken where the image agrees it is a function entry
+		std::vector<bool> referenced = referenced_defaults();
+		for (size_t i = 0; i < referenced.size(); i++)
+		{
+			if (referenced[i])
+				learn(i);
+			else
+			{
+				addresses[i] = 0;
+				ZEAL_LOG_WARN("addresses", "symbol %u is not referenced at its built in address on this client build, its hooks are skipped", static_cast<UINT>(i));
+			}
+		}
+	}
+	save();
+}
+
+AddressTable::~AddressTable()
+{
+}
@@ -0,0 +1,60 @@
+#pragma once
+#include <Windows.h>
+#include <vector>
+
+// game addresses resolved once per client build and cached in zeal_addresses.bin
+// the first launch takes a built in address only when the running image calls, jumps to or points at it (every symbol
+// is a function entry) and learns a signature for each; when eqgame.exe changes the signatures are scanned for in one
+// pass so a patched client keeps working without a rebuild. a symbol that fails either check is unresolved (0) for that
+// build, the built in address is never assumed for a client it wasn't taken from
+enum struct game_address
+{
+	main_loop,
+	render,
+	execute_cmd,
+	enter_zone,
+	character_select,
+	handle_world_message,
+	send_message,
+	msg_new_text,
+	print_chat,
+	log_chat_text,
+	_count
+};
+
+struct module_key
+{
+	DWORD timestamp;
+	DWORD checksum;
+	DWORD image_size;
+	bool operator==(const module_key& o) const { return timestamp == o.timestamp && checksum == o.checksum && image_size == o.image_size; }
+};
+
+class AddressTable
+{
+public:
+	static constexpr size_t signature_length = 32;
+	AddressTable();
+	~AddressTable();
+	DWORD get(game_address symbol) const { return addresses[static_cast<size_t>(symbol)]; } //0 when unresolved, HookWrapper skips those
+	bool resolved(game_address symbol) const { return addresses[static_cast<size_t>(symbol)] != 0; }
+	bool relocated(game_address symbol) const { return resolved(symbol) && addresses[static_cast<size_t>(symbol)] != defaults[static_cast<size_t>(symbol)]; }
+private:
+	struct signature
+	{
+		BYTE bytes[signature_length];
+		BYTE mask[signature_length]; //1 where the byte has to match, operands that may hold addresses are wildcards
+		BYTE length;
+	};
+	static const DWORD defaults[static_cast<size_t>(game_address::_count)];
+	static module_key read_key(HMODULE module);
+	bool load(module_key& game, module_key& gfx);
+	void save();
+	void learn(size_t symbol);
+	std::vector<bool> relocate();
+	static std::vector<bool> referenced_defaults();
+	DWORD addresses[static_cast<size_t>(game_address::_count)];
+	signature signatures[static_cast<size_t>(game_address::_count)] = {};
+	module_key game_key = {};
+	module_key gfx_key = {};
+};
@@ -39,6 +39,8 @@ void Alarm::callback_main()
     if (GetTickCount64() - start_time > duration)
     {
       Zeal::EqGame::print_chat("[Alarm] COMPLETED!");
+      if (ZealService::get_instance()->audio)
+        ZealService::get_instance()->audio->play(audio_cue::alarm);
       enabled = false;
     }
   }
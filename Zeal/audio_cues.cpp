@@ -0,0 +1,187 @@
+#include "audio_cues.h"
+#include "Zeal.h"
+#include "EqFunctions.h"
+#include "string_util.h"
+#include <fstream>
+
+static const char* cue_names[] = { "alarm", "tell", "trigger", "buff" };
+
+// riff wave with a pcm fmt chunk, anything compressed is left for the system sound fallback
+bool AudioCues::load(const char* path, clip& out)
+{
+	std::ifstream file(path, std::ios::binary);
+	if (!file)
+		return false;
+	std::vector<BYTE> bytes((std::istreambuf_iterator<char>(file)), std::istreambuf_iterator<char>());
+	if (bytes.size() < 12 || memcmp(bytes.data(), "RIFF", 4) || memcmp(bytes.data() + 8, "WAVE", 4))
+		return false;
+	bool have_format = false;
+	size_t pos = 12;
+	while (pos + 8 <= bytes.size())
+	{
+		DWORD size = *reinterpret_cast<const DWORD*>(bytes.data() + pos + 4);
+		const BYTE* body = bytes.data() + pos + 8;
+		if (size > bytes.size() - pos - 8)
+			size = static_cast<DWORD>(bytes.size() - pos - 8);
+		if (!memcmp(bytes.data() + pos, "fmt ", 4) && size >= 16)
+		{
+			memcpy(&out.format, body, 16); //PCMWAVEFORMAT, cbSize stays 0
+			out.format.cbSize = 0;
+			have_format = out.format.wFormatTag == WAVE_FORMAT_PCM;
+		}
+		else if (!memcmp(bytes.data() + pos, "data", 4) && have_format)
+		{
+			out.pcm.assign(body, body + size);
+			return !out.pcm.empty();
+		}
+		pos += 8 + size + (size & 1); //chunks are word aligned
+	}
+	return false;
+}
+
+void AudioCues::play(audio_cue cue)
+{
+	{
+		std::lock_guard<std::mutex> guard(lock);
+		queued.push_back(cue);
+	}
+	wake.notify_one();
+}
+
+void AudioCues::close(voice& v)
+{
+	if (!v.handle)
+		return;
+	waveOutReset(v.handle);
+	if (v.prepared)
+		waveOutUnprepareHeader(v.handle, &v.header, sizeof(v.header));
+	waveOutClose(v.handle);
+	v = voice();
+}
+
+// a voice stays open with the format it was last opened for, a clip in the same format reuses it without a reopen
+void AudioCues::start(voice& v, const clip& c)
+{
+	if (v.handle && memcmp(&v.format, &c.format, sizeof(WAVEFORMATEX)))
+		close(v);
+	if (v.handle)
+	{
+		waveOutReset(v.handle);
+		if (v.prepared)
+			waveOutUnprepareHeader(v.handle, &v.header, sizeof(v.header));
+		v.prepared = false;
+	}
+	else
+	{
+		WAVEFORMATEX format = c.format;
+		if (waveOutOpen(&v.handle, WAVE_MAPPER, &format, 0, 0, CALLBACK_NULL) != MMSYSERR_NOERROR)
+		{
+			v.handle = nullptr;
+			return;
+		}
+		v.format = c.format;
+	}
+	v.header = {};
+	v.header.lpData = reinterpret_cast<LPSTR>(const_cast<BYTE*>(c.pcm.data()));
+	v.header.dwBufferLength = static_cast<DWORD>(c.pcm.size());
+	if (waveOutPrepareHeader(v.handle, &v.header, sizeof(v.header)) != MMSYSERR_NOERROR)
+		return;
+	v.prepared = true;
+	v.started = GetTickCount64();
+	waveOutWrite(v.handle, &v.header, sizeof(v.header));
+}
+
+void AudioCues::thread_main()
+{
+	for (int i = 0; i < cue_count; ++i)
+	{
+		char path[MAX_PATH];
+		snprintf(path, sizeof(path), "sounds\\zeal\\%s.wav", cue_names[i]);
+		if (!load(path, clips[i]))
+			clips[i] = clip();
+	}
+	std::vector<audio_cue> cues;
+	while (true)
+	{
+		{
+			std::unique_lock<std::mutex> guard(lock);
+			wake.wait(guard, [this]() { return end_thread || !queued.empty(); });
+			if (end_thread)
+				break;
+			cues.swap(queued);
+		}
+		for (audio_cue cue : cues)
+		{
+			const clip& c = clips[static_cast<int>(cue)];
+			if (c.pcm.empty())
+			{
+				MessageBeep(MB_ICONEXCLAMATION);
+				continue;
+			}
+			// a finished voice with the same format first, then any finished one, then the one playing longest
+			voice* pick = nullptr;
+			for (voice& v : voices)
+			{
+				bool idle = !v.prepared || (v.header.dwFlags & WHDR_DONE);
+				bool same = v.handle && !memcmp(&v.format, &c.format, sizeof(WAVEFORMATEX));
+				if (idle && same)
+				{
+					pick = &v;
+					break;
+				}
+				if (idle && !pick)
+					pick = &v;
+			}
+			if (!pick)
+			{
+				pick = &voices[0];
+				for (voice& v : voices)
+					if (v.started < pick->started)
+						pick = &v;
+			}
+			start(*pick, c);
+		}
+		cues.clear();
+	}
+	for (voice& v : voices)
+		close(v);
+}
+
+AudioCues::AudioCues(ZealService* zeal)
+{
+	thread = std::thread([this]() { thread_main(); });
+	zeal->commands_hook->add("/zealsound", {}, "Notification sounds from sounds\\zeal\\<alarm|tell|trigger|buff>.wav, /zealsound tell toggles the sound on incoming tells, "
+		"/zealsound test <cue> plays one.",
+		[this](std::vector<std::string>& args) {
+			if (args.size() > 1 && Zeal::String::compare_insensitive(args[1], "tell"))
+			{
+				tell_sound.set(!tell_sound.get());
+				Zeal::EqGame::print_chat("Tell sound is %s", tell_sound.get() ? "on" : "off");
+				return true;
+			}
+			if (args.size() > 2 && Zeal::String::compare_insensitive(args[1], "test"))
+			{
+				for (int i = 0; i < cue_count; ++i)
+				{
+					if (Zeal::String::compare_insensitive(args[2], cue_names[i]))
+					{
+						play(static_cast<audio_cue>(i));
+						return true;
+					}
+				}
+			}
+			Zeal::EqGame::print_chat("usage: /zealsound tell | /zealsound test <alarm|tell|trigger|buff>");
+			return true;
+		});
+}
+
+AudioCues::~AudioCues()
+{
+	{
+		std::lock_guard<std::mutex> guard(lock);
+		end_thread = true;
+	}
+	wake.notify_one();
+	if (thread.joinable())
+		thread.join();
+}
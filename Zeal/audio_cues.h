@@ -0,0 +1,57 @@
+#pragma once
+#include <Windows.h>
+#include <mmsystem.h>
+#include <array>
+#include <condition_variable>
+#include <mutex>
+#include <thread>
+#include <vector>
+#include "settings.h"
+
+enum class audio_cue
+{
+	alarm,
+	tell,
+	trigger,
+	buff_fading,
+	_count
+};
+
+// short notification sounds from sounds\zeal\<cue>.wav, decoded into memory once by the audio thread and played from
+// there through a few waveOut voices it keeps open, so play() from the game thread is a queue push and never touches
+// the disk or the driver. a cue without a file falls back to the system exclamation sound
+class AudioCues
+{
+public:
+	void play(audio_cue cue); //any thread
+	Setting<bool> tell_sound{ "Zeal", "TellSound", false };
+	AudioCues(class ZealService* zeal);
+	~AudioCues();
+private:
+	static constexpr int voice_count = 4;
+	static constexpr int cue_count = static_cast<int>(audio_cue::_count);
+	struct clip
+	{
+		WAVEFORMATEX format = {};
+		std::vector<BYTE> pcm; //empty when the file is missing or not pcm
+	};
+	struct voice
+	{
+		HWAVEOUT handle = nullptr;
+		WAVEFORMATEX format = {};
+		WAVEHDR header = {};
+		bool prepared = false;
+		ULONGLONG started = 0;
+	};
+	static bool load(const char* path, clip& out);
+	void thread_main();
+	void start(voice& v, const clip& c);
+	void close(voice& v);
+	std::array<clip, cue_count> clips; //owned by the audio thread
+	std::array<voice, voice_count> voices;
+	std::mutex lock;
+	std::condition_variable wake;
+	std::vector<audio_cue> queued;
+	bool end_thread = false;
+	std::thread thread;
+};
@@ -10,7 +10,7 @@
 //    static bool disabled_auto = false;
 //    if (type == 13 || type == 14)
 //    {
-//        ZealService::get_instance()->eqstr_hook->str_noprint[124] = true; //don't print too far away messaging
+//        ZealService::get_instance()->eqstr_hook->set_noprint(124, true); //don't print too far away messaging
 //        if (!Zeal::EqGame::CanIHitTarget(0.f))
 //        {
 //            if (player->Position.Dist2D(target->Position) > 30.f )
@@ -25,7 +25,7 @@
 //                {
 //                    do_autofire = false;
 //                }
-//                ZealService::get_instance()->eqstr_hook->str_noprint[124] = false;
+//                ZealService::get_instance()->eqstr_hook->set_noprint(124, false);
 //                return true;
 //            }
 //        }
@@ -37,62 +37,97 @@
 //    return false;
 //}
 
+static constexpr int noprint_ids[] = { 124, 108, 12695, 12696, 12698, 12699 }; //too far, can't see and the other range failure messages
+static constexpr float hit_slack = 100.f; //CanIHitTarget adds both actors' sizes to the range, generous so large models aren't culled early
+
+void AutoFire::update_range()
+{
+    Zeal::EqStructures::EQCHARINFO* char_info = Zeal::EqGame::get_char_info();
+    Zeal::EqStructures::_EQITEMINFO* ranged = char_info ? char_info->Inventory.Ranged : nullptr;
+    Zeal::EqStructures::_EQITEMINFO* ammo = char_info ? char_info->Inventory.Ammo : nullptr;
+    if (range_valid && ranged == cached_ranged && ammo == cached_ammo)
+        return;
+    cached_ranged = ranged;
+    cached_ammo = ammo;
+    range_valid = true;
+    range = 0;
+    if (ranged && ranged->Common.Skill == 0x5)
+    {
+        range += ranged->Common.Range;
+        if (ammo)
+            range += ammo->Common.Range;
+    }
+    else if (ranged && ammo && ammo->Common.Range)
+    {
+        range += ammo->Common.Range;
+    }
+    else
+    {
+        range = -1;
+    }
+}
+
 void AutoFire::Main()
 {
-    if (!Zeal::EqGame::get_target() || *(BYTE*)0x7f6ffe)
+    Zeal::EqStructures::Entity* target = Zeal::EqGame::get_target();
+    if (!target || *Zeal::EqGame::auto_attack_on)
     {
         SetAutoFire(false);
         return;
     }
-    static ULONGLONG last_print_time = GetTickCount64();
-    if (autofire)
+    if (!autofire)
+        return;
+
+    bool ready = *Zeal::EqGame::ranged_ready != 0;
+    if (ready && !was_ready)
+        do_autofire = true; //timer just elapsed, shoot as soon as the target is in range
+    else if (!ready)
+        do_autofire = false; //a manual shot took it
+    was_ready = ready;
+    if (!do_autofire)
+        return;
+
+    update_range();
+    if (range < 0)
     {
-        if (*(BYTE*)0x7cd844)
-        {
-            int range = 0;
-            if (Zeal::EqGame::get_char_info()->Inventory.Ranged && Zeal::EqGame::get_char_info()->Inventory.Ranged->Common.Skill == 0x5)
-            {
-                range += Zeal::EqGame::get_char_info()->Inventory.Ranged->Common.Range;
-                if (Zeal::EqGame::get_char_info()->Inventory.Ammo)
-                    range += Zeal::EqGame::get_char_info()->Inventory.Ammo->Common.Range;
-            }
-            else if (Zeal::EqGame::get_char_info()->Inventory.Ranged && Zeal::EqGame::get_char_info()->Inventory.Ammo && Zeal::EqGame::get_char_info()->Inventory.Ammo->Common.Range)
-            {
-                range += Zeal::EqGame::get_char_info()->Inventory.Ammo->Common.Range;
-            }
-            else
-            {
-                Zeal::EqGame::print_chat("You do not have a ranged weapon");
-                SetAutoFire(false);
-            }
+        Zeal::EqGame::print_chat("You do not have a ranged weapon");
+        SetAutoFire(false);
+        return;
+    }
 
-            if (GetTickCount64() - last_print_time<1000)
-            {
-                ZealService::get_instance()->eqstr_hook->str_noprint[124] = true;
-                ZealService::get_instance()->eqstr_hook->str_noprint[108] = true;
-                ZealService::get_instance()->eqstr_hook->str_noprint[12695] = true;
-                ZealService::get_instance()->eqstr_hook->str_noprint[12696] = true;
-                ZealService::get_instance()->eqstr_hook->str_noprint[12698] = true;
-                ZealService::get_instance()->eqstr_hook->str_noprint[12699] = true;
-            }
-            else
-            {
-                last_print_time = GetTickCount64();
-            }
+    Zeal::EqStructures::Entity* self = Zeal::EqGame::get_self();
+    if (!self)
+        return;
+    float dx = target->Position.x - self->Position.x;
+    float dy = target->Position.y - self->Position.y;
+    float reach = range + hit_slack;
+    if (dx * dx + dy * dy > reach * reach)
+        return; //clearly out of range, skip the game's hit test until it closes in
+
+    static ULONGLONG last_print_time = GetTickCount64();
+    bool quiet = GetTickCount64() - last_print_time < 1000;
+    if (quiet)
+    {
+        for (int id : noprint_ids)
+            ZealService::get_instance()->eqstr_hook->set_noprint(id, true);
+    }
+    else
+    {
+        last_print_time = GetTickCount64();
+    }
 
-            if (Zeal::EqGame::CanIHitTarget(static_cast<float>(range)))
-            {
-                *(BYTE*)0x7cd844 = 0;
-                Zeal::EqGame::do_attack(11, 0);
-            }
+    if (Zeal::EqGame::CanIHitTarget(static_cast<float>(range)))
+    {
+        *Zeal::EqGame::ranged_ready = 0;
+        was_ready = false;
+        do_autofire = false;
+        Zeal::EqGame::do_attack(11, 0);
+    }
 
-            ZealService::get_instance()->eqstr_hook->str_noprint[124] = false;
-            ZealService::get_instance()->eqstr_hook->str_noprint[108] = false;
-            ZealService::get_instance()->eqstr_hook->str_noprint[12695] = false;
-            ZealService::get_instance()->eqstr_hook->str_noprint[12696] = false;
-            ZealService::get_instance()->eqstr_hook->str_noprint[12698] = false;
-            ZealService::get_instance()->eqstr_hook->str_noprint[12699] = false;
-        }
+    if (quiet)
+    {
+        for (int id : noprint_ids)
+            ZealService::get_instance()->eqstr_hook->set_noprint(id, false);
     }
 }
 
@@ -120,6 +155,8 @@ void AutoFire::SetAutoFire(bool enabled)
     }
     autofire = enabled;
     do_autofire = false;
+    was_ready = false; //a timer that is already elapsed counts as a fresh transition
+    range_valid = false;
 }
 
 AutoFire::AutoFire(ZealService* zeal, IO_ini* ini)
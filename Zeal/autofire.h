@@ -13,7 +13,13 @@ public:
 	AutoFire(class ZealService* zeal, class IO_ini* ini);
 	~AutoFire();
 private: 
+	void update_range(); //recomputed only when the ranged or ammo item changes
 	bool was_autoattacking = false;
-	bool do_autofire = false;
+	bool do_autofire = false; //armed by the ranged timer becoming ready, cleared by the shot
+	bool was_ready = false;
+	bool range_valid = false;
+	int range = 0; //-1 without a usable ranged weapon
+	Zeal::EqStructures::_EQITEMINFO* cached_ranged = nullptr;
+	Zeal::EqStructures::_EQITEMINFO* cached_ammo = nullptr;
 };
 
@@ -0,0 +1,294 @@
+#include "benchmark.h"
+#include "Zeal.h"
+#include "EqFunctions.h"
+#include "string_util.h"
+#include "camera_math.h"
+#include "SpellCategories.h"
+#include "profiler.h"
+#include "json_writer.h"
+#include <algorithm>
+
+static constexpr double target_ms = 20.0; //each benchmark runs about this long after calibration
+static volatile int sink = 0; //results land here so the optimizer keeps the work
+#if defined(ZEAL_PGO_INSTRUMENT)
+static const char* build_flavor = "pginstrument";
+#include <pgobootrun.h> //PgoAutoSweep is PgoAutoSweepA or W by the character set, linked from pgobootrun.lib
+#elif defined(ZEAL_PGO_OPTIMIZE)
+static const char* build_flavor = "pgoptimize";
+#elif defined(_DEBUG)
+static const char* build_flavor = "debug";
+#else
+static const char* build_flavor = "release";
+#endif
+
+void Benchmark::build_fixture()
+{
+	if (!fixture.empty())
+		return;
+	fixture.build_inventory();
+	fixture.build_zone(500);
+	fixture.build_raid(72);
+}
+
+// the client's own handlers never see the trace, so its packets and keys only exercise zeal's side of each frame
+void Benchmark::run_trace()
+{
+	ZealService* zeal = ZealService::get_instance();
+	std::vector<capture_event> events;
+	if (!zeal->packet_capture || !zeal->packet_capture->load(events))
+	{
+		Zeal::EqGame::print_chat("Nothing to run in %s, record one with /capture frames", zeal->packet_capture ? zeal->packet_capture->file_name().c_str() : "the capture file");
+		return;
+	}
+	build_fixture();
+	bool profiling = Zeal::Profiler::enabled;
+	Zeal::Profiler::set_enabled(true);
+	Zeal::Profiler::reset();
+	std::vector<double> frame_ms;
+	UINT counts[capture_frame + 1] = {};
+	replay(events, frame_ms, counts);
+	std::sort(frame_ms.begin(), frame_ms.end());
+	double total = 0;
+	for (double ms : frame_ms)
+		total += ms;
+	Zeal::EqGame::print_chat("Trace: %u frames, %u packets, %u keys, %u mouse, %u chat", (UINT)frame_ms.size(), counts[capture_received] + counts[capture_sent],
+		counts[capture_key], counts[capture_mouse], counts[capture_chat]);
+	Zeal::EqGame::print_chat("Frame cpu ms: avg %.4f, p50 %.4f, p99 %.4f, max %.4f", total / frame_ms.size(), frame_ms[frame_ms.size() / 2],
+		frame_ms[static_cast<size_t>(frame_ms.size() * 0.99)], frame_ms.back());
+	for (const std::string& line : Zeal::Profiler::report(8))
+		Zeal::EqGame::print_chat("%s", line.c_str());
+	Zeal::Profiler::set_enabled(profiling);
+	record_trace(total / frame_ms.size(), frame_ms[frame_ms.size() / 2], frame_ms[static_cast<size_t>(frame_ms.size() * 0.99)]);
+}
+
+void Benchmark::replay(const std::vector<capture_event>& events, std::vector<double>& frame_ms, UINT* counts)
+{
+	ZealService* zeal = ZealService::get_instance();
+	LARGE_INTEGER frequency;
+	QueryPerformanceFrequency(&frequency);
+	GameFixture::scope redirected(fixture);
+	size_t i = 0;
+	while (i < events.size())
+	{
+		LARGE_INTEGER start, end;
+		QueryPerformanceCounter(&start);
+		for (; i < events.size() && events[i].kind != capture_frame; i++)
+		{
+			const capture_event& event = events[i];
+			if (event.kind <= capture_frame)
+				counts[event.kind]++;
+			if (event.kind == capture_chat)
+			{
+				std::string text(event.payload.begin(), event.payload.end());
+				if (zeal->session_stats)
+					zeal->session_stats->note_chat(text.c_str());
+				zeal->guild_roster->note_chat(text.c_str());
+			}
+			else
+				zeal->packet_capture->deliver(event);
+		}
+		i++; //past the frame marker
+		QueryPerformanceCounter(&end);
+		frame_ms.push_back((end.QuadPart - start.QuadPart) * 1000.0 / frequency.QuadPart);
+	}
+}
+
+// one line per trace run, so two builds replaying the same capture can be compared
+void Benchmark::record_trace(double avg_ms, double p50_ms, double p99_ms)
+{
+	static const char* path = "Logs\\zealbench_trace.txt";
+	char flavor[32] = {};
+	double last_avg = 0, last_p50 = 0, last_p99 = 0;
+	if (FILE* file = fopen(path, "r"))
+	{
+		char line_flavor[32];
+		double avg, p50, p99;
+		while (fscanf(file, "%31s %lf %lf %lf", line_flavor, &avg, &p50, &p99) == 4)
+		{
+			if (!strcmp(line_flavor, build_flavor))
+				continue;
+			strcpy_s(flavor, line_flavor);
+			last_avg = avg;
+			last_p50 = p50;
+			last_p99 = p99;
+		}
+		fclose(file);
+	}
+	CreateDirectoryA("Logs", NULL);
+	if (FILE* file = fopen(path, "a"))
+	{
+		fprintf(file, "%s %.5f %.5f %.5f\n", build_flavor, avg_ms, p50_ms, p99_ms);
+		fclose(file);
+	}
+	auto delta = [](double now, double before) { return before > 0 ? (now - before) * 100.0 / before : 0.0; };
+	if (flavor[0])
+		Zeal::EqGame::print_chat("Against the last %s build: avg %+.1f%%, p50 %+.1f%%, p99 %+.1f%%", flavor, delta(avg_ms, last_avg), delta(p50_ms, last_p50),
+			delta(p99_ms, last_p99));
+}
+
+// the same fixture, benchmarks and capture every time, so two training runs give the same profile whatever the session did
+void Benchmark::train(int rounds)
+{
+	ZealService* zeal = ZealService::get_instance();
+	build_fixture();
+	std::vector<capture_event> events;
+	bool have_trace = zeal->packet_capture && zeal->packet_capture->load(events);
+	for (int round = 0; round < rounds; round++)
+	{
+		for (entry& bench : entries)
+		{
+			std::unique_ptr<GameFixture::scope> redirected = bench.fixture ? std::make_unique<GameFixture::scope>(fixture) : nullptr;
+			for (int i = 0; i < 2000; i++)
+				bench.op();
+		}
+		if (have_trace)
+		{
+			std::vector<double> frame_ms;
+			UINT counts[capture_frame + 1] = {};
+			replay(events, frame_ms, counts);
+		}
+	}
+#ifdef ZEAL_PGO_INSTRUMENT
+	PgoAutoSweep(TEXT("train")); //counts so far go to Zeal!train<n>.pgc next to the .pgd, the PGOptimize link merges them
+	Zeal::EqGame::print_chat("Trained %i rounds %s, relink with the PGOptimize configuration", rounds, have_trace ? "with the capture" : "without a capture");
+#else
+	Zeal::EqGame::print_chat("Ran %i training rounds, only the PGInstrument build records a profile", rounds);
+#endif
+}
+
+void Benchmark::run(const std::string& filter)
+{
+	LARGE_INTEGER frequency;
+	QueryPerformanceFrequency(&frequency);
+	double ms_per_tick = 1000.0 / frequency.QuadPart;
+	int ran = 0;
+	for (entry& bench : entries)
+	{
+		if (!filter.empty() && bench.name.find(filter) == std::string::npos)
+			continue;
+		ran++;
+		if (bench.fixture)
+			build_fixture();
+		std::unique_ptr<GameFixture::scope> redirected = bench.fixture ? std::make_unique<GameFixture::scope>(fixture) : nullptr;
+		// double the batch until it takes long enough to time, then time one batch of the target length
+		bench.op();
+		LONGLONG iterations = 1;
+		double elapsed_ms = 0;
+		LARGE_INTEGER start, end;
+		while (true)
+		{
+			QueryPerformanceCounter(&start);
+			for (LONGLONG i = 0; i < iterations; i++)
+				bench.op();
+			QueryPerformanceCounter(&end);
+			elapsed_ms = (end.QuadPart - start.QuadPart) * ms_per_tick;
+			if (elapsed_ms > 1.0 || iterations >= (1ll << 30))
+				break;
+			iterations *= 2;
+		}
+		iterations = static_cast<LONGLONG>(iterations * (target_ms / elapsed_ms));
+		if (iterations < 1)
+			iterations = 1;
+		size_t allocations = Zeal::Memory::allocations();
+		QueryPerformanceCounter(&start);
+		for (LONGLONG i = 0; i < iterations; i++)
+			bench.op();
+		QueryPerformanceCounter(&end);
+		double allocs = static_cast<double>(Zeal::Memory::allocations() - allocations) / iterations; //other threads' allocations land in here too
+		double ns = (end.QuadPart - start.QuadPart) * ms_per_tick * 1000000.0 / iterations;
+		redirected.reset(); //the result goes to the real chat window
+		Zeal::EqGame::print_chat("%-28s %10.1f ns/op %8.2f allocs/op", bench.name.c_str(), ns, allocs);
+	}
+	if (!ran)
+		Zeal::EqGame::print_chat("No benchmark matches %s", filter.c_str());
+}
+
+Benchmark::Benchmark(ZealService* zeal)
+{
+	static const std::string command_line = "/fps bg 20 with a few more words";
+	static const std::string mixed_case = "ThisIsAMixedCaseWord";
+	static const std::string lower_case = "thisisamixedcaseword";
+	entries.push_back({ "string.split", []() { sink += static_cast<int>(Zeal::String::split(command_line, " ").size()); } });
+	entries.push_back({ "string.tokenize", []() {
+		Zeal::String::token_list tokens;
+		Zeal::String::tokenize(command_line, ' ', tokens);
+		sink += static_cast<int>(tokens.size());
+	} });
+	entries.push_back({ "string.compare_insensitive", []() { sink += Zeal::String::compare_insensitive(mixed_case, lower_case); } });
+	entries.push_back({ "string.parse_int", []() { int value = 0; Zeal::String::parse("123456", value); sink += value; } });
+	entries.push_back({ "string.parse_float", []() { float value = 0; Zeal::String::parse("1234.5", value); sink += static_cast<int>(value); } });
+	entries.push_back({ "camera.cam_pos_behind", []() {
+		static float yaw = 0;
+		yaw += 1.f;
+		Vec3 pos = camera_math::get_cam_pos_behind(Vec3(10.f, 20.f, 30.f), 25.f, yaw, 10.f);
+		sink += static_cast<int>(pos.x);
+	} });
+	entries.push_back({ "camera.angle_difference", []() { sink += static_cast<int>(camera_math::angle_difference(10.f, 500.f)); } });
+	entries.push_back({ "vectors.dot", []() {
+		static Vec3 a(1.f, 2.f, 3.f);
+		a.x += 0.5f;
+		sink += static_cast<int>(a.DotProduct(Vec3(4.f, 5.f, 6.f)));
+	} });
+	entries.push_back({ "pipe.serialize_label", []() {
+		pipe_data data(pipe_data_type::label, "[{\"type\":1,\"value\":\"Soandso\"}]", "Character");
+		sink += static_cast<int>(data.serialize().dump(-1, ' ', false, nlohmann::json::error_handler_t::replace).size());
+	} });
+	entries.push_back({ "pipe.write_labels", []() {
+		static std::string out;
+		static const std::string value = "Soandso";
+		out.clear();
+		json_writer labels(out);
+		labels.begin_array();
+		for (int id = 0; id < 8; id++)
+			labels.begin_object().field("type", id).field("value", value).end_object();
+		labels.end_array();
+		sink += static_cast<int>(out.size());
+	} });
+	entries.push_back({ "commands.find", [zeal]() { sink += zeal->commands_hook->find("/FPS") != nullptr; } });
+	entries.push_back({ "spells.category", []() {
+		static DWORD spell = 0;
+		spell = (spell + 7) % 4000;
+		sink += static_cast<int>(GetSpellCategory(spell));
+	} });
+	entries.push_back({ "ini.get_value", [zeal]() { sink += zeal->ini->getValue<int>("Zeal", "FpsLimit"); } });
+	entries.push_back({ "fixture.entity_by_id", []() {
+		static WORD id = 0;
+		id = id % 500 + 1;
+		sink += Zeal::EqGame::get_entity_by_id(id) != nullptr;
+	}, true });
+	entries.push_back({ "fixture.query_radius", [zeal]() {
+		static std::vector<Zeal::EqStructures::Entity*> found;
+		zeal->entity_manager->query_radius(Vec3(0.f, 0.f, 0.f), 300.f, found);
+		sink += static_cast<int>(found.size());
+	}, true });
+	entries.push_back({ "fixture.query_nearest", [zeal]() {
+		static std::vector<Zeal::EqStructures::Entity*> found;
+		zeal->entity_manager->query_nearest(Vec3(0.f, 0.f, 0.f), 10, 500.f, found);
+		sink += static_cast<int>(found.size());
+	}, true });
+	entries.push_back({ "fixture.raid_list", []() { sink += static_cast<int>(Zeal::EqGame::get_raid_list().size()); }, true });
+	entries.push_back({ "fixture.raid_rebuild", [zeal]() {
+		zeal->raid_hook->invalidate();
+		sink += static_cast<int>(zeal->raid_hook->get_roster().size());
+	}, true });
+	entries.push_back({ "fixture.inventory_scan", []() {
+		Zeal::EqStructures::EQCHARINFO* info = Zeal::EqGame::get_char_info();
+		int count = 0;
+		for (int slot = 0; info && slot < EQ_NUM_INVENTORY_SLOTS; slot++)
+			if (Zeal::EqStructures::EQITEMINFO* item = info->InventoryItem[slot])
+				count += item->Name[0] != '\0';
+		sink += count;
+	}, true });
+	zeal->commands_hook->add("/zealbench", {}, "Times zeal's pure logic hot paths, /zealbench <name filter> for a subset, /zealbench trace to run a /capture frames recording, "
+		"/zealbench train [rounds] for the profile guided build.",
+		[this](std::vector<std::string>& args) {
+			int rounds = 20;
+			if (args.size() > 1 && Zeal::String::compare_insensitive(args[1], "trace"))
+				run_trace();
+			else if (args.size() > 1 && Zeal::String::compare_insensitive(args[1], "train"))
+				train(args.size() > 2 && Zeal::String::tryParse(args[2], &rounds) && rounds > 0 ? rounds : 20);
+			else
+				run(args.size() > 1 ? args[1] : "");
+			return true;
+		});
+}
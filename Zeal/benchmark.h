@@ -0,0 +1,33 @@
+#pragma once
+#include <functional>
+#include <string>
+#include <vector>
+#include "game_fixture.h"
+#include "packet_capture.h"
+
+// /zealbench times zeal's pure logic hot paths inside the client, ns and zeal heap allocations per op. meant for before and
+// after numbers on a change, not for a live session. the fixture.* entries run against a fabricated 500 spawn zone, 72
+// member raid and full inventory instead of the live game. /zealbench trace feeds a /capture frames recording to zeal's
+// callbacks frame by frame inside the fixture and reports the frame times and the heaviest callbacks, each trace run is
+// logged with the build it ran on and compared with the last run of another build. /zealbench train is the training run
+// for the PGInstrument configuration
+class Benchmark
+{
+public:
+	Benchmark(class ZealService* zeal);
+	void run(const std::string& filter);
+	void run_trace();
+	void train(int rounds);
+private:
+	void replay(const std::vector<capture_event>& events, std::vector<double>& frame_ms, UINT* counts); //inside the fixture
+	void record_trace(double avg_ms, double p50_ms, double p99_ms);
+	struct entry
+	{
+		std::string name;
+		std::function<void()> op;
+		bool fixture = false;
+	};
+	void build_fixture();
+	std::vector<entry> entries;
+	GameFixture fixture;
+};
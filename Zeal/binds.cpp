@@ -3,26 +3,28 @@
 #include "EqAddresses.h"
 #include "EqFunctions.h"
 #include "Zeal.h"
+#include "string_util.h"
+#include <algorithm>
 Binds::~Binds()
 {
 }
 
 bool Binds::execute_cmd(UINT cmd, bool isdown)
 {
-    ZealService* zeal = ZealService::get_instance();
+    if (cmd >= max_cmd)
+        return false;
+    auto& replacements = ReplacementFunctions[cmd];
+    auto& bind = KeyMapFunctions[cmd];
+    if (replacements.empty() && !bind) //most commands have nothing attached, skip the input check too
+        return false;
     if (!Zeal::EqGame::game_wants_input() || !isdown) //checks if the game wants keyboard input... don't call our binds when the game wants input
     {
-        if (zeal->binds_hook->ReplacementFunctions.count(cmd) > 0)
-        {
-            for (auto& fn : zeal->binds_hook->ReplacementFunctions[cmd])
-                if (fn(isdown)) //if the replacement function returns true, end here otherwise its really just adding more to the command 
-                    return true;
-        }
+        for (auto& fn : replacements)
+            if (fn(isdown)) //if the replacement function returns true, end here otherwise its really just adding more to the command 
+                return true;
 
-        if (zeal->binds_hook->KeyMapFunctions.count(cmd) > 0)
-            zeal->binds_hook->KeyMapFunctions[cmd](isdown);
-        else
-            return false;
+        if (bind)
+            bind(isdown);
     }
 
     return false;
@@ -34,39 +36,41 @@ void __fastcall InitKeyboardAssignments(int t, int unused)
     zeal->binds_hook->ptr_binds = t;
     zeal->binds_hook->add_binds();
     zeal->binds_hook->read_ini();
-    zeal->hooks->hook_map["initbinds"]->original(InitKeyboardAssignments)(t, unused);
+    hook_ref<InitKeyboardAssignments>::original()(t, unused);
 }
 
-UINT32 read_internal_from_ini(int index, int key_type)
+static std::string upper(std::string text)
 {
-    int fn = 0x525520;
-    __asm
-    {
-        push key_type
-        push index
-        call fn
-        pop ecx
-        pop ecx
-    }
+    std::transform(text.begin(), text.end(), text.begin(), [](unsigned char c) { return static_cast<char>(toupper(c)); });
+    return text;
 }
 
+// the client's read_internal_from_ini (0x525520) goes to the disk through GetPrivateProfileInt for every key, this reads
+// the cached [KeyMaps] section once into a table and applies all of zeal's binds from it
 void Binds::read_ini()
 {
+    ZealService* zeal = ZealService::get_instance();
+    zeal->ini->flush(true); //picks up keys the options window wrote since the cache was loaded
+    std::unordered_map<std::string, int> keycodes;
+    for (const auto& [key, value] : zeal->ini->getSection("KeyMaps"))
+    {
+        int keycode = 0;
+        if (Zeal::String::parse(value, keycode))
+            keycodes[upper(key)] = keycode;
+    }
+    char key[96];
     int size = sizeof(KeyMapNames) / sizeof(KeyMapNames[0]);
     for (int i = 128; i < size; i++) //the game will load its own properly
     {
-        if (KeyMapNames[i]) //check if its not nullptr
+        if (!KeyMapNames[i]) //no bind registered at this index
+            continue;
+        int* maps[2] = { Zeal::EqGame::ptr_PrimaryKeyMap, Zeal::EqGame::ptr_AlternateKeyMap };
+        for (int key_type = 0; key_type < 2; key_type++)
         {
-            int keycode = read_internal_from_ini(i, 0);
-            int keycode_alt = read_internal_from_ini(i, 1);
-            if (keycode != -0x2)
-            {
-                Zeal::EqGame::ptr_PrimaryKeyMap[i] = keycode;
-            }
-            if (keycode_alt != -0x2)
-            {
-                Zeal::EqGame::ptr_AlternateKeyMap[i] = keycode_alt;
-            }
+            snprintf(key, sizeof(key), "KEYMAPPING_%s_%d", KeyMapNames[i], key_type + 1);
+            auto it = keycodes.find(upper(key));
+            if (it != keycodes.end() && it->second != -0x2)
+                maps[key_type][i] = it->second;
         }
     }
 }
@@ -288,6 +292,10 @@ void Binds::add_binds()
             ZealService::get_instance()->autofire->SetAutoFire(!ZealService::get_instance()->autofire->autofire);
         }
         });
+    add_bind(230, "Screenshot", "ZealScreenshot", key_category::Commands, [](int key_down) {
+        if (key_down && ZealService::get_instance()->screenshot)
+            ZealService::get_instance()->screenshot->request();
+        });
     add_bind(251, "Target Nearest NPC Corpse", "TargetNPCCorpse", key_category::Target, [](int key_down) {
         if (key_down && !Zeal::EqGame::EqGameInternal::UI_ChatInputCheck())
         {
@@ -351,12 +359,14 @@ void Binds::add_bind(int cmd, const char* name, const char* short_name, int cate
         return;
     Zeal::EqGame::EqGameInternal::InitKeyBindStr((options + cmd * 0x8 + 0x20c), 0, (char*)name);
     *(int*)((options + cmd * 0x8 + 0x210)) = category;
-    KeyMapFunctions[cmd] = callback;
+    if (cmd >= 0 && cmd < (int)max_cmd)
+        KeyMapFunctions[cmd] = callback;
 }
 
 void Binds::replace_cmd(int cmd, std::function<bool(int state)> callback)
 {
-    ReplacementFunctions[cmd].push_back(callback);
+    if (cmd >= 0 && cmd < (int)max_cmd)
+        ReplacementFunctions[cmd].push_back(callback);
 }
 
 void Binds::main_loop()
@@ -387,5 +397,5 @@ Binds::Binds(ZealService* zeal)
     mem::write(0x42C52F, (byte)0xEB); //remove the check for max index of 116 being stored in client ini
     mem::write(0x52485A, (int)256); //increase this for loop to look through all 256
     mem::write(0x52591C, (int)(Zeal::EqGame::ptr_AlternateKeyMap + (256 * 4))); //fix another for loop to loop through all 256
-    zeal->hooks->Add("initbinds", Zeal::EqGame::EqGameInternal::fn_initkeyboardassignments, InitKeyboardAssignments, hook_type_detour);
+    zeal->hooks->Add<InitKeyboardAssignments>("initbinds", Zeal::EqGame::EqGameInternal::fn_initkeyboardassignments, hook_type_detour);
 }
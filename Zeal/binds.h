@@ -23,8 +23,9 @@ public:
 	~Binds();
 	char* KeyMapNames[256] = { 0 };
 	int ptr_binds = 0;
-	std::unordered_map<int, std::function<void(int state)>> KeyMapFunctions;
-	std::unordered_map<int, std::vector<std::function<bool(int state)>>> ReplacementFunctions;
+	static constexpr UINT max_cmd = 256; //same bound as KeyMapNames, dispatch indexes these directly
+	std::function<void(int state)> KeyMapFunctions[max_cmd];
+	std::vector<std::function<bool(int state)>> ReplacementFunctions[max_cmd];
 	std::pair<int, int> last_targets;
 	void read_ini();
 	void add_binds();
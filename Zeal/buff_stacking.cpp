@@ -0,0 +1,255 @@
+#include "buff_stacking.h"
+#include "Zeal.h"
+#include "EqFunctions.h"
+#include "string_util.h"
+#include <algorithm>
+
+namespace
+{
+	constexpr BYTE effect_blank = 254;
+	constexpr BYTE effect_charisma = 10; //zero charisma pads the unused slots of older spells
+	constexpr BYTE effect_stacking_block = 148; //base is the effect, max the value, calc - 201 the slot
+	constexpr BYTE effect_stacking_overwrite = 149;
+	constexpr BYTE target_self = 0x06;
+	constexpr BYTE target_group_v1 = 0x03;
+	constexpr BYTE target_group_v2 = 0x29;
+	constexpr BYTE target_pet = 0x0e;
+	constexpr WORD empty_buff = USHRT_MAX;
+}
+
+static UINT64 key_bit(int slot, int effect)
+{
+	return 1ull << ((effect * 12 + slot) & 63);
+}
+
+void BuffStacking::build()
+{
+	SpellIndex* index = ZealService::get_instance()->spell_index.get();
+	if (!index->size())
+		return;
+	ZEAL_PROFILE_SCOPE("buff stacking build");
+	profiles.assign(SpellIndex::max_spells, spell_profile());
+	for (int id = 0; id < SpellIndex::max_spells; ++id)
+	{
+		Zeal::EqStructures::SPELL* spell = index->get(id);
+		if (!spell)
+			continue;
+		spell_profile& p = profiles[id];
+		p.buff = spell->DurationType || spell->DurationValue1;
+		p.beneficial = spell->SpellType != 0;
+		for (int slot = 0; slot < effect_slots; ++slot)
+		{
+			BYTE effect = spell->Attrib[slot];
+			short base = spell->Base[slot], max = spell->Max[slot];
+			if (effect == effect_blank || effect == 255 || (effect == effect_charisma && !base))
+				effect = effect_blank;
+			p.effect[slot] = effect;
+			p.value[slot] = static_cast<short>(std::max(std::abs(base), std::abs(max)));
+			if (effect == effect_blank)
+				continue;
+			if (effect == effect_stacking_block || effect == effect_stacking_overwrite)
+			{
+				int covered = spell->Calc[slot] - 201;
+				if (effect == effect_stacking_block && covered >= 0 && covered < effect_slots && base >= 0 && base < effect_blank && p.block_count < p.blocks.size())
+				{
+					p.blocks[p.block_count++] = { static_cast<BYTE>(covered), static_cast<BYTE>(base), max };
+					p.block_keys |= key_bit(covered, base);
+				}
+				p.effect[slot] = effect_blank; //the command itself never conflicts
+				continue;
+			}
+			p.keys |= key_bit(slot, effect);
+		}
+	}
+	pairs.clear();
+	self_verdicts.clear();
+	built = true;
+}
+
+bool BuffStacking::ensure()
+{
+	if (!built)
+		build();
+	return built;
+}
+
+// a is the incoming spell, b the one already on the target
+buff_fit BuffStacking::compare(const spell_profile& a, const spell_profile& b) const
+{
+	if (b.block_keys & a.keys)
+	{
+		for (int i = 0; i < b.block_count; ++i)
+		{
+			const blocker& block = b.blocks[i];
+			if (a.effect[block.slot] == block.effect && a.value[block.slot] < std::abs(block.below))
+				return buff_fit::blocked;
+		}
+	}
+	if (!(a.keys & b.keys) || a.beneficial != b.beneficial)
+		return buff_fit::lands; //a buff and a debuff sit side by side
+	buff_fit fit = buff_fit::lands;
+	for (int slot = 0; slot < effect_slots; ++slot)
+	{
+		if (a.effect[slot] == effect_blank || a.effect[slot] != b.effect[slot])
+			continue;
+		if (a.value[slot] < b.value[slot])
+			return buff_fit::blocked;
+		fit = buff_fit::overwrites;
+	}
+	return fit;
+}
+
+buff_fit BuffStacking::pair(WORD incoming, WORD existing)
+{
+	if (incoming >= profiles.size() || existing >= profiles.size())
+		return buff_fit::lands;
+	UINT32 key = (static_cast<UINT32>(incoming) << 16) | existing;
+	auto it = pairs.find(key);
+	if (it != pairs.end())
+		return it->second;
+	buff_fit fit = compare(profiles[incoming], profiles[existing]);
+	pairs.emplace(key, fit);
+	return fit;
+}
+
+buff_verdict BuffStacking::evaluate(WORD spell_id, const Zeal::EqStructures::_EQBUFFINFO* buffs, int count, int caster_level)
+{
+	if (!ensure() || spell_id >= profiles.size())
+		return { buff_fit::unknown, -1 };
+	if (!profiles[spell_id].buff)
+		return { buff_fit::lands, -1 }; //instant, nothing to hold
+	int overwritten = -1;
+	bool free_slot = false;
+	for (int i = 0; i < count; ++i)
+	{
+		WORD existing = buffs[i].SpellId;
+		if (existing == empty_buff || existing >= profiles.size())
+		{
+			free_slot = true;
+			continue;
+		}
+		if (existing == spell_id)
+		{
+			if (buffs[i].CasterLevel > caster_level)
+				return { buff_fit::blocked, i }; //the same buff from a higher level caster
+			if (overwritten < 0)
+				overwritten = i;
+			continue;
+		}
+		buff_fit fit = pair(spell_id, existing);
+		if (fit == buff_fit::blocked)
+			return { buff_fit::blocked, i };
+		if (fit == buff_fit::overwrites && overwritten < 0)
+			overwritten = i;
+	}
+	if (overwritten >= 0)
+		return { buff_fit::overwrites, overwritten };
+	return { free_slot ? buff_fit::lands : buff_fit::blocked, -1 };
+}
+
+buff_verdict BuffStacking::will_land(WORD spell_id, Zeal::EqStructures::Entity* target)
+{
+	Zeal::EqStructures::Entity* self = Zeal::EqGame::get_self();
+	if (!target)
+		target = self;
+	if (!self || target != self || !self->CharInfo)
+		return { buff_fit::unknown, -1 };
+	UINT version = ZealService::get_instance()->buff_timers->version();
+	if (version != self_version || self->Level != self_level)
+	{
+		self_verdicts.clear();
+		self_version = version;
+		self_level = self->Level;
+	}
+	auto it = self_verdicts.find(spell_id);
+	if (it != self_verdicts.end())
+		return it->second;
+	buff_verdict verdict = evaluate(spell_id, self->CharInfo->Buff, EQ_NUM_BUFFS, self->Level);
+	if (verdict.fit != buff_fit::unknown)
+		self_verdicts.emplace(spell_id, verdict);
+	return verdict;
+}
+
+buff_verdict BuffStacking::will_land(WORD spell_id)
+{
+	Zeal::EqStructures::SPELL* spell = ZealService::get_instance()->spell_index->get(spell_id);
+	if (!spell)
+		return { buff_fit::unknown, -1 };
+	Zeal::EqStructures::Entity* self = Zeal::EqGame::get_self();
+	switch (spell->TargetType)
+	{
+	case target_self:
+	case target_group_v1:
+	case target_group_v2: //the caster is one of those it lands on
+		return will_land(spell_id, self);
+	case target_pet:
+	{
+		Zeal::EqStructures::Entity* pet = self ? ZealService::get_instance()->pet_tracker->pet(self->SpawnId) : nullptr;
+		return pet ? will_land(spell_id, pet) : buff_verdict();
+	}
+	default:
+		return will_land(spell_id, Zeal::EqGame::get_target());
+	}
+}
+
+const char* BuffStacking::name(buff_fit fit)
+{
+	static const char* names[] = { "lands", "overwrites", "blocked", "unknown" };
+	return names[static_cast<int>(fit)];
+}
+
+BuffStacking::BuffStacking(ZealService* zeal)
+{
+	zeal->callbacks->add_generic([this]() { ZealService::get_instance()->fast_login->defer([this]() { ensure(); }); }, callback_type::InitUI); //after the spell index, it registered first
+	zeal->labels_hook->add_label(83, "CastingStacks", { [this](label_value& value) {
+		CastTracker* cast = ZealService::get_instance()->cast_tracker.get();
+		buff_verdict verdict = cast->casting() ? will_land(cast->spell_id()) : buff_verdict();
+		value.write_text = true;
+		if (verdict.fit != buff_fit::blocked)
+		{
+			value.text.clear();
+			return;
+		}
+		value.text = "Will not take hold";
+		value.override_color = true;
+		value.color = 0xffff4040;
+	}, []() {
+		CastTracker* cast = ZealService::get_instance()->cast_tracker.get();
+		Zeal::EqStructures::Entity* target = Zeal::EqGame::get_target();
+		return ((UINT64)cast->spell_id() << 48) | ((UINT64)(target ? target->SpawnId : 0) << 32) | ZealService::get_instance()->buff_timers->version();
+	} });
+	zeal->commands_hook->add("/stacks", {}, "Tells whether a buff would take hold on you, your pet or your target right now, /stacks <spell name>.",
+		[this](std::vector<std::string>& args) {
+			if (args.size() < 2)
+			{
+				Zeal::EqGame::print_chat("usage: /stacks <spell name>");
+				return true;
+			}
+			std::string spell_name = args[1];
+			for (size_t i = 2; i < args.size(); ++i)
+				spell_name += " " + args[i];
+			int spell_id = ZealService::get_instance()->spell_index->find(spell_name);
+			if (spell_id < 0)
+			{
+				Zeal::EqGame::print_chat("No spell named [%s]", spell_name.c_str());
+				return true;
+			}
+			buff_verdict verdict = will_land(static_cast<WORD>(spell_id));
+			Zeal::EqStructures::Entity* self = Zeal::EqGame::get_self();
+			Zeal::EqStructures::SPELL* other = nullptr;
+			if (verdict.slot >= 0 && self && self->CharInfo)
+				other = ZealService::get_instance()->spell_index->get(self->CharInfo->Buff[verdict.slot].SpellId);
+			if (other)
+				Zeal::EqGame::print_chat("[%s] %s, buff %i (%s)", spell_name.c_str(), name(verdict.fit), verdict.slot + 1, other->Name);
+			else
+				Zeal::EqGame::print_chat("[%s] %s", spell_name.c_str(), verdict.fit == buff_fit::blocked ? "blocked, no free buff slot" : name(verdict.fit));
+			return true;
+		});
+	zeal->memory_report->add("buff stacking", [this]() {
+		return Zeal::Memory::usage{ Zeal::Memory::vector_bytes(profiles) + Zeal::Memory::hash_bytes(pairs) + Zeal::Memory::hash_bytes(self_verdicts), pairs.size() };
+	});
+}
+
+BuffStacking::~BuffStacking()
+{
+}
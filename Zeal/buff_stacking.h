@@ -0,0 +1,66 @@
+#pragma once
+#include <Windows.h>
+#include <array>
+#include <string>
+#include <unordered_map>
+#include <vector>
+#include "EqStructures.h"
+
+enum class buff_fit : UINT8
+{
+	lands, //a free slot, nothing in the way
+	overwrites, //replaces or refreshes the buff in slot
+	blocked, //a stronger buff in slot holds, or every slot is taken
+	unknown //the target's buffs aren't visible to the client
+};
+
+struct buff_verdict
+{
+	buff_fit fit = buff_fit::unknown;
+	int slot = -1; //the buff overwritten or in the way, -1 for none
+};
+
+// whether a buff will take hold, from the spell effects in each of the twelve effect slots: two buffs with the same
+// effect in the same slot conflict and the stronger one stays, a stacking blocker (effect 148) keeps weaker versions of
+// an effect out. every spell's effects are compacted into a profile once per spell load, pair answers are memoized
+// and the answer for the player's own buffs is kept until the buff timers see a change
+class BuffStacking
+{
+public:
+	buff_verdict evaluate(WORD spell_id, const Zeal::EqStructures::_EQBUFFINFO* buffs, int count, int caster_level);
+	buff_verdict will_land(WORD spell_id, Zeal::EqStructures::Entity* target); //unknown for anyone but yourself
+	buff_verdict will_land(WORD spell_id); //on whoever the spell would go to right now
+	static const char* name(buff_fit fit);
+	void warm() { ensure(); }
+	BuffStacking(class ZealService* zeal);
+	~BuffStacking();
+private:
+	static constexpr int effect_slots = 12;
+	struct blocker
+	{
+		BYTE slot;
+		BYTE effect;
+		short below; //keeps out that effect in that slot when weaker than this
+	};
+	struct spell_profile
+	{
+		std::array<BYTE, effect_slots> effect; //blank for unused slots
+		std::array<short, effect_slots> value; //the larger magnitude of base and max
+		UINT64 keys = 0; //one bit per (slot, effect) hash, disjoint keys can't conflict
+		UINT64 block_keys = 0; //the (slot, effect) pairs a stacking blocker covers
+		std::array<blocker, 4> blocks;
+		BYTE block_count = 0;
+		bool buff = false; //has a duration
+		bool beneficial = false;
+	};
+	void build();
+	bool ensure();
+	buff_fit pair(WORD incoming, WORD existing); //lands, overwrites or blocked
+	buff_fit compare(const spell_profile& a, const spell_profile& b) const;
+	std::vector<spell_profile> profiles; //by spell id, empty until the spells are loaded
+	std::unordered_map<UINT32, buff_fit> pairs;
+	std::unordered_map<WORD, buff_verdict> self_verdicts;
+	UINT self_version = 0; //the buff timers version the self verdicts were made against
+	int self_level = 0;
+	bool built = false;
+};
@@ -1,49 +1,115 @@
 #include "buff_timers.h"
 #include "Zeal.h"
 
-BuffDetails::BuffDetails(size_t index, Zeal::EqStructures::_EQBUFFINFO info) :
-  BuffSlot(index), Buff(info)
+static constexpr ULONGLONG tick_ms = 6000; //one buff tick
+
+static const char* spell_name(WORD spell_id)
 {
+  Zeal::EqStructures::SPELL* spell = ZealService::get_instance()->spell_index->get(spell_id);
+  return spell && spell->Name ? spell->Name : "Unknown";
 }
 
-// An improvement we could have would be having a pointer/hook to the function that provides
-// the spell name based on the spell id.
-void BuffTimers::print_timers(void) {
-  std::vector<BuffDetails> activeBuffs;
-  std::ostringstream oss;
-
-  auto CharInfo = Zeal::EqGame::get_self()->CharInfo;
+// the buff array only changes when the server updates it, so a cheap periodic read stands in for the buff packets:
+// a slot whose spell changed or whose ticks left the predicted value by more than a tick (a refresh) gets a new expiry
+void BuffTimers::snapshot()
+{
+  Zeal::EqStructures::Entity* self = Zeal::EqGame::get_self();
+  if (!Zeal::EqGame::is_in_game() || !self || !self->CharInfo)
+    return;
+  ULONGLONG now = GetTickCount64();
+  bool changed = false;
+  bool expiring = false;
+  int warn_ms = warn_seconds.get() * 1000;
   for (size_t i = 0; i < EQ_NUM_BUFFS; ++i) {
-    WORD BuffId = CharInfo->Buff[i].SpellId;
-    if (BuffId != USHRT_MAX) {
-      activeBuffs.push_back(BuffDetails({ i, CharInfo->Buff[i] }));
+    const Zeal::EqStructures::_EQBUFFINFO& info = self->CharInfo->Buff[i];
+    tracked_buff& buff = buffs[i];
+    if (info.SpellId != buff.spell_id) {
+      buff.spell_id = info.SpellId;
+      buff.ticks = info.Ticks;
+      buff.expires = now + info.Ticks * tick_ms;
+      buff.warned = false;
+      changed = true;
+      continue;
+    }
+    if (buff.empty() || info.Ticks == buff.ticks)
+      continue;
+    buff.ticks = info.Ticks;
+    ULONGLONG left = buff.expires > now ? buff.expires - now : 0;
+    LONGLONG predicted = static_cast<LONGLONG>((left + tick_ms - 1) / tick_ms);
+    if (info.Ticks > predicted + 1 || info.Ticks + 1 < predicted) {
+      buff.expires = now + info.Ticks * tick_ms;
+      buff.warned = false;
+      changed = true;
     }
   }
-
-  oss << "[Buffs] ";
-  if (activeBuffs.size() != 0) {
-    for (size_t i = 0; i <  activeBuffs.size(); ++i) {
-      BuffDetails details = activeBuffs[i];
-      if (details.Buff.SpellId != USHRT_MAX) {
-        int Mins = ((details.Buff.Ticks) * 6) / 60;
-        int Secs = ((details.Buff.Ticks) * 6) % 60;
-
-        oss << "(" << details.BuffSlot + 1 << ")" << " " << Mins << "m" << Secs << "s";
-        if ((i+1) != activeBuffs.size()) { oss << ", "; }
-      }
+  if (warn_ms > 0) {
+    for (tracked_buff& buff : buffs) {
+      if (buff.empty() || buff.warned || buff.expires > now + warn_ms)
+        continue;
+      buff.warned = true;
+      expiring = true;
+      Zeal::EqGame::print_chat(USERCOLOR_SPELL_FAILURE, "[Buffs] %s fades in %llus", spell_name(buff.spell_id),
+        buff.expires > now ? (buff.expires - now) / 1000 : 0);
     }
   }
-  else
-  {
-    oss << "None";
+  if (expiring && ZealService::get_instance()->audio)
+    ZealService::get_instance()->audio->play(audio_cue::buff_fading); //once for however many faded together
+  if (changed)
+    changes++;
+  if (changed || expiring)
+    publish();
+}
+
+void BuffTimers::publish()
+{
+  named_pipe* pipe = ZealService::get_instance()->pipe.get();
+  if (!pipe)
+    return;
+  ULONGLONG now = GetTickCount64();
+  nlohmann::json list = nlohmann::json::array();
+  std::string payload;
+  UINT16 count = 0;
+  payload.append(reinterpret_cast<const char*>(&count), sizeof(count));
+  for (size_t i = 0; i < EQ_NUM_BUFFS; ++i) {
+    const tracked_buff& buff = buffs[i];
+    if (buff.empty())
+      continue;
+    pipe_buff_record record = { static_cast<UINT8>(i), buff.warned, buff.spell_id,
+      static_cast<INT32>(buff.expires > now ? buff.expires - now : 0) };
+    list.push_back({ {"slot", i + 1}, {"spell_id", buff.spell_id}, {"name", spell_name(buff.spell_id)},
+      {"remaining_ms", record.remaining_ms}, {"expiring", buff.warned} });
+    payload.append(reinterpret_cast<const char*>(&record), sizeof(record));
+    count++;
   }
-  oss << std::endl;
+  memcpy(&payload[0], &count, sizeof(count));
+  pipe->write(list.dump(-1, ' ', false, nlohmann::json::error_handler_t::replace), pipe_data_type::buff);
+  pipe->write_binary(pipe_data_type::buff, payload);
+}
 
-  Zeal::EqGame::print_chat(oss.str());
+void BuffTimers::print_timers(void) {
+  snapshot();
+  ULONGLONG now = GetTickCount64();
+  std::string text = "[Buffs] ";
+  bool any = false;
+  char part[96];
+  for (size_t i = 0; i < EQ_NUM_BUFFS; ++i) {
+    const tracked_buff& buff = buffs[i];
+    if (buff.empty())
+      continue;
+    ULONGLONG secs = buff.expires > now ? (buff.expires - now) / 1000 : 0;
+    snprintf(part, sizeof(part), "%s(%u) %llum%llus", any ? ", " : "", static_cast<unsigned>(i + 1), secs / 60, secs % 60);
+    text += part;
+    any = true;
+  }
+  if (!any)
+    text += "None";
+  Zeal::EqGame::print_chat(text);
 }
 
 BuffTimers::BuffTimers(ZealService* zeal)
 {
+  zeal->callbacks->add_work([this](int) { snapshot(); return false; }, 500);
+  zeal->callbacks->add_generic([this]() { buffs.fill(tracked_buff{}); changes++; }, callback_type::CharacterSelect);
   if (!Zeal::EqGame::is_new_ui()) {
     zeal->commands_hook->add("/buffs", {}, "Prints your buff timers (mostly useful for oldui).",
       [this](std::vector<std::string>& args) {
@@ -2,14 +2,17 @@
 #include "hook_wrapper.h"
 #include "memory.h"
 #include "EqStructures.h"
+#include "settings.h"
+#include <array>
 
-class BuffDetails
+// one entry per buff slot with an absolute expiry, so readers compute the time left instead of anything ticking it
+struct tracked_buff
 {
-public:
-  BuffDetails(size_t index, Zeal::EqStructures::_EQBUFFINFO buff);
-  ~BuffDetails() {};
-  size_t BuffSlot;
-  Zeal::EqStructures::_EQBUFFINFO Buff;
+  WORD spell_id = USHRT_MAX; //USHRT_MAX for an empty slot
+  WORD ticks = 0; //as last read from the buff array
+  ULONGLONG expires = 0; //GetTickCount64 time the buff fades
+  bool warned = false; //expiry soon already announced
+  bool empty() const { return spell_id == USHRT_MAX; }
 };
 
 class BuffTimers
@@ -17,6 +20,13 @@ class BuffTimers
 public:
   BuffTimers(class ZealService* zeal);
   ~BuffTimers() {};
+  const std::array<tracked_buff, EQ_NUM_BUFFS>& get() const { return buffs; }
+  UINT version() const { return changes; } //bumped whenever a slot starts, ends or is refreshed
+  Setting<int> warn_seconds{ "Zeal", "BuffWarnSeconds", 0 }; //announce buffs with less time left than this, 0 disables
 private:
+  void snapshot();
+  void publish();
   void print_timers(void);
+  std::array<tracked_buff, EQ_NUM_BUFFS> buffs;
+  UINT changes = 0;
 };
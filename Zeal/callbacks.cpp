@@ -3,6 +3,9 @@
 #include "EqAddresses.h"
 #include "EqFunctions.h"
 #include "Zeal.h"
+#include "string_util.h"
+#include <algorithm>
+extern "C" IMAGE_DOS_HEADER __ImageBase;
 CallbackManager::~CallbackManager()
 {
 
@@ -11,30 +14,58 @@ CallbackManager::~CallbackManager()
 void __fastcall main_loop_hk(int t, int unused)
 {
 	ZealService* zeal = ZealService::get_instance();
+	Zeal::Thread::set_game_thread();
+	Zeal::Frame::arena().reset(); //last frame's temporaries are gone by now
+	if (zeal->frame_pacer)
+		zeal->frame_pacer->pace(); //before the mark, the wait counts toward the previous frame like a vsync would
+	if (zeal->frame_profiler)
+		zeal->frame_profiler->mark(frame_phase::main_loop);
+	if (zeal->pipe)
+		zeal->pipe->run_commands(); //before the modules look at this frame's state
 	zeal->callbacks->invoke_generic(callback_type::MainLoop);
 	zeal->callbacks->invoke_delayed();
-	zeal->hooks->hook_map["MainLoop"]->original(main_loop_hk)(t, unused);
+	zeal->callbacks->invoke_work();
+	if (zeal->tasks)
+		zeal->tasks->drain_main();
+	hook_ref<main_loop_hk>::original()(t, unused);
 }
 
 void __fastcall render_hk(int t, int unused)
 {
 	ZealService* zeal = ZealService::get_instance();
-	zeal->hooks->hook_map["Render"]->original(render_hk)(t, unused);
+	if (zeal->frame_profiler)
+		zeal->frame_profiler->mark(frame_phase::render);
+	if (zeal->frame_pacer && zeal->frame_pacer->skip_render())
+		return; //idle box, the main loop still ran
+	if (zeal->input)
+		zeal->input->before_render();
+	hook_ref<render_hk>::original()(t, unused);
 	zeal->callbacks->invoke_generic(callback_type::Render);
 }
 
 void render_ui(int x)
 {
 	ZealService* zeal = ZealService::get_instance();
+	if (zeal->frame_profiler)
+		zeal->frame_profiler->mark(frame_phase::render_ui);
+	if (zeal->frame_pacer && zeal->frame_pacer->skip_render())
+		return;
+	if (zeal->dx)
+		zeal->dx->states.invalidate(); //the game drew since the last overlay
+	LONGLONG overlay_start = zeal->frame_profiler ? zeal->frame_profiler->overlay_begin(nullptr, false) : 0;
 	zeal->callbacks->invoke_generic(callback_type::RenderUI);
-	zeal->hooks->hook_map["RenderUI"]->original(render_ui)(x);
+	if (zeal->dx)
+		zeal->dx->primitives.flush(zeal->dx->get_device());
+	if (zeal->frame_profiler)
+		zeal->frame_profiler->overlay_end(nullptr, overlay_start, false);
+	hook_ref<render_ui>::original()(x);
 }
 
 void _fastcall charselect_hk(int t, int u)
 {
 	ZealService* zeal = ZealService::get_instance();
 	zeal->callbacks->invoke_generic(callback_type::CharacterSelect);
-	zeal->hooks->hook_map["DoCharacterSelection"]->original(charselect_hk)(t, u);
+	hook_ref<charselect_hk>::original()(t, u);
 }
 
 void CallbackManager::eml()
@@ -44,70 +75,334 @@ void CallbackManager::eml()
 
 void CallbackManager::invoke_generic(callback_type fn)
 {
-	for (auto& f : generic_functions[fn])
-			f();
+	CrashHandler::note_phase(static_cast<UINT>(fn));
+	dispatching++;
+#if ZEAL_PROFILER
+	if (Zeal::Profiler::enabled)
+	{
+		auto& functions = generic_functions[static_cast<size_t>(fn)];
+		auto& stats = generic_stats[static_cast<size_t>(fn)];
+		for (size_t i = 0; i < functions.size(); ++i)
+		{
+			Zeal::Profiler::scope timer(stats[i]);
+			functions[i]();
+		}
+	}
+	else
+#endif
+	for (auto& f : generic_functions[static_cast<size_t>(fn)])
+		f();
+	if (--dispatching == 0 && !deferred_active.empty())
+	{
+		std::vector<std::pair<UINT, bool>> changes;
+		changes.swap(deferred_active);
+		for (const auto& [handle, active] : changes)
+			apply_active(handle, active);
+	}
+}
+
+void CallbackManager::set_active(UINT handle, bool active)
+{
+	if (dispatching)
+		deferred_active.push_back({ handle, active });
+	else
+		apply_active(handle, active);
+}
+
+void CallbackManager::apply_active(UINT handle, bool active)
+{
+	auto entry = generic_by_handle.find(handle);
+	if (entry == generic_by_handle.end())
+		return;
+	size_t type = static_cast<size_t>(entry->second.type);
+	auto& handles = generic_handles[type];
+	auto pos = std::lower_bound(handles.begin(), handles.end(), handle);
+	bool is_active = pos != handles.end() && *pos == handle;
+	if (active == is_active)
+		return;
+	size_t index = pos - handles.begin();
+	auto& functions = generic_functions[type];
+	auto& stats = generic_stats[type];
+	if (active)
+	{
+		handles.insert(pos, handle);
+		functions.insert(functions.begin() + index, std::move(entry->second.callback));
+		stats.insert(stats.begin() + index, entry->second.stats);
+		entry->second.callback = nullptr;
+	}
+	else
+	{
+		entry->second.callback = std::move(functions[index]);
+		handles.erase(pos);
+		functions.erase(functions.begin() + index);
+		stats.erase(stats.begin() + index);
+	}
 }
 
-void CallbackManager::add_delayed(std::function<void()> callback_function, int ms)
+static const char* callback_type_names[] = { "MainLoop", "Zone", "CleanUI", "Render", "CharacterSelect", "InitUI", "EndMainLoop",
+	"WorldMessage", "SendMessage", "ExecuteCmd", "Delayed", "RenderUI", "EndScene", "AddDeferred", "DeviceReset" };
+static_assert(sizeof(callback_type_names) / sizeof(callback_type_names[0]) == static_cast<size_t>(callback_type::_count));
+
+Zeal::Profiler::stats* CallbackManager::caller_stats(const char* kind, void* caller)
 {
-	delayed_functions.push_back({ GetTickCount64() + ms, callback_function });
+	auto it = stats_by_caller.find(caller);
+	if (it != stats_by_caller.end())
+		return it->second;
+	char name[96];
+	snprintf(name, sizeof(name), "%s callback Zeal+0x%x", kind, (UINT)((BYTE*)caller - (BYTE*)&__ImageBase));
+	Zeal::Profiler::stats* stats = Zeal::Profiler::create(name);
+	stats_by_caller[caller] = stats;
+	return stats;
 }
 
-void CallbackManager::add_generic(std::function<void()> callback_function, callback_type fn)
+UINT CallbackManager::add_timer(std::function<void()> callback_function, int ms, int interval, void* caller)
 {
-	generic_functions[fn].push_back(callback_function);
+	UINT id = next_timer_id++;
+	if (!next_timer_id)
+		next_timer_id = 1;
+	timers[id] = { std::move(callback_function), interval, caller_stats(interval ? "Periodic" : "Delayed", caller) };
+	timer_heap.push_back({ GetTickCount64() + (ms > 0 ? ms : 0), id });
+	std::push_heap(timer_heap.begin(), timer_heap.end(), std::greater<timer_deadline>());
+	return id;
 }
+
+UINT CallbackManager::add_delayed(std::function<void()> callback_function, int ms)
+{
+	return add_timer(std::move(callback_function), ms, 0, _ReturnAddress());
+}
+
+UINT CallbackManager::add_periodic(std::function<void()> callback_function, int ms)
+{
+	return add_timer(std::move(callback_function), ms, ms > 0 ? ms : 1, _ReturnAddress());
+}
+
+UINT CallbackManager::add_work(std::function<bool(int budget_us)> step, int ms, work_priority priority, int deadline_ms)
+{
+	UINT id = next_timer_id++;
+	if (!next_timer_id)
+		next_timer_id = 1;
+	int interval = ms > 0 ? ms : 1;
+	work[id] = { std::move(step), interval, priority, deadline_ms > 0 ? deadline_ms : interval, GetTickCount64() + interval, false,
+		caller_stats("Work", _ReturnAddress()) };
+	return id;
+}
+
+void CallbackManager::cancel_timer(UINT timer_id)
+{
+	timers.erase(timer_id);
+	work.erase(timer_id);
+}
+
+void CallbackManager::invoke_work()
+{
+	if (work.empty())
+		return;
+	ULONGLONG now = GetTickCount64();
+	work_order.clear();
+	for (const auto& [id, item] : work)
+	{
+		if (item.resuming || item.due <= now)
+			work_order.push_back({ id, item.due + item.deadline_ms });
+	}
+	if (work_order.empty())
+		return;
+	work_frames++;
+	std::sort(work_order.begin(), work_order.end(), [this, now](const auto& a, const auto& b) {
+		bool a_late = a.second <= now, b_late = b.second <= now;
+		if (a_late != b_late)
+			return a_late;
+		work_priority pa = work[a.first].priority, pb = work[b.first].priority;
+		if (pa != pb)
+			return pa < pb;
+		return a.second < b.second;
+	});
+	LARGE_INTEGER start, current, frequency;
+	QueryPerformanceCounter(&start);
+	QueryPerformanceFrequency(&frequency);
+	LONGLONG budget = frequency.QuadPart * std::max(work_budget_us.get(), 0) / 1000000;
+	for (size_t i = 0; i < work_order.size(); ++i)
+	{
+		QueryPerformanceCounter(&current);
+		LONGLONG used = current.QuadPart - start.QuadPart;
+		if (i && used >= budget)
+		{
+			work_spilled += work_order.size() - i;
+			break;
+		}
+		auto it = work.find(work_order[i].first);
+		if (it == work.end()) //cancelled by an earlier step
+			continue;
+		std::function<bool(int)> step = it->second.step; //the step may cancel itself
+		Zeal::Profiler::stats* stats = it->second.stats;
+		int left_us = static_cast<int>(std::max<LONGLONG>(budget - used, 0) * 1000000 / frequency.QuadPart);
+		bool more;
+		{
+			Zeal::Profiler::scope timer(stats);
+			more = step(left_us);
+		}
+		it = work.find(work_order[i].first);
+		if (it == work.end())
+			continue;
+		it->second.resuming = more;
+		if (!more)
+			it->second.due = now + it->second.interval;
+	}
+}
+
+Zeal::Memory::usage CallbackManager::memory_usage() const
+{
+	Zeal::Memory::usage use{ Zeal::Memory::hash_bytes(timers) + Zeal::Memory::vector_bytes(timer_heap) + Zeal::Memory::hash_bytes(generic_by_handle)
+		+ Zeal::Memory::hash_bytes(work) + Zeal::Memory::vector_bytes(work_order), timers.size() + work.size() };
+	for (size_t i = 0; i < generic_functions.size(); i++)
+	{
+		use.bytes += Zeal::Memory::vector_bytes(generic_functions[i]) + Zeal::Memory::vector_bytes(generic_stats[i]) + Zeal::Memory::vector_bytes(generic_handles[i])
+			+ Zeal::Memory::vector_bytes(cmd_functions[i]);
+		use.count += generic_functions[i].size() + cmd_functions[i].size();
+	}
+	for (const packet_table& table : packet_functions)
+	{
+		use.bytes += Zeal::Memory::vector_bytes(table.any_opcode) + Zeal::Memory::vector_bytes(table.by_opcode) + (table.opcode_slot ? sizeof(*table.opcode_slot) : 0);
+		use.count += table.any_opcode.size();
+		for (const auto& handlers : table.by_opcode)
+		{
+			use.bytes += Zeal::Memory::vector_bytes(handlers);
+			use.count += handlers.size();
+		}
+	}
+	return use;
+}
+
+UINT CallbackManager::add_generic(std::function<void()> callback_function, callback_type fn, bool active)
+{
+	UINT handle = next_generic_handle++;
+	Zeal::Profiler::stats* stats = caller_stats(callback_type_names[static_cast<size_t>(fn)], _ReturnAddress());
+	generic_by_handle[handle] = { fn, nullptr, stats };
+	if (!active)
+	{
+		generic_by_handle[handle].callback = std::move(callback_function);
+		return handle;
+	}
+	generic_functions[static_cast<size_t>(fn)].push_back(std::move(callback_function));
+	generic_stats[static_cast<size_t>(fn)].push_back(stats);
+	generic_handles[static_cast<size_t>(fn)].push_back(handle);
+	return handle;
+}
+
+#if ZEAL_PROFILER
+static std::function<bool(UINT, char*, UINT)> profiled_packet(std::function<bool(UINT, char*, UINT)> callback_function, Zeal::Profiler::stats* stats)
+{
+	return [callback_function = std::move(callback_function), stats](UINT opcode, char* buffer, UINT len) {
+		Zeal::Profiler::scope timer(stats);
+		return callback_function(opcode, buffer, len);
+	};
+}
+#endif
+
 void CallbackManager::add_packet(std::function<bool(UINT, char*, UINT)> callback_function, callback_type type)
 {
-	packet_functions[type].push_back(callback_function);
+#if ZEAL_PROFILER
+	callback_function = profiled_packet(std::move(callback_function), caller_stats(callback_type_names[static_cast<size_t>(type)], _ReturnAddress()));
+#endif
+	packet_functions[static_cast<size_t>(type)].any_opcode.push_back(std::move(callback_function));
+}
+void CallbackManager::add_packet(std::function<bool(UINT, char*, UINT)> callback_function, std::initializer_list<UINT> opcodes, callback_type type)
+{
+#if ZEAL_PROFILER
+	callback_function = profiled_packet(std::move(callback_function), caller_stats(callback_type_names[static_cast<size_t>(type)], _ReturnAddress()));
+#endif
+	packet_table& table = packet_functions[static_cast<size_t>(type)];
+	if (!table.opcode_slot)
+	{
+		table.opcode_slot = std::make_unique<std::array<USHORT, 0x10000>>();
+		table.opcode_slot->fill(0);
+		table.by_opcode.resize(1);
+	}
+	for (UINT opcode : opcodes)
+	{
+		if (opcode > 0xFFFF)
+			continue;
+		USHORT& slot = (*table.opcode_slot)[opcode];
+		if (!slot)
+		{
+			slot = static_cast<USHORT>(table.by_opcode.size());
+			table.by_opcode.emplace_back();
+		}
+		table.by_opcode[slot].push_back(callback_function);
+	}
 }
 void CallbackManager::add_command(std::function<bool(UINT, BOOL)> callback_function, callback_type type)
 {
-	cmd_functions[type].push_back(callback_function);
+	cmd_functions[static_cast<size_t>(type)].push_back(std::move(callback_function));
 }
 
 void __fastcall enterzone_hk(int t, int unused, int hwnd)
 {
 	ZealService* zeal = ZealService::get_instance();
-	zeal->hooks->hook_map["EnterZone"]->original(enterzone_hk)(t, unused, hwnd);
+	hook_ref<enterzone_hk>::original()(t, unused, hwnd);
 	zeal->callbacks->invoke_generic(callback_type::Zone);
 }
 void __fastcall initgameui_hk(int t, int u)
 {
 	ZealService* zeal = ZealService::get_instance();
-	zeal->hooks->hook_map["InitGameUI"]->original(initgameui_hk)(t, u);
+	hook_ref<initgameui_hk>::original()(t, u);
 	zeal->callbacks->invoke_generic(callback_type::InitUI);
 }
 void __stdcall clean_up_ui()
 {
 	ZealService* zeal = ZealService::get_instance();
 	zeal->callbacks->invoke_generic(callback_type::CleanUI);
-	zeal->hooks->hook_map["CleanUpUI"]->original(clean_up_ui)();
+	hook_ref<clean_up_ui>::original()();
 }
 
 void CallbackManager::invoke_delayed()
 {
+	if (timer_heap.empty())
+		return;
 	ULONGLONG current_time = GetTickCount64();
-	for (auto& [end_time, fn] : delayed_functions)
+	while (!timer_heap.empty() && timer_heap.front().due <= current_time)
 	{
-		if (current_time >= end_time)
-			fn();
+		std::pop_heap(timer_heap.begin(), timer_heap.end(), std::greater<timer_deadline>());
+		UINT id = timer_heap.back().id;
+		timer_heap.pop_back();
+
+		auto it = timers.find(id);
+		if (it == timers.end()) //cancelled
+			continue;
+
+		std::function<void()> fn;
+		Zeal::Profiler::stats* stats = it->second.stats;
+		if (it->second.interval)
+		{
+			fn = it->second.callback;
+			timer_heap.push_back({ current_time + it->second.interval, id });
+			std::push_heap(timer_heap.begin(), timer_heap.end(), std::greater<timer_deadline>());
+		}
+		else
+		{
+			fn = std::move(it->second.callback);
+			timers.erase(it);
+		}
+		Zeal::Profiler::scope timer(stats);
+		fn(); //may add or cancel timers
 	}
-	delayed_functions.erase(
-		std::remove_if(
-			delayed_functions.begin(),
-			delayed_functions.end(),
-			[current_time](const std::pair<ULONGLONG, std::function<void()>>& item) {
-				return current_time>item.first;
-			}
-		),
-		delayed_functions.end()
-	);
 }
 
 bool CallbackManager::invoke_packet(callback_type cb_type, UINT opcode, char* buffer, UINT len)
 {
-	for (auto& fn : packet_functions[cb_type])
+	packet_table& table = packet_functions[static_cast<size_t>(cb_type)];
+	if (table.opcode_slot && opcode <= 0xFFFF)
+	{
+		USHORT slot = (*table.opcode_slot)[opcode];
+		if (slot)
+		{
+			for (auto& fn : table.by_opcode[slot])
+			{
+				if (fn(opcode, buffer, len))
+					return true;
+			}
+		}
+	}
+	for (auto& fn : table.any_opcode)
 	{
 		if (fn(opcode, buffer, len))
 			return true;
@@ -117,7 +412,7 @@ bool CallbackManager::invoke_packet(callback_type cb_type, UINT opcode, char* bu
 
 bool CallbackManager::invoke_command(callback_type cb_type, UINT opcode, bool state)
 {
-	for (auto& fn : cmd_functions[cb_type])
+	for (auto& fn : cmd_functions[static_cast<size_t>(cb_type)])
 	{
 		if (fn(opcode, state))
 			return true;
@@ -136,19 +431,27 @@ char __fastcall handleworldmessage_hk(int* connection, int unused, UINT unk, UIN
 	//if (!Zeal::EqGame::get_self() && opcode == 0x4107) //a fix for a crash reported by Ecliptor at 0x004E2803
 	//	return 1;
 
+	if (zeal->frame_profiler)
+		zeal->frame_profiler->note_packet(opcode, len);
+	if (zeal->packet_capture)
+		zeal->packet_capture->record(0, opcode, buffer, len);
+	CrashHandler::note_packet(false, opcode, buffer, len);
 	if (zeal->callbacks->invoke_packet(callback_type::WorldMessage,opcode, buffer, len))
 		return 1;
 
-	return zeal->hooks->hook_map["HandleWorldMessage"]->original(handleworldmessage_hk)(connection, unused, unk, opcode, buffer, len);
+	return hook_ref<handleworldmessage_hk>::original()(connection, unused, unk, opcode, buffer, len);
 }
 void send_message_hk(int* connection, UINT opcode, char* buffer, UINT len, int unknown)
 {
 	ZealService* zeal = ZealService::get_instance();
 	//Zeal::EqGame::print_chat("Opcode %i   len: %i", opcode, len);
+	if (zeal->packet_capture)
+		zeal->packet_capture->record(1, opcode, buffer, len);
+	CrashHandler::note_packet(true, opcode, buffer, len);
 	if (zeal->callbacks->invoke_packet(callback_type::SendMessage_, opcode, buffer, len))
 		return;
 
-	zeal->hooks->hook_map["SendMessage"]->original(send_message_hk)(connection, opcode, buffer, len, unknown);
+	hook_ref<send_message_hk>::original()(connection, opcode, buffer, len, unknown);
 }
 
 void executecmd_hk(UINT cmd, bool isdown, int unk2)
@@ -157,10 +460,14 @@ void executecmd_hk(UINT cmd, bool isdown, int unk2)
 	//Zeal::EqGame::print_chat(USERCOLOR_SHOUT, "Cmd: %i", cmd);
 	if (cmd == 0xd2)
 		zeal->callbacks->invoke_generic(callback_type::EndMainLoop);
+	else if (zeal->input)
+		zeal->input->push(cmd, isdown);
+	if (cmd != 0xd2 && zeal->packet_capture)
+		zeal->packet_capture->record_key(cmd, isdown);
 	if (zeal->callbacks->invoke_command(callback_type::ExecuteCmd, cmd, isdown))
 		return;
 
-	zeal->hooks->hook_map["ExecuteCmd"]->original(executecmd_hk)(cmd, isdown, unk2);
+	hook_ref<executecmd_hk>::original()(cmd, isdown, unk2);
 }
 
 void msg_new_text(char* msg)
@@ -171,31 +478,48 @@ void msg_new_text(char* msg)
 	//	Zeal::EqGame::print_chat("self was null during new text");
 		return;
 	}
-	zeal->hooks->hook_map["MsgNewText"]->original(msg_new_text)(msg);
+	hook_ref<msg_new_text>::original()(msg);
 }
 
 int __fastcall AddDeferred(int t, int u)
 {
 	ZealService* zeal = ZealService::get_instance();
+	if (zeal->frame_profiler)
+		zeal->frame_profiler->mark(frame_phase::deferred);
+	if (zeal->dx)
+		zeal->dx->states.invalidate();
+	LONGLONG overlay_start = zeal->frame_profiler ? zeal->frame_profiler->overlay_begin(nullptr, false) : 0;
 	zeal->callbacks->invoke_generic(callback_type::AddDeferred);
-	return ZealService::get_instance()->hooks->hook_map["AddDeferred"]->original(AddDeferred)(t, u);
+	if (zeal->frame_profiler)
+		zeal->frame_profiler->overlay_end(nullptr, overlay_start, false);
+	return hook_ref<AddDeferred>::original()(t, u);
 }
 
 CallbackManager::CallbackManager(ZealService* zeal)
 {
-	zeal->hooks->Add("AddDeferred", 0x59E000, AddDeferred, hook_type_detour); //render in this hook so damage is displayed behind ui
-	zeal->hooks->Add("MsgNewText", 0x4e25a1, msg_new_text, hook_type_detour);
-	zeal->hooks->Add("ExecuteCmd", 0x54050c, executecmd_hk, hook_type_detour);
-	zeal->hooks->Add("MainLoop", 0x5473c3, main_loop_hk, hook_type_detour);
-	zeal->hooks->Add("Render", 0x4AA8BC, render_hk, hook_type_detour);
+	zeal->hooks->Add<AddDeferred>("AddDeferred", 0x59E000, hook_type_detour); //render in this hook so damage is displayed behind ui
+	zeal->hooks->Add<msg_new_text>("MsgNewText", zeal->addresses->get(game_address::msg_new_text), hook_type_detour);
+	zeal->hooks->Add<executecmd_hk>("ExecuteCmd", zeal->addresses->get(game_address::execute_cmd), hook_type_detour);
+	zeal->hooks->Add<main_loop_hk>("MainLoop", zeal->addresses->get(game_address::main_loop), hook_type_detour);
+	zeal->hooks->Add<render_hk>("Render", zeal->addresses->get(game_address::render), hook_type_detour);
 	HMODULE eqfx = GetModuleHandleA("eqgfx_dx8.dll");
 	if (eqfx)
-		zeal->hooks->Add("RenderUI", (DWORD)eqfx+0x6b7f0, render_ui, hook_type_detour);
+		zeal->hooks->Add<render_ui>("RenderUI", (DWORD)eqfx+0x6b7f0, hook_type_detour);
 	
-	zeal->hooks->Add("EnterZone", 0x53D2C4, enterzone_hk, hook_type_detour);
-	zeal->hooks->Add("CleanUpUI", 0x4A6EBC, clean_up_ui, hook_type_detour);
-	zeal->hooks->Add("DoCharacterSelection", 0x53b9cf, charselect_hk, hook_type_detour);
-	zeal->hooks->Add("InitGameUI", 0x4a60b5, initgameui_hk, hook_type_detour);
-	zeal->hooks->Add("HandleWorldMessage", 0x4e829f, handleworldmessage_hk, hook_type_detour);
-	zeal->hooks->Add("SendMessage", 0x54e51a, send_message_hk, hook_type_detour);
+	zeal->hooks->Add<enterzone_hk>("EnterZone", zeal->addresses->get(game_address::enter_zone), hook_type_detour);
+	zeal->hooks->Add<clean_up_ui>("CleanUpUI", 0x4A6EBC, hook_type_detour);
+	zeal->hooks->Add<charselect_hk>("DoCharacterSelection", zeal->addresses->get(game_address::character_select), hook_type_detour);
+	zeal->hooks->Add<initgameui_hk>("InitGameUI", 0x4a60b5, hook_type_detour);
+	zeal->hooks->Add<handleworldmessage_hk>("HandleWorldMessage", zeal->addresses->get(game_address::handle_world_message), hook_type_detour);
+	zeal->hooks->Add<send_message_hk>("SendMessage", zeal->addresses->get(game_address::send_message), hook_type_detour);
+	zeal->commands_hook->add("/zealwork", {}, "Zeal's frame budgeted background work: items, the per frame budget and how often it overflowed, /zealwork <microseconds> sets the budget.",
+		[this](std::vector<std::string>& args) {
+			int budget = 0;
+			if (args.size() > 1 && Zeal::String::tryParse(args[1], &budget) && budget >= 0)
+				work_budget_us.set(budget);
+			size_t resuming = std::count_if(work.begin(), work.end(), [](const auto& w) { return w.second.resuming; });
+			Zeal::EqGame::print_chat("%u work items (%u mid step), budget %ius a frame, %llu items pushed to a later frame over %llu frames with work",
+				(UINT)work.size(), (UINT)resuming, work_budget_us.get(), work_spilled, work_frames);
+			return true;
+		});
 }
@@ -1,8 +1,12 @@
 #pragma once
 #include "hook_wrapper.h"
 #include "memory.h"
+#include "memory_report.h"
+#include "settings.h"
 #include <functional>
 #include <unordered_map>
+#include <array>
+#include <memory>
 enum class callback_type
 {
 	MainLoop,
@@ -18,26 +22,99 @@ enum class callback_type
 	Delayed,
 	RenderUI,
 	EndScene,
-	AddDeferred
+	AddDeferred,
+	DeviceReset, //before the d3d device resets, release anything the reset would invalidate
+	_count //keep last, sizes the dispatch tables
+};
+enum class work_priority
+{
+	high,
+	normal,
+	low
 };
 class CallbackManager
 {
 public:
-	void add_generic(std::function<void()> callback_function, callback_type fn = callback_type::MainLoop);
+	//the handle switches the callback with set_active, an inactive one is out of the dispatch list and costs nothing per frame
+	UINT add_generic(std::function<void()> callback_function, callback_type fn = callback_type::MainLoop, bool active = true);
+	void set_active(UINT handle, bool active); //safe from inside a dispatch, the change lands once it returns
 	void add_packet(std::function<bool(UINT, char*, UINT)> callback_function, callback_type fn = callback_type::WorldMessage);
+	//only invoked for the listed opcodes, everything else skips straight to the game
+	void add_packet(std::function<bool(UINT, char*, UINT)> callback_function, std::initializer_list<UINT> opcodes, callback_type fn = callback_type::WorldMessage);
 	void add_command(std::function<bool(UINT, BOOL)> callback_function, callback_type fn = callback_type::ExecuteCmd);
-	void add_delayed(std::function<void()> callback_function, int ms);
+	UINT add_delayed(std::function<void()> callback_function, int ms);
+	UINT add_periodic(std::function<void()> callback_function, int ms); //fires every ms until cancelled
+	//frame budgeted work, due every ms and run from main_loop_hk while the frame's budget lasts: overdue items first, then by
+	//priority and deadline (due plus deadline_ms, 0 for one interval). whatever doesn't fit waits for the next frame, at least
+	//one item runs each frame. the step gets the microseconds left and returns true to be called again next frame
+	UINT add_work(std::function<bool(int budget_us)> step, int ms, work_priority priority = work_priority::normal, int deadline_ms = 0);
+	void cancel_timer(UINT timer_id); //timers and work items share ids
+	Setting<int> work_budget_us{ "Zeal", "WorkBudget", 1000 };
+	Zeal::Memory::usage memory_usage() const; //timers and registered callbacks, for /zealmem
 	void invoke_generic(callback_type fn);
 	bool invoke_packet(callback_type fn, UINT opcode, char* buffer, UINT len);
 	bool invoke_command(callback_type fn, UINT opcode, bool state);
 	void invoke_delayed();
+	void invoke_work();
 	CallbackManager(class ZealService* zeal);
 	~CallbackManager();
 	void eml();
 private:
-	std::vector<std::pair<ULONGLONG, std::function<void()>>> delayed_functions;
-	std::unordered_map<callback_type, std::vector<std::function<void()>>> generic_functions;
-	std::unordered_map<callback_type, std::vector<std::function<bool(UINT, char*, UINT)>>> packet_functions;
-	std::unordered_map<callback_type, std::vector<std::function<bool(UINT, BOOL)>>> cmd_functions;
+	struct packet_table
+	{
+		std::vector<std::function<bool(UINT, char*, UINT)>> any_opcode;
+		std::vector<std::vector<std::function<bool(UINT, char*, UINT)>>> by_opcode; //index 0 is unused
+		std::unique_ptr<std::array<USHORT, 0x10000>> opcode_slot; //opcode -> by_opcode index, allocated on first filtered add
+	};
+	template<typename T>
+	using callback_table = std::array<std::vector<T>, static_cast<size_t>(callback_type::_count)>;
+	struct timer
+	{
+		std::function<void()> callback;
+		int interval; //0 for one shot timers
+		Zeal::Profiler::stats* stats;
+	};
+	struct timer_deadline
+	{
+		ULONGLONG due;
+		UINT id;
+		bool operator>(const timer_deadline& other) const { return due > other.due; }
+	};
+	struct work_item
+	{
+		std::function<bool(int)> step;
+		int interval;
+		work_priority priority;
+		int deadline_ms;
+		ULONGLONG due;
+		bool resuming; //returned true last time, runs again regardless of due
+		Zeal::Profiler::stats* stats;
+	};
+	std::unordered_map<UINT, work_item> work;
+	std::vector<std::pair<UINT, ULONGLONG>> work_order; //ready ids and their sort deadline, reused every frame
+	UINT64 work_spilled = 0; //ready items a frame's budget left for the next one
+	UINT64 work_frames = 0;
+	UINT add_timer(std::function<void()> callback_function, int ms, int interval, void* caller);
+	Zeal::Profiler::stats* caller_stats(const char* kind, void* caller); //one entry per registering call site
+	std::vector<timer_deadline> timer_heap; //min-heap on due, cancelled ids are dropped when they surface
+	std::unordered_map<UINT, timer> timers;
+	UINT next_timer_id = 1;
+	callback_table<std::function<void()>> generic_functions;
+	callback_table<Zeal::Profiler::stats*> generic_stats; //parallel to generic_functions
+	callback_table<UINT> generic_handles; //parallel to generic_functions and ascending, so a resumed callback goes back to its place
+	struct parked_generic
+	{
+		callback_type type;
+		std::function<void()> callback; //empty while active
+		Zeal::Profiler::stats* stats;
+	};
+	std::unordered_map<UINT, parked_generic> generic_by_handle;
+	UINT next_generic_handle = 1;
+	int dispatching = 0; //nested invoke_generic depth
+	std::vector<std::pair<UINT, bool>> deferred_active;
+	void apply_active(UINT handle, bool active);
+	std::unordered_map<void*, Zeal::Profiler::stats*> stats_by_caller;
+	std::array<packet_table, static_cast<size_t>(callback_type::_count)> packet_functions;
+	callback_table<std::function<bool(UINT, BOOL)>> cmd_functions;
 };
 
@@ -1,4 +1,5 @@
 #include "camera_math.h"
+#include <Windows.h>
 namespace camera_math
 {
     float pitch_to_normal(float game_pitch) {
@@ -27,6 +28,78 @@ namespace camera_math
     float lerp(float rawDelta, float smoothDelta, float t) {
         return std::lerp(smoothDelta, static_cast<float>(rawDelta), t);
     }
+    float damp(float current, float target, float half_life_ms, float dt_ms) {
+        if (half_life_ms <= 0)
+            return target;
+        return std::lerp(target, current, exp2f(-dt_ms / half_life_ms));
+    }
+    float frame_clock::tick(float max_ms) {
+        static LARGE_INTEGER frequency = {};
+        if (!frequency.QuadPart)
+            QueryPerformanceFrequency(&frequency);
+        LARGE_INTEGER now;
+        QueryPerformanceCounter(&now);
+        float dt = last ? (float)((now.QuadPart - last) * 1000.0 / frequency.QuadPart) : 0.f;
+        last = now.QuadPart;
+        return dt < max_ms ? dt : max_ms;
+    }
+    static double qpc_ms(long long ticks) {
+        static LARGE_INTEGER frequency = {};
+        if (!frequency.QuadPart)
+            QueryPerformanceFrequency(&frequency);
+        return ticks * 1000.0 / frequency.QuadPart;
+    }
+    Vec3 head_predictor::predict(const void* view_actor, Vec3 head, float heading) {
+        LARGE_INTEGER now;
+        QueryPerformanceCounter(&now);
+        if (!valid || view_actor != actor) {
+            valid = true;
+            actor = view_actor;
+            last_head = head;
+            last_heading = heading;
+            last_change = now.QuadPart;
+            velocity = Vec3();
+            heading_rate = 0;
+            interval_ms = 0;
+            return head;
+        }
+        float since_ms = (float)qpc_ms(now.QuadPart - last_change);
+        if (head != last_head) {
+            float turn = heading - last_heading;
+            if (turn > 256.f)
+                turn -= 512.f;
+            else if (turn < -256.f)
+                turn += 512.f;
+            if (since_ms > 0 && since_ms < max_ahead_ms && head.Dist2(last_head) < max_step * max_step) {
+                velocity = Vec3((head.x - last_head.x) / since_ms, (head.y - last_head.y) / since_ms, (head.z - last_head.z) / since_ms);
+                heading_rate = turn / since_ms;
+                interval_ms = interval_ms > 0 ? std::lerp(interval_ms, since_ms, 0.25f) : since_ms;
+            }
+            else {
+                velocity = Vec3();
+                heading_rate = 0;
+            }
+            last_head = head;
+            last_heading = heading;
+            last_change = now.QuadPart;
+            return head;
+        }
+        // stopped, or the update is overdue: hold the last known head rather than running off
+        float limit = interval_ms * 1.5f;
+        if (limit > max_ahead_ms)
+            limit = max_ahead_ms;
+        if (since_ms > limit) {
+            velocity = Vec3();
+            heading_rate = 0;
+            return head;
+        }
+        // bend the step by half the turn made over it, an arc instead of the tangent
+        float bend = heading_rate * since_ms * 0.5f;
+        float c = heading_cos(bend), s = heading_sin(bend);
+        float vx = velocity.x * c - velocity.y * s;
+        float vy = velocity.x * s + velocity.y * c;
+        return Vec3(head.x + vx * since_ms, head.y + vy * since_ms, head.z + velocity.z * since_ms);
+    }
     float angle_difference(float angle1, float angle2) {
         float abs_diff = fabs(angle1 - angle2);
         if (abs_diff > 256.0f) {
@@ -38,10 +111,9 @@ namespace camera_math
     }
 
     float get_pitch(Vec3 cameraPos, Vec3 targetPos) {
-        Vec3 direction = targetPos - cameraPos;
-        float horizontalDistance = (float)direction.Length2D();
-        float verticalDistance = (float)direction.z;
-        float pitch = std::atan2(verticalDistance, horizontalDistance);
+        float horizontalDistance = sqrtf(targetPos.Dist2D2(cameraPos));
+        float verticalDistance = targetPos.z - cameraPos.z;
+        float pitch = atan2f(verticalDistance, horizontalDistance);
         float pitchDegrees = pitch * (180.0f / (float)M_PI);
 
         // Scale the pitch to fit into the [-128, 128] range
@@ -51,23 +123,20 @@ namespace camera_math
     }
 
     Vec3 get_cam_pos_behind(const Vec3& playerHead, float distance, float playerYaw, float pitch) {
-        float yaw_rads = playerYaw * (2.0f * (float)M_PI) / 512.0f;
-        float yaw_deg = yaw_rads * (180.0f / (float)M_PI);
-
-        // Convert pitch to radians
-        float pitch_rads = pitch * ((float)M_PI / 180.0f);
+        // pitch comes in degrees, both angles go through the heading table
+        float pitch_heading = degrees_to_heading(pitch);
 
         Vec3 positionBehind;
 
         // Calculate the position behind based on player's orientation and pitch
-        float horizontalDistance = distance * cos(pitch_rads);
-        float verticalDistance = distance * sin(pitch_rads);
+        float horizontalDistance = distance * heading_cos(pitch_heading);
+        float verticalDistance = distance * heading_sin(pitch_heading);
 
         static Vec3 last_good;
         // Limit vertical distance to prevent camera from moving too far above the player's head
-        if (pitch_rads > -M_PI / 2 && pitch_rads < M_PI / 2) {
-            positionBehind.x = playerHead.x - horizontalDistance * cos(yaw_rads);
-            positionBehind.y = playerHead.y - horizontalDistance * sin(yaw_rads);
+        if (pitch > -90.f && pitch < 90.f) {
+            positionBehind.x = playerHead.x - horizontalDistance * heading_cos(playerYaw);
+            positionBehind.y = playerHead.y - horizontalDistance * heading_sin(playerYaw);
             positionBehind.z = playerHead.z + verticalDistance;
             last_good = positionBehind;
         }
@@ -78,4 +147,4 @@ namespace camera_math
 
         return positionBehind;
     }
-}
\ No newline at end of file
+}
@@ -1,11 +1,75 @@
 #pragma once
+#include <array>
 #include <cmath>
 #include "vectors.h"
 namespace camera_math
 {
+	// eq headings run 0-512 for a full turn; sine sampled at every heading unit, built at compile time, and read back
+	// with linear interpolation (error under 2e-5) so the per frame camera, ring and radar math skip the libm calls
+	inline constexpr int heading_units = 512;
+	namespace detail
+	{
+		constexpr double series_sin(double x) {
+			double term = x, sum = x;
+			for (int n = 1; n < 14; ++n) {
+				term *= -x * x / ((2 * n) * (2 * n + 1));
+				sum += term;
+			}
+			return sum;
+		}
+		constexpr std::array<float, heading_units + 1> make_sin_table() {
+			std::array<float, heading_units + 1> table = {};
+			for (int i = 0; i <= heading_units; ++i) {
+				double x = 2.0 * 3.14159265358979323846 * i / heading_units;
+				if (x > 3.14159265358979323846)
+					x -= 2.0 * 3.14159265358979323846;
+				table[i] = static_cast<float>(series_sin(x));
+			}
+			return table;
+		}
+	}
+	inline constexpr std::array<float, heading_units + 1> heading_sin_table = detail::make_sin_table(); //the last entry repeats the first
+	inline float heading_sin(float heading) {
+		float whole = floorf(heading);
+		int i = static_cast<int>(whole) & (heading_units - 1);
+		return heading_sin_table[i] + (heading_sin_table[i + 1] - heading_sin_table[i]) * (heading - whole);
+	}
+	inline float heading_cos(float heading) { return heading_sin(heading + heading_units / 4); }
+	inline constexpr float degrees_to_heading(float degrees) { return degrees * (heading_units / 360.f); }
+	inline constexpr float heading_to_degrees(float heading) { return heading * (360.f / heading_units); }
+	inline constexpr float radians_to_heading(float radians) { return radians * (heading_units / (2.f * 3.14159265f)); }
+	inline constexpr float heading_to_radians(float heading) { return heading * (2.f * 3.14159265f / heading_units); }
 	float pitch_to_normal(float game_pitch);
 	float pitch_to_game(float zeal_pitch);
 	float lerp(float rawDelta, float smoothDelta, float t);
+	float damp(float current, float target, float half_life_ms, float dt_ms); //exponential smoothing, halves the gap every half_life_ms at any frame rate
+	// milliseconds since the previous tick from QueryPerformanceCounter, clamped so the first call or a hitch does not jump
+	class frame_clock
+	{
+	public:
+		float tick(float max_ms = 100.f);
+	private:
+		long long last = 0;
+	};
+	// constant velocity and turn rate model of the view actor's head, fed every rendered frame
+	// the head only moves when the client simulates it or a position update arrives, in between it is carried along the last motion
+	class head_predictor
+	{
+	public:
+		Vec3 predict(const void* actor, Vec3 head, float heading);
+		void reset() { valid = false; }
+	private:
+		static constexpr float max_step = 50.f; //a bigger jump between samples is a teleport, not movement
+		static constexpr float max_ahead_ms = 250.f;
+		bool valid = false;
+		const void* actor = nullptr;
+		Vec3 last_head;
+		float last_heading = 0;
+		long long last_change = 0; //qpc when the sampled head last moved
+		Vec3 velocity; //units per ms
+		float heading_rate = 0; //heading units per ms
+		float interval_ms = 0; //smoothed time between movements
+	};
 	float angle_difference(float angle1, float angle2);
 	Vec3 get_cam_pos_behind(const Vec3& playerHead, float distance, float playerYaw, float pitch);
 	float get_pitch(Vec3 cameraPos, Vec3 targetPos);
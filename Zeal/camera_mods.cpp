@@ -20,6 +20,22 @@ void set_camera_view(int view)
     *Zeal::EqGame::camera_view = view;
 }
 
+const char* CameraMods::mode_name(int mode)
+{
+    switch (mode)
+    {
+    case Shoulder: return "shoulder";
+    case FixedFollow: return "fixed";
+    case Cinematic: return "cinematic";
+    default: return "behind";
+    }
+}
+
+bool CameraMods::owns_camera() const
+{
+    return enabled && Zeal::EqGame::is_in_game() && get_camera_view() == Zeal::EqEnums::CameraView::ZealCam && Zeal::EqGame::get_view_actor_entity();
+}
+
 bool CameraMods::update_cam()
 {
     if (!enabled)
@@ -30,20 +46,100 @@ bool CameraMods::update_cam()
         return false;
 
     Zeal::EqStructures::CameraInfo* cam = Zeal::EqGame::get_camera();
-    Vec3 head_pos = Zeal::EqGame::get_view_actor_head_pos();
-    Vec3 wanted_pos = camera_math::get_cam_pos_behind(head_pos, current_zoom, zeal_cam_yaw/*self->Heading*/, -zeal_cam_pitch);
+    Vec3 head_pos = head_model.predict(self, Zeal::EqGame::get_view_actor_head_pos(), self->Heading);
+    float yaw = zeal_cam_yaw;
+    int cam_mode = mode.get();
+    if (cam_mode == FixedFollow)
+        yaw = self->Heading;
+    if (cam_mode == Cinematic)
+    {
+        float dt = cinematic_clock.tick();
+        if (!cinematic_valid)
+            cinematic_yaw = zeal_cam_yaw;
+        float gap = fmodf(zeal_cam_yaw - cinematic_yaw + 768.f, 512.f) - 256.f; //shortest way round
+        cinematic_yaw = fmodf(cinematic_yaw + gap - camera_math::damp(gap, 0, cinematic_half_life_ms, dt) + 512.f, 512.f);
+        yaw = cinematic_yaw;
+    }
+    cinematic_valid = cam_mode == Cinematic;
+    if (cam_mode == Shoulder)
+    {
+        // the camera ray starts at the offset pivot, so sweep out to it first or a wall beside the head ends up behind the ray's start
+        float offset = shoulder_offset.get();
+        Vec3 pivot = head_pos;
+        pivot.x += offset * camera_math::heading_sin(yaw);
+        pivot.y -= offset * camera_math::heading_cos(yaw);
+        Vec3 hit;
+        if (offset != 0 && Zeal::EqGame::collide_with_world(head_pos, pivot, hit))
+        {
+            float side = std::max(0.f, static_cast<float>(head_pos.Dist(hit)) - 0.5f) * (offset < 0 ? -1.f : 1.f); //stop short of the wall
+            pivot = head_pos;
+            pivot.x += side * camera_math::heading_sin(yaw);
+            pivot.y -= side * camera_math::heading_cos(yaw);
+        }
+        head_pos = pivot;
+    }
+    Vec3 wanted_pos = camera_math::get_cam_pos_behind(head_pos, current_zoom, yaw, -zeal_cam_pitch);
 
 #ifdef debug_cam
     ZealService::get_instance()->labels_hook->print_debug_info("View actor: %i\nHead: %s\nWanted: %s", self, head_pos.toString().c_str(), wanted_pos.toString().c_str());
 #endif
-    bool rval = Zeal::EqGame::collide_with_world(head_pos, wanted_pos, wanted_pos);
+    bool rval = collide_cached(head_pos, yaw, zeal_cam_pitch, current_zoom, wanted_pos);
     cam->Position = wanted_pos;
-    cam->Heading = zeal_cam_yaw;// self->Heading;
+    cam->Heading = yaw;
     cam->Pitch = camera_math::get_pitch(cam->Position, head_pos);
     cam->RegionNumber = Zeal::EqGame::get_region_from_pos(&cam->Position);
     return rval;
 }
 
+// the world does not move, so along an unchanged ray the last sweep already answers any distance up to where it hit
+// or stopped, only a zoom past the known free part sweeps again and only over the extension
+// a ray that changes again after this frame's sweep keeps the previous hit distance until the next frame
+bool CameraMods::collide_cached(Vec3 head_pos, float yaw, float pitch, float distance, Vec3& wanted_pos)
+{
+    bool same_ray = ray.valid && head_pos.Dist2(ray.head) < 0.0001f && fabs(yaw - ray.yaw) < 0.001f && fabs(pitch - ray.pitch) < 0.001f;
+    if (!same_ray)
+    {
+        if (ray.valid && (ray.hit || ray.free_distance > 0))
+        {
+            ray.guess_hit = ray.hit;
+            ray.guess_distance = ray.hit_distance;
+        }
+        ray.valid = true;
+        ray.head = head_pos;
+        ray.yaw = yaw;
+        ray.pitch = pitch;
+        ray.free_distance = 0;
+        ray.free_end = head_pos;
+        ray.hit = false;
+    }
+    if (ray.hit && distance > ray.hit_distance + 0.1f)
+    {
+        wanted_pos = ray.hit_pos;
+        return true;
+    }
+    if (distance <= ray.free_distance)
+        return false;
+    if (sweep_frame == frame)
+    {
+        if (!ray.guess_hit || distance <= ray.guess_distance)
+            return false;
+        wanted_pos = camera_math::get_cam_pos_behind(head_pos, ray.guess_distance, yaw, -pitch);
+        return true;
+    }
+    sweep_frame = frame;
+    Vec3 end = wanted_pos;
+    if (Zeal::EqGame::collide_with_world(ray.free_end, end, wanted_pos))
+    {
+        ray.hit = true;
+        ray.hit_pos = wanted_pos;
+        ray.hit_distance = (float)head_pos.Dist(wanted_pos);
+        return true;
+    }
+    ray.free_distance = distance;
+    ray.free_end = end;
+    return false;
+}
+
 void CameraMods::mouse_wheel(int delta)
 {
     Zeal::EqStructures::CameraInfo* cam = Zeal::EqGame::get_camera();
@@ -127,18 +223,69 @@ int handle_mouse_wheel(int delta)
         return 0;
     }
     else
-        return ZealService::get_instance()->hooks->hook_map["HandleMouseWheel"]->original(handle_mouse_wheel)(delta);
+        return hook_ref<handle_mouse_wheel>::original()(delta);
 }
 
 
+LRESULT CALLBACK CameraMods::raw_input_proc(HWND hwnd, UINT msg, WPARAM wparam, LPARAM lparam)
+{
+    if (msg == WM_INPUT)
+    {
+        RAWINPUT input;
+        UINT size = sizeof(input);
+        if (GetRawInputData((HRAWINPUT)lparam, RID_INPUT, &input, &size, sizeof(RAWINPUTHEADER)) != (UINT)-1
+            && input.header.dwType == RIM_TYPEMOUSE && !(input.data.mouse.usFlags & MOUSE_MOVE_ABSOLUTE))
+        {
+            raw_x.fetch_add(input.data.mouse.lLastX, std::memory_order_relaxed);
+            raw_y.fetch_add(input.data.mouse.lLastY, std::memory_order_relaxed);
+        }
+    }
+    return CallWindowProcA(game_wnd_proc, hwnd, msg, wparam, lparam);
+}
+
+// legacy mouse messages and the game's DirectInput device keep working, raw input is only added alongside
+void CameraMods::update_raw_input()
+{
+    HWND gwnd = raw_mouse.get() ? Zeal::EqGame::get_game_window() : nullptr;
+    if (gwnd == raw_window)
+        return;
+    remove_raw_input();
+    if (!gwnd)
+        return;
+    RAWINPUTDEVICE mouse = { 0x01, 0x02, 0, gwnd }; //generic desktop, mouse
+    if (!RegisterRawInputDevices(&mouse, 1, sizeof(mouse)))
+        return;
+    game_wnd_proc = (WNDPROC)SetWindowLongPtrA(gwnd, GWLP_WNDPROC, (LONG_PTR)raw_input_proc);
+    raw_window = gwnd;
+    raw_x = 0;
+    raw_y = 0;
+}
+
+void CameraMods::remove_raw_input()
+{
+    if (!raw_window)
+        return;
+    if (IsWindow(raw_window))
+    {
+        RAWINPUTDEVICE mouse = { 0x01, 0x02, RIDEV_REMOVE, nullptr };
+        RegisterRawInputDevices(&mouse, 1, sizeof(mouse));
+        if ((WNDPROC)GetWindowLongPtrA(raw_window, GWLP_WNDPROC) == raw_input_proc) //someone subclassed after us, leave the chain alone
+            SetWindowLongPtrA(raw_window, GWLP_WNDPROC, (LONG_PTR)game_wnd_proc);
+    }
+    raw_window = nullptr;
+}
+
 void CameraMods::proc_mouse()
 {
+    //taken every call so reports from while the camera wasn't turning don't land as one jump later
+    LONG raw_dx = raw_x.exchange(0, std::memory_order_relaxed);
+    LONG raw_dy = raw_y.exchange(0, std::memory_order_relaxed);
     if (!enabled)
         return;
     if (get_camera_view() == Zeal::EqEnums::CameraView::ZealCam || get_camera_view() == Zeal::EqEnums::CameraView::FirstPerson)
     {
-        static float smoothMouseDeltaX = 0;
-        static float smoothMouseDeltaY = 0;
+        static float smooth_rate_x = 0; //mouse counts per ms after smoothing
+        static float smooth_rate_y = 0;
         Zeal::EqStructures::CameraInfo* cam = Zeal::EqGame::get_camera();
         DWORD camera_view = get_camera_view();
         Zeal::EqStructures::MouseDelta* delta = (Zeal::EqStructures::MouseDelta*)0x798586;
@@ -151,17 +298,17 @@ void CameraMods::proc_mouse()
  
         if (rbutton || (camera_view== Zeal::EqEnums::CameraView::ZealCam && lbutton))
         {
-            float delta_y = delta->y;
-            float delta_x = delta->x;
-            float t = 1.0f / 1.5f;
-            /*if (fps < 50)
-            {
-                delta_y *= fps/2;
-                delta_x *= fps/2;
-            }*/
-            smoothMouseDeltaX = camera_math::lerp(delta_x * sensitivity_x, smoothMouseDeltaX, t);
-            smoothMouseDeltaY = camera_math::lerp(delta_y * sensitivity_y, smoothMouseDeltaY, t);
-            if (fabs(smoothMouseDeltaX) > 5)
+            float delta_y = raw_window ? static_cast<float>(raw_dy) : delta->y;
+            float delta_x = raw_window ? static_cast<float>(raw_dx) : delta->x;
+            // smoothing the rate instead of the per frame delta keeps the response and the total turn the same at any frame rate
+            float dt = mouse_clock.tick();
+            if (dt < 0.1f)
+                dt = 0.1f;
+            smooth_rate_x = camera_math::damp(smooth_rate_x, delta_x * sensitivity_x / dt, mouse_half_life_ms, dt);
+            smooth_rate_y = camera_math::damp(smooth_rate_y, delta_y * sensitivity_y / dt, mouse_half_life_ms, dt);
+            float smoothMouseDeltaX = smooth_rate_x * dt;
+            float smoothMouseDeltaY = smooth_rate_y * dt;
+            if (fabs(smooth_rate_x) * reference_frame_ms > 5)
                 smoothMouseDeltaY /= 2;
 
             delta->y = 0;
@@ -231,7 +378,7 @@ void __fastcall procMouse(int eq, int unused, int a1)
     if (eq == 0)
         return;
     else
-        zeal->hooks->hook_map["procMouse"]->original(procMouse)(eq, unused, a1);
+        hook_ref<procMouse>::original()(eq, unused, a1);
 }
 
 void CameraMods::set_smoothing(bool val)
@@ -243,7 +390,7 @@ void CameraMods::set_smoothing(bool val)
         toggle_zeal_cam(enabled);
     else
         toggle_zeal_cam(false);
-    ZealService::get_instance()->ui->options->UpdateOptions();
+    ZealService::get_instance()->ui->options->changed(ui_options::option::cam);
 }
 
 void CameraMods::interpolate_zoom() 
@@ -252,33 +399,13 @@ void CameraMods::interpolate_zoom()
         return;
     if (get_camera_view() == Zeal::EqEnums::CameraView::ZealCam)
     {
-        current_zoom = current_zoom + (desired_zoom - current_zoom) * .3f; //linear interpolation
+        current_zoom = camera_math::damp(current_zoom, desired_zoom, zoom_half_life_ms, zoom_clock.tick(reference_frame_ms * 2)); //the clock is stale when zeal cam was just entered
         if (current_zoom < .5)
             toggle_zeal_cam(false);
     }
 }
 
 
-void CameraMods::handle_camera_motion_binds(int cmd, bool is_down)
-{
-    DWORD camera_view = get_camera_view();
-    if (!enabled)
-    {
-        cmd_key_map.clear();
-        return;
-    }
-
-   // if ((camera_view == Zeal::EqEnums::CameraView::ZealCam) || (cmd == 19)) //allow zoom out
- //   {
-        if (is_down)
-            cmd_key_map[cmd] = true;
-        else
-            cmd_key_map[cmd] = false;
-   //     return;
-  //  }
- //   cmd_key_map[cmd] = false;
-}
-
 // didn't want to clutter handle_binds() with specific logic to this situation.
 // feel free to change this if you would prefer to have it elsewhere.
 void CameraMods::handle_cycle_camera_views(int cmd, bool is_down)
@@ -299,10 +426,6 @@ void CameraMods::handle_cycle_camera_views(int cmd, bool is_down)
     mem::write<byte>(0x53fa50, strafe_camera_count);
     mem::write<byte>(0x53f648, strafe_camera_count);
   }
-  else
-  {
-      cmd_key_map.clear();
-  }
 }
 
 // check to help fix left mouse panning from preventing repositioning the game in windowed mode.
@@ -318,17 +441,13 @@ static bool is_over_title_bar(void)
 void CameraMods::tick_key_move()
 {
     if (!enabled)
-    {
-        if (cmd_key_map.size())
-            cmd_key_map.clear();
         return;
-    }
-    Zeal::EqStructures::Entity* self = Zeal::EqGame::get_self();
+    InputEvents* input = ZealService::get_instance()->input.get();
     DWORD camera_view = get_camera_view();
     //if (camera_view != Zeal::EqEnums::CameraView::ZealCam && current_key_cmd != 19)
     //    current_key_cmd = 0;
 
-    if (camera_view == Zeal::EqEnums::CameraView::FirstPerson && cmd_key_map[19])
+    if (camera_view == Zeal::EqEnums::CameraView::FirstPerson && input->is_down(19))
     {
         mouse_wheel(-120);
     }
@@ -365,59 +484,26 @@ void CameraMods::tick_key_move()
             mem::write<byte>(0x53edef, 0x75);
         lmouse_time = 0;
     }
-    for (auto& [current_key_cmd, down] : cmd_key_map)
+    if ((input->is_down(5) || input->is_down(6)) && Zeal::EqGame::can_move()) //turning with the keys keeps the camera behind the player
+        zeal_cam_yaw = Zeal::EqGame::get_self()->Heading;
+    //zoom speed was tuned as a step per frame at 60fps, scaling by the time held keeps it the same at any frame rate
+    float zoom_in = input->held_ms(18) / (1000.f / 60.f);
+    float zoom_out = input->held_ms(19) / (1000.f / 60.f);
+    if (zoom_in > 0 && desired_zoom > 0)
+        desired_zoom -= .3f * zoom_in;
+    if (zoom_out > 0)
     {
-        if (down)
-        {
-            switch (current_key_cmd)
-            {
-            case 5:
-            case 6:
-            {
-                if (Zeal::EqGame::can_move())
-                {
-                    //if (camera_view == Zeal::EqEnums::CameraView::ZealCam && (self->StandingState == Stance::Stand || self->StandingState == Stance::Duck))
-                    //{
-                    //    //if your camera is panned more than 5 degrees different than your players heading then shift the player to match the camera
-                    //    if (fabs(camera_math::angle_difference(zeal_cam_yaw, self->Heading)) > 20 && fps > 40)
-                    //       self->Heading = zeal_cam_yaw;
-                    //    else
-                            zeal_cam_yaw = self->Heading;
-                   // }
-                }
-                break;
-            }
-            case 15: //up
-                //zeal_cam_pitch -= 0.3f;
-                //if (zeal_cam_pitch <= -89.99f)
-                //    zeal_cam_pitch = -89.99f;
-                break;
-            case 16: //down
-                //zeal_cam_pitch += 0.3f;
-                //if (zeal_cam_pitch >= 89.99f)
-                //    zeal_cam_pitch = 89.99f;
-                break;
-            case 18: //zoom in
-                if (desired_zoom > 0)
-                    desired_zoom -= .3f;
-                break;
-            case 19: //zoom out
-                desired_zoom += .3f;
-                if (desired_zoom > max_zoom_out)
-                    desired_zoom = max_zoom_out;
-                break;
-            }
-        }
+        desired_zoom += .3f * zoom_out;
+        if (desired_zoom > max_zoom_out)
+            desired_zoom = max_zoom_out;
     }
 }
 
 void CameraMods::update_fps_sensitivity()
 {
-    auto currentTime = std::chrono::steady_clock::now();
-    auto elapsedTime = std::chrono::duration_cast<std::chrono::milliseconds>(currentTime - lastTime).count();
-    if (elapsedTime > 0) {
-        fps = 1000.0f / elapsedTime;
-    }
+    float elapsed_ms = fps_clock.tick(1000.f);
+    if (elapsed_ms > 0)
+        fps = 1000.0f / elapsed_ms;
 
     if (use_old_sens)
     {
@@ -447,7 +533,6 @@ void CameraMods::update_fps_sensitivity()
     float multiplier = current_sens / 4.0f;
     sensitivity_x *= multiplier;
     sensitivity_y *= multiplier;
-    lastTime = currentTime;
 }
 void CameraMods::callback_render()
 {
@@ -460,7 +545,7 @@ void CameraMods::callback_render()
         //}
         if (Zeal::EqGame::is_in_game() && Zeal::EqGame::get_self() && Zeal::EqGame::get_char_info() /*&& !*Zeal::EqGame::is_right_mouse_down*/ && get_camera_view() == Zeal::EqEnums::CameraView::ZealCam)
         { 
-            if (Zeal::EqGame::get_self()->Position.Dist(Zeal::EqGame::get_char_info()->ZoneEnter) != 0)
+            if (Zeal::EqGame::get_self()->Position != Zeal::EqGame::get_char_info()->ZoneEnter)
                 update_cam();
             
         }
@@ -471,6 +556,8 @@ void CameraMods::callback_main()
 {
     static int prev_view = get_camera_view();
     DWORD camera_view = get_camera_view();
+    frame++; //a new collision budget for the camera
+    update_raw_input();
     if (Zeal::EqGame::is_in_game())
         update_fps_sensitivity();
     if (enabled && Zeal::EqGame::is_in_game() && !main_loop_ended)
@@ -497,6 +584,30 @@ void CameraMods::callback_main()
     }
     main_loop_ended = false;
     prev_view = get_camera_view();
+    tick_fov();
+}
+
+float CameraMods::wanted_fov() const
+{
+    float wanted = fov;
+    Zeal::EqStructures::Entity* self = Zeal::EqGame::is_in_game() ? Zeal::EqGame::get_self() : nullptr;
+    if (!self)
+        return wanted;
+    if (fov_zoom && Zeal::EqGame::get_target())
+        wanted = zoom_fov.get() < wanted ? zoom_fov.get() : wanted;
+    else if (sprint_fov.get() > 0 && self->MovementSpeed > sprint_speed)
+        wanted += sprint_fov.get();
+    return wanted < 10.f ? 10.f : (wanted > 120.f ? 120.f : wanted);
+}
+
+// once it lands the lens sees the same fov every frame and the hook below stops rebuilding the projection
+void CameraMods::tick_fov()
+{
+    float dt = fov_clock.tick();
+    float wanted = wanted_fov();
+    lens_fov = camera_math::damp(lens_fov, wanted, fov_half_life_ms, dt);
+    if (fabs(lens_fov - wanted) < 0.01f)
+        lens_fov = wanted;
 }
 void CameraMods::callback_characterselect()
 {
@@ -561,32 +672,27 @@ void __stdcall procRightMouse(int x, int y)
 {
     ZealService* zeal = ZealService::get_instance();
     zeal->camera_mods->proc_rmousedown(x,y);
-    zeal->hooks->hook_map["procRightMouse"]->original(procRightMouse)(x, y);
+    hook_ref<procRightMouse>::original()(x, y);
 }
 
 void CameraMods::set_old_sens(bool enabled)
 {
     use_old_sens = enabled;
     ZealService::get_instance()->ini->setValue<int>("Zeal", "OldSens", use_old_sens);
-    ZealService::get_instance()->ui->options->UpdateOptions();
+    ZealService::get_instance()->ui->options->changed(ui_options::option::use_old_sens);
 }
 
 void CameraMods::set_pan_delay(int value_ms)
 {
    pan_delay = value_ms;
    ZealService::get_instance()->ini->setValue<int>("Zeal", "PanDelay", pan_delay);
-   ZealService::get_instance()->ui->options->UpdateOptions();
+   ZealService::get_instance()->ui->options->changed(ui_options::option::pan_delay);
 }
 void CameraMods::set_fov(float _fov)
 {
-    fov = _fov;
-    Zeal::EqStructures::CameraInfo* ci = Zeal::EqGame::get_camera();
-    if (ci)
-    {
-        ci->FieldOfView = fov;
-    }
+    fov = _fov; //the lens hook eases over to it
     ZealService::get_instance()->ini->setValue<float>("Zeal", "Fov", fov);
-    ZealService::get_instance()->ui->options->UpdateOptions();
+    ZealService::get_instance()->ui->options->changed(ui_options::option::fov);
 }
 
 
@@ -596,10 +702,15 @@ void CameraMods::update_sensitivity()
     ZealService::get_instance()->ini->setValue<float>("Zeal", "MouseSensitivityY", user_sensitivity_y);
     ZealService::get_instance()->ini->setValue<float>("Zeal", "MouseSensitivityX3rd", user_sensitivity_x_3rd);
     ZealService::get_instance()->ini->setValue<float>("Zeal", "MouseSensitivityY3rd", user_sensitivity_y_3rd);
-    ZealService::get_instance()->ui->options->UpdateOptions();
+    ZealService::get_instance()->ui->options->changed(ui_options::option::sensitivity);
 }
 void CameraMods::callback_zone()
 {
+    ray.valid = false;
+    ray.guess_hit = false;
+    cinematic_valid = false;
+    invalidate_lens();
+    head_model.reset();
 
 }
 void CameraMods::callback_endmainloop()
@@ -607,31 +718,43 @@ void CameraMods::callback_endmainloop()
     main_loop_ended = true;
 }
 
+// the client sets the lens every frame, the projection is only rebuilt when one of its inputs actually moved
 int SetCameraLens(int a1, float fov, float aspect_ratio, float a4, float a5)
 {
-    ZealService* zeal = ZealService::get_instance();
-    fov = zeal->camera_mods->fov;
-    int rval = zeal->hooks->hook_map["SetCameraLens"]->original(SetCameraLens)(a1, fov, aspect_ratio, a4, a5);
+    CameraMods* cam = ZealService::get_instance()->camera_mods.get();
+    fov = cam->lens_fov;
+    CameraMods::lens_state& lens = cam->lens;
+    if (!lens.valid || lens.camera != a1 || lens.fov != fov || lens.aspect != aspect_ratio || lens.a4 != a4 || lens.a5 != a5)
+        lens = { true, a1, fov, aspect_ratio, a4, a5, hook_ref<SetCameraLens>::original()(a1, fov, aspect_ratio, a4, a5) };
     if (Zeal::EqGame::get_gamestate()!=GAMESTATE_PRECHARSELECT)
     {
         Zeal::EqStructures::CameraInfo* ci = Zeal::EqGame::get_camera(); 
-        if (ci)
-            ci->FieldOfView = zeal->camera_mods->fov;
+        if (ci && ci->FieldOfView != fov)
+            ci->FieldOfView = fov;
     }
-    return rval;
+    return lens.result;
 }
 
+// while the zeal cam is up the game's camera ai is skipped, it would place the camera and sweep the world only to be overwritten
 void __fastcall DoCamAI(int display, int u, float p1)
 {
     ZealService* zeal = ZealService::get_instance();
-    zeal->hooks->hook_map["DoCamAI"]->original(DoCamAI)(display, u, p1);
-    if (Zeal::EqGame::is_in_game() && get_camera_view() == Zeal::EqEnums::CameraView::ZealCam)
+    if (zeal->camera_mods->owns_camera())
         zeal->camera_mods->update_cam();
+    else
+        hook_ref<DoCamAI>::original()(display, u, p1);
 }
 
 CameraMods::CameraMods(ZealService* zeal, IO_ini* ini)
 {
     load_settings(ini);
+    lens_fov = fov; //no ease in on load
+    zeal->config_watch->on_reload([this, ini]() {
+        load_settings(ini); //the lens hook and the mouse handlers read fov and the sensitivities every frame
+        ZealService* zeal = ZealService::get_instance();
+        if (zeal->ui && zeal->ui->options)
+            zeal->ui->options->UpdateOptions();
+    });
 
     mem::write<byte>(0x53fa50, Zeal::EqEnums::CameraView::TotalCameras); //allow for strafing whenever in zeal cam
     mem::write<byte>(0x53f648, Zeal::EqEnums::CameraView::TotalCameras); //allow for strafing whenever in zeal cam
@@ -641,30 +764,36 @@ CameraMods::CameraMods(ZealService* zeal, IO_ini* ini)
     else
         mem::write<byte>(0x4adcd9, Zeal::EqEnums::CameraView::ZealCam);
 
-    lastTime = std::chrono::steady_clock::now();
     fps = 0;
     height = 0;
     zeal->callbacks->add_generic([this]() { callback_main();  });
     zeal->callbacks->add_generic([this]() { callback_render();  }, callback_type::Render);
     zeal->callbacks->add_generic([this]() { callback_zone(); }, callback_type::Zone);
+    zeal->callbacks->add_generic([this]() { invalidate_lens(); }, callback_type::CharacterSelect);
+    zeal->callbacks->add_generic([this]() { invalidate_lens(); }, callback_type::DeviceReset); //the reset rebuilds the camera's projection
     zeal->callbacks->add_generic([this]() { callback_endmainloop(); }, callback_type::EndMainLoop);
 
     //zeal->main_loop_hook->add_callback([this]() { callback_characterselect();  }, callback_fn::CharacterSelect);
     zeal->callbacks->add_generic([this]() { callback_characterselect(); }, callback_type::EndMainLoop);
-    zeal->hooks->Add("HandleMouseWheel", Zeal::EqGame::EqGameInternal::fn_handle_mouseweheel, handle_mouse_wheel, hook_type_detour);
-    zeal->hooks->Add("procMouse", 0x537707, procMouse, hook_type_detour);
-    zeal->hooks->Add("procRightMouse", 0x54699d, procRightMouse, hook_type_detour);
-    zeal->hooks->Add("DoCamAI", 0x4db384, DoCamAI, hook_type_detour);
+    zeal->hooks->Add<handle_mouse_wheel>("HandleMouseWheel", Zeal::EqGame::EqGameInternal::fn_handle_mouseweheel, hook_type_detour);
+    zeal->hooks->Add<procMouse>("procMouse", 0x537707, hook_type_detour);
+    zeal->hooks->Add<procRightMouse>("procRightMouse", 0x54699d, hook_type_detour);
+    zeal->hooks->Add<DoCamAI>("DoCamAI", 0x4db384, hook_type_detour);
     FARPROC eqfx = GetProcAddress(GetModuleHandleA("eqgfx_dx8.dll"), "t3dSetCameraLens");
     if (eqfx != NULL) 
-        zeal->hooks->Add("SetCameraLens", (int)eqfx, SetCameraLens, hook_type_detour);
-    zeal->commands_hook->add("/fov", { }, "Set your field of view requires a value between 45 and 90.",
+        zeal->hooks->Add<SetCameraLens>("SetCameraLens", (int)eqfx, hook_type_detour);
+    zeal->commands_hook->add("/fov", { }, "Set your field of view requires a value between 45 and 90, /fov zoom toggles zooming in on your target.",
         [this](std::vector<std::string>& args) {
             Zeal::EqStructures::CameraInfo* ci = Zeal::EqGame::get_camera();
             if (ci)
             {
                 float fov = 0;
-                if (args.size() > 1 && Zeal::String::tryParse(args[1], &fov))
+                if (args.size() > 1 && Zeal::String::compare_insensitive(args[1], "zoom"))
+                {
+                    fov_zoom = !fov_zoom;
+                    Zeal::EqGame::print_chat("Target zoom is %s (FovZoom %.0f)", fov_zoom ? "on" : "off", zoom_fov.get());
+                }
+                else if (args.size() > 1 && Zeal::String::tryParse(args[1], &fov))
                 {
                     if (fov < 45 || fov > 90)
                     {
@@ -697,13 +826,30 @@ CameraMods::CameraMods(ZealService* zeal, IO_ini* ini)
                 Zeal::EqGame::print_chat("Invalid arguments for pandelay example usage: /pandelay 200");
             return true;
         });
-    zeal->commands_hook->add("/zealcam", { "/smoothing" }, "Toggles the zealcam on/off as well as adjusting the sensitivities.",
+    zeal->commands_hook->add("/zealcam", { "/smoothing" }, "Toggles the zealcam on/off as well as adjusting the sensitivities, /zealcam raw toggles raw mouse input, /zealcam mode <behind|shoulder|fixed|cinematic> picks the camera mode.",
         [this](std::vector<std::string>& args) {
             if (args.size() == 2 && Zeal::String::compare_insensitive(args[1], "info"))
             {
                 Zeal::EqGame::print_chat("camera sensitivity FirstPerson : [% f] [% f] ThirdPerson : [% f] [% f] ", user_sensitivity_x, user_sensitivity_y, user_sensitivity_x_3rd, user_sensitivity_y_3rd);
                 return true;
             }
+            else if (args.size() >= 2 && Zeal::String::compare_insensitive(args[1], "mode"))
+            {
+                for (int i = 0; args.size() == 3 && i < TotalModes; ++i)
+                {
+                    if (Zeal::String::compare_insensitive(args[2], mode_name(i)))
+                        mode.set(i);
+                }
+                Zeal::EqGame::print_chat("Zealcam mode is %s (behind, shoulder, fixed, cinematic)", mode_name(mode.get()));
+                return true;
+            }
+            else if (args.size() == 2 && Zeal::String::compare_insensitive(args[1], "raw"))
+            {
+                raw_mouse.set(!raw_mouse.get());
+                update_raw_input();
+                Zeal::EqGame::print_chat("Zealcam raw mouse input %s", raw_mouse.get() ? (raw_window ? "enabled" : "enabled, waiting for the game window") : "disabled");
+                return true;
+            }
             else if (args.size() == 3) //the first arg is the command name itself
             {
                 float x_sens = 0;
@@ -765,14 +911,6 @@ CameraMods::CameraMods(ZealService* zeal, IO_ini* ini)
             }
             return true;
         });
-    zeal->binds_hook->replace_cmd(15, [this](int state) { handle_camera_motion_binds(15, state); return false; });
-    zeal->binds_hook->replace_cmd(115, [this](int state) { handle_camera_motion_binds(15, state); return false; });
-    zeal->binds_hook->replace_cmd(111, [this](int state) { handle_camera_motion_binds(15, state); return false; });
-    zeal->binds_hook->replace_cmd(16, [this](int state) { handle_camera_motion_binds(16, state); return false; });
-    zeal->binds_hook->replace_cmd(116, [this](int state) { handle_camera_motion_binds(16, state); return false; });
-    zeal->binds_hook->replace_cmd(112, [this](int state) { handle_camera_motion_binds(16, state); return false; });
-    zeal->binds_hook->replace_cmd(18, [this](int state) { handle_camera_motion_binds(18, state); return false; });
-    zeal->binds_hook->replace_cmd(19, [this](int state) { handle_camera_motion_binds(19, state); return false; });
     zeal->binds_hook->replace_cmd(20, [this](int state) { handle_cycle_camera_views(20, state); return false; });
 
 }
@@ -781,4 +919,5 @@ CameraMods::~CameraMods()
 {
     shutting_down = true;
     toggle_zeal_cam(false);
+    remove_raw_input();
 }
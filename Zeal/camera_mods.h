@@ -2,6 +2,9 @@
 #include "memory.h"
 #include <chrono>
 #include "vectors.h"
+#include "camera_math.h"
+#include "settings.h"
+#include <atomic>
 
 class CameraMods
 {
@@ -36,15 +39,37 @@ public:
 	void update_zoom(float zoom);
 	void toggle_zeal_cam(bool enabled, bool reset_pitch = true);
 	void proc_mouse();
-	void handle_camera_motion_binds(int cmd, bool is_down);
 	void handle_cycle_camera_views(int cmd, bool is_down);
 	void proc_rmousedown(int x, int y);
 	int pan_delay = 200;
-	float fov = 45;
+	float fov = 45; //the user's setting
+	float lens_fov = 45; //what the lens gets, eases toward the wanted fov on the camera clock
+	bool fov_zoom = false; //toggled by /fov zoom, narrows to FovZoom while something is targeted
+	Setting<float> zoom_fov{ "Zeal", "FovZoom", 30.f };
+	Setting<float> sprint_fov{ "Zeal", "FovSprint", 0.f }; //degrees added while running, 0 turns it off
+	// the last lens the client set, the same arguments again leave the projection as it is
+	struct lens_state
+	{
+		bool valid = false;
+		int camera = 0;
+		float fov = 0;
+		float aspect = 0;
+		float a4 = 0;
+		float a5 = 0;
+		int result = 0;
+	} lens;
+	void invalidate_lens() { lens.valid = false; }
 	void set_pan_delay(int value_ms);
 	void set_fov(float fov);
 	void update_sensitivity();
 	void set_old_sens(bool enabled);
+	Setting<bool> raw_mouse{ "Zeal", "RawMouse", false }; //WM_INPUT deltas instead of the game's polled MouseDelta
+	// how the zeal cam places itself around the view actor, every mode goes through the same ray and collision budget
+	enum cam_mode { Behind, Shoulder, FixedFollow, Cinematic, TotalModes };
+	Setting<int> mode{ "Zeal", "ZealCamMode", Behind };
+	Setting<float> shoulder_offset{ "Zeal", "ZealCamShoulder", 3.f }; //units to the right of the head, negative for the left shoulder
+	static const char* mode_name(int mode);
+	bool owns_camera() const; //true while the zeal cam replaces the game's camera ai
 	CameraMods(class ZealService* pHookWrapper, class IO_ini* ini);
 	~CameraMods();
 private:
@@ -57,13 +82,54 @@ private:
 	float sensitivity_y = 0.4f;
 	void load_settings(class IO_ini* ini);
 	void interpolate_zoom();
-	std::unordered_map<int, bool> cmd_key_map;
+	float wanted_fov() const;
+	void tick_fov();
+	static constexpr float fov_half_life_ms = 60.f;
+	static constexpr float sprint_speed = 0.6f; //MovementSpeed past a walk, unbuffed running is about 0.7
+	camera_math::frame_clock fov_clock;
 	BYTE original_cam[6] = { 0 };
-	std::chrono::steady_clock::time_point lastTime;
+	// the old per frame steps (2/3 of the mouse gap, 0.3 of the zoom gap) expressed as half-lives at 60fps
+	static constexpr float reference_frame_ms = 1000.f / 60.f;
+	static constexpr float mouse_half_life_ms = 10.5f;
+	static constexpr float zoom_half_life_ms = 32.4f;
+	camera_math::frame_clock mouse_clock;
+	camera_math::frame_clock zoom_clock;
+	camera_math::frame_clock fps_clock;
+	camera_math::head_predictor head_model;
 	Vec2 local_delta = { 0, 0 };
 	bool shutting_down = false;
 	void tick_key_move();
+	bool collide_cached(Vec3 head_pos, float yaw, float pitch, float distance, Vec3& wanted_pos); //wanted_pos is pulled in to the hit, returns true on collision
+	// at most one world sweep per frame for the camera, later calls in the same frame reuse what the last sweep found
+	unsigned int frame = 0;
+	unsigned int sweep_frame = ~0u;
+	static constexpr float cinematic_half_life_ms = 400.f;
+	camera_math::frame_clock cinematic_clock;
+	float cinematic_yaw = 0;
+	bool cinematic_valid = false;
+	struct camera_ray
+	{
+		bool valid = false;
+		bool guess_hit = false; //the previous ray's answer, used for a new ray until the budget allows a sweep
+		float guess_distance = 0;
+		Vec3 head;
+		float yaw = 0;
+		float pitch = 0;
+		float free_distance = 0; //zoom known to be clear of the world
+		Vec3 free_end; //camera position at free_distance
+		bool hit = false;
+		float hit_distance = 0;
+		Vec3 hit_pos;
+	} ray;
 	void update_fps_sensitivity();
+	// raw input: the game window is subclassed for WM_INPUT, which adds every mouse report to these between frames
+	static LRESULT CALLBACK raw_input_proc(HWND hwnd, UINT msg, WPARAM wparam, LPARAM lparam);
+	static inline std::atomic<LONG> raw_x = 0;
+	static inline std::atomic<LONG> raw_y = 0;
+	static inline WNDPROC game_wnd_proc = nullptr;
+	HWND raw_window = nullptr;
+	void update_raw_input(); //installs or removes the raw path to match the setting and the current game window
+	void remove_raw_input();
 };
 	
 
@@ -0,0 +1,196 @@
+#include "cast_tracker.h"
+#include "Zeal.h"
+#include "EqFunctions.h"
+#include "EqPackets.h"
+#include <algorithm>
+
+static constexpr ULONGLONG pending_timeout = 1000; //a request the server never answered stops counting as pending
+static constexpr ULONGLONG early_stop_ms = 100; //a stop this close to the predicted end is the cast landing, not an interrupt
+
+static int remaining(ULONGLONG when, ULONGLONG now)
+{
+	return when > now ? static_cast<int>(when - now) : 0;
+}
+
+bool CastTracker::pending() const
+{
+	return requested_at && GetTickCount64() - requested_at < pending_timeout;
+}
+
+int CastTracker::cast_remaining() const
+{
+	return casting() ? remaining(cast.ends, GetTickCount64()) : 0;
+}
+
+int CastTracker::recovery_remaining() const
+{
+	ULONGLONG now = GetTickCount64();
+	return remaining(casting() ? std::max(cast.recovery_ends, recovery_ends) : recovery_ends, now);
+}
+
+ULONGLONG CastTracker::gem_ready(int gem) const
+{
+	if (gem < 0 || gem >= EQ_NUM_SPELL_GEMS)
+		return 0;
+	ULONGLONG ready = recovery_ends;
+	Zeal::EqStructures::EQCHARINFO* char_info = Zeal::EqGame::get_char_info();
+	if (char_info && char_info->MemorizedSpell[gem] == recast_spell[gem])
+		ready = std::max(ready, recast_ends[gem]);
+	if (casting())
+	{
+		ready = std::max(ready, cast.recovery_ends);
+		if (gem == cast.gem)
+			ready = std::max(ready, cast.recast_ends);
+	}
+	return ready > GetTickCount64() ? ready : 0;
+}
+
+int CastTracker::ready_in(int gem) const
+{
+	return remaining(gem_ready(gem), GetTickCount64());
+}
+
+void CastTracker::on_cast_request(UINT gem)
+{
+	requested_gem = gem < EQ_NUM_SPELL_GEMS ? static_cast<int>(gem) : -1;
+	requested_at = GetTickCount64();
+}
+
+void CastTracker::on_stop_cast(BYTE reason)
+{
+	requested_at = 0;
+	if (!casting())
+		return;
+	finish(GetTickCount64() + early_stop_ms >= cast.ends ? complete : interrupt);
+}
+
+// the server sends it to everyone in range, only our own casts are tracked
+bool CastTracker::on_begin_cast(const char* buffer, UINT len)
+{
+	if (len < sizeof(Zeal::Packets::BeginCast_Struct))
+		return false;
+	const Zeal::Packets::BeginCast_Struct* packet = reinterpret_cast<const Zeal::Packets::BeginCast_Struct*>(buffer);
+	Zeal::EqStructures::Entity* self = Zeal::EqGame::get_self();
+	Zeal::EqStructures::EQCHARINFO* char_info = Zeal::EqGame::get_char_info();
+	if (!self || !char_info || packet->caster_id != self->SpawnId)
+		return false;
+	if (casting())
+		finish(interrupt); //a new cast replaced one we never saw end
+	ULONGLONG now = GetTickCount64();
+	int gem = -1; //stays -1 for an item click, those are requested without a gem
+	for (int i = 0; requested_gem >= 0 && i < EQ_NUM_SPELL_GEMS; ++i)
+	{
+		if (char_info->MemorizedSpell[i] == static_cast<short>(packet->spell_id) && (gem < 0 || i == requested_gem))
+			gem = i;
+	}
+	cast.spell_id = packet->spell_id;
+	cast.gem = gem;
+	cast.started = now;
+	cast.ends = now + packet->cast_time;
+	cast.recovery_ends = cast.ends;
+	cast.recast_ends = cast.ends;
+	Zeal::EqStructures::SPELL* spell = ZealService::get_instance()->spell_index->get(packet->spell_id);
+	if (spell && gem >= 0)
+	{
+		cast.recovery_ends = cast.ends + spell->FizzleTime; //the recovery column, every gem waits for it
+		cast.recast_ends = cast.ends + std::max<DWORD>(spell->FizzleTime, spell->RecastTime);
+	}
+	requested_gem = -1;
+	requested_at = 0;
+	changes++;
+	publish(begin, cast);
+	return false;
+}
+
+void CastTracker::tick()
+{
+	if (casting() && GetTickCount64() >= cast.ends)
+		finish(complete);
+}
+
+void CastTracker::finish(event kind)
+{
+	cast_state ended = cast;
+	if (kind == complete)
+	{
+		recovery_ends = std::max(recovery_ends, ended.recovery_ends);
+		if (ended.gem >= 0)
+		{
+			Zeal::EqStructures::EQCHARINFO* char_info = Zeal::EqGame::get_char_info();
+			recast_ends[ended.gem] = ended.recast_ends;
+			recast_spell[ended.gem] = char_info ? char_info->MemorizedSpell[ended.gem] : -1;
+		}
+	}
+	cast = cast_state();
+	changes++;
+	publish(kind, ended);
+}
+
+void CastTracker::publish(event kind, const cast_state& state)
+{
+	named_pipe* pipe = ZealService::get_instance()->pipe.get();
+	if (!pipe)
+		return;
+	ULONGLONG now = GetTickCount64();
+	pipe_cast_record record = { kind, static_cast<UINT8>(state.gem >= 0 ? state.gem : 255), state.spell_id,
+		static_cast<INT32>(state.ends - state.started), kind == begin ? remaining(state.ends, now) : 0,
+		kind == interrupt ? 0 : remaining(state.recast_ends, now), kind == interrupt ? 0 : remaining(state.recovery_ends, now) };
+	static const char* event_names[] = { "", "begin", "complete", "interrupt" };
+	Zeal::EqStructures::SPELL* spell = ZealService::get_instance()->spell_index->get(state.spell_id);
+	nlohmann::json json = { {"event", event_names[kind]}, {"spell_id", state.spell_id}, {"name", spell && spell->Name ? spell->Name : ""},
+		{"gem", state.gem + 1}, {"cast_ms", record.cast_ms}, {"remaining_ms", record.remaining_ms}, {"ready_ms", record.ready_ms},
+		{"recovery_ms", record.recovery_ms} };
+	if (kind == begin)
+		json["stacks"] = BuffStacking::name(ZealService::get_instance()->buff_stacking->will_land(state.spell_id).fit);
+	pipe->write(json.dump(-1, ' ', false, nlohmann::json::error_handler_t::replace), pipe_data_type::cast);
+	pipe->write_binary(pipe_data_type::cast, std::string(reinterpret_cast<const char*>(&record), sizeof(record)));
+}
+
+void CastTracker::reset()
+{
+	cast = cast_state();
+	requested_gem = -1;
+	requested_at = 0;
+	recovery_ends = 0;
+	recast_ends.fill(0);
+	recast_spell.fill(-1);
+	changes++;
+}
+
+CastTracker::CastTracker(ZealService* zeal)
+{
+	recast_spell.fill(-1);
+	zeal->callbacks->add_generic([this]() { tick(); });
+	zeal->callbacks->add_generic([this]() { reset(); }, callback_type::Zone);
+	zeal->callbacks->add_generic([this]() { reset(); }, callback_type::CharacterSelect);
+	zeal->callbacks->add_packet([this](UINT opcode, char* buffer, UINT len) { return on_begin_cast(buffer, len); }, { Zeal::Packets::BeginCast });
+	zeal->labels_hook->add_gauge(24, "CastRemaining", { [this](std::string& text) {
+		int left = cast_remaining();
+		if (!left)
+		{
+			text.clear();
+			return 0;
+		}
+		char buffer[16];
+		snprintf(buffer, sizeof(buffer), "%.1f", left / 1000.f);
+		text = buffer;
+		ULONGLONG total = cast.ends - cast.started;
+		return total ? static_cast<int>(1000 - 1000 * left / total) : 1000;
+	}, 50 });
+	zeal->labels_hook->add_gauge(25, "SpellRecovery", { [this](std::string& text) {
+		int left = recovery_remaining();
+		if (!left)
+		{
+			text.clear();
+			return 0;
+		}
+		char buffer[16];
+		snprintf(buffer, sizeof(buffer), "%.1f", left / 1000.f);
+		text = buffer;
+		return std::min(1000, left * 1000 / 2500); //full at the usual 2.5s recovery
+	}, 50 });
+}
+
+CastTracker::~CastTracker()
+{
+}
@@ -0,0 +1,54 @@
+#pragma once
+#include <Windows.h>
+#include <array>
+#include "EqStructures.h"
+
+// the player's cast bar and spell gems as absolute GetTickCount64 times. the server's begin cast packet carries the real
+// cast time (focus and haste included) and the spell index the recovery and recast, so the melody, hotbutton macros, the
+// gauges and the pipe wait exactly until the cast lands and the gem is back instead of guessing with /pause
+class CastTracker
+{
+public:
+	enum event : UINT8
+	{
+		begin = 1,
+		complete = 2,
+		interrupt = 3
+	};
+	bool casting() const { return cast.spell_id != USHRT_MAX; }
+	bool pending() const; //a cast was requested and neither the begin cast nor a stop came back yet
+	WORD spell_id() const { return cast.spell_id; } //USHRT_MAX when not casting
+	int gem() const { return cast.gem; } //0 based, -1 for items and unknown gems
+	ULONGLONG cast_end() const { return cast.ends; }
+	int cast_remaining() const; //ms until the cast bar ends, 0 when not casting
+	int recovery_remaining() const; //ms until any gem can be cast, counting the recovery of the current cast
+	int ready_in(int gem) const; //ms until that gem can be cast, assuming the current cast completes
+	ULONGLONG gem_ready(int gem) const; //GetTickCount64 time for ready_in, 0 for a gem that is ready now
+	UINT version() const { return changes; } //bumped on every begin, completion and interrupt
+	void on_cast_request(UINT gem); //every cast request, from the CastSpell hook
+	void on_stop_cast(BYTE reason); //from the StopCast hook
+	CastTracker(class ZealService* zeal);
+	~CastTracker();
+private:
+	struct cast_state
+	{
+		WORD spell_id = USHRT_MAX;
+		int gem = -1;
+		ULONGLONG started = 0;
+		ULONGLONG ends = 0;
+		ULONGLONG recovery_ends = 0; //what completing it does to every gem
+		ULONGLONG recast_ends = 0; //and to its own
+	};
+	bool on_begin_cast(const char* buffer, UINT len);
+	void tick(); //completes the cast once its end passed
+	void finish(event kind);
+	void publish(event kind, const cast_state& state);
+	void reset();
+	cast_state cast;
+	int requested_gem = -1;
+	ULONGLONG requested_at = 0;
+	ULONGLONG recovery_ends = 0;
+	std::array<ULONGLONG, EQ_NUM_SPELL_GEMS> recast_ends = {};
+	std::array<short, EQ_NUM_SPELL_GEMS> recast_spell = {}; //a gem's recast only holds while the same spell stays memorized
+	UINT changes = 0;
+};
@@ -0,0 +1,171 @@
+#include "character_store.h"
+#include "Zeal.h"
+#include "EqFunctions.h"
+
+std::string CharacterStore::path(const std::string& name)
+{
+	return "characters\\" + name + ".zchar";
+}
+
+void CharacterStore::ensure_character()
+{
+	Zeal::EqStructures::Entity* self = Zeal::EqGame::get_self();
+	std::string name = self ? self->Name : "";
+	if (name.empty() || name == loaded)
+		return;
+	save();
+	loaded = name;
+	load();
+}
+
+void CharacterStore::preload(const std::string& name)
+{
+	if (name.empty() || name == loaded)
+		return;
+	save();
+	loaded = name;
+	load();
+}
+
+const std::string& CharacterStore::character()
+{
+	ensure_character();
+	return loaded;
+}
+
+void CharacterStore::load()
+{
+	records.clear();
+	changed = false;
+	HANDLE file = CreateFileA(path(loaded).c_str(), GENERIC_READ, FILE_SHARE_READ, NULL, OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL, NULL);
+	if (file == INVALID_HANDLE_VALUE)
+		return;
+	LARGE_INTEGER file_size = {};
+	HANDLE mapping = nullptr;
+	if (GetFileSizeEx(file, &file_size) && file_size.QuadPart >= (LONGLONG)sizeof(store_header))
+		mapping = CreateFileMappingA(file, NULL, PAGE_READONLY, 0, 0, NULL);
+	const char* view = mapping ? (const char*)MapViewOfFile(mapping, FILE_MAP_READ, 0, 0, 0) : nullptr;
+	if (view)
+	{
+		const store_header* header = (const store_header*)view;
+		const char* p = view + sizeof(store_header);
+		const char* end = view + file_size.QuadPart;
+		if (header->magic == store_magic && header->version == store_version)
+		{
+			for (UINT32 i = 0; i < header->record_count; i++)
+			{
+				UINT16 key_length;
+				UINT32 value_length;
+				if (end - p < (ptrdiff_t)(sizeof(key_length) + sizeof(value_length)))
+					break;
+				memcpy(&key_length, p, sizeof(key_length));
+				memcpy(&value_length, p + sizeof(key_length), sizeof(value_length));
+				p += sizeof(key_length) + sizeof(value_length);
+				if ((size_t)(end - p) < (size_t)key_length + value_length)
+					break; //truncated, keep what was whole
+				records[std::string(p, key_length)] = std::string(p + key_length, value_length);
+				p += key_length + value_length;
+			}
+		}
+		UnmapViewOfFile(view);
+	}
+	if (mapping)
+		CloseHandle(mapping);
+	CloseHandle(file);
+}
+
+void CharacterStore::save()
+{
+	if (!changed || loaded.empty())
+		return;
+	changed = false;
+	std::string buffer;
+	store_header header = { store_magic, store_version, static_cast<UINT32>(records.size()) };
+	buffer.append(reinterpret_cast<const char*>(&header), sizeof(header));
+	for (const auto& [key, value] : records)
+	{
+		UINT16 key_length = static_cast<UINT16>(key.length());
+		UINT32 value_length = static_cast<UINT32>(value.length());
+		buffer.append(reinterpret_cast<const char*>(&key_length), sizeof(key_length));
+		buffer.append(reinterpret_cast<const char*>(&value_length), sizeof(value_length));
+		buffer.append(key);
+		buffer.append(value);
+	}
+	CreateDirectoryA("characters", NULL);
+	std::string final_path = path(loaded);
+	std::string temp_path = final_path + ".tmp";
+	HANDLE file = CreateFileA(temp_path.c_str(), GENERIC_WRITE, 0, NULL, CREATE_ALWAYS, FILE_ATTRIBUTE_NORMAL, NULL);
+	if (file == INVALID_HANDLE_VALUE)
+	{
+		ZEAL_LOG_WARN("store", "could not create %s, error %u", temp_path, GetLastError());
+		changed = true;
+		return;
+	}
+	DWORD written = 0;
+	BOOL ok = WriteFile(file, buffer.data(), static_cast<DWORD>(buffer.length()), &written, NULL) && written == buffer.length();
+	ok = FlushFileBuffers(file) && ok;
+	CloseHandle(file);
+	if (!ok || !MoveFileExA(temp_path.c_str(), final_path.c_str(), MOVEFILE_REPLACE_EXISTING | MOVEFILE_WRITE_THROUGH))
+	{
+		ZEAL_LOG_WARN("store", "could not write %s, error %u", final_path, GetLastError());
+		DeleteFileA(temp_path.c_str());
+		changed = true; //try again on the next save
+	}
+}
+
+bool CharacterStore::get(const std::string& key, std::string& value)
+{
+	ensure_character();
+	auto it = records.find(key);
+	if (it == records.end())
+		return false;
+	value = it->second;
+	return true;
+}
+
+void CharacterStore::set(const std::string& key, const std::string& value)
+{
+	ensure_character();
+	if (loaded.empty() || key.length() > 0xFFFF)
+		return;
+	std::string& slot = records[key];
+	if (slot == value && !slot.empty())
+		return;
+	slot = value;
+	changed = true;
+}
+
+bool CharacterStore::erase(const std::string& key)
+{
+	ensure_character();
+	if (!records.erase(key))
+		return false;
+	changed = true;
+	return true;
+}
+
+std::vector<std::string> CharacterStore::keys(const std::string& prefix)
+{
+	ensure_character();
+	std::vector<std::string> out;
+	for (auto it = records.lower_bound(prefix); it != records.end() && it->first.compare(0, prefix.length(), prefix) == 0; ++it)
+		out.push_back(it->first);
+	return out;
+}
+
+CharacterStore::CharacterStore(ZealService* zeal)
+{
+	zeal->memory_report->add("character store", [this]() {
+		Zeal::Memory::usage use{ Zeal::Memory::node_bytes(records) + Zeal::Memory::string_bytes(loaded), records.size() };
+		for (const auto& [key, value] : records)
+			use.bytes += Zeal::Memory::string_bytes(key) + Zeal::Memory::string_bytes(value);
+		return use;
+	});
+	zeal->callbacks->add_work([this](int) { save(); return false; }, 5000, work_priority::low);
+	zeal->callbacks->add_generic([this]() { save(); }, callback_type::CharacterSelect);
+}
+
+CharacterStore::~CharacterStore()
+{
+	save();
+}
@@ -0,0 +1,57 @@
+#pragma once
+#include <Windows.h>
+#include <map>
+#include <string>
+#include <type_traits>
+#include <vector>
+
+// characters\<name>.zchar: a store_header followed by record_count records, each
+//   UINT16 key length, UINT32 value length, key, value
+static constexpr UINT32 store_magic = 0x52484358; //XCHR
+static constexpr UINT32 store_version = 1;
+struct store_header
+{
+	UINT32 magic;
+	UINT32 version;
+	UINT32 record_count;
+};
+
+// per character state that doesn't belong in the shared eqclient.ini sections, keyed by "feature/name" strings.
+// a character's file is mapped and copied out in one pass when it logs in, saves write the whole store to a temp
+// file in one call and rename it over the old one, so a crash mid write leaves the previous file intact
+class CharacterStore
+{
+public:
+	bool get(const std::string& key, std::string& value);
+	void set(const std::string& key, const std::string& value);
+	bool erase(const std::string& key);
+	std::vector<std::string> keys(const std::string& prefix); //sorted, with the prefix
+	template<typename T>
+	bool get(const std::string& key, T& value)
+	{
+		static_assert(std::is_trivially_copyable_v<T>, "fixed size values only");
+		std::string raw;
+		if (!get(key, raw) || raw.length() != sizeof(T))
+			return false;
+		memcpy(&value, raw.data(), sizeof(T));
+		return true;
+	}
+	template<typename T>
+	void set(const std::string& key, const T& value)
+	{
+		static_assert(std::is_trivially_copyable_v<T>, "fixed size values only");
+		set(key, std::string(reinterpret_cast<const char*>(&value), sizeof(T)));
+	}
+	const std::string& character(); //empty out of game
+	void preload(const std::string& name); //loads a character's store ahead of its login
+	void save(); //when anything changed since the last save
+	CharacterStore(class ZealService* zeal);
+	~CharacterStore();
+private:
+	static std::string path(const std::string& name);
+	void ensure_character();
+	void load();
+	std::string loaded;
+	std::map<std::string, std::string> records;
+	bool changed = false;
+};
@@ -57,28 +57,65 @@ std::string StripSpecialCharacters(const std::string& input) {
     return result;
 }
 
-std::string generateTimestampedString(const std::string& message, bool longform = true) {
-    time_t rawtime;
+static char* write_two_digits(char* out, int value)
+{
+    *out++ = static_cast<char>('0' + value / 10);
+    *out++ = static_cast<char>('0' + value % 10);
+    return out;
+}
+
+// the prefix only changes once a second so it is rebuilt when the second or the format changes
+struct timestamp_prefix
+{
+    time_t second = -1;
+    bool longform = false;
+    char text[16] = {};
+    size_t len = 0;
+};
+
+static const timestamp_prefix& get_timestamp_prefix(bool longform)
+{
+    static thread_local timestamp_prefix prefix;
+    time_t rawtime = time(nullptr);
+    if (rawtime == prefix.second && longform == prefix.longform)
+        return prefix;
     struct tm timeinfo;
-    time(&rawtime);
     localtime_s(&timeinfo, &rawtime);
-
-    std::ostringstream oss;
+    char* out = prefix.text;
+    *out++ = '[';
     if (longform)
     {
-        oss << "[" << std::setw(2) << std::setfill('0') << ((timeinfo.tm_hour % 12 == 0) ? 12 : timeinfo.tm_hour % 12) << ":"
-            << std::setw(2) << std::setfill('0') << timeinfo.tm_min << ":"
-            << std::setw(2) << std::setfill('0') << timeinfo.tm_sec << " "
-            << ((timeinfo.tm_hour >= 12) ? "PM" : "AM") << "] "
-            << message;
+        out = write_two_digits(out, (timeinfo.tm_hour % 12 == 0) ? 12 : timeinfo.tm_hour % 12);
+        *out++ = ':';
+        out = write_two_digits(out, timeinfo.tm_min);
+        *out++ = ':';
+        out = write_two_digits(out, timeinfo.tm_sec);
+        *out++ = ' ';
+        *out++ = (timeinfo.tm_hour >= 12) ? 'P' : 'A';
+        *out++ = 'M';
     }
     else
     {
-        oss << "[" << std::setw(2) << std::setfill('0') << timeinfo.tm_hour << ":"
-            << std::setw(2) << std::setfill('0') << timeinfo.tm_min << "] "
-            << message;
+        out = write_two_digits(out, timeinfo.tm_hour);
+        *out++ = ':';
+        out = write_two_digits(out, timeinfo.tm_min);
     }
-    return oss.str();
+    *out++ = ']';
+    *out++ = ' ';
+    prefix.len = out - prefix.text;
+    prefix.second = rawtime;
+    prefix.longform = longform;
+    return prefix;
+}
+
+// prefix + message in a per thread buffer that keeps its capacity between messages
+static const char* timestamp_message(const char* message, bool longform)
+{
+    static thread_local std::string buffer;
+    const timestamp_prefix& prefix = get_timestamp_prefix(longform);
+    buffer.assign(prefix.text, prefix.len);
+    buffer.append(message);
+    return buffer.c_str();
 }
 // Function to replace underscores with spaces in a word
 std::string replaceUnderscores(const std::smatch& match) {
@@ -89,20 +126,62 @@ std::string replaceUnderscores(const std::smatch& match) {
 
 
 
+// set while the original PrintChat runs with a timestamped copy so only the untouched text reaches the log
+static bool suppress_chat_log = false;
+
+void __cdecl LogChatText(const char* data)
+{
+    if (suppress_chat_log)
+        return;
+    hook_ref<LogChatText>::original()(data);
+}
+
+static void log_chat_line(const char* data)
+{
+    ChatLog* log = ZealService::get_instance()->chat_log.get();
+    if (log && log->enabled)
+        log->write(data); //queued for the background writer
+    else
+        hook_ref<LogChatText>::original()(data);
+}
+
 void __fastcall PrintChat(int t, int unused, const char* data, short color_index, bool u)
 {
     if (!data || strlen(data) == 0)
         return;
     chat* c = ZealService::get_instance()->chat_hook.get();
-    ZealService::get_instance()->pipe->chat_msg(data, color_index);
-
-
-
+    ChatRouter* router = ZealService::get_instance()->chat_router.get();
+    UINT8 route = router ? router->route(color_index) : route_all;
+    if (route & route_pipe)
+        ZealService::get_instance()->pipe->chat_msg(data, color_index);
+    if (ZealService::get_instance()->frame_profiler)
+        ZealService::get_instance()->frame_profiler->note_chat();
+    if (ZealService::get_instance()->packet_capture)
+        ZealService::get_instance()->packet_capture->record_chat(data, color_index);
+    if (ZealService::get_instance()->session_stats)
+        ZealService::get_instance()->session_stats->note_chat(data);
+    ZealService::get_instance()->guild_roster->note_chat(data);
+    if (ZealService::get_instance()->con_cache)
+        ZealService::get_instance()->con_cache->note_chat(data);
+    if (ZealService::get_instance()->input_history)
+        ZealService::get_instance()->input_history->note_chat(data);
+    if (color_index == USERCOLOR_TELL && strncmp(data, "You told", 8) && ZealService::get_instance()->audio && ZealService::get_instance()->audio->tell_sound.get())
+        ZealService::get_instance()->audio->play(audio_cue::tell);
+    if (route & route_triggers)
+        route &= ~ZealService::get_instance()->chat_triggers->process(data, color_index);
+    if (route & route_history)
+        ZealService::get_instance()->chat_history->add(data, color_index);
+    if (!(route & route_windows)) //no window draws it, only the log might still want it
+    {
+        if (u && (route & route_log))
+            log_chat_line(data);
+        return;
+    }
 
     if (color_index == 4 && c->bluecon)
         color_index = 325;
 
-    std::string data_str = data;
+    //std::string data_str = data;
     //if (data_str.length())
     //{
     //    data_str.erase(std::remove(data_str.begin(), data_str.end(), '#'), data_str.end());
@@ -112,48 +191,65 @@ void __fastcall PrintChat(int t, int unused, const char* data, short color_index
     //}
     if (c->timestamps && strlen(data) > 0) //remove phantom prints (the game also checks this, no idea why they are sending blank data in here sometimes
     {
-        mem::write<byte>(0x5380C9, 0xEB); // don't log information so we can manipulate data before between chat and logs
-        ZealService::get_instance()->hooks->hook_map["PrintChat"]->original(PrintChat)(t, unused, generateTimestampedString(data_str, c->timestamps==1).c_str(), color_index, false);
-        mem::write<byte>(0x5380C9, 0x75); //reset the logging
-        if (u)
-            reinterpret_cast<void(__cdecl*)( const char* data)>(0x5240dc)(data); //add to log
+        suppress_chat_log = true; // don't log information so we can manipulate data before between chat and logs
+        hook_ref<PrintChat>::original()(t, unused, timestamp_message(data, c->timestamps==1), color_index, false);
+        suppress_chat_log = false; //reset the logging
+        if (u && (route & route_log))
+            log_chat_line(data); //add to log
     }
     else
     {
-        ZealService::get_instance()->hooks->hook_map["PrintChat"]->original(PrintChat)(t, unused, data_str.c_str(), color_index, false);
-        if (u)
-            reinterpret_cast<void(__cdecl*)(const char* data)>(0x5240dc)(data); //add to log
+        hook_ref<PrintChat>::original()(t, unused, data, color_index, false);
+        if (u && (route & route_log))
+            log_chat_line(data); //add to log
     }
 
 
 }
 
-char* __fastcall StripName(int t, int unused, char* data)
+// every patched strip site calls StripName, which goes through one cached pointer that uniquenames swaps between the
+// client's strip and a pass through, so a combat line costs an indirect call whatever the setting
+using strip_name_fn = char* (__fastcall*)(int t, int unused, char* data);
+static char* __fastcall keep_name(int t, int unused, char* data)
 {
-    if (ZealService::get_instance()->hooks && ZealService::get_instance()->hooks->hook_map.count("StripName"))
-    {
-        if (ZealService::get_instance()->chat_hook->uniquenames)
-            return data;
-        else
-            return ZealService::get_instance()->hooks->hook_map["StripName"]->original(StripName)(t, unused, data);
-    }
     return data;
 }
+static strip_name_fn client_strip_name = keep_name;
+static strip_name_fn strip_name = keep_name;
+
+char* __fastcall StripName(int t, int unused, char* data)
+{
+    return strip_name(t, unused, data);
+}
 
-void chat::LoadSettings(IO_ini* ini)
+static constexpr int strip_name_sites[] = {
+    0x529A8b, 0x529B1D, 0x529b6d, 0x529b89, 0x529A55,
+    0x4EDBE5, 0x4EDBDA, 0x529371, 0x52933D, 0x5293EB, 0x529407, 0x529423, 0x5293CF, 0x5293B3, 0x5293A6 //killed msg
+};
+
+static int call_target(int site)
 {
-    if (!ini->exists("Zeal", "ChatTimestamps"))
-        ini->setValue<int>("Zeal", "ChatTimestamps", 0);
-    if (!ini->exists("Zeal", "Bluecon"))
-        ini->setValue<bool>("Zeal", "Bluecon", false);
-    if (!ini->exists("Zeal", "ZealInput"))
-        ini->setValue<bool>("Zeal", "ZealInput", false);
-    if (!ini->exists("Zeal", "UniqueNames"))
-        ini->setValue<bool>("Zeal", "UniqueNames", false);
-    uniquenames = ini->getValue<bool>("Zeal", "UniqueNames");
-    bluecon = ini->getValue<bool>("Zeal", "Bluecon");
-    timestamps = ini->getValue<int>("Zeal", "ChatTimestamps");
-    zealinput = ini->getValue<bool>("Zeal", "ZealInput");
+    if (*(BYTE*)site != 0xE8)
+        return 0;
+    return site + 5 + *(int*)(site + 1);
+}
+
+void chat::install_strip_name()
+{
+    if (strip_name_installed)
+        return;
+    strip_name_installed = true;
+    int target = call_target(strip_name_sites[0]);
+    if (!target)
+        return;
+    client_strip_name = reinterpret_cast<strip_name_fn>(target);
+    strip_name = uniquenames ? keep_name : client_strip_name;
+    ZealService* zeal = ZealService::get_instance();
+    for (int i = 0; i < static_cast<int>(sizeof(strip_name_sites) / sizeof(strip_name_sites[0])); i++)
+    {
+        if (call_target(strip_name_sites[i]) == target) //skips a site a patch or another client build has moved
+            zeal->hooks->Add<StripName>("StripName" + std::to_string(i), strip_name_sites[i], hook_type_replace_call);
+    }
 }
 
 enum class caret_dir : int
@@ -232,6 +328,10 @@ int __fastcall EditWndHandleKey(Zeal::EqUI::EditWnd* active_edit, int u, UINT32
         if (!active_edit->InputText.Data)
             active_edit->InputText.Assure(32, 0);
 
+        InputHistory* history = ZealService::get_instance()->input_history.get();
+        if (history && history->handle_key(active_edit, key, Zeal::EqGame::KeyMods->Ctrl))
+            return 0;
+
         static caret_dir last_highlight_dir = caret_dir::none;
 
         switch (key)
@@ -321,7 +421,7 @@ int __fastcall EditWndHandleKey(Zeal::EqUI::EditWnd* active_edit, int u, UINT32
             }
         }
     }
-    return ZealService::get_instance()->hooks->hook_map["EditWndHandleKey"]->original(EditWndHandleKey)(active_edit, u, key, modifier, keydown);
+    return hook_ref<EditWndHandleKey>::original()(active_edit, u, key, modifier, keydown);
 }
 
 
@@ -386,63 +486,50 @@ chat::chat(ZealService* zeal, IO_ini* ini)
             }
             return false; //return true to stop the game from processing any further on this command, false if you want to just add features to an existing cmd
         });
-    LoadSettings(ini);
-
-  /*  zeal->commands_hook->add("/uniquenaming", {}, "Toggles off the stripping of mob id and other identifiers from name of npc's (log only)",
-        [this, ini](std::vector<std::string>& args) {
-            uniquenames = !uniquenames;
+    zeal->commands_hook->add("/uniquenames", { "/uniquenaming" }, "Toggles off the stripping of mob id and other identifiers from name of npc's (log only)",
+        [this](std::vector<std::string>& args) {
+            uniquenames.set(!uniquenames);
             Zeal::EqGame::print_chat("Unique naming is %s", uniquenames ? "Enabled" : "Disabled");
             return true;
-        });*/
-
-    //zeal->hooks->Add("StripName", 0x529A8b, StripName, hook_type_replace_call); 
-    //zeal->hooks->Add("StripName1", 0x529B1D, StripName, hook_type_replace_call); 
-    //zeal->hooks->Add("StripName2", 0x529b6d, StripName, hook_type_replace_call);
-    //zeal->hooks->Add("StripName3", 0x529b89, StripName, hook_type_replace_call);
-    //zeal->hooks->Add("StripName4", 0x529A55, StripName, hook_type_replace_call);
-    //zeal->hooks->Add("StripName5", 0x4EDBE5, StripName, hook_type_replace_call); //killed msg
-    //zeal->hooks->Add("StripName6", 0x4EDBDA, StripName, hook_type_replace_call);//killed msg
-    //zeal->hooks->Add("StripName7", 0x529371, StripName, hook_type_replace_call);//killed msg
-    //zeal->hooks->Add("StripName8", 0x52933D, StripName, hook_type_replace_call);//killed msg
-    //zeal->hooks->Add("StripName9", 0x5293EB, StripName, hook_type_replace_call);//killed msg
-    //zeal->hooks->Add("StripName10", 0x529407, StripName, hook_type_replace_call);//killed msg
-    //zeal->hooks->Add("StripName11", 0x529423, StripName, hook_type_replace_call);//killed msg
-    //zeal->hooks->Add("StripName12", 0x5293CF, StripName, hook_type_replace_call);//killed msg
-    //zeal->hooks->Add("StripName13", 0x5293B3, StripName, hook_type_replace_call);//killed msg
-    //zeal->hooks->Add("StripName14", 0x5293A6, StripName, hook_type_replace_call);//killed msg
-    zeal->hooks->Add("PrintChat", 0x537f99, PrintChat, hook_type_detour); //add extra prints for new loot types
-    zeal->hooks->Add("EditWndHandleKey", 0x5A3010, EditWndHandleKey, hook_type_detour); //this makes more sense than the hook I had previously
+        });
+    uniquenames.on_change([this](bool enabled) {
+        if (enabled)
+            install_strip_name();
+        strip_name = enabled ? keep_name : client_strip_name;
+    });
+    if (uniquenames)
+        install_strip_name();
+    zeal->hooks->Add<LogChatText>("LogChatText", zeal->addresses->get(game_address::log_chat_text), hook_type_detour); //lets PrintChat skip logging with a flag instead of patching 0x5380C9 per message
+    zeal->hooks->Add<PrintChat>("PrintChat", zeal->addresses->get(game_address::print_chat), hook_type_detour); //add extra prints for new loot types
+    zeal->hooks->Add<EditWndHandleKey>("EditWndHandleKey", 0x5A3010, hook_type_detour); //this makes more sense than the hook I had previously
   
 }
 void chat::set_input(bool val)
 {
-    zealinput = val;
-    ZealService::get_instance()->ini->setValue<bool>("Zeal", "ZealInput", zealinput);
+    zealinput.set(val);
     if (zealinput)
         Zeal::EqGame::print_chat("Zeal special input enabled");
     else
         Zeal::EqGame::print_chat("Zeal special input disabled");
-    ZealService::get_instance()->ui->options->UpdateOptions();
+    ZealService::get_instance()->ui->options->changed(ui_options::option::input);
 }
 void chat::set_timestamp(int val)
 {
-    timestamps = val;
-    ZealService::get_instance()->ini->setValue<int>("Zeal", "ChatTimestamps", timestamps);
+    timestamps.set(val);
     if (timestamps)
         Zeal::EqGame::print_chat("Timestamps enabled");
     else
         Zeal::EqGame::print_chat("Timestamps disabled");
-    ZealService::get_instance()->ui->options->UpdateOptions();
+    ZealService::get_instance()->ui->options->changed(ui_options::option::timestamps);
 }
 void chat::set_bluecon(bool val)
 {
-    bluecon = val;
-    ZealService::get_instance()->ini->setValue<bool>("Zeal", "Bluecon", bluecon);
+    bluecon.set(val);
     if (bluecon)
         Zeal::EqGame::print_chat("Blue con color is now set to usercolor 70");
     else
         Zeal::EqGame::print_chat("Default blue con color.");
-    ZealService::get_instance()->ui->options->UpdateOptions();
+    ZealService::get_instance()->ui->options->changed(ui_options::option::blue_con);
 }
 chat::~chat()
 {
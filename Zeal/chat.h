@@ -2,14 +2,19 @@
 #include "hook_wrapper.h"
 #include "memory.h"
 #include "EqUI.h"
+#include <string>
+#include "settings.h"
+
+void __fastcall PrintChat(int t, int unused, const char* data, short color_index, bool u);
+void SetClipboardText(const std::string& text);
 
 class chat
 {
 public:
-	int timestamps = 0;
-	bool bluecon = false;
-	bool zealinput = false;
-	bool uniquenames = false;
+	Setting<int> timestamps{ "Zeal", "ChatTimestamps", 0 };
+	Setting<bool> bluecon{ "Zeal", "Bluecon", false };
+	Setting<bool> zealinput{ "Zeal", "ZealInput", false };
+	Setting<bool> uniquenames{ "Zeal", "UniqueNames", false };
 	void set_input_color(Zeal::EqUI::ARGBCOLOR col);
 	void set_bluecon(bool val);
 	void set_timestamp(int val);
@@ -17,5 +22,6 @@ public:
 	chat(class ZealService* pHookWrapper, class IO_ini* ini);
 	~chat();
 private:
-	void LoadSettings(class IO_ini* ini);
+	void install_strip_name(); //on the first enable of uniquenames, the client's call sites stay untouched until then
+	bool strip_name_installed = false;
 };
@@ -0,0 +1,237 @@
+#include "chat_history.h"
+#include "EqStructures.h"
+#include "EqAddresses.h"
+#include "EqFunctions.h"
+#include "Zeal.h"
+#include "string_util.h"
+#include <algorithm>
+#include <fstream>
+
+static unsigned char lower(unsigned char c)
+{
+	return (c >= 'A' && c <= 'Z') ? c + ('a' - 'A') : c;
+}
+
+static UINT trigram(const char* p)
+{
+	return (UINT)lower(p[0]) | ((UINT)lower(p[1]) << 8) | ((UINT)lower(p[2]) << 16);
+}
+
+void ChatHistory::collect_trigrams(const char* text, size_t length, std::vector<UINT>& out) const
+{
+	out.clear();
+	for (size_t i = 0; i + 3 <= length; i++)
+		out.push_back(trigram(text + i));
+	std::sort(out.begin(), out.end());
+	out.erase(std::unique(out.begin(), out.end()), out.end());
+}
+
+void ChatHistory::evict_oldest()
+{
+	const line& l = at(first_seq);
+	collect_trigrams(arena.data() + l.offset, l.length, scratch);
+	for (UINT t : scratch)
+	{
+		auto it = postings.find(t);
+		if (it == postings.end())
+			continue;
+		if (it->second.size() && it->second.front() == l.seq)
+			it->second.pop_front();
+		if (it->second.empty())
+			postings.erase(it);
+	}
+	first_seq++;
+}
+
+void ChatHistory::add(const char* text, short color_index)
+{
+	if (printing || !text)
+		return;
+	size_t length = strlen(text);
+	if (!length)
+		return;
+	if (length > max_line_length)
+		length = max_line_length;
+
+	if (write_pos + length > arena.size()) //lines never straddle the end, the tail is left unused
+		write_pos = 0;
+	while (size() && (size() == lines.size() || (at(first_seq).offset < write_pos + length && at(first_seq).offset + at(first_seq).length > write_pos)))
+		evict_oldest();
+
+	memcpy(arena.data() + write_pos, text, length);
+	line& l = lines[next_seq % lines.size()];
+	l.seq = next_seq;
+	l.offset = write_pos;
+	l.length = static_cast<USHORT>(length);
+	l.color_index = color_index;
+	l.time = time(nullptr);
+	collect_trigrams(text, length, scratch);
+	for (UINT t : scratch)
+		postings[t].push_back(l.seq);
+	write_pos += static_cast<UINT>(length);
+	next_seq++;
+}
+
+bool ChatHistory::contains(const line& l, const std::string& lowered) const
+{
+	const char* p = arena.data() + l.offset;
+	if (lowered.length() > l.length)
+		return false;
+	for (size_t i = 0; i + lowered.length() <= l.length; i++)
+	{
+		size_t j = 0;
+		while (j < lowered.length() && lower(p[i + j]) == static_cast<unsigned char>(lowered[j]))
+			j++;
+		if (j == lowered.length())
+			return true;
+	}
+	return false;
+}
+
+size_t ChatHistory::search(const char* text, size_t max_results, std::vector<const line*>& out) const
+{
+	out.clear();
+	std::string lowered = text ? text : "";
+	for (char& c : lowered)
+		c = static_cast<char>(lower(static_cast<unsigned char>(c)));
+	if (lowered.empty())
+		return 0;
+	if (lowered.length() < 3) //too short to index, the ring is small enough to scan
+	{
+		for (UINT seq = next_seq; seq != first_seq && out.size() < max_results; seq--)
+			if (contains(at(seq - 1), lowered))
+				out.push_back(&at(seq - 1));
+		return out.size();
+	}
+	//every candidate has to contain all trigrams, so walk only the rarest one's lines
+	const std::deque<UINT>* rarest = nullptr;
+	for (size_t i = 0; i + 3 <= lowered.length(); i++)
+	{
+		auto it = postings.find(trigram(lowered.c_str() + i));
+		if (it == postings.end())
+			return 0;
+		if (!rarest || it->second.size() < rarest->size())
+			rarest = &it->second;
+	}
+	for (auto it = rarest->rbegin(); it != rarest->rend() && out.size() < max_results; ++it)
+		if (contains(at(*it), lowered))
+			out.push_back(&at(*it));
+	return out.size();
+}
+
+size_t ChatHistory::find_color(short color_index, size_t max_results, std::vector<const line*>& out) const
+{
+	out.clear();
+	for (UINT seq = next_seq; seq != first_seq && out.size() < max_results; seq--)
+		if (at(seq - 1).color_index == color_index)
+			out.push_back(&at(seq - 1));
+	return out.size();
+}
+
+void ChatHistory::print_results(const std::vector<const line*>& results)
+{
+	printing = true;
+	for (auto it = results.rbegin(); it != results.rend(); ++it)
+	{
+		tm local;
+		localtime_s(&local, &(*it)->time);
+		Zeal::EqGame::print_chat("[%02d:%02d:%02d] %s", local.tm_hour, local.tm_min, local.tm_sec, text(**it).c_str());
+	}
+	printing = false;
+}
+
+size_t ChatHistory::export_to(const std::string& path) const
+{
+	std::ofstream file(path, std::ios::binary);
+	if (!file)
+		return 0;
+	size_t count = 0;
+	for (UINT seq = first_seq; seq != next_seq; seq++, count++)
+	{
+		const line& l = at(seq);
+		tm local;
+		localtime_s(&local, &l.time);
+		char stamp[32];
+		strftime(stamp, sizeof(stamp), "[%Y-%m-%d %H:%M:%S] ", &local);
+		file << stamp;
+		file.write(arena.data() + l.offset, l.length);
+		file << "\r\n";
+	}
+	return file ? count : 0;
+}
+
+ChatHistory::ChatHistory(ZealService* zeal, IO_ini* ini)
+{
+	lines.resize(std::clamp(line_cap.get(), 256, 65536));
+	arena.resize(static_cast<size_t>(std::clamp(arena_kb.get(), 64, 8192)) * 1024);
+	zeal->memory_report->add("chat history", [this]() {
+		Zeal::Memory::usage use{ Zeal::Memory::vector_bytes(lines) + Zeal::Memory::vector_bytes(arena) + Zeal::Memory::hash_bytes(postings) + Zeal::Memory::vector_bytes(scratch), size() };
+		for (const auto& [trigram, seqs] : postings)
+			use.bytes += seqs.size() * sizeof(UINT) + 32; //the deque's map and a partly used block
+		return use;
+	});
+	zeal->commands_hook->add("/chatsearch", {}, "Searches recent chat: /chatsearch <text>",
+		[this](std::vector<std::string>& args) {
+			if (args.size() < 2)
+			{
+				Zeal::EqGame::print_chat("usage: /chatsearch <text>");
+				return true;
+			}
+			std::string query = args[1];
+			for (size_t i = 2; i < args.size(); i++)
+				query += " " + args[i];
+			std::vector<const line*> results;
+			search(query.c_str(), 10, results);
+			print_results(results);
+			printing = true;
+			Zeal::EqGame::print_chat("%i match(es) for %s in the last %i lines", (int)results.size(), query.c_str(), (int)size());
+			printing = false;
+			return true;
+		});
+	zeal->commands_hook->add("/copytells", {}, "Copies the most recent tells to the clipboard: /copytells [count]",
+		[this](std::vector<std::string>& args) {
+			int count = 5;
+			if (args.size() > 1 && !Zeal::String::tryParse(args[1], &count))
+				count = 5;
+			if (count < 1)
+				count = 1;
+			std::vector<const line*> results;
+			find_color(USERCOLOR_TELL, count, results);
+			std::string clip;
+			for (auto it = results.rbegin(); it != results.rend(); ++it)
+				clip += text(**it) + "\r\n";
+			SetClipboardText(clip);
+			printing = true;
+			Zeal::EqGame::print_chat("Copied %i tell(s) to the clipboard", (int)results.size());
+			printing = false;
+			return true;
+		});
+	zeal->commands_hook->add("/chatexport", {}, "Writes the chat history to a file: /chatexport [file], defaults to Logs\\zeal_chat_<time>.txt",
+		[this](std::vector<std::string>& args) {
+			std::string path;
+			if (args.size() > 1)
+				path = args[1];
+			else
+			{
+				CreateDirectoryA("Logs", NULL);
+				time_t now = time(nullptr);
+				tm local;
+				localtime_s(&local, &now);
+				char name[64];
+				strftime(name, sizeof(name), "Logs\\zeal_chat_%Y%m%d_%H%M%S.txt", &local);
+				path = name;
+			}
+			size_t count = export_to(path);
+			printing = true;
+			if (count)
+				Zeal::EqGame::print_chat("Exported %i line(s) to %s, the history holds up to %i", (int)count, path.c_str(), (int)lines.size());
+			else
+				Zeal::EqGame::print_chat("Nothing exported to %s", path.c_str());
+			printing = false;
+			return true;
+		});
+}
+
+ChatHistory::~ChatHistory()
+{
+}
@@ -0,0 +1,50 @@
+#pragma once
+#include <Windows.h>
+#include <string>
+#include <vector>
+#include <deque>
+#include <unordered_map>
+#include <time.h>
+#include "settings.h"
+
+// recent chat lines kept in a fixed text arena with a trigram index, so searches never touch the game's window buffers or the log file
+// the oldest lines are evicted (and dropped from the index) once either the line ring or the arena is full. both caps come
+// from the ini and are sized once at startup, so a long session holds the same memory at hour eight as at minute one
+// this bounds zeal's copy only: the game's chat windows keep their own scrollback, which zeal doesn't map and doesn't trim
+class ChatHistory
+{
+public:
+	struct line
+	{
+		UINT seq;
+		UINT offset; //into the arena
+		USHORT length;
+		short color_index;
+		time_t time;
+	};
+	ChatHistory(class ZealService* zeal, class IO_ini* ini);
+	~ChatHistory();
+	void add(const char* text, short color_index);
+	size_t search(const char* text, size_t max_results, std::vector<const line*>& out) const; //newest first
+	size_t find_color(short color_index, size_t max_results, std::vector<const line*>& out) const; //newest first
+	std::string text(const line& l) const { return std::string(arena.data() + l.offset, l.length); }
+	size_t size() const { return next_seq - first_seq; }
+	size_t export_to(const std::string& path) const; //oldest first, returns the lines written
+	Setting<int> line_cap{ "Zeal", "ChatHistoryLines", 4096 }; //applied at startup
+	Setting<int> arena_kb{ "Zeal", "ChatHistoryKB", 512 }; //applied at startup
+private:
+	static constexpr size_t max_line_length = 2048;
+	const line& at(UINT seq) const { return lines[seq % lines.size()]; }
+	void evict_oldest();
+	void collect_trigrams(const char* text, size_t length, std::vector<UINT>& out) const;
+	bool contains(const line& l, const std::string& lowered) const;
+	void print_results(const std::vector<const line*>& results);
+	std::vector<line> lines;
+	std::vector<char> arena;
+	UINT write_pos = 0;
+	UINT first_seq = 0; //oldest line still held
+	UINT next_seq = 0;
+	std::unordered_map<UINT, std::deque<UINT>> postings; //trigram -> line seqs in ascending order
+	std::vector<UINT> scratch;
+	bool printing = false; //results echoed to chat are not recorded again
+};
@@ -0,0 +1,184 @@
+#include "chat_log.h"
+#include "EqStructures.h"
+#include "EqAddresses.h"
+#include "EqFunctions.h"
+#include "Zeal.h"
+#include "string_util.h"
+#include <time.h>
+
+void ChatLog::update_character()
+{
+	if (Zeal::EqGame::is_in_game() && Zeal::EqGame::get_self())
+		character = Zeal::EqGame::get_self()->Name;
+	else
+		character.clear();
+}
+
+void ChatLog::write(const char* text)
+{
+	if (!text || !*text)
+		return;
+	line l = { time(nullptr), character.length() ? character : "unknown", text };
+	if (!lines.push(std::move(l)))
+	{
+		SetEvent(wake_event); //full, let the writer catch up and drop this line rather than stall the game
+		return;
+	}
+}
+
+void ChatLog::set_enabled(bool val)
+{
+	enabled = val;
+	ZealService::get_instance()->ini->setValue<bool>("Zeal", "ChatLogWriter", enabled);
+}
+
+bool ChatLog::open_file(const std::string& name, log_file& file, const tm& local)
+{
+	int day = (local.tm_year + 1900) * 10000 + (local.tm_mon + 1) * 100 + local.tm_mday;
+	if (file.handle != INVALID_HANDLE_VALUE)
+	{
+		bool roll = (rollover == chat_log_rollover::daily && day != file.day) || (rollover == chat_log_rollover::size && file.size >= max_size);
+		if (!roll)
+			return true;
+		close_file(file);
+		if (rollover == chat_log_rollover::size)
+			file.part++;
+	}
+	CreateDirectoryA("Logs", NULL);
+	std::string path = "Logs\\zeal_" + name;
+	if (rollover == chat_log_rollover::daily)
+		path += "_" + std::to_string(day);
+	else if (rollover == chat_log_rollover::size && file.part)
+		path += "_" + std::to_string(file.part);
+	path += ".txt";
+	file.handle = CreateFileA(path.c_str(), FILE_APPEND_DATA, FILE_SHARE_READ | FILE_SHARE_WRITE, NULL, OPEN_ALWAYS, FILE_ATTRIBUTE_NORMAL, NULL);
+	if (file.handle == INVALID_HANDLE_VALUE)
+		return false;
+	LARGE_INTEGER size = {};
+	GetFileSizeEx(file.handle, &size);
+	file.size = size.QuadPart;
+	file.path = path;
+	file.day = day;
+	if (rollover == chat_log_rollover::size && file.size >= max_size) //a previous session already filled this part
+	{
+		close_file(file);
+		file.part++;
+		return open_file(name, file, local);
+	}
+	return true;
+}
+
+//lines still buffered belong to the file that is open now, a roll must not carry them into the next one
+void ChatLog::close_file(log_file& file)
+{
+	write_pending(file);
+	if (file.handle != INVALID_HANDLE_VALUE)
+		CloseHandle(file.handle);
+	file.handle = INVALID_HANDLE_VALUE;
+}
+
+void ChatLog::write_pending(log_file& file)
+{
+	if (!file.pending.size() || file.handle == INVALID_HANDLE_VALUE)
+		return;
+	DWORD written = 0;
+	WriteFile(file.handle, file.pending.data(), (DWORD)file.pending.size(), &written, NULL);
+	file.size += written;
+	file.pending.clear();
+}
+
+void ChatLog::drain()
+{
+	//eq log format, the prefix only changes once a second
+	static time_t prefix_time = -1;
+	static char prefix[64];
+	static tm local = {};
+	line l;
+	while (lines.pop(l))
+	{
+		if (l.time != prefix_time)
+		{
+			localtime_s(&local, &l.time);
+			strftime(prefix, sizeof(prefix), "[%a %b %d %H:%M:%S %Y] ", &local);
+			prefix_time = l.time;
+		}
+		log_file& file = files[l.character];
+		if (!open_file(l.character, file, local))
+			continue;
+		file.pending += prefix;
+		file.pending += l.text;
+		file.pending += "\r\n";
+		if (file.pending.size() >= flush_threshold || (rollover == chat_log_rollover::size && file.size + file.pending.size() >= max_size))
+			write_pending(file);
+	}
+}
+
+void ChatLog::flush_all(bool force)
+{
+	for (auto& [name, file] : files)
+	{
+		if (!file.pending.size() || file.handle == INVALID_HANDLE_VALUE)
+			continue;
+		write_pending(file);
+		if (fsync || force)
+			FlushFileBuffers(file.handle);
+	}
+}
+
+void ChatLog::writer_main()
+{
+	while (!end_thread)
+	{
+		WaitForSingleObject(wake_event, flush_interval);
+		drain();
+		flush_all(false);
+	}
+	drain();
+	flush_all(true);
+	for (auto& [name, file] : files)
+		close_file(file);
+}
+
+ChatLog::ChatLog(ZealService* zeal, IO_ini* ini)
+{
+	if (!ini->exists("Zeal", "ChatLogWriter"))
+		ini->setValue<bool>("Zeal", "ChatLogWriter", false);
+	if (!ini->exists("Zeal", "ChatLogFlushMs"))
+		ini->setValue<int>("Zeal", "ChatLogFlushMs", 1000);
+	if (!ini->exists("Zeal", "ChatLogFsync"))
+		ini->setValue<bool>("Zeal", "ChatLogFsync", false);
+	if (!ini->exists("Zeal", "ChatLogRollover"))
+		ini->setValue<int>("Zeal", "ChatLogRollover", static_cast<int>(chat_log_rollover::daily));
+	if (!ini->exists("Zeal", "ChatLogMaxMB"))
+		ini->setValue<int>("Zeal", "ChatLogMaxMB", 256);
+	enabled = ini->getValue<bool>("Zeal", "ChatLogWriter");
+	flush_interval = ini->getValue<int>("Zeal", "ChatLogFlushMs");
+	if (flush_interval < 10)
+		flush_interval = 10;
+	fsync = ini->getValue<bool>("Zeal", "ChatLogFsync");
+	rollover = static_cast<chat_log_rollover>(ini->getValue<int>("Zeal", "ChatLogRollover"));
+	int max_mb = ini->getValue<int>("Zeal", "ChatLogMaxMB");
+	max_size = static_cast<ULONGLONG>(max_mb > 0 ? max_mb : 256) * 1024 * 1024;
+
+	zeal->commands_hook->add("/chatlog", {}, "Toggles the background chat log writer (Logs\\zeal_<name>_<date>.txt) in place of the client's log",
+		[this](std::vector<std::string>& args) {
+			set_enabled(!enabled);
+			Zeal::EqGame::print_chat("Zeal chat log writer is %s", enabled ? "Enabled" : "Disabled");
+			return true;
+		});
+	update_character();
+	zeal->callbacks->add_generic([this]() { update_character(); }, callback_type::Zone);
+	zeal->callbacks->add_generic([this]() { update_character(); }, callback_type::InitUI);
+	zeal->callbacks->add_generic([this]() { character.clear(); }, callback_type::CharacterSelect);
+	wake_event = CreateEvent(NULL, FALSE, FALSE, NULL);
+	writer = std::thread([this]() { writer_main(); });
+}
+
+ChatLog::~ChatLog()
+{
+	end_thread = true;
+	SetEvent(wake_event);
+	if (writer.joinable())
+		writer.join();
+	CloseHandle(wake_event);
+}
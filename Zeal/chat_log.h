@@ -0,0 +1,58 @@
+#pragma once
+#include <Windows.h>
+#include <string>
+#include <thread>
+#include <atomic>
+#include <unordered_map>
+#include "spsc_queue.h"
+
+enum struct chat_log_rollover
+{
+	none,
+	daily, //one file per character per day
+	size //a new numbered file once the current one reaches ChatLogMaxMB
+};
+// optional replacement for the client's synchronous log append, PrintChat queues lines and a background thread batches them to disk
+class ChatLog
+{
+public:
+	ChatLog(class ZealService* zeal, class IO_ini* ini);
+	~ChatLog();
+	bool enabled = false;
+	void write(const char* text); //game thread only
+	void set_enabled(bool val);
+private:
+	struct line
+	{
+		time_t time;
+		std::string character;
+		std::string text;
+	};
+	struct log_file
+	{
+		HANDLE handle = INVALID_HANDLE_VALUE;
+		std::string path;
+		int day = -1; //yyyymmdd the file was opened for
+		int part = 0;
+		ULONGLONG size = 0;
+		std::string pending;
+	};
+	void update_character();
+	void writer_main();
+	void drain();
+	void flush_all(bool force);
+	bool open_file(const std::string& character, log_file& file, const tm& local);
+	void close_file(log_file& file);
+	void write_pending(log_file& file);
+	std::string character; //game thread only
+	spsc_queue<line> lines{ 4096 };
+	int flush_interval = 1000; //ms between appends
+	bool fsync = false; //FlushFileBuffers after every append
+	chat_log_rollover rollover = chat_log_rollover::daily;
+	ULONGLONG max_size = 256ull * 1024 * 1024;
+	size_t flush_threshold = 64 * 1024; //append early once this much is buffered for a character
+	std::unordered_map<std::string, log_file> files; //writer thread only
+	HANDLE wake_event = nullptr;
+	std::atomic<bool> end_thread = false;
+	std::thread writer;
+};
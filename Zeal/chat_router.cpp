@@ -0,0 +1,107 @@
+#include "chat_router.h"
+#include "Zeal.h"
+#include "EqFunctions.h"
+#include "string_util.h"
+#include <algorithm>
+
+static const char* route_names[] = { "windows", "log", "history", "pipe", "triggers" };
+static constexpr int route_count = 5;
+
+static std::string describe(UINT8 mask)
+{
+	std::string out;
+	for (int i = 0; i < route_count; i++)
+		if (mask & (1 << i))
+			out += std::string(out.length() ? " " : "") + route_names[i];
+	return out.length() ? out : "nowhere";
+}
+
+void ChatRouter::rebuild()
+{
+	routes.fill(route_all);
+	for (const rule& r : rules)
+		routes[r.color_index] = r.mask;
+}
+
+void ChatRouter::set_rule(short color_index, UINT8 mask)
+{
+	if (color_index < 0 || color_index >= color_count)
+		return;
+	rules.erase(std::remove_if(rules.begin(), rules.end(), [color_index](const rule& r) { return r.color_index == color_index; }), rules.end());
+	if (mask != route_all)
+		rules.push_back({ color_index, mask });
+	rebuild();
+	save();
+}
+
+void ChatRouter::save()
+{
+	ini->deleteSection("ChatRoutes");
+	for (size_t i = 0; i < rules.size(); i++)
+		ini->setValue<std::string>("ChatRoutes", std::to_string(i), std::to_string(rules[i].color_index) + "|" + std::to_string(rules[i].mask));
+}
+
+void ChatRouter::load()
+{
+	for (int i = 0; ini->exists("ChatRoutes", std::to_string(i)); i++)
+	{
+		std::vector<std::string> parts = Zeal::String::split(ini->getValue<std::string>("ChatRoutes", std::to_string(i)), "|");
+		int color_index = -1, mask = route_all;
+		if (parts.size() == 2 && Zeal::String::tryParse(parts[0], &color_index) && Zeal::String::tryParse(parts[1], &mask) && color_index >= 0 && color_index < color_count)
+			rules.push_back({ static_cast<short>(color_index), static_cast<UINT8>(mask & route_all) });
+	}
+	rebuild();
+}
+
+ChatRouter::ChatRouter(ZealService* zeal, IO_ini* _ini)
+{
+	ini = _ini;
+	load();
+	zeal->commands_hook->add("/chatroute", {}, "Routes chat by color index: /chatroute <color> [+|-]<windows|log|history|pipe|triggers>..., /chatroute <color> reset, /chatroute list",
+		[this](std::vector<std::string>& args) {
+			int color_index = -1;
+			if (args.size() > 2 && Zeal::String::tryParse(args[1], &color_index) && color_index >= 0 && color_index < color_count)
+			{
+				UINT8 mask = route(static_cast<short>(color_index));
+				for (size_t i = 2; i < args.size(); i++)
+				{
+					std::string name = args[i];
+					bool add = true, relative = name.length() && (name[0] == '+' || name[0] == '-');
+					if (relative)
+					{
+						add = name[0] == '+';
+						name.erase(0, 1);
+					}
+					if (Zeal::String::compare_insensitive(name, "reset"))
+					{
+						mask = route_all;
+						continue;
+					}
+					int bit = -1;
+					for (int r = 0; r < route_count; r++)
+						if (Zeal::String::compare_insensitive(name, route_names[r]))
+							bit = r;
+					if (bit < 0)
+					{
+						Zeal::EqGame::print_chat("Unknown route %s, use windows, log, history, pipe or triggers", name.c_str());
+						return true;
+					}
+					if (!relative && i == 2)
+						mask = 0; //a plain list replaces the route
+					mask = add ? (mask | (1 << bit)) : (mask & ~(1 << bit));
+				}
+				set_rule(static_cast<short>(color_index), mask);
+				Zeal::EqGame::print_chat("Color %i goes to: %s", color_index, describe(mask).c_str());
+				return true;
+			}
+			for (const rule& r : rules)
+				Zeal::EqGame::print_chat("Color %i goes to: %s", r.color_index, describe(r.mask).c_str());
+			if (!rules.size())
+				Zeal::EqGame::print_chat("Every color goes everywhere, route one with /chatroute <color> -windows");
+			return true;
+		});
+}
+
+ChatRouter::~ChatRouter()
+{
+}
@@ -0,0 +1,39 @@
+#pragma once
+#include <Windows.h>
+#include <array>
+#include <vector>
+
+// where a chat line goes after PrintChat has seen it
+enum chat_route : UINT8
+{
+	route_windows = 0x01, //the game's chat windows, the only part that redraws
+	route_log = 0x02,
+	route_history = 0x04,
+	route_pipe = 0x08,
+	route_triggers = 0x10,
+	route_all = 0x1F
+};
+
+// one route mask per color index, rebuilt from the rules whenever they change, so PrintChat dispatches a line with a
+// single table lookup. keyword routing stays with the trigger automaton (suppress and hide), which drops bits from the mask
+class ChatRouter
+{
+public:
+	static constexpr int color_count = 512;
+	UINT8 route(short color_index) const { return color_index >= 0 && color_index < color_count ? routes[color_index] : route_all; }
+	void set_rule(short color_index, UINT8 mask); //route_all removes the rule
+	ChatRouter(class ZealService* zeal, class IO_ini* ini);
+	~ChatRouter();
+private:
+	struct rule
+	{
+		short color_index;
+		UINT8 mask;
+	};
+	void rebuild();
+	void save();
+	void load();
+	std::vector<rule> rules;
+	std::array<UINT8, color_count> routes;
+	class IO_ini* ini = nullptr;
+};
@@ -0,0 +1,335 @@
+#include "chat_triggers.h"
+#include "EqStructures.h"
+#include "EqAddresses.h"
+#include "EqFunctions.h"
+#include "Zeal.h"
+#include "string_util.h"
+#include <queue>
+
+static const char* action_names[] = { "sound", "pipe", "suppress", "hide" };
+static constexpr int action_count = static_cast<int>(trigger_action::_count);
+
+static unsigned char lower(unsigned char c)
+{
+	return (c >= 'A' && c <= 'Z') ? c + ('a' - 'A') : c;
+}
+
+//longest run without wildcards, it is what the automaton looks for
+static std::string longest_literal(const std::string& glob)
+{
+	std::string best, current;
+	for (char c : glob)
+	{
+		if (c == '*' || c == '?')
+		{
+			if (current.length() > best.length())
+				best = current;
+			current.clear();
+		}
+		else
+			current += c;
+	}
+	if (current.length() > best.length())
+		best = current;
+	return best;
+}
+
+bool ChatTriggers::glob_match(const chat_trigger& t, const char* line, size_t len) const
+{
+	//iterative wildcard match over the lowered line, unanchored ends behave like a * on that side
+	const std::string& p = t.glob;
+	size_t start_limit = t.anchor_start ? 0 : len;
+	for (size_t start = 0; start <= start_limit; start++)
+	{
+		size_t pi = 0, li = start, star = std::string::npos, mark = 0;
+		bool ok = false;
+		while (true)
+		{
+			if (pi == p.length())
+			{
+				if (!t.anchor_end || li == len)
+				{
+					ok = true;
+					break;
+				}
+			}
+			else if (li < len && (p[pi] == '?' || p[pi] == line[li]))
+			{
+				pi++;
+				li++;
+				continue;
+			}
+			else if (p[pi] == '*')
+			{
+				star = pi++;
+				mark = li;
+				continue;
+			}
+			if (star != std::string::npos && mark < len)
+			{
+				pi = star + 1;
+				li = ++mark;
+				continue;
+			}
+			break;
+		}
+		if (ok)
+			return true;
+		if (p.length() && p[0] == '*') //a leading star already tried every start
+			break;
+	}
+	return false;
+}
+
+void ChatTriggers::build()
+{
+	nodes.clear();
+	nodes.push_back(node());
+	nodes[0].next.fill(-1);
+	output_next.assign(triggers.size(), -1);
+	always.clear();
+	seen.assign(triggers.size(), 0);
+	line_number = 0;
+	for (size_t i = 0; i < triggers.size(); i++)
+	{
+		std::string literal = longest_literal(triggers[i].glob);
+		if (literal.empty())
+		{
+			always.push_back((int)i);
+			continue;
+		}
+		int cur = 0;
+		for (unsigned char c : literal)
+		{
+			if (nodes[cur].next[c] < 0)
+			{
+				nodes[cur].next[c] = (int)nodes.size();
+				nodes.push_back(node());
+				nodes.back().next.fill(-1);
+			}
+			cur = nodes[cur].next[c];
+		}
+		output_next[i] = nodes[cur].output;
+		nodes[cur].output = (int)i;
+	}
+	//breadth first fail links, missing transitions are filled in so matching never follows fail links
+	std::queue<int> q;
+	for (int c = 0; c < 256; c++)
+	{
+		int n = nodes[0].next[c];
+		if (n < 0)
+			nodes[0].next[c] = 0;
+		else
+		{
+			nodes[n].fail = 0;
+			q.push(n);
+		}
+	}
+	while (!q.empty())
+	{
+		int cur = q.front();
+		q.pop();
+		int f = nodes[cur].fail;
+		nodes[cur].dict = nodes[f].output >= 0 ? f : nodes[f].dict;
+		for (int c = 0; c < 256; c++)
+		{
+			int n = nodes[cur].next[c];
+			if (n < 0)
+				nodes[cur].next[c] = nodes[f].next[c];
+			else
+			{
+				nodes[n].fail = nodes[f].next[c];
+				q.push(n);
+			}
+		}
+	}
+}
+
+UINT8 ChatTriggers::process(const char* line, short color_index)
+{
+	if (!triggers.size() || !line)
+		return 0;
+	size_t len = strlen(line);
+	lowered.resize(len);
+	for (size_t i = 0; i < len; i++)
+		lowered[i] = lower(line[i]);
+	line_number++;
+	if (!line_number) //wrapped, make sure nothing looks seen
+	{
+		std::fill(seen.begin(), seen.end(), 0);
+		line_number = 1;
+	}
+
+	UINT8 dropped = 0;
+	auto fire = [&](int index) {
+		if (seen[index] == line_number)
+			return;
+		seen[index] = line_number;
+		const chat_trigger& t = triggers[index];
+		if (!t.plain && !glob_match(t, lowered.c_str(), len))
+			return;
+		switch (t.action)
+		{
+		case trigger_action::sound:
+			if (ZealService::get_instance()->audio)
+				ZealService::get_instance()->audio->play(audio_cue::trigger);
+			break;
+		case trigger_action::pipe:
+		{
+			nlohmann::json data = { {"trigger", index}, {"pattern", t.pattern}, {"text", line}, {"color", color_index} };
+			ZealService::get_instance()->pipe->write(data.dump(-1, ' ', false, nlohmann::json::error_handler_t::replace), pipe_data_type::custom);
+			break;
+		}
+		case trigger_action::suppress:
+			dropped |= route_windows | route_log | route_history;
+			break;
+		case trigger_action::hide:
+			dropped |= route_windows;
+			break;
+		}
+	};
+
+	int state = 0;
+	for (size_t i = 0; i < len; i++)
+	{
+		state = nodes[state].next[(unsigned char)lowered[i]];
+		for (int n = nodes[state].output >= 0 ? state : nodes[state].dict; n >= 0; n = nodes[n].dict)
+		{
+			for (int t = nodes[n].output; t >= 0; t = output_next[t])
+			{
+				if (triggers[t].plain && (triggers[t].anchor_start || triggers[t].anchor_end))
+				{
+					//anchored plain text, the position of the hit decides
+					size_t tlen = triggers[t].glob.length();
+					size_t begin = i + 1 - tlen;
+					if ((triggers[t].anchor_start && begin != 0) || (triggers[t].anchor_end && i + 1 != len))
+						continue;
+				}
+				fire(t);
+			}
+		}
+	}
+	for (int t : always)
+		fire(t);
+	return dropped;
+}
+
+int ChatTriggers::add(trigger_action action, const std::string& pattern)
+{
+	chat_trigger t;
+	t.action = action;
+	t.pattern = pattern;
+	std::string body = pattern;
+	if (body.length() && body[0] == '^')
+	{
+		t.anchor_start = true;
+		body.erase(0, 1);
+	}
+	if (body.length() && body.back() == '$')
+	{
+		t.anchor_end = true;
+		body.pop_back();
+	}
+	for (char& c : body)
+		c = static_cast<char>(lower(static_cast<unsigned char>(c)));
+	if (body.empty())
+		return -1;
+	t.glob = body;
+	t.plain = body.find_first_of("*?") == std::string::npos;
+	triggers.push_back(t);
+	build();
+	return (int)triggers.size() - 1;
+}
+
+bool ChatTriggers::remove(size_t index)
+{
+	if (index >= triggers.size())
+		return false;
+	triggers.erase(triggers.begin() + index);
+	build();
+	return true;
+}
+
+void ChatTriggers::save()
+{
+	ini->deleteSection("ChatTriggers");
+	for (size_t i = 0; i < triggers.size(); i++)
+		ini->setValue<std::string>("ChatTriggers", std::to_string(i), std::string(action_names[static_cast<int>(triggers[i].action)]) + "|" + triggers[i].pattern);
+}
+
+void ChatTriggers::load()
+{
+	for (int i = 0; ini->exists("ChatTriggers", std::to_string(i)); i++)
+	{
+		std::string value = ini->getValue<std::string>("ChatTriggers", std::to_string(i));
+		size_t bar = value.find('|');
+		if (bar == std::string::npos)
+			continue;
+		std::string action = value.substr(0, bar);
+		for (int a = 0; a < action_count; a++)
+		{
+			if (Zeal::String::compare_insensitive(action, action_names[a]))
+			{
+				add(static_cast<trigger_action>(a), value.substr(bar + 1));
+				break;
+			}
+		}
+	}
+}
+
+ChatTriggers::ChatTriggers(ZealService* zeal, IO_ini* _ini)
+{
+	ini = _ini;
+	load();
+	zeal->commands_hook->add("/trigger", {}, "Chat triggers: /trigger add <sound|pipe|suppress|hide> <pattern>, /trigger remove <index>, /trigger list, /trigger clear",
+		[this](std::vector<std::string>& args) {
+			if (args.size() > 3 && Zeal::String::compare_insensitive(args[1], "add"))
+			{
+				std::string pattern = args[3];
+				for (size_t i = 4; i < args.size(); i++)
+					pattern += " " + args[i];
+				for (int a = 0; a < action_count; a++)
+				{
+					if (Zeal::String::compare_insensitive(args[2], action_names[a]))
+					{
+						int index = add(static_cast<trigger_action>(a), pattern);
+						if (index >= 0)
+						{
+							save();
+							Zeal::EqGame::print_chat("Trigger %i added: %s %s", index, action_names[a], pattern.c_str());
+						}
+						return true;
+					}
+				}
+				Zeal::EqGame::print_chat("Unknown trigger action %s, use sound, pipe, suppress or hide", args[2].c_str());
+			}
+			else if (args.size() == 3 && Zeal::String::compare_insensitive(args[1], "remove"))
+			{
+				int index = -1;
+				if (Zeal::String::tryParse(args[2], &index) && remove(index))
+				{
+					save();
+					Zeal::EqGame::print_chat("Trigger %i removed", index);
+				}
+			}
+			else if (args.size() == 2 && Zeal::String::compare_insensitive(args[1], "clear"))
+			{
+				triggers.clear();
+				build();
+				save();
+				Zeal::EqGame::print_chat("Triggers cleared");
+			}
+			else
+			{
+				for (size_t i = 0; i < triggers.size(); i++)
+					Zeal::EqGame::print_chat("[%i] %s %s", (int)i, action_names[static_cast<int>(triggers[i].action)], triggers[i].pattern.c_str());
+				if (!triggers.size())
+					Zeal::EqGame::print_chat("No triggers, add one with /trigger add <sound|pipe|suppress|hide> <pattern>");
+			}
+			return true;
+		});
+}
+
+ChatTriggers::~ChatTriggers()
+{
+}
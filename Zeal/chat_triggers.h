@@ -0,0 +1,58 @@
+#pragma once
+#include <Windows.h>
+#include <string>
+#include <vector>
+#include <array>
+#include "chat_router.h"
+
+enum struct trigger_action
+{
+	sound, //system notification sound
+	pipe, //custom pipe message with the trigger and the line
+	suppress, //the line is neither shown nor logged
+	hide, //kept out of the chat windows, still logged and kept in the history
+	_count
+};
+// pattern syntax, always case insensitive:
+//   plain text matches anywhere in the line
+//   * and ? are wildcards, a leading ^ or trailing $ anchors the pattern to the start or end of the line
+// every pattern contributes its longest literal run to one aho-corasick automaton, so a line is scanned once no matter
+// how many triggers exist and only patterns whose literal was seen get their glob checked
+struct chat_trigger
+{
+	trigger_action action;
+	std::string pattern;
+	std::string glob; //lowercased pattern without anchors
+	bool anchor_start = false;
+	bool anchor_end = false;
+	bool plain = true; //the literal is the whole pattern, a hit needs no further check
+};
+class ChatTriggers
+{
+public:
+	ChatTriggers(class ZealService* zeal, class IO_ini* ini);
+	~ChatTriggers();
+	UINT8 process(const char* line, short color_index); //chat_route bits the line is dropped from
+	int add(trigger_action action, const std::string& pattern);
+	bool remove(size_t index);
+private:
+	struct node
+	{
+		std::array<int, 256> next; //full transition table once built
+		int fail = 0;
+		int output = -1; //first pattern ending here, chained through output_next
+		int dict = -1; //nearest node down the fail chain with an output
+	};
+	void build();
+	void save();
+	void load();
+	bool glob_match(const chat_trigger& t, const char* line, size_t len) const;
+	std::vector<chat_trigger> triggers;
+	std::vector<node> nodes;
+	std::vector<int> output_next; //per trigger, the next trigger ending on the same node
+	std::vector<int> always; //triggers with no literal run, checked on every line
+	std::vector<UINT> seen; //per trigger, line number it was last evaluated for
+	UINT line_number = 0;
+	std::string lowered; //reused per line
+	class IO_ini* ini = nullptr;
+};
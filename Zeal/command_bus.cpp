@@ -0,0 +1,166 @@
+#include "command_bus.h"
+#include "EqStructures.h"
+#include "EqAddresses.h"
+#include "EqFunctions.h"
+#include "Zeal.h"
+#include "string_util.h"
+
+static std::string join_args(const std::vector<std::string>& args, size_t first)
+{
+	std::string result;
+	for (size_t i = first; i < args.size(); i++)
+	{
+		if (!result.empty())
+			result += " ";
+		result += args[i];
+	}
+	return result;
+}
+
+bool CommandBus::publish(const std::string& target, const std::string& command, bool include_self)
+{
+	if (!bus)
+	{
+		Zeal::EqGame::print_chat("The command bus isn't available");
+		return false;
+	}
+	if (executing)
+	{
+		Zeal::EqGame::print_chat("A broadcast command can't broadcast again");
+		return false;
+	}
+	if (command.empty() || command.length() >= sizeof(command_bus_entry::command))
+		return false;
+	LONG ticket = InterlockedIncrement(&bus->write_index) - 1;
+	command_bus_entry& e = bus->entries[static_cast<ULONG>(ticket) % command_bus_entries];
+	InterlockedExchange(&e.sequence, 0); //readers that reach it wait until it is published
+	e.sender_pid = GetCurrentProcessId();
+	e.include_sender = include_self;
+	strncpy_s(e.target, sizeof(e.target), target.c_str(), _TRUNCATE);
+	strncpy_s(e.command, sizeof(e.command), command.c_str(), _TRUNCATE);
+	InterlockedExchange(&e.sequence, ticket + 1);
+	return true;
+}
+
+void CommandBus::execute(const char* command)
+{
+	Zeal::EqStructures::Entity* self = Zeal::EqGame::get_self();
+	if (!self || !Zeal::EqGame::is_in_game())
+		return; //stale by the time we are back in game
+	executing = true;
+	Zeal::EqGame::interpret_command(command);
+	executing = false;
+}
+
+void CommandBus::pump()
+{
+	if (!bus)
+		return;
+	LONG write = bus->write_index;
+	if (write - cursor > command_bus_entries) //lapped, the oldest entries are gone
+		cursor = write - command_bus_entries;
+	DWORD pid = GetCurrentProcessId();
+	while (cursor != write)
+	{
+		command_bus_entry& e = bus->entries[static_cast<ULONG>(cursor) % command_bus_entries];
+		LONG sequence = e.sequence;
+		if (sequence != cursor + 1)
+		{
+			if (sequence - (cursor + 1) > 0) //already overwritten by a later lap
+			{
+				cursor++;
+				continue;
+			}
+			ULONGLONG now = GetTickCount64();
+			if (!stalled_since)
+				stalled_since = now;
+			if (now - stalled_since < 1000)
+				break; //still being written, try again next frame
+			stalled_since = 0;
+			cursor++;
+			continue;
+		}
+		stalled_since = 0;
+		char target[sizeof(e.target)];
+		char command[sizeof(e.command)];
+		UINT32 sender = e.sender_pid;
+		bool include_sender = e.include_sender != 0;
+		memcpy(target, e.target, sizeof(target));
+		memcpy(command, e.command, sizeof(command));
+		MemoryBarrier();
+		cursor++;
+		if (e.sequence != sequence) //a writer took the entry while we copied it
+			continue;
+		target[sizeof(target) - 1] = 0;
+		command[sizeof(command) - 1] = 0;
+		if (sender == pid && !include_sender)
+			continue;
+		if (target[0])
+		{
+			Zeal::EqStructures::Entity* self = Zeal::EqGame::get_self();
+			if (!self || !Zeal::String::compare_insensitive(target, self->Name))
+				continue;
+		}
+		execute(command);
+	}
+}
+
+CommandBus::CommandBus(ZealService* zeal)
+{
+	mapping = CreateFileMappingA(INVALID_HANDLE_VALUE, NULL, PAGE_READWRITE, 0, sizeof(command_bus_section), "Local\\zeal_bus");
+	if (!mapping)
+		return;
+	bool created = GetLastError() != ERROR_ALREADY_EXISTS;
+	bus = reinterpret_cast<command_bus_section*>(MapViewOfFile(mapping, FILE_MAP_ALL_ACCESS, 0, 0, sizeof(command_bus_section)));
+	if (bus && created) //new section, zero filled
+	{
+		bus->version = command_bus_version;
+		bus->entry_count = command_bus_entries;
+	}
+	if (bus && bus->version && (bus->version != command_bus_version || bus->entry_count != command_bus_entries))
+	{
+		UnmapViewOfFile(bus); //a client with another layout owns the section
+		bus = nullptr;
+	}
+	if (!bus)
+	{
+		CloseHandle(mapping);
+		mapping = nullptr;
+		return;
+	}
+	cursor = bus->write_index; //only commands sent from now on
+
+	zeal->commands_hook->add("/bca", {}, "Runs a command on every other Zeal client on this machine.",
+		[this](std::vector<std::string>& args) {
+			if (args.size() < 2)
+				Zeal::EqGame::print_chat("usage: /bca <command>");
+			else
+				publish("", join_args(args, 1), false);
+			return true;
+		});
+	zeal->commands_hook->add("/bcaa", {}, "Runs a command on every Zeal client on this machine, this one included.",
+		[this](std::vector<std::string>& args) {
+			if (args.size() < 2)
+				Zeal::EqGame::print_chat("usage: /bcaa <command>");
+			else
+				publish("", join_args(args, 1), true);
+			return true;
+		});
+	zeal->commands_hook->add("/bct", {}, "Runs a command on the Zeal client logged in as the named character.",
+		[this](std::vector<std::string>& args) {
+			if (args.size() < 3)
+				Zeal::EqGame::print_chat("usage: /bct <character> <command>");
+			else
+				publish(args[1], join_args(args, 2), true);
+			return true;
+		});
+	zeal->callbacks->add_generic([this]() { pump(); }, callback_type::MainLoop);
+}
+
+CommandBus::~CommandBus()
+{
+	if (bus)
+		UnmapViewOfFile(bus);
+	if (mapping)
+		CloseHandle(mapping);
+}
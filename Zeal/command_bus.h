@@ -0,0 +1,42 @@
+#pragma once
+#include <Windows.h>
+#include <string>
+
+// command broadcast between the Zeal clients on this machine through the named section Local\zeal_bus
+// any client may publish: take a ticket from write_index, clear the entry's sequence, fill it, then set sequence to ticket + 1
+// every client reads every entry with its own cursor, so this is a broadcast ring rather than a work queue
+static constexpr UINT32 command_bus_version = 1;
+static constexpr int command_bus_entries = 64;
+#pragma pack(push, 4)
+struct command_bus_entry
+{
+	volatile LONG sequence; //ticket + 1 once published, 0 while being written
+	UINT32 sender_pid;
+	UINT32 include_sender;
+	char target[64]; //character name, empty for everyone
+	char command[256];
+};
+struct command_bus_section
+{
+	UINT32 version;
+	UINT32 entry_count;
+	volatile LONG write_index; //next ticket
+	command_bus_entry entries[command_bus_entries];
+};
+#pragma pack(pop)
+
+class CommandBus
+{
+public:
+	CommandBus(class ZealService* zeal);
+	~CommandBus();
+	bool publish(const std::string& target, const std::string& command, bool include_self);
+private:
+	void pump();
+	void execute(const char* command);
+	HANDLE mapping = nullptr;
+	command_bus_section* bus = nullptr;
+	LONG cursor = 0; //next ticket this client reads
+	ULONGLONG stalled_since = 0; //an entry left half written by a client that died is skipped after a second
+	bool executing = false; //received commands may not publish again
+};
@@ -7,6 +7,8 @@
 #include <algorithm>
 #include <cctype>
 #include "string_util.h"
+#include "hook_test.h"
+#include "profiler.h"
 
 
 void ChatCommands::print_commands()
@@ -35,49 +37,91 @@ void ChatCommands::print_commands()
 	Zeal::EqGame::print_chat(ss.str());
 }
 
+static std::string lowercase(std::string_view text)
+{
+	std::string result(text);
+	for (char& c : result)
+		c = static_cast<char>(std::tolower(static_cast<unsigned char>(c)));
+	return result;
+}
+
+ZealCommand* ChatCommands::find(std::string_view name)
+{
+	char lowered[64];
+	if (name.empty() || name.length() >= sizeof(lowered))
+		return nullptr;
+	for (size_t i = 0; i < name.length(); i++)
+		lowered[i] = static_cast<char>(std::tolower(static_cast<unsigned char>(name[i])));
+	auto it = lookup.find(std::string_view(lowered, name.length()));
+	return it == lookup.end() ? nullptr : it->second;
+}
+
 void __fastcall InterpretCommand(int c, int unused, int player, char* cmd)
 {
 	ZealService* zeal = ZealService::get_instance();
-	std::string str_cmd = Zeal::String::trim_and_reduce_spaces(cmd);
-	if (str_cmd.length() == 0)
+	//split in place, only a matching zeal command pays for building the argument strings
+	static std::vector<std::string_view> tokens;
+	tokens.clear();
+	for (const char* p = cmd; *p; )
+	{
+		while (*p && std::isspace(static_cast<unsigned char>(*p)))
+			p++;
+		const char* begin = p;
+		while (*p && !std::isspace(static_cast<unsigned char>(*p)))
+			p++;
+		if (p != begin)
+			tokens.emplace_back(begin, p - begin);
+	}
+	if (tokens.empty())
 		return;
-	if (str_cmd.length()>0 && str_cmd.front() != '/')
-		str_cmd = "/" + str_cmd;
-	std::vector<std::string> args = Zeal::String::split(str_cmd," ");
-	const std::string& cmd_name = args.front();
-	if (!args.empty() && !cmd_name.empty() && Zeal::EqGame::is_in_game())
+	char prefixed[64];
+	std::string_view cmd_name = tokens.front();
+	if (cmd_name.front() != '/' && cmd_name.length() + 1 < sizeof(prefixed))
 	{
-		bool cmd_handled = false;
-		auto& command_functions = zeal->commands_hook->CommandFunctions;
-		if (command_functions.count(cmd_name))
-		{
-			cmd_handled = command_functions[args[0]].callback(args);
-		} 
-		else
+		prefixed[0] = '/';
+		memcpy(prefixed + 1, cmd_name.data(), cmd_name.length());
+		cmd_name = std::string_view(prefixed, cmd_name.length() + 1);
+	}
+	if (Zeal::EqGame::is_in_game())
+	{
+		ZealCommand* command = zeal->commands_hook->find(cmd_name);
+		if (command && command->callback)
 		{
-			//attempt to find and call the function via an alias
-			for (const auto& command_pair : command_functions) {
-				const auto& command = command_pair.second;
-				if (command.callback && !command.aliases.empty()) {
-					for (const auto alias : command.aliases) {
-						if (!alias.empty() && alias == cmd_name) {
-							cmd_handled = command.callback(args);
-							break;
-						}
-					}
-				}
-			}
-		}
-		if (cmd_handled) {
-			return;
+			std::vector<std::string> args;
+			args.reserve(tokens.size());
+			args.emplace_back(cmd_name);
+			for (size_t i = 1; i < tokens.size(); i++)
+				args.emplace_back(tokens[i]);
+			if (command->callback(args))
+				return;
 		}
 	}
-	zeal->hooks->hook_map["commands"]->original(InterpretCommand)(c, unused, player, cmd);
+	hook_ref<InterpretCommand>::original()(c, unused, player, cmd);
 }
 
 void ChatCommands::add(std::string cmd, std::vector<std::string>aliases, std::string description, std::function<bool(std::vector<std::string>&args)> callback)
 {
-	CommandFunctions[cmd] = ZealCommand(aliases, description, callback);
+	auto existing = CommandFunctions.find(cmd);
+	if (existing != CommandFunctions.end()) //re-registration replaces the old aliases too
+	{
+		for (const auto& alias : existing->second.aliases)
+		{
+			auto it = lookup.find(lowercase(alias));
+			if (it != lookup.end() && it->second == &existing->second)
+				lookup.erase(it);
+		}
+	}
+	ZealCommand& command = CommandFunctions[cmd];
+	command = ZealCommand(aliases, description, callback);
+	lookup[lowercase(cmd)] = &command; //map nodes never move, the pointer stays valid
+	for (const auto& alias : command.aliases)
+	{
+		if (alias.empty())
+			continue;
+		std::string key = lowercase(alias);
+		if (!CommandFunctions.count(key)) //a command's own name wins over another command's alias
+			lookup.emplace(key, &command);
+	}
 }
 
 ChatCommands::~ChatCommands()
@@ -101,43 +145,6 @@ ChatCommands::ChatCommands(ZealService* zeal)
 			}
 			return false;
 		});
-	add("/corpsedrag", { "/drag"}, "Attempts to corpse drag your current target.",
-		[](std::vector<std::string>& args) {
-			if (args.size() == 1)
-			{
-				if (Zeal::EqGame::get_target())
-				{
-					Zeal::Packets::CorpseDrag_Struct tmp;
-					memset(&tmp, 0, sizeof(tmp));
-					strcpy_s(tmp.CorpseName, 30, Zeal::EqGame::get_target()->Name);
-					strcpy_s(tmp.DraggerName, 30, Zeal::EqGame::get_self()->Name);
-					Zeal::EqGame::send_message(Zeal::Packets::opcodes::CorpseDrag, (int*)&tmp, sizeof(tmp), 0);
-				}
-				return true; //return true to stop the game from processing any further on this command, false if you want to just add features to an existing cmd
-			}
-			return false;
-		});
-	add("/corpsedrop", { "/drop"}, "Attempts to drop a corpse (your current target). To drop all use /corpsedrop all",
-		[](std::vector<std::string>& args) {
-			if (args.size() == 1)
-			{
-				if (Zeal::EqGame::get_target())
-				{
-					Zeal::Packets::CorpseDrag_Struct tmp;
-					memset(&tmp, 0, sizeof(tmp));
-					strcpy_s(tmp.CorpseName, 30, Zeal::EqGame::get_target()->Name);
-					strcpy_s(tmp.DraggerName, 30, Zeal::EqGame::get_self()->Name);
-					Zeal::EqGame::send_message(Zeal::Packets::opcodes::CorpseDrop, (int*)&tmp, sizeof(tmp), 0);
-				}
-				return true; //return true to stop the game from processing any further on this command, false if you want to just add features to an existing cmd
-			}
-			else if (Zeal::String::compare_insensitive(args[1], "all"))
-			{
-				Zeal::EqGame::send_message(Zeal::Packets::opcodes::CorpseDrop, 0, 0, 0);
-				return true;
-			}
-			return false;
-		});
 	add("/trade", { "/opentrade", "/ot" }, "Opens a trade window with your current target.",
 		[](std::vector<std::string>& args) {
 			if (args.size() == 1)
@@ -148,7 +155,7 @@ ChatCommands::ChatCommands(ZealService* zeal)
 					memset(&tmp, 0, sizeof(tmp));
 					tmp.from_id = Zeal::EqGame::get_self()->SpawnId;
 					tmp.to_id = Zeal::EqGame::get_target()->SpawnId;
-					Zeal::EqGame::send_message(Zeal::Packets::opcodes::RequestTrade, (int*)&tmp, sizeof(tmp), 0);
+					ZealService::get_instance()->packets->send(Zeal::Packets::opcodes::RequestTrade, &tmp, sizeof(tmp), packet_priority::normal, tmp.to_id);
 				}
 				return true; //return true to stop the game from processing any further on this command, false if you want to just add features to an existing cmd
 			}
@@ -282,7 +289,12 @@ ChatCommands::ChatCommands(ZealService* zeal)
 			return true;
 		});
 	add("/reloadskin", {}, "Reload your current ui with ini.",
-		[this](std::vector<std::string>& args) {
+		[this, zeal](std::vector<std::string>& args) {
+			if (zeal->zone_warmup)
+			{
+				zeal->zone_warmup->reload_skin();
+				return true;
+			}
 			mem::write<BYTE>(0x8092d9, 1); //reload skin
 			mem::write<BYTE>(0x8092da, 1);  //reload with ui
 			return true;
@@ -369,6 +381,74 @@ ChatCommands::ChatCommands(ZealService* zeal)
 			}
 			return false;
 		});
-	zeal->hooks->Add("commands", Zeal::EqGame::EqGameInternal::fn_interpretcmd, InterpretCommand, hook_type_detour);
+	add("/hooktest", {}, "Self tests each hook type on synthetic functions, /hooktest bench also times the per call cost.",
+		[](std::vector<std::string>& args) {
+			std::vector<std::string> report;
+			bool passed = Zeal::HookTest::run(args.size() > 1 && Zeal::String::compare_insensitive(args[1], "bench"), report);
+			for (const auto& line : report)
+				Zeal::EqGame::print_chat(line);
+			Zeal::EqGame::print_chat(passed ? "Hook self test passed" : "Hook self test FAILED");
+			return true;
+		});
+	add("/zealprof", {}, "Times every hook and callback, /zealprof on|off|reset|pipe or /zealprof [count] to list the heaviest.",
+		[zeal](std::vector<std::string>& args) {
+			int count = 10;
+			if (args.size() > 1 && Zeal::String::compare_insensitive(args[1], "on"))
+			{
+				Zeal::Profiler::set_enabled(true);
+				Zeal::EqGame::print_chat("Profiler enabled");
+			}
+			else if (args.size() > 1 && Zeal::String::compare_insensitive(args[1], "off"))
+			{
+				Zeal::Profiler::set_enabled(false);
+				Zeal::EqGame::print_chat("Profiler disabled");
+			}
+			else if (args.size() > 1 && Zeal::String::compare_insensitive(args[1], "reset"))
+			{
+				Zeal::Profiler::reset();
+				Zeal::EqGame::print_chat("Profiler counters cleared");
+			}
+			else if (args.size() > 1 && Zeal::String::compare_insensitive(args[1], "pipe"))
+			{
+				if (args.size() > 2)
+					Zeal::String::tryParse(args[2], &count);
+				zeal->pipe->write(Zeal::Profiler::to_json(count > 0 ? count : 10), pipe_data_type::custom);
+			}
+			else
+			{
+				if (args.size() > 1)
+					Zeal::String::tryParse(args[1], &count);
+				if (!Zeal::Profiler::enabled)
+					Zeal::EqGame::print_chat("Profiler is off, /zealprof on to start collecting");
+				for (const auto& line : Zeal::Profiler::report(count > 0 ? count : 10))
+					Zeal::EqGame::print_chat(line);
+			}
+			return true;
+		});
+	add("/zealtrace", {}, "Records every hook, callback and long operation as spans, /zealtrace start|stop writes a chrome trace file.",
+		[](std::vector<std::string>& args) {
+			if (args.size() > 1 && Zeal::String::compare_insensitive(args[1], "start"))
+			{
+				Zeal::Profiler::start_trace();
+				Zeal::EqGame::print_chat("Trace started, /zealtrace stop to write it out");
+			}
+			else if (args.size() > 1 && Zeal::String::compare_insensitive(args[1], "stop"))
+			{
+				if (!Zeal::Profiler::tracing)
+				{
+					Zeal::EqGame::print_chat("No trace is running");
+					return true;
+				}
+				std::string filename = Zeal::Profiler::stop_trace();
+				if (filename.empty())
+					Zeal::EqGame::print_chat("Failed to write the trace file");
+				else
+					Zeal::EqGame::print_chat("Trace written to %s", filename.c_str());
+			}
+			else
+				Zeal::EqGame::print_chat("usage: /zealtrace start|stop");
+			return true;
+		});
+	zeal->hooks->Add<InterpretCommand>("commands", Zeal::EqGame::EqGameInternal::fn_interpretcmd, hook_type_detour);
 }
 
@@ -3,6 +3,7 @@
 #include "memory.h"
 #include <functional>
 #include <unordered_map>
+#include <string_view>
 
 struct  ZealCommand
 {
@@ -18,6 +19,13 @@ struct  ZealCommand
 	ZealCommand() {};
 };
 
+// lets the lookup table be probed with a string_view without building a std::string
+struct command_name_hash
+{
+	using is_transparent = void;
+	size_t operator()(std::string_view name) const { return std::hash<std::string_view>{}(name); }
+};
+
 class ChatCommands
 {
 public:
@@ -25,7 +33,10 @@ public:
 	ChatCommands(class ZealService* zeal);
 	~ChatCommands();
 	void add(std::string cmd, std::vector<std::string> aliases, std::string description, std::function<bool(std::vector<std::string>& args)> callback);
+	ZealCommand* find(std::string_view name); //name or alias, case insensitive
 	std::unordered_map<std::string, ZealCommand> CommandFunctions;
+private:
+	std::unordered_map<std::string, ZealCommand*, command_name_hash, std::equal_to<>> lookup; //lowercased names and aliases
 };
 
 
@@ -0,0 +1,122 @@
+#include "con_cache.h"
+#include "Zeal.h"
+#include "EqFunctions.h"
+#include "EqPackets.h"
+#include "entity_manager.h"
+#include "string_util.h"
+
+static constexpr ULONGLONG pending_timeout = 5000; //a con that never came back is sent again after this
+
+std::string ConCache::key(const Zeal::EqStructures::Entity* ent)
+{
+	std::string name = ent->Name;
+	while (name.length() && isdigit(static_cast<unsigned char>(name.back())))
+		name.pop_back();
+	return name + "|" + std::to_string(ent->Level);
+}
+
+UINT8 ConCache::get(Zeal::EqStructures::Entity* ent)
+{
+	if (!ent || ent->Type != Zeal::EqEnums::NPC)
+		return unknown;
+	auto spawn = by_spawn.find(ent->SpawnId);
+	if (spawn != by_spawn.end() && spawn->second.generation == generation)
+		return spawn->second.faction;
+	auto kind = by_kind.find(key(ent));
+	UINT8 value = kind != by_kind.end() ? kind->second : unknown;
+	by_spawn[ent->SpawnId] = { generation, value };
+	return value;
+}
+
+void ConCache::clear()
+{
+	by_kind.clear();
+	by_spawn.clear();
+	generation++;
+}
+
+void ConCache::note_chat(const char* text)
+{
+	if (text && strncmp(text, "Your faction standing with ", 27) == 0)
+		clear(); //the message names the faction, not which npcs are on it
+}
+
+// answers to our own background cons are swallowed, the rest go on to the game's chat output as usual
+bool ConCache::on_consider(const char* buffer, UINT len)
+{
+	if (len < sizeof(Zeal::Packets::Consider_Struct))
+		return false;
+	const Zeal::Packets::Consider_Struct* con = reinterpret_cast<const Zeal::Packets::Consider_Struct*>(buffer);
+	ZealService* zeal = ZealService::get_instance();
+	if (Zeal::EqStructures::Entity* ent = zeal->entity_manager->get(con->targetid))
+	{
+		if (ent->Type == Zeal::EqEnums::NPC && con->faction >= ally && con->faction <= scowls)
+		{
+			UINT8& kind = by_kind[key(ent)];
+			if (kind != con->faction)
+				generation++; //spawns of this kind cached as unknown (or as the old answer) look again
+			kind = static_cast<UINT8>(con->faction);
+			by_spawn[ent->SpawnId] = { generation, kind };
+		}
+	}
+	return pending.erase(con->targetid) > 0;
+}
+
+void ConCache::background_tick()
+{
+	Zeal::EqStructures::Entity* self = Zeal::EqGame::get_self();
+	if (!background.get() || !self || !Zeal::EqGame::is_in_game())
+		return;
+	ULONGLONG now = GetTickCount64();
+	for (auto it = pending.begin(); it != pending.end();)
+		it = now - it->second > pending_timeout ? pending.erase(it) : std::next(it);
+	if (!pending.empty())
+		return; //one in flight at a time, the server answers in order anyway
+	ZealService* zeal = ZealService::get_instance();
+	zeal->entity_manager->query_nearest(self->Position, 32, static_cast<float>(background_range.get()), nearby);
+	for (Zeal::EqStructures::Entity* ent : nearby)
+	{
+		if (ent->Type != Zeal::EqEnums::NPC || ent->PetOwnerSpawnId || get(ent) != unknown)
+			continue;
+		Zeal::Packets::Consider_Struct con = {};
+		con.playerid = self->SpawnId;
+		con.targetid = ent->SpawnId;
+		pending[ent->SpawnId] = now;
+		zeal->packets->send(Zeal::Packets::opcodes::Consider, &con, sizeof(con), packet_priority::housekeeping, ent->SpawnId);
+		return;
+	}
+}
+
+ConCache::ConCache(ZealService* zeal)
+{
+	zeal->memory_report->add("con cache", [this]() {
+		Zeal::Memory::usage use{ Zeal::Memory::hash_bytes(by_kind) + Zeal::Memory::hash_bytes(by_spawn) + Zeal::Memory::hash_bytes(pending) + Zeal::Memory::vector_bytes(nearby),
+			by_kind.size() + by_spawn.size() };
+		for (const auto& [kind, faction] : by_kind)
+			use.bytes += Zeal::Memory::string_bytes(kind);
+		return use;
+	});
+	zeal->callbacks->add_packet([this](UINT opcode, char* buffer, UINT len) { return on_consider(buffer, len); }, { Zeal::Packets::Consider });
+	despawn_subscription = zeal->entity_manager->subscribe([this](const entity_event& e) { by_spawn.erase(e.spawn_id); pending.erase(e.spawn_id); },
+		1u << (int)entity_event_type::despawned);
+	zeal->callbacks->add_generic([this]() { by_spawn.clear(); pending.clear(); }, callback_type::Zone);
+	background_timer = zeal->callbacks->add_work([this](int) { background_tick(); return false; }, background_ms.get() > 100 ? background_ms.get() : 100, work_priority::low);
+	background_ms.on_change([this, zeal](int ms) {
+		zeal->callbacks->cancel_timer(background_timer);
+		background_timer = zeal->callbacks->add_work([this](int) { background_tick(); return false; }, ms > 100 ? ms : 100, work_priority::low);
+	});
+	zeal->commands_hook->add("/concache", {}, "Cached consider answers, /concache clear, /concache bg [on|off] cons nearby npcs in the background without targeting them.",
+		[this](std::vector<std::string>& args) {
+			if (args.size() > 1 && Zeal::String::compare_insensitive(args[1], "clear"))
+				clear();
+			else if (args.size() > 1 && Zeal::String::compare_insensitive(args[1], "bg"))
+				background.set(args.size() > 2 ? Zeal::String::compare_insensitive(args[2], "on") : !background.get());
+			Zeal::EqGame::print_chat("Con cache: %u kinds of npc, background con %s (%ims, range %i)", (UINT)by_kind.size(), background.get() ? "on" : "off",
+				background_ms.get(), background_range.get());
+			return true;
+		});
+}
+
+ConCache::~ConCache()
+{
+}
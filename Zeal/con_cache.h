@@ -0,0 +1,48 @@
+#pragma once
+#include <Windows.h>
+#include <string>
+#include <vector>
+#include <unordered_map>
+#include "settings.h"
+namespace Zeal { namespace EqStructures { struct Entity; } }
+
+// the server's consider answers keyed by npc name and level, so a faction only costs one round trip per kind of npc.
+// every answer the client gets is cached, the optional background queue cons nearby npcs itself without a target swap
+// and keeps their answers out of the chat window
+class ConCache
+{
+public:
+	enum faction : UINT8
+	{
+		unknown = 0,
+		ally = 1,
+		indifferent = 5,
+		threatening = 8,
+		scowls = 9
+	};
+	UINT8 get(Zeal::EqStructures::Entity* ent); //faction value, unknown until a con came back
+	static bool hostile(UINT8 value) { return value >= threatening; }
+	void note_chat(const char* text); //faction hits reset the cache
+	void clear();
+	ConCache(class ZealService* zeal);
+	~ConCache();
+	Setting<bool> background{ "Zeal", "BackgroundCon", false };
+	Setting<int> background_ms{ "Zeal", "BackgroundConMs", 1000 }; //one con per interval at most
+	Setting<int> background_range{ "Zeal", "BackgroundConRange", 200 };
+private:
+	struct cached_spawn
+	{
+		UINT generation;
+		UINT8 faction;
+	};
+	static std::string key(const Zeal::EqStructures::Entity* ent);
+	bool on_consider(const char* buffer, UINT len);
+	void background_tick();
+	std::unordered_map<std::string, UINT8> by_kind; //stripped name and level -> faction
+	std::unordered_map<WORD, cached_spawn> by_spawn; //per frame lookups skip the key string
+	std::unordered_map<WORD, ULONGLONG> pending; //background cons in flight, spawn id -> send tick
+	std::vector<Zeal::EqStructures::Entity*> nearby;
+	UINT generation = 1;
+	UINT background_timer = 0;
+	UINT despawn_subscription = 0;
+};
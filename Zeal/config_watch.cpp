@@ -0,0 +1,91 @@
+#include "config_watch.h"
+#include "Zeal.h"
+#include "settings.h"
+
+ConfigWatch::ConfigWatch(ZealService* zeal, const std::string& folder, const std::string& file) : zeal(zeal), file_name(file.begin(), file.end())
+{
+	directory = CreateFileA(folder.c_str(), FILE_LIST_DIRECTORY, FILE_SHARE_READ | FILE_SHARE_WRITE | FILE_SHARE_DELETE, NULL, OPEN_EXISTING,
+		FILE_FLAG_BACKUP_SEMANTICS | FILE_FLAG_OVERLAPPED, NULL);
+	if (directory == INVALID_HANDLE_VALUE)
+	{
+		ZEAL_LOG_WARN("config", "watching %s failed, error %u, edits are picked up by the once a second check", folder, GetLastError());
+		return;
+	}
+	stop_event = CreateEvent(NULL, TRUE, FALSE, NULL);
+	watcher = std::thread([this]() { watch_main(); });
+}
+
+ConfigWatch::~ConfigWatch()
+{
+	end_thread = true;
+	if (stop_event)
+		SetEvent(stop_event);
+	if (watcher.joinable())
+		watcher.join();
+	if (directory != INVALID_HANDLE_VALUE)
+		CloseHandle(directory);
+	if (stop_event)
+		CloseHandle(stop_event);
+}
+
+void ConfigWatch::on_reload(std::function<void()> callback)
+{
+	callbacks.push_back(callback);
+}
+
+void ConfigWatch::apply()
+{
+	Settings::reload();
+	for (auto& callback : callbacks)
+		callback();
+}
+
+bool ConfigWatch::names_file(const FILE_NOTIFY_INFORMATION* info) const
+{
+	size_t length = info->FileNameLength / sizeof(WCHAR);
+	return length == file_name.length() && !_wcsnicmp(info->FileName, file_name.c_str(), length);
+}
+
+void ConfigWatch::watch_main()
+{
+	OVERLAPPED overlapped = {};
+	overlapped.hEvent = CreateEvent(NULL, TRUE, FALSE, NULL);
+	alignas(DWORD) BYTE buffer[4096];
+	HANDLE waits[2] = { overlapped.hEvent, stop_event };
+	while (!end_thread)
+	{
+		ResetEvent(overlapped.hEvent);
+		if (!ReadDirectoryChangesW(directory, buffer, sizeof(buffer), FALSE, FILE_NOTIFY_CHANGE_LAST_WRITE | FILE_NOTIFY_CHANGE_FILE_NAME | FILE_NOTIFY_CHANGE_SIZE,
+			NULL, &overlapped, NULL))
+		{
+			ZEAL_LOG_WARN("config", "ReadDirectoryChangesW failed, error %u", GetLastError());
+			break;
+		}
+		DWORD bytes = 0;
+		if (WaitForMultipleObjects(2, waits, FALSE, INFINITE) != WAIT_OBJECT_0)
+		{
+			CancelIo(directory);
+			GetOverlappedResult(directory, &overlapped, &bytes, TRUE);
+			break;
+		}
+		if (!GetOverlappedResult(directory, &overlapped, &bytes, FALSE))
+			continue;
+		bool touched = bytes == 0; //the buffer overflowed and the names were lost, check anyway
+		for (DWORD offset = 0; offset < bytes;)
+		{
+			const FILE_NOTIFY_INFORMATION* info = reinterpret_cast<const FILE_NOTIFY_INFORMATION*>(buffer + offset);
+			touched |= names_file(info);
+			if (!info->NextEntryOffset)
+				break;
+			offset += info->NextEntryOffset;
+		}
+		if (!touched)
+			continue;
+		// editors save in a few steps (truncate, write, rename), wait for them to finish before reading it back
+		if (WaitForSingleObject(stop_event, 200) == WAIT_OBJECT_0)
+			break;
+		if (zeal->ini->flush(true)) //our own writes leave the cache current and don't count as a reload
+			zeal->tasks->post_to_main([this]() { apply(); });
+	}
+	CloseHandle(overlapped.hEvent);
+}
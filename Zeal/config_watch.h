@@ -0,0 +1,30 @@
+#pragma once
+#include <Windows.h>
+#include <atomic>
+#include <functional>
+#include <string>
+#include <thread>
+#include <vector>
+
+// picks up edits of eqclient.ini while the client runs. a thread blocks in ReadDirectoryChangesW on the ini's folder,
+// reloads the cache once the writes settle and hands the reload to the game thread, where the declared settings fire
+// their on_change and the modules that still read the ini themselves re-apply through on_reload
+class ConfigWatch
+{
+public:
+	ConfigWatch(class ZealService* zeal, const std::string& folder, const std::string& file);
+	~ConfigWatch();
+	void on_reload(std::function<void()> callback); //game thread, after every declared setting has been reloaded
+	void apply(); //game thread, the ini cache was reloaded
+	bool watching() const { return directory != INVALID_HANDLE_VALUE; }
+private:
+	void watch_main();
+	bool names_file(const FILE_NOTIFY_INFORMATION* info) const;
+	class ZealService* zeal;
+	std::wstring file_name;
+	std::vector<std::function<void()>> callbacks;
+	HANDLE directory = INVALID_HANDLE_VALUE;
+	HANDLE stop_event = nullptr;
+	std::atomic<bool> end_thread = false;
+	std::thread watcher;
+};
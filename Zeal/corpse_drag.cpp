@@ -0,0 +1,180 @@
+#include "corpse_drag.h"
+#include "Zeal.h"
+#include "EqPackets.h"
+#include "string_util.h"
+#include <algorithm>
+
+// "Soandso's corpse" and the like, the owner is everything before the apostrophe
+static std::string corpse_owner(const char* name)
+{
+	const char* end = name;
+	while (*end && *end != '\'' && *end != '`' && *end != '_' && *end != ' ')
+		end++;
+	return std::string(name, end);
+}
+
+void CorpseDrag::refresh()
+{
+	if (!dirty)
+		return;
+	dirty = false;
+	corpses.clear();
+	ZealService* zeal = ZealService::get_instance();
+	for (Zeal::EqStructures::Entity* ent = Zeal::EqGame::get_entity_list(); ent; ent = ent->Next)
+	{
+		if (ent->Type != Zeal::EqEnums::PlayerCorpse)
+			continue;
+		std::string owner = corpse_owner(ent->Name);
+		bool in_raid = zeal->raid_hook && zeal->raid_hook->find_member(owner);
+		corpses.push_back({ ent->SpawnId, ent->Name, owner, ent->Position, in_raid });
+	}
+	// a towed corpse that despawned (looted, summoned, rezzed) stops being sent
+	towed.erase(std::remove_if(towed.begin(), towed.end(), [this](const std::string& name) {
+		return std::none_of(corpses.begin(), corpses.end(), [&](const corpse& c) { return c.name == name; });
+	}), towed.end());
+}
+
+const std::vector<CorpseDrag::corpse>& CorpseDrag::get_corpses()
+{
+	refresh();
+	return corpses;
+}
+
+static UINT64 corpse_key(const std::string& corpse_name)
+{
+	return std::hash<std::string>()(corpse_name) | 1; //never 0, that would opt out of coalescing
+}
+
+void CorpseDrag::send_drag(const std::string& corpse_name, packet_priority priority)
+{
+	Zeal::EqStructures::Entity* self = Zeal::EqGame::get_self();
+	if (!self)
+		return;
+	Zeal::Packets::CorpseDrag_Struct tmp;
+	memset(&tmp, 0, sizeof(tmp));
+	strcpy_s(tmp.CorpseName, 30, corpse_name.c_str());
+	strcpy_s(tmp.DraggerName, 30, self->Name);
+	ZealService::get_instance()->packets->send(Zeal::Packets::opcodes::CorpseDrag, &tmp, sizeof(tmp), priority, corpse_key(corpse_name));
+}
+
+void CorpseDrag::drag(const std::vector<std::string>& names)
+{
+	for (const std::string& name : names)
+	{
+		send_drag(name);
+		if (std::find(towed.begin(), towed.end(), name) == towed.end())
+			towed.push_back(name);
+	}
+	last_redrag = GetTickCount64();
+}
+
+void CorpseDrag::drop_all()
+{
+	towed.clear();
+	PacketGovernor* packets = ZealService::get_instance()->packets.get();
+	packets->cancel(Zeal::Packets::opcodes::CorpseDrag); //a re-drag still waiting would pick them back up
+	packets->send(Zeal::Packets::opcodes::CorpseDrop, nullptr, 0, packet_priority::normal, 1);
+}
+
+// every towed corpse goes out in the same tick, the server handles them independently
+void CorpseDrag::redrag()
+{
+	if (towed.empty() || redrag_ms.get() <= 0 || !Zeal::EqGame::is_in_game())
+		return;
+	ULONGLONG now = GetTickCount64();
+	if (now - last_redrag < (ULONGLONG)redrag_ms.get())
+		return;
+	last_redrag = now;
+	refresh();
+	for (const std::string& name : towed)
+		send_drag(name, packet_priority::housekeeping);
+}
+
+CorpseDrag::CorpseDrag(ZealService* zeal)
+{
+	zeal->callbacks->add_packet([this](UINT opcode, char* buffer, UINT len) {
+		dirty = true; //the game applies the packet after the callbacks, the list is read on the next use
+		return false;
+	}, { Zeal::Packets::ZoneSpawns, Zeal::Packets::NewSpawn, Zeal::Packets::DeleteSpawn, Zeal::Packets::DeathDamage });
+	zeal->callbacks->add_generic([this]() { towed.clear(); corpses.clear(); dirty = true; }, callback_type::Zone);
+	zeal->callbacks->add_work([this](int) { redrag(); return false; }, 250);
+
+	zeal->commands_hook->add("/corpsedrag", { "/drag" }, "Drags your target's corpse, /corpsedrag all|raid|<name> for every nearby corpse, the raid's or one owner's. Dragged corpses are re-dragged every CorpseRedragMs.",
+		[this](std::vector<std::string>& args) {
+			Zeal::EqStructures::Entity* self = Zeal::EqGame::get_self();
+			if (!self)
+				return true;
+			if (args.size() == 1)
+			{
+				if (Zeal::EqStructures::Entity* target = Zeal::EqGame::get_target())
+					drag({ target->Name });
+				return true; //return true to stop the game from processing any further on this command, false if you want to just add features to an existing cmd
+			}
+			bool all = Zeal::String::compare_insensitive(args[1], "all");
+			bool raid = Zeal::String::compare_insensitive(args[1], "raid");
+			float range2 = static_cast<float>(drag_range.get()) * drag_range.get();
+			std::vector<std::string> names;
+			for (const corpse& c : get_corpses())
+			{
+				bool wanted = all || (raid && c.raid_member) || (!all && !raid && Zeal::String::compare_insensitive(c.owner, args[1]));
+				if (wanted && (!(all || raid) || c.position.Dist2(self->Position) <= range2))
+					names.push_back(c.name);
+			}
+			if (names.empty())
+				Zeal::EqGame::print_chat("No corpses to drag for %s", args[1].c_str());
+			else
+			{
+				drag(names);
+				Zeal::EqGame::print_chat("Dragging %u corpse%s", (UINT)names.size(), names.size() == 1 ? "" : "s");
+			}
+			return true;
+		});
+	zeal->commands_hook->add("/corpsedrop", { "/drop" }, "Attempts to drop a corpse (your current target). To drop all use /corpsedrop all",
+		[this](std::vector<std::string>& args) {
+			if (args.size() == 1)
+			{
+				if (Zeal::EqStructures::Entity* target = Zeal::EqGame::get_target())
+				{
+					if (Zeal::EqStructures::Entity* self = Zeal::EqGame::get_self())
+					{
+						towed.erase(std::remove(towed.begin(), towed.end(), std::string(target->Name)), towed.end());
+						Zeal::Packets::CorpseDrag_Struct tmp;
+						memset(&tmp, 0, sizeof(tmp));
+						strcpy_s(tmp.CorpseName, 30, target->Name);
+						strcpy_s(tmp.DraggerName, 30, self->Name);
+						PacketGovernor* packets = ZealService::get_instance()->packets.get();
+						packets->cancel(Zeal::Packets::opcodes::CorpseDrag, corpse_key(target->Name));
+						packets->send(Zeal::Packets::opcodes::CorpseDrop, &tmp, sizeof(tmp), packet_priority::normal, corpse_key(target->Name));
+					}
+				}
+				return true;
+			}
+			else if (Zeal::String::compare_insensitive(args[1], "all"))
+			{
+				drop_all();
+				return true;
+			}
+			return false;
+		});
+	zeal->commands_hook->add("/corpselist", {}, "Lists the player corpses in the zone, closest first, marking raid members and the ones you are dragging.",
+		[this](std::vector<std::string>& args) {
+			Zeal::EqStructures::Entity* self = Zeal::EqGame::get_self();
+			if (!self)
+				return true;
+			std::vector<const corpse*> sorted;
+			for (const corpse& c : get_corpses())
+				sorted.push_back(&c);
+			std::sort(sorted.begin(), sorted.end(), [self](const corpse* a, const corpse* b) { return a->position.Dist2(self->Position) < b->position.Dist2(self->Position); });
+			Zeal::EqGame::print_chat("--- corpses (%u, dragging %u) ---", (UINT)sorted.size(), (UINT)towed.size());
+			for (const corpse* c : sorted)
+			{
+				bool dragging = std::find(towed.begin(), towed.end(), c->name) != towed.end();
+				Zeal::EqGame::print_chat("%s %.0f%s%s", c->name.c_str(), c->position.Dist(self->Position), c->raid_member ? " [raid]" : "", dragging ? " [dragging]" : "");
+			}
+			return true;
+		});
+}
+
+CorpseDrag::~CorpseDrag()
+{
+}
@@ -0,0 +1,37 @@
+#pragma once
+#include <Windows.h>
+#include <string>
+#include <vector>
+#include "settings.h"
+#include "vectors.h"
+#include "packet_governor.h"
+
+// the zone's player corpses, refreshed from the entity list only after spawn, despawn or death traffic, and the set
+// being dragged, which gets its drag packets re-sent on a timer so the corpses stay in tow
+class CorpseDrag
+{
+public:
+	struct corpse
+	{
+		WORD spawn_id;
+		std::string name; //the corpse's own name, what the drag packet carries
+		std::string owner;
+		Vec3 position;
+		bool raid_member;
+	};
+	const std::vector<corpse>& get_corpses(); //refreshed when packets changed the list since the last call
+	void drag(const std::vector<std::string>& names);
+	void drop_all();
+	Setting<int> redrag_ms{ "Zeal", "CorpseRedragMs", 2000 }; //0 sends each drag once
+	Setting<int> drag_range{ "Zeal", "CorpseDragRange", 100 }; //all and raid only pick up corpses this close
+	CorpseDrag(class ZealService* zeal);
+	~CorpseDrag();
+private:
+	void refresh();
+	void redrag();
+	void send_drag(const std::string& corpse_name, packet_priority priority = packet_priority::normal);
+	std::vector<corpse> corpses;
+	std::vector<std::string> towed;
+	bool dirty = true;
+	ULONGLONG last_redrag = 0;
+};
@@ -1,11 +1,10 @@
 #include "crash_handler.h"
-#include <ctime>
-#include <sstream>
-#include <iomanip>
-#include <map>
-#include <vector>
+#include "Zeal.h"
+#include <psapi.h>
+#include <cstdio>
+#include <cstdarg>
 
-std::vector<DWORD> nonCrashExceptionCodes =
+static const DWORD nonCrashExceptionCodes[] =
 {
     0x40010006, // Application-defined exception used by Visual Studio for debug events
     0x406D1388, // Exception used to set thread names for debugging
@@ -15,150 +14,284 @@ std::vector<DWORD> nonCrashExceptionCodes =
     0x80000007  //  Used to wake up the system debugger
 };
 
-// Define a map to store exception codes and their descriptions
-std::map<DWORD, std::string> exceptionCodeStrings = {
-    {EXCEPTION_ACCESS_VIOLATION, "EXCEPTION_ACCESS_VIOLATION"},
-    {EXCEPTION_ARRAY_BOUNDS_EXCEEDED, "EXCEPTION_ARRAY_BOUNDS_EXCEEDED"},
-    {EXCEPTION_BREAKPOINT, "EXCEPTION_BREAKPOINT"},
-    {EXCEPTION_DATATYPE_MISALIGNMENT, "EXCEPTION_DATATYPE_MISALIGNMENT"},
-    {EXCEPTION_FLT_DENORMAL_OPERAND, "EXCEPTION_FLT_DENORMAL_OPERAND"},
-    {EXCEPTION_FLT_DIVIDE_BY_ZERO, "EXCEPTION_FLT_DIVIDE_BY_ZERO"},
-    {EXCEPTION_FLT_INEXACT_RESULT, "EXCEPTION_FLT_INEXACT_RESULT"},
-    {EXCEPTION_FLT_INVALID_OPERATION, "EXCEPTION_FLT_INVALID_OPERATION"},
-    {EXCEPTION_FLT_OVERFLOW, "EXCEPTION_FLT_OVERFLOW"},
-    {EXCEPTION_FLT_STACK_CHECK, "EXCEPTION_FLT_STACK_CHECK"},
-    {EXCEPTION_FLT_UNDERFLOW, "EXCEPTION_FLT_UNDERFLOW"},
-    {EXCEPTION_ILLEGAL_INSTRUCTION, "EXCEPTION_ILLEGAL_INSTRUCTION"},
-    {EXCEPTION_IN_PAGE_ERROR, "EXCEPTION_IN_PAGE_ERROR"},
-    {EXCEPTION_INT_DIVIDE_BY_ZERO, "EXCEPTION_INT_DIVIDE_BY_ZERO"},
-    {EXCEPTION_INT_OVERFLOW, "EXCEPTION_INT_OVERFLOW"},
-    {EXCEPTION_INVALID_DISPOSITION, "EXCEPTION_INVALID_DISPOSITION"},
-    {EXCEPTION_NONCONTINUABLE_EXCEPTION, "EXCEPTION_NONCONTINUABLE_EXCEPTION"},
-    {EXCEPTION_PRIV_INSTRUCTION, "EXCEPTION_PRIV_INSTRUCTION"},
-    {EXCEPTION_SINGLE_STEP, "EXCEPTION_SINGLE_STEP"},
-    {EXCEPTION_STACK_OVERFLOW, "EXCEPTION_STACK_OVERFLOW"},
-    // Add more exception codes as needed
-};
-
-void EnsureCrashesFolderExists() {
-    // Check if 'crashes' folder exists
-    DWORD dwAttrib = GetFileAttributes(L"crashes");
-    if (dwAttrib == INVALID_FILE_ATTRIBUTES || !(dwAttrib & FILE_ATTRIBUTE_DIRECTORY)) {
-        // Create 'crashes' folder if it does not exist
-        if (!CreateDirectory(L"crashes", NULL)) {
-            std::cerr << "Failed to create 'crashes' folder." << std::endl;
-        }
+static const char* ExceptionCodeString(DWORD code)
+{
+    switch (code) {
+    case EXCEPTION_ACCESS_VIOLATION:         return "EXCEPTION_ACCESS_VIOLATION";
+    case EXCEPTION_ARRAY_BOUNDS_EXCEEDED:    return "EXCEPTION_ARRAY_BOUNDS_EXCEEDED";
+    case EXCEPTION_BREAKPOINT:               return "EXCEPTION_BREAKPOINT";
+    case EXCEPTION_DATATYPE_MISALIGNMENT:    return "EXCEPTION_DATATYPE_MISALIGNMENT";
+    case EXCEPTION_FLT_DENORMAL_OPERAND:     return "EXCEPTION_FLT_DENORMAL_OPERAND";
+    case EXCEPTION_FLT_DIVIDE_BY_ZERO:       return "EXCEPTION_FLT_DIVIDE_BY_ZERO";
+    case EXCEPTION_FLT_INEXACT_RESULT:       return "EXCEPTION_FLT_INEXACT_RESULT";
+    case EXCEPTION_FLT_INVALID_OPERATION:    return "EXCEPTION_FLT_INVALID_OPERATION";
+    case EXCEPTION_FLT_OVERFLOW:             return "EXCEPTION_FLT_OVERFLOW";
+    case EXCEPTION_FLT_STACK_CHECK:          return "EXCEPTION_FLT_STACK_CHECK";
+    case EXCEPTION_FLT_UNDERFLOW:            return "EXCEPTION_FLT_UNDERFLOW";
+    case EXCEPTION_ILLEGAL_INSTRUCTION:      return "EXCEPTION_ILLEGAL_INSTRUCTION";
+    case EXCEPTION_IN_PAGE_ERROR:            return "EXCEPTION_IN_PAGE_ERROR";
+    case EXCEPTION_INT_DIVIDE_BY_ZERO:       return "EXCEPTION_INT_DIVIDE_BY_ZERO";
+    case EXCEPTION_INT_OVERFLOW:             return "EXCEPTION_INT_OVERFLOW";
+    case EXCEPTION_INVALID_DISPOSITION:      return "EXCEPTION_INVALID_DISPOSITION";
+    case EXCEPTION_NONCONTINUABLE_EXCEPTION: return "EXCEPTION_NONCONTINUABLE_EXCEPTION";
+    case EXCEPTION_PRIV_INSTRUCTION:         return "EXCEPTION_PRIV_INSTRUCTION";
+    case EXCEPTION_SINGLE_STEP:              return "EXCEPTION_SINGLE_STEP";
+    case EXCEPTION_STACK_OVERFLOW:           return "EXCEPTION_STACK_OVERFLOW";
     }
+    return nullptr;
 }
 
-std::string GetModuleNameFromAddress(LPVOID address) {
-    HMODULE hModule;
-    DWORD_PTR dwOffset;
-    char modulePath[MAX_PATH];
-
-    // Get module handle from address
-    if (GetModuleHandleEx(GET_MODULE_HANDLE_EX_FLAG_FROM_ADDRESS | GET_MODULE_HANDLE_EX_FLAG_UNCHANGED_REFCOUNT,
-        reinterpret_cast<LPCWSTR>(address), &hModule) != 0) {
-        // Get module file name
-        if (GetModuleFileNameA(hModule, modulePath, MAX_PATH) != 0) {
-            return modulePath;
-        }
-    }
+// callback_type order
+static const char* phase_names[] = { "MainLoop", "Zone", "CleanUI", "Render", "CharacterSelect", "InitUI", "EndMainLoop", "WorldMessage",
+    "SendMessage", "ExecuteCmd", "Delayed", "RenderUI", "EndScene", "AddDeferred", "DeviceReset" };
 
-    return "";
-}
+static crash_shared local_block{}; // used until, or instead of, the shared mapping
+static crash_shared* trace = &local_block;
+static HANDLE mapping = nullptr;
+static HANDLE crash_event = nullptr;
+static HANDLE done_event = nullptr;
+static HANDLE watchdog = nullptr;
+static volatile LONG in_handler = 0;
 
+static void ObjectName(char* out, size_t size, DWORD pid, const char* suffix)
+{
+    snprintf(out, size, "Local\\ZealCrash_%u%s", pid, suffix);
+}
 
-void WriteMiniDump(EXCEPTION_POINTERS* pep, const std::string& reason) {
-    // Check for non-crash exceptions and return early if detected
-    if (pep != nullptr && pep->ExceptionRecord != nullptr) {
-        DWORD exceptionCode = pep->ExceptionRecord->ExceptionCode;
-        for (DWORD nonCrashCode : nonCrashExceptionCodes) {
-            if (exceptionCode == nonCrashCode) {
-                std::cerr << "Non-crash exception detected, skipping mini-dump generation." << std::endl;
-                return;
-            }
-        }
-    }
-    // Get the current time for a unique folder name
-    EnsureCrashesFolderExists();
-    std::time_t t = std::time(nullptr);
-    std::tm tm;
-    localtime_s(&tm, &t);
-    std::ostringstream folderNameStream;
-    folderNameStream << "crashes\\"
-        << std::put_time(&tm, "%Y-%m-%d_%H-%M-%S");
-
-    std::string folderName = folderNameStream.str();
-
-    // Create the unique folder
-    if (CreateDirectoryA(folderName.c_str(), NULL) || GetLastError() == ERROR_ALREADY_EXISTS) {
-        // Create the mini-dump file path
-        std::string dumpFilePath = folderName + "\\minidump.dmp";
-
-        HANDLE hFile = CreateFileA(dumpFilePath.c_str(), GENERIC_WRITE, 0, NULL, CREATE_ALWAYS, FILE_ATTRIBUTE_NORMAL, NULL);
-
-        if (hFile == INVALID_HANDLE_VALUE) {
-            std::cerr << "Could not create dump file." << std::endl;
-            return;
-        }
+void CrashHandler::note_phase(UINT phase)
+{
+    crash_shared* s = trace;
+    UINT i = s->phase_head++ % crash_shared::trace_size;
+    s->phases[i].tick = GetTickCount();
+    s->phases[i].phase = phase;
+}
 
-        // Create the mini-dump
-        MINIDUMP_EXCEPTION_INFORMATION mdei;
-        mdei.ThreadId = GetCurrentThreadId();
-        mdei.ExceptionPointers = pep;
-        mdei.ClientPointers = FALSE;
-        //MiniDumpWithPrivateReadWriteMemory
-        MINIDUMP_TYPE mdt = (MINIDUMP_TYPE)(MiniDumpWithHandleData | MiniDumpWithProcessThreadData | MiniDumpWithThreadInfo | MiniDumpWithUnloadedModules);
+void CrashHandler::note_packet(bool outgoing, UINT opcode, const char* buffer, UINT len)
+{
+    crash_shared* s = trace;
+    UINT i = s->packet_head++ % crash_shared::trace_size;
+    auto& p = s->packets[i];
+    p.tick = GetTickCount();
+    p.opcode = static_cast<WORD>(opcode);
+    p.len = static_cast<WORD>(len);
+    p.outgoing = outgoing;
+    UINT copy = len < sizeof(p.data) ? len : sizeof(p.data);
+    if (buffer && copy)
+        memcpy(p.data, buffer, copy);
+}
 
-        BOOL result = MiniDumpWriteDump(GetCurrentProcess(), GetCurrentProcessId(), hFile, mdt, (pep != 0) ? &mdei : 0, 0, 0);
+static void WriteLine(HANDLE file, const char* format, ...)
+{
+    char line[512];
+    va_list args;
+    va_start(args, format);
+    int len = vsnprintf(line, sizeof(line) - 2, format, args);
+    va_end(args);
+    if (len < 0)
+        return;
+    len = len < (int)sizeof(line) - 2 ? len : (int)sizeof(line) - 3;
+    line[len++] = '\r';
+    line[len++] = '\n';
+    DWORD written = 0;
+    WriteFile(file, line, len, &written, NULL);
+}
 
-        if (!result) {
-            std::cerr << "Failed to write dump file." << std::endl;
-        }
-        else {
-            // Create the reason file path
-            std::string reasonFilePath = folderName + "\\crash_reason.txt";
-            std::ofstream reasonFile(reasonFilePath);
-            if (reasonFile.is_open()) {
-                reasonFile << "Unhandled exception occurred: " << reason << std::endl << std::endl;
-                if (pep != nullptr && pep->ExceptionRecord != nullptr) {
-                    reasonFile << "Exception Code: 0x" << std::hex << pep->ExceptionRecord->ExceptionCode << std::endl;
-                    if (exceptionCodeStrings.count(pep->ExceptionRecord->ExceptionCode))
-                        reasonFile << "Exception String: " << std::hex << exceptionCodeStrings[pep->ExceptionRecord->ExceptionCode] << std::endl;
-                    reasonFile << "Exception Address: 0x" << std::hex << pep->ExceptionRecord->ExceptionAddress << std::endl;
-                    // Get and write module information
-                    std::string moduleName = GetModuleNameFromAddress(pep->ExceptionRecord->ExceptionAddress);
-                    if (!moduleName.empty()) {
-                        reasonFile << "Exception occurred in module: " << moduleName << std::endl;
-                    }
-                    else {
-                        reasonFile << "Module information not available." << std::endl;
-                    }
-                    // Add more details as needed from pep->ExceptionRecord and pep->ContextRecord
-                }
-                reasonFile.close();
-            }
-        }
+static void WriteReason(HANDLE file, HANDLE process, const crash_shared& s, const char* reason)
+{
+    WriteLine(file, "Unhandled exception occurred: %s", reason);
+    WriteLine(file, "Zeal version: %.16s", s.version);
+    WriteLine(file, "");
+    WriteLine(file, "Exception Code: 0x%x", s.record.ExceptionCode);
+    if (const char* name = ExceptionCodeString(s.record.ExceptionCode))
+        WriteLine(file, "Exception String: %s", name);
+    WriteLine(file, "Exception Address: 0x%p", s.record.ExceptionAddress);
+    if (s.module[0])
+        WriteLine(file, "Exception occurred in module: %s", s.module);
+    else
+        WriteLine(file, "Module information not available.");
+    WriteLine(file, "Thread: %u", s.thread_id);
+    PROCESS_MEMORY_COUNTERS_EX counters = {};
+    counters.cb = sizeof(counters);
+    GetProcessMemoryInfo(process, reinterpret_cast<PROCESS_MEMORY_COUNTERS*>(&counters), sizeof(counters));
+    WriteLine(file, "Process memory: private %u KB, working set %u KB", (UINT)(counters.PrivateUsage / 1024), (UINT)(counters.WorkingSetSize / 1024));
+    WriteLine(file, "Zeal heap: %u KB in %u blocks, peak %u KB", s.zeal_heap_kb, s.zeal_heap_blocks, s.zeal_heap_peak_kb);
 
-        CloseHandle(hFile);
+    DWORD now = GetTickCount();
+    WriteLine(file, "");
+    WriteLine(file, "Recent callbacks, newest first:");
+    for (UINT n = 0; n < crash_shared::trace_size && n < s.phase_head; ++n) {
+        const auto& p = s.phases[(s.phase_head - 1 - n) % crash_shared::trace_size];
+        const char* name = p.phase < sizeof(phase_names) / sizeof(phase_names[0]) ? phase_names[p.phase] : "?";
+        WriteLine(file, "  -%ums %s", now - p.tick, name);
     }
-    else {
-        std::cerr << "Could not create directory: " << folderName << std::endl;
+    WriteLine(file, "");
+    WriteLine(file, "Recent packets, newest first:");
+    for (UINT n = 0; n < crash_shared::trace_size && n < s.packet_head; ++n) {
+        const auto& p = s.packets[(s.packet_head - 1 - n) % crash_shared::trace_size];
+        char hex[sizeof(p.data) * 3 + 1] = {};
+        for (UINT b = 0; b < sizeof(p.data) && b < p.len; ++b)
+            snprintf(hex + b * 3, 4, "%02x ", p.data[b]);
+        WriteLine(file, "  -%ums %s 0x%04x len %u: %s", now - p.tick, p.outgoing ? "sent" : "recv", p.opcode, p.len, hex);
     }
 }
 
+// crashes\<date time>\minidump.dmp and crash_reason.txt, client_pointers when s.pointers belongs to another process
+static void WriteMiniDump(HANDLE process, DWORD pid, const crash_shared& s, BOOL client_pointers, const char* reason)
+{
+    SYSTEMTIME t;
+    GetLocalTime(&t);
+    char folder[64];
+    snprintf(folder, sizeof(folder), "crashes\\%04u-%02u-%02u_%02u-%02u-%02u", t.wYear, t.wMonth, t.wDay, t.wHour, t.wMinute, t.wSecond);
+    CreateDirectoryA("crashes", NULL);
+    if (!CreateDirectoryA(folder, NULL) && GetLastError() != ERROR_ALREADY_EXISTS)
+        return;
+
+    char path[96];
+    snprintf(path, sizeof(path), "%s\\minidump.dmp", folder);
+    HANDLE hFile = CreateFileA(path, GENERIC_WRITE, 0, NULL, CREATE_ALWAYS, FILE_ATTRIBUTE_NORMAL, NULL);
+    if (hFile == INVALID_HANDLE_VALUE)
+        return;
+
+    MINIDUMP_EXCEPTION_INFORMATION mdei;
+    mdei.ThreadId = s.thread_id;
+    mdei.ExceptionPointers = s.pointers;
+    mdei.ClientPointers = client_pointers;
+    //MiniDumpWithPrivateReadWriteMemory
+    MINIDUMP_TYPE mdt = (MINIDUMP_TYPE)(MiniDumpWithHandleData | MiniDumpWithProcessThreadData | MiniDumpWithThreadInfo | MiniDumpWithUnloadedModules);
+    BOOL result = MiniDumpWriteDump(process, pid, hFile, mdt, s.pointers ? &mdei : 0, 0, 0);
+    CloseHandle(hFile);
+    if (!result)
+        return;
+
+    snprintf(path, sizeof(path), "%s\\crash_reason.txt", folder);
+    HANDLE reasonFile = CreateFileA(path, GENERIC_WRITE, 0, NULL, CREATE_ALWAYS, FILE_ATTRIBUTE_NORMAL, NULL);
+    if (reasonFile == INVALID_HANDLE_VALUE)
+        return;
+    WriteReason(reasonFile, process, s, reason);
+    CloseHandle(reasonFile);
+}
+
+// runs in the rundll32 watchdog: waits for the game to signal a crash, dumps it from outside, lets the game go on
+extern "C" void CALLBACK ZealCrashWatchdog(HWND, HINSTANCE, LPSTR cmd_line, int)
+{
+    DWORD pid = strtoul(cmd_line, nullptr, 10);
+    char name[64];
+    HANDLE process = OpenProcess(PROCESS_QUERY_INFORMATION | PROCESS_VM_READ | PROCESS_DUP_HANDLE | SYNCHRONIZE, FALSE, pid);
+    ObjectName(name, sizeof(name), pid, "");
+    HANDLE map = OpenFileMappingA(FILE_MAP_READ, FALSE, name);
+    ObjectName(name, sizeof(name), pid, "_crash");
+    HANDLE crashed = OpenEventA(SYNCHRONIZE, FALSE, name);
+    ObjectName(name, sizeof(name), pid, "_done");
+    HANDLE done = OpenEventA(EVENT_MODIFY_STATE, FALSE, name);
+    const crash_shared* s = map ? static_cast<const crash_shared*>(MapViewOfFile(map, FILE_MAP_READ, 0, 0, sizeof(crash_shared))) : nullptr;
+    if (process && s && crashed && done && s->magic == crash_shared::magic_value) {
+        HANDLE waits[2] = { crashed, process };
+        while (WaitForMultipleObjects(2, waits, FALSE, INFINITE) == WAIT_OBJECT_0) {
+            WriteMiniDump(process, pid, *s, TRUE, "VEH (watchdog)");
+            SetEvent(done);
+        }
+    }
+    if (s)
+        UnmapViewOfFile(s);
+    for (HANDLE h : { process, map, crashed, done })
+        if (h)
+            CloseHandle(h);
+}
+#pragma comment(linker, "/EXPORT:ZealCrashWatchdog=_ZealCrashWatchdog@16")
 
 LONG CALLBACK VectoredExceptionHandler(PEXCEPTION_POINTERS pExceptionInfo) {
-    WriteMiniDump(pExceptionInfo, "VEH");
+    if (!pExceptionInfo || !pExceptionInfo->ExceptionRecord)
+        return EXCEPTION_CONTINUE_SEARCH;
+    for (DWORD nonCrashCode : nonCrashExceptionCodes)
+        if (pExceptionInfo->ExceptionRecord->ExceptionCode == nonCrashCode)
+            return EXCEPTION_CONTINUE_SEARCH;
+    if (InterlockedExchange(&in_handler, 1)) // faulted while reporting another one
+        return EXCEPTION_CONTINUE_SEARCH;
+
+    // only fixed size copies here, the heap may be what broke
+    crash_shared* s = trace;
+    s->thread_id = GetCurrentThreadId();
+    s->pointers = pExceptionInfo;
+    s->record = *pExceptionInfo->ExceptionRecord;
+    if (pExceptionInfo->ContextRecord)
+        s->context = *pExceptionInfo->ContextRecord;
+    s->module[0] = 0;
+    HMODULE hModule;
+    if (GetModuleHandleExA(GET_MODULE_HANDLE_EX_FLAG_FROM_ADDRESS | GET_MODULE_HANDLE_EX_FLAG_UNCHANGED_REFCOUNT, reinterpret_cast<LPCSTR>(s->record.ExceptionAddress), &hModule))
+        GetModuleFileNameA(hModule, s->module, MAX_PATH);
+    s->zeal_heap_kb = static_cast<UINT>(Zeal::Memory::heap_bytes() / 1024); //atomic loads, nothing that touches the heap
+    s->zeal_heap_peak_kb = static_cast<UINT>(Zeal::Memory::heap_peak() / 1024);
+    s->zeal_heap_blocks = static_cast<UINT>(Zeal::Memory::heap_blocks());
+
+    if (watchdog && WaitForSingleObject(watchdog, 0) == WAIT_TIMEOUT) {
+        SetEvent(crash_event);
+        WaitForSingleObject(done_event, 15000);
+    }
+    else
+        WriteMiniDump(GetCurrentProcess(), GetCurrentProcessId(), *s, FALSE, "VEH");
+
+    InterlockedExchange(&in_handler, 0);
     return EXCEPTION_CONTINUE_SEARCH; // Continue searching for other handlers
 }
 
+bool CrashHandler::start_watchdog()
+{
+    if (!GetPrivateProfileIntA("Zeal", "CrashWatchdog", 1, ".\\eqclient.ini"))
+        return false;
+    DWORD pid = GetCurrentProcessId();
+    char name[64];
+    ObjectName(name, sizeof(name), pid, "");
+    mapping = CreateFileMappingA(INVALID_HANDLE_VALUE, NULL, PAGE_READWRITE, 0, sizeof(crash_shared), name);
+    crash_shared* view = mapping ? static_cast<crash_shared*>(MapViewOfFile(mapping, FILE_MAP_WRITE, 0, 0, sizeof(crash_shared))) : nullptr;
+    if (!view)
+        return false;
+    *view = local_block;
+    trace = view;
+    ObjectName(name, sizeof(name), pid, "_crash");
+    crash_event = CreateEventA(NULL, FALSE, FALSE, name);
+    ObjectName(name, sizeof(name), pid, "_done");
+    done_event = CreateEventA(NULL, FALSE, FALSE, name);
+
+    HMODULE self = nullptr;
+    char module_path[MAX_PATH] = {};
+    char system_path[MAX_PATH] = {};
+    GetModuleHandleExA(GET_MODULE_HANDLE_EX_FLAG_FROM_ADDRESS | GET_MODULE_HANDLE_EX_FLAG_UNCHANGED_REFCOUNT, reinterpret_cast<LPCSTR>(&ZealCrashWatchdog), &self);
+    if (!crash_event || !done_event || !self || !GetModuleFileNameA(self, module_path, MAX_PATH) || !GetSystemDirectoryA(system_path, MAX_PATH))
+        return false;
+    std::string rundll = std::string(system_path) + "\\rundll32.exe"; // wow64 redirects this to the 32 bit one
+    std::string command = "\"" + rundll + "\" \"" + module_path + "\",ZealCrashWatchdog " + std::to_string(pid);
+    STARTUPINFOA si = { sizeof(si) };
+    PROCESS_INFORMATION pi = {};
+    if (!CreateProcessA(rundll.c_str(), &command[0], NULL, NULL, FALSE, CREATE_NO_WINDOW, NULL, NULL, &si, &pi))
+        return false;
+    CloseHandle(pi.hThread);
+    watchdog = pi.hProcess;
+    return true;
+}
+
 CrashHandler::CrashHandler()
 {
+    local_block.magic = crash_shared::magic_value;
+    strncpy_s(local_block.version, ZEAL_VERSION, _TRUNCATE);
+    start_watchdog(); // falls back to dumping in process
     exception_handler = AddVectoredExceptionHandler(0, VectoredExceptionHandler);
 }
 CrashHandler::~CrashHandler()
 {
     RemoveVectoredExceptionHandler(exception_handler);
+    if (watchdog) {
+        TerminateProcess(watchdog, 0); // the game keeps running after an unload
+        CloseHandle(watchdog);
+        watchdog = nullptr;
+    }
+    if (trace != &local_block) {
+        crash_shared* view = trace;
+        trace = &local_block;
+        UnmapViewOfFile(view);
+    }
+    for (HANDLE* h : { &mapping, &crash_event, &done_event }) {
+        if (*h)
+            CloseHandle(*h);
+        *h = nullptr;
+    }
 }
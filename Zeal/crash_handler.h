@@ -1,15 +1,49 @@
 #pragma once
 #include <windows.h>
 #include <dbghelp.h>
-#include <iostream>
-#include <fstream>
 #include <string>
+
+// everything a crash report needs, laid out flat so a watchdog process can read it from shared memory
+// the game process only stores into it while running and copies the exception into it when it faults
+struct crash_shared
+{
+	static constexpr DWORD magic_value = 0x5A435348; //ZCSH
+	static constexpr int trace_size = 32;
+	DWORD magic;
+	char version[16];
+	DWORD thread_id;
+	EXCEPTION_POINTERS* pointers; //address in the game process
+	EXCEPTION_RECORD record;
+	CONTEXT context;
+	char module[MAX_PATH]; //module holding the faulting address
+	UINT zeal_heap_kb; //zeal's own live allocations at the fault, against the process totals in the dump
+	UINT zeal_heap_peak_kb;
+	UINT zeal_heap_blocks;
+	UINT phase_head;
+	struct
+	{
+		DWORD tick;
+		UINT phase; //callback_type being dispatched
+	} phases[trace_size];
+	UINT packet_head;
+	struct
+	{
+		DWORD tick;
+		WORD opcode;
+		WORD len;
+		BYTE outgoing;
+		BYTE data[15];
+	} packets[trace_size];
+};
+
 class CrashHandler
 {
 public:
 	CrashHandler();
 	~CrashHandler();
+	static void note_phase(UINT phase); //cheap ring buffer stores, safe to call every dispatch
+	static void note_packet(bool outgoing, UINT opcode, const char* buffer, UINT len);
 private:
+	bool start_watchdog(); //rundll32 hosting ZealCrashWatchdog from this module, writes the dump from outside
 	PVOID exception_handler;
 };
-
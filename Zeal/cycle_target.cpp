@@ -6,10 +6,26 @@
 #include <algorithm>
 
 static size_t last_index = -1;
-static std::vector<Zeal::EqStructures::Entity*> near_ents;
-bool compareDist(Zeal::EqStructures::Entity* i1, Zeal::EqStructures::Entity* i2)
+static std::vector<std::pair<float, Zeal::EqStructures::Entity*>> near_ents; //squared distance to self, kept across calls so it keeps its capacity
+static std::vector<Zeal::EqStructures::Entity*> visible_ents;
+
+static float dist_sq(const Vec3& a, const Vec3& b)
+{
+	float dx = a.x - b.x, dy = a.y - b.y, dz = a.z - b.z;
+	return dx * dx + dy * dy + dz * dz;
+}
+
+static bool compare_key(const std::pair<float, Zeal::EqStructures::Entity*>& i1, const std::pair<float, Zeal::EqStructures::Entity*>& i2)
+{
+	return i1.first < i2.first;
+}
+
+static bool is_npc_owned(Zeal::EqStructures::Entity* ent)
 {
-	return (i1->Position.Dist(Zeal::EqGame::get_self()->Position) < i2->Position.Dist(Zeal::EqGame::get_self()->Position));
+	if (!ent->PetOwnerSpawnId)
+		return true;
+	Zeal::EqStructures::Entity* owner = ZealService::get_instance()->pet_tracker->owner(ent);
+	return !owner || owner->Type == Zeal::EqEnums::EntityTypes::NPC || owner->Type == Zeal::EqEnums::EntityTypes::NPCCorpse;
 }
 
 void AddIndex()
@@ -23,7 +39,7 @@ Zeal::EqStructures::Entity* CycleTarget::get_next_ent(float dist, byte type)
 	static ULONGLONG last_press = 0;
 	
 	
-	std::vector<Zeal::EqStructures::Entity*> visible_ents = Zeal::EqGame::get_world_visible_actor_list(dist, true);
+	ZealService::get_instance()->entity_manager->get_visible_actors(dist, true, visible_ents);
 	if (GetTickCount64() - last_press > 3000) //if you haven't pressed the cycle key in 3 seconds reset the index so it selected the nearest
 		last_index = -1;
 	last_press = GetTickCount64();
@@ -31,75 +47,48 @@ Zeal::EqStructures::Entity* CycleTarget::get_next_ent(float dist, byte type)
 
 	if (!visible_ents.size())
 		return 0;
+	Vec3 self_pos = Zeal::EqGame::get_self()->Position;
 	near_ents.clear();
 	for (auto& ent : visible_ents)
 	{
-		if (!ent->IsHidden && ent->Type == type && ent->HpCurrent > 0 && ent->Level>0 && ent->TargetType<66)
-		{
-			if (ent->PetOwnerSpawnId)
-			{
-				Zeal::EqStructures::Entity* owner = Zeal::EqGame::get_entity_by_id(ent->PetOwnerSpawnId);
-				if ((owner && (owner->Type == Zeal::EqEnums::EntityTypes::NPC || owner->Type == Zeal::EqEnums::EntityTypes::NPCCorpse)) || !owner)
-					near_ents.push_back(ent);
-			}
-			else
-				near_ents.push_back(ent);
-		}
+		if (!ent->IsHidden && ent->Type == type && ent->HpCurrent > 0 && ent->Level>0 && ent->TargetType<66 && is_npc_owned(ent))
+			near_ents.push_back({ dist_sq(ent->Position, self_pos), ent });
 	}
 	if (!near_ents.size())
 		return 0;
 
-	std::sort(near_ents.begin(), near_ents.end(), compareDist);
+	std::sort(near_ents.begin(), near_ents.end(), compare_key);
 	AddIndex();
 	
-	if (near_ents[last_index] && Zeal::EqGame::get_target() && Zeal::EqGame::get_target() == near_ents[last_index])
+	if (near_ents[last_index].second && Zeal::EqGame::get_target() && Zeal::EqGame::get_target() == near_ents[last_index].second)
 		AddIndex();
 
-	if (near_ents[last_index])
-		return near_ents[last_index];
-	else
-		return 0;
-
+	return near_ents[last_index].second;
 }
 
 Zeal::EqStructures::Entity* CycleTarget::get_nearest_ent(float dist, byte type)
 {
-	static ULONGLONG last_press = 0;
-	std::vector<Zeal::EqStructures::Entity*> visible_ents;
-	if (type>1)
-		visible_ents = Zeal::EqGame::get_world_visible_actor_list(dist, true);
-	else
-		visible_ents = Zeal::EqGame::get_world_visible_actor_list(dist, false);
+	ZealService::get_instance()->entity_manager->get_visible_actors(dist, type > 1, visible_ents);
 	if (!visible_ents.size())
 		return 0;
+	Vec3 self_pos = Zeal::EqGame::get_self()->Position;
 	near_ents.clear();
 	for (auto& ent : visible_ents)
 	{
 		if (ent->ActorInfo && ent->ActorInfo->IsInvisible)
 			continue;
-		if (!ent->IsHidden && ent->Type == type && ent->Level > 0 && ent->TargetType < 66)
-		{
-			if (ent->PetOwnerSpawnId)
-			{
-				Zeal::EqStructures::Entity* owner = Zeal::EqGame::get_entity_by_id(ent->PetOwnerSpawnId);
-				if ((owner && (owner->Type == Zeal::EqEnums::EntityTypes::NPC || owner->Type == Zeal::EqEnums::EntityTypes::NPCCorpse)) || !owner)
-					near_ents.push_back(ent);
-			}
-			else
-				near_ents.push_back(ent);
-		}
+		if (!ent->IsHidden && ent->Type == type && ent->Level > 0 && ent->TargetType < 66 && is_npc_owned(ent))
+			near_ents.push_back({ dist_sq(ent->Position, self_pos), ent });
 	}
 	if (!near_ents.size())
 		return 0;
 
-	std::sort(near_ents.begin(), near_ents.end(), compareDist);
+	//only the closest one is needed, no need to order the rest
+	auto nearest = std::min_element(near_ents.begin(), near_ents.end(), compare_key);
+	std::iter_swap(near_ents.begin(), nearest);
 	AddIndex();
 
-	if (near_ents.front())
-		return near_ents.front();
-	else
-		return 0;
-
+	return near_ents.front().second;
 }
 
 CycleTarget::~CycleTarget()
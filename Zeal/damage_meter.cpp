@@ -0,0 +1,291 @@
+#include "damage_meter.h"
+#include "Zeal.h"
+#include "string_util.h"
+#include <algorithm>
+
+DamageMeter::source_totals& DamageMeter::source(UINT16 spawn_id, ULONGLONG now)
+{
+	USHORT& slot = (*source_slot)[spawn_id];
+	if (!slot)
+	{
+		current.sources.push_back({});
+		source_totals& s = current.sources.back();
+		s.spawn_id = spawn_id;
+		s.first = now;
+		strcpy_s(s.name, "Unknown");
+		Zeal::EqStructures::Entity* ent = spawn_id ? ZealService::get_instance()->entity_manager->get(spawn_id) : nullptr;
+		if (ent)
+		{
+			strncpy_s(s.name, Zeal::EqGame::strip_name(ent->Name), _TRUNCATE);
+			Zeal::EqStructures::Entity* self = Zeal::EqGame::get_self();
+			s.ours = self && (ent == self || ent->PetOwnerSpawnId == self->SpawnId);
+		}
+		slot = (USHORT)current.sources.size();
+	}
+	return current.sources[slot - 1];
+}
+
+void DamageMeter::add_hit(const Zeal::Packets::Damage_Struct* dmg, int heal)
+{
+	if (!dmg || !Zeal::EqGame::is_in_game())
+		return;
+	ULONGLONG now = GetTickCount64();
+	if (dmg->damage > 0)
+	{
+		Zeal::EqStructures::Entity* target = ZealService::get_instance()->entity_manager->get(dmg->target);
+		if (!target || target->Type != Zeal::EqEnums::EntityTypes::NPC || target->PetOwnerSpawnId)
+			return; //only damage done to npcs makes up a fight
+		if (!open)
+		{
+			current = fight();
+			current.foe = Zeal::EqGame::strip_name(target->Name);
+			current.start = now;
+			open = true;
+		}
+		if (std::find(foes.begin(), foes.end(), dmg->target) == foes.end())
+			foes.push_back(dmg->target);
+		source_totals& s = source(dmg->source, now);
+		s.damage += dmg->damage;
+		s.hits++;
+		if ((UINT)dmg->damage > s.max_hit)
+			s.max_hit = dmg->damage;
+		s.last = now;
+		current.damage += dmg->damage;
+		current.end = now;
+	}
+	else if (heal > 0 && open)
+	{
+		source_totals& s = source(dmg->source, now);
+		s.healing += heal;
+		s.heals++;
+		s.last = now;
+		current.healing += heal;
+		current.end = now;
+	}
+}
+
+void DamageMeter::on_death(const char* buffer, UINT len)
+{
+	if (len < sizeof(Zeal::Packets::Death_Struct) || !open)
+		return;
+	const Zeal::Packets::Death_Struct* death = (const Zeal::Packets::Death_Struct*)buffer;
+	auto it = std::find(foes.begin(), foes.end(), death->spawn_id);
+	if (it == foes.end())
+		return;
+	foes.erase(it);
+	if (!foes.size())
+		close_fight();
+}
+
+void DamageMeter::close_fight()
+{
+	if (!open)
+		return;
+	for (const source_totals& s : current.sources)
+		(*source_slot)[s.spawn_id] = 0;
+	history.push_back(std::move(current));
+	if (history.size() > history_size)
+		history.erase(history.begin());
+	current = fight();
+	foes.clear();
+	open = false;
+}
+
+void DamageMeter::reset()
+{
+	close_fight();
+	history.clear();
+}
+
+void DamageMeter::tick()
+{
+	if (!open)
+		return;
+	if (idle_timeout.get() > 0 && GetTickCount64() - current.end > (ULONGLONG)idle_timeout.get() * 1000)
+	{
+		close_fight();
+		return;
+	}
+	if (stream.get())
+		ZealService::get_instance()->pipe->write(to_json(0), pipe_data_type::custom);
+}
+
+const DamageMeter::fight* DamageMeter::get_fight(int index) const
+{
+	if (open)
+	{
+		if (index == 0)
+			return &current;
+		index--;
+	}
+	if (index < 0 || index >= (int)history.size())
+		return nullptr;
+	return &history[history.size() - 1 - index];
+}
+
+Zeal::Frame::vector<const DamageMeter::source_totals*> DamageMeter::ranked(const fight& f) const
+{
+	auto sorted = Zeal::Frame::make_vector<const source_totals*>();
+	sorted.reserve(f.sources.size());
+	for (const source_totals& s : f.sources)
+		sorted.push_back(&s);
+	std::sort(sorted.begin(), sorted.end(), [](const source_totals* a, const source_totals* b) {
+		if (a->damage != b->damage)
+			return a->damage > b->damage;
+		return a->healing > b->healing;
+	});
+	return sorted;
+}
+
+void DamageMeter::print(int index) const
+{
+	const fight* f = get_fight(index);
+	if (!f)
+	{
+		Zeal::EqGame::print_chat("No fight recorded");
+		return;
+	}
+	float seconds = f->seconds();
+	Zeal::EqGame::print_chat("%s %s: %.0fs, %llu damage (%.0f dps), %llu healing (%.0f hps)", f == &current ? "Fighting" : "Fight with",
+		f->foe.c_str(), seconds, f->damage, f->damage / seconds, f->healing, f->healing / seconds);
+	int shown = 0;
+	for (const source_totals* s : ranked(*f))
+	{
+		if (++shown > 10)
+			break;
+		Zeal::EqGame::print_chat("%s: %llu (%.0f dps, %.0f%%) in %u hits, max %u, healed %llu", s->name, s->damage, s->damage / seconds,
+			f->damage ? s->damage * 100.0 / f->damage : 0.0, s->hits, s->max_hit, s->healing);
+	}
+}
+
+std::string DamageMeter::to_json(int index) const
+{
+	const fight* f = get_fight(index);
+	if (!f)
+		return nlohmann::json({ {"damage_meter", nullptr} }).dump(-1, ' ', false, nlohmann::json::error_handler_t::replace);
+	float seconds = f->seconds();
+	nlohmann::json sources = nlohmann::json::array();
+	for (const source_totals* s : ranked(*f))
+	{
+		sources.push_back({ {"spawn_id", s->spawn_id}, {"name", s->name}, {"ours", s->ours}, {"damage", s->damage}, {"healing", s->healing},
+			{"hits", s->hits}, {"heals", s->heals}, {"max_hit", s->max_hit}, {"dps", s->damage / seconds}, {"hps", s->healing / seconds} });
+	}
+	nlohmann::json root = { {"damage_meter", { {"foe", f->foe}, {"open", f == &current}, {"seconds", seconds}, {"damage", f->damage},
+		{"healing", f->healing}, {"sources", sources} }} };
+	return root.dump(-1, ' ', false, nlohmann::json::error_handler_t::replace);
+}
+
+// names in the ui font, dps, damage and share in digits, the fight header shows seconds and total dps
+void DamageMeter::render()
+{
+	ZealService* zeal = ZealService::get_instance();
+	if (!overlay.get() || !Zeal::EqGame::is_in_game() || !Zeal::EqGame::get_wnd_manager() || !zeal->dx)
+		return;
+	const fight* f = get_fight(0);
+	if (!f)
+		return;
+	Zeal::EqUI::CTextureFont* fnt = Zeal::EqGame::get_wnd_manager()->GetFont(2);
+	IDirect3DDevice8* device = zeal->dx->get_device();
+	if (!fnt || !device)
+		return;
+	Vec2 screen = zeal->dx->GetScreenRect();
+	if (screen.y <= 0)
+		return;
+	int line = fnt->GetHeight() + 2;
+	bool batched = digits.ready(device, fnt->GetHeight());
+	Zeal::EqUI::CXRect clip(0, 0, (int)screen.x, (int)screen.y);
+	auto number = [&](UINT64 value, float x, float y, D3DCOLOR color) {
+		char text[24];
+		snprintf(text, sizeof(text), "%llu", value);
+		if (batched)
+			digits.add(text, x, y, color);
+		else
+			fnt->DrawWrappedText(text, Zeal::EqUI::CXRect((int)x, (int)y, (int)x + 80, (int)y + line), clip, color, 1, 0);
+	};
+	auto label = [&](const char* text, float x, float y, D3DCOLOR color) {
+		fnt->DrawWrappedText(text, Zeal::EqUI::CXRect((int)x, (int)y, (int)x + 115, (int)y + line), clip, color, 1, 0);
+	};
+	const D3DCOLOR header = f == &current ? D3DCOLOR_ARGB(255, 255, 200, 80) : D3DCOLOR_ARGB(255, 160, 160, 160);
+	const D3DCOLOR mine = D3DCOLOR_ARGB(255, 120, 220, 255);
+	const D3DCOLOR other = D3DCOLOR_ARGB(255, 230, 230, 230);
+	float seconds = f->seconds();
+	float x = 10.f;
+	float y = screen.y * 0.45f;
+	label(f->foe.c_str(), x, y, header);
+	number((UINT64)seconds, x + 120.f, y, header);
+	number((UINT64)(f->damage / seconds), x + 170.f, y, header);
+	int shown = 0;
+	for (const source_totals* s : ranked(*f))
+	{
+		if (++shown > 8 || !s->damage)
+			break;
+		y += line;
+		D3DCOLOR color = s->ours ? mine : other;
+		label(s->name, x, y, color);
+		number((UINT64)(s->damage / seconds), x + 120.f, y, color);
+		number(s->damage, x + 170.f, y, color);
+		number(f->damage ? s->damage * 100 / f->damage : 0, x + 240.f, y, color);
+	}
+	if (batched)
+		digits.flush(device);
+}
+
+DamageMeter::DamageMeter(ZealService* zeal)
+{
+	zeal->memory_report->add("damage meter", [this]() {
+		Zeal::Memory::usage use{ sizeof(*source_slot) + Zeal::Memory::vector_bytes(history) + Zeal::Memory::vector_bytes(foes) + Zeal::Memory::vector_bytes(current.sources), history.size() };
+		for (const fight& f : history)
+			use.bytes += Zeal::Memory::string_bytes(f.foe) + Zeal::Memory::vector_bytes(f.sources);
+		return use;
+	});
+	source_slot = std::make_unique<std::array<USHORT, 0x10000>>();
+	source_slot->fill(0);
+	zeal->callbacks->add_packet([this](UINT opcode, char* buffer, UINT len) { on_death(buffer, len); return false; }, { Zeal::Packets::DeathDamage });
+	zeal->callbacks->add_generic([this]() { close_fight(); }, callback_type::Zone);
+	zeal->callbacks->add_generic([this]() { render(); }, callback_type::AddDeferred);
+	zeal->callbacks->add_generic([this]() { digits.release(); }, callback_type::DeviceReset);
+	zeal->callbacks->add_work([this](int) { tick(); return false; }, 1000);
+	zeal->commands_hook->add("/dmgmeter", {}, "Damage and healing per source for recent fights, /dmgmeter [fight] | overlay | reset | pipe [fight] | stream | idle <seconds>.",
+		[this, zeal](std::vector<std::string>& args) {
+			int index = 0;
+			if (args.size() > 1 && Zeal::String::compare_insensitive(args[1], "overlay"))
+			{
+				overlay.set(!overlay.get());
+				Zeal::EqGame::print_chat("Damage meter overlay is %s", overlay.get() ? "on" : "off");
+			}
+			else if (args.size() > 1 && Zeal::String::compare_insensitive(args[1], "reset"))
+			{
+				reset();
+				Zeal::EqGame::print_chat("Damage meter cleared");
+			}
+			else if (args.size() > 1 && Zeal::String::compare_insensitive(args[1], "pipe"))
+			{
+				if (args.size() > 2)
+					Zeal::String::tryParse(args[2], &index);
+				zeal->pipe->write(to_json(index), pipe_data_type::custom);
+			}
+			else if (args.size() > 1 && Zeal::String::compare_insensitive(args[1], "stream"))
+			{
+				stream.set(!stream.get());
+				Zeal::EqGame::print_chat("Damage meter pipe stream is %s", stream.get() ? "on" : "off");
+			}
+			else if (args.size() > 2 && Zeal::String::compare_insensitive(args[1], "idle"))
+			{
+				int seconds = 0;
+				if (Zeal::String::tryParse(args[2], &seconds) && seconds >= 0)
+					idle_timeout.set(seconds);
+				Zeal::EqGame::print_chat("Fights close after %d seconds without a hit%s", idle_timeout.get(), idle_timeout.get() ? "" : " (never)");
+			}
+			else
+			{
+				if (args.size() > 1)
+					Zeal::String::tryParse(args[1], &index);
+				print(index);
+			}
+			return true;
+		});
+}
+
+DamageMeter::~DamageMeter()
+{
+}
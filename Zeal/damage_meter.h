@@ -0,0 +1,64 @@
+#pragma once
+#include <Windows.h>
+#include <array>
+#include <memory>
+#include <string>
+#include <vector>
+#include "settings.h"
+#include "digit_batch.h"
+#include "frame_arena.h"
+#include "EqPackets.h"
+
+// damage and healing per source from the hits the client reports, split into fights that end when every npc hit in them has died
+// sources live in a flat table indexed by spawn id for the current fight, finished fights keep their own copy
+class DamageMeter
+{
+public:
+	void add_hit(const Zeal::Packets::Damage_Struct* dmg, int heal); //from the ReportSuccessfulHit hook
+	void reset();
+	std::string to_json(int fight) const; //0 is the current or last fight, 1 the one before and so on
+	DamageMeter(class ZealService* zeal);
+	~DamageMeter();
+	Setting<bool> overlay{ "Zeal", "DamageMeterOverlay", false };
+	Setting<int> idle_timeout{ "Zeal", "DamageMeterIdle", 10 }; //seconds without a hit before a fight closes on its own
+	Setting<bool> stream{ "Zeal", "DamageMeterPipe", false }; //source totals of the open fight to the pipe once a second
+private:
+	static constexpr size_t history_size = 10;
+	struct source_totals
+	{
+		UINT16 spawn_id;
+		bool ours; //self or a pet of ours
+		char name[32];
+		UINT64 damage;
+		UINT64 healing;
+		UINT hits;
+		UINT heals;
+		UINT max_hit;
+		ULONGLONG first; //tick of the first and last hit or heal
+		ULONGLONG last;
+	};
+	struct fight
+	{
+		std::string foe; //the first npc hit
+		ULONGLONG start = 0;
+		ULONGLONG end = 0;
+		UINT64 damage = 0;
+		UINT64 healing = 0;
+		std::vector<source_totals> sources;
+		float seconds() const { return end > start + 1000 ? (end - start) / 1000.f : 1.f; }
+	};
+	source_totals& source(UINT16 spawn_id, ULONGLONG now);
+	void on_death(const char* buffer, UINT len);
+	void close_fight();
+	void tick();
+	void render();
+	void print(int index) const;
+	const fight* get_fight(int index) const;
+	Zeal::Frame::vector<const source_totals*> ranked(const fight& f) const; //frame arena, the overlay ranks every frame
+	std::unique_ptr<std::array<USHORT, 0x10000>> source_slot; //spawn id -> current.sources index + 1, 0 when not in this fight
+	std::vector<UINT16> foes; //npcs hit in the open fight that are still alive
+	fight current;
+	bool open = false;
+	std::vector<fight> history; //newest last
+	DigitBatch digits;
+};
@@ -0,0 +1,332 @@
+#include "debug_log.h"
+#include "Zeal.h"
+#include "string_util.h"
+#include "spsc_queue.h"
+#include <memory>
+#include <mutex>
+#include <vector>
+
+namespace
+{
+	struct thread_ring
+	{
+		spsc_queue<Zeal::Log::record> records{ 1024 };
+		DWORD thread = 0;
+		std::atomic<UINT> dropped = 0;
+	};
+	// a ring outlives its thread so the last records of a finished thread still get written
+	std::mutex rings_lock;
+	std::vector<std::unique_ptr<thread_ring>> rings;
+	thread_local thread_ring* local_ring = nullptr;
+	std::atomic<int> min_level = static_cast<int>(Zeal::Log::level::warn);
+	std::mutex muted_lock;
+	std::vector<std::string> muted;
+}
+
+std::atomic<UINT> Zeal::Log::filter_generation = 1; //sites start at 0 so their first call refreshes
+
+bool Zeal::Log::refresh(site& s)
+{
+	UINT generation = filter_generation.load();
+	bool on = s.severity != level::off && static_cast<int>(s.severity) >= min_level.load();
+	if (on)
+	{
+		std::lock_guard<std::mutex> guard(muted_lock);
+		for (const std::string& module : muted)
+			if (!_stricmp(module.c_str(), s.module))
+				on = false;
+	}
+	s.filter.store(generation << 1 | (on ? 1 : 0), std::memory_order_relaxed);
+	return on;
+}
+
+void Zeal::Log::submit(const record& r)
+{
+	if (!local_ring)
+	{
+		std::lock_guard<std::mutex> guard(rings_lock);
+		rings.push_back(std::make_unique<thread_ring>());
+		local_ring = rings.back().get();
+		local_ring->thread = r.thread;
+	}
+	record copy = r;
+	if (!local_ring->records.push(std::move(copy)))
+		local_ring->dropped.fetch_add(1, std::memory_order_relaxed);
+}
+
+void Zeal::Log::set_level(level l)
+{
+	min_level = static_cast<int>(l);
+	filter_generation++;
+}
+
+Zeal::Log::level Zeal::Log::get_level()
+{
+	return static_cast<level>(min_level.load());
+}
+
+void Zeal::Log::set_muted(const std::string& modules)
+{
+	{
+		std::lock_guard<std::mutex> guard(muted_lock);
+		muted.clear();
+		for (const std::string& module : Zeal::String::split(modules, ","))
+			if (module.length())
+				muted.push_back(module);
+	}
+	filter_generation++;
+}
+
+std::string Zeal::Log::get_muted()
+{
+	std::lock_guard<std::mutex> guard(muted_lock);
+	std::string out;
+	for (const std::string& module : muted)
+		out += (out.length() ? "," : "") + module;
+	return out;
+}
+
+const char* Zeal::Log::level_name(level l)
+{
+	static const char* names[] = { "trace", "debug", "info", "warn", "error", "off" };
+	int i = static_cast<int>(l);
+	return i >= 0 && i <= static_cast<int>(level::off) ? names[i] : "?";
+}
+
+// one printf conversion per argument, the length modifiers are rewritten to the packed 64 bit or double argument
+static void format_record(const Zeal::Log::record& r, std::string& out)
+{
+	const char* format = r.origin->format;
+	int arg = 0;
+	char spec[32];
+	char buffer[128];
+	for (const char* p = format; *p; p++)
+	{
+		if (*p != '%')
+		{
+			out += *p;
+			continue;
+		}
+		if (p[1] == '%')
+		{
+			out += '%';
+			p++;
+			continue;
+		}
+		size_t len = 0;
+		spec[len++] = '%';
+		const char* q = p + 1;
+		for (; *q && strchr("-+ #0123456789.", *q); q++)
+			if (len < sizeof(spec) - 4)
+				spec[len++] = *q;
+		while (*q && strchr("hlLqjztI64", *q))
+			q++;
+		char conversion = *q;
+		if (!conversion)
+			break;
+		p = q;
+		if (arg >= r.argc)
+		{
+			out += "<missing>";
+			continue;
+		}
+		int type = r.types[arg];
+		const auto& value = r.args[arg++];
+		bool integer_conversion = strchr("diuoxXc", conversion) != nullptr;
+		bool float_conversion = strchr("feEgGaA", conversion) != nullptr;
+		int written = 0;
+		if (type == Zeal::Log::arg_text)
+		{
+			spec[len++] = 's';
+			spec[len] = '\0';
+			written = snprintf(buffer, sizeof(buffer), spec, r.text + value.text);
+		}
+		else if (type == Zeal::Log::arg_double)
+		{
+			spec[len++] = float_conversion ? conversion : 'g';
+			spec[len] = '\0';
+			written = snprintf(buffer, sizeof(buffer), spec, value.d);
+		}
+		else if (type == Zeal::Log::arg_pointer || conversion == 'p')
+		{
+			spec[len++] = 'p';
+			spec[len] = '\0';
+			written = snprintf(buffer, sizeof(buffer), spec, value.p);
+		}
+		else if (float_conversion)
+		{
+			spec[len++] = conversion;
+			spec[len] = '\0';
+			written = snprintf(buffer, sizeof(buffer), spec, type == Zeal::Log::arg_int ? static_cast<double>(value.i) : static_cast<double>(value.u));
+		}
+		else if (conversion == 'c')
+		{
+			spec[len++] = 'c';
+			spec[len] = '\0';
+			written = snprintf(buffer, sizeof(buffer), spec, static_cast<int>(value.i));
+		}
+		else
+		{
+			spec[len++] = 'l';
+			spec[len++] = 'l';
+			spec[len++] = integer_conversion ? conversion : (type == Zeal::Log::arg_int ? 'd' : 'u');
+			spec[len] = '\0';
+			written = snprintf(buffer, sizeof(buffer), spec, value.i);
+		}
+		if (written > 0)
+			out.append(buffer, written < static_cast<int>(sizeof(buffer)) ? written : sizeof(buffer) - 1);
+	}
+}
+
+bool DebugLog::open_file()
+{
+	if (file != INVALID_HANDLE_VALUE)
+		return true;
+	CreateDirectoryA("Logs", NULL);
+	file = CreateFileA("Logs\\zeal_debug.txt", FILE_APPEND_DATA, FILE_SHARE_READ | FILE_SHARE_WRITE | FILE_SHARE_DELETE, NULL, OPEN_ALWAYS, FILE_ATTRIBUTE_NORMAL, NULL);
+	if (file == INVALID_HANDLE_VALUE)
+		return false;
+	LARGE_INTEGER size = {};
+	GetFileSizeEx(file, &size);
+	file_size = size.QuadPart;
+	return true;
+}
+
+void DebugLog::write_out(bool force)
+{
+	if (!pending.length() || !open_file())
+		return;
+	ULONGLONG limit = static_cast<ULONGLONG>(max_kb.get() > 0 ? max_kb.get() : 4096) * 1024;
+	if (file_size && file_size + pending.length() > limit)
+	{
+		CloseHandle(file);
+		file = INVALID_HANDLE_VALUE;
+		MoveFileExA("Logs\\zeal_debug.txt", "Logs\\zeal_debug.1.txt", MOVEFILE_REPLACE_EXISTING);
+		if (!open_file())
+			return;
+	}
+	DWORD written = 0;
+	WriteFile(file, pending.data(), static_cast<DWORD>(pending.length()), &written, NULL);
+	file_size += written;
+	pending.clear();
+	if (force)
+		FlushFileBuffers(file);
+}
+
+void DebugLog::render(const Zeal::Log::record& r)
+{
+	ULARGE_INTEGER stamp;
+	stamp.QuadPart = filetime_base + static_cast<LONGLONG>((r.qpc - qpc_base) * filetime_per_qpc);
+	FILETIME utc = { stamp.LowPart, stamp.HighPart };
+	SYSTEMTIME system, local;
+	FileTimeToSystemTime(&utc, &system);
+	SystemTimeToTzSpecificLocalTime(NULL, &system, &local);
+	char prefix[96];
+	snprintf(prefix, sizeof(prefix), "%04u-%02u-%02u %02u:%02u:%02u.%03u %-5s %s %u: ", local.wYear, local.wMonth, local.wDay, local.wHour, local.wMinute,
+		local.wSecond, local.wMilliseconds, Zeal::Log::level_name(r.origin->severity), r.origin->module, static_cast<unsigned>(r.thread));
+	pending += prefix;
+	format_record(r, pending);
+	pending += "\r\n";
+}
+
+void DebugLog::drain()
+{
+	std::vector<thread_ring*> current; //a thread logging for the first time only waits for this copy, not the file io
+	{
+		std::lock_guard<std::mutex> guard(rings_lock);
+		for (auto& ring : rings)
+			current.push_back(ring.get());
+	}
+	Zeal::Log::record r;
+	for (thread_ring* ring : current)
+	{
+		while (ring->records.pop(r))
+		{
+			render(r);
+			if (pending.length() >= 64 * 1024)
+				write_out(false);
+		}
+		if (UINT dropped = ring->dropped.exchange(0))
+		{
+			char line[96];
+			snprintf(line, sizeof(line), "%u records dropped on thread %u, its ring was full\r\n", dropped, static_cast<unsigned>(ring->thread));
+			pending += line;
+		}
+	}
+}
+
+void DebugLog::writer_main()
+{
+	while (!end_thread)
+	{
+		WaitForSingleObject(wake_event, 250);
+		drain();
+		write_out(false);
+	}
+	drain();
+	write_out(true);
+	if (file != INVALID_HANDLE_VALUE)
+		CloseHandle(file);
+	file = INVALID_HANDLE_VALUE;
+}
+
+void DebugLog::flush()
+{
+	SetEvent(wake_event);
+}
+
+DebugLog::DebugLog(ZealService* zeal)
+{
+	LARGE_INTEGER frequency, now;
+	QueryPerformanceFrequency(&frequency);
+	QueryPerformanceCounter(&now);
+	FILETIME filetime;
+	GetSystemTimeAsFileTime(&filetime);
+	qpc_base = now.QuadPart;
+	filetime_base = (static_cast<ULONGLONG>(filetime.dwHighDateTime) << 32) | filetime.dwLowDateTime;
+	filetime_per_qpc = 10000000.0 / frequency.QuadPart;
+
+	if (!zeal->ini->exists("Zeal", "DebugLogMuted"))
+		zeal->ini->setValue<std::string>("Zeal", "DebugLogMuted", "");
+	Zeal::Log::set_muted(zeal->ini->getValue<std::string>("Zeal", "DebugLogMuted"));
+	Zeal::Log::set_level(static_cast<Zeal::Log::level>(min_level.get()));
+	min_level.on_change([](int value) { Zeal::Log::set_level(static_cast<Zeal::Log::level>(value)); });
+
+	zeal->commands_hook->add("/zeallog", {}, "Zeal's debug log (Logs\\zeal_debug.txt), /zeallog level <trace|debug|info|warn|error|off>, /zeallog mute|unmute <module>, /zeallog flush",
+		[this, zeal](std::vector<std::string>& args) {
+			if (args.size() > 2 && Zeal::String::compare_insensitive(args[1], "level"))
+			{
+				for (int i = 0; i <= static_cast<int>(Zeal::Log::level::off); i++)
+					if (Zeal::String::compare_insensitive(args[2], Zeal::Log::level_name(static_cast<Zeal::Log::level>(i))))
+						min_level.set(i);
+			}
+			else if (args.size() > 2 && (Zeal::String::compare_insensitive(args[1], "mute") || Zeal::String::compare_insensitive(args[1], "unmute")))
+			{
+				bool mute = Zeal::String::compare_insensitive(args[1], "mute");
+				std::string modules;
+				for (const std::string& module : Zeal::String::split(Zeal::Log::get_muted(), ","))
+					if (!Zeal::String::compare_insensitive(module, args[2]))
+						modules += (modules.length() ? "," : "") + module;
+				if (mute)
+					modules += (modules.length() ? "," : "") + args[2];
+				Zeal::Log::set_muted(modules);
+				zeal->ini->setValue<std::string>("Zeal", "DebugLogMuted", modules);
+			}
+			else if (args.size() > 1 && Zeal::String::compare_insensitive(args[1], "flush"))
+				flush();
+			std::string modules = Zeal::Log::get_muted();
+			Zeal::EqGame::print_chat("Debug log level %s, muted: %s", Zeal::Log::level_name(Zeal::Log::get_level()), modules.length() ? modules.c_str() : "none");
+			return true;
+		});
+	wake_event = CreateEvent(NULL, FALSE, FALSE, NULL);
+	writer = std::thread([this]() { writer_main(); });
+}
+
+DebugLog::~DebugLog()
+{
+	end_thread = true;
+	SetEvent(wake_event);
+	if (writer.joinable())
+		writer.join();
+	CloseHandle(wake_event);
+}
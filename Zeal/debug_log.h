@@ -0,0 +1,175 @@
+#pragma once
+#include <Windows.h>
+#include <atomic>
+#include <cstring>
+#include <string>
+#include <thread>
+#include <type_traits>
+#include "settings.h"
+
+// zeal's own diagnostics, kept out of the chat window. a call site stores its level, module and printf style format once,
+// a call packs its raw arguments into the calling thread's ring without a lock or any formatting, and the DebugLog
+// thread renders the records to Logs\zeal_debug.txt. a call filtered out by level or module costs two loads and a compare
+//   ZEAL_LOG_WARN("pipe", "listening on %s failed, error %u", name, GetLastError());
+namespace Zeal
+{
+	namespace Log
+	{
+		enum struct level : int
+		{
+			trace,
+			debug,
+			info,
+			warn,
+			error,
+			off
+		};
+		struct site
+		{
+			level severity;
+			const char* module;
+			const char* format; //%s takes a const char* or std::string, the other conversions any number
+			std::atomic<UINT> filter = 0; //filter generation << 1 | enabled, refreshed once the filters change
+		};
+		static constexpr int max_args = 8; //later arguments are dropped
+		static constexpr int text_capacity = 96; //shared by the string arguments, longer ones are cut
+		enum arg_type : UINT8
+		{
+			arg_int,
+			arg_uint,
+			arg_double,
+			arg_text,
+			arg_pointer
+		};
+		struct record
+		{
+			const site* origin;
+			LONGLONG qpc;
+			DWORD thread;
+			UINT8 argc;
+			UINT8 text_used;
+			UINT8 types[max_args];
+			union
+			{
+				INT64 i;
+				UINT64 u;
+				double d;
+				const void* p;
+				UINT8 text; //offset into text, zero terminated
+			} args[max_args];
+			char text[text_capacity];
+			template<typename T>
+			void add(const T& v)
+			{
+				if (argc >= max_args)
+					return;
+				if constexpr (std::is_same_v<T, std::string>)
+					add_text(v.data(), v.length());
+				else if constexpr (std::is_convertible_v<const T&, const char*>)
+				{
+					const char* t = v;
+					add_text(t ? t : "(null)", t ? strlen(t) : 6);
+				}
+				else if constexpr (std::is_floating_point_v<T>)
+				{
+					types[argc] = arg_double;
+					args[argc++].d = static_cast<double>(v);
+				}
+				else if constexpr (std::is_pointer_v<T>)
+				{
+					types[argc] = arg_pointer;
+					args[argc++].p = v;
+				}
+				else if constexpr (std::is_enum_v<T> || std::is_signed_v<T>)
+				{
+					types[argc] = arg_int;
+					args[argc++].i = static_cast<INT64>(v);
+				}
+				else
+				{
+					static_assert(std::is_integral_v<T>, "log arguments are numbers, pointers or strings");
+					types[argc] = arg_uint;
+					args[argc++].u = static_cast<UINT64>(v);
+				}
+			}
+			void add_text(const char* t, size_t len)
+			{
+				size_t room = text_capacity - text_used;
+				if (!room)
+					return;
+				if (len > room - 1)
+					len = room - 1;
+				memcpy(text + text_used, t, len);
+				text[text_used + len] = '\0';
+				types[argc] = arg_text;
+				args[argc++].text = text_used;
+				text_used = static_cast<UINT8>(text_used + len + 1);
+			}
+		};
+		extern std::atomic<UINT> filter_generation;
+		bool refresh(site& s); //the filters changed since the site last checked
+		inline bool enabled(site& s)
+		{
+			UINT cached = s.filter.load(std::memory_order_relaxed);
+			if ((cached >> 1) == filter_generation.load(std::memory_order_relaxed))
+				return cached & 1;
+			return refresh(s);
+		}
+		void submit(const record& r); //any thread, dropped and counted when the thread's ring is full
+		template<typename... Args>
+		void write(const site& s, const Args&... args)
+		{
+			record r;
+			r.origin = &s;
+			QueryPerformanceCounter(reinterpret_cast<LARGE_INTEGER*>(&r.qpc));
+			r.thread = GetCurrentThreadId();
+			r.argc = 0;
+			r.text_used = 0;
+			(r.add(args), ...);
+			submit(r);
+		}
+		void set_level(level min_level);
+		level get_level();
+		void set_muted(const std::string& modules); //comma separated
+		std::string get_muted();
+		const char* level_name(level l);
+	}
+}
+
+#define ZEAL_LOG(severity, module, format, ...) \
+	do { \
+		static Zeal::Log::site zeal_log_site{ severity, module, format }; \
+		if (Zeal::Log::enabled(zeal_log_site)) \
+			Zeal::Log::write(zeal_log_site, ##__VA_ARGS__); \
+	} while (0)
+#define ZEAL_LOG_TRACE(module, format, ...) ZEAL_LOG(Zeal::Log::level::trace, module, format, ##__VA_ARGS__)
+#define ZEAL_LOG_DEBUG(module, format, ...) ZEAL_LOG(Zeal::Log::level::debug, module, format, ##__VA_ARGS__)
+#define ZEAL_LOG_INFO(module, format, ...) ZEAL_LOG(Zeal::Log::level::info, module, format, ##__VA_ARGS__)
+#define ZEAL_LOG_WARN(module, format, ...) ZEAL_LOG(Zeal::Log::level::warn, module, format, ##__VA_ARGS__)
+#define ZEAL_LOG_ERROR(module, format, ...) ZEAL_LOG(Zeal::Log::level::error, module, format, ##__VA_ARGS__)
+
+// renders every thread's ring to the file, rotating it to zeal_debug.1.txt at DebugLogMaxKB
+class DebugLog
+{
+public:
+	DebugLog(class ZealService* zeal);
+	~DebugLog();
+	void flush(); //any thread, wakes the writer
+private:
+	void writer_main();
+	void drain();
+	void render(const Zeal::Log::record& r);
+	void write_out(bool force);
+	bool open_file();
+	Setting<int> min_level{ "Zeal", "DebugLogLevel", static_cast<int>(Zeal::Log::level::warn) };
+	Setting<int> max_kb{ "Zeal", "DebugLogMaxKB", 4096 };
+	HANDLE file = INVALID_HANDLE_VALUE;
+	ULONGLONG file_size = 0;
+	std::string pending; //writer thread only
+	LONGLONG qpc_base = 0;
+	ULONGLONG filetime_base = 0;
+	double filetime_per_qpc = 0;
+	HANDLE wake_event = nullptr;
+	std::atomic<bool> end_thread = false;
+	std::thread writer;
+};
@@ -0,0 +1,87 @@
+#include "digit_batch.h"
+#include "Zeal.h"
+
+#define DIGIT_FVF (D3DFVF_XYZRHW | D3DFVF_DIFFUSE | D3DFVF_TEX1)
+
+static void set_draw_states(render_state_cache& states, IDirect3DTexture8* atlas)
+{
+	states.set_render_state(D3DRS_CULLMODE, D3DCULL_NONE);
+	states.set_render_state(D3DRS_ALPHABLENDENABLE, TRUE);
+	states.set_render_state(D3DRS_SRCBLEND, D3DBLEND_SRCALPHA);
+	states.set_render_state(D3DRS_DESTBLEND, D3DBLEND_INVSRCALPHA);
+	states.set_render_state(D3DRS_ZENABLE, FALSE);
+	states.set_render_state(D3DRS_ZWRITEENABLE, FALSE);
+	states.set_render_state(D3DRS_LIGHTING, FALSE);
+	states.set_render_state(D3DRS_FOGENABLE, FALSE);
+	states.set_texture_stage_state(0, D3DTSS_COLOROP, D3DTOP_MODULATE);
+	states.set_texture_stage_state(0, D3DTSS_COLORARG1, D3DTA_TEXTURE);
+	states.set_texture_stage_state(0, D3DTSS_COLORARG2, D3DTA_DIFFUSE);
+	states.set_texture_stage_state(0, D3DTSS_ALPHAOP, D3DTOP_MODULATE);
+	states.set_texture_stage_state(0, D3DTSS_ALPHAARG1, D3DTA_TEXTURE);
+	states.set_texture_stage_state(0, D3DTSS_ALPHAARG2, D3DTA_DIFFUSE);
+	states.set_texture_stage_state(0, D3DTSS_MINFILTER, D3DTEXF_POINT);
+	states.set_texture_stage_state(0, D3DTSS_MAGFILTER, D3DTEXF_POINT);
+	states.set_texture_stage_state(1, D3DTSS_COLOROP, D3DTOP_DISABLE);
+	states.set_texture(atlas);
+	states.set_vertex_shader(DIGIT_FVF);
+}
+
+bool DigitBatch::ready(IDirect3DDevice8* device, int pixel_height)
+{
+	if (!device || pixel_height <= 0)
+		return false;
+	GlyphCache& glyphs = ZealService::get_instance()->dx->glyphs;
+	if (atlas && atlas_device == device && atlas_height == pixel_height && atlas_generation == glyphs.generation)
+		return true;
+	atlas = glyphs.get(device, "Arial", pixel_height);
+	atlas_device = device;
+	atlas_height = pixel_height;
+	atlas_generation = glyphs.generation;
+	return atlas != nullptr;
+}
+
+void DigitBatch::add(const char* text, float x, float y, D3DCOLOR color)
+{
+	float h = atlas->line_height;
+	for (; *text; text++)
+	{
+		const GlyphAtlas::glyph* g = atlas->find(*text);
+		if (!g)
+			continue;
+		float w = g->width;
+		float left = x - 0.5f, top = y - 0.5f, right = x + w - 0.5f, bottom = y + h - 0.5f; //texel centers on pixel centers
+		vertex quad[6] = {
+			{ left, top, 0.f, 1.f, color, g->u0, g->v0 },
+			{ right, top, 0.f, 1.f, color, g->u1, g->v0 },
+			{ left, bottom, 0.f, 1.f, color, g->u0, g->v1 },
+			{ right, top, 0.f, 1.f, color, g->u1, g->v0 },
+			{ right, bottom, 0.f, 1.f, color, g->u1, g->v1 },
+			{ left, bottom, 0.f, 1.f, color, g->u0, g->v1 },
+		};
+		vertices.insert(vertices.end(), quad, quad + 6);
+		x += w;
+	}
+}
+
+void DigitBatch::flush(IDirect3DDevice8* device)
+{
+	if (!vertices.size() || !atlas || device != atlas_device)
+	{
+		vertices.clear();
+		return;
+	}
+	render_state_cache& states = ZealService::get_instance()->dx->states;
+	states.begin(device);
+	set_draw_states(states, atlas->texture);
+	device->DrawPrimitiveUP(D3DPT_TRIANGLELIST, (UINT)(vertices.size() / 3), vertices.data(), sizeof(vertex));
+	states.restore();
+	vertices.clear();
+}
+
+void DigitBatch::release()
+{
+	atlas = nullptr; //owned by the glyph cache
+	atlas_device = nullptr;
+	atlas_height = 0;
+	vertices.clear();
+}
@@ -0,0 +1,28 @@
+#pragma once
+#include <Windows.h>
+#include <vector>
+#include "d3dx8/d3d8.h"
+#include "glyph_cache.h"
+
+// draws short strings, mostly numbers, as textured quads out of the shared glyph atlas for its height (dx->glyphs)
+// everything added between ready() and flush() goes out in a single draw call with per vertex color and alpha
+class DigitBatch
+{
+public:
+	bool ready(IDirect3DDevice8* device, int pixel_height); //looks the atlas up again after a reset or a new height
+	void add(const char* text, float x, float y, D3DCOLOR color);
+	void flush(IDirect3DDevice8* device);
+	void release(); //before a device reset, the next ready() looks up the rebuilt atlas
+private:
+	struct vertex
+	{
+		float x, y, z, rhw;
+		D3DCOLOR color;
+		float u, v;
+	};
+	IDirect3DDevice8* atlas_device = nullptr;
+	const GlyphAtlas* atlas = nullptr;
+	UINT atlas_generation = 0;
+	int atlas_height = 0;
+	std::vector<vertex> vertices; //triangle list, reused every frame
+};
@@ -1,35 +1,222 @@
 #include "directx.h"
 #include "Zeal.h"
+#include <xmmintrin.h>
 #pragma comment(lib, "d3dx8/d3d8.lib")
 #pragma comment(lib, "d3dx8/d3dx8.lib")
 
 HRESULT WINAPI Local_EndScene(LPDIRECT3DDEVICE8 pDevice)
 {
-    HRESULT ret = ZealService::get_instance()->hooks->hook_map["EndScene"]->original(Local_EndScene)(pDevice);
     __asm { pushad };
     if (pDevice)
     {
+        FrameProfiler* profiler = ZealService::get_instance()->frame_profiler.get();
+        if (profiler)
+            profiler->mark(frame_phase::end_scene);
+        LONGLONG overlay_start = profiler ? profiler->overlay_begin(pDevice, true) : 0;
         if (ZealService::get_instance()->callbacks)
-            ZealService::get_instance()->callbacks->invoke_generic(callback_type::EndScene);
+            ZealService::get_instance()->callbacks->invoke_generic(callback_type::EndScene); //still inside the scene so callbacks can draw
+        if (profiler)
+            profiler->overlay_end(pDevice, overlay_start, true);
     }
     __asm { popad };
+    HRESULT ret = hook_ref<Local_EndScene>::original()(pDevice);
+    if (pDevice && ZealService::get_instance()->dx)
+        ZealService::get_instance()->dx->end_frame(); //the next projection captures fresh transforms
     return ret;
 }
 
 HRESULT WINAPI Local_Reset(IDirect3DDevice8* pDevice, D3DPRESENT_PARAMETERS* pPresentationParameters)
 {
-    ZealService::get_instance()->dx->device = nullptr;
-    HRESULT ret = ZealService::get_instance()->hooks->hook_map["Reset"]->original(Local_Reset)(pDevice, pPresentationParameters);
+    if (ZealService::get_instance()->callbacks)
+        ZealService::get_instance()->callbacks->invoke_generic(callback_type::DeviceReset);
+    ZealService::get_instance()->dx->device_lost();
+    HRESULT ret = hook_ref<Local_Reset>::original()(pDevice, pPresentationParameters);
     return ret;
 }
 
-void directx::update_device()
+void render_state_cache::invalidate()
+{
+    for (slot& s : slots)
+        s.known = false;
+}
+
+void render_state_cache::begin(IDirect3DDevice8* new_device)
+{
+    invalidate(); //the game may have drawn since the last pass, and nothing tells us when it does
+    device = new_device;
+}
+
+DWORD render_state_cache::get(UINT key)
+{
+    slot& s = slots[key];
+    if (!s.known)
+    {
+        if (key < render_state_count)
+            device->GetRenderState(static_cast<D3DRENDERSTATETYPE>(key), &s.value);
+        else
+            device->GetTextureStageState((key - render_state_count) / stage_state_count,
+                static_cast<D3DTEXTURESTAGESTATETYPE>((key - render_state_count) % stage_state_count), &s.value);
+        s.known = true;
+    }
+    return s.value;
+}
+
+void render_state_cache::set(UINT key, DWORD value)
 {
-    HMODULE eqfx = GetModuleHandleA("eqgfx_dx8.dll");
-    if (eqfx)
-        device = *(IDirect3DDevice8**)((DWORD)eqfx + 0xa4f92c);
+    slot& s = slots[key];
+    if (get(key) == value)
+        return;
+    if (!s.changed)
+    {
+        s.original = s.value;
+        s.changed = true;
+        changed.push_back(key);
+    }
+    write(key, value);
+    s.value = value;
+}
+
+void render_state_cache::write(UINT key, DWORD value)
+{
+    if (key < render_state_count)
+        device->SetRenderState(static_cast<D3DRENDERSTATETYPE>(key), value);
     else
-        device = nullptr;
+        device->SetTextureStageState((key - render_state_count) / stage_state_count,
+            static_cast<D3DTEXTURESTAGESTATETYPE>((key - render_state_count) % stage_state_count), value);
+}
+
+DWORD render_state_cache::get_render_state(D3DRENDERSTATETYPE state)
+{
+    DWORD value = 0;
+    if (state >= render_state_count)
+        device->GetRenderState(state, &value);
+    else
+        value = get(state);
+    return value;
+}
+
+void render_state_cache::set_render_state(D3DRENDERSTATETYPE state, DWORD value)
+{
+    if (state < render_state_count)
+        set(state, value);
+    else
+        device->SetRenderState(state, value); //not shadowed, and nothing restores it
+}
+
+DWORD render_state_cache::get_texture_stage_state(DWORD stage, D3DTEXTURESTAGESTATETYPE type)
+{
+    DWORD value = 0;
+    if (stage >= stage_count || type >= stage_state_count)
+        device->GetTextureStageState(stage, type, &value);
+    else
+        value = get(render_state_count + stage * stage_state_count + type);
+    return value;
+}
+
+void render_state_cache::set_texture_stage_state(DWORD stage, D3DTEXTURESTAGESTATETYPE type, DWORD value)
+{
+    if (stage >= stage_count || type >= stage_state_count)
+        device->SetTextureStageState(stage, type, value);
+    else
+        set(render_state_count + stage * stage_state_count + type, value);
+}
+
+void render_state_cache::set_texture(IDirect3DBaseTexture8* texture)
+{
+    if (!texture_changed)
+    {
+        device->GetTexture(0, &original_texture);
+        if (original_texture)
+            original_texture->Release(); //the game keeps its own reference
+        current_texture = original_texture;
+        texture_changed = true;
+    }
+    if (texture == current_texture)
+        return;
+    device->SetTexture(0, texture);
+    current_texture = texture;
+}
+
+void render_state_cache::set_vertex_shader(DWORD handle)
+{
+    if (!shader_changed)
+    {
+        device->GetVertexShader(&original_shader);
+        current_shader = original_shader;
+        shader_changed = true;
+    }
+    if (handle == current_shader)
+        return;
+    device->SetVertexShader(handle);
+    current_shader = handle;
+}
+
+void render_state_cache::set_stream_source(IDirect3DVertexBuffer8* buffer, UINT stride)
+{
+    if (!stream_changed)
+    {
+        device->GetStreamSource(0, &original_buffer, &original_stride);
+        if (original_buffer)
+            original_buffer->Release();
+        current_buffer = original_buffer;
+        current_stride = original_stride;
+        stream_changed = true;
+    }
+    if (buffer == current_buffer && stride == current_stride)
+        return;
+    device->SetStreamSource(0, buffer, stride);
+    current_buffer = buffer;
+    current_stride = stride;
+}
+
+void render_state_cache::set_world(const D3DMATRIX& world)
+{
+    if (!world_changed)
+    {
+        device->GetTransform(D3DTS_WORLD, &original_world);
+        current_world = original_world;
+        world_changed = true;
+    }
+    if (!memcmp(&world, &current_world, sizeof(D3DMATRIX)))
+        return;
+    device->SetTransform(D3DTS_WORLD, &world);
+    current_world = world;
+}
+
+void render_state_cache::restore()
+{
+    if (!device)
+        return;
+    for (UINT key : changed)
+    {
+        slot& s = slots[key];
+        s.changed = false;
+        if (s.value == s.original)
+            continue;
+        write(key, s.original);
+        s.value = s.original;
+    }
+    changed.clear();
+    if (texture_changed && current_texture != original_texture)
+        device->SetTexture(0, original_texture);
+    if (shader_changed && current_shader != original_shader)
+        device->SetVertexShader(original_shader);
+    if (stream_changed && (current_buffer != original_buffer || current_stride != original_stride))
+        device->SetStreamSource(0, original_buffer, original_stride);
+    if (world_changed && memcmp(&current_world, &original_world, sizeof(D3DMATRIX)))
+        device->SetTransform(D3DTS_WORLD, &original_world);
+    texture_changed = shader_changed = stream_changed = world_changed = false;
+}
+
+void directx::update_device()
+{
+    if (device)
+        return;
+    if (!eqgfx)
+        eqgfx = GetModuleHandleA("eqgfx_dx8.dll");
+    if (!eqgfx)
+        return;
+    device = *(IDirect3DDevice8**)((DWORD)eqgfx + 0xa4f92c);
 
     if (device)
     {
@@ -38,23 +225,62 @@ void directx::update_device()
         {
             DWORD endscene_addr = (DWORD)vtable[35];
             DWORD reset_addr = (DWORD)vtable[14];
-            if (!ZealService::get_instance()->hooks->hook_map.count("EndScene"))
-                ZealService::get_instance()->hooks->Add("EndScene", endscene_addr, Local_EndScene, hook_type_detour);
-            if (!ZealService::get_instance()->hooks->hook_map.count("Reset"))
-                ZealService::get_instance()->hooks->Add("Reset", reset_addr, Local_Reset, hook_type_detour);
+            if (!hook_ref<Local_EndScene>::ptr)
+                ZealService::get_instance()->hooks->Add<Local_EndScene>("EndScene", endscene_addr, hook_type_detour);
+            if (!hook_ref<Local_Reset>::ptr)
+                ZealService::get_instance()->hooks->Add<Local_Reset>("Reset", reset_addr, hook_type_detour);
         }
      //   ZealService::get_instance()->hooks->Add("Reset", reset_addr, Local_Reset, hook_type_detour);
     }
 }
 
-Vec2 directx::GetScreenRect()
+IDirect3DDevice8* directx::get_device()
 {
     update_device();
+    return device;
+}
+
+void directx::device_lost()
+{
+    primitives.release(); //default pool buffer, has to go before the reset
+    glyphs.release();
+    states.invalidate(); //reset puts every state back to its default
+    device = nullptr;
+    state.valid = false;
+    frame++;
+}
+
+void directx::begin_frame()
+{
+    update_device();
+    state.valid = false;
+    state.frame = frame;
     if (!device)
+        return;
+    D3DXMATRIX world_view;
+    device->GetTransform(D3DTS_WORLD, &state.world);
+    device->GetTransform(D3DTS_VIEW, &state.view);
+    device->GetTransform(D3DTS_PROJECTION, &state.projection);
+    device->GetViewport(&state.viewport);
+    D3DXMatrixMultiply(&world_view, &state.world, &state.view);
+    D3DXMatrixMultiply(&state.world_view_proj, &world_view, &state.projection);
+    state.screen_size = { (float)state.viewport.Width, (float)state.viewport.Height };
+    state.valid = true;
+}
+
+const frame_state& directx::get_frame_state()
+{
+    if (state.frame != frame || !state.valid)
+        begin_frame();
+    return state;
+}
+
+Vec2 directx::GetScreenRect()
+{
+    const frame_state& fs = get_frame_state();
+    if (!fs.valid)
         return { 0,0 };
-    D3DVIEWPORT8 viewport;
-    device->GetViewport(&viewport);
-    return { (float)viewport.Width, (float)viewport.Height };
+    return fs.screen_size;
 }
 
 
@@ -63,22 +289,55 @@ bool IsOffScreen(Vec2 screenPos, const D3DVIEWPORT8& viewport) {
         screenPos.y < viewport.Y || screenPos.y > viewport.Y + viewport.Height;
 }
 
+size_t directx::WorldToScreen(const Vec3* world, size_t count, Vec2* screen, BYTE* on_screen)
+{
+    const frame_state& fs = get_frame_state();
+    if (!fs.valid)
+    {
+        if (on_screen)
+            memset(on_screen, 0, count);
+        return 0;
+    }
+    const D3DXMATRIX& m = fs.world_view_proj;
+    const __m128 row0 = _mm_loadu_ps(&m._11);
+    const __m128 row1 = _mm_loadu_ps(&m._21);
+    const __m128 row2 = _mm_loadu_ps(&m._31);
+    const __m128 row3 = _mm_loadu_ps(&m._41);
+    const float half_width = fs.viewport.Width * 0.5f;
+    const float half_height = fs.viewport.Height * 0.5f;
+    const float cull_margin = 1.1f; //keep text anchored just past the edge
+    size_t visible = 0;
+    alignas(16) float clip[4];
+    for (size_t i = 0; i < count; i++)
+    {
+        __m128 v = _mm_add_ps(
+            _mm_add_ps(_mm_mul_ps(_mm_set1_ps(world[i].x), row0), _mm_mul_ps(_mm_set1_ps(world[i].y), row1)),
+            _mm_add_ps(_mm_mul_ps(_mm_set1_ps(world[i].z), row2), row3));
+        _mm_store_ps(clip, v);
+        float w = clip[3];
+        bool inside = w > 0.f && fabsf(clip[0]) <= w * cull_margin && fabsf(clip[1]) <= w * cull_margin;
+        if (inside)
+        {
+            float inv_w = 1.f / w;
+            //same axis order as the single point version
+            screen[i].y = fs.viewport.X + (1.f + clip[0] * inv_w) * half_width;
+            screen[i].x = fs.viewport.Y + (1.f - clip[1] * inv_w) * half_height;
+            visible++;
+        }
+        if (on_screen)
+            on_screen[i] = inside;
+    }
+    return visible;
+}
+
 bool directx::WorldToScreen(Vec3 worldPos, Vec2& screenPos) 
 {
-    update_device();
-    if (!device)
+    const frame_state& fs = get_frame_state();
+    if (!fs.valid)
         return false;
-    // Transform the world coordinates by the combined matrix
-    D3DXMATRIX matWorld, matView, matProj;
-    D3DVIEWPORT8 viewport;
-
-    device->GetTransform(D3DTS_WORLD, &matWorld);
-    device->GetTransform(D3DTS_VIEW, &matView);
-    device->GetTransform(D3DTS_PROJECTION, &matProj);
-    device->GetViewport(&viewport);
     D3DXVECTOR3 screen;
     D3DXVECTOR3 d3dPOS = { worldPos.x,worldPos.y, worldPos.z };
-    D3DXVec3Project(&screen, &d3dPOS, &viewport, &matProj, &matView, &matWorld);
+    D3DXVec3Project(&screen, &d3dPOS, &fs.viewport, &fs.projection, &fs.view, &fs.world);
     screenPos.x = screen.y;
     screenPos.y = screen.x;
     return true;
@@ -100,7 +359,7 @@ directx::directx()
 {
   /*  FARPROC partial_scene = GetProcAddress(GetModuleHandleA("eqgfx_dx8.dll"), "t3dRenderPartialScene");
     if (partial_scene)
-        ZealService::get_instance()->hooks->Add("RenderPartialScene", (int)partial_scene, RenderPartialScene, hook_type_detour);*/
+        ZealService::get_instance()->hooks->Add<RenderPartialScene>("RenderPartialScene", (int)partial_scene, hook_type_detour);*/
     update_device();
 
 }
\ No newline at end of file
@@ -1,16 +1,96 @@
 #pragma once
+#include <vector>
 #include "vectors.h"
 #include "d3dx8/d3d8.h"
 #include "d3dx8/d3d8types.h"
 #include "d3dx8/d3dx8math.h"
+#include "primitive_batch.h"
+#include "glyph_cache.h"
+// device state captured by begin_frame on the first query of a frame and reused until the next EndScene
+struct frame_state
+{
+	D3DXMATRIX world;
+	D3DXMATRIX view;
+	D3DXMATRIX projection;
+	D3DXMATRIX world_view_proj;
+	D3DVIEWPORT8 viewport;
+	Vec2 screen_size;
+	UINT frame;
+	bool valid;
+};
+// shadow copy of the states zeal's overlays touch: a set equal to the current value never reaches the driver, gets after
+// the first come from the shadow, and restore() puts back only what actually changed. the game draws with the raw device
+// between zeal's callbacks, so the shadow is dropped at the start of every overlay pass and on a reset
+class render_state_cache
+{
+public:
+	void begin(IDirect3DDevice8* device); //start of an overlay draw, drops the shadow
+	DWORD get_render_state(D3DRENDERSTATETYPE state);
+	void set_render_state(D3DRENDERSTATETYPE state, DWORD value);
+	DWORD get_texture_stage_state(DWORD stage, D3DTEXTURESTAGESTATETYPE type);
+	void set_texture_stage_state(DWORD stage, D3DTEXTURESTAGESTATETYPE type, DWORD value);
+	void set_texture(IDirect3DBaseTexture8* texture); //stage 0
+	void set_vertex_shader(DWORD handle);
+	void set_stream_source(IDirect3DVertexBuffer8* buffer, UINT stride); //stream 0
+	void set_world(const D3DMATRIX& world);
+	void restore(); //back to the game's values
+	void invalidate();
+private:
+	static constexpr UINT render_state_count = 256;
+	static constexpr UINT stage_count = 8;
+	static constexpr UINT stage_state_count = 32;
+	struct slot
+	{
+		DWORD value;
+		DWORD original;
+		bool known;
+		bool changed;
+	};
+	// keys are render states first, then render_state_count + stage * stage_state_count + type
+	DWORD get(UINT key);
+	void set(UINT key, DWORD value);
+	void write(UINT key, DWORD value);
+	IDirect3DDevice8* device = nullptr;
+	slot slots[render_state_count + stage_count * stage_state_count] = {};
+	std::vector<UINT> changed; //keys to restore
+	// bindings are read once per overlay draw when first set, pointers are the game's and not held
+	IDirect3DBaseTexture8* original_texture = nullptr;
+	IDirect3DBaseTexture8* current_texture = nullptr;
+	DWORD original_shader = 0;
+	DWORD current_shader = 0;
+	IDirect3DVertexBuffer8* original_buffer = nullptr;
+	IDirect3DVertexBuffer8* current_buffer = nullptr;
+	UINT original_stride = 0;
+	UINT current_stride = 0;
+	D3DMATRIX original_world = {};
+	D3DMATRIX current_world = {};
+	bool texture_changed = false;
+	bool shader_changed = false;
+	bool stream_changed = false;
+	bool world_changed = false;
+};
+
 class directx
 {
 public:
 	bool WorldToScreen(Vec3 worldPos, Vec2& screenPos);
+	// projects count points in one pass, on_screen is set to 0 for points behind the camera or outside the view, returns how many are on screen
+	size_t WorldToScreen(const Vec3* world, size_t count, Vec2* screen, BYTE* on_screen);
 	Vec2 GetScreenRect();
-	IDirect3DDevice8* device;
+	void begin_frame();
+	void end_frame() { frame++; states.invalidate(); }
+	const frame_state& get_frame_state();
+	IDirect3DDevice8* get_device(); //resolved once, again after a Reset
+	void device_lost();
+	IDirect3DDevice8* device = nullptr;
+	PrimitiveBatch primitives; //flushed once after the RenderUI callbacks
+	render_state_cache states;
+	GlyphCache glyphs; //text atlases shared by the overlays
 	directx();
 private:
 	void update_device();
+	frame_state state = {};
+	UINT frame = 0;
+	HMODULE eqgfx = nullptr;
 };
 
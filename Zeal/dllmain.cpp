@@ -8,15 +8,9 @@ static std::thread MainLoop{};
 void init()
 {
     ZealService zeal;
-    while (!exitFlag.load(std::memory_order_acquire))
+    WaitForSingleObject(Shutdown::event(), INFINITE); //shift+pause or process detach
+    if (!Shutdown::process_exiting())
     {
-        if (GetAsyncKeyState(VK_PAUSE) & 0x8000 && GetAsyncKeyState(VK_SHIFT) & 0x8000)
-            break;
-        Sleep(5);
-    }
-    if (!exitFlag.load(std::memory_order_acquire))
-    {
-        exitFlag.store(true, std::memory_order_release);
         zeal.~ZealService();
         Sleep(1000);
         while (!FreeLibrary(this_module))
@@ -38,6 +32,8 @@ BOOL APIENTRY DllMain( HMODULE hModule,
     {
     case DLL_PROCESS_ATTACH:
     {
+        if (strstr(GetCommandLineA(), "ZealCrashWatchdog")) //loaded by rundll32 as the crash watchdog, leave the host alone
+            break;
         if (!this_module)
         {
             this_module = hModule;
@@ -48,7 +44,7 @@ BOOL APIENTRY DllMain( HMODULE hModule,
 		break;
 	}
     case DLL_PROCESS_DETACH:
-        exitFlag.store(true, std::memory_order_release);
+        Shutdown::request(true);
         if (MainLoop.joinable())
             MainLoop.join();
         break;
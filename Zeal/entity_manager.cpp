@@ -0,0 +1,594 @@
+#include "entity_manager.h"
+#include "EqAddresses.h"
+#include "EqFunctions.h"
+#include "EqPackets.h"
+#include "Zeal.h"
+#include <algorithm>
+#include <cmath>
+
+//entities are bucketed into square cells of this size for radius queries
+static constexpr float grid_cell_size = 50.f;
+
+//line of sight is raycast again once either end leaves its cell or the result gets old
+static constexpr float los_tolerance = 2.f;
+static constexpr ULONGLONG los_max_age = 1000;
+static constexpr size_t los_cache_limit = 1024;
+
+static void quantize(const Vec3& pos, short* cell)
+{
+	cell[0] = static_cast<short>(floorf(pos.x / los_tolerance));
+	cell[1] = static_cast<short>(floorf(pos.y / los_tolerance));
+	cell[2] = static_cast<short>(floorf(pos.z / los_tolerance));
+}
+
+static size_t hash_spawn_id(WORD spawn_id, size_t mask)
+{
+	return (spawn_id * 2654435761u) & mask;
+}
+
+bool EntityManager::is_linked(Zeal::EqStructures::Entity* ent) const
+{
+	if (ent->Prev)
+		return ent->Prev->Next == ent;
+	return Zeal::EqGame::get_entity_list() == ent;
+}
+
+void EntityManager::insert(WORD spawn_id, Zeal::EqStructures::Entity* ent)
+{
+	if ((count + 1) * 2 > table.size()) //keep the load under half so probes stay short
+	{
+		std::vector<slot> old = std::move(table);
+		table = std::vector<slot>(old.size() * 2);
+		count = 0;
+		for (auto& s : old)
+			if (s.spawn_id)
+				insert(s.spawn_id, s.ent);
+	}
+	size_t mask = table.size() - 1;
+	for (size_t i = hash_spawn_id(spawn_id, mask);; i = (i + 1) & mask)
+	{
+		if (!table[i].spawn_id)
+		{
+			table[i] = { spawn_id, ent };
+			count++;
+			return;
+		}
+		if (table[i].spawn_id == spawn_id)
+		{
+			table[i].ent = ent;
+			return;
+		}
+	}
+}
+
+Zeal::EqStructures::Entity* EntityManager::find(WORD spawn_id) const
+{
+	size_t mask = table.size() - 1;
+	for (size_t i = hash_spawn_id(spawn_id, mask); table[i].spawn_id; i = (i + 1) & mask)
+	{
+		if (table[i].spawn_id == spawn_id)
+			return table[i].ent;
+	}
+	return nullptr;
+}
+
+Zeal::EqStructures::Entity* EntityManager::walk(WORD spawn_id) const
+{
+	for (Zeal::EqStructures::Entity* ent = Zeal::EqGame::get_entity_list(); ent; ent = ent->Next)
+	{
+		if (ent->SpawnId == spawn_id)
+			return ent;
+	}
+	return nullptr;
+}
+
+void EntityManager::rebuild()
+{
+	std::fill(table.begin(), table.end(), slot{ 0, nullptr });
+	count = 0;
+	pets.clear();
+	for (Zeal::EqStructures::Entity* ent = Zeal::EqGame::get_entity_list(); ent; ent = ent->Next)
+	{
+		if (!ent->SpawnId)
+			continue;
+		insert(ent->SpawnId, ent);
+		if (ent->PetOwnerSpawnId)
+			pets.push_back({ ent->PetOwnerSpawnId, ent });
+	}
+	std::sort(pets.begin(), pets.end(), [](const auto& a, const auto& b) { return a.first < b.first; });
+	dirty = false;
+}
+
+Zeal::EqStructures::Entity* EntityManager::get(WORD spawn_id)
+{
+	ZEAL_ASSERT_GAME_THREAD();
+	if (!spawn_id || !Zeal::EqGame::get_entity_list())
+		return nullptr;
+	if (dirty)
+		rebuild();
+	Zeal::EqStructures::Entity* ent = find(spawn_id);
+	if (ent && ent->SpawnId == spawn_id && is_linked(ent))
+		return ent;
+	if (ent) //stale entry, something spawned or despawned without us seeing it
+		dirty = true;
+	ent = walk(spawn_id);
+	if (ent && !dirty)
+		insert(spawn_id, ent);
+	return ent;
+}
+
+EntityHandle EntityManager::handle(Zeal::EqStructures::Entity* ent)
+{
+	if (!ent || !ent->SpawnId)
+		return {};
+	binding& b = bindings[ent->SpawnId];
+	if (b.ent != ent)
+		b = { ent, next_generation++ };
+	return { ent->SpawnId, b.generation };
+}
+
+// the id still has to be in the list and bound to the same entity the handle was made from, a different entity under
+// the id is bound afresh so the handles made from it from now on resolve
+Zeal::EqStructures::Entity* EntityManager::resolve(const EntityHandle& handle)
+{
+	if (!handle)
+		return nullptr;
+	Zeal::EqStructures::Entity* ent = get(handle.spawn_id);
+	auto it = bindings.find(handle.spawn_id);
+	if (!ent || it == bindings.end())
+		return nullptr;
+	if (it->second.ent != ent)
+	{
+		it->second = { ent, next_generation++ };
+		return nullptr;
+	}
+	return it->second.generation == handle.generation ? ent : nullptr;
+}
+
+Zeal::EqStructures::Entity* EntityManager::get_pet(WORD owner_id)
+{
+	if (!owner_id || !Zeal::EqGame::get_entity_list())
+		return nullptr;
+	if (dirty)
+		rebuild();
+	auto it = std::lower_bound(pets.begin(), pets.end(), owner_id, [](const auto& p, WORD id) { return p.first < id; });
+	if (it != pets.end() && it->first == owner_id)
+	{
+		if (it->second->PetOwnerSpawnId == owner_id && is_linked(it->second))
+			return it->second;
+		dirty = true;
+	}
+	for (Zeal::EqStructures::Entity* ent = Zeal::EqGame::get_entity_list(); ent; ent = ent->Next)
+	{
+		if (ent->PetOwnerSpawnId == owner_id)
+			return ent;
+	}
+	return nullptr;
+}
+
+void EntityManager::get_pets(WORD owner_id, std::vector<Zeal::EqStructures::Entity*>& out)
+{
+	out.clear();
+	if (!owner_id || !Zeal::EqGame::get_entity_list())
+		return;
+	if (dirty)
+		rebuild();
+	auto range = std::equal_range(pets.begin(), pets.end(), std::pair<WORD, Zeal::EqStructures::Entity*>{ owner_id, nullptr },
+		[](const auto& a, const auto& b) { return a.first < b.first; });
+	for (auto it = range.first; it != range.second; ++it)
+	{
+		if (it->second->PetOwnerSpawnId != owner_id || !is_linked(it->second))
+		{
+			//the multimap is stale, take the answer straight from the list
+			dirty = true;
+			out.clear();
+			for (Zeal::EqStructures::Entity* ent = Zeal::EqGame::get_entity_list(); ent; ent = ent->Next)
+				if (ent->PetOwnerSpawnId == owner_id)
+					out.push_back(ent);
+			return;
+		}
+		out.push_back(it->second);
+	}
+}
+
+void EntityManager::refresh_visible(float max_dist)
+{
+	Zeal::EqStructures::Entity* self = Zeal::EqGame::get_self();
+	Zeal::EqGame::query_world_visible_actors(max_dist, visible_query);
+	visible.clear();
+	visible_ids.reset();
+	for (auto& ent : visible_query)
+	{
+		visible.push_back({ ent, static_cast<float>(ent->Position.Dist2D(self->Position)), -1 });
+		visible_ids.set(ent->SpawnId);
+	}
+	visible_dist = max_dist;
+	visible_frame = frame;
+}
+
+int EntityManager::lookup_los(Zeal::EqStructures::Entity* self, Zeal::EqStructures::Entity* target, ULONGLONG now)
+{
+	auto it = los_cache.find(target->SpawnId);
+	if (it == los_cache.end())
+		return -1;
+	short self_cell[3];
+	short target_cell[3];
+	quantize(self->Position, self_cell);
+	quantize(target->Position, target_cell);
+	los_entry& e = it->second;
+	if (e.ent == target && now - e.tick < los_max_age
+		&& !memcmp(e.self_cell, self_cell, sizeof(self_cell)) && !memcmp(e.target_cell, target_cell, sizeof(target_cell)))
+		return e.los ? 1 : 0;
+	return -1;
+}
+
+void EntityManager::store_los(Zeal::EqStructures::Entity* self, Zeal::EqStructures::Entity* target, ULONGLONG now, bool los)
+{
+	if (los_cache.size() >= los_cache_limit)
+		std::erase_if(los_cache, [now](const auto& p) { return now - p.second.tick >= los_max_age; });
+	los_entry& e = los_cache[target->SpawnId];
+	e.ent = target;
+	quantize(self->Position, e.self_cell);
+	quantize(target->Position, e.target_cell);
+	e.tick = now;
+	e.los = los;
+}
+
+bool EntityManager::has_los(visible_actor& actor)
+{
+	if (actor.los < 0)
+	{
+		Zeal::EqStructures::Entity* self = Zeal::EqGame::get_self();
+		ULONGLONG now = GetTickCount64();
+		actor.los = lookup_los(self, actor.ent, now);
+		if (actor.los < 0)
+		{
+			actor.los = Zeal::EqGame::has_line_of_sight(self, actor.ent) ? 1 : 0;
+			store_los(self, actor.ent, now, actor.los == 1);
+		}
+	}
+	return actor.los == 1;
+}
+
+// everything in range the cache can't answer is raycast as one batch, so the rays run in direction order
+void EntityManager::resolve_los(float max_dist)
+{
+	Zeal::EqStructures::Entity* self = Zeal::EqGame::get_self();
+	ULONGLONG now = GetTickCount64();
+	los_pending.clear();
+	los_targets.clear();
+	for (UINT i = 0; i < visible.size(); ++i)
+	{
+		visible_actor& actor = visible[i];
+		if (actor.los >= 0 || actor.dist > max_dist)
+			continue;
+		actor.los = lookup_los(self, actor.ent, now);
+		if (actor.los < 0)
+		{
+			los_pending.push_back(i);
+			los_targets.push_back(actor.ent);
+		}
+	}
+	if (los_targets.empty())
+		return;
+	Zeal::EqGame::has_line_of_sight(self, los_targets, los_results);
+	for (size_t i = 0; i < los_pending.size(); ++i)
+	{
+		visible_actor& actor = visible[los_pending[i]];
+		actor.los = los_results[i];
+		store_los(self, actor.ent, now, actor.los == 1);
+	}
+}
+
+void EntityManager::ensure_visible(float max_dist)
+{
+	if (!Zeal::EqGame::get_self())
+	{
+		visible.clear();
+		visible_ids.reset();
+		return;
+	}
+	//a smaller radius later in the frame is served from the wider query
+	if (visible_frame != frame || visible_dist < 0 || max_dist > visible_dist)
+		refresh_visible(max_dist);
+}
+
+void EntityManager::get_visible_actors(float max_dist, bool only_targetable, std::vector<Zeal::EqStructures::Entity*>& out)
+{
+	out.clear();
+	if (!Zeal::EqGame::get_self())
+		return;
+	ensure_visible(max_dist);
+	if (only_targetable)
+		resolve_los(max_dist);
+	for (auto& actor : visible)
+	{
+		if (actor.dist > max_dist)
+			continue;
+		if (only_targetable && !has_los(actor))
+			continue;
+		out.push_back(actor.ent);
+	}
+}
+
+static UINT64 grid_key(int cx, int cy)
+{
+	return (static_cast<UINT64>(static_cast<UINT32>(cx)) << 32) | static_cast<UINT32>(cy);
+}
+
+static int grid_coord(float v)
+{
+	return static_cast<int>(floorf(v / grid_cell_size));
+}
+
+void EntityManager::rebuild_grid()
+{
+	grid_entries.clear();
+	grid_cells.clear();
+	for (Zeal::EqStructures::Entity* ent = Zeal::EqGame::get_entity_list(); ent; ent = ent->Next)
+		grid_entries.push_back({ grid_key(grid_coord(ent->Position.x), grid_coord(ent->Position.y)), ent });
+	std::sort(grid_entries.begin(), grid_entries.end(), [](const grid_entry& a, const grid_entry& b) { return a.key < b.key; });
+	for (size_t i = 0; i < grid_entries.size();)
+	{
+		size_t end = i + 1;
+		while (end < grid_entries.size() && grid_entries[end].key == grid_entries[i].key)
+			end++;
+		grid_cells.push_back({ grid_entries[i].key, static_cast<UINT>(i), static_cast<UINT>(end) });
+		i = end;
+	}
+	grid_frame = frame;
+	grid_built = true;
+}
+
+void EntityManager::query_radius(const Vec3& center, float radius, std::vector<Zeal::EqStructures::Entity*>& out)
+{
+	ZEAL_ASSERT_GAME_THREAD();
+	out.clear();
+	if (!Zeal::EqGame::get_entity_list())
+		return;
+	if (!grid_built || grid_frame != frame)
+		rebuild_grid();
+	float radius_sq = radius * radius;
+	int min_x = grid_coord(center.x - radius), max_x = grid_coord(center.x + radius);
+	int min_y = grid_coord(center.y - radius), max_y = grid_coord(center.y + radius);
+	if (static_cast<size_t>(max_x - min_x + 1) * static_cast<size_t>(max_y - min_y + 1) > grid_cells.size())
+	{
+		//the box covers more cells than are occupied, scanning the occupied ones is cheaper
+		for (auto& e : grid_entries)
+		{
+			float dx = e.ent->Position.x - center.x, dy = e.ent->Position.y - center.y;
+			if (dx * dx + dy * dy <= radius_sq)
+				out.push_back(e.ent);
+		}
+		return;
+	}
+	for (int cx = min_x; cx <= max_x; cx++)
+	{
+		for (int cy = min_y; cy <= max_y; cy++)
+		{
+			UINT64 key = grid_key(cx, cy);
+			auto cell = std::lower_bound(grid_cells.begin(), grid_cells.end(), key, [](const grid_cell& c, UINT64 k) { return c.key < k; });
+			if (cell == grid_cells.end() || cell->key != key)
+				continue;
+			for (UINT i = cell->begin; i < cell->end; i++)
+			{
+				Zeal::EqStructures::Entity* ent = grid_entries[i].ent;
+				float dx = ent->Position.x - center.x, dy = ent->Position.y - center.y;
+				if (dx * dx + dy * dy <= radius_sq)
+					out.push_back(ent);
+			}
+		}
+	}
+}
+
+void EntityManager::query_nearest(const Vec3& center, size_t k, float max_radius, std::vector<Zeal::EqStructures::Entity*>& out)
+{
+	ZEAL_ASSERT_GAME_THREAD();
+	out.clear();
+	if (!k)
+		return;
+	//grow the search radius until it holds k entities, everything inside it is then a candidate
+	float radius = grid_cell_size < max_radius ? grid_cell_size : max_radius;
+	while (true)
+	{
+		query_radius(center, radius, out);
+		if (out.size() >= k || radius >= max_radius)
+			break;
+		radius = radius * 2 < max_radius ? radius * 2 : max_radius;
+	}
+	auto dist_sq = [&center](Zeal::EqStructures::Entity* ent) {
+		float dx = ent->Position.x - center.x, dy = ent->Position.y - center.y;
+		return dx * dx + dy * dy;
+	};
+	size_t n = out.size() < k ? out.size() : k;
+	std::partial_sort(out.begin(), out.begin() + n, out.end(), [&dist_sq](Zeal::EqStructures::Entity* a, Zeal::EqStructures::Entity* b) { return dist_sq(a) < dist_sq(b); });
+	out.resize(n);
+}
+
+void EntityManager::entity_snapshot::clear()
+{
+	spawn_id.clear();
+	ent.clear();
+	hp.clear();
+	position.clear();
+	reported.clear();
+	heading.clear();
+	level.clear();
+	type.clear();
+	owner.clear();
+}
+
+void EntityManager::entity_snapshot::reserve(size_t n)
+{
+	spawn_id.reserve(n);
+	ent.reserve(n);
+	hp.reserve(n);
+	position.reserve(n);
+	reported.reserve(n);
+	heading.reserve(n);
+	level.reserve(n);
+	type.reserve(n);
+	owner.reserve(n);
+}
+
+void EntityManager::reserve(size_t spawns)
+{
+	snapshots[0].reserve(spawns);
+	snapshots[1].reserve(spawns);
+	snapshot_order.reserve(spawns);
+	grid_entries.reserve(spawns);
+	grid_cells.reserve(spawns);
+	visible.reserve(spawns);
+}
+
+void EntityManager::entity_snapshot::push(Zeal::EqStructures::Entity* e, const Vec3& reported_pos)
+{
+	spawn_id.push_back(e->SpawnId);
+	ent.push_back(e);
+	hp.push_back(e->HpCurrent);
+	position.push_back(e->Position);
+	reported.push_back(reported_pos);
+	heading.push_back(e->Heading);
+	level.push_back(e->Level);
+	type.push_back(e->Type);
+	owner.push_back(e->PetOwnerSpawnId);
+}
+
+UINT EntityManager::subscribe(std::function<void(const entity_event&)> callback, UINT32 type_mask)
+{
+	UINT id = next_subscriber_id++;
+	subscribers.push_back({ id, type_mask, std::move(callback) });
+	subscribed_mask |= type_mask;
+	return id;
+}
+
+void EntityManager::set_subscription_mask(UINT id, UINT32 type_mask)
+{
+	subscribed_mask = 0;
+	for (auto& s : subscribers)
+	{
+		if (s.id == id)
+			s.mask = type_mask;
+		subscribed_mask |= s.mask;
+	}
+}
+
+void EntityManager::publish(entity_event_type type, WORD spawn_id, Zeal::EqStructures::Entity* ent, int old_value, int new_value)
+{
+	if (type == entity_event_type::despawned)
+		bindings.erase(spawn_id); //catches a new spawn under the id at the same address while the diff runs
+	UINT32 bit = 1u << static_cast<int>(type);
+	if (!(subscribed_mask & bit))
+		return;
+	entity_event e = { type, spawn_id, ent, old_value, new_value };
+	for (auto& s : subscribers)
+	{
+		if (s.mask & bit)
+			s.callback(e);
+	}
+}
+
+void EntityManager::diff_entities()
+{
+	ZEAL_ASSERT_GAME_THREAD();
+	entity_snapshot& prev = snapshots[current_snapshot];
+	entity_snapshot& cur = snapshots[current_snapshot ^ 1];
+	cur.clear();
+	if (!subscribed_mask || !Zeal::EqGame::is_in_game())
+	{
+		prev.clear(); //start from scratch once someone listens again
+		last_target_id = 0;
+		return;
+	}
+	snapshot_order.clear();
+	for (Zeal::EqStructures::Entity* ent = Zeal::EqGame::get_entity_list(); ent; ent = ent->Next)
+	{
+		if (ent->SpawnId)
+			snapshot_order.push_back(ent);
+	}
+	std::sort(snapshot_order.begin(), snapshot_order.end(), [](Zeal::EqStructures::Entity* a, Zeal::EqStructures::Entity* b) { return a->SpawnId < b->SpawnId; });
+
+	float threshold_sq = move_threshold * move_threshold;
+	size_t i = 0;
+	for (Zeal::EqStructures::Entity* ent : snapshot_order)
+	{
+		while (i < prev.spawn_id.size() && prev.spawn_id[i] < ent->SpawnId)
+		{
+			publish(entity_event_type::despawned, prev.spawn_id[i], nullptr, 0, 0);
+			i++;
+		}
+		if (i < prev.spawn_id.size() && prev.spawn_id[i] == ent->SpawnId && prev.ent[i] == ent)
+		{
+			Vec3 reported = prev.reported[i];
+			if (prev.hp[i] != ent->HpCurrent)
+				publish(entity_event_type::hp_changed, ent->SpawnId, ent, static_cast<int>(prev.hp[i]), static_cast<int>(ent->HpCurrent));
+			if (prev.level[i] != ent->Level)
+				publish(entity_event_type::level_changed, ent->SpawnId, ent, prev.level[i], ent->Level);
+			if (prev.type[i] != ent->Type)
+				publish(entity_event_type::type_changed, ent->SpawnId, ent, prev.type[i], ent->Type);
+			if (prev.owner[i] != ent->PetOwnerSpawnId)
+				publish(entity_event_type::owner_changed, ent->SpawnId, ent, prev.owner[i], ent->PetOwnerSpawnId);
+			float dx = ent->Position.x - reported.x, dy = ent->Position.y - reported.y, dz = ent->Position.z - reported.z;
+			if (dx * dx + dy * dy + dz * dz > threshold_sq)
+			{
+				publish(entity_event_type::moved, ent->SpawnId, ent, 0, 0);
+				reported = ent->Position;
+			}
+			cur.push(ent, reported);
+			i++;
+		}
+		else
+		{
+			if (i < prev.spawn_id.size() && prev.spawn_id[i] == ent->SpawnId) //same id on a new entity, the old one is gone
+			{
+				publish(entity_event_type::despawned, prev.spawn_id[i], nullptr, 0, 0);
+				i++;
+			}
+			publish(entity_event_type::spawned, ent->SpawnId, ent, 0, 0);
+			cur.push(ent, ent->Position);
+		}
+	}
+	for (; i < prev.spawn_id.size(); i++)
+		publish(entity_event_type::despawned, prev.spawn_id[i], nullptr, 0, 0);
+	current_snapshot ^= 1;
+
+	Zeal::EqStructures::Entity* target = Zeal::EqGame::get_target();
+	WORD target_id = target ? target->SpawnId : 0;
+	if (target_id != last_target_id)
+	{
+		publish(entity_event_type::target_changed, target_id, target, last_target_id, target_id);
+		last_target_id = target_id;
+	}
+}
+
+EntityManager::EntityManager(ZealService* zeal)
+{
+	zeal->memory_report->add("entities", [this]() {
+		Zeal::Memory::usage use{ Zeal::Memory::vector_bytes(table) + Zeal::Memory::vector_bytes(pets) + Zeal::Memory::vector_bytes(visible) + Zeal::Memory::vector_bytes(visible_query)
+			+ Zeal::Memory::vector_bytes(grid_entries) + Zeal::Memory::vector_bytes(grid_cells) + Zeal::Memory::vector_bytes(snapshot_order) + Zeal::Memory::hash_bytes(los_cache)
+			+ Zeal::Memory::hash_bytes(bindings) + Zeal::Memory::vector_bytes(subscribers), count };
+		for (const entity_snapshot& s : snapshots) //the columns grow together
+			use.bytes += s.spawn_id.capacity() * (2 * sizeof(WORD) + sizeof(Zeal::EqStructures::Entity*) + sizeof(DWORD) + 2 * sizeof(Vec3) + sizeof(float) + 2 * sizeof(BYTE));
+		return use;
+	});
+	zeal->callbacks->add_generic([this]() { frame++; diff_entities(); }, callback_type::MainLoop);
+	zeal->callbacks->add_packet([this](UINT opcode, char* buffer, UINT len) {
+		dirty = true; //the game applies the packet after the callbacks, rebuild on the next lookup
+		return false;
+	}, { Zeal::Packets::ZoneSpawns, Zeal::Packets::NewSpawn, Zeal::Packets::DeleteSpawn }); //only packets that add or remove spawns
+	zeal->callbacks->add_generic([this]() {
+		dirty = true;
+		visible_dist = -1.f;
+		visible_ids.reset();
+		grid_built = false;
+		los_cache.clear();
+		bindings.clear(); //every handle from the old zone goes stale
+		snapshots[current_snapshot].clear(); //the old zone's entities are freed, the new zone reports everything as spawned
+		last_target_id = 0;
+	}, callback_type::Zone);
+	zeal->callbacks->add_generic([this]() { dirty = true; visible_dist = -1.f; visible_ids.reset(); grid_built = false; los_cache.clear(); bindings.clear(); }, callback_type::CharacterSelect);
+}
+
+EntityManager::~EntityManager()
+{
+}
@@ -0,0 +1,166 @@
+#pragma once
+#include <Windows.h>
+#include <vector>
+#include <utility>
+#include <unordered_map>
+#include <functional>
+#include <bitset>
+#include "EqStructures.h"
+
+enum struct entity_event_type
+{
+	spawned,
+	despawned,
+	hp_changed, //old/new value are current hp
+	moved, //moved further than the subscriber threshold since the last moved event
+	target_changed, //old/new value are target spawn ids, spawn_id is the new target
+	level_changed,
+	type_changed, //e.g. an npc turning into a corpse
+	owner_changed, //old/new value are pet owner spawn ids, a charm taking hold or breaking
+	_count
+};
+struct entity_event
+{
+	entity_event_type type;
+	WORD spawn_id;
+	Zeal::EqStructures::Entity* ent; //nullptr for despawned
+	int old_value;
+	int new_value;
+};
+
+// a spawn held across frames, the id plus the generation the manager bound it to. a despawned spawn, or its id handed
+// to a new one, resolves to nullptr instead of a freed or different entity
+struct EntityHandle
+{
+	WORD spawn_id = 0;
+	UINT generation = 0;
+	explicit operator bool() const { return spawn_id != 0; }
+	bool operator==(const EntityHandle& other) const { return spawn_id == other.spawn_id && generation == other.generation; }
+	bool operator!=(const EntityHandle& other) const { return !(*this == other); }
+};
+
+// spawn id lookups without walking the game's entity list on every call
+// the index is rebuilt lazily after spawn/despawn traffic, every hit is validated and a miss falls back to the list walk
+class EntityManager
+{
+public:
+	EntityManager(class ZealService* zeal);
+	~EntityManager();
+	Zeal::EqStructures::Entity* get(WORD spawn_id);
+	EntityHandle handle(Zeal::EqStructures::Entity* ent); //empty for nullptr
+	Zeal::EqStructures::Entity* resolve(const EntityHandle& handle); //one index lookup, nullptr for a stale handle
+	Zeal::EqStructures::Entity* get_pet(WORD owner_id);
+	void get_pets(WORD owner_id, std::vector<Zeal::EqStructures::Entity*>& out);
+	void invalidate() { dirty = true; grid_built = false; visible_dist = -1.f; } //the spawn list was swapped or rebuilt outside a frame
+	void reserve(size_t spawns); //sizes the per frame buffers ahead of a zone with this many spawns
+	size_t spawn_count() const { return count; } //as of the last index rebuild
+	// engine visible set, queried once per frame and shared by every consumer; line of sight is only raycast when asked for
+	void get_visible_actors(float max_dist, bool only_targetable, std::vector<Zeal::EqStructures::Entity*>& out);
+	void ensure_visible(float max_dist); //refreshes the frame's set if it doesn't reach max_dist yet
+	bool is_visible(WORD spawn_id) const { return visible_ids.test(spawn_id); } //within the widest radius queried this frame
+	// 2d proximity over every spawn in the zone, backed by a uniform grid rebuilt on the first query of a frame
+	void query_radius(const Vec3& center, float radius, std::vector<Zeal::EqStructures::Entity*>& out);
+	void query_nearest(const Vec3& center, size_t k, float max_radius, std::vector<Zeal::EqStructures::Entity*>& out); //closest first
+	// change feed, the entity list is diffed once per frame while at least one subscriber has a non empty mask
+	UINT subscribe(std::function<void(const entity_event&)> callback, UINT32 type_mask = 0xFFFFFFFF);
+	void set_subscription_mask(UINT id, UINT32 type_mask);
+	float move_threshold = 1.f;
+private:
+	// one column per tracked field, rows sorted by spawn id so two frames diff with a single merge
+	struct entity_snapshot
+	{
+		std::vector<WORD> spawn_id;
+		std::vector<Zeal::EqStructures::Entity*> ent;
+		std::vector<DWORD> hp;
+		std::vector<Vec3> position;
+		std::vector<Vec3> reported; //position at the last moved event
+		std::vector<float> heading;
+		std::vector<BYTE> level;
+		std::vector<BYTE> type;
+		std::vector<WORD> owner;
+		void clear();
+		void reserve(size_t n);
+		void push(Zeal::EqStructures::Entity* e, const Vec3& reported_pos);
+	};
+	struct event_subscriber
+	{
+		UINT id;
+		UINT32 mask;
+		std::function<void(const entity_event&)> callback;
+	};
+	void diff_entities();
+	void publish(entity_event_type type, WORD spawn_id, Zeal::EqStructures::Entity* ent, int old_value, int new_value);
+	entity_snapshot snapshots[2];
+	int current_snapshot = 0;
+	std::vector<Zeal::EqStructures::Entity*> snapshot_order;
+	std::vector<event_subscriber> subscribers;
+	UINT next_subscriber_id = 1;
+	UINT32 subscribed_mask = 0;
+	WORD last_target_id = 0;
+	struct grid_entry
+	{
+		UINT64 key; //packed cell coordinates
+		Zeal::EqStructures::Entity* ent;
+	};
+	struct grid_cell
+	{
+		UINT64 key;
+		UINT begin; //range in grid_entries
+		UINT end;
+	};
+	void rebuild_grid();
+	struct visible_actor
+	{
+		Zeal::EqStructures::Entity* ent;
+		float dist; //2d distance to self
+		signed char los; //-1 not evaluated yet
+	};
+	struct los_entry
+	{
+		Zeal::EqStructures::Entity* ent;
+		short self_cell[3]; //positions quantized to los_tolerance
+		short target_cell[3];
+		ULONGLONG tick;
+		bool los;
+	};
+	void refresh_visible(float max_dist);
+	bool has_los(visible_actor& actor);
+	void resolve_los(float max_dist); //batches the raycasts for every unevaluated actor in range
+	int lookup_los(Zeal::EqStructures::Entity* self, Zeal::EqStructures::Entity* target, ULONGLONG now); //-1 when not cached or either end moved
+	void store_los(Zeal::EqStructures::Entity* self, Zeal::EqStructures::Entity* target, ULONGLONG now, bool los);
+	struct slot
+	{
+		WORD spawn_id; //0 is empty
+		Zeal::EqStructures::Entity* ent;
+	};
+	void rebuild();
+	void insert(WORD spawn_id, Zeal::EqStructures::Entity* ent);
+	Zeal::EqStructures::Entity* find(WORD spawn_id) const;
+	Zeal::EqStructures::Entity* walk(WORD spawn_id) const;
+	bool is_linked(Zeal::EqStructures::Entity* ent) const;
+	struct binding
+	{
+		Zeal::EqStructures::Entity* ent;
+		UINT generation;
+	};
+	std::unordered_map<WORD, binding> bindings; //spawn id -> the entity handles to it currently mean, cleared on zone
+	UINT next_generation = 1;
+	std::vector<slot> table = std::vector<slot>(1024); //power of two, linear probing
+	size_t count = 0;
+	std::vector<std::pair<WORD, Zeal::EqStructures::Entity*>> pets; //sorted by owner id
+	bool dirty = true;
+	std::vector<visible_actor> visible;
+	std::vector<Zeal::EqStructures::Entity*> visible_query;
+	float visible_dist = -1.f; //distance the cached set was queried with
+	std::bitset<0x10000> visible_ids; //spawn ids in the cached set
+	UINT frame = 0;
+	UINT visible_frame = 0;
+	std::vector<grid_entry> grid_entries; //sorted by cell
+	std::vector<grid_cell> grid_cells; //occupied cells, sorted by key
+	UINT grid_frame = 0;
+	bool grid_built = false;
+	std::unordered_map<WORD, los_entry> los_cache; //last raycast result per spawn id, reused while neither end moves
+	std::vector<UINT> los_pending; //indices into visible for the batch being raycast
+	std::vector<Zeal::EqStructures::Entity*> los_targets;
+	std::vector<char> los_results;
+};
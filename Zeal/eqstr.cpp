@@ -3,6 +3,7 @@
 #include "EqAddresses.h"
 #include "EqFunctions.h"
 #include "Zeal.h"
+#include <fstream>
 
 
 
@@ -13,25 +14,78 @@ eqstr::~eqstr()
 
 const char* __fastcall GetString(int stringtable, int unused, int string_id, bool* valid)
 {
-	eqstr* t = ZealService::get_instance()->eqstr_hook.get();
-	if (t->str_replacements.count(string_id) > 0)
+	const char* text = ZealService::get_instance()->eqstr_hook->lookup(string_id);
+	if (!text)
+		return hook_ref<GetString>::original()(stringtable, unused, string_id, valid);
+	if (text == eqstr::suppressed)
+		return "";
+	if (valid)
+		*valid = true;
+	return text;
+}
+
+void eqstr::refresh(int string_id)
+{
+	auto it = replacements.find(string_id);
+	(*table)[string_id] = it != replacements.end() ? it->second : (*noprint)[string_id] ? suppressed : nullptr;
+}
+
+void eqstr::set_noprint(int string_id, bool value)
+{
+	if ((UINT)string_id >= (UINT)table_size)
+		return;
+	(*noprint)[string_id] = value;
+	refresh(string_id);
+}
+
+void eqstr::set_replacement(int string_id, const char* text)
+{
+	if ((UINT)string_id >= (UINT)table_size)
+		return;
+	if (text)
+		replacements[string_id] = text;
+	else
+		replacements.erase(string_id);
+	refresh(string_id);
+}
+
+int eqstr::load_overrides(const char* path)
+{
+	std::ifstream file(path);
+	if (!file.is_open())
+		return 0;
+	int count = 0;
+	std::string line;
+	while (std::getline(file, line))
 	{
-		if (valid)
-			*valid = true;
-		return t->str_replacements[string_id];
+		if (line.size() && line.back() == '\r')
+			line.pop_back();
+		size_t split = line.find('=');
+		if (!line.size() || line[0] == '#' || split == std::string::npos)
+			continue;
+		char* end = nullptr;
+		long string_id = strtol(line.c_str(), &end, 10);
+		if (end != line.c_str() + split || string_id < 0 || string_id >= table_size)
+			continue;
+		if (split + 1 == line.size())
+			set_noprint(string_id, true);
+		else
+		{
+			owned_text.push_back(line.substr(split + 1));
+			set_replacement(string_id, owned_text.back().c_str());
+		}
+		count++;
 	}
-	if (t->str_noprint[string_id])
-		return "";
-	const char* d = ZealService::get_instance()->hooks->hook_map["GetString"]->original(GetString)(stringtable, unused, string_id, valid);
-	return d;
+	return count;
 }
 
 eqstr::eqstr(ZealService* zeal)
 {
-	str_replacements =
-	{
-		{6551, "Toggle target and myself"}
-		//{13085, "Well hello there, %1"}, //replaces Hail, player was for testing purposes
-	};
-	zeal->hooks->Add("GetString", 0x550EFE, GetString, hook_type_detour); //add extra prints for new loot types
+	table = std::make_unique<std::array<const char*, table_size>>();
+	table->fill(nullptr);
+	noprint = std::make_unique<std::bitset<table_size>>();
+	set_replacement(6551, "Toggle target and myself");
+	//set_replacement(13085, "Well hello there, %1"); //replaces Hail, player was for testing purposes
+	load_overrides(".\\zeal_strings.txt");
+	zeal->hooks->Add<GetString>("GetString", 0x550EFE, hook_type_detour); //add extra prints for new loot types
 }
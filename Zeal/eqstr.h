@@ -1,13 +1,30 @@
 #pragma once
 #include "hook_wrapper.h"
 #include "memory.h"
+#include <array>
+#include <bitset>
+#include <deque>
+#include <memory>
+#include <string>
+#include <unordered_map>
 
+// string table overrides, one slot per string id so the GetString hook costs a load and a compare for untouched ids
+// replacements win over suppression, user overrides are read from zeal_strings.txt once at startup (id=text, id= suppresses)
 class eqstr
 {
 public:
-	std::unordered_map<int, const char*> str_replacements;
-	std::unordered_map<int, bool> str_noprint;
+	static constexpr int table_size = 0x10000;
+	static constexpr const char* suppressed = ""; //slot marker for ids that print nothing
+	const char* lookup(int string_id) const { return (UINT)string_id < (UINT)table_size ? (*table)[string_id] : nullptr; }
+	void set_noprint(int string_id, bool noprint);
+	void set_replacement(int string_id, const char* text); //nullptr removes it, the text has to outlive the override
+	int load_overrides(const char* path);
 	eqstr(class ZealService* zeal);
 	~eqstr();
 private:
+	void refresh(int string_id);
+	std::unique_ptr<std::array<const char*, table_size>> table;
+	std::unique_ptr<std::bitset<table_size>> noprint;
+	std::unordered_map<int, const char*> replacements;
+	std::deque<std::string> owned_text; //text read from the override file, the deque keeps it in place
 };
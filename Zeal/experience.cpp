@@ -1,19 +1,21 @@
 #include "experience.h"
 #include "Zeal.h"
+#include "string_util.h"
+#include <algorithm>
 
 
-std::string format_duration(std::chrono::milliseconds ms) {
-	using namespace std::chrono;
-	auto secs = duration_cast<seconds>(ms);
-	ms -= duration_cast<milliseconds>(secs);
-	auto mins = duration_cast<minutes>(secs);
-	secs -= duration_cast<seconds>(mins);
-	auto hour = duration_cast<hours>(mins);
-	mins -= duration_cast<minutes>(hour);
+static std::string format_duration(ULONGLONG ms) {
+	ULONGLONG secs = ms / 1000;
+	char text[32];
+	snprintf(text, sizeof(text), "%llu:%llu:%llu", secs / 3600, (secs / 60) % 60, secs % 60);
+	return text;
+}
 
-	std::stringstream ss;
-	ss << hour.count() << ":" << mins.count() << ":" << secs.count();
-	return ss.str();
+void Experience::clear()
+{
+	ExpInfo.clear();
+	session_start = GetTickCount64();
+	last_update = 0;
 }
 
 void Experience::check_reset()
@@ -22,70 +24,89 @@ void Experience::check_reset()
 	static int zone_id = self->ZoneId;
 	static int prev_level = 0;
 	if (exp_per_hour_pct_tot < 0)
-		ExpInfo.clear();
+		clear();
 
 	if (self->Level != prev_level) //level up or delevel
-		ExpInfo.clear();
+		clear();
 
 	if (zone_id != self->ZoneId) //zoned
-		ExpInfo.clear();
+		clear();
 
 	prev_level = self->Level;
 	zone_id = self->ZoneId;
 }
 
-void Experience::callback_main()
+float Experience::rate(exp_window window, ULONGLONG now) const
 {
-	Zeal::EqStructures::Entity* self = Zeal::EqGame::get_self();
-	if (!self || !Zeal::EqGame::is_in_game())
-		return;
-	if (!self->CharInfo)
-		return;
-
-	check_reset();
-	exp_per_hour_tot = 0;
-	exp_per_hour_pct_tot = 0;
-	int total_gained = 0;
-	ULONGLONG total_duration = 0;
-	for (auto& e : ExpInfo)
+	if (!ExpInfo.size())
+		return 0;
+	size_t first = 0; //oldest gain in the window
+	ULONGLONG start = session_start;
+	if (window == exp_window::kills)
 	{
-		total_gained += e.Gained;
-		total_duration += e.Duration;
+		size_t kills = rate_kills.get() > 0 ? (size_t)rate_kills.get() : 1;
+		first = ExpInfo.size() > kills ? ExpInfo.size() - kills : 0;
+		// the time since the gain before the window, the first gain of a session only starts the clock
+		start = first ? ExpInfo[first - 1].TimeStamp : ExpInfo[0].TimeStamp;
 	}
-	if (ExpInfo.size())
-		total_duration += GetTickCount64() - ExpInfo.back().TimeStamp;
-
-	if (total_gained && total_duration)
+	else if (window == exp_window::minutes)
 	{
-		exp_per_hour_tot = ((((float)total_gained / (float)total_duration) * 1000) * 60) * 60;
-		exp_per_hour_pct_tot = (exp_per_hour_tot / max_exp) * 100;
+		ULONGLONG span = (ULONGLONG)(rate_minutes.get() > 0 ? rate_minutes.get() : 1) * 60000;
+		start = now > span ? now - span : 0;
+		if (start < session_start)
+			start = session_start;
+		first = std::lower_bound(ExpInfo.begin(), ExpInfo.end(), start, [](const _ExpData& e, ULONGLONG t) { return e.TimeStamp < t; }) - ExpInfo.begin();
 	}
-	std::chrono::milliseconds ms_to_level = std::chrono::milliseconds(0);
-	if (exp_per_hour_tot)
+	if (first >= ExpInfo.size() || now <= start)
+		return 0;
+	long long gained = ExpInfo.back().Total - (first ? ExpInfo[first - 1].Total : 0);
+	return (float)gained / (float)(now - start) * 1000.f * 60.f * 60.f;
+}
+
+void Experience::update_rates(ULONGLONG now)
+{
+	for (int i = 0; i < (int)exp_window::_count; ++i)
+		exp_per_hour_pct[i] = rate((exp_window)i, now) / max_exp * 100;
+	int selected = rate_window.get();
+	if (selected < 0 || selected >= (int)exp_window::_count)
+		selected = (int)exp_window::kills;
+	exp_per_hour_tot = rate((exp_window)selected, now);
+	exp_per_hour_pct_tot = exp_per_hour_pct[selected];
+	ULONGLONG ms_to_level = 0;
+	if (exp_per_hour_tot > 0)
 	{
-		float experience_needed = max_exp - self->CharInfo->Experience;
-		float total_hour_to_level = experience_needed / exp_per_hour_tot;
-		float total_minutes_to_level = total_hour_to_level * 60;
-		float total_seconds_to_level = total_minutes_to_level * 60;
-		int toal_ms_to_level = (int)(total_seconds_to_level * 1000);
-		ms_to_level = std::chrono::milliseconds(toal_ms_to_level);
+		float experience_needed = max_exp - exp;
+		ms_to_level = (ULONGLONG)(experience_needed / exp_per_hour_tot * 60 * 60 * 1000);
 	}
 	ttl = format_duration(ms_to_level);
+	last_update = now;
+}
 
+// the rates only move when exp does or as time passes, so they are refreshed on a gain and once a second
+void Experience::callback_main()
+{
+	Zeal::EqStructures::Entity* self = Zeal::EqGame::get_self();
+	if (!self || !Zeal::EqGame::is_in_game())
+		return;
+	if (!self->CharInfo)
+		return;
+
+	check_reset();
+	ULONGLONG now = GetTickCount64();
+	bool changed = false;
 	if (exp != self->CharInfo->Experience && exp != 0)
 	{
 		int gained = self->CharInfo->Experience - exp;
-		ULONGLONG last_stamp = GetTickCount64();
-		if (ExpInfo.size())
-			last_stamp = ExpInfo.back().TimeStamp;
-		ExpInfo.push_back(_ExpData(gained, last_stamp));
-		if (ExpInfo.size() > 20)
-			ExpInfo.pop_front();
+		long long total = (ExpInfo.size() ? ExpInfo.back().Total : 0) + gained;
+		ExpInfo.push_back({ now, gained, total });
+		changed = true;
 
 		//float gained_pct = ((float)gained / max_exp) * 100.f;
 		//Zeal::EqGame::print_chat("percent gained: %.2f%%  actual value: %i", gained_pct, gained);
 	}
 	exp = self->CharInfo->Experience;
+	if (changed || now - last_update >= 1000)
+		update_rates(now);
 }
 
 
@@ -98,5 +119,27 @@ Experience::Experience(ZealService* zeal)
 	exp = 0;
 	exp_per_hour_pct_tot = 0;
 	exp_per_hour_tot = 0;
+	session_start = GetTickCount64();
 	zeal->callbacks->add_generic([this]() { callback_main();  });
-}
\ No newline at end of file
+	zeal->labels_hook->add_label(81, "ExpPH", { [this](label_value& value) {
+		value.set_number(static_cast<int>(lroundf(exp_per_hour_pct_tot)));
+	}, [this]() { float rate = exp_per_hour_pct_tot; return (UINT64)*(UINT*)&rate; }, 100, true });
+	zeal->labels_hook->add_gauge(23, "ExpPerHR", { [this](std::string& text) { return (int)(1000.f * exp_per_hour_pct_tot / 100.f); } });
+	zeal->commands_hook->add("/exprate", {}, "Experience per hour over each window, /exprate [kills | minutes | session] picks the one the labels show.",
+		[this](std::vector<std::string>& args) {
+			static const char* window_names[] = { "kills", "minutes", "session" };
+			if (args.size() > 1)
+			{
+				for (int i = 0; i < (int)exp_window::_count; ++i)
+				{
+					if (Zeal::String::compare_insensitive(args[1], window_names[i]))
+						rate_window.set(i);
+				}
+				update_rates(GetTickCount64());
+			}
+			Zeal::EqGame::print_chat("Exp per hour: %.2f%% over the last %i kills, %.2f%% over %i minutes, %.2f%% this session (labels use %s)",
+				exp_per_hour_pct[0], rate_kills.get(), exp_per_hour_pct[1], rate_minutes.get(), exp_per_hour_pct[2],
+				window_names[rate_window.get() >= 0 && rate_window.get() < (int)exp_window::_count ? rate_window.get() : 0]);
+			return true;
+		});
+}
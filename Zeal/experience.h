@@ -1,18 +1,20 @@
 #pragma once
 #include <string>
-#include <deque>
+#include <vector>
 #include <Windows.h>
+#include "settings.h"
 struct _ExpData
 {
 	ULONGLONG TimeStamp;
-	ULONGLONG Duration;
 	int Gained;
-	_ExpData(int _gained, ULONGLONG LastTimeStamp)
-	{
-		TimeStamp = GetTickCount64();
-		Gained = _gained;
-		Duration = TimeStamp - LastTimeStamp;
-	}
+	long long Total; //running sum of Gained up to and including this one
+};
+enum struct exp_window
+{
+	kills, //the last ExpRateKills gains
+	minutes, //the last ExpRateMinutes
+	session, //since the last reset (zoning or a level change)
+	_count
 };
 class Experience
 {
@@ -23,10 +25,18 @@ public:
 	~Experience();
 	int exp;
 	static constexpr float max_exp = 330.f;
-	float exp_per_hour_tot;
+	float exp_per_hour_tot; //for the selected window, the labels show this one
 	float exp_per_hour_pct_tot;
+	float exp_per_hour_pct[(int)exp_window::_count] = {};
 	std::string ttl;
-	std::deque<_ExpData> ExpInfo;
-	
+	std::vector<_ExpData> ExpInfo; //prefix sums, so every window is two lookups
+	Setting<int> rate_window{ "Zeal", "ExpRateWindow", (int)exp_window::kills };
+	Setting<int> rate_kills{ "Zeal", "ExpRateKills", 20 };
+	Setting<int> rate_minutes{ "Zeal", "ExpRateMinutes", 5 };
+private:
+	void clear();
+	void update_rates(ULONGLONG now);
+	float rate(exp_window window, ULONGLONG now) const; //exp per hour
+	ULONGLONG session_start = 0;
+	ULONGLONG last_update = 0;
 };
-
@@ -0,0 +1,139 @@
+#include "fast_login.h"
+#include "Zeal.h"
+#include "EqFunctions.h"
+#include "string_util.h"
+
+static constexpr int warm_stages = 4;
+
+void FastLogin::defer(std::function<void()> job)
+{
+	if (enabled.get() && entering)
+		deferred.push_back(std::move(job));
+	else
+		job();
+}
+
+// the files the client reads for a character on entering the world: <name>_<server>.ini for binds and options,
+// UI_<name>_<server>.ini for the window layout. the server part isn't known at character select, so whatever matches
+void FastLogin::prefetch(const std::string& name)
+{
+	ZealService* zeal = ZealService::get_instance();
+	if (!zeal->tasks)
+		return;
+	zeal->tasks->post([name]() {
+		std::vector<std::string> files;
+		for (const std::string& pattern : { name + "_*.ini", "UI_" + name + "_*.ini" })
+		{
+			WIN32_FIND_DATAA found;
+			HANDLE find = FindFirstFileA(pattern.c_str(), &found);
+			if (find == INVALID_HANDLE_VALUE)
+				continue;
+			do
+				files.push_back(found.cFileName);
+			while (FindNextFileA(find, &found));
+			FindClose(find);
+		}
+		ZoneWarmup::read_ahead(files);
+	});
+}
+
+// one stage a frame, character select frames are idle but the list should stay responsive
+bool FastLogin::warm_step()
+{
+	if (!enabled.get() || warm_stage >= warm_stages || Zeal::EqGame::get_gamestate() != GAMESTATE_CHARSELECT)
+		return false;
+	ZealService* zeal = ZealService::get_instance();
+	switch (warm_stage++)
+	{
+	case 0:
+		zeal->spell_index->warm(); //the spell file is loaded before the character list comes up
+		break;
+	case 1:
+		zeal->buff_stacking->warm();
+		break;
+	case 2:
+		if (!last_character.empty())
+			zeal->character_store->preload(last_character);
+		break;
+	case 3:
+		if (!last_character.empty())
+			prefetch(last_character);
+		break;
+	}
+	return warm_stage < warm_stages;
+}
+
+bool FastLogin::run_deferred()
+{
+	if (entering || deferred.empty())
+		return false;
+	std::function<void()> job = std::move(deferred.front());
+	deferred.pop_front();
+	job();
+	return !deferred.empty();
+}
+
+void FastLogin::remember_character()
+{
+	Zeal::EqStructures::Entity* self = Zeal::EqGame::get_self();
+	if (!self || last_character == self->Name)
+		return;
+	last_character = self->Name;
+	ZealService::get_instance()->ini->setValue<std::string>("Zeal", "LastCharacter", last_character);
+}
+
+void FastLogin::first_frame()
+{
+	entering = false;
+	LARGE_INTEGER now;
+	QueryPerformanceCounter(&now);
+	last_login_ms = (now.QuadPart - enter_start) * ms_per_tick;
+	remember_character();
+	ZEAL_LOG_INFO("login", "enter world took %.0f ms, %u init jobs deferred", last_login_ms, static_cast<UINT>(deferred.size()));
+}
+
+void FastLogin::main_loop()
+{
+	int state = Zeal::EqGame::get_gamestate();
+	if (state == last_state)
+		return;
+	if (state == GAMESTATE_CHARSELECT)
+	{
+		warm_stage = 0;
+		entering = false;
+		deferred.clear(); //init jobs of a session that never rendered
+	}
+	else if (last_state == GAMESTATE_CHARSELECT && state != GAMESTATE_UNLOADING)
+	{
+		LARGE_INTEGER now;
+		QueryPerformanceCounter(&now);
+		enter_start = now.QuadPart;
+		entering = true;
+	}
+	last_state = state;
+}
+
+FastLogin::FastLogin(ZealService* zeal)
+{
+	LARGE_INTEGER frequency;
+	QueryPerformanceFrequency(&frequency);
+	ms_per_tick = 1000.0 / frequency.QuadPart;
+	last_character = zeal->ini->getValue<std::string>("Zeal", "LastCharacter");
+	zeal->callbacks->add_generic([this]() { main_loop(); });
+	zeal->callbacks->add_generic([this]() { if (entering && Zeal::EqGame::is_in_game()) first_frame(); }, callback_type::Render);
+	zeal->callbacks->add_work([this](int) { return warm_step(); }, 100, work_priority::low);
+	zeal->callbacks->add_work([this](int) { return run_deferred(); }, 1);
+	zeal->commands_hook->add("/fastlogin", {}, "Warms the last played character at character select and defers non critical ui init past the first frame, "
+		"/fastlogin on | off, no argument reports the last enter world time.",
+		[this](std::vector<std::string>& args) {
+			if (args.size() > 1 && (Zeal::String::compare_insensitive(args[1], "on") || Zeal::String::compare_insensitive(args[1], "off")))
+				enabled.set(Zeal::String::compare_insensitive(args[1], "on"));
+			Zeal::EqGame::print_chat("Fast login is %s, last character %s, last enter world %.0f ms", enabled.get() ? "on" : "off",
+				last_character.empty() ? "unknown" : last_character.c_str(), last_login_ms);
+			return true;
+		});
+}
+
+FastLogin::~FastLogin()
+{
+}
@@ -0,0 +1,34 @@
+#pragma once
+#include <Windows.h>
+#include <deque>
+#include <functional>
+#include <string>
+#include "settings.h"
+
+// character select to a responsive ui: while the character list is up, the spell index, the buff stacking profiles and
+// the last played character's store are built and that character's ini files are read ahead, so entering the world
+// finds them warm. InitUI work that nothing needs for the first frame goes through defer() and runs from the scheduler
+// once the world has rendered, a job at a time. /fastlogin reports how long the last enter world took
+class FastLogin
+{
+public:
+	void defer(std::function<void()> job); //after the first in game frame when entering the world, right away otherwise
+	Setting<bool> enabled{ "Zeal", "FastLogin", false };
+	FastLogin(class ZealService* zeal);
+	~FastLogin();
+private:
+	bool warm_step(); //scheduler work while at character select
+	bool run_deferred(); //scheduler work once the world has rendered
+	void main_loop();
+	void first_frame();
+	void remember_character();
+	void prefetch(const std::string& name);
+	std::deque<std::function<void()>> deferred;
+	std::string last_character; //from the ini, the one warmed at character select
+	int warm_stage = 0; //steps done this character select visit
+	int last_state = -1;
+	bool entering = false; //left character select, no in game frame rendered yet
+	LONGLONG enter_start = 0; //qpc when character select was left
+	double last_login_ms = 0;
+	double ms_per_tick = 0;
+};
@@ -4,48 +4,95 @@
 #include "EqAddresses.h"
 #include "string_util.h"
 #include <cstdint>
-#include <random>
-int getRandomIntBetween(int min, int max) {
-	// Create a random device and a random engine
-	std::random_device rd;
-	static std::mt19937 gen(rd());
+#include <climits>
+#include <algorithm>
+static constexpr ULONGLONG damage_lifetime = 2500;
+static constexpr ULONGLONG damage_step = 25; //the number rises and fades once per step
+static constexpr float digit_width_ratio = 0.6f; //layout width of a character against the font height
+static constexpr UINT32 despawn_mask = 1u << static_cast<int>(entity_event_type::despawned);
 
-	// Define the distribution range
-	std::uniform_int_distribution<> dis(min, max);
+void damage_particles::remove(int i)
+{
+	count--;
+	if (i == count)
+		return;
+	target[i] = target[count];
+	value[i] = value[count];
+	color_index[i] = color_index[count];
+	birth[i] = birth[count];
+	flags[i] = flags[count];
+}
 
-	// Generate and return the random integer
-	return dis(gen);
+void dps_tracker::add(ULONGLONG now_second, int damage)
+{
+	if (now_second > second)
+	{
+		ULONGLONG gap = now_second - second;
+		for (ULONGLONG s = 1; s <= gap && s <= dps_window; s++)
+			buckets[(second + s) % dps_window] = 0;
+		second = now_second;
+	}
+	buckets[now_second % dps_window] += damage;
 }
-void DamageData::tick()
+
+int dps_tracker::per_second(ULONGLONG now_second) const
 {
-	if (GetTickCount64() - start_time > 2500)
+	if (!target || now_second >= second + dps_window)
+		return 0;
+	int sum = 0;
+	for (ULONGLONG s = now_second - (dps_window - 1); s <= second; s++) //buckets newer than the last hit are empty
+		sum += buckets[s % dps_window];
+	return sum / dps_window;
+}
+
+void FloatingDamage::record_dps(WORD target, int damage, ULONGLONG now)
+{
+	ULONGLONG now_second = now / 1000;
+	dps_tracker* slot = &dps[0];
+	for (auto& t : dps)
 	{
-		needs_removed = true;
-		return;
+		if (t.target == target)
+		{
+			slot = &t;
+			break;
+		}
+		if (t.second < slot->second) //reuse the target hit longest ago
+			slot = &t;
+	}
+	if (slot->target != target)
+	{
+		*slot = dps_tracker();
+		slot->target = target;
+		slot->second = now_second;
+	}
+	slot->add(now_second, damage);
+}
+
+void FloatingDamage::release_target(WORD spawn_id)
+{
+	for (int i = 0; i < particles.count;)
+	{
+		if (particles.target[i] == spawn_id)
+			particles.remove(i);
+		else
+			i++;
 	}
-	if (GetTickCount64() - last_tick >= 25)
+	for (auto& t : dps)
 	{
-		y_offset -= 2;
-		opacity -= 0.02f;
-		last_tick = GetTickCount64();
+		if (t.target == spawn_id)
+			t = dps_tracker();
 	}
 }
-DamageData::DamageData(int dmg, bool _is_my_damage_dealt, bool _is_spell, int _heal)
+
+void FloatingDamage::tick(ULONGLONG now)
 {
-	is_spell = _is_spell;
-	is_my_damage = _is_my_damage_dealt;
-	if (dmg>0)
-		str_dmg = std::to_string(dmg);
-	else if (_heal>0)
-		str_dmg = "+" + std::to_string(_heal);
-	damage = dmg;
-	opacity = 1.0f;
-	y_offset = getRandomIntBetween(-20, 20);
-	x_offset = getRandomIntBetween(-20, 20);
-	needs_removed = false;
-	last_tick = GetTickCount64();
-	start_time = GetTickCount64();
-	heal = _heal;
+	for (int i = 0; i < particles.count;)
+	{
+		if (now - particles.birth[i] > damage_lifetime)
+			particles.remove(i);
+		else
+			i++;
+	}
 }
 
 long FloatRGBAtoLong(float r, float g, float b, float a) {
@@ -88,69 +135,125 @@ void FloatingDamage::callback_deferred()
 {
 	if (!Zeal::EqGame::is_in_game() || !enabled)
 		return;
-	if (Zeal::EqGame::get_wnd_manager())
+	ULONGLONG now = GetTickCount64();
+	tick(now);
+	if (!particles.count || !Zeal::EqGame::get_wnd_manager())
+		return;
+	if (font_height_size != font_size)
 	{
-		Zeal::EqUI::CTextureFont* fnt = Zeal::EqGame::get_wnd_manager()->GetFont(font_size);
-		if (fnt)
+		//only the height is needed while the atlas can be built
+		Zeal::EqUI::CTextureFont* fnt = Zeal::EqGame::get_wnd_manager()->GetFont(font_size.get());
+		font_height = fnt ? fnt->GetHeight() : 0;
+		font_height_size = font_size.get();
+	}
+	if (font_height <= 0)
+		return;
+	ZealService* zeal = ZealService::get_instance();
+	zeal->entity_manager->ensure_visible(250);
+	Zeal::EqStructures::Entity* self = Zeal::EqGame::get_self();
+
+	//anchor every live number on its target, then project them all at once; off screen ones are culled before any text is laid out
+	anchor_pos.clear();
+	anchor_particle.clear();
+	for (int i = 0; i < particles.count; i++)
+	{
+		Zeal::EqStructures::Entity* target = zeal->entity_manager->get(particles.target[i]);
+		if (!target)
+			continue;
+		if (target != self && !zeal->entity_manager->is_visible(particles.target[i]))
+			continue;
+		anchor_pos.push_back(target->Position);
+		anchor_particle.push_back(i);
+	}
+	if (show_dps)
+	{
+		for (int t = 0; t < dps_max_targets; t++)
 		{
-			std::vector<Zeal::EqStructures::Entity*> visible_ents = Zeal::EqGame::get_world_visible_actor_list(250, false);
-			Vec2 screen_size = ZealService::get_instance()->dx->GetScreenRect();
-			for (auto& [target, dmg_vec] : damage_numbers)
-			{
-				for (auto& dmg : dmg_vec)
-				{
-					dmg.tick();
-					if (std::find(visible_ents.begin(), visible_ents.end(), target) != visible_ents.end() || target == Zeal::EqGame::get_self())
-					{
-						Vec2 screen_pos = { 0,0 };
-						if (ZealService::get_instance()->dx->WorldToScreen({ target->Position.x,target->Position.y,target->Position.z }, screen_pos))
-						{
-							long color = FloatRGBAtoLong(1.0f, 1.0f, 1.0f, dmg.opacity);
-							if (dmg.is_my_damage) //if the damage is dealt by me
-							{
-								if (dmg.is_spell) 
-									color = Zeal::EqGame::get_user_color(28);
-								else
-									color = Zeal::EqGame::get_user_color(10);
-							}
-							else if (target == Zeal::EqGame::get_controlled()) //if the target is me
-							{
-								if (dmg.is_spell)
-									color = Zeal::EqGame::get_user_color(28);
-								else
-									color = Zeal::EqGame::get_user_color(11);
-							}
-							else if (target->Type==Zeal::EqEnums::EntityTypes::Player)
-							{
-								if (dmg.is_spell)
-									color = Zeal::EqGame::get_user_color(28);
-								else
-									color = Zeal::EqGame::get_user_color(17); //player being hit
-							}
-							else
-							{
-								if (dmg.is_spell)
-									color = Zeal::EqGame::get_user_color(28);
-								else
-									color = Zeal::EqGame::get_user_color(24); //npc being hit
-							}
-							if (dmg.heal > 0)
-								color = 0x00FF00FF;
-							fnt->DrawWrappedText(dmg.str_dmg.c_str(), Zeal::EqUI::CXRect(screen_pos.x + dmg.y_offset, screen_pos.y + dmg.x_offset, screen_pos.x + 150, screen_pos.y + 150), Zeal::EqUI::CXRect(0, 0, screen_size.x*2, screen_size.y*2), ModifyAlpha(color, dmg.opacity), 1, 0);
-						}
-					}
-				}
-				dmg_vec.erase(std::remove_if(dmg_vec.begin(), dmg_vec.end(), [](const DamageData& d) { return d.needs_removed; }), dmg_vec.end());
-			}
+			if (!dps[t].per_second(now / 1000))
+				continue;
+			Zeal::EqStructures::Entity* target = zeal->entity_manager->get(dps[t].target);
+			if (!target || (target != self && !zeal->entity_manager->is_visible(dps[t].target)))
+				continue;
+			anchor_pos.push_back(target->Position);
+			anchor_particle.push_back(-1 - t);
 		}
-		for (auto it = damage_numbers.begin(); it != damage_numbers.end();) {
-			if (it->second.empty()) {
-				it = damage_numbers.erase(it);
-			}
-			else {
-				++it;
+	}
+	anchor_screen.resize(anchor_pos.size());
+	anchor_on_screen.resize(anchor_pos.size());
+	if (!zeal->dx->WorldToScreen(anchor_pos.data(), anchor_pos.size(), anchor_screen.data(), anchor_on_screen.data()))
+		return;
+
+	//text and a layout box for every anchor on screen, the layout then spreads them out and drops what doesn't fit
+	glyphs.clear();
+	glyph_text.clear();
+	boxes.clear();
+	float digit_width = font_height * digit_width_ratio;
+	for (size_t a = 0; a < anchor_particle.size(); a++)
+	{
+		if (!anchor_on_screen[a])
+			continue;
+		char text[16];
+		int len = 0;
+		float x = anchor_screen[a].y; //the projector returns rows in x
+		float y = anchor_screen[a].x;
+		unsigned long color = 0xFFFFFFFF;
+		int priority = INT_MAX; //rolling dps sits above the target and always keeps its place
+		int value;
+		if (anchor_particle[a] < 0)
+		{
+			value = dps[-1 - anchor_particle[a]].per_second(now / 1000);
+			y -= 40.f;
+		}
+		else
+		{
+			int i = anchor_particle[a];
+			ULONGLONG age = now - particles.birth[i];
+			float steps = static_cast<float>(age / damage_step);
+			value = particles.value[i];
+			if (value < 0)
+			{
+				text[len++] = '+';
+				value = -value;
 			}
+			y -= 2.f * steps;
+			color = particles.color_index[i] < 0 ? 0x00FF00FF : Zeal::EqGame::user_color(particles.color_index[i]);
+			color = ModifyAlpha(color, 1.0f - 0.02f * steps);
+			//mine first, then the older numbers so they hold their spots and newer ones flow around them
+			priority = ((particles.flags[i] & damage_flag_mine) ? 1 << 20 : 0) + static_cast<int>(std::min(age, damage_lifetime));
 		}
+		UINT v = static_cast<UINT>(value);
+		char reversed[10];
+		int n = 0;
+		do { reversed[n++] = static_cast<char>('0' + v % 10); v /= 10; } while (v);
+		while (n)
+			text[len++] = reversed[--n];
+		boxes.push_back({ x, y, len * digit_width, static_cast<float>(font_height), priority, false });
+		glyphs.push_back({ static_cast<UINT>(glyph_text.size()), color });
+		text[len++] = '\0';
+		glyph_text.append(text, len);
+	}
+	Vec2 screen_size = zeal->dx->GetScreenRect();
+	layout.solve(boxes, screen_size.x, screen_size.y);
+	//one textured draw for every number, the ui font is only the fallback when the atlas can't be built
+	IDirect3DDevice8* device = zeal->dx->get_device();
+	if (digits.ready(device, font_height))
+	{
+		for (size_t g = 0; g < glyphs.size(); g++)
+			if (boxes[g].placed)
+				digits.add(glyph_text.c_str() + glyphs[g].text, boxes[g].left, boxes[g].top, glyphs[g].color);
+		digits.flush(device);
+		return;
+	}
+	Zeal::EqUI::CTextureFont* fnt = Zeal::EqGame::get_wnd_manager()->GetFont(font_size.get());
+	if (!fnt)
+		return;
+	Zeal::EqUI::CXRect clip(0, 0, screen_size.x * 2, screen_size.y * 2);
+	for (size_t g = 0; g < glyphs.size(); g++)
+	{
+		if (!boxes[g].placed)
+			continue;
+		float x = boxes[g].left, y = boxes[g].top;
+		fnt->DrawWrappedText(glyph_text.c_str() + glyphs[g].text, Zeal::EqUI::CXRect(y, x, y + 150, x + 150), clip, glyphs[g].color, 1, 0); //rows first, like the projector
 	}
 }
 
@@ -165,10 +268,63 @@ void FloatingDamage::add_damage(int* dmg_ptr, int heal)
 		Zeal::EqStructures::Entity* src = Zeal::EqGame::get_entity_by_id(dmg->source);
 		if (ent)
 		{
-			bool is_me = false;
-			if (src && src == Zeal::EqGame::get_controlled())
-				is_me = true;
-			damage_numbers[ent].push_back(DamageData(dmg->damage, is_me, dmg->spellid > 0, heal));
+			bool is_spell = dmg->spellid > 0;
+			short color_index = 24; //npc being hit
+			if (src && src == Zeal::EqGame::get_controlled()) //if the damage is dealt by me
+				color_index = 10;
+			else if (ent == Zeal::EqGame::get_controlled()) //if the target is me
+				color_index = 11;
+			else if (ent->Type == Zeal::EqEnums::EntityTypes::Player)
+				color_index = 17; //player being hit
+			if (is_spell)
+				color_index = 28;
+			if (heal > 0)
+				color_index = -1;
+			int value = (int)dmg->damage > 0 ? (int)dmg->damage : -heal; //negative shows as a heal
+			ULONGLONG now = GetTickCount64();
+			BYTE flags = (src && src == Zeal::EqGame::get_controlled() ? damage_flag_mine : 0) | (heal > 0 ? damage_flag_heal : 0);
+			if ((int)dmg->damage > 0)
+				record_dps(ent->SpawnId, (int)dmg->damage, now);
+			//fold into a recent number of the same kind, and find who gives way if the target is capped
+			int on_target = 0;
+			int evict = -1;
+			for (int j = 0; j < particles.count; j++)
+			{
+				if (particles.target[j] != ent->SpawnId)
+					continue;
+				if (merge_window > 0 && particles.color_index[j] == color_index && particles.flags[j] == flags
+					&& (particles.value[j] < 0) == (value < 0) && now - particles.birth[j] <= (ULONGLONG)merge_window)
+				{
+					particles.value[j] += value;
+					return;
+				}
+				on_target++;
+				bool low = !particles.flags[j];
+				if (evict < 0 || (low && particles.flags[evict]) || (low == !particles.flags[evict] && particles.birth[j] < particles.birth[evict]))
+					evict = j;
+			}
+			int i = particles.count;
+			if (max_per_target > 0 && on_target >= max_per_target)
+			{
+				if (particles.flags[evict] && !flags) //everything shown is mine or a heal, drop the newcomer
+					return;
+				i = evict;
+			}
+			else if (i == floating_damage_capacity)
+			{
+				//recycle the oldest number
+				i = 0;
+				for (int j = 1; j < particles.count; j++)
+					if (particles.birth[j] < particles.birth[i])
+						i = j;
+			}
+			else
+				particles.count++;
+			particles.target[i] = ent->SpawnId;
+			particles.value[i] = value;
+			particles.color_index[i] = color_index;
+			particles.birth[i] = now;
+			particles.flags[i] = flags;
 		}
 	}
 }
@@ -176,32 +332,67 @@ void FloatingDamage::add_damage(int* dmg_ptr, int heal)
 
 void __fastcall ReportSuccessfulHit(int t, int u, Zeal::Packets::Damage_Struct* dmg, char output_text, int heal)
 {
-	ZealService::get_instance()->floating_damage->add_damage((int*)dmg, heal);
-	ZealService::get_instance()->hooks->hook_map["ReportSuccessfulHit"]->original(ReportSuccessfulHit)(t, u, dmg, output_text, heal);
+	ZealService* zeal = ZealService::get_instance();
+	zeal->floating_damage->add_damage((int*)dmg, heal);
+	if (zeal->damage_meter)
+		zeal->damage_meter->add_hit(dmg, heal);
+	hook_ref<ReportSuccessfulHit>::original()(t, u, dmg, output_text, heal);
 }
 
 void FloatingDamage::set_enabled(bool _enabled)
 {
-	ZealService::get_instance()->ini->setValue<bool>("Zeal", "FloatingDamage", _enabled);
-	enabled = _enabled;
+	enabled.set(_enabled); //the change callback updates the despawn subscription
 }
 
 FloatingDamage::FloatingDamage(ZealService* zeal, IO_ini* ini)
 {
+	zeal->memory_report->add("floating damage", [this]() {
+		return Zeal::Memory::usage{ sizeof(particles) + sizeof(dps) + Zeal::Memory::vector_bytes(anchor_pos) + Zeal::Memory::vector_bytes(anchor_particle) + Zeal::Memory::vector_bytes(anchor_screen)
+			+ Zeal::Memory::vector_bytes(anchor_on_screen) + Zeal::Memory::vector_bytes(glyphs) + Zeal::Memory::string_bytes(glyph_text) + Zeal::Memory::vector_bytes(boxes), static_cast<size_t>(particles.count) };
+	});
 	//mem::write<BYTE>(0x4A594B, 0x14);
-	if (!ini->exists("Zeal", "FloatingDamage"))
-		ini->setValue<bool>("Zeal", "FloatingDamage", true);
-	enabled = ini->getValue<bool>("Zeal", "FloatingDamage");
-	zeal->callbacks->add_generic([this]() { callback_deferred(); }, callback_type::AddDeferred);
-	zeal->commands_hook->add("/fcd", {}, "Toggles floating combat text or adjusts the font size with argument",
-		[this, ini](std::vector<std::string>& args) {
+	deferred_callback = zeal->callbacks->add_generic([this]() { callback_deferred(); }, callback_type::AddDeferred, enabled);
+	zeal->callbacks->add_generic([this]() { digits.release(); }, callback_type::DeviceReset);
+	zeal->callbacks->add_generic([this]() { particles.count = 0; for (auto& t : dps) t = dps_tracker(); }, callback_type::Zone);
+	despawn_subscription = zeal->entity_manager->subscribe([this](const entity_event& e) { release_target(e.spawn_id); }, enabled ? despawn_mask : 0);
+	enabled.on_change([this](bool value) {
+		ZealService::get_instance()->entity_manager->set_subscription_mask(despawn_subscription, value ? despawn_mask : 0);
+		ZealService::get_instance()->callbacks->set_active(deferred_callback, value);
+		if (!value)
+			particles.count = 0; //numbers left over aren't drawn or aged out while the callback is off
+	});
+	zeal->commands_hook->add("/fcd", {}, "Toggles floating combat text or adjusts the font size with argument, also /fcd merge <ms>, /fcd cap <count> and /fcd dps",
+		[this](std::vector<std::string>& args) {
 			int new_size = 5;
-			if (args.size() == 2)
+			if (args.size() == 3 && Zeal::String::compare_insensitive(args[1], "merge"))
+			{
+				int value = 0;
+				if (Zeal::String::tryParse(args[2], &value))
+				{
+					merge_window.set(value);
+					Zeal::EqGame::print_chat("Floating combat hits within %i ms now merge", value);
+				}
+			}
+			else if (args.size() == 3 && Zeal::String::compare_insensitive(args[1], "cap"))
+			{
+				int value = 0;
+				if (Zeal::String::tryParse(args[2], &value))
+				{
+					max_per_target.set(value);
+					Zeal::EqGame::print_chat("Floating combat numbers per target capped at %i", value);
+				}
+			}
+			else if (args.size() == 2 && Zeal::String::compare_insensitive(args[1], "dps"))
+			{
+				show_dps.set(!show_dps);
+				Zeal::EqGame::print_chat("Floating combat dps is %s", show_dps ? "Enabled" : "Disabled");
+			}
+			else if (args.size() == 2)
 			{
 				if (Zeal::String::tryParse(args[1], &new_size))
 				{
-					font_size = new_size;
-					Zeal::EqGame::print_chat("Floating combat font size is now %i", font_size);
+					font_size.set(new_size);
+					Zeal::EqGame::print_chat("Floating combat font size is now %i", font_size.get());
 				}
 			}
 			else
@@ -212,7 +403,7 @@ FloatingDamage::FloatingDamage(ZealService* zeal, IO_ini* ini)
 			return true;
 		});
 
-	zeal->hooks->Add("ReportSuccessfulHit", 0x5297D2, ReportSuccessfulHit, hook_type_detour);
+	zeal->hooks->Add<ReportSuccessfulHit>("ReportSuccessfulHit", 0x5297D2, hook_type_detour);
 	
 	//zeal->callbacks->add_generic([this]() { callback_render();  }, callback_type::Render);
 }
@@ -1,25 +1,43 @@
 #pragma once
+#include "settings.h"
 #include "hook_wrapper.h"
 #include "memory.h"
 #include <stdint.h>
 #include "EqStructures.h"
 #include "EqUI.h"
+#include "digit_batch.h"
+#include "screen_layout.h"
 
-struct DamageData
+// floating numbers live in a fixed pool in structure of arrays layout, a full pool recycles the oldest number
+static constexpr int floating_damage_capacity = 512;
+struct damage_particles
 {
-	ULONGLONG start_time;
-	ULONGLONG last_tick;
-	float y_offset;
-	float x_offset;
-	bool needs_removed;
-	float opacity;
-	void tick();
-	bool is_my_damage;
-	bool is_spell;
-	std::string str_dmg;
-	int damage;
-	int heal;
-	DamageData(int dmg, bool _is_my_damage_dealt, bool _is_spell, int _heal);
+	int count = 0;
+	WORD target[floating_damage_capacity]; //spawn id
+	INT32 value[floating_damage_capacity]; //damage, or minus the amount healed
+	short color_index[floating_damage_capacity]; //user color index, -1 for heals
+	BYTE flags[floating_damage_capacity]; //damage_flag_*
+	ULONGLONG birth[floating_damage_capacity];
+	void remove(int i);
+};
+static constexpr BYTE damage_flag_mine = 1; //dealt by me, kept over other numbers when a target is capped
+static constexpr BYTE damage_flag_heal = 2;
+// rolling damage per target in one second buckets, shown above the target when enabled
+static constexpr int dps_window = 5; //seconds
+static constexpr int dps_max_targets = 32;
+struct dps_tracker
+{
+	WORD target = 0;
+	ULONGLONG second = 0; //newest bucket
+	INT32 buckets[dps_window] = {};
+	void add(ULONGLONG now_second, int damage);
+	int per_second(ULONGLONG now_second) const;
+};
+// the text of every number drawn this frame, laid out in one buffer before any draw call
+struct damage_glyph
+{
+	UINT text; //offset into glyph_text, the layout box with the same index has where it goes
+	unsigned long color;
 };
 
 class FloatingDamage
@@ -27,12 +45,32 @@ class FloatingDamage
 public:
 	void add_damage(int* dmg, int heal);
 	void callback_deferred();
+	void tick(ULONGLONG now);
+	void release_target(WORD spawn_id); //drops the numbers and dps of a spawn that left the world
 	void set_enabled(bool enable);
-	bool enabled;
+	Setting<bool> enabled{ "Zeal", "FloatingDamage", true };
 	FloatingDamage(class ZealService* zeal, class IO_ini* ini);
 	~FloatingDamage();
 private:
-	int font_size = 5;
-	std::unordered_map<Zeal::EqStructures::Entity*, std::vector<DamageData>> damage_numbers;
+	Setting<int> font_size{ "Zeal", "FloatingDamageFont", 5 }; //ui font index, the digit atlas rebuilds when it changes
+	int font_height = 0; //of the ui font at font_size, the atlas is built to match
+	int font_height_size = -1;
+	Setting<int> merge_window{ "Zeal", "FloatingDamageMerge", 250 }; //ms, hits of the same kind on the same target inside it add up into one number, 0 disables
+	Setting<int> max_per_target{ "Zeal", "FloatingDamageCap", 10 }; //live numbers per target, 0 for no cap
+	Setting<bool> show_dps{ "Zeal", "FloatingDamageDps", false };
+	void record_dps(WORD target, int damage, ULONGLONG now);
+	dps_tracker dps[dps_max_targets];
+	UINT despawn_subscription = 0;
+	UINT deferred_callback = 0; //only dispatched while enabled
+	damage_particles particles;
+	std::vector<Vec3> anchor_pos;
+	std::vector<int> anchor_particle;
+	std::vector<Vec2> anchor_screen;
+	std::vector<BYTE> anchor_on_screen;
+	std::vector<damage_glyph> glyphs;
+	std::string glyph_text;
+	std::vector<layout_box> boxes; //one per glyph
+	ScreenLayout layout;
+	DigitBatch digits;
 };
 
@@ -0,0 +1,74 @@
+#include "frame_arena.h"
+#include <Windows.h>
+#include <cstdio>
+
+FrameArena::FrameArena(size_t initial_size)
+{
+	add_block(initial_size);
+}
+
+FrameArena::~FrameArena()
+{
+	for (block& b : blocks)
+		::operator delete(b.data);
+}
+
+void FrameArena::add_block(size_t size)
+{
+	blocks.push_back({ static_cast<char*>(::operator new(size)), size });
+}
+
+void* FrameArena::do_allocate(size_t bytes, size_t alignment)
+{
+	block& b = blocks.back();
+	size_t start = (reinterpret_cast<size_t>(b.data + current_used) + alignment - 1) & ~(alignment - 1);
+	size_t offset = start - reinterpret_cast<size_t>(b.data);
+	if (offset + bytes > b.size)
+	{
+		retired += current_used;
+		size_t size = b.size * 2;
+		while (size < bytes + alignment)
+			size *= 2;
+		add_block(size);
+		current_used = 0;
+		return do_allocate(bytes, alignment);
+	}
+	current_used = offset + bytes;
+	if (used() > peak)
+		peak = used();
+	return b.data + offset;
+}
+
+void FrameArena::reset()
+{
+	if (blocks.size() > 1)
+	{
+		size_t size = blocks.front().size;
+		while (size < peak)
+			size *= 2;
+		for (block& b : blocks)
+			::operator delete(b.data);
+		blocks.clear();
+		add_block(size);
+	}
+	current_used = 0;
+	retired = 0;
+#ifdef _DEBUG
+	if (peak > reported * 2)
+	{
+		reported = peak;
+		char text[64];
+		snprintf(text, sizeof(text), "frame arena high water %u KB\n", static_cast<unsigned>(peak / 1024));
+		OutputDebugStringA(text);
+	}
+#endif
+}
+
+namespace Zeal::Frame
+{
+	FrameArena& arena()
+	{
+		static FrameArena instance;
+		return instance;
+	}
+}
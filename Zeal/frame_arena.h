@@ -0,0 +1,44 @@
+#pragma once
+#include <memory_resource>
+#include <string>
+#include <vector>
+
+// bump allocator for temporaries that live within one frame, game thread only, reset at the start of main_loop_hk
+// deallocate does nothing and reset() takes everything back at once, so a Frame:: container must not outlive the callback that made it
+class FrameArena : public std::pmr::memory_resource
+{
+public:
+	FrameArena(size_t initial_size = 64 * 1024);
+	~FrameArena();
+	FrameArena(const FrameArena&) = delete;
+	FrameArena& operator=(const FrameArena&) = delete;
+	void reset(); //overflow blocks are folded into one block sized to the high water mark
+	size_t used() const { return retired + current_used; }
+	size_t high_water() const { return peak; }
+private:
+	void* do_allocate(size_t bytes, size_t alignment) override;
+	void do_deallocate(void*, size_t, size_t) override {}
+	bool do_is_equal(const std::pmr::memory_resource& other) const noexcept override { return this == &other; }
+	struct block
+	{
+		char* data;
+		size_t size;
+	};
+	void add_block(size_t size);
+	std::vector<block> blocks;
+	size_t current_used = 0; //bytes taken from blocks.back()
+	size_t retired = 0; //bytes in the blocks before it
+	size_t peak = 0;
+	size_t reported = 0; //debug builds print the high water mark each time it doubles
+};
+
+namespace Zeal::Frame
+{
+	FrameArena& arena();
+	template<typename T>
+	using vector = std::pmr::vector<T>;
+	using string = std::pmr::string;
+	template<typename T>
+	vector<T> make_vector() { return vector<T>(&arena()); }
+	inline string make_string() { return string(&arena()); }
+}
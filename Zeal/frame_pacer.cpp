@@ -0,0 +1,126 @@
+#include "frame_pacer.h"
+#include "Zeal.h"
+#include "EqFunctions.h"
+#include "string_util.h"
+
+#ifndef CREATE_WAITABLE_TIMER_HIGH_RESOLUTION
+#define CREATE_WAITABLE_TIMER_HIGH_RESOLUTION 0x00000002
+#endif
+
+static constexpr int idle_fps = 10; //main loop rate while rendering is skipped, packets and logic still run every frame
+
+void FramePacer::wait_until(LONGLONG deadline)
+{
+	LARGE_INTEGER now;
+	QueryPerformanceCounter(&now);
+	// leave the last stretch to the spin, a timer wakes late far more often than early
+	LONGLONG spin = frequency / (high_resolution ? 1000 : 500);
+	if (timer && deadline - now.QuadPart > spin)
+	{
+		LARGE_INTEGER due;
+		due.QuadPart = -((deadline - now.QuadPart - spin) * 10000000 / frequency); //relative, 100ns units
+		if (SetWaitableTimer(timer, &due, 0, NULL, NULL, FALSE))
+			WaitForSingleObject(timer, 1000);
+	}
+	while (true)
+	{
+		QueryPerformanceCounter(&now);
+		if (now.QuadPart >= deadline)
+			break;
+		YieldProcessor();
+	}
+}
+
+void FramePacer::pace()
+{
+	HWND window = Zeal::EqGame::get_game_window();
+	bool minimized = window && IsIconic(window);
+	bool focused = window && GetForegroundWindow() == window;
+	ULONGLONG tick = GetTickCount64();
+	if (focused || !last_focused)
+		last_focused = tick;
+	bool idle = (minimized && skip_minimized.get()) ||
+		(!focused && skip_unfocused.get() > 0 && tick - last_focused >= static_cast<ULONGLONG>(skip_unfocused.get()) * 1000);
+	// an occasional real frame keeps managed resources and the ui's state from going stale
+	skipping = idle && !(keep_alive.get() > 0 && tick - last_rendered >= static_cast<ULONGLONG>(keep_alive.get()) * 1000);
+	if (!skipping)
+		last_rendered = tick;
+	int fps = focused ? foreground_fps.get() : background_fps.get();
+	if (idle && (fps <= 0 || fps > idle_fps))
+		fps = idle_fps; //nothing is drawn, a faster loop would only spin
+	if (fps <= 0)
+	{
+		next_frame = 0;
+		return;
+	}
+	LONGLONG period = frequency / fps;
+	LARGE_INTEGER now;
+	QueryPerformanceCounter(&now);
+	if (!next_frame || now.QuadPart - next_frame > period || next_frame - now.QuadPart > period)
+	{
+		// first frame, a hitch or a cap change, pace from here rather than rushing to catch up
+		next_frame = now.QuadPart + period;
+		return;
+	}
+	wait_until(next_frame);
+	next_frame += period;
+}
+
+FramePacer::FramePacer(ZealService* zeal)
+{
+	LARGE_INTEGER qpf;
+	QueryPerformanceFrequency(&qpf);
+	frequency = qpf.QuadPart;
+	timer = CreateWaitableTimerExW(NULL, NULL, CREATE_WAITABLE_TIMER_HIGH_RESOLUTION, TIMER_ALL_ACCESS);
+	high_resolution = timer != nullptr;
+	if (!timer)
+		timer = CreateWaitableTimerExW(NULL, NULL, 0, TIMER_ALL_ACCESS); //before windows 10 1803
+	zeal->commands_hook->add("/fps", {}, "Frame rate caps, /fps <n|off> for the focused client, /fps bg <n|off> for the others, /fps minimized to stop rendering while minimized, "
+		"/fps unfocused <seconds|off> to stop it after that long without focus, /fps keepalive <seconds> for the occasional frame while stopped.",
+		[this](std::vector<std::string>& args) {
+			int value = 0;
+			if (args.size() == 3 && Zeal::String::compare_insensitive(args[1], "unfocused") &&
+				(Zeal::String::compare_insensitive(args[2], "off") || (Zeal::String::tryParse(args[2], &value) && value >= 0)))
+			{
+				skip_unfocused.set(value);
+				if (value)
+					Zeal::EqGame::print_chat("Rendering stops after %is without focus", value);
+				else
+					Zeal::EqGame::print_chat("Rendering continues without focus");
+			}
+			else if (args.size() == 3 && Zeal::String::compare_insensitive(args[1], "keepalive") && Zeal::String::tryParse(args[2], &value) && value >= 0)
+			{
+				keep_alive.set(value);
+				Zeal::EqGame::print_chat("Skipped rendering still draws a frame every %is", value);
+			}
+			else if (args.size() == 2 && Zeal::String::compare_insensitive(args[1], "minimized"))
+			{
+				skip_minimized.set(!skip_minimized.get());
+				Zeal::EqGame::print_chat("Rendering while minimized is %s", skip_minimized.get() ? "off" : "on");
+			}
+			else if (args.size() == 2 && (Zeal::String::compare_insensitive(args[1], "off") || (Zeal::String::tryParse(args[1], &value) && value >= 0)))
+			{
+				foreground_fps.set(value);
+				Zeal::EqGame::print_chat("Foreground fps cap is %s", value ? std::to_string(value).c_str() : "off");
+			}
+			else if (args.size() == 3 && Zeal::String::compare_insensitive(args[1], "bg") &&
+				(Zeal::String::compare_insensitive(args[2], "off") || (Zeal::String::tryParse(args[2], &value) && value >= 0)))
+			{
+				background_fps.set(value);
+				Zeal::EqGame::print_chat("Background fps cap is %s", value ? std::to_string(value).c_str() : "off");
+			}
+			else
+			{
+				Zeal::EqGame::print_chat("Fps caps: foreground %i, background %i (0 is off), minimized rendering %s, unfocused render stop %is, keepalive %is",
+					foreground_fps.get(), background_fps.get(), skip_minimized.get() ? "off" : "on", skip_unfocused.get(), keep_alive.get());
+				Zeal::EqGame::print_chat("usage: /fps <n|off>, /fps bg <n|off>, /fps minimized, /fps unfocused <seconds|off>, /fps keepalive <seconds>");
+			}
+			return true;
+		});
+}
+
+FramePacer::~FramePacer()
+{
+	if (timer)
+		CloseHandle(timer);
+}
@@ -0,0 +1,30 @@
+#pragma once
+#include <Windows.h>
+#include "settings.h"
+
+// caps the frame rate from the start of the main loop, separately for the focused client and the ones behind it, so a box
+// of multiboxed clients leaves the cpu and gpu to the one being played. a high resolution waitable timer sleeps most of
+// the gap and a short spin lands on the deadline. idle boxes can also stop rendering altogether while the main loop keeps
+// handling packets and logic, at a low idle rate
+class FramePacer
+{
+public:
+	FramePacer(class ZealService* zeal);
+	~FramePacer();
+	void pace(); //top of the main loop, waits until the next frame is due
+	bool skip_render() const { return skipping; } //world and ui render are bypassed this frame, decided once per frame by pace()
+	Setting<int> foreground_fps{ "Zeal", "FpsLimit", 0 }; //0 for no cap
+	Setting<int> background_fps{ "Zeal", "FpsLimitBackground", 0 }; //e.g. 20 when multiboxing
+	Setting<bool> skip_minimized{ "Zeal", "SkipRenderMinimized", false };
+	Setting<int> skip_unfocused{ "Zeal", "SkipRenderUnfocused", 0 }; //seconds without focus before rendering stops, 0 never
+	Setting<int> keep_alive{ "Zeal", "SkipRenderKeepAlive", 5 }; //seconds, one frame is still rendered this often while skipping
+private:
+	void wait_until(LONGLONG deadline);
+	HANDLE timer = nullptr;
+	bool high_resolution = false; //a plain waitable timer is only as fine as the system timer, so spin longer
+	LONGLONG frequency = 0;
+	LONGLONG next_frame = 0; //qpc, 0 when not pacing
+	bool skipping = false;
+	ULONGLONG last_focused = 0;
+	ULONGLONG last_rendered = 0;
+};
@@ -0,0 +1,503 @@
+#include "frame_profiler.h"
+#include "Zeal.h"
+#include "EqFunctions.h"
+#include "string_util.h"
+#include <algorithm>
+#include <cmath>
+#include <fstream>
+
+#define GRAPH_FVF (D3DFVF_XYZRHW | D3DFVF_DIFFUSE)
+static constexpr int graph_columns = 300; //frames shown, one pixel each
+static constexpr float graph_height = 100.f;
+static constexpr float graph_ms = 50.f; //frame time at the top of the graph
+static constexpr D3DCOLOR phase_colors[] = {
+	D3DCOLOR_ARGB(220, 70, 130, 255), //main_loop
+	D3DCOLOR_ARGB(220, 60, 200, 90), //render
+	D3DCOLOR_ARGB(220, 255, 160, 40), //deferred
+	D3DCOLOR_ARGB(220, 190, 90, 230), //render_ui
+	D3DCOLOR_ARGB(220, 160, 160, 160), //end_scene
+};
+static_assert(sizeof(phase_colors) / sizeof(phase_colors[0]) == static_cast<size_t>(frame_phase::_count));
+static const char* phase_names[] = { "logic", "render", "deferred", "ui", "present" };
+static constexpr D3DCOLOR overlay_color = D3DCOLOR_ARGB(255, 80, 240, 240); //zeal's own drawing
+
+void FrameProfiler::mark(frame_phase phase)
+{
+	if (!collecting())
+		return;
+	LARGE_INTEGER now;
+	QueryPerformanceCounter(&now);
+	int index = static_cast<int>(phase);
+	if (phase == frame_phase::main_loop)
+	{
+		if (marks[index])
+			close_frame(now.QuadPart);
+		memset(marks, 0, sizeof(marks));
+		frame_packets.clear();
+		frame_packet_count = 0;
+		frame_chat_lines = 0;
+		frame_input_ms = 0;
+		overlay_ticks = 0;
+		overlay_gpu_ticks = 0;
+		if (hitch_reports.get() && Zeal::Profiler::enabled)
+			Zeal::Profiler::snapshot(frame_baseline);
+		else
+			frame_baseline.clear();
+	}
+	else if (!marks[static_cast<int>(frame_phase::main_loop)] || marks[index])
+		return; //before the first full frame or a repeat within this one
+	marks[index] = now.QuadPart;
+}
+
+void FrameProfiler::close_frame(LONGLONG now)
+{
+	// each phase runs until the next one that fired, the last one until the next frame starts
+	int order[phase_count];
+	int present = 0;
+	for (int i = 0; i < phase_count; ++i)
+		if (marks[i])
+			order[present++] = i;
+	std::sort(order, order + present, [this](int a, int b) { return marks[a] < marks[b]; });
+	frame_record& record = frames[frame_count % history];
+	memset(&record, 0, sizeof(record));
+	for (int i = 0; i < present; ++i)
+	{
+		LONGLONG end = i + 1 < present ? marks[order[i + 1]] : now;
+		record.phase_ms[order[i]] = (float)((end - marks[order[i]]) * ms_per_tick);
+	}
+	record.total_ms = (float)((now - marks[static_cast<int>(frame_phase::main_loop)]) * ms_per_tick);
+	record.overlay_ms = (float)(overlay_ticks * ms_per_tick);
+	record.overlay_gpu_ms = (float)(overlay_gpu_ticks * ms_per_tick);
+	record.input_ms = frame_input_ms;
+	frame_count++;
+
+	if (median_ms > 0 && record.total_ms > median_ms * 3 && record.total_ms > 50.f)
+	{
+		hitches[hitch_count % hitches.size()] = { GetTickCount64(), record };
+		hitch_count++;
+		if (hitch_reports.get())
+			write_hitch_report(record);
+	}
+	ULONGLONG tick = GetTickCount64();
+	if (tick - last_lows > 500)
+	{
+		last_lows = tick;
+		update_lows();
+	}
+}
+
+void FrameProfiler::update_lows()
+{
+	size_t count = frame_count < history ? frame_count : history;
+	if (!count)
+		return;
+	sorted.resize(count);
+	double sum = 0;
+	double overlay_sum = 0;
+	for (size_t i = 0; i < count; ++i)
+	{
+		sorted[i] = frames[i].total_ms;
+		sum += sorted[i];
+		overlay_sum += frames[i].overlay_ms;
+	}
+	average_ms = (float)(sum / count);
+	overlay_average_ms = (float)(overlay_sum / count);
+	size_t p99 = count * 99 / 100;
+	size_t p999 = count * 999 / 1000;
+	std::nth_element(sorted.begin(), sorted.begin() + p999, sorted.end());
+	low_01_ms = sorted[p999];
+	std::nth_element(sorted.begin(), sorted.begin() + p99, sorted.begin() + p999);
+	low_1_ms = sorted[p99];
+	std::nth_element(sorted.begin(), sorted.begin() + count / 2, sorted.begin() + p99);
+	median_ms = sorted[count / 2];
+}
+
+LONGLONG FrameProfiler::overlay_begin(IDirect3DDevice8* device, bool fence_gpu)
+{
+	if (!collecting() || !marks[static_cast<int>(frame_phase::main_loop)])
+		return 0;
+	if (fence_gpu && gpu_timing && device)
+		fence(device); //the game's work so far, so the second fence only waits on ours
+	LARGE_INTEGER now;
+	QueryPerformanceCounter(&now);
+	return now.QuadPart;
+}
+
+void FrameProfiler::overlay_end(IDirect3DDevice8* device, LONGLONG start, bool fence_gpu)
+{
+	if (!start)
+		return;
+	LARGE_INTEGER now;
+	QueryPerformanceCounter(&now);
+	overlay_ticks += now.QuadPart - start;
+	if (fence_gpu && gpu_timing && device && fence(device))
+	{
+		QueryPerformanceCounter(&now);
+		overlay_gpu_ticks += now.QuadPart - start;
+	}
+}
+
+// d3d8 has no queries, reading back a pixel of the back buffer is the one way to wait for the gpu to catch up
+bool FrameProfiler::fence(IDirect3DDevice8* device)
+{
+	IDirect3DSurface8* back = nullptr;
+	if (FAILED(device->GetBackBuffer(0, D3DBACKBUFFER_TYPE_MONO, &back)) || !back)
+		return false;
+	if (!fence_surface)
+	{
+		D3DSURFACE_DESC desc;
+		if (FAILED(back->GetDesc(&desc)) || FAILED(device->CreateImageSurface(1, 1, desc.Format, &fence_surface)))
+			fence_surface = nullptr;
+	}
+	RECT rect = { 0, 0, 1, 1 };
+	POINT point = { 0, 0 };
+	bool ok = fence_surface && SUCCEEDED(device->CopyRects(back, &rect, 1, fence_surface, &point));
+	back->Release();
+	D3DLOCKED_RECT locked;
+	if (ok && SUCCEEDED(fence_surface->LockRect(&locked, NULL, D3DLOCK_READONLY)))
+	{
+		fence_surface->UnlockRect();
+		return true;
+	}
+	gpu_timing = false; //the driver won't read back, don't keep stalling for nothing
+	Zeal::EqGame::print_chat("Gpu timing is not supported by this device");
+	return false;
+}
+
+void FrameProfiler::release_fence()
+{
+	if (fence_surface)
+		fence_surface->Release();
+	fence_surface = nullptr;
+}
+
+void FrameProfiler::note_packet(UINT opcode, UINT len)
+{
+	if (!collecting())
+		return;
+	frame_packet_count++;
+	if (frame_packets.size() < max_packets)
+		frame_packets.push_back({ opcode, len });
+}
+
+// one text file per hitch next to the crash dumps, at most one every 10 seconds so a long zone does not write dozens
+void FrameProfiler::write_hitch_report(const frame_record& record)
+{
+	ULONGLONG tick = GetTickCount64();
+	if (last_report && tick - last_report < 10000)
+		return;
+	last_report = tick;
+	CreateDirectoryA("crashes", NULL);
+	SYSTEMTIME time;
+	GetLocalTime(&time);
+	char filename[96];
+	snprintf(filename, sizeof(filename), "crashes\\hitch_%04d%02d%02d_%02d%02d%02d_%03d.txt", time.wYear, time.wMonth, time.wDay,
+		time.wHour, time.wMinute, time.wSecond, time.wMilliseconds);
+	std::ofstream file(filename);
+	if (!file.is_open())
+		return;
+	char line[256];
+	snprintf(line, sizeof(line), "frame %.1fms, median %.1fms, average %.1fms\n", record.total_ms, median_ms, average_ms);
+	file << line;
+	for (int p = 0; p < phase_count; ++p)
+	{
+		snprintf(line, sizeof(line), "  %-8s %.2fms\n", phase_names[p], record.phase_ms[p]);
+		file << line;
+	}
+	Zeal::EqStructures::Entity* self = Zeal::EqGame::get_self();
+	snprintf(line, sizeof(line), "zone %d, chat lines %u, packets %u, pipe queue %u\n", self ? (int)self->ZoneId : -1, frame_chat_lines,
+		frame_packet_count, ZealService::get_instance()->pipe ? (UINT)ZealService::get_instance()->pipe->queued_frames() : 0);
+	file << line;
+
+	if (frame_baseline.size())
+	{
+		Zeal::Profiler::snapshot(frame_end);
+		double per_ms = Zeal::Profiler::cycles_per_ms();
+		std::vector<std::pair<UINT64, size_t>> ran; //cycles this frame, entry index
+		for (size_t i = 0; i < frame_end.size(); ++i)
+		{
+			UINT64 calls = frame_end[i].first - (i < frame_baseline.size() ? frame_baseline[i].first : 0);
+			UINT64 cycles = frame_end[i].second - (i < frame_baseline.size() ? frame_baseline[i].second : 0);
+			if (calls)
+				ran.push_back({ cycles, i });
+		}
+		std::sort(ran.begin(), ran.end(), [](const auto& a, const auto& b) { return a.first > b.first; });
+		file << "hooks and callbacks this frame:\n";
+		for (size_t i = 0; i < ran.size() && i < 25; ++i)
+		{
+			size_t index = ran[i].second;
+			snprintf(line, sizeof(line), "  %s: %llu calls, %.2fms\n", Zeal::Profiler::all()[index]->name.c_str(),
+				frame_end[index].first - (index < frame_baseline.size() ? frame_baseline[index].first : 0), per_ms > 0 ? ran[i].first / per_ms : 0.0);
+			file << line;
+		}
+	}
+	else
+		file << "hooks and callbacks were not timed, /zealprof on to include them\n";
+
+	if (frame_packets.size())
+	{
+		file << "packets:";
+		for (const auto& packet : frame_packets)
+		{
+			snprintf(line, sizeof(line), " 0x%04x(%u)", packet.first, packet.second);
+			file << line;
+		}
+		file << "\n";
+	}
+}
+
+static void set_graph_states(render_state_cache& states)
+{
+	states.set_render_state(D3DRS_CULLMODE, D3DCULL_NONE);
+	states.set_render_state(D3DRS_ALPHABLENDENABLE, TRUE);
+	states.set_render_state(D3DRS_SRCBLEND, D3DBLEND_SRCALPHA);
+	states.set_render_state(D3DRS_DESTBLEND, D3DBLEND_INVSRCALPHA);
+	states.set_render_state(D3DRS_ZENABLE, FALSE);
+	states.set_render_state(D3DRS_ZWRITEENABLE, FALSE);
+	states.set_render_state(D3DRS_LIGHTING, FALSE);
+	states.set_render_state(D3DRS_FOGENABLE, FALSE);
+	states.set_texture_stage_state(0, D3DTSS_COLOROP, D3DTOP_SELECTARG1);
+	states.set_texture_stage_state(0, D3DTSS_COLORARG1, D3DTA_DIFFUSE);
+	states.set_texture_stage_state(0, D3DTSS_ALPHAOP, D3DTOP_SELECTARG1);
+	states.set_texture_stage_state(0, D3DTSS_ALPHAARG1, D3DTA_DIFFUSE);
+	states.set_texture_stage_state(1, D3DTSS_COLOROP, D3DTOP_DISABLE);
+	states.set_texture(nullptr);
+	states.set_vertex_shader(GRAPH_FVF);
+}
+
+void FrameProfiler::add_quad(std::vector<vertex>& vertices, float left, float top, float right, float bottom, D3DCOLOR color)
+{
+	vertex quad[6] = {
+		{ left, top, 0.f, 1.f, color },
+		{ right, top, 0.f, 1.f, color },
+		{ left, bottom, 0.f, 1.f, color },
+		{ right, top, 0.f, 1.f, color },
+		{ right, bottom, 0.f, 1.f, color },
+		{ left, bottom, 0.f, 1.f, color },
+	};
+	vertices.insert(vertices.end(), quad, quad + 6);
+}
+
+void FrameProfiler::render()
+{
+	ZealService* zeal = ZealService::get_instance();
+	if (!enabled || !frame_count || !zeal->dx)
+		return;
+	IDirect3DDevice8* device = zeal->dx->get_device();
+	if (!device)
+		return;
+	Vec2 screen = zeal->dx->GetScreenRect();
+	if (screen.x < graph_columns + 20 || screen.y < graph_height + 60)
+		return;
+	float left = screen.x - graph_columns - 10.f;
+	float bottom = 40.f + graph_height;
+	float scale = graph_height / graph_ms;
+
+	vertices.clear();
+	add_quad(vertices, left, bottom - graph_height, left + graph_columns, bottom, D3DCOLOR_ARGB(140, 0, 0, 0));
+	size_t shown = frame_count < graph_columns ? frame_count : graph_columns;
+	for (size_t i = 0; i < shown; ++i)
+	{
+		const frame_record& record = frames[(frame_count - shown + i) % history];
+		float x = left + graph_columns - shown + i;
+		float y = bottom;
+		for (int p = 0; p < phase_count && y > bottom - graph_height; ++p)
+		{
+			float height = record.phase_ms[p] * scale;
+			if (height <= 0)
+				continue;
+			float top = y - height;
+			if (top < bottom - graph_height)
+				top = bottom - graph_height;
+			add_quad(vertices, x, top, x + 1.f, y, phase_colors[p]);
+			y = top;
+		}
+		float overlay = (gpu_timing && record.overlay_gpu_ms > 0 ? record.overlay_gpu_ms : record.overlay_ms) * scale;
+		if (overlay > 0 && overlay < graph_height)
+			add_quad(vertices, x, bottom - overlay - 1.f, x + 1.f, bottom - overlay, overlay_color);
+	}
+	add_quad(vertices, left, bottom - 1000.f / 60.f * scale, left + graph_columns, bottom - 1000.f / 60.f * scale + 1.f, D3DCOLOR_ARGB(160, 255, 255, 255)); //60 fps
+	add_quad(vertices, left, bottom - 1000.f / 30.f * scale, left + graph_columns, bottom - 1000.f / 30.f * scale + 1.f, D3DCOLOR_ARGB(160, 255, 80, 80)); //30 fps
+
+	render_state_cache& states = zeal->dx->states;
+	states.begin(device);
+	set_graph_states(states);
+	device->DrawPrimitiveUP(D3DPT_TRIANGLELIST, (UINT)(vertices.size() / 3), vertices.data(), sizeof(vertex));
+	states.restore();
+
+	// average, 1% low and 0.1% low as fps above the graph, then the average overlay cost in microseconds
+	if (average_ms > 0 && digits.ready(device, 14))
+	{
+		char text[16];
+		const float values[] = { average_ms, low_1_ms, low_01_ms };
+		const D3DCOLOR colors[] = { D3DCOLOR_ARGB(255, 255, 255, 255), D3DCOLOR_ARGB(255, 255, 220, 60), D3DCOLOR_ARGB(255, 255, 80, 80) };
+		for (int i = 0; i < 3; ++i)
+		{
+			snprintf(text, sizeof(text), "%d", values[i] > 0 ? (int)(1000.f / values[i] + 0.5f) : 0);
+			digits.add(text, left + i * 50.f, bottom - graph_height - 20.f, colors[i]);
+		}
+		snprintf(text, sizeof(text), "%d", (int)(overlay_average_ms * 1000.f + 0.5f)); //microseconds
+		digits.add(text, left + 3 * 50.f, bottom - graph_height - 20.f, overlay_color);
+		digits.flush(device);
+	}
+}
+
+void FrameProfiler::report_hitches()
+{
+	size_t count = hitch_count < hitches.size() ? hitch_count : hitches.size();
+	Zeal::EqGame::print_chat("Frame average %.1fms, 1%% low %.1fms, 0.1%% low %.1fms over %u frames", average_ms, low_1_ms, low_01_ms,
+		(UINT)(frame_count < history ? frame_count : history));
+	if (!count)
+	{
+		Zeal::EqGame::print_chat("No hitches recorded");
+		return;
+	}
+	ULONGLONG now = GetTickCount64();
+	for (size_t i = 0; i < count; ++i)
+	{
+		const hitch& h = hitches[(hitch_count - 1 - i) % hitches.size()];
+		std::string line;
+		char part[64];
+		snprintf(part, sizeof(part), "%.0fs ago %.1fms:", (now - h.tick) / 1000.0, h.frame.total_ms);
+		line = part;
+		for (int p = 0; p < phase_count; ++p)
+		{
+			snprintf(part, sizeof(part), " %s %.1f", phase_names[p], h.frame.phase_ms[p]);
+			line += part;
+		}
+		Zeal::EqGame::print_chat(line);
+	}
+}
+
+// frame to frame consistency, a steady 40 fps reads smoother than one alternating between 20ms and 30ms
+void FrameProfiler::report_pacing()
+{
+	size_t count = frame_count < history ? frame_count : history;
+	if (count < 2)
+	{
+		Zeal::EqGame::print_chat("Not enough frames recorded, /frameprof on first");
+		return;
+	}
+	double sum = 0, squares = 0, jitter = 0, overlay = 0, overlay_gpu = 0, input = 0;
+	float input_worst = 0;
+	size_t spikes = 0;
+	size_t gpu_frames = 0;
+	size_t input_frames = 0;
+	for (size_t i = 0; i < count; ++i)
+	{
+		const frame_record& record = frames[(frame_count - count + i) % history];
+		sum += record.total_ms;
+		squares += (double)record.total_ms * record.total_ms;
+		overlay += record.overlay_ms;
+		if (record.overlay_gpu_ms > 0)
+		{
+			overlay_gpu += record.overlay_gpu_ms;
+			gpu_frames++;
+		}
+		if (record.input_ms > 0)
+		{
+			input += record.input_ms;
+			input_worst = record.input_ms > input_worst ? record.input_ms : input_worst;
+			input_frames++;
+		}
+		if (i > 0)
+		{
+			const frame_record& last = frames[(frame_count - count + i - 1) % history];
+			jitter += fabs(record.total_ms - last.total_ms);
+			if (record.total_ms > last.total_ms * 1.5f)
+				spikes++;
+		}
+	}
+	double mean = sum / count;
+	double variance = squares / count - mean * mean;
+	Zeal::EqGame::print_chat("Pacing over %u frames: %.2fms average, %.2fms median, %.2fms deviation, %.2fms frame to frame, %.1f%% spikes",
+		(UINT)count, mean, median_ms, variance > 0 ? sqrt(variance) : 0.0, jitter / (count - 1), 100.0 * spikes / (count - 1));
+	Zeal::EqGame::print_chat("Zeal overlays: %.3fms cpu per frame (%.1f%%)%s", overlay / count, mean > 0 ? 100.0 * overlay / sum : 0.0,
+		gpu_frames ? "" : ", /frameprof gpu to include gpu time");
+	if (gpu_frames)
+		Zeal::EqGame::print_chat("Zeal overlays with gpu: %.3fms per frame over %u fenced frames, the fences themselves slow the frame down",
+			overlay_gpu / gpu_frames, (UINT)gpu_frames);
+	if (input_frames)
+		Zeal::EqGame::print_chat("Input to action: %.1fms average, %.1fms worst over %u frames with input%s", input / input_frames, input_worst,
+			(UINT)input_frames, ZealService::get_instance()->input && ZealService::get_instance()->input->early_input.get() ? " (early input on)" : "");
+}
+
+void FrameProfiler::set_enabled(bool on)
+{
+	if (on && !collecting())
+	{
+		memset(marks, 0, sizeof(marks));
+		frame_count = 0;
+		hitch_count = 0;
+		average_ms = 0;
+		low_1_ms = 0;
+		low_01_ms = 0;
+		overlay_average_ms = 0;
+	}
+	enabled = on;
+	if (!on)
+		gpu_timing = false;
+}
+
+FrameProfiler::FrameProfiler(ZealService* zeal)
+{
+	LARGE_INTEGER frequency;
+	QueryPerformanceFrequency(&frequency);
+	ms_per_tick = 1000.0 / frequency.QuadPart;
+	frames.resize(history);
+	hitches.resize(10);
+	if (hitch_reports.get())
+		Zeal::Profiler::set_enabled(true);
+	zeal->callbacks->add_generic([this]() { render(); }, callback_type::EndScene);
+	zeal->callbacks->add_generic([this]() { digits.release(); release_fence(); }, callback_type::DeviceReset);
+	zeal->commands_hook->add("/frameprof", {}, "Frame time graph split by phase, /frameprof on|off, /frameprof hitches to list the recent long frames, /frameprof reports to write each one to crashes, "
+		"/frameprof pacing for frame consistency, input latency and the overlays' cost, /frameprof gpu to fence the gpu around them, "
+		"/frameprof earlyinput to process the mouse again right before render.",
+		[this](std::vector<std::string>& args) {
+			if (args.size() > 1 && Zeal::String::compare_insensitive(args[1], "hitches"))
+			{
+				report_hitches();
+				return true;
+			}
+			if (args.size() > 1 && Zeal::String::compare_insensitive(args[1], "earlyinput") && ZealService::get_instance()->input)
+			{
+				Setting<bool>& early = ZealService::get_instance()->input->early_input;
+				early.set(!early.get());
+				Zeal::EqGame::print_chat("Early input is %s", early.get() ? "on, the mouse is processed again just before render" : "off");
+				return true;
+			}
+			if (args.size() > 1 && Zeal::String::compare_insensitive(args[1], "pacing"))
+			{
+				report_pacing();
+				return true;
+			}
+			if (args.size() > 1 && Zeal::String::compare_insensitive(args[1], "gpu"))
+			{
+				if (!gpu_timing && !enabled)
+					set_enabled(true);
+				gpu_timing = !gpu_timing;
+				Zeal::EqGame::print_chat("Gpu timing is %s%s", gpu_timing ? "on" : "off", gpu_timing ? ", frame times include two gpu stalls" : "");
+				return true;
+			}
+			if (args.size() > 1 && Zeal::String::compare_insensitive(args[1], "reports"))
+			{
+				hitch_reports.set(!hitch_reports.get());
+				if (hitch_reports.get())
+					Zeal::Profiler::set_enabled(true); //so the report can list what ran during the frame
+				Zeal::EqGame::print_chat("Hitch reports are %s", hitch_reports.get() ? "on" : "off");
+				return true;
+			}
+			if (args.size() > 1 && Zeal::String::compare_insensitive(args[1], "on"))
+				set_enabled(true);
+			else if (args.size() > 1 && Zeal::String::compare_insensitive(args[1], "off"))
+				set_enabled(false);
+			else
+				set_enabled(!enabled);
+			Zeal::EqGame::print_chat("Frame profiler is %s", enabled ? "on" : "off");
+			return true;
+		});
+}
+
+FrameProfiler::~FrameProfiler()
+{
+}
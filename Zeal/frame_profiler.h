@@ -0,0 +1,94 @@
+#pragma once
+#include <Windows.h>
+#include <vector>
+#include <string>
+#include "digit_batch.h"
+#include "settings.h"
+
+// the hooks that bracket a frame, in the order they normally fire
+enum class frame_phase
+{
+	main_loop, //start of the frame, game logic until render
+	render,
+	deferred,
+	render_ui,
+	end_scene, //our EndScene callbacks, the present and whatever the driver waits on
+	_count
+};
+
+// qpc timestamps for each phase of the last few thousand frames, drawn as a stacked frame time graph in EndScene
+class FrameProfiler
+{
+public:
+	void mark(frame_phase phase); //first call per frame wins, main_loop closes the previous frame
+	void note_packet(UINT opcode, UINT len); //hitch context, from HandleWorldMessage
+	void note_chat() { if (collecting()) frame_chat_lines++; }
+	void note_input(float latency_ms) { if (collecting() && latency_ms > frame_input_ms) frame_input_ms = latency_ms; } //arrival to the game acting on it
+	void set_enabled(bool on);
+	// brackets zeal's own draw callbacks, fence_gpu waits for the gpu on both ends when gpu_timing is on
+	LONGLONG overlay_begin(IDirect3DDevice8* device, bool fence_gpu); //0 when not collecting
+	void overlay_end(IDirect3DDevice8* device, LONGLONG start, bool fence_gpu);
+	bool collecting() const { return enabled || hitch_reports.get(); }
+	bool enabled = false; //the overlay
+	bool gpu_timing = false; //diagnostic, stalls the frame twice so the overlays' gpu time can be read on the cpu
+	Setting<bool> hitch_reports{ "Zeal", "HitchReports", false }; //writes a context report to crashes\ for frames well over the median
+	FrameProfiler(class ZealService* zeal);
+	~FrameProfiler();
+private:
+	static constexpr int history = 4096;
+	static constexpr int phase_count = static_cast<int>(frame_phase::_count);
+	struct frame_record
+	{
+		float total_ms;
+		float phase_ms[phase_count];
+		float overlay_ms; //cpu time in zeal's draw callbacks
+		float overlay_gpu_ms; //fence to fence around the EndScene callbacks, 0 unless gpu_timing
+		float input_ms; //oldest input's wait before the game acted on it, 0 for frames without input
+	};
+	struct hitch
+	{
+		ULONGLONG tick;
+		frame_record frame;
+	};
+	void close_frame(LONGLONG now);
+	void update_lows();
+	void render();
+	void report_hitches();
+	void report_pacing();
+	bool fence(IDirect3DDevice8* device);
+	void release_fence();
+	void write_hitch_report(const frame_record& record);
+	LONGLONG marks[phase_count] = {}; //qpc of each phase this frame, 0 when it has not fired
+	double ms_per_tick = 0;
+	std::vector<frame_record> frames; //ring of history entries
+	size_t frame_count = 0; //total frames recorded, frames[frame_count % history] is the next slot
+	std::vector<hitch> hitches; //ring of the last few frames well over the recent average
+	size_t hitch_count = 0;
+	std::vector<float> sorted; //scratch for the percentile pass
+	// what happened during the frame being timed, reset when it closes
+	std::vector<std::pair<UINT64, UINT64>> frame_baseline; //profiler calls and cycles when the frame started
+	std::vector<std::pair<UINT64, UINT64>> frame_end;
+	std::vector<std::pair<UINT, UINT>> frame_packets; //opcode, length, capped at max_packets
+	static constexpr size_t max_packets = 64;
+	UINT frame_packet_count = 0;
+	UINT frame_chat_lines = 0;
+	float frame_input_ms = 0;
+	LONGLONG overlay_ticks = 0;
+	LONGLONG overlay_gpu_ticks = 0;
+	IDirect3DSurface8* fence_surface = nullptr; //1x1 system memory copy of the back buffer, locking it waits for the gpu
+	ULONGLONG last_report = 0;
+	ULONGLONG last_lows = 0;
+	float average_ms = 0;
+	float median_ms = 0;
+	float low_1_ms = 0; //99th percentile frame time
+	float low_01_ms = 0; //99.9th percentile frame time
+	float overlay_average_ms = 0;
+	DigitBatch digits;
+	struct vertex
+	{
+		float x, y, z, rhw;
+		D3DCOLOR color;
+	};
+	std::vector<vertex> vertices; //triangle list, reused every frame
+	static void add_quad(std::vector<vertex>& vertices, float left, float top, float right, float bottom, D3DCOLOR color);
+};
@@ -9,33 +9,76 @@
 #include "camera_mods.h"
 #include "looting.h"
 #include "FindPattern.h"
+#include "address_table.h"
 #include "labels.h"
 #include "binds.h"
 #include "raid.h"
 #include "eqstr.h"
 #include "chat.h"
 #include "IO_ini.h"
+#include "settings.h"
 #include "callbacks.h"
+#include "entity_manager.h"
+#include "pet_tracker.h"
+#include "buff_stacking.h"
+#include "navigation.h"
+#include "input_events.h"
 #include "item_display.h"
+#include "window_stack.h"
 #include "melody.h"
 #include "named_pipe.h"
+#include "shared_state.h"
+#include "command_bus.h"
 #include "floating_damage.h"
 #include "directx.h"
 // other features
 #include "cycle_target.h"
 #include "outputfile.h"
+#include "chat_log.h"
+#include "chat_triggers.h"
+#include "chat_router.h"
+#include "chat_history.h"
 #include "experience.h"
 #include "buff_timers.h"
 #include "player_movement.h"
 #include "spellsets.h"
 #include "alarm.h"
 #include "netstat.h"
+#include "packet_capture.h"
 #include "ui_manager.h"
 #include "autofire.h"
 #include "tooltip.h"
 #include "physics.h"
+#include "spell_index.h"
+#include "cast_tracker.h"
+#include "guild_roster.h"
+#include "item_index.h"
+#include "session_stats.h"
+#include "damage_meter.h"
+#include "corpse_drag.h"
+#include "spawn_tracker.h"
+#include "con_cache.h"
+#include "input_history.h"
+#include "frame_profiler.h"
+#include "screenshot.h"
+#include "audio_cues.h"
+#include "packet_governor.h"
+#include "frame_pacer.h"
+#include "zone_warmup.h"
+#include "fast_login.h"
+#include "benchmark.h"
 #include "target_ring.h"
+#include "nameplates.h"
+#include "radar.h"
 #include "crash_handler.h"
+#include "task_pool.h"
+#include "frame_arena.h"
+#include "thread_affinity.h"
+#include "debug_log.h"
+#include "character_store.h"
+#include "config_watch.h"
+#include "memory_report.h"
+#include "plugin_host.h"
 #include "Zeal.h" 
 
 extern HMODULE this_module;
@@ -0,0 +1,111 @@
+#include "game_fixture.h"
+#include "Zeal.h"
+
+static constexpr int raid_slots = 72;
+
+// deterministic, the same population on every run so numbers compare
+static UINT next_random(UINT& state)
+{
+	state = state * 1664525u + 1013904223u;
+	return state >> 8;
+}
+
+void GameFixture::build_zone(int spawns)
+{
+	entities.clear();
+	UINT seed = 12345;
+	for (int i = 0; i < spawns; i++)
+	{
+		auto ent = std::make_unique<Zeal::EqStructures::Entity>();
+		memset(ent.get(), 0, sizeof(Zeal::EqStructures::Entity));
+		ent->SpawnId = static_cast<WORD>(i + 1);
+		ent->Position = Vec3(static_cast<float>(next_random(seed) % 4000) - 2000.f, static_cast<float>(next_random(seed) % 4000) - 2000.f,
+			static_cast<float>(next_random(seed) % 200) - 100.f);
+		ent->Heading = static_cast<float>(next_random(seed) % 512);
+		UINT kind = next_random(seed) % 100;
+		ent->Type = i == 0 || kind < 10 ? 0 : (kind < 15 ? 2 : 1); //a tenth players, a few corpses
+		ent->Level = static_cast<BYTE>(1 + next_random(seed) % 60);
+		ent->HpMax = 100;
+		ent->HpCurrent = next_random(seed) % 101;
+		ent->Height = 6.f;
+		snprintf(ent->Name, sizeof(ent->Name), ent->Type == 0 ? "Player%03i" : "a_gnoll%03i", i);
+		if (i)
+		{
+			ent->Prev = entities.back().get();
+			entities.back()->Next = ent.get();
+		}
+		entities.push_back(std::move(ent));
+	}
+	if (char_info && !entities.empty())
+		entities[0]->CharInfo = char_info.get();
+}
+
+void GameFixture::build_raid(int members)
+{
+	raid.assign(raid_slots, Zeal::EqStructures::RaidMember{});
+	for (int i = 0; i < members && i < raid_slots; i++)
+	{
+		Zeal::EqStructures::RaidMember& member = raid[i];
+		snprintf(member.Name, sizeof(member.Name), "Raider%02i", i);
+		snprintf(member.Class, sizeof(member.Class), "Warrior");
+		member.GroupNumber = i / 6;
+		member.IsGroupLeader = i % 6 == 0;
+	}
+}
+
+void GameFixture::build_inventory()
+{
+	items.clear();
+	char_info = std::make_unique<Zeal::EqStructures::EQCHARINFO>();
+	memset(char_info.get(), 0, sizeof(Zeal::EqStructures::EQCHARINFO));
+	auto make_item = [this](const char* name, BYTE type) {
+		auto item = std::make_unique<Zeal::EqStructures::EQITEMINFO>();
+		memset(item.get(), 0, sizeof(Zeal::EqStructures::EQITEMINFO));
+		snprintf(item->Name, sizeof(item->Name), "%s", name);
+		item->Type = type;
+		item->ID = static_cast<WORD>(1000 + items.size());
+		items.push_back(std::move(item));
+		return items.back().get();
+	};
+	for (int slot = 0; slot < EQ_NUM_INVENTORY_SLOTS; slot++)
+	{
+		char name[32];
+		snprintf(name, sizeof(name), "Fixture Item %02i", slot);
+		char_info->InventoryItem[slot] = make_item(name, 0);
+	}
+	for (int i = 0; i < EQ_NUM_CONTAINER_SLOTS; i++)
+	{
+		char name[32];
+		snprintf(name, sizeof(name), "Fixture Bag %02i", i);
+		Zeal::EqStructures::EQITEMINFO* bag = make_item(name, 1);
+		bag->Container.Capacity = EQ_NUM_CONTAINER_SLOTS;
+		for (int j = 0; j < EQ_NUM_CONTAINER_SLOTS; j++)
+			bag->Container.Item[j] = make_item("Fixture Stack", 0);
+	}
+	if (!entities.empty())
+		entities[0]->CharInfo = char_info.get();
+}
+
+GameFixture::scope::scope(GameFixture& fixture) : previous(Zeal::EqGame::installed_view)
+{
+	if (fixture.raid.size() != raid_slots)
+		fixture.raid.assign(raid_slots, Zeal::EqStructures::RaidMember{}); //no raid built, an empty one rather than the live slots
+	short members = 0;
+	for (auto& member : fixture.raid)
+		members += member.Name[0] != '\0';
+	Zeal::EqStructures::Entity* fixture_self = fixture.spawn(0);
+	view = { fixture_self, fixture.spawn(1), fixture_self, fixture_self, fixture.char_info.get(), fixture.raid.data(), members, 0 };
+	Zeal::EqGame::set_state_view(&view);
+	// the caches over those accessors rebuild from the fixture on their next use
+	ZealService* zeal = ZealService::get_instance();
+	zeal->entity_manager->invalidate();
+	zeal->raid_hook->invalidate();
+}
+
+GameFixture::scope::~scope()
+{
+	Zeal::EqGame::set_state_view(previous);
+	ZealService* zeal = ZealService::get_instance();
+	zeal->entity_manager->invalidate();
+	zeal->raid_hook->invalidate();
+}
@@ -0,0 +1,34 @@
+#pragma once
+#include <memory>
+#include <vector>
+#include "EqStructures.h"
+#include "EqFunctions.h"
+
+// fabricated game state with the real struct layouts, a populated zone, a raid and a full inventory, for timing the entity
+// heavy paths with a known population. while a GameFixture::scope is alive, Zeal::EqGame's accessors (self, target,
+// controlled, the spawn list, char info and the raid slots) and the caches over them read the fixture, on the thread that
+// opened the scope only. the client's globals are never touched, so the game and zeal's other threads carry on unaffected
+class GameFixture
+{
+public:
+	void build_zone(int spawns); //spawn 1 is self, the rest mostly npcs with some players and corpses
+	void build_raid(int members);
+	void build_inventory(); //every inventory slot filled, bags packed full
+	bool empty() const { return entities.empty(); }
+	Zeal::EqStructures::Entity* spawn(size_t i) { return i < entities.size() ? entities[i].get() : nullptr; }
+	size_t spawn_count() const { return entities.size(); }
+	class scope
+	{
+	public:
+		scope(GameFixture& fixture);
+		~scope();
+	private:
+		Zeal::EqGame::state_view view;
+		Zeal::EqGame::state_view* previous;
+	};
+private:
+	std::vector<std::unique_ptr<Zeal::EqStructures::Entity>> entities;
+	std::vector<Zeal::EqStructures::RaidMember> raid;
+	std::unique_ptr<Zeal::EqStructures::EQCHARINFO> char_info;
+	std::vector<std::unique_ptr<Zeal::EqStructures::EQITEMINFO>> items;
+};
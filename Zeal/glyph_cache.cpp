@@ -0,0 +1,151 @@
+#include "glyph_cache.h"
+
+static constexpr int atlas_width = 256;
+static constexpr int glyph_total = GlyphAtlas::last_char - GlyphAtlas::first_char + 1;
+
+static int next_pow2(int v)
+{
+	int p = 1;
+	while (p < v)
+		p <<= 1;
+	return p;
+}
+
+float GlyphAtlas::measure(const char* text) const
+{
+	float width = 0;
+	for (; *text; text++)
+		if (const glyph* g = find(*text))
+			width += g->width;
+	return width;
+}
+
+bool GlyphAtlas::build(IDirect3DDevice8* device, const char* face, int pixel_height, bool bold)
+{
+	release();
+	HDC dc = CreateCompatibleDC(NULL);
+	if (!dc)
+		return false;
+	HFONT font = CreateFontA(-pixel_height, 0, 0, 0, bold ? FW_BOLD : FW_NORMAL, FALSE, FALSE, FALSE, ANSI_CHARSET, OUT_DEFAULT_PRECIS, CLIP_DEFAULT_PRECIS,
+		ANTIALIASED_QUALITY, DEFAULT_PITCH, face);
+	HGDIOBJ old_font = SelectObject(dc, font);
+	// shelf layout, a texel of padding around each glyph so point sampling never bleeds
+	int row_height = pixel_height + 2;
+	int widths[glyph_total];
+	int x = 1, rows = 1;
+	for (int i = 0; i < glyph_total; i++)
+	{
+		char c = static_cast<char>(first_char + i);
+		SIZE size = { 0, 0 };
+		GetTextExtentPoint32A(dc, &c, 1, &size);
+		widths[i] = size.cx < atlas_width - 2 ? size.cx : atlas_width - 2;
+		if (x + widths[i] + 1 > atlas_width)
+		{
+			x = 1;
+			rows++;
+		}
+		x += widths[i] + 1;
+	}
+	int texture_height = next_pow2(rows * row_height);
+
+	BITMAPINFO bmi = {};
+	bmi.bmiHeader.biSize = sizeof(BITMAPINFOHEADER);
+	bmi.bmiHeader.biWidth = atlas_width;
+	bmi.bmiHeader.biHeight = -texture_height; //top down
+	bmi.bmiHeader.biPlanes = 1;
+	bmi.bmiHeader.biBitCount = 32;
+	bmi.bmiHeader.biCompression = BI_RGB;
+	void* bits = nullptr;
+	HBITMAP bitmap = CreateDIBSection(dc, &bmi, DIB_RGB_COLORS, &bits, NULL, 0);
+	bool ok = font && bitmap && bits;
+	if (ok)
+	{
+		HGDIOBJ old_bitmap = SelectObject(dc, bitmap);
+		memset(bits, 0, atlas_width * texture_height * 4);
+		SetTextColor(dc, RGB(255, 255, 255));
+		SetBkColor(dc, RGB(0, 0, 0));
+		SetBkMode(dc, OPAQUE);
+		x = 1;
+		int y = 0;
+		for (int i = 0; i < glyph_total; i++)
+		{
+			if (x + widths[i] + 1 > atlas_width)
+			{
+				x = 1;
+				y += row_height;
+			}
+			char c = static_cast<char>(first_char + i);
+			TextOutA(dc, x, y + 1, &c, 1);
+			glyphs[i] = { (float)x / atlas_width, (float)y / texture_height, (float)(x + widths[i]) / atlas_width,
+				(float)(y + pixel_height + 1) / texture_height, (float)widths[i] };
+			x += widths[i] + 1;
+		}
+		GdiFlush();
+		ok = SUCCEEDED(device->CreateTexture(atlas_width, texture_height, 1, 0, D3DFMT_A8R8G8B8, D3DPOOL_MANAGED, &texture));
+		D3DLOCKED_RECT rect;
+		if (ok && SUCCEEDED(texture->LockRect(0, &rect, NULL, 0)))
+		{
+			//white glyphs, the gdi coverage becomes the alpha channel
+			for (int py = 0; py < texture_height; py++)
+			{
+				const DWORD* src = (const DWORD*)bits + py * atlas_width;
+				DWORD* dest = (DWORD*)((BYTE*)rect.pBits + py * rect.Pitch);
+				for (int px = 0; px < atlas_width; px++)
+					dest[px] = ((src[px] & 0xFF) << 24) | 0x00FFFFFF;
+			}
+			texture->UnlockRect(0);
+		}
+		else if (ok)
+			ok = false;
+		SelectObject(dc, old_bitmap);
+	}
+	if (bitmap)
+		DeleteObject(bitmap);
+	SelectObject(dc, old_font);
+	if (font)
+		DeleteObject(font);
+	DeleteDC(dc);
+	if (!ok)
+	{
+		release();
+		return false;
+	}
+	line_height = (float)(pixel_height + 1);
+	return true;
+}
+
+void GlyphAtlas::release()
+{
+	if (texture)
+		texture->Release();
+	texture = nullptr;
+}
+
+const GlyphAtlas* GlyphCache::get(IDirect3DDevice8* device, const char* face, int pixel_height, bool bold)
+{
+	if (!device || pixel_height <= 0 || !face)
+		return nullptr;
+	if (device != cache_device)
+	{
+		release();
+		cache_device = device;
+	}
+	std::string key = std::string(face) + "|" + std::to_string(pixel_height) + (bold ? "b" : "");
+	auto it = atlases.find(key);
+	if (it == atlases.end())
+	{
+		std::unique_ptr<GlyphAtlas> atlas = std::make_unique<GlyphAtlas>();
+		atlas->build(device, face, pixel_height, bold);
+		it = atlases.emplace(key, std::move(atlas)).first;
+	}
+	return it->second->texture ? it->second.get() : nullptr;
+}
+
+void GlyphCache::release()
+{
+	for (auto& atlas : atlases)
+		atlas.second->release();
+	atlases.clear();
+	cache_device = nullptr;
+	generation++;
+}
@@ -0,0 +1,40 @@
+#pragma once
+#include <Windows.h>
+#include <string>
+#include <memory>
+#include <unordered_map>
+#include "d3dx8/d3d8.h"
+
+// printable ascii of one gdi font rendered once into a texture, white with the coverage in alpha so vertex colors tint it
+class GlyphAtlas
+{
+public:
+	struct glyph
+	{
+		float u0, v0, u1, v1;
+		float width; //pixels, the advance and the quad width
+	};
+	static constexpr char first_char = 32;
+	static constexpr char last_char = 126;
+	const glyph* find(char c) const { return c >= first_char && c <= last_char ? &glyphs[c - first_char] : nullptr; }
+	float measure(const char* text) const;
+	bool build(IDirect3DDevice8* device, const char* face, int pixel_height, bool bold);
+	void release();
+	IDirect3DTexture8* texture = nullptr;
+	float line_height = 0; //quad height in pixels
+private:
+	glyph glyphs[last_char - first_char + 1] = {};
+};
+
+// atlases shared by every overlay, one per face, size and weight, built on first use and dropped before a device reset;
+// pointers from get() stay valid until release(), generation tells holders when that happened
+class GlyphCache
+{
+public:
+	const GlyphAtlas* get(IDirect3DDevice8* device, const char* face, int pixel_height, bool bold = true); //nullptr if it can't be built
+	void release();
+	UINT generation = 0;
+private:
+	IDirect3DDevice8* cache_device = nullptr;
+	std::unordered_map<std::string, std::unique_ptr<GlyphAtlas>> atlases; //failed builds stay as empty atlases so they aren't retried every frame
+};
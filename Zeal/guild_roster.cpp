@@ -0,0 +1,258 @@
+#include "guild_roster.h"
+#include "Zeal.h"
+#include "string_util.h"
+#include <algorithm>
+#include <ctime>
+
+static std::string lower(const char* text, size_t len)
+{
+	std::string out(text, len);
+	std::transform(out.begin(), out.end(), out.begin(), [](char c) { return (char)tolower((unsigned char)c); });
+	return out;
+}
+
+std::string GuildRoster::guild_name() const
+{
+	Zeal::EqStructures::Entity* self = Zeal::EqGame::get_self();
+	return self ? Zeal::EqGame::guild_name(self->GuildId) : "";
+}
+
+void GuildRoster::index_guilds()
+{
+	guild_index.clear();
+	guild_index_time = GetTickCount64();
+	for (int id = 0; id < Zeal::EqGame::max_guilds; id++)
+	{
+		const char* name = Zeal::EqGame::guild_names->name[id];
+		size_t len = strnlen(name, sizeof(Zeal::EqGame::guild_names->name[id]));
+		if (len)
+			guild_index.emplace(lower(name, len), static_cast<UINT16>(id));
+	}
+}
+
+int GuildRoster::guild_id(const std::string& name)
+{
+	std::string key = lower(name.c_str(), name.size());
+	auto it = guild_index.find(key);
+	if (it == guild_index.end() && GetTickCount64() - guild_index_time >= 1000)
+	{
+		index_guilds();
+		it = guild_index.find(key);
+	}
+	return it != guild_index.end() ? it->second : -1;
+}
+
+size_t GuildRoster::member(const char* name, size_t len)
+{
+	std::string key = lower(name, len);
+	auto it = name_index.find(key);
+	if (it != name_index.end())
+		return it->second;
+	roster.push_back({});
+	guild_member& m = roster.back();
+	memcpy(m.name, name, len < sizeof(m.name) - 1 ? len : sizeof(m.name) - 1);
+	UINT16 index = (UINT16)(roster.size() - 1);
+	name_index[key] = index;
+	zone_members[0].push_back(index);
+	return index;
+}
+
+UINT16 GuildRoster::intern_zone(const std::string& name)
+{
+	std::string key = lower(name.c_str(), name.size());
+	auto it = zone_index.find(key);
+	if (it != zone_index.end())
+		return it->second;
+	zone_names.push_back(name);
+	zone_members.push_back({});
+	UINT16 zone = (UINT16)(zone_names.size() - 1);
+	zone_index[key] = zone;
+	return zone;
+}
+
+void GuildRoster::set_zone(size_t index, UINT16 zone)
+{
+	guild_member& m = roster[index];
+	if (m.zone == zone)
+		return;
+	std::vector<UINT16>& from = zone_members[m.zone];
+	auto it = std::find(from.begin(), from.end(), (UINT16)index);
+	if (it != from.end())
+	{
+		*it = from.back();
+		from.pop_back();
+	}
+	zone_members[zone].push_back((UINT16)index);
+	m.zone = zone;
+}
+
+// [60 Warlord] Name (Iksar) <Guild> ZONE: cabeast LFG, or [ANONYMOUS] Name <Guild>
+void GuildRoster::note_chat(const char* text)
+{
+	while (*text == ' ')
+		text++;
+	if (*text != '[')
+		return;
+	const char* close = strchr(text, ']');
+	const char* guild_open = close ? strchr(close, '<') : nullptr;
+	const char* guild_close = guild_open ? strchr(guild_open, '>') : nullptr;
+	if (!guild_close)
+		return;
+	std::string ours = guild_name();
+	if (ours.empty() || ours.length() != (size_t)(guild_close - guild_open - 1) || _strnicmp(ours.c_str(), guild_open + 1, ours.length()))
+		return;
+	const char* name = close + 1;
+	while (*name == ' ')
+		name++;
+	size_t name_len = strcspn(name, " (<");
+	if (!name_len || name + name_len > guild_open)
+		return;
+
+	size_t index = member(name, name_len);
+	guild_member& m = roster[index];
+	std::string bracket(text + 1, close);
+	if (bracket == "ANONYMOUS")
+		m.flags |= member_anonymous;
+	else
+	{
+		char* class_start = nullptr;
+		long level = strtol(bracket.c_str(), &class_start, 10);
+		while (class_start && *class_start == ' ')
+			class_start++;
+		m.flags &= ~member_anonymous;
+		m.level = (UINT8)(level > 0 && level < 256 ? level : m.level);
+		if (class_start && *class_start)
+			strncpy_s(m.class_name, class_start, _TRUNCATE);
+	}
+	if (strstr(guild_close, " LFG"))
+		m.flags |= member_lfg;
+	else
+		m.flags &= ~member_lfg;
+	const char* zone = strstr(guild_close, "ZONE: ");
+	if (zone)
+	{
+		zone += 6;
+		UINT16 atom = intern_zone(std::string(zone, strcspn(zone, " ")));
+		set_zone(index, atom);
+		Zeal::EqStructures::Entity* self = Zeal::EqGame::get_self();
+		if (self && (m.flags & member_in_zone))
+			zone_by_id[self->ZoneId] = atom;
+	}
+	m.last_on = (UINT32)time(nullptr);
+	if (on_change)
+		on_change(index);
+}
+
+void GuildRoster::on_entity(const entity_event& e)
+{
+	if (e.type == entity_event_type::despawned)
+	{
+		auto it = spawn_members.find(e.spawn_id);
+		if (it == spawn_members.end())
+			return;
+		roster[it->second].flags &= ~member_in_zone;
+		roster[it->second].last_on = (UINT32)time(nullptr);
+		size_t index = it->second;
+		spawn_members.erase(it);
+		if (on_change)
+			on_change(index);
+		return;
+	}
+	Zeal::EqStructures::Entity* self = Zeal::EqGame::get_self();
+	Zeal::EqStructures::Entity* ent = e.ent;
+	if (!ent || !self || ent->Type != Zeal::EqEnums::EntityTypes::Player || ent->GuildId != self->GuildId || self->GuildId >= 512)
+		return;
+	size_t index = member(ent->Name, strnlen(ent->Name, sizeof(ent->Name)));
+	guild_member& m = roster[index];
+	m.level = ent->Level;
+	strncpy_s(m.class_name, Zeal::EqGame::class_name_view(ent->Class).data(), _TRUNCATE);
+	m.flags |= member_in_zone;
+	m.last_on = (UINT32)time(nullptr);
+	auto zone = zone_by_id.find(self->ZoneId);
+	if (zone != zone_by_id.end())
+		set_zone(index, zone->second);
+	spawn_members[e.spawn_id] = (UINT16)index;
+	if (on_change)
+		on_change(index);
+}
+
+const guild_member* GuildRoster::find(const std::string& name) const
+{
+	auto it = name_index.find(lower(name.c_str(), name.size()));
+	return it != name_index.end() ? &roster[it->second] : nullptr;
+}
+
+const std::vector<UINT16>& GuildRoster::in_zone(const std::string& zone) const
+{
+	auto it = zone_index.find(lower(zone.c_str(), zone.size()));
+	return zone_members[it != zone_index.end() ? it->second : 0];
+}
+
+void GuildRoster::print(const guild_member& m) const
+{
+	UINT32 ago = (UINT32)time(nullptr) - m.last_on;
+	const char* zone = m.zone ? zone_name(m.zone) : "unknown zone";
+	if (m.flags & member_anonymous)
+		Zeal::EqGame::print_chat("%s: anonymous, %s%s, seen %um ago", m.name, zone, m.flags & member_in_zone ? " (here)" : "", ago / 60);
+	else
+		Zeal::EqGame::print_chat("%s: %u %s, %s%s%s, seen %um ago", m.name, m.level, m.class_name, zone, m.flags & member_in_zone ? " (here)" : "",
+			m.flags & member_lfg ? " LFG" : "", ago / 60);
+}
+
+GuildRoster::GuildRoster(ZealService* zeal)
+{
+	zeal->memory_report->add("guild roster", [this]() {
+		Zeal::Memory::usage use{ Zeal::Memory::vector_bytes(roster) + Zeal::Memory::hash_bytes(name_index) + Zeal::Memory::vector_bytes(zone_names) + Zeal::Memory::hash_bytes(zone_index)
+			+ Zeal::Memory::vector_bytes(zone_members) + Zeal::Memory::hash_bytes(zone_by_id) + Zeal::Memory::hash_bytes(spawn_members) + Zeal::Memory::hash_bytes(guild_index), roster.size() };
+		for (const auto& [name, index] : name_index)
+			use.bytes += Zeal::Memory::string_bytes(name);
+		for (const auto& members : zone_members)
+			use.bytes += Zeal::Memory::vector_bytes(members);
+		return use;
+	});
+	constexpr UINT32 mask = (1u << (int)entity_event_type::spawned) | (1u << (int)entity_event_type::despawned) | (1u << (int)entity_event_type::level_changed);
+	entity_subscription = zeal->entity_manager->subscribe([this](const entity_event& e) { on_entity(e); }, mask);
+	zeal->callbacks->add_generic([this]() {
+		for (auto& [spawn_id, index] : spawn_members)
+			roster[index].flags &= ~member_in_zone;
+		spawn_members.clear();
+		guild_index.clear();
+		guild_index_time = 0; //next guild_id rebuilds from the list that came with this zone
+	}, callback_type::Zone);
+	zeal->commands_hook->add("/groster", {}, "Guild members seen in /who guild replies and in zone, /groster [name] | zone <zone> | here.",
+		[this](std::vector<std::string>& args) {
+			if (args.size() > 2 && Zeal::String::compare_insensitive(args[1], "zone"))
+			{
+				const std::vector<UINT16>& members = in_zone(args[2]);
+				if (!members.size() || !zone_index.count(lower(args[2].c_str(), args[2].size())))
+					Zeal::EqGame::print_chat("No guild members known in %s", args[2].c_str());
+				for (UINT16 index : members)
+					print(roster[index]);
+			}
+			else if (args.size() > 1 && Zeal::String::compare_insensitive(args[1], "here"))
+			{
+				for (auto& [spawn_id, index] : spawn_members)
+					print(roster[index]);
+			}
+			else if (args.size() > 1)
+			{
+				const guild_member* m = find(args[1]);
+				if (m)
+					print(*m);
+				else
+					Zeal::EqGame::print_chat("%s isn't in the guild roster, /who all guild refreshes it", args[1].c_str());
+			}
+			else
+			{
+				size_t zones = 0;
+				for (size_t zone = 1; zone < zone_members.size(); ++zone)
+					zones += zone_members[zone].size() ? 1 : 0;
+				Zeal::EqGame::print_chat("%u guild members known, %u spawned here, across %u zones", (UINT)roster.size(), (UINT)spawn_members.size(), (UINT)zones);
+			}
+			return true;
+		});
+}
+
+GuildRoster::~GuildRoster()
+{
+}
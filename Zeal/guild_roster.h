@@ -0,0 +1,57 @@
+#pragma once
+#include <Windows.h>
+#include <functional>
+#include <string>
+#include <unordered_map>
+#include <vector>
+#include "entity_manager.h"
+
+// members of our guild as seen in /who replies and in the zone, kept as packed records indexed by name and by zone
+// the server sends no roster packet to this client, so the /who guild text is the roster feed and spawns refresh what is in view
+#pragma pack(push, 1)
+struct guild_member
+{
+	char name[24];
+	char class_name[24]; //as /who shows it, titles included
+	UINT8 level; //0 when anonymous
+	UINT8 flags;
+	UINT16 zone; //index into GuildRoster::zone_name, 0 unknown
+	UINT32 last_on; //unix time last listed or seen
+};
+#pragma pack(pop)
+
+class GuildRoster
+{
+public:
+	static constexpr UINT8 member_anonymous = 1;
+	static constexpr UINT8 member_lfg = 2;
+	static constexpr UINT8 member_in_zone = 4; //spawned near us right now
+	void note_chat(const char* text); //PrintChat, picks up /who lines of our guild
+	const guild_member* find(const std::string& name) const;
+	const std::vector<UINT16>& in_zone(const std::string& zone) const;
+	const std::vector<guild_member>& members() const { return roster; }
+	const char* zone_name(UINT16 zone) const { return zone < zone_names.size() ? zone_names[zone].c_str() : ""; }
+	int guild_id(const std::string& name); //-1 when no guild has that name, case insensitive
+	std::function<void(size_t index)> on_change; //a member was added or changed, index into members()
+	GuildRoster(class ZealService* zeal);
+	~GuildRoster();
+private:
+	size_t member(const char* name, size_t len); //finds or adds
+	void set_zone(size_t index, UINT16 zone);
+	UINT16 intern_zone(const std::string& name);
+	void on_entity(const entity_event& e);
+	void print(const guild_member& m) const;
+	std::string guild_name() const;
+	std::vector<guild_member> roster;
+	std::unordered_map<std::string, UINT16> name_index; //lower case name -> roster index
+	std::vector<std::string> zone_names{ "" };
+	std::unordered_map<std::string, UINT16> zone_index;
+	std::vector<std::vector<UINT16>> zone_members{ {} }; //zone -> roster indexes
+	std::unordered_map<DWORD, UINT16> zone_by_id; //learned when a /who line names the zone of someone spawned here
+	std::unordered_map<WORD, UINT16> spawn_members; //spawn id -> roster index for members spawned in this zone
+	UINT entity_subscription = 0;
+	// the client's guild list indexed by name, rebuilt on zone (the list arrives with zone entry) and on a miss at most once a second
+	void index_guilds();
+	std::unordered_map<std::string, UINT16> guild_index; //lower case name -> guild id
+	ULONGLONG guild_index_time = 0;
+};
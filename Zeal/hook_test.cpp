@@ -0,0 +1,153 @@
+#include "hook_test.h"
+#include "hook_wrapper.h"
+#include "EqFunctions.h"
+#include <stdio.h>
+
+namespace Zeal
+{
+	namespace HookTest
+	{
+		typedef int(__cdecl* cdecl_fn)(int);
+		typedef int(__fastcall* fastcall_fn)(int);
+
+		//synthetic functions, each starts with a different kind of prologue
+		static const BYTE plain_code[] = { 0x55, 0x8B, 0xEC, 0x8B, 0x45, 0x08, 0x83, 0xC0, 0x01, 0x5D, 0xC3 }; //push ebp; mov ebp,esp; mov eax,[ebp+8]; add eax,1; pop ebp; ret -> x+1
+		static const BYTE helper_code[] = { 0xB8, 0x29, 0x00, 0x00, 0x00, 0xC3 }; //mov eax,41; ret
+		static const BYTE call_code[] = { 0xE8, 0, 0, 0, 0, 0x03, 0x44, 0x24, 0x04, 0xC3 }; //call helper; add eax,[esp+4]; ret -> x+41
+		static const BYTE branch_code[] = { 0x85, 0xC9, 0x74, 0x05, 0x8B, 0xC1, 0x40, 0xC3, 0xCC, 0x33, 0xC0, 0x48, 0xC3 }; //fastcall: x ? x+1 : -1, the je is in the stolen bytes
+		static const BYTE caller_code[] = { 0xFF, 0x74, 0x24, 0x04, 0xE8, 0, 0, 0, 0, 0x83, 0xC4, 0x04, 0xC3 }; //push [esp+4]; call plain; add esp,4; ret
+
+		struct scratch
+		{
+			BYTE* plain;
+			BYTE* helper;
+			BYTE* call;
+			BYTE* branch;
+			BYTE* caller;
+			int vtable[2];
+		};
+		static scratch code;
+
+		static hook* active = nullptr;
+		static int __cdecl plain_detour(int x) { return ((cdecl_fn)active->trampoline)(x) * 2; }
+		static int __cdecl call_detour(int x) { return ((cdecl_fn)active->trampoline)(x) * 2; }
+		static int __fastcall branch_detour(int x) { return ((fastcall_fn)active->trampoline)(x) * 2; }
+		static int __cdecl replaced_call(int x) { return ((cdecl_fn)active->trampoline)(x) * 2; }
+		static int __cdecl vtable_detour(int x) { return ((cdecl_fn)active->trampoline)(x) * 2; }
+
+		static BYTE* emit(BYTE*& cursor, const BYTE* bytes, size_t size)
+		{
+			BYTE* start = cursor;
+			memcpy(cursor, bytes, size);
+			cursor += (size + 15) & ~15;
+			return start;
+		}
+
+		static void build(BYTE* memory)
+		{
+			BYTE* cursor = memory;
+			code.plain = emit(cursor, plain_code, sizeof(plain_code));
+			code.helper = emit(cursor, helper_code, sizeof(helper_code));
+			code.call = emit(cursor, call_code, sizeof(call_code));
+			code.branch = emit(cursor, branch_code, sizeof(branch_code));
+			code.caller = emit(cursor, caller_code, sizeof(caller_code));
+			*(int*)(code.call + 1) = (int)code.helper - ((int)code.call + 5);
+			*(int*)(code.caller + 5) = (int)code.plain - ((int)code.caller + 9);
+			code.vtable[0] = 0;
+			code.vtable[1] = (int)code.plain;
+		}
+
+		static double ns_per_call(std::function<int(int)> fn, int iterations)
+		{
+			LARGE_INTEGER f, a, b;
+			QueryPerformanceFrequency(&f);
+			volatile int sink = 0;
+			QueryPerformanceCounter(&a);
+			for (int i = 0; i < iterations; i++)
+				sink += fn(i);
+			QueryPerformanceCounter(&b);
+			return (b.QuadPart - a.QuadPart) * 1e9 / f.QuadPart / iterations;
+		}
+
+		struct test_case
+		{
+			const char* name;
+			hook_type_ type;
+			std::function<int()> target; //address the hook goes on
+			std::function<int()> replacement;
+			std::function<int(int)> call; //invokes the synthetic function the way the game would
+			std::function<int(int)> expected; //unhooked result
+			int input;
+		};
+
+		bool run(bool benchmark, std::vector<std::string>& report)
+		{
+			BYTE* memory = (BYTE*)VirtualAlloc(nullptr, 4096, MEM_COMMIT | MEM_RESERVE, PAGE_EXECUTE_READWRITE);
+			if (!memory)
+			{
+				report.push_back("VirtualAlloc failed");
+				return false;
+			}
+			build(memory);
+			FlushInstructionCache(GetCurrentProcess(), memory, 4096);
+
+			test_case cases[] = {
+				{ "detour plain prologue", hook_type_detour, [] { return (int)code.plain; }, [] { return (int)plain_detour; },
+					[](int x) { return ((cdecl_fn)code.plain)(x); }, [](int x) { return x + 1; }, 5 },
+				{ "detour call prologue", hook_type_detour, [] { return (int)code.call; }, [] { return (int)call_detour; },
+					[](int x) { return ((cdecl_fn)code.call)(x); }, [](int x) { return x + 41; }, 5 },
+				{ "detour branch prologue", hook_type_detour, [] { return (int)code.branch; }, [] { return (int)branch_detour; },
+					[](int x) { return ((fastcall_fn)code.branch)(x); }, [](int x) { return x ? x + 1 : -1; }, 0 },
+				{ "replace call", hook_type_replace_call, [] { return (int)code.caller + 4; }, [] { return (int)replaced_call; },
+					[](int x) { return ((cdecl_fn)code.caller)(x); }, [](int x) { return x + 1; }, 5 },
+				{ "vtable", hook_type_vtable, [] { return (int)&code.vtable[1]; }, [] { return (int)vtable_detour; },
+					[](int x) { return ((cdecl_fn)code.vtable[1])(x); }, [](int x) { return x + 1; }, 5 },
+			};
+
+			bool all_passed = true;
+			const int iterations = 1000000;
+			for (auto& c : cases)
+			{
+				char line[256];
+				int target = c.target();
+				double base_ns = benchmark ? ns_per_call(c.call, iterations) : 0;
+				int byte_count = c.type == hook_type_vtable ? 4 : HookWrapper::stolen_bytes(target);
+				if (!byte_count)
+				{
+					snprintf(line, sizeof(line), "%s: FAIL (prologue not decodable)", c.name);
+					report.push_back(line);
+					all_passed = false;
+					continue;
+				}
+				active = new hook(target, c.replacement(), c.type, byte_count);
+				FlushInstructionCache(GetCurrentProcess(), memory, 4096);
+				bool hooked = c.call(c.input) == c.expected(c.input) * 2;
+				//both branches of the relocated je have to survive
+				if (c.type == hook_type_detour && c.input == 0)
+					hooked = hooked && c.call(7) == c.expected(7) * 2;
+				double hooked_ns = benchmark ? ns_per_call(c.call, iterations) : 0;
+				active->remove();
+				FlushInstructionCache(GetCurrentProcess(), memory, 4096);
+				bool removed = c.call(c.input) == c.expected(c.input);
+				active->rehook();
+				FlushInstructionCache(GetCurrentProcess(), memory, 4096);
+				bool rehooked = c.call(c.input) == c.expected(c.input) * 2;
+				delete active; //removes
+				active = nullptr;
+				FlushInstructionCache(GetCurrentProcess(), memory, 4096);
+				bool restored = c.call(c.input) == c.expected(c.input);
+				bool passed = hooked && removed && rehooked && restored;
+				all_passed &= passed;
+				if (benchmark)
+					snprintf(line, sizeof(line), "%s: %s (hook %s, remove %s, rehook %s, restore %s) %.2fns -> %.2fns per call",
+						c.name, passed ? "pass" : "FAIL", hooked ? "ok" : "bad", removed ? "ok" : "bad", rehooked ? "ok" : "bad", restored ? "ok" : "bad", base_ns, hooked_ns);
+				else
+					snprintf(line, sizeof(line), "%s: %s (hook %s, remove %s, rehook %s, restore %s)",
+						c.name, passed ? "pass" : "FAIL", hooked ? "ok" : "bad", removed ? "ok" : "bad", rehooked ? "ok" : "bad", restored ? "ok" : "bad");
+				report.push_back(line);
+			}
+			VirtualFree(memory, 0, MEM_RELEASE);
+			return all_passed;
+		}
+	}
+}
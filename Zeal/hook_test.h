@@ -0,0 +1,13 @@
+#pragma once
+#include <string>
+#include <vector>
+
+// installs every hook type on synthetic functions in scratch memory, checks install/remove/rehook round trips and
+// times the per call cost of each, results are returned as printable lines
+namespace Zeal
+{
+	namespace HookTest
+	{
+		bool run(bool benchmark, std::vector<std::string>& report);
+	}
+}
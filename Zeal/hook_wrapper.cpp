@@ -14,14 +14,86 @@ void hook::replace(int addr, int dest)
 		destination = (DWORD)dest;
 		address = (DWORD)addr;
 		trampoline = mem::instruction_to_absolute_address(addr);
-		DWORD old;
-		VirtualProtect((LPVOID)addr, 0x5, PAGE_EXECUTE_READWRITE, &old);
 		memcpy(original_bytes, (LPVOID)addr, 5);
-		*(DWORD*)(addr + 1) = dest - addr - 5;
-		VirtualProtect((LPVOID)addr, 0x5, old, NULL);
+		mem::write<int>(addr + 1, dest - addr - 5);
 	}
 }
 
+void hook::decode_prologue()
+{
+	prologue.clear();
+	for (int in = 0; in < orig_byte_count;)
+	{
+		Zeal::X86::instruction ins;
+		if (!Zeal::X86::decode(original_bytes + in, ins) || in + ins.length > orig_byte_count)
+		{
+			//copied as is, it was stolen without being understood
+			ins = {};
+			ins.length = static_cast<BYTE>(orig_byte_count - in);
+		}
+		prologue.push_back(ins);
+		in += ins.length;
+	}
+}
+
+// copies the stolen instructions into the trampoline, re-targeting relative branches and calls so they still reach
+// their original destinations; short branches are widened to rel32 since the trampoline can be far from the game code,
+// loop/jecxz have no wide form so they hop over a short jmp onto a near one
+// (a short branch into the stolen bytes themselves is not handled, game prologues don't do that)
+static int relocate_instructions(const std::vector<Zeal::X86::instruction>& prologue, const BYTE* src, int src_addr, BYTE* dst)
+{
+	int in = 0, out = 0;
+	for (const Zeal::X86::instruction& decoded : prologue)
+	{
+		const BYTE* ins = src + in;
+		const BYTE* op = ins + decoded.opcode;
+		int dst_addr = (int)dst + out;
+		int next = src_addr + in + decoded.length;
+		if (decoded.relative == Zeal::X86::branch::rel32)
+		{
+			int target = next + *(int*)(ins + decoded.displacement);
+			memcpy(dst + out, ins, decoded.displacement);
+			out += decoded.displacement;
+			*(int*)(dst + out) = target - (dst_addr + decoded.displacement + 4);
+			out += 4;
+		}
+		else if (decoded.relative == Zeal::X86::branch::rel8 && *op == 0xEB)
+		{
+			int target = next + (signed char)ins[decoded.displacement];
+			dst[out] = 0xE9;
+			*(int*)(dst + out + 1) = target - (dst_addr + 5);
+			out += 5;
+		}
+		else if (decoded.relative == Zeal::X86::branch::rel8)
+		{
+			int target = next + (signed char)ins[decoded.displacement];
+			dst[out] = 0x0F;
+			dst[out + 1] = 0x80 | (*op & 0x0F);
+			*(int*)(dst + out + 2) = target - (dst_addr + 6);
+			out += 6;
+		}
+		else if (decoded.relative == Zeal::X86::branch::loop)
+		{
+			int target = next + (signed char)ins[decoded.displacement];
+			memcpy(dst + out, ins, decoded.displacement);
+			out += decoded.displacement;
+			dst[out++] = 2; //taken: over the jmp short onto the jmp near
+			dst[out++] = 0xEB;
+			dst[out++] = 5;
+			dst[out] = 0xE9;
+			*(int*)(dst + out + 1) = target - ((int)dst + out + 5);
+			out += 5;
+		}
+		else
+		{
+			memcpy(dst + out, ins, decoded.length);
+			out += decoded.length;
+		}
+		in += decoded.length;
+	}
+	return out;
+}
+
 void hook::detour(int addr, int dest)
 {
 	int orig_to_dest_offset = dest - addr - 5;
@@ -41,16 +113,18 @@ void hook::detour(int addr, int dest)
 	}
 	else
 	{
-		// Build a trampoline
-		trampoline = (int)malloc(orig_byte_count + 5); // A jump is 5 bytes
-		VirtualProtect((LPVOID)trampoline, orig_byte_count+5, PAGE_EXECUTE_READWRITE, &old_protect);
-		mem::copy(trampoline, original_bytes, orig_byte_count);
-		// Calculate the relative offsets
-		int trampoline_to_orig_offset = addr - trampoline - orig_byte_count;
+		// Build a trampoline, a relocated 2 byte loop grows to 9 bytes
+		if (prologue.empty()) //rehook reuses what the first install decoded
+			decode_prologue();
+		int trampoline_size = orig_byte_count * 5 + 5; // A jump is 5 bytes
+		trampoline = (int)malloc(trampoline_size);
+		VirtualProtect((LPVOID)trampoline, trampoline_size, PAGE_EXECUTE_READWRITE, &old_protect);
+		int relocated = relocate_instructions(prologue, original_bytes, addr, (BYTE*)trampoline);
 
-		// Write the relative jump instruction at the end of the trampoline
-		mem::write<byte>(trampoline + orig_byte_count, 0xE9);
-		mem::write<int>(trampoline + orig_byte_count + 1, trampoline_to_orig_offset);
+		// Write the relative jump instruction at the end of the trampoline, back to the first instruction after the stolen ones
+		int trampoline_to_orig_offset = (addr + orig_byte_count) - (trampoline + relocated + 5);
+		mem::write<byte>(trampoline + relocated, 0xE9);
+		mem::write<int>(trampoline + relocated + 1, trampoline_to_orig_offset);
 
 		// Write the relative jump instruction at the original address
 		mem::write<byte>(addr, 0xE9);
@@ -71,7 +145,6 @@ void hook::replace_call(int addr, int dest)
 }
 void hook::replace_vtable(int addr, int index, int dest)
 {
-	mem::copy((int)&original_bytes, (BYTE*)dest, 4);
 	int orig_addr = ((int*)addr)[index];
 	DWORD old_protect;
 	orig_byte_count = 4;
@@ -93,15 +166,29 @@ void hook::replace_vtable(int addr, int dest)
 }
 void hook::rehook()
 {
-
+	restored = false;
 	if (hook_type == hook_type_detour)
 		detour(address, destination);
+	else if (hook_type == hook_type_vtable)
+		replace_vtable(address, destination);
 	else
 		replace_call(address, destination);
 }
 
-void hook::remove()
+void hook::restore()
 {
+	if (!address || !trampoline || restored)
+		return;
 	mem::copy(address, original_bytes, orig_byte_count);
-	free((void*)trampoline);
+	restored = true;
+}
+
+void hook::remove()
+{
+	if (!address || !trampoline)
+		return;
+	restore();
+	if (hook_type == hook_type_detour || hook_type == hook_type_vtable) //replaced calls point the trampoline at the game's own function
+		free((void*)trampoline);
+	trampoline = 0;
 }
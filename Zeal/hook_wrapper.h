@@ -1,7 +1,11 @@
 #pragma once
 #include "memory.h"
 #include <unordered_map>
+#include <vector>
+#include <atomic>
 #include "InstructionLength.h"
+#include "profiler.h"
+#include "debug_log.h"
 
 #pragma comment(lib, "Ws2_32.lib")
 #pragma comment(lib, "psapi.lib")
@@ -21,19 +25,23 @@ private:
 	void replace_call(int addr, int dest);
 	void replace(int addr, int dest);
 	void detour(int addr, int dest);
+	void decode_prologue();
 	BYTE* original_bytes;
+	std::vector<Zeal::X86::instruction> prologue; //the stolen instructions, decoded once and kept for rehook
 public: //methods
+	void restore(); //the original bytes only
 	void remove();
 	~hook()
 	{
 		remove();
+		delete[] original_bytes;
 	}
 	hook() : orig_byte_count{0}, address {}, original_bytes{}, destination{}, trampoline{}, hook_type{ hook_type_detour } { };
 	template<typename X, typename T>
 	hook(X addr, T dest, hook_type_ hooktype = hook_type_detour, int byte_count = 5)
 	{
 		orig_byte_count = byte_count;
-		original_bytes = new BYTE(byte_count);
+		original_bytes = new BYTE[byte_count];
 		address = (int)addr;
 		destination = (int)dest;
 		hook_type = hooktype;
@@ -76,36 +84,175 @@ public: //variables
 	int trampoline;
 	int orig_byte_count;
 	hook_type_ hook_type;
+	bool restored = false;
 };
+
+// pre-resolved handle for the hook whose detour is Fn, filled in by HookWrapper::Add<Fn>
+// trampolines call hook_ref<Fn>::original()(...) so the hot path is a single indirect call
+template<auto Fn>
+struct hook_ref
+{
+	static inline hook* ptr = nullptr;
+	static inline Zeal::Profiler::stats* stats = nullptr;
+	static decltype(Fn) original()
+	{
+		return (decltype(Fn))ptr->trampoline;
+	}
+};
+
+// calls that came into zeal through an installed detour and haven't returned yet. the unload restores the game's code,
+// then waits for this to drain before freeing trampolines or destroying the modules those calls are still using
+namespace Zeal::Hooks
+{
+	inline std::atomic<int> in_flight = 0;
+	struct in_flight_scope
+	{
+		in_flight_scope() { in_flight.fetch_add(1, std::memory_order_acq_rel); }
+		~in_flight_scope() { in_flight.fetch_sub(1, std::memory_order_acq_rel); }
+	};
+}
+
+// the detour actually installed for Fn: counts the call as in flight and times it into hook_ref<Fn>::stats while the
+// profiler is enabled. conventions without a specialization fall back to installing Fn itself
+template<auto Fn, typename F = decltype(Fn)>
+struct guarded_hook
+{
+	static constexpr auto thunk = Fn;
+};
+template<auto Fn, typename R, typename... A>
+struct guarded_hook<Fn, R(__cdecl*)(A...)>
+{
+	static R __cdecl thunk(A... args) { Zeal::Hooks::in_flight_scope call; Zeal::Profiler::scope timer(hook_ref<Fn>::stats); return Fn(args...); }
+};
+template<auto Fn, typename R, typename... A>
+struct guarded_hook<Fn, R(__stdcall*)(A...)>
+{
+	static R __stdcall thunk(A... args) { Zeal::Hooks::in_flight_scope call; Zeal::Profiler::scope timer(hook_ref<Fn>::stats); return Fn(args...); }
+};
+template<auto Fn, typename R, typename... A>
+struct guarded_hook<Fn, R(__fastcall*)(A...)>
+{
+	static R __fastcall thunk(A... args) { Zeal::Hooks::in_flight_scope call; Zeal::Profiler::scope timer(hook_ref<Fn>::stats); return Fn(args...); }
+};
+
+// a heap copy of a class vtable that chosen objects are pointed at. patching a slot here overrides it for those objects
+// only, every other object of the class keeps the game's table and nobody pays a detour
+struct shadow_vtable_base
+{
+	virtual ~shadow_vtable_base() = default;
+};
+template<typename VT>
+struct shadow_vtable : shadow_vtable_base
+{
+	shadow_vtable(const VT* source) : source(source) { memcpy(&table, source, sizeof(VT)); }
+	template<typename Fn>
+	shadow_vtable& patch(LPVOID VT::* slot, Fn fn)
+	{
+		table.*slot = reinterpret_cast<LPVOID>(fn);
+		return *this;
+	}
+	template<typename Fn>
+	Fn original(LPVOID VT::* slot) const { return reinterpret_cast<Fn>(source->*slot); }
+	// the game's classes keep their vtable pointer at offset 0, whatever the struct calls it
+	void attach(void* object) { *reinterpret_cast<VT**>(object) = &table; }
+	void detach(void* object)
+	{
+		if (*reinterpret_cast<VT**>(object) == &table)
+			*reinterpret_cast<const VT**>(object) = source;
+	}
+	const VT* source;
+	VT table;
+};
+
 class HookWrapper
 {
 public:
 	std::unordered_map<std::string, hook*> hook_map;
+	std::unordered_map<std::string, shadow_vtable_base*> shadow_tables; //never freed, game objects can outlive zeal's hooks
+	std::vector<hook*> install_order; //removal walks this backwards so stacked patches unwind in the order they were made
 	template<typename X, typename T>
 	hook* Add(std::string name, X addr, T fnc, hook_type_ type, int byte_count = -1) //could have used zdys or capstone but keeping this a single compile with minimal libs and its not that hard to figure out the bytes
 	{
+		if (!addr) //a symbol the address table couldn't resolve on this client build
+		{
+			ZEAL_LOG_ERROR("hooks", "%s has no address on this client, not hooked", name.c_str());
+			return nullptr;
+		}
+		if (mem::is_staged((int)addr, 16)) //the instructions below are decoded from memory, so a pending patch there has to land first
+		{
+			mem::commit_batch();
+			mem::begin_batch();
+		}
 		if (type != hook_type_vtable)
 		{
 			if (byte_count == -1)
-			{
-				byte_count = Zeal::InstructionLength((unsigned char*)addr);
-				while (byte_count < 5) //you need 5 bytes for a jmp
-					byte_count += Zeal::InstructionLength((unsigned char*)(addr + byte_count));
-			}
+				byte_count = stolen_bytes((int)addr);
+			if (!byte_count)
+				return nullptr; //logged by stolen_bytes, the target is left alone
 		}
 		else
 			byte_count = 4;
 		hook* x = new hook(addr, fnc, type, byte_count);
 		hook_map[name] = x;
+		install_order.push_back(x);
 		x->hook_type = type;
 
 
 		return x;
 	}
+	template<auto Fn, typename X>
+	hook* Add(std::string name, X addr, hook_type_ type, int byte_count = -1)
+	{
+		hook* x = Add(name, addr, guarded_hook<Fn>::thunk, type, byte_count);
+		if (!x)
+			return nullptr;
+#if ZEAL_PROFILER
+		hook_ref<Fn>::stats = Zeal::Profiler::create("hook " + name);
+#endif
+		hook_ref<Fn>::ptr = x;
+		return x;
+	}
+	// the shadow of the table object_vtbl points at, cloned the first time a name is used and shared by every object
+	// attached under it; a source that moved (ui reload into a new class) gets a fresh clone, the old one stays valid
+	template<typename VT>
+	shadow_vtable<VT>& ShadowVTable(const std::string& name, const void* object_vtbl)
+	{
+		shadow_vtable_base*& entry = shadow_tables[name];
+		auto* shadow = static_cast<shadow_vtable<VT>*>(entry);
+		if (shadow && (shadow->source == object_vtbl || &shadow->table == object_vtbl))
+			return *shadow;
+		shadow = new shadow_vtable<VT>(static_cast<const VT*>(object_vtbl));
+		entry = shadow;
+		return *shadow;
+	}
+	static int stolen_bytes(int addr) //whole instructions covering the 5 byte jmp, 0 when they can't be decoded
+	{
+		int byte_count = 0;
+		while (byte_count < 5) //you need 5 bytes for a jmp
+		{
+			int length = Zeal::InstructionLength((unsigned char*)(addr + byte_count));
+			if (!length) //not decodable, a guessed cut could split an instruction into the trampoline
+			{
+				ZEAL_LOG_ERROR("hooks", "can't decode the instruction at %p", (void*)(addr + byte_count));
+				return 0;
+			}
+			byte_count += length;
+		}
+		return byte_count;
+	}
+	// patches made between these land together: one protection change per page, other threads suspended while writing
+	void begin_batch() { mem::begin_batch(); }
+	void commit() { mem::commit_batch(); }
+	// puts the game's code back but keeps the trampolines, a call already inside a detour can still reach the original
+	void restore()
+	{
+		for (auto it = install_order.rbegin(); it != install_order.rend(); ++it)
+			(*it)->restore();
+	}
 	~HookWrapper()
 	{
-		for (auto& hook : hook_map)
-			hook.second->remove();
+		for (auto it = install_order.rbegin(); it != install_order.rend(); ++it)
+			(*it)->remove();
 	}
 };
 
@@ -0,0 +1,144 @@
+#include "input_events.h"
+#include "EqStructures.h"
+#include "EqAddresses.h"
+#include "EqFunctions.h"
+#include "Zeal.h"
+
+LONGLONG InputEvents::now()
+{
+	static LONGLONG frequency = 0;
+	if (!frequency)
+	{
+		LARGE_INTEGER f;
+		QueryPerformanceFrequency(&f);
+		frequency = f.QuadPart;
+	}
+	LARGE_INTEGER counter;
+	QueryPerformanceCounter(&counter);
+	return counter.QuadPart / frequency * 1000000 + counter.QuadPart % frequency * 1000000 / frequency;
+}
+
+void InputEvents::push(UINT cmd, bool is_down)
+{
+	if (cmd >= max_cmd)
+		return;
+	if (is_down && Zeal::EqGame::game_wants_input()) //typing, same rule the binds follow
+		return;
+	if (count == ring_size) //a full ring drops the oldest transition
+		count--;
+	ring[head] = { cmd, is_down, now() };
+	head = (head + 1) % ring_size;
+	count++;
+}
+
+void InputEvents::consume()
+{
+	if (!message_hook) //the main loop runs on the thread that pumps the game window
+		message_hook = SetWindowsHookExA(WH_GETMESSAGE, get_message_proc, nullptr, GetCurrentThreadId());
+	LONGLONG frame_end = now();
+	if (!last_frame)
+		last_frame = frame_end;
+	for (UINT cmd : held_last_frame)
+		held[cmd] = 0;
+	held_last_frame.clear();
+
+	size_t index = (head + ring_size - count) % ring_size;
+	for (; count; count--, index = (index + 1) % ring_size)
+	{
+		const input_event& e = ring[index];
+		if (e.down && !down[e.cmd])
+		{
+			down.set(e.cmd);
+			down_since[e.cmd] = e.time;
+		}
+		else if (!e.down && down[e.cmd])
+		{
+			down.reset(e.cmd);
+			LONGLONG start = down_since[e.cmd] > last_frame ? down_since[e.cmd] : last_frame;
+			if (e.time > start)
+			{
+				if (held[e.cmd] == 0)
+					held_last_frame.push_back(e.cmd);
+				held[e.cmd] += (e.time - start) / 1000.f;
+			}
+		}
+		else
+			continue; //key repeat
+		for (auto& fn : listeners)
+			fn(e);
+	}
+	for (UINT cmd = 0; cmd < max_cmd; cmd++)
+	{
+		if (!down[cmd])
+			continue;
+		LONGLONG start = down_since[cmd] > last_frame ? down_since[cmd] : last_frame;
+		if (held[cmd] == 0)
+			held_last_frame.push_back(cmd);
+		held[cmd] += (frame_end - start) / 1000.f;
+	}
+	last_frame_ms = (frame_end - last_frame) / 1000.f;
+	last_frame = frame_end;
+}
+
+LRESULT CALLBACK InputEvents::get_message_proc(int code, WPARAM wparam, LPARAM lparam)
+{
+	const MSG* msg = reinterpret_cast<const MSG*>(lparam);
+	InputEvents* input = ZealService::get_instance()->input.get();
+	if (code == HC_ACTION && wparam == PM_REMOVE && input && ((msg->message >= WM_KEYFIRST && msg->message <= WM_KEYLAST)
+		|| (msg->message >= WM_MOUSEFIRST && msg->message <= WM_MOUSELAST) || msg->message == WM_INPUT))
+	{
+		DWORD age_ms = GetTickCount() - msg->time;
+		if (age_ms < 1000 && !input->first_arrival)
+			input->first_arrival = now() - static_cast<LONGLONG>(age_ms) * 1000;
+	}
+	return CallNextHookEx(nullptr, code, wparam, lparam);
+}
+
+void InputEvents::input_phase()
+{
+	if (!first_arrival)
+		return;
+	ZealService* zeal = ZealService::get_instance();
+	if (zeal->frame_profiler)
+		zeal->frame_profiler->note_input((now() - first_arrival) / 1000.f);
+	first_arrival = 0;
+}
+
+void InputEvents::before_render()
+{
+	if (!early_input.get() || !Zeal::EqGame::is_in_game())
+		return;
+	input_phase();
+	Zeal::EqGame::EqGameInternal::ProcessMouseEvent();
+}
+
+void InputEvents::release_all()
+{
+	down.reset();
+	count = 0;
+}
+
+void InputEvents::add_listener(std::function<void(const input_event&)> callback)
+{
+	listeners.push_back(callback);
+}
+
+static int __fastcall ProcessControls(int t, int unused)
+{
+	if (InputEvents* input = ZealService::get_instance()->input.get())
+		input->input_phase();
+	return hook_ref<ProcessControls>::original()(t, unused);
+}
+
+InputEvents::InputEvents(ZealService* zeal)
+{
+	zeal->hooks->Add<ProcessControls>("ProcessControls", 0x53F337, hook_type_detour);
+	zeal->callbacks->add_generic([this]() { consume(); }, callback_type::MainLoop);
+	zeal->callbacks->add_generic([this]() { release_all(); }, callback_type::Zone);
+}
+
+InputEvents::~InputEvents()
+{
+	if (message_hook)
+		UnhookWindowsHookEx(message_hook);
+}
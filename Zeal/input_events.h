@@ -0,0 +1,51 @@
+#pragma once
+#include <Windows.h>
+#include <bitset>
+#include <functional>
+#include <vector>
+#include "settings.h"
+
+struct input_event
+{
+	UINT cmd;
+	bool down;
+	LONGLONG time; //microseconds, QueryPerformanceCounter based
+};
+
+// ExecuteCmd only records key transitions here; once per frame they are consumed in order into a dense key state
+// so frame code sees a consistent snapshot plus how long each command was held within the frame
+class InputEvents
+{
+public:
+	static constexpr UINT max_cmd = 256;
+	InputEvents(class ZealService* zeal);
+	~InputEvents();
+	void push(UINT cmd, bool down); //game thread, from the ExecuteCmd hook
+	bool is_down(UINT cmd) const { return cmd < max_cmd && down[cmd]; }
+	float held_ms(UINT cmd) const { return cmd < max_cmd ? held[cmd] : 0.f; } //time held during the last consumed frame
+	float frame_ms() const { return last_frame_ms; }
+	void release_all(); //forgets held commands, e.g. after losing focus
+	void add_listener(std::function<void(const input_event&)> callback); //called per event while consuming
+	static LONGLONG now();
+	void input_phase(); //the game's ProcessControls is about to act on what arrived, reports the wait to the frame profiler
+	void before_render(); //runs the game's mouse processing again just before render when early_input is on
+	Setting<bool> early_input{ "Zeal", "EarlyInput", false };
+private:
+	void consume();
+	// arrival times of window input messages, seen as the game pumps them. message times are tick counts,
+	// so an arrival is only good to the system tick (10-16ms) while the part after the pump is exact
+	static LRESULT CALLBACK get_message_proc(int code, WPARAM wparam, LPARAM lparam);
+	HHOOK message_hook = nullptr;
+	LONGLONG first_arrival = 0; //oldest input not acted on yet, 0 when there is none
+	static constexpr size_t ring_size = 128;
+	input_event ring[ring_size];
+	size_t head = 0; //next write
+	size_t count = 0;
+	std::bitset<max_cmd> down;
+	LONGLONG down_since[max_cmd] = { 0 };
+	float held[max_cmd] = { 0 };
+	std::vector<UINT> held_last_frame;
+	LONGLONG last_frame = 0;
+	float last_frame_ms = 0;
+	std::vector<std::function<void(const input_event&)>> listeners;
+};
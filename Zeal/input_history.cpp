@@ -0,0 +1,362 @@
+#include "input_history.h"
+#include "Zeal.h"
+#include "EqFunctions.h"
+#include "EqUI.h"
+#include "string_util.h"
+#include <algorithm>
+#include <cctype>
+#include <fstream>
+
+static constexpr UINT32 key_tab = 0x0F;
+static constexpr UINT32 key_r = 0x13;
+static constexpr UINT32 key_enter = 0x1C;
+static constexpr UINT32 key_numpad_enter = 0x9C;
+
+static std::string lowercase(std::string_view text)
+{
+	std::string out(text);
+	std::transform(out.begin(), out.end(), out.begin(), [](char c) { return (char)tolower((unsigned char)c); });
+	return out;
+}
+
+static bool contains_insensitive(std::string_view text, const std::string& lowered_needle)
+{
+	auto it = std::search(text.begin(), text.end(), lowered_needle.begin(), lowered_needle.end(),
+		[](char a, char b) { return tolower((unsigned char)a) == b; });
+	return it != text.end();
+}
+
+static bool is_tell_command(const std::string& lowered)
+{
+	return lowered == "/tell" || lowered == "/t" || lowered == "/msg";
+}
+
+void prefix_trie::insert(const std::string& word)
+{
+	int index = 0;
+	for (char raw : word)
+	{
+		char c = (char)tolower((unsigned char)raw);
+		int prev = -1;
+		int cur = nodes[index].child;
+		while (cur >= 0 && nodes[cur].c < c)
+		{
+			prev = cur;
+			cur = nodes[cur].next;
+		}
+		if (cur < 0 || nodes[cur].c != c)
+		{
+			node added;
+			added.c = c;
+			added.next = cur;
+			nodes.push_back(added);
+			int created = static_cast<int>(nodes.size() - 1);
+			if (prev < 0)
+				nodes[index].child = created;
+			else
+				nodes[prev].next = created;
+			cur = created;
+		}
+		index = cur;
+	}
+	if (nodes[index].word < 0)
+	{
+		nodes[index].word = static_cast<int>(words.size());
+		words.push_back(word);
+	}
+}
+
+void prefix_trie::collect(int index, size_t limit, std::vector<const std::string*>& out) const
+{
+	if (out.size() >= limit)
+		return;
+	if (nodes[index].word >= 0)
+		out.push_back(&words[nodes[index].word]);
+	for (int child = nodes[index].child; child >= 0 && out.size() < limit; child = nodes[child].next)
+		collect(child, limit, out);
+}
+
+void prefix_trie::complete(const std::string& prefix, size_t limit, std::vector<const std::string*>& out) const
+{
+	out.clear();
+	int index = 0;
+	for (char raw : prefix)
+	{
+		char c = (char)tolower((unsigned char)raw);
+		int cur = nodes[index].child;
+		while (cur >= 0 && nodes[cur].c < c)
+			cur = nodes[cur].next;
+		if (cur < 0 || nodes[cur].c != c)
+			return;
+		index = cur;
+	}
+	collect(index, limit, out);
+}
+
+std::string InputHistory::read_text(Zeal::EqUI::EditWnd* edit)
+{
+	if (!edit->InputText.Data)
+		return "";
+	return std::string(edit->InputText.Data->Text, edit->InputText.Data->Length);
+}
+
+void InputHistory::write_text(Zeal::EqUI::EditWnd* edit, const std::string& line)
+{
+	edit->Caret_Start = 0;
+	edit->Caret_End = edit->GetInputLength();
+	edit->InputText.Assure(line.length() + edit->InputText.Data->Length, 0);
+	edit->ReplaceSelection(line.c_str(), false);
+}
+
+void InputHistory::ensure_character()
+{
+	Zeal::EqStructures::Entity* self = Zeal::EqGame::get_self();
+	std::string name = self ? self->Name : "";
+	if (name == character)
+		return;
+	save();
+	character = name;
+	load();
+}
+
+void InputHistory::load()
+{
+	entries.clear();
+	arena.clear();
+	targets.clear();
+	targets_trie.clear();
+	changed = false;
+	if (character.empty())
+		return;
+	std::ifstream in("history\\" + character + ".zhist", std::ios::binary);
+	UINT32 header[3] = {};
+	if (!in.is_open() || !in.read(reinterpret_cast<char*>(header), sizeof(header)) || header[0] != history_magic || header[1] != history_version)
+		return;
+	std::string line;
+	for (UINT32 i = 0; i < header[2]; i++)
+	{
+		USHORT length = 0;
+		if (!in.read(reinterpret_cast<char*>(&length), sizeof(length)) || length > max_line_length)
+			break;
+		line.resize(length);
+		if (!in.read(line.data(), length))
+			break;
+		add(line);
+	}
+	changed = false;
+}
+
+// length prefixed lines, oldest first
+void InputHistory::save()
+{
+	if (!changed || character.empty())
+		return;
+	changed = false;
+	CreateDirectoryA("history", NULL);
+	std::ofstream out("history\\" + character + ".zhist", std::ios::binary | std::ios::trunc);
+	if (!out.is_open())
+		return;
+	UINT32 header[3] = { history_magic, history_version, static_cast<UINT32>(entries.size()) };
+	out.write(reinterpret_cast<const char*>(header), sizeof(header));
+	for (const entry& e : entries)
+	{
+		out.write(reinterpret_cast<const char*>(&e.length), sizeof(e.length));
+		out.write(arena.data() + e.offset, e.length);
+	}
+}
+
+// the newer half survives, at least one entry goes. repeats erased from the middle leave their bytes behind until this runs
+void InputHistory::compact()
+{
+	std::vector<char> packed;
+	packed.reserve(arena_size);
+	std::vector<entry> kept;
+	for (size_t i = (entries.size() + 1) / 2; i < entries.size(); i++)
+	{
+		kept.push_back({ static_cast<UINT>(packed.size()), entries[i].length });
+		packed.insert(packed.end(), arena.begin() + entries[i].offset, arena.begin() + entries[i].offset + entries[i].length);
+	}
+	arena.swap(packed);
+	entries.swap(kept);
+}
+
+void InputHistory::add(const std::string& line)
+{
+	if (line.empty() || line.length() > max_line_length || line[0] != '/')
+		return;
+	// a repeat moves to the newest slot instead of filling the history with the same line
+	for (size_t i = entries.size(), checked = 0; i-- > 0 && checked < 64; checked++)
+	{
+		if (text(entries[i]) == line)
+		{
+			entries.erase(entries.begin() + i);
+			break;
+		}
+	}
+	if (entries.empty())
+		arena.clear(); //only erased bytes are left
+	while (entries.size() && (entries.size() >= max_entries || arena.size() + line.length() > arena_size))
+		compact();
+	entries.push_back({ static_cast<UINT>(arena.size()), static_cast<USHORT>(line.length()) });
+	arena.insert(arena.end(), line.begin(), line.end());
+	changed = true;
+	size_t space = line.find(' ');
+	if (space != std::string::npos && is_tell_command(lowercase(std::string_view(line).substr(0, space))))
+	{
+		size_t end = line.find(' ', space + 1);
+		note_target(line.substr(space + 1, end == std::string::npos ? std::string::npos : end - space - 1));
+	}
+}
+
+void InputHistory::note_target(const std::string& name)
+{
+	if (name.empty() || name.length() > 64)
+		return;
+	auto it = std::find_if(targets.begin(), targets.end(), [&](const std::string& t) { return Zeal::String::compare_insensitive(t, name); });
+	if (it != targets.end())
+		targets.erase(it);
+	targets.push_back(name);
+	if (targets.size() > max_targets)
+		targets.erase(targets.begin());
+	targets_trie.clear();
+	for (const std::string& t : targets)
+		targets_trie.insert(t);
+}
+
+void InputHistory::note_chat(const char* text)
+{
+	const char* tells = text ? strstr(text, " tells you, ") : nullptr;
+	if (!tells || tells - text > 64)
+		return;
+	std::string name(text, tells);
+	if (name.find(' ') == std::string::npos)
+		note_target(name);
+}
+
+void InputHistory::build_commands()
+{
+	ZealService* zeal = ZealService::get_instance();
+	if (zeal->commands_hook->CommandFunctions.size() == command_count)
+		return;
+	commands.clear();
+	for (const auto& [name, command] : zeal->commands_hook->CommandFunctions)
+	{
+		commands.insert(name);
+		for (const std::string& alias : command.aliases)
+			commands.insert(alias);
+	}
+	command_count = zeal->commands_hook->CommandFunctions.size();
+}
+
+bool InputHistory::complete(Zeal::EqUI::EditWnd* edit, const std::string& line)
+{
+	if (!completed.empty() && line == completed && candidates.size() > 1)
+	{
+		candidate = (candidate + 1) % candidates.size();
+		completed = candidates[candidate];
+		write_text(edit, completed);
+		return true;
+	}
+	candidates.clear();
+	if (line.empty() || line[0] != '/')
+		return false;
+	std::vector<const std::string*> words;
+	size_t space = line.find(' ');
+	if (space == std::string::npos)
+	{
+		build_commands();
+		commands.complete(line, 32, words);
+		for (const std::string* word : words)
+			candidates.push_back(*word + " ");
+	}
+	else
+	{
+		std::string head = line.substr(0, space + 1);
+		std::string rest = line.substr(space + 1);
+		if (is_tell_command(lowercase(std::string_view(line).substr(0, space))))
+		{
+			if (rest.find(' ') == std::string::npos)
+			{
+				targets_trie.complete(rest, 32, words);
+				for (const std::string* word : words)
+					candidates.push_back(head + *word + " ");
+			}
+		}
+		else if (rest.length())
+		{
+			ZealService* zeal = ZealService::get_instance();
+			std::vector<WORD> spells;
+			if (zeal->spell_index)
+				zeal->spell_index->find_prefix(rest, spells, 32);
+			for (WORD id : spells)
+				if (Zeal::EqStructures::SPELL* spell = zeal->spell_index->get(id))
+					candidates.push_back(head + spell->Name);
+		}
+	}
+	if (candidates.empty())
+		return false;
+	candidate = 0;
+	completed = candidates[0];
+	write_text(edit, completed);
+	return true;
+}
+
+bool InputHistory::search(Zeal::EqUI::EditWnd* edit, const std::string& line)
+{
+	if (found.empty() || line != found)
+	{
+		query = lowercase(line);
+		search_pos = static_cast<int>(entries.size());
+	}
+	if (query.empty())
+		return true;
+	for (int i = search_pos - 1; i >= 0; i--)
+	{
+		std::string_view t = text(entries[i]);
+		if (t != line && contains_insensitive(t, query))
+		{
+			search_pos = i;
+			found = std::string(t);
+			write_text(edit, found);
+			return true;
+		}
+	}
+	return true; //nothing older matches, the input stays as it is
+}
+
+bool InputHistory::handle_key(Zeal::EqUI::EditWnd* edit, UINT32 key, bool ctrl)
+{
+	if (!enabled.get())
+		return false;
+	ensure_character();
+	if (key == key_tab && !ctrl)
+		return complete(edit, read_text(edit));
+	if (key == key_r && ctrl)
+		return search(edit, read_text(edit));
+	candidates.clear();
+	completed.clear();
+	found.clear();
+	search_pos = -1;
+	if ((key == key_enter || key == key_numpad_enter) && !edit->item_link_count)
+		add(read_text(edit));
+	return false;
+}
+
+InputHistory::InputHistory(ZealService* zeal)
+{
+	zeal->memory_report->add("input history", [this]() {
+		Zeal::Memory::usage use{ Zeal::Memory::vector_bytes(arena) + Zeal::Memory::vector_bytes(entries) + Zeal::Memory::vector_bytes(targets) + Zeal::Memory::vector_bytes(candidates),
+			entries.size() };
+		for (const std::string& target : targets)
+			use.bytes += Zeal::Memory::string_bytes(target);
+		return use;
+	});
+	arena.reserve(arena_size);
+	zeal->callbacks->add_work([this](int) { save(); return false; }, 60000, work_priority::low);
+	zeal->callbacks->add_generic([this]() { save(); }, callback_type::CharacterSelect);
+}
+
+InputHistory::~InputHistory()
+{
+	save();
+}
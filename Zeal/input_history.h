@@ -0,0 +1,81 @@
+#pragma once
+#include <Windows.h>
+#include <string>
+#include <string_view>
+#include <vector>
+#include "settings.h"
+namespace Zeal { namespace EqUI { struct EditWnd; } }
+
+// lowercase prefix trie, the words keep their own case. siblings are kept sorted so completions come out alphabetical
+// and a lookup walks at most prefix length * alphabet nodes however many words there are
+class prefix_trie
+{
+public:
+	void insert(const std::string& word);
+	void complete(const std::string& prefix, size_t limit, std::vector<const std::string*>& out) const;
+	void clear() { nodes.assign(1, node{}); words.clear(); }
+	size_t size() const { return words.size(); }
+private:
+	struct node
+	{
+		char c = 0;
+		int child = -1; //first child, then along next
+		int next = -1;
+		int word = -1; //index into words when a word ends here
+	};
+	void collect(int index, size_t limit, std::vector<const std::string*>& out) const;
+	std::vector<node> nodes = std::vector<node>(1);
+	std::vector<std::string> words;
+};
+
+// lines typed into the chat input, per character in an arena and saved to history\<name>.zhist between sessions.
+// tab completes zeal commands and their aliases, tell targets after /tell and spell names after anything else,
+// ctrl+r steps back through the lines containing what was typed
+class InputHistory
+{
+public:
+	bool handle_key(Zeal::EqUI::EditWnd* edit, UINT32 key, bool ctrl); //true when the key was used up
+	void note_chat(const char* text); //incoming tells add their sender as a target
+	InputHistory(class ZealService* zeal);
+	~InputHistory();
+	Setting<bool> enabled{ "Zeal", "InputHistory", true };
+private:
+	struct entry
+	{
+		UINT offset; //into arena
+		USHORT length;
+	};
+	static constexpr size_t max_entries = 4096;
+	static constexpr size_t arena_size = 256 * 1024;
+	static constexpr size_t max_line_length = 512;
+	static constexpr size_t max_targets = 64;
+	static constexpr UINT32 history_magic = 0x5453485A; //ZHST
+	static constexpr UINT32 history_version = 1;
+	std::string_view text(const entry& e) const { return std::string_view(arena.data() + e.offset, e.length); }
+	void ensure_character();
+	void load();
+	void save();
+	void add(const std::string& line);
+	void compact();
+	void note_target(const std::string& name);
+	void build_commands();
+	bool complete(Zeal::EqUI::EditWnd* edit, const std::string& line);
+	bool search(Zeal::EqUI::EditWnd* edit, const std::string& line);
+	static std::string read_text(Zeal::EqUI::EditWnd* edit);
+	static void write_text(Zeal::EqUI::EditWnd* edit, const std::string& line);
+	std::vector<char> arena;
+	std::vector<entry> entries; //oldest first
+	std::string character;
+	bool changed = false;
+	prefix_trie commands;
+	size_t command_count = 0; //CommandFunctions size the trie was built from
+	prefix_trie targets_trie;
+	std::vector<std::string> targets; //newest last
+	// tab cycles the candidates while the input still holds the last completion, ctrl+r keeps stepping back
+	std::vector<std::string> candidates;
+	size_t candidate = 0;
+	std::string completed;
+	std::string query;
+	int search_pos = -1;
+	std::string found;
+};
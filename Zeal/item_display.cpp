@@ -10,64 +10,168 @@ void __fastcall Deconstruct(Zeal::EqUI::ItemDisplayWnd* wnd, int unused, BYTE re
 	Zeal::EqGame::get_wnd_manager()->Unknown0x8 -= 1;
 }
 
+// every item display window, the game's own included, reports activation to the window stack for escape
+static LPVOID original_activate = nullptr;
+static LPVOID original_deactivate = nullptr;
+static void __fastcall Activate(Zeal::EqUI::ItemDisplayWnd* wnd, int unused)
+{
+	ZealService* zeal = ZealService::get_instance();
+	if (zeal && zeal->window_stack)
+		zeal->window_stack->raise(wnd);
+	reinterpret_cast<void(__fastcall*)(Zeal::EqUI::ItemDisplayWnd*, int)>(original_activate)(wnd, unused);
+}
+static int __fastcall Deactivate(Zeal::EqUI::ItemDisplayWnd* wnd, int unused)
+{
+	ZealService* zeal = ZealService::get_instance();
+	if (zeal && zeal->window_stack)
+		zeal->window_stack->lower(wnd);
+	return reinterpret_cast<int(__fastcall*)(Zeal::EqUI::ItemDisplayWnd*, int)>(original_deactivate)(wnd, unused);
+}
+static void track_activation(shadow_vtable<Zeal::EqUI::ItemDisplayVtable>& shadow)
+{
+	original_activate = shadow.source->Activate;
+	original_deactivate = shadow.source->basic.Deactivate;
+	shadow.table.Activate = Activate;
+	shadow.table.basic.Deactivate = Deactivate;
+}
+
+Zeal::EqUI::ItemDisplayWnd* ItemDisplay::add_window()
+{
+	int offset = 20 * (int)windows.size();
+	Zeal::EqUI::ItemDisplayWnd* new_wnd = new Zeal::EqUI::ItemDisplayWnd();
+	mem::set((int)new_wnd, 0, sizeof(Zeal::EqUI::ItemDisplayWnd));
+	windows.push_back(new_wnd);
+	reinterpret_cast<Zeal::EqUI::ItemDisplayWnd* (__thiscall*)(const Zeal::EqUI::ItemDisplayWnd*, int unk)>(0x423331)(new_wnd, 0);
+	auto& shadow = ZealService::get_instance()->hooks->ShadowVTable<Zeal::EqUI::ItemDisplayVtable>("ItemDisplayWnd", new_wnd->vtbl);
+	shadow.table.basic.Deconstructor = Deconstruct;
+	track_activation(shadow);
+	shadow.attach(new_wnd);
+	new_wnd->Location.Top += offset;
+	new_wnd->Location.Left += offset;
+	new_wnd->Location.Bottom += offset;
+	new_wnd->Location.Right += offset;
+	lru_pos[new_wnd] = lru.insert(lru.begin(), new_wnd);
+	return new_wnd;
+}
+
 void ItemDisplay::init_ui()
 {
+	formatted_windows.clear(); //a skin reload rebuilt every description window
 	windows.clear();
+	by_item.clear();
+	lru.clear();
+	lru_pos.clear();
 	windows.push_back(Zeal::EqGame::Windows->ItemWnd);
-	for (int i = 0; i < max_item_displays; i++)
-	{
-		Zeal::EqUI::ItemDisplayWnd* new_wnd = new Zeal::EqUI::ItemDisplayWnd();
-		mem::set((int)new_wnd, 0, sizeof(Zeal::EqUI::ItemDisplayWnd));
-		windows.push_back(new_wnd);
-		reinterpret_cast<Zeal::EqUI::ItemDisplayWnd* (__thiscall*)(const Zeal::EqUI::ItemDisplayWnd*, int unk)>(0x423331)(new_wnd, 0);
-		new_wnd->SetupCustomVTable();
-		new_wnd->vtbl->Deconstructor = Deconstruct;
-		new_wnd->Location.Top += 20 * (i + 1);
-		new_wnd->Location.Left += 20 * (i + 1);
-		new_wnd->Location.Bottom += 20 * (i + 1);
-		new_wnd->Location.Right += 20 * (i + 1);
-	}
+	lru_pos[Zeal::EqGame::Windows->ItemWnd] = lru.insert(lru.end(), Zeal::EqGame::Windows->ItemWnd);
+	main_wnd = Zeal::EqGame::Windows->ItemWnd;
+	main_shadow = &ZealService::get_instance()->hooks->ShadowVTable<Zeal::EqUI::ItemDisplayVtable>("ItemDisplayWnd.Main", main_wnd->vtbl);
+	track_activation(*main_shadow); //the game keeps its own destructor for this one
+	main_shadow->attach(main_wnd);
+	ui_ready = true;
+}
+
+// the game's window goes back to the game's table while it still exists: before the ui reload destroys it, and on unload
+// so an inspect afterwards doesn't call into a zeal that's gone
+void ItemDisplay::detach_main()
+{
+	if (main_wnd && main_shadow && Zeal::EqGame::Windows && Zeal::EqGame::Windows->ItemWnd == main_wnd)
+		main_shadow->detach(main_wnd);
+	main_wnd = nullptr;
+}
+
+bool ItemDisplay::build_spare()
+{
+	int wanted = std::min(spare_windows.get(), max_windows.get()) + 1;
+	if (!ui_ready || windows.empty() || (int)windows.size() >= wanted || !Zeal::EqGame::is_in_game())
+		return false;
+	add_window();
+	return (int)windows.size() < wanted;
+}
+
+void ItemDisplay::touch(Zeal::EqUI::ItemDisplayWnd* wnd)
+{
+	auto it = lru_pos.find(wnd);
+	if (it != lru_pos.end())
+		lru.splice(lru.end(), lru, it->second);
 }
 
 Zeal::EqUI::ItemDisplayWnd* ItemDisplay::get_available_window(Zeal::EqStructures::_EQITEMINFO* item)
 {
+	if (windows.empty())
+		return Zeal::EqGame::Windows->ItemWnd;
+	Zeal::EqUI::ItemDisplayWnd* wnd = nullptr;
 	if (item)
 	{
 		/*check if the item is already being displayed*/
-		for (auto& w : windows)
+		auto it = by_item.find(item->ID);
+		if (it != by_item.end() && it->second->Item.ID == item->ID)
+			wnd = it->second;
+	}
+	if (!wnd)
+	{
+		// oldest first, a hidden window there is the one closed longest ago
+		for (Zeal::EqUI::ItemDisplayWnd* w : lru)
 		{
-			if (w->Item.ID == item->ID)
-				return w;
+			if (!w->IsVisible)
+			{
+				wnd = w;
+				break;
+			}
 		}
 	}
+	if (!wnd && (int)windows.size() < max_windows.get() + 1)
+		wnd = add_window();
+	if (!wnd)
+		wnd = lru.front();
+	if (item)
+		by_item[item->ID] = wnd;
+	touch(wnd);
+	return wnd;
+}
 
-	for (auto& w : windows)
-	{
-		if (!w->IsVisible)
-			return w;
-	}
-	return windows.back();
+// the window's Item is the client's copy of the record it formatted, comparing all of it is the stat signature
+bool ItemDisplay::holds_formatted(Zeal::EqUI::ItemDisplayWnd* wnd, const Zeal::EqStructures::_EQITEMINFO* item) const
+{
+	return item && wnd->Item.ID == item->ID && formatted_windows.count(wnd) && !memcmp(&wnd->Item, item, sizeof(*item));
 }
+
 void __fastcall SetItem(Zeal::EqUI::ItemDisplayWnd* wnd, int unused, Zeal::EqStructures::_EQITEMINFO* item, bool show)
 {
 	ZealService* zeal = ZealService::get_instance();
-	wnd = zeal->item_displays->get_available_window(item);
-	zeal->hooks->hook_map["SetItem"]->original(SetItem)(wnd, unused, item, show);
+	ItemDisplay* displays = zeal->item_displays.get();
+	wnd = displays->get_available_window(item);
+	if (displays->holds_formatted(wnd, item))
+	{
+		if (show)
+			wnd->IsVisible = true;
+	}
+	else
+	{
+		hook_ref<SetItem>::original()(wnd, unused, item, show);
+		if (item)
+			displays->formatted(wnd);
+	}
 	wnd->IconBtn->ZLayer = wnd->ZLayer;
 	wnd->Activate();
+	zeal->window_stack->raise(wnd);
 }
 void __fastcall SetSpell(Zeal::EqUI::ItemDisplayWnd* wnd, int unused, int spell_id, bool show, int unknown)
 {
 	ZealService* zeal = ZealService::get_instance();
 	wnd = zeal->item_displays->get_available_window(0);
-	zeal->hooks->hook_map["SetSpell"]->original(SetSpell)(wnd, unused, spell_id, show, unknown);
+	zeal->item_displays->forget(wnd); //now holds a spell description
+	hook_ref<SetSpell>::original()(wnd, unused, spell_id, show, unknown);
 	wnd->IconBtn->ZLayer = wnd->ZLayer;
 	wnd->Activate();
+	zeal->window_stack->raise(wnd);
 }
 
 void ItemDisplay::CleanUI()
 {
 		Zeal::EqGame::print_debug("Clean UI ItemDisplay");
+		ui_ready = false;
+		detach_main();
+		formatted_windows.clear();
 		for (auto& w : windows)
 		{
 			if (w)
@@ -79,10 +183,11 @@ ItemDisplay::ItemDisplay(ZealService* zeal, IO_ini* ini)
 {
 	windows.clear();
 	if (Zeal::EqGame::is_in_game()) init_ui(); /*for testing only must be in game before its loaded or you will crash*/
-	zeal->hooks->Add("SetItem", 0x423640, SetItem, hook_type_detour);
-	zeal->hooks->Add("SetSpell", 0x425957, SetSpell, hook_type_detour);
+	zeal->hooks->Add<SetItem>("SetItem", 0x423640, hook_type_detour);
+	zeal->hooks->Add<SetSpell>("SetSpell", 0x425957, hook_type_detour);
 	zeal->callbacks->add_generic([this]() { init_ui(); }, callback_type::InitUI);
 	zeal->callbacks->add_generic([this]() { CleanUI(); }, callback_type::CleanUI);
+	zeal->callbacks->add_work([this](int) { return build_spare(); }, 1000, work_priority::low);
 	//zeal->callbacks->add_generic([this]() { if (!Zeal::EqGame::is_in_game()) CleanUI(); }, callback_type::MainLoop);
 
 	mem::write<BYTE>(0x4090AB, 0xEB); //for some reason the game when setting spell toggles the item display window unlike with items..this just disables that feature
@@ -95,5 +200,6 @@ ItemDisplay::ItemDisplay(ZealService* zeal, IO_ini* ini)
 
 ItemDisplay::~ItemDisplay()
 {
+	detach_main();
 }
 
@@ -2,18 +2,42 @@
 #include "hook_wrapper.h"
 #include "memory.h"
 #include "EqUI.h"
+#include "settings.h"
+#include <list>
+#include <unordered_map>
+#include <unordered_set>
 
+// item and spell display windows in a pool: an item id -> window map finds the window already showing an item,
+// a use ordered list hands out the least recently used hidden window, grows the pool up to ItemDisplayMax when none
+// is free, and past that reuses the oldest visible one. only the game's own window exists after ui init, the rest are
+// built the first time they're needed (or ahead of time in the background, ItemDisplayWindows of them). a window keeps the description the client formatted for its item, so
+// showing an item whose full record matches what the window already holds skips SetItem's text layout entirely
 class ItemDisplay
 {
 public:
 	ItemDisplay(class ZealService* pHookWrapper, class IO_ini* ini);
 	~ItemDisplay();
 	Zeal::EqUI::ItemDisplayWnd* get_available_window(Zeal::EqStructures::_EQITEMINFO* item);
+	bool holds_formatted(Zeal::EqUI::ItemDisplayWnd* wnd, const Zeal::EqStructures::_EQITEMINFO* item) const; //same id and stats, text still valid
+	void formatted(Zeal::EqUI::ItemDisplayWnd* wnd) { formatted_windows.insert(wnd); }
+	void forget(Zeal::EqUI::ItemDisplayWnd* wnd) { formatted_windows.erase(wnd); }
 	std::vector<Zeal::EqUI::ItemDisplayWnd*> windows;
+	Setting<int> spare_windows{ "Zeal", "ItemDisplayWindows", 0 }; //built one a frame after ui init, besides the game's own
+	Setting<int> max_windows{ "Zeal", "ItemDisplayMax", 10 };
 private:
 	void init_ui();
 	void CleanUI();
-	const int max_item_displays = 5;
+	Zeal::EqUI::ItemDisplayWnd* add_window();
+	void touch(Zeal::EqUI::ItemDisplayWnd* wnd);
+	bool build_spare(); //scheduler work, true while more spares are wanted
+	void detach_main();
+	Zeal::EqUI::ItemDisplayWnd* main_wnd = nullptr; //the game's own window while it points at main_shadow
+	shadow_vtable<Zeal::EqUI::ItemDisplayVtable>* main_shadow = nullptr; //shadows are never freed
+	bool ui_ready = false; //between InitUI and CleanUI, windows can only be built then
+	std::unordered_map<WORD, Zeal::EqUI::ItemDisplayWnd*> by_item; //a hint, checked against the window's own Item.ID
+	std::list<Zeal::EqUI::ItemDisplayWnd*> lru; //front is the least recently used
+	std::unordered_map<Zeal::EqUI::ItemDisplayWnd*, std::list<Zeal::EqUI::ItemDisplayWnd*>::iterator> lru_pos;
+	std::unordered_set<Zeal::EqUI::ItemDisplayWnd*> formatted_windows; //description built by SetItem since the last ui load
 };
 
 
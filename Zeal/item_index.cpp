@@ -0,0 +1,237 @@
+#include "item_index.h"
+#include "Zeal.h"
+#include "string_util.h"
+#include <algorithm>
+
+static const char* equip_names[EQ_NUM_INVENTORY_SLOTS] = { "Left Ear", "Head", "Face", "Right Ear", "Neck", "Shoulders", "Arms", "Back",
+	"Left Wrist", "Right Wrist", "Range", "Hands", "Primary", "Secondary", "Left Finger", "Right Finger", "Chest", "Legs", "Feet", "Waist", "Ammo" };
+
+static bool is_container(const Zeal::EqStructures::EQITEMINFO* item)
+{
+	return item->Type == 1 && item->Container.Capacity > 0;
+}
+
+static WORD stack_count(const Zeal::EqStructures::EQITEMINFO* item)
+{
+	if (item->Type != 1 && item->Common.IsStackable && item->Common.SpellId == 0)
+		return item->Common.StackCount;
+	return 1;
+}
+
+void ItemIndex::insert_name(WORD item_id, const char* name)
+{
+	if (names.count(item_id))
+		return;
+	names[item_id] = name;
+	UINT32 node = 0;
+	for (const char* p = name; *p; ++p)
+	{
+		char c = (char)tolower((unsigned char)*p);
+		auto& children = trie[node].children;
+		auto it = std::lower_bound(children.begin(), children.end(), c, [](const std::pair<char, UINT32>& e, char v) { return e.first < v; });
+		if (it != children.end() && it->first == c)
+		{
+			node = it->second;
+			continue;
+		}
+		UINT32 child = (UINT32)trie.size();
+		children.insert(it, { c, child });
+		trie.emplace_back(); //may move the nodes, children is not used past here
+		node = child;
+	}
+	trie[node].ids.push_back(item_id);
+}
+
+void ItemIndex::set_slot(int slot, Zeal::EqStructures::EQITEMINFO* item)
+{
+	slot_state& s = slots[slot];
+	WORD id = item ? item->ID : 0;
+	WORD count = item ? stack_count(item) : 0;
+	if (s.item == item && s.id == id && s.count == count)
+		return;
+	if (s.item)
+	{
+		std::vector<UINT16>& held = by_id[s.id];
+		held.erase(std::remove(held.begin(), held.end(), (UINT16)slot), held.end());
+	}
+	s = { item, id, count };
+	changes++;
+	if (item)
+	{
+		by_id[id].push_back((UINT16)slot);
+		insert_name(id, item->Name);
+	}
+}
+
+// base is the slot of the bag itself, its contents follow it
+void ItemIndex::scan_bag(int base, Zeal::EqStructures::EQITEMINFO* bag)
+{
+	set_slot(base, bag);
+	bool open = bag && is_container(bag);
+	for (int i = 0; i < bag_size; ++i)
+		set_slot(base + 1 + i, open && i < bag->Container.Capacity ? bag->Container.Item[i] : nullptr);
+}
+
+void ItemIndex::refresh()
+{
+	Zeal::EqStructures::Entity* self = Zeal::EqGame::get_self();
+	Zeal::EqStructures::EQCHARINFO* info = self ? self->CharInfo : nullptr;
+	if (!info)
+	{
+		clear();
+		return;
+	}
+	for (int i = 0; i < EQ_NUM_INVENTORY_SLOTS; ++i)
+		set_slot(equip_base + i, info->InventoryItem[i]);
+	for (int i = 0; i < EQ_NUM_INVENTORY_PACK_SLOTS; ++i)
+		scan_bag(pack_base + i * (bag_size + 1), info->InventoryPackItem[i]);
+	for (int i = 0; i < EQ_NUM_INVENTORY_BANK_SLOTS; ++i)
+		scan_bag(bank_base + i * (bag_size + 1), info->InventoryBankItem[i]);
+	scan_bag(cursor_base, info->CursorItem);
+}
+
+void ItemIndex::clear()
+{
+	for (slot_state& s : slots)
+		s = {};
+	by_id.clear();
+	changes++;
+}
+
+item_location ItemIndex::location(int slot) const
+{
+	item_location loc = { item_area::equip, (BYTE)slot, 0xFF, slots[slot].count };
+	auto in_bags = [&](item_area area, int base) {
+		loc.area = area;
+		loc.slot = (BYTE)((slot - base) / (bag_size + 1));
+		int offset = (slot - base) % (bag_size + 1);
+		loc.bag_slot = offset ? (BYTE)(offset - 1) : 0xFF;
+	};
+	if (slot >= cursor_base)
+		in_bags(item_area::cursor, cursor_base);
+	else if (slot >= bank_base)
+		in_bags(item_area::bank, bank_base);
+	else if (slot >= pack_base)
+		in_bags(item_area::pack, pack_base);
+	return loc;
+}
+
+void ItemIndex::find(WORD item_id, std::vector<item_location>& out)
+{
+	refresh();
+	auto it = by_id.find(item_id);
+	if (it == by_id.end())
+		return;
+	for (UINT16 slot : it->second)
+		out.push_back(location(slot));
+}
+
+int ItemIndex::count(WORD item_id)
+{
+	refresh();
+	auto it = by_id.find(item_id);
+	int total = 0;
+	if (it != by_id.end())
+		for (UINT16 slot : it->second)
+			total += slots[slot].count;
+	return total;
+}
+
+void ItemIndex::collect(UINT32 node, std::vector<WORD>& out, size_t limit) const
+{
+	for (WORD id : trie[node].ids)
+	{
+		if (out.size() >= limit)
+			return;
+		out.push_back(id);
+	}
+	for (const auto& [c, child] : trie[node].children)
+	{
+		if (out.size() >= limit)
+			return;
+		collect(child, out, limit);
+	}
+}
+
+void ItemIndex::find_prefix(const std::string& prefix, std::vector<WORD>& out, size_t limit)
+{
+	refresh();
+	UINT32 node = 0;
+	for (char ch : prefix)
+	{
+		char c = (char)tolower((unsigned char)ch);
+		const auto& children = trie[node].children;
+		auto it = std::lower_bound(children.begin(), children.end(), c, [](const std::pair<char, UINT32>& e, char v) { return e.first < v; });
+		if (it == children.end() || it->first != c)
+			return;
+		node = it->second;
+	}
+	collect(node, out, limit);
+}
+
+const char* ItemIndex::name(WORD item_id) const
+{
+	auto it = names.find(item_id);
+	return it != names.end() ? it->second.c_str() : "";
+}
+
+std::string ItemIndex::describe(const item_location& loc) const
+{
+	char text[64];
+	const char* area = loc.area == item_area::bank ? "Bank" : loc.area == item_area::cursor ? "Cursor" : "General";
+	if (loc.area == item_area::equip)
+		snprintf(text, sizeof(text), "%s", loc.slot < EQ_NUM_INVENTORY_SLOTS ? equip_names[loc.slot] : "Equipped");
+	else if (loc.area == item_area::cursor)
+		snprintf(text, sizeof(text), loc.bag_slot == 0xFF ? "%s" : "%s bag slot %d", area, loc.bag_slot + 1);
+	else if (loc.bag_slot == 0xFF)
+		snprintf(text, sizeof(text), "%s%d", area, loc.slot + 1);
+	else
+		snprintf(text, sizeof(text), "%s%d slot %d", area, loc.slot + 1, loc.bag_slot + 1);
+	return text;
+}
+
+ItemIndex::ItemIndex(ZealService* zeal)
+{
+	zeal->callbacks->add_generic([this]() { clear(); }, callback_type::CharacterSelect);
+	zeal->commands_hook->add("/finditem", {}, "Where an item is across equipment, bags, bank and cursor, /finditem <name prefix | item id>.",
+		[this](std::vector<std::string>& args) {
+			if (args.size() < 2)
+			{
+				Zeal::EqGame::print_chat("usage: /finditem <name prefix | item id>");
+				return true;
+			}
+			std::vector<WORD> ids;
+			int id = 0;
+			if (args.size() == 2 && Zeal::String::tryParse(args[1], &id) && id > 0 && id < 0x10000)
+				ids.push_back((WORD)id);
+			else
+			{
+				std::string prefix = args[1];
+				for (size_t i = 2; i < args.size(); ++i)
+					prefix += " " + args[i];
+				find_prefix(prefix, ids, 50);
+			}
+			int shown = 0;
+			std::vector<item_location> where;
+			for (WORD item_id : ids)
+			{
+				where.clear();
+				find(item_id, where);
+				for (const item_location& loc : where)
+				{
+					if (loc.count > 1)
+						Zeal::EqGame::print_chat("%s (%u): %s x%u", name(item_id), item_id, describe(loc).c_str(), loc.count);
+					else
+						Zeal::EqGame::print_chat("%s (%u): %s", name(item_id), item_id, describe(loc).c_str());
+					shown++;
+				}
+			}
+			if (!shown)
+				Zeal::EqGame::print_chat("No matching item on you or in the bank");
+			return true;
+		});
+}
+
+ItemIndex::~ItemIndex()
+{
+}
@@ -0,0 +1,66 @@
+#pragma once
+#include <Windows.h>
+#include <string>
+#include <unordered_map>
+#include <vector>
+#include "EqStructures.h"
+
+// where every item of the character is, one fixed slot per equip, pack, bank and cursor position (bag contents included)
+// refresh() compares each slot's item pointer, id and count with what was indexed and only re-indexes the slots that changed
+// names go into a prefix trie as items are first seen, so name searches never walk the inventory
+enum struct item_area : BYTE
+{
+	equip,
+	pack,
+	bank,
+	cursor
+};
+struct item_location
+{
+	item_area area;
+	BYTE slot; //equip slot, pack or bank slot
+	BYTE bag_slot; //0xFF when not inside a bag
+	WORD count;
+};
+class ItemIndex
+{
+public:
+	void refresh(); //cheap when nothing changed, queries call it first
+	void find(WORD item_id, std::vector<item_location>& out);
+	void find_prefix(const std::string& prefix, std::vector<WORD>& out, size_t limit); //ids of items seen with a name starting with prefix
+	int count(WORD item_id); //stack total across every slot, for loot rules
+	UINT version() const { return changes; } //bumped whenever refresh() re-indexes a slot
+	const char* name(WORD item_id) const;
+	std::string describe(const item_location& loc) const;
+	ItemIndex(class ZealService* zeal);
+	~ItemIndex();
+private:
+	static constexpr int bag_size = EQ_NUM_CONTAINER_SLOTS;
+	static constexpr int equip_base = 0;
+	static constexpr int pack_base = equip_base + EQ_NUM_INVENTORY_SLOTS;
+	static constexpr int bank_base = pack_base + EQ_NUM_INVENTORY_PACK_SLOTS * (bag_size + 1);
+	static constexpr int cursor_base = bank_base + EQ_NUM_INVENTORY_BANK_SLOTS * (bag_size + 1);
+	static constexpr int slot_count = cursor_base + bag_size + 1;
+	struct slot_state
+	{
+		Zeal::EqStructures::EQITEMINFO* item;
+		WORD id;
+		WORD count;
+	};
+	struct trie_node
+	{
+		std::vector<std::pair<char, UINT32>> children; //sorted by character
+		std::vector<WORD> ids; //items whose lower case name ends here
+	};
+	void clear();
+	void set_slot(int slot, Zeal::EqStructures::EQITEMINFO* item);
+	void scan_bag(int base, Zeal::EqStructures::EQITEMINFO* bag);
+	void insert_name(WORD item_id, const char* name);
+	void collect(UINT32 node, std::vector<WORD>& out, size_t limit) const;
+	item_location location(int slot) const;
+	slot_state slots[slot_count] = {};
+	std::unordered_map<WORD, std::vector<UINT16>> by_id; //item id -> slots holding it
+	std::unordered_map<WORD, std::string> names;
+	std::vector<trie_node> trie{ trie_node() };
+	UINT changes = 0;
+};
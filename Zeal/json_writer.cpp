@@ -0,0 +1,152 @@
+#include "json_writer.h"
+#include "json.hpp"
+#include <charconv>
+#include <cmath>
+#include <cstring>
+
+json_writer& json_writer::key(const char* name)
+{
+	separator();
+	append_string(out, name, strlen(name));
+	out += ':';
+	first = true; //the value follows without a comma
+	return *this;
+}
+
+json_writer& json_writer::value(int v)
+{
+	separator();
+	char buffer[16];
+	auto result = std::to_chars(buffer, buffer + sizeof(buffer), v);
+	out.append(buffer, result.ptr);
+	return *this;
+}
+
+json_writer& json_writer::value(unsigned int v)
+{
+	separator();
+	char buffer[16];
+	auto result = std::to_chars(buffer, buffer + sizeof(buffer), v);
+	out.append(buffer, result.ptr);
+	return *this;
+}
+
+json_writer& json_writer::value(double v)
+{
+	separator();
+	append_number(out, v);
+	return *this;
+}
+
+json_writer& json_writer::value(const char* text, size_t len)
+{
+	separator();
+	append_string(out, text, len);
+	return *this;
+}
+
+//how many bytes from text (a lead byte >= 0x80) fit a well formed utf8 sequence (rfc 3629: no overlong forms,
+//surrogates or code points past U+10FFFF), at least 1 since a bad lead byte is replaced on its own
+static size_t utf8_prefix(const unsigned char* text, size_t len)
+{
+	unsigned char c = text[0];
+	size_t need;
+	unsigned char low = 0x80, high = 0xBF; //range of the second byte
+	if (c >= 0xC2 && c <= 0xDF)
+		need = 2;
+	else if (c >= 0xE0 && c <= 0xEF)
+	{
+		need = 3;
+		if (c == 0xE0)
+			low = 0xA0;
+		else if (c == 0xED)
+			high = 0x9F;
+	}
+	else if (c >= 0xF0 && c <= 0xF4)
+	{
+		need = 4;
+		if (c == 0xF0)
+			low = 0x90;
+		else if (c == 0xF4)
+			high = 0x8F;
+	}
+	else
+		return 1;
+	size_t taken = 1;
+	while (taken < need && taken < len)
+	{
+		unsigned char next = text[taken];
+		if (next < (taken == 1 ? low : 0x80) || next > (taken == 1 ? high : 0xBF))
+			break;
+		taken++;
+	}
+	return taken;
+}
+
+//length of the complete sequence starting at text, 0 when it is truncated or malformed
+static size_t utf8_sequence(const unsigned char* text, size_t len)
+{
+	unsigned char c = text[0];
+	size_t need = c >= 0xF0 ? 4 : c >= 0xE0 ? 3 : 2;
+	size_t taken = utf8_prefix(text, len);
+	return (c >= 0xC2 && c <= 0xF4 && taken == need) ? taken : 0;
+}
+
+void json_writer::append_string(std::string& out, const char* text, size_t len)
+{
+	static const char hex[] = "0123456789abcdef";
+	out += '"';
+	for (size_t i = 0; i < len; i++)
+	{
+		unsigned char c = static_cast<unsigned char>(text[i]);
+		switch (c)
+		{
+		case '"': out += "\\\""; break;
+		case '\\': out += "\\\\"; break;
+		case '\b': out += "\\b"; break;
+		case '\f': out += "\\f"; break;
+		case '\n': out += "\\n"; break;
+		case '\r': out += "\\r"; break;
+		case '\t': out += "\\t"; break;
+		default:
+			if (c < 0x20)
+			{
+				out += "\\u00";
+				out += hex[c >> 4];
+				out += hex[c & 0xF];
+			}
+			else if (c < 0x80)
+				out += static_cast<char>(c);
+			else
+			{
+				size_t valid = utf8_sequence(reinterpret_cast<const unsigned char*>(text) + i, len - i);
+				if (valid)
+				{
+					out.append(text + i, valid);
+					i += valid - 1;
+				}
+				else
+				{
+					//as dump() with error_handler_t::replace: the bytes taken so far become one U+FFFD and the
+					//byte that broke the sequence is read again as the start of the next
+					out += "\xEF\xBF\xBD";
+					i += utf8_prefix(reinterpret_cast<const unsigned char*>(text) + i, len - i) - 1;
+				}
+			}
+		}
+	}
+	out += '"';
+}
+
+// nlohmann's own grisu2 formatter, called directly so the digits match dump() even where grisu2 isn't the shortest form
+void json_writer::append_number(std::string& out, double v)
+{
+	if (!std::isfinite(v))
+	{
+		out += "null";
+		return;
+	}
+	char buffer[64];
+	char* end = nlohmann::detail::to_chars(buffer, buffer + sizeof(buffer), v);
+	out.append(buffer, end);
+}
@@ -0,0 +1,39 @@
+#pragma once
+#include <cstring>
+#include <string>
+
+// streams json text for the pipe straight into a buffer instead of building a nlohmann DOM. strings, integers (to_chars)
+// and floats (nlohmann's own formatter) come out byte for byte as dump() writes them, so pipe consumers see the same
+// messages. nlohmann's objects are sorted by key, so keys have to be written in sorted order to match
+class json_writer
+{
+public:
+	json_writer(std::string& out) : out(out) {}
+	json_writer& begin_object() { separator(); out += '{'; first = true; return *this; }
+	json_writer& end_object() { out += '}'; first = false; return *this; }
+	json_writer& begin_array() { separator(); out += '['; first = true; return *this; }
+	json_writer& end_array() { out += ']'; first = false; return *this; }
+	json_writer& key(const char* name);
+	json_writer& value(int v);
+	json_writer& value(unsigned int v);
+	json_writer& value(long v) { return value(static_cast<int>(v)); }
+	json_writer& value(unsigned long v) { return value(static_cast<unsigned int>(v)); }
+	json_writer& value(double v);
+	json_writer& value(float v) { return value(static_cast<double>(v)); }
+	json_writer& value(const std::string& v) { return value(v.c_str(), v.length()); }
+	json_writer& value(const char* text, size_t len);
+	json_writer& value(const char* text) { return value(text, strlen(text)); }
+	template<typename T>
+	json_writer& field(const char* name, const T& v) { key(name); return value(v); }
+	static void append_string(std::string& out, const char* text, size_t len); //same escaping as nlohmann, invalid utf8 becomes U+FFFD as dump() with error_handler_t::replace
+	static void append_number(std::string& out, double v); //1.0 rather than 1, null for nan and infinities
+private:
+	void separator()
+	{
+		if (!first)
+			out += ',';
+		first = false;
+	}
+	std::string& out;
+	bool first = true;
+};
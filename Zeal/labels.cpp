@@ -5,6 +5,109 @@
 #include "EqUI.h"
 #include "Zeal.h"
 #include "json.hpp"
+#include <algorithm>
+#include <charconv>
+
+// the labels and gauges the client computes itself, by the ids the ui's EQType uses
+static const std::pair<int, const char*> client_labels[] = {
+	{ 1, "Name" },
+	{ 2, "Level" },
+	{ 3, "Class" },
+	{ 4, "Deity" },
+	{ 5, "Strength" },
+	{ 6, "Stamina" },
+	{ 7, "Dexterity" },
+	{ 8, "Agility" },
+	{ 9, "Wisdom" },
+	{ 10, "Intelligence" },
+	{ 11, "Charisma" },
+	{ 12, "SaveVsPoison" },
+	{ 13, "SaveVsDisease" },
+	{ 14, "SaveVsFire" },
+	{ 15, "SaveVsCold" },
+	{ 16, "SaveVsMagic" },
+	{ 17, "CurrentHP" },
+	{ 18, "MaxHP" },
+	{ 19, "HPPerc" },
+	{ 20, "ManaPerc" },
+	{ 21, "STAPerc" },
+	{ 22, "CurrentMitigation" },
+	{ 23, "CurrentOffense" },
+	{ 24, "Weight" },
+	{ 25, "MaxWeight" },
+	{ 26, "ExpPerc" },
+	{ 27, "AltExpPerc" },
+	{ 28, "TargetName" },
+	{ 29, "TargetHPPerc" },
+	{ 30, "GroupMember1Name" },
+	{ 31, "GroupMember2Name" },
+	{ 32, "GroupMember3Name" },
+	{ 33, "GroupMember4Name" },
+	{ 34, "GroupMember5Name" },
+	{ 35, "GroupMember1HPPerc" },
+	{ 36, "GroupMember2HPPerc" },
+	{ 37, "GroupMember3HPPerc" },
+	{ 38, "GroupMember4HPPerc" },
+	{ 39, "GroupMember5HPPerc" },
+	{ 40, "GroupPet1HPPerc" },
+	{ 41, "GroupPet2HPPerc" },
+	{ 42, "GroupPet3HPPerc" },
+	{ 43, "GroupPet4HPPerc" },
+	{ 44, "GroupPet5HPPerc" },
+	{ 45, "Buff0" },
+	{ 46, "Buff1" },
+	{ 47, "Buff2" },
+	{ 48, "Buff3" },
+	{ 49, "Buff4" },
+	{ 50, "Buff5" },
+	{ 51, "Buff6" },
+	{ 52, "Buff7" },
+	{ 53, "Buff8" },
+	{ 54, "Buff9" },
+	{ 55, "Buff10" },
+	{ 56, "Buff11" },
+	{ 57, "Buff12" },
+	{ 58, "Buff13" },
+	{ 59, "Buff14" },
+	{ 60, "Spell1XMLName0" },
+	{ 61, "Spell2XMLName1" },
+	{ 62, "Spell3XMLName2" },
+	{ 63, "Spell4XMLName3" },
+	{ 64, "Spell5XMLName4" },
+	{ 65, "Spell6XMLName5" },
+	{ 66, "Spell7XMLName6" },
+	{ 67, "Spell8XMLName7" },
+	{ 68, "PlayerPetName" },
+	{ 69, "PlayerPetHPPerc" },
+	{ 70, "PlayerCurrentHPMaxHP" },
+	{ 71, "CurrentAAPoints" },
+	{ 72, "CurrentAAPerc" },
+	{ 73, "LastName" },
+	{ 74, "Title" },
+};
+static const std::pair<int, const char*> client_gauges[] = {
+	{ 1, "HP" },
+	{ 2, "Mana" },
+	{ 3, "Stamina" },
+	{ 4, "Experience" },
+	{ 5, "AltExp" },
+	{ 6, "Target" },
+	{ 7, "Casting" },
+	{ 8, "Breath" },
+	{ 9, "Memorize" },
+	{ 10, "Scribe" },
+	{ 11, "Group1HP" },
+	{ 12, "Group2HP" },
+	{ 13, "Group3HP" },
+	{ 14, "Group4HP" },
+	{ 15, "Group5HP" },
+	{ 16, "PetHP" },
+	{ 17, "Group1PetHP" },
+	{ 18, "Group2PetHP" },
+	{ 19, "Group3PetHP" },
+	{ 20, "Group4PetHP" },
+	{ 21, "Group5PetHP" },
+};
 
 void default_empty(Zeal::EqUI::CXSTR* str, bool* override_color, ULONG* color)
 {
@@ -14,108 +117,81 @@ void default_empty(Zeal::EqUI::CXSTR* str, bool* override_color, ULONG* color)
 }
 
 
+// skips the client string write when the label already shows the text. otherwise the text goes to the client's formatter
+// as a %s argument, without zeal's vsnprintf pass in front and with a % in a name taken literally
+static void write_label(Zeal::EqUI::CXSTR* str, const std::string& text)
+{
+	if (str->Data && !str->Data->Encoding && str->Data->Length == text.length() && !strcmp(str->Data->Text, text.c_str()))
+		return;
+	Zeal::EqGame::EqGameInternal::CXStr_PrintString(str, "%s", text.c_str());
+}
+
+void label_value::set_number(int a)
+{
+	write_text = true;
+	numbered = true;
+	UINT64 key = static_cast<UINT32>(a);
+	if (number_count == 1 && numbers == key)
+		return;
+	char buffer[16];
+	char* end = std::to_chars(buffer, buffer + sizeof(buffer), a).ptr;
+	text.assign(buffer, end);
+	numbers = key;
+	number_count = 1;
+}
+
+void label_value::set_number(int a, int b)
+{
+	write_text = true;
+	numbered = true;
+	UINT64 key = static_cast<UINT64>(static_cast<UINT32>(a)) << 32 | static_cast<UINT32>(b);
+	if (number_count == 2 && numbers == key)
+		return;
+	char buffer[32];
+	char* end = std::to_chars(buffer, buffer + sizeof(buffer), a).ptr;
+	*end++ = '/';
+	end = std::to_chars(end, buffer + sizeof(buffer), b).ptr;
+	text.assign(buffer, end);
+	numbers = key;
+	number_count = 2;
+}
+
 bool GetLabelFromEq(int EqType, Zeal::EqUI::CXSTR* str, bool* override_color, ULONG* color)
 {
 	ZealService* zeal = ZealService::get_instance();
 	if (!Zeal::EqGame::is_in_game())
-		return ZealService::get_instance()->hooks->hook_map["GetLabel"]->original(GetLabelFromEq)(EqType, str, override_color, color);
-	switch (EqType)
-	{
-	case 80:
-	{
-		if (!zeal->experience && Zeal::EqGame::get_char_info())
-			return true;
-		int max_mana = Zeal::EqGame::get_char_info()->max_mana();//  Zeal::EqGame::EqGameInternal::get_max_mana(*Zeal::EqGame::ptr_LocalPC, 0);
-		int mana = Zeal::EqGame::get_char_info()->mana(); //Zeal::EqGame::EqGameInternal::get_cur_mana(*Zeal::EqGame::ptr_LocalPC, 0);
-		Zeal::EqGame::CXStr_PrintString(str, "%d/%d", mana, max_mana);
-		*override_color = false;
-		return true;
-	}
-	case 81:
-	{
-		if (!zeal->experience)
-			return true;
-		Zeal::EqGame::CXStr_PrintString(str, "%.f", zeal->experience->exp_per_hour_pct_tot);
-		*override_color = false;
-		return true;
-	}
-	case 82:
+		return hook_ref<GetLabelFromEq>::original()(EqType, str, override_color, color);
+	if (const label_value* value = zeal->labels_hook->get_cached(EqType))
 	{
-		Zeal::EqStructures::Entity* target = Zeal::EqGame::get_target();
-		if (target && target->PetOwnerSpawnId > 0)
-		{
-			Zeal::EqStructures::Entity* owner = Zeal::EqGame::get_entity_by_id(target->PetOwnerSpawnId);
-			if (owner)
-			{
-				Zeal::EqGame::CXStr_PrintString(str, "%s", owner->Name);
-				*override_color = false;
-			}
-		}
-		else
+		if (value->write_text)
+			write_label(str, value->text);
+		if (value->set_color)
 		{
-			default_empty(str, override_color, color);
+			*override_color = value->override_color;
+			if (value->override_color)
+				*color = value->color;
 		}
 		return true;
 	}
-	case 124:
+	if (EqType == 255) //debug label, read once
 	{
-		if (Zeal::EqGame::get_char_info())
-			Zeal::EqGame::CXStr_PrintString(str, "%d", Zeal::EqGame::get_char_info()->mana());
+		Zeal::EqGame::CXStr_PrintString(str, "%s", zeal->labels_hook->debug_info.c_str());
+		zeal->labels_hook->debug_info = "";
 		*override_color = false;
 		return true;
 	}
-	case 125:
-	{
-		if (Zeal::EqGame::get_char_info())
-			Zeal::EqGame::CXStr_PrintString(str, "%d", Zeal::EqGame::get_char_info()->max_mana());
-		*override_color = false;
-		return true;
-	}
-	case 134:
-	{
-		if (Zeal::EqGame::get_controlled() && Zeal::EqGame::get_controlled()->ActorInfo)
-		{
-			if (Zeal::EqGame::get_controlled()->ActorInfo->CastingSpellId) {
-				int spell_id = Zeal::EqGame::get_controlled()->ActorInfo->CastingSpellId;
-				if (spell_id == 65535) spell_id = 0; // avoid crash while player is not casting a spell
-				Zeal::EqStructures::SPELL* casting_spell = Zeal::EqGame::get_spell_mgr()->Spells[spell_id];
-				Zeal::EqGame::CXStr_PrintString(str, "%s", casting_spell->Name);
-				*override_color = false;
-			}
-			
-		}
-		return true;
-	}
-	case 255: //debug label
-	{
-		Zeal::EqGame::CXStr_PrintString(str, "%s", ZealService::get_instance()->labels_hook->debug_info.c_str());
-		ZealService::get_instance()->labels_hook->debug_info = "";
-		*override_color = false;
-		return true;
-	}
-	default:
-		break;
-	}
-	return ZealService::get_instance()->hooks->hook_map["GetLabel"]->original(GetLabelFromEq)(EqType, str, override_color, color);
+	return hook_ref<GetLabelFromEq>::original()(EqType, str, override_color, color);
 }
 
 int GetGaugeFromEq(int EqType, Zeal::EqUI::CXSTR* str)
 {
-	ZealService* zeal = ZealService::get_instance();
-	switch (EqType)
+	if (const gauge_value* value = ZealService::get_instance()->labels_hook->get_cached_gauge(EqType))
 	{
-		case 23:
-		{
-			if (!zeal->experience) //possible nullptr crash (race condition)
-				return 0;
-			float fpct = zeal->experience->exp_per_hour_pct_tot / 100.f;
-			return (int)(1000.f * fpct);
-		}
-		default:
-			break;
+		if (!value->text.empty())
+			write_label(str, value->text);
+		return value->value;
 	}
-
-	return ZealService::get_instance()->hooks->hook_map["GetGauge"]->original(GetGaugeFromEq)(EqType, str);
+	return hook_ref<GetGaugeFromEq>::original()(EqType, str);
 }
 
 void labels::print_debug_info(std::string data)
@@ -136,14 +212,155 @@ void labels::print_debug_info(const char* format, ...)
 		debug_info += std::string(buffer);
 }
 
+void labels::add_label(int id, const char* name, label_provider provider)
+{
+	if (id < 0 || id >= max_label_id)
+		return;
+	label_table[id].name = name;
+	label_table[id].provider = std::move(provider);
+	label_table[id].value = label_value();
+	auto it = std::lower_bound(named_labels.begin(), named_labels.end(), id);
+	if (it == named_labels.end() || *it != id)
+		named_labels.insert(it, id);
+}
+
+void labels::add_gauge(int id, const char* name, gauge_provider provider)
+{
+	if (id < 0 || id >= max_gauge_id)
+		return;
+	gauge_table[id].name = name;
+	gauge_table[id].provider = std::move(provider);
+	gauge_table[id].value = gauge_value();
+	auto it = std::lower_bound(named_gauges.begin(), named_gauges.end(), id);
+	if (it == named_gauges.end() || *it != id)
+		named_gauges.insert(it, id);
+}
+
+// the zeal labels that don't belong to another module
+void labels::register_builtin()
+{
+	for (const auto& [id, name] : client_labels)
+		add_label(id, name);
+	for (const auto& [id, name] : client_gauges)
+		add_gauge(id, name);
+	add_label(80, "Mana/MaxMana", { [](label_value& value) {
+		Zeal::EqStructures::EQCHARINFO* char_info = Zeal::EqGame::get_char_info();
+		if (!char_info)
+		{
+			value.set_color = false;
+			return;
+		}
+		value.set_number(char_info->mana(), char_info->max_mana());
+	}, []() { return (UINT64)(UINT_PTR)Zeal::EqGame::get_char_info(); }, 100, true });
+	add_label(82, "TargetPetOwner", { [](label_value& value) {
+		Zeal::EqStructures::Entity* target = Zeal::EqGame::get_target();
+		if (!target || !target->PetOwnerSpawnId)
+		{
+			value.write_text = true;
+			value.override_color = true;
+			value.color = 0xffc0c0c0;
+			return;
+		}
+		Zeal::EqStructures::Entity* owner = ZealService::get_instance()->pet_tracker->owner(target);
+		if (!owner)
+		{
+			value.set_color = false;
+			return;
+		}
+		value.text = owner->Name;
+		value.write_text = true;
+	}, []() {
+		Zeal::EqStructures::Entity* target = Zeal::EqGame::get_target();
+		return (UINT64)(UINT_PTR)target | (target ? (UINT64)target->PetOwnerSpawnId << 32 : 0);
+	} });
+	for (int id : { 124, 125 })
+	{
+		add_label(id, id == 124 ? "Mana" : "MaxMana", { [id](label_value& value) {
+			Zeal::EqStructures::EQCHARINFO* char_info = Zeal::EqGame::get_char_info();
+			if (!char_info)
+				return;
+			value.set_number(id == 124 ? char_info->mana() : char_info->max_mana());
+		}, []() { return (UINT64)(UINT_PTR)Zeal::EqGame::get_char_info(); }, 100, true });
+	}
+	add_label(134, "CastingName", { [](label_value& value) {
+		Zeal::EqStructures::Entity* controlled = Zeal::EqGame::get_controlled();
+		if (!controlled || !controlled->ActorInfo || !controlled->ActorInfo->CastingSpellId)
+		{
+			value.set_color = false;
+			return;
+		}
+		int spell_id = controlled->ActorInfo->CastingSpellId;
+		if (spell_id == 65535) spell_id = 0; // avoid crash while player is not casting a spell
+		Zeal::EqStructures::SPELL* casting_spell = ZealService::get_instance()->spell_index->get(spell_id);
+		value.text = casting_spell ? casting_spell->Name : "";
+		value.write_text = true;
+	}, []() {
+		Zeal::EqStructures::Entity* controlled = Zeal::EqGame::get_controlled();
+		return (UINT64)(UINT_PTR)controlled | (controlled && controlled->ActorInfo ? (UINT64)controlled->ActorInfo->CastingSpellId << 32 : 0);
+	} });
+}
 
-void labels::callback_main()
+const label_value* labels::get_cached(int EqType)
 {
+	if (EqType < 0 || EqType >= max_label_id || !label_table[EqType].provider.format)
+		return nullptr;
+	label_entry& entry = label_table[EqType];
+	label_value& value = entry.value;
+	if (value.cached && entry.frame == frame)
+		return &value; //someone already asked this frame
+	UINT64 inputs = entry.provider.inputs ? entry.provider.inputs() : 0;
+	ULONGLONG now = GetTickCount64();
+	if (!value.cached || value.inputs != inputs || now - value.computed >= entry.provider.refresh_ms)
+	{
+		value.write_text = false;
+		value.set_color = true;
+		value.override_color = false;
+		if (!entry.provider.numeric)
+		{
+			value.text.clear();
+			value.number_count = 0;
+		}
+		value.numbered = false;
+		entry.provider.format(value);
+		if (!value.numbered)
+			value.number_count = 0; //whatever text holds now, it isn't set_number's
+		value.cached = true;
+		value.inputs = inputs;
+		value.computed = now;
+	}
+	entry.frame = frame;
+	return &value;
+}
 
-	
+const gauge_value* labels::get_cached_gauge(int EqType)
+{
+	if (EqType < 0 || EqType >= max_gauge_id || !gauge_table[EqType].provider.format)
+		return nullptr;
+	gauge_entry& entry = gauge_table[EqType];
+	gauge_value& value = entry.value;
+	if (value.cached && entry.frame == frame)
+		return &value;
+	ULONGLONG now = GetTickCount64();
+	if (!value.cached || now - value.computed >= entry.provider.refresh_ms)
+	{
+		value.text.clear();
+		value.value = entry.provider.format(value.text);
+		value.cached = true;
+		value.computed = now;
+	}
+	entry.frame = frame;
+	return &value;
 }
 
-bool labels::GetLabel(int EqType, std::string& str)
+void labels::invalidate()
+{
+	for (label_entry& entry : label_table)
+		entry.value.cached = false;
+	for (gauge_entry& entry : gauge_table)
+		entry.value.cached = false;
+}
+
+static bool read_client_label(int EqType, std::string& str)
 {
 	Zeal::EqUI::CXSTR tmp("");
 	bool override = false;
@@ -156,7 +373,8 @@ bool labels::GetLabel(int EqType, std::string& str)
 	}
 	return val;
 }
-int labels::GetGauge(int EqType, std::string& str)
+
+static int read_client_gauge(int EqType, std::string& str)
 {
 	Zeal::EqUI::CXSTR tmp("");
 	int value = GetGaugeFromEq(EqType, (Zeal::EqUI::CXSTR*)&tmp);
@@ -168,6 +386,50 @@ int labels::GetGauge(int EqType, std::string& str)
 	return value;
 }
 
+// the pipe and the shared snapshot both sweep every named id, the second one in a frame reads the first one's copy
+bool labels::GetLabel(int EqType, std::string& str)
+{
+	if (!Zeal::EqGame::is_in_game() || EqType < 0 || EqType >= max_label_id || EqType == 255)
+		return read_client_label(EqType, str);
+	if (const label_value* value = get_cached(EqType))
+	{
+		if (value->write_text)
+			str = value->text;
+		return true;
+	}
+	label_entry& entry = label_table[EqType];
+	if (!entry.value.cached || entry.frame != frame)
+	{
+		entry.value.text.clear();
+		entry.found = read_client_label(EqType, entry.value.text);
+		entry.value.cached = true;
+		entry.frame = frame;
+	}
+	str = entry.value.text;
+	return entry.found;
+}
+
+int labels::GetGauge(int EqType, std::string& str)
+{
+	if (EqType < 0 || EqType >= max_gauge_id)
+		return read_client_gauge(EqType, str);
+	if (const gauge_value* value = get_cached_gauge(EqType))
+	{
+		str = value->text;
+		return value->value;
+	}
+	gauge_entry& entry = gauge_table[EqType];
+	if (!entry.value.cached || entry.frame != frame)
+	{
+		entry.value.text.clear();
+		entry.value.value = read_client_gauge(EqType, entry.value.text);
+		entry.value.cached = true;
+		entry.frame = frame;
+	}
+	str = entry.value.text;
+	return entry.value.value;
+}
+
 
 labels::~labels()
 {
@@ -176,6 +438,7 @@ labels::~labels()
 
 labels::labels(ZealService* zeal)
 {
+	register_builtin();
 	zeal->commands_hook->add("/labels", {}, "prints all labels",
 		[this](std::vector<std::string>& args) {
 			for (int i = 0; i < 200; i++)
@@ -185,12 +448,14 @@ labels::labels(ZealService* zeal)
 				ULONG color = 0;
 				GetLabelFromEq(i, (Zeal::EqUI::CXSTR*)&tmp, &override, &color);
 				if (tmp.Data)
-					Zeal::EqGame::print_chat("label: %i value: %s", i, tmp.Data->Text);
+					Zeal::EqGame::print_chat("label: %i %s value: %s", i, label_name(i) ? label_name(i) : "", tmp.Data->Text);
 			}
 			return true; //return true to stop the game from processing any further on this command, false if you want to just add features to an existing cmd
 		});
-	// zeal->callbacks->add_generic([this]() { callback_main(); }); //causes a crash because callback_main is empty
+	zeal->callbacks->add_generic([this]() { frame++; }, callback_type::MainLoop);
+	zeal->callbacks->add_generic([this]() { invalidate(); }, callback_type::Zone);
+	zeal->callbacks->add_generic([this]() { invalidate(); }, callback_type::CharacterSelect);
 	//zeal->hooks->Add("FinalizeLoot", Zeal::EqGame::EqGameInternal::fn_finalizeloot, finalize_loot, hook_type_detour);
-	zeal->hooks->Add("GetLabel", Zeal::EqGame::EqGameInternal::fn_GetLabelFromEQ, GetLabelFromEq, hook_type_detour);
-	zeal->hooks->Add("GetGauge", Zeal::EqGame::EqGameInternal::fn_GetGaugeLabelFromEQ, GetGaugeFromEq, hook_type_detour);
+	zeal->hooks->Add<GetLabelFromEq>("GetLabel", Zeal::EqGame::EqGameInternal::fn_GetLabelFromEQ, hook_type_detour);
+	zeal->hooks->Add<GetGaugeFromEq>("GetGauge", Zeal::EqGame::EqGameInternal::fn_GetGaugeLabelFromEQ, hook_type_detour);
 }
@@ -1,7 +1,55 @@
 #pragma once
 #include "hook_wrapper.h"
 #include "memory.h"
+#include <array>
+#include <functional>
+#include <string>
+#include <vector>
 
+// a zeal label's last computed text, served to the ui and the pipe until its inputs change or it gets older than its provider's refresh_ms
+struct label_value
+{
+	bool cached = false;
+	bool write_text = false; //false leaves the caller's string as it was
+	bool set_color = false;
+	bool override_color = false;
+	ULONG color = 0;
+	UINT64 inputs = 0; //cheap signature of what the text depends on
+	ULONGLONG computed = 0;
+	std::string text;
+	UINT64 numbers = 0; //what set_number last formatted into text
+	BYTE number_count = 0; //0 when text isn't set_number's
+	bool numbered = false; //set_number was called by this format
+	void set_number(int a); //text is the integer, the formatting is skipped when text already holds it
+	void set_number(int a, int b); //"a/b"
+};
+
+// the same for a zeal gauge
+struct gauge_value
+{
+	bool cached = false;
+	int value = 0;
+	std::string text;
+	ULONGLONG computed = 0;
+};
+
+// a zeal label or gauge, registered by id with the module that knows its value. inputs is a cheap signature of what the
+// value depends on, it is recomputed when that changes or refresh_ms passes; a label without inputs only ages out
+struct label_provider
+{
+	std::function<void(label_value&)> format;
+	std::function<UINT64()> inputs;
+	ULONGLONG refresh_ms = 100; //bounds how stale values read through client calls (mana) can get
+	bool numeric = false; //format writes its text with set_number, the text is kept between recomputes instead of cleared
+};
+struct gauge_provider
+{
+	std::function<int(std::string&)> format; //returns the gauge, 0 to 1000
+	ULONGLONG refresh_ms = 100;
+};
+
+// one flat table for every label and gauge id the ui, the pipe and the shared snapshot read. the client's own are listed
+// by name only, zeal's carry a provider. each value is fetched at most once a frame however many consumers ask for it
 class labels
 {
 public:
@@ -12,6 +60,37 @@ public:
 	int GetGauge(int EqType, std::string& str);
 	labels(class ZealService* zeal);
 	~labels();
-	void callback_main();
+	const label_value* get_cached(int EqType); //nullptr for labels the client computes itself
+	const gauge_value* get_cached_gauge(int EqType); //nullptr for gauges the client computes itself
+	void invalidate();
+	void add_label(int id, const char* name, label_provider provider = {}); //no provider names one of the client's
+	void add_gauge(int id, const char* name, gauge_provider provider = {});
+	const std::vector<int>& label_ids() const { return named_labels; } //ascending, every named id
+	const std::vector<int>& gauge_ids() const { return named_gauges; }
+	const char* label_name(int id) const { return id >= 0 && id < max_label_id ? label_table[id].name : nullptr; }
+	const char* gauge_name(int id) const { return id >= 0 && id < max_gauge_id ? gauge_table[id].name : nullptr; }
+	static constexpr int max_label_id = 256;
+	static constexpr int max_gauge_id = 32;
 private:
+	struct label_entry
+	{
+		const char* name = nullptr;
+		label_provider provider;
+		label_value value;
+		bool found = false; //a client label's last GetLabelFromEq result
+		UINT frame = 0; //value was fetched in this frame
+	};
+	struct gauge_entry
+	{
+		const char* name = nullptr;
+		gauge_provider provider;
+		gauge_value value;
+		UINT frame = 0;
+	};
+	void register_builtin();
+	std::array<label_entry, max_label_id> label_table;
+	std::array<gauge_entry, max_gauge_id> gauge_table;
+	std::vector<int> named_labels;
+	std::vector<int> named_gauges;
+	UINT frame = 1; //bumped every main loop
 };
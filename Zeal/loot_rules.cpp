@@ -0,0 +1,146 @@
+#include "loot_rules.h"
+#include "item_index.h"
+#include <algorithm>
+#include <fstream>
+#include <sstream>
+
+static std::string lower(std::string text)
+{
+	std::transform(text.begin(), text.end(), text.begin(), [](char c) { return (char)tolower((unsigned char)c); });
+	return text;
+}
+
+int LootRules::load(const char* path)
+{
+	rules.clear();
+	id_rules.clear();
+	patterns.clear();
+	matched.clear();
+	min_value = 0;
+	std::ifstream file(path);
+	if (!file.is_open())
+		return 0;
+	std::string line;
+	while (std::getline(file, line))
+	{
+		if (line.size() && line.back() == '\r')
+			line.pop_back();
+		std::istringstream words(line);
+		std::string action, target;
+		words >> action;
+		if (action.empty() || action[0] == '#')
+			continue;
+		action = lower(action);
+		if (action == "value")
+		{
+			words >> min_value;
+			continue;
+		}
+		if (action != "loot" && action != "skip")
+			continue;
+		// the target is everything up to an optional trailing "max <count>", names have spaces
+		std::string rest;
+		std::getline(words, rest);
+		rest.erase(0, rest.find_first_not_of(' '));
+		int max_count = 0;
+		size_t max_at = lower(rest).rfind(" max ");
+		if (max_at != std::string::npos)
+		{
+			max_count = atoi(rest.c_str() + max_at + 5);
+			rest.erase(max_at);
+		}
+		while (rest.size() && rest.back() == ' ')
+			rest.pop_back();
+		if (rest.empty())
+			continue;
+		int index = (int)rules.size();
+		rules.push_back({ action == "skip" ? verdict::skip : verdict::loot, max_count });
+		char* end = nullptr;
+		long item_id = strtol(rest.c_str(), &end, 10);
+		if (*end == 0 && item_id > 0 && item_id < 0x10000)
+		{
+			id_rules.emplace((WORD)item_id, index); //the first line for an id wins
+			continue;
+		}
+		pattern p{ "", "", index };
+		for (char c : lower(rest))
+			if (c != '*' || p.text.empty() || p.text.back() != '*')
+				p.text += c;
+		p.prefix = p.text.substr(0, p.text.find_first_of("*?"));
+		patterns.push_back(p);
+	}
+	return (int)rules.size();
+}
+
+// iterative wildcard match, backtracks only to the last * seen
+bool LootRules::glob(const char* pattern, const char* text)
+{
+	const char* star = nullptr;
+	const char* resume = nullptr;
+	while (*text)
+	{
+		char c = (char)tolower((unsigned char)*text);
+		if (*pattern == '?' || *pattern == c)
+		{
+			pattern++;
+			text++;
+		}
+		else if (*pattern == '*')
+		{
+			star = pattern++;
+			resume = text;
+		}
+		else if (star)
+		{
+			pattern = star + 1;
+			text = ++resume;
+		}
+		else
+			return false;
+	}
+	while (*pattern == '*')
+		pattern++;
+	return *pattern == 0;
+}
+
+int LootRules::match(const Zeal::EqStructures::EQITEMINFO* item)
+{
+	auto cached = matched.find(item->ID);
+	if (cached != matched.end())
+		return cached->second;
+	int result = -1;
+	auto by_id = id_rules.find(item->ID);
+	if (by_id != id_rules.end())
+		result = by_id->second;
+	else
+	{
+		for (const pattern& p : patterns)
+		{
+			if (_strnicmp(item->Name, p.prefix.c_str(), p.prefix.size()))
+				continue;
+			if (glob(p.text.c_str(), item->Name))
+			{
+				result = p.rule;
+				break;
+			}
+		}
+	}
+	matched[item->ID] = result;
+	return result;
+}
+
+bool LootRules::wants(Zeal::EqStructures::EQITEMINFO* item, ItemIndex& items)
+{
+	int index = match(item);
+	if (index < 0 && (!min_value || item->Cost < min_value))
+		return false;
+	if (index >= 0 && rules[index].action == verdict::skip)
+		return false;
+	int max_count = index >= 0 ? rules[index].max_count : 0;
+	if (!item->Lore && !max_count)
+		return true;
+	int have = items.count(item->ID);
+	if (item->Lore && have) //the server refuses a second lore item, it would only stall the batch
+		return false;
+	return !max_count || have < max_count;
+}
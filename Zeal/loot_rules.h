@@ -0,0 +1,44 @@
+#pragma once
+#include <Windows.h>
+#include <string>
+#include <unordered_map>
+#include <vector>
+#include "EqStructures.h"
+
+// auto loot rules read from zeal_loot.txt, one per line:
+//   loot <item id | name pattern> [max <count>]   take it, optionally only while we hold fewer than count
+//   skip <item id | name pattern>                  never take it
+//   value <copper>                                 take anything else worth at least this much
+// patterns use * and ? and ignore case. an id line beats any pattern, otherwise the first matching line wins.
+// the id and pattern part of a decision never changes for an item id, so it is matched once and cached
+class LootRules
+{
+public:
+	int load(const char* path); //number of rules read, replaces the current set
+	bool wants(Zeal::EqStructures::EQITEMINFO* item, class ItemIndex& items);
+	size_t size() const { return rules.size(); }
+	DWORD min_value = 0; //0 disables the value rule
+private:
+	enum struct verdict : BYTE
+	{
+		loot,
+		skip
+	};
+	struct rule
+	{
+		verdict action;
+		int max_count; //0 for no limit
+	};
+	struct pattern
+	{
+		std::string text; //lower case, runs of * collapsed
+		std::string prefix; //literal text before the first wildcard, a cheap reject
+		int rule;
+	};
+	int match(const Zeal::EqStructures::EQITEMINFO* item); //rule index or -1
+	static bool glob(const char* pattern, const char* text);
+	std::vector<rule> rules;
+	std::unordered_map<WORD, int> id_rules; //item id -> rule index
+	std::vector<pattern> patterns;
+	std::unordered_map<WORD, int> matched; //item id -> match() result
+};
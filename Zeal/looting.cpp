@@ -18,7 +18,7 @@ void looting::set_hide_looted(bool val)
 {
 	hide_looted = val;
 	ZealService::get_instance()->ini->setValue<bool>("Zeal", "HideLooted", hide_looted);
-	ZealService::get_instance()->ui->options->UpdateOptions();
+	ZealService::get_instance()->ui->options->changed(ui_options::option::hide_corpse);
 	if (hide_looted)
 		Zeal::EqGame::print_chat("Corpses will be hidden after looting.");
 	else
@@ -34,7 +34,7 @@ void __fastcall release_loot(int uk, int lootwnd_ptr)
 	{
 		corpse->ActorInfo->IsInvisible = 1; //this is the flag set by /hidecorpse all (so /hidecorpse none will reshow these hidden corpses)
 	}
-	zeal->hooks->hook_map["ReleaseLoot"]->original(release_loot)(uk, lootwnd_ptr);
+	hook_ref<release_loot>::original()(uk, lootwnd_ptr);
 }
 
 looting::~looting()
@@ -69,80 +69,155 @@ void looting::init_ui()
 //li.slot_id = Zeal::EqGame::Windows->Loot->ItemSlotIndex[i];
 //Zeal::EqGame::send_message(0x40a0, (int*)&li, sizeof(li), 1);
 
-void looting::looted_item()
+static bool loot_window_open()
 {
-	if (Zeal::EqGame::get_char_info()->CursorItem) 
+	return Zeal::EqGame::Windows && Zeal::EqGame::Windows->Loot && Zeal::EqGame::Windows->Loot->IsVisible;
+}
+
+void looting::queue_loot(bool use_rules)
+{
+	stop();
+	Zeal::EqStructures::Entity* corpse = Zeal::EqGame::get_active_corpse();
+	if (!loot_window_open() || !corpse || Zeal::EqGame::get_char_info()->CursorItem)
+		return;
+	ZealService* zeal = ZealService::get_instance();
+	std::string corpse_name = Zeal::EqGame::strip_name(corpse->Name);
+	std::string self_name = Zeal::EqGame::get_self()->Name;
+	bool is_me = corpse_name == self_name; //my own corpse
+	if (is_me && use_rules) //rules are for loot, not for our own gear
+		return;
+	int item_count = 0;
+	for (int i = 0; i < EQ_NUM_LOOT_WINDOW_ITEMS; i++)
+		if (Zeal::EqGame::Windows->Loot->Item[i])
+			item_count++;
+
+	if (is_me && item_count == 1)
 	{
-		loot_all = false;
-		loot_next_item_time = 0;
+		Zeal::EqGame::print_chat(USERCOLOR_LOOT, "Loot all but 1 item on your own corpse for safety, you may click the item to loot it yourself.");
 		return;
 	}
-	if (loot_all && Zeal::EqGame::Windows && Zeal::EqGame::Windows->Loot && Zeal::EqGame::Windows->Loot->IsVisible)
+	for (int i = 0; i < EQ_NUM_LOOT_WINDOW_ITEMS; i++)
 	{
-		std::string corpse_name = Zeal::EqGame::strip_name(Zeal::EqGame::get_active_corpse()->Name);
-		std::string self_name = Zeal::EqGame::get_self()->Name;
-		bool is_me = corpse_name == self_name; //my own corpse
-		byte nodrop_confirm_bypass[2] = { 0x74, 0x22 };
-		int item_count = 0;
-		for (int i = 0; i < 30; i++)
-			if (Zeal::EqGame::Windows->Loot->Item[i])
-				item_count++;
+		Zeal::EqStructures::EQITEMINFO* item = Zeal::EqGame::Windows->Loot->Item[i];
+		if (!item)
+			continue;
+		bool loot = false;
+		if (is_me)
+			loot = true;
+		else if (item->NoDrop == 0)
+			loot = false;
+		else if (use_rules)
+			loot = rules.wants(item, *zeal->item_index);
+		else
+			loot = !(item->Lore && zeal->item_index->count(item->ID)); //a duplicate lore item would only be refused
+		if (loot)
+			loot_queue.push_back(i);
+	}
+	if (is_me && (int)loot_queue.size() == item_count)
+		loot_queue.pop_back();
+	pump();
+}
 
-		if (is_me && item_count == 1)
-		{
-			Zeal::EqGame::print_chat(USERCOLOR_LOOT, "Loot all but 1 item on your own corpse for safety, you may click the item to loot it yourself.");
-			loot_all = false;
-			return;
-		}
-		for (int i = 0; i < 30; i++)
-		{
-			bool loot = false;
-			if (Zeal::EqGame::Windows->Loot->Item[i])
-			{
-				if (is_me && item_count>1)
-					loot = true;
-				else if (Zeal::EqGame::Windows->Loot->Item[i]->NoDrop != 0)
-					loot = true;
+void looting::stop()
+{
+	loot_queue.clear();
+	queue_pos = 0;
+	in_flight = 0;
+}
 
-				if (loot)
-				{
-					Zeal::EqGame::Windows->Loot->RequestLootSlot(i, true);
-					return;
-				}
-			}
-		}
-		loot_all = false;
+void looting::pump()
+{
+	if (loot_queue.empty())
+		return;
+	if (!loot_window_open() || Zeal::EqGame::get_char_info()->CursorItem)
+	{
+		stop();
+		return;
+	}
+	ULONGLONG now = GetTickCount64();
+	if (in_flight && now - last_request > 1500) //no reply, don't wait on it forever
+		in_flight = 0;
+	int depth = pipeline.get() < 1 ? 1 : pipeline.get();
+	while (in_flight < depth && queue_pos < loot_queue.size())
+	{
+		int slot = loot_queue[queue_pos++];
+		if (!Zeal::EqGame::Windows->Loot->Item[slot])
+			continue;
+		Zeal::EqGame::Windows->Loot->RequestLootSlot(slot, true);
+		in_flight++;
+		last_request = now;
+	}
+	if (queue_pos >= loot_queue.size() && !in_flight)
+		stop();
+}
+
+void looting::test_rules()
+{
+	if (!loot_window_open())
+	{
+		Zeal::EqGame::print_chat("Open a loot window to test the loot rules against it");
+		return;
+	}
+	ZealService* zeal = ZealService::get_instance();
+	for (int i = 0; i < EQ_NUM_LOOT_WINDOW_ITEMS; i++)
+	{
+		Zeal::EqStructures::EQITEMINFO* item = Zeal::EqGame::Windows->Loot->Item[i];
+		if (item)
+			Zeal::EqGame::print_chat("%s (%u): %s", item->Name, item->ID, item->NoDrop && rules.wants(item, *zeal->item_index) ? "loot" : "leave");
 	}
-	else
-		loot_all = false;
 }
 
 looting::looting(ZealService* zeal)
 {
 	hide_looted = zeal->ini->getValue<bool>("Zeal", "HideLooted"); //just remembers the state
+	rules.load(".\\zeal_loot.txt");
 	zeal->callbacks->add_generic([this]() { init_ui(); }, callback_type::InitUI);
 	zeal->callbacks->add_generic([this]() {
-		if (loot_next_item_time == 0)
-			return;
-		if (!Zeal::EqGame::Windows || !Zeal::EqGame::Windows->Loot || !Zeal::EqGame::Windows->Loot->IsVisible)
+		if (!loot_window_open())
 		{
-			loot_next_item_time = 0;
-			loot_all = false;
+			stop();
+			window_opened = 0;
+			evaluated_corpse = 0;
 			return;
 		}
-		if (GetTickCount64() >= loot_next_item_time && loot_all)
+		ULONGLONG now = GetTickCount64();
+		if (!window_opened)
+			window_opened = now;
+		Zeal::EqStructures::Entity* corpse = Zeal::EqGame::get_active_corpse();
+		// the items arrive just after the window opens, give them a moment before judging the corpse
+		if (auto_loot.get() && corpse && corpse->SpawnId != evaluated_corpse && now - window_opened > 150)
 		{
-			looted_item();
-			loot_next_item_time = 0;
+			evaluated_corpse = corpse->SpawnId;
+			queue_loot(true);
 		}
+		pump();
 	}, callback_type::MainLoop);
 	zeal->callbacks->add_packet([this](UINT opcode, char* buffer, UINT len) {
-			if (opcode == 0x4031)
+		if (in_flight)
+			in_flight--;
+		return false; 
+	}, { 0x4031 });
+	zeal->commands_hook->add("/autoloot", {}, "Loot rules from zeal_loot.txt, /autoloot [on | off | now | reload | test].",
+		[this](std::vector<std::string>& args) {
+			if (args.size() > 1 && Zeal::String::compare_insensitive(args[1], "on"))
+				auto_loot.set(true);
+			else if (args.size() > 1 && Zeal::String::compare_insensitive(args[1], "off"))
+				auto_loot.set(false);
+			else if (args.size() > 1 && Zeal::String::compare_insensitive(args[1], "now"))
 			{
-				loot_next_item_time = GetTickCount64() + 250;
+				queue_loot(true);
+				return true;
 			}
-		return false; 
-	});
+			else if (args.size() > 1 && Zeal::String::compare_insensitive(args[1], "reload"))
+				rules.load(".\\zeal_loot.txt");
+			else if (args.size() > 1 && Zeal::String::compare_insensitive(args[1], "test"))
+			{
+				test_rules();
+				return true;
+			}
+			Zeal::EqGame::print_chat("Auto loot is %s, %u rules, value threshold %u copper", auto_loot.get() ? "on" : "off", (UINT)rules.size(), rules.min_value);
+			return true;
+		});
 	zeal->commands_hook->add("/hidecorpse", { "/hc", "/hideco", "/hidec" }, "Adds looted argument to hidecorpse.",
 		[this](std::vector<std::string>& args) {
 			if (args.size() > 1 && Zeal::String::compare_insensitive(args[1], "looted"))
@@ -158,7 +233,7 @@ looting::looting(ZealService* zeal)
 			return false;
 		});
 	
-	zeal->hooks->Add("ReleaseLoot", Zeal::EqGame::EqGameInternal::fn_releaseloot, release_loot, hook_type_detour);
+	zeal->hooks->Add<release_loot>("ReleaseLoot", Zeal::EqGame::EqGameInternal::fn_releaseloot, hook_type_detour);
 	if (Zeal::EqGame::is_in_game())
 		init_ui();
 }
@@ -1,6 +1,8 @@
 #pragma once
 #include "hook_wrapper.h"
 #include "memory.h"
+#include "loot_rules.h"
+#include "settings.h"
 
 class looting
 {
@@ -8,11 +10,20 @@ public:
 	void set_hide_looted(bool val);
 	bool hide_looted;
 	void init_ui();
-	bool loot_all=false;
-	ULONGLONG loot_next_item_time = 0;
-	void looted_item();
+	void queue_loot(bool use_rules); //picks every slot to take in one pass, pump() then keeps a few requests in flight
+	Setting<bool> auto_loot{ "Zeal", "AutoLoot", false }; //apply the loot rules whenever a loot window opens
+	Setting<int> pipeline{ "Zeal", "LootPipeline", 3 }; //loot requests sent ahead of the server's replies
+	LootRules rules;
 	looting(class ZealService* zeal);
 	~looting();
 private:
-	int last_looted = -1;
+	void pump();
+	void stop();
+	void test_rules();
+	std::vector<int> loot_queue; //loot window slots still to request
+	size_t queue_pos = 0;
+	int in_flight = 0;
+	ULONGLONG last_request = 0;
+	ULONGLONG window_opened = 0;
+	WORD evaluated_corpse = 0; //auto loot ran for this corpse, until the window closes
 };
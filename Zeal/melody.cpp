@@ -22,7 +22,7 @@
 //   - New /melody without a /stopsong transitions cleanly after current song
 //   - /stopsong immediately stops (aborts) active song
 // - Check basic song looping functionality (single song, multiple songs)
-// - Retry logic for missed notes (correct rewind of song index, retry timeout)\
+// - Retry logic for missed notes (same song retried, retry timeout)
 //   - Should advance song after 8 retries (try Selo's indoors)
 //   - Should terminate melody after 15 failures without a success
 // - Graceful handling of spells without single target
@@ -32,15 +32,22 @@
 // - Paused when zoning, trading, looting, or ducking and then resumed
 
 // Issues list:
-// - There's a timing window vulnerability if a UI gem is clicked right as a melody song
-//   ends. The click should terminate melody but it doesn't always work and melody just
-//   continues after that song is cast (can be confusing). When the current song is
-//   failing (like Selo's indoors), the vulnerable timing window is dominant, making it
-//   hard to click off the melody with the UI. The new retry_count logic mitigates this.
+// - Clicking a UI gem right as a melody song ended used to race the next song. Every cast
+//   request now passes through the CastSpell hook, so any cast melody did not issue itself
+//   ends the melody on the spot.
 
+// Scheduling is event driven:
+// - CastSpell hook: a cast request that isn't ours ends the melody.
+// - StopCast hook: interrupts end the melody, missed notes (reason 3) retry the song.
+// - Cast bar closing while Casting: the song completed, the next one is issued on that frame.
+// The per frame tick only watches for that edge and the terminating conditions (sitting,
+// stunned, zoning); there are no fixed delays between songs. A song whose gem the cast
+// tracker still has in recovery waits for it instead of being refused and retried.
 
-constexpr int RETRY_COUNT_REWIND_LIMIT = 8;  // Will rewind up to 8 times.
+
+constexpr int RETRY_COUNT_REWIND_LIMIT = 8;  // Will retry a song up to 8 times.
 constexpr int RETRY_COUNT_END_LIMIT = 15;  // Will terminate if 15 retries w/out a 'success'.
+constexpr ULONGLONG PENDING_TIMEOUT_MS = 250;  // Cast requested but the client never showed the cast bar.
 
 bool Melody::start(const std::vector<int>& new_songs)
 {
@@ -77,129 +84,176 @@ bool Melody::start(const std::vector<int>& new_songs)
     }
 
     songs = new_songs;
-    current_index = -1;
+    current_index = 0;
     retry_count = 0;
+    state = songs.size() ? State::Ready : State::Idle;
     if (songs.size())
+    {
         Zeal::EqGame::print_chat(USERCOLOR_SPELLS, "You begin playing a melody.");
+        tick();  // First song on this frame if the client is idle.
+    }
     return true;
 }
 
 void Melody::end()
 {
+    state = State::Idle;
     if (songs.size())
     {
-        current_index = -1;
+        current_index = 0;
         songs.clear();
         retry_count = 0;
         Zeal::EqGame::print_chat(USERCOLOR_SPELL_FAILURE, "Your melody has ended.");
     }
 }
 
+void Melody::advance()
+{
+    current_index++;
+    if (current_index >= songs.size() || current_index < 0)
+        current_index = 0;
+}
+
 void Melody::handle_stop_cast_callback(BYTE reason)
 {
-    // Terminate melody on stop except for missed note (part of reason == 3) rewind attempts.
+    // Terminate melody on stop except for missed note (part of reason == 3) retry attempts.
     if (reason != 3 || !songs.size())
     {
         end();
         return;
     }
+    if (state != State::Pending && state != State::Casting)
+        return;  // Not one of our songs.
 
-    // Support rewinding to the interrupted last song (primarily for missed notes).
     // Note that reason code == 3 is shared by missed notes as well as other failures (such as the spell
-    // is not allowed in the zone), so we use a retry_count to limit the spammy loop that is
-    // difficult to click off with UI spell gems (/stopsong, /melody still work fine). The modulo
-    // check skips the rewind so it advances to the next song but then allows that song to retry.
-    if ((current_index >= 0) && (++retry_count % RETRY_COUNT_REWIND_LIMIT)) {
-        current_index--;
-        if (current_index < 0) {  // Handle wraparound.
-            current_index = songs.size() - 1;
-        }
-    }
+    // is not allowed in the zone), so we use a retry_count to limit the spammy loop. The modulo
+    // check advances to the next song but then allows that song to retry.
+    if (!(++retry_count % RETRY_COUNT_REWIND_LIMIT))
+        advance();
+    state = State::Ready;
+}
+
+void Melody::handle_cast_callback(UINT gem)
+{
+    if (!issuing && state != State::Idle && gem < EQ_NUM_SPELL_GEMS)
+        end();  // The player cast something themselves.
 }
 
 void __fastcall StopCast(int t, int u, BYTE reason, short spell_id)
 {
+    ZealService::get_instance()->cast_tracker->on_stop_cast(reason);
     ZealService::get_instance()->melody->handle_stop_cast_callback(reason);
-    ZealService::get_instance()->hooks->hook_map["StopCast"]->original(StopCast)(t, u, reason, spell_id);
+    hook_ref<StopCast>::original()(t, u, reason, spell_id);
+}
+
+int __fastcall CastSpell(int t, int u, UINT gem, short spell_id, int* item, short un)
+{
+    ZealService::get_instance()->cast_tracker->on_cast_request(gem);
+    ZealService::get_instance()->melody->handle_cast_callback(gem);
+    return hook_ref<CastSpell>::original()(t, u, gem, spell_id, item, un);
 }
 
 void Melody::stop_current_cast()
 {
-    // Note: This code assumes the current_index is valid to look up the spell_id for the StopCast call.
     Zeal::EqStructures::EQCHARINFO* char_info = Zeal::EqGame::get_char_info();
-    if (char_info && current_index>=0 && current_index < songs.size())
-        ZealService::get_instance()->hooks->hook_map["StopCast"]->original(StopCast)((int)char_info, 0, 0, char_info->MemorizedSpell[songs[current_index]]);
+    if (char_info && singing_spell_id != -1)
+        hook_ref<StopCast>::original()((int)char_info, 0, 0, singing_spell_id);
 }
 
-void Melody::tick()
+void Melody::try_cast()
 {
-    if (!songs.size())
-        return;
-
     Zeal::EqStructures::Entity* self = Zeal::EqGame::get_self();
     Zeal::EqStructures::EQCHARINFO* char_info = Zeal::EqGame::get_char_info();
 
-    // Handle various reasons to terminate Zeal automatically.
-    if (!Zeal::EqGame::is_in_game() || !self || !char_info ||
-        (self->StandingState == Stance::Sit) || (char_info->StunnedState) ||
-        (retry_count > RETRY_COUNT_END_LIMIT))
+    // Handles situations like trade windows, looting (Stance::Bind), and ducking.
+    if (!Zeal::EqGame::get_eq() || !Zeal::EqGame::get_eq()->IsOkToTransact() ||
+        self->StandingState != Stance::Stand)
+        return;
+
+    int current_gem = songs[current_index];  // songs is 'guaranteed' to have a valid gem index from start().
+    if (char_info->MemorizedSpell[current_gem] == -1)
     {
-        end();
+        advance();  //simply skip empty gem slots (unexpected to occur)
         return;
     }
 
-    //use timestamps to add minimum delay after casting ends and detect excessive retries.
-    static ULONGLONG casting_visible_timestamp = GetTickCount64();
-    static ULONGLONG start_of_cast_timestamp = casting_visible_timestamp;
-
-    ULONGLONG current_timestamp = GetTickCount64();
-    if (!Zeal::EqGame::Windows->Casting || Zeal::EqGame::Windows->Casting->IsVisible)
+    //handle a common issue of no target gracefully (notify and skip to next song).
+    Zeal::EqStructures::SPELL* spell = ZealService::get_instance()->spell_index->get(char_info->MemorizedSpell[current_gem]);
+    if (spell && spell->TargetType == 5 &&
+        !Zeal::EqGame::get_target())
     {
-        casting_visible_timestamp = current_timestamp;
-        //reset retry_count if the song cast window has been visible for > 1 second.
-        if ((casting_visible_timestamp - start_of_cast_timestamp) > 1000)
-            retry_count = 0;
+        Zeal::EqGame::print_chat(USERCOLOR_SPELL_FAILURE, "You must first select a target for spell %i", current_gem + 1);
+        retry_count++;  // Re-use the retry logic to limit runaway spam if entire song list is target-based.
+        advance();
         return;
     }
 
-    if ((current_timestamp - casting_visible_timestamp) < 150)
-        return;
- 
-    // Handles situations like trade windows, looting (Stance::Bind), and ducking.
-    if (!Zeal::EqGame::get_eq() || !Zeal::EqGame::get_eq()->IsOkToTransact() ||
-        self->StandingState != Stance::Stand)
-        return;
+    if (ZealService::get_instance()->cast_tracker->ready_in(current_gem))
+        return;  // Still in recovery, issued on the frame it comes back.
 
     if (self->ActorInfo && self->ActorInfo->CastingSpellGemNumber == 255) //255 = Bard Singing
         stop_current_cast();  //abort bard song if active.
 
-    current_index++;
-    if (current_index >= songs.size() || current_index < 0)
-        current_index = 0;
+    issuing = true;
+    char_info->cast(current_gem, char_info->MemorizedSpell[current_gem], 0, 0);
+    issuing = false;
+    singing_spell_id = char_info->MemorizedSpell[current_gem];
+    pending_timestamp = GetTickCount64();
+    state = State::Pending;
+}
 
-    int current_gem = songs[current_index];  // songs is 'guaranteed' to have a valid gem index from start().
-    if (char_info->MemorizedSpell[current_gem] == -1)
-        return;  //simply skip empty gem slots (unexpected to occur)
+void Melody::tick()
+{
+    if (state == State::Idle)
+        return;
 
-    //handle a common issue of no target gracefully (notify once and skip to next song w/out retry failures).
-    if (Zeal::EqGame::get_spell_mgr() &&
-        Zeal::EqGame::get_spell_mgr()->Spells[char_info->MemorizedSpell[current_gem]]->TargetType == 5 &&
-        !Zeal::EqGame::get_target())
+    Zeal::EqStructures::Entity* self = Zeal::EqGame::get_self();
+    Zeal::EqStructures::EQCHARINFO* char_info = Zeal::EqGame::get_char_info();
+
+    // Handle various reasons to terminate Zeal automatically.
+    if (!Zeal::EqGame::is_in_game() || !self || !char_info ||
+        (self->StandingState == Stance::Sit) || (char_info->StunnedState) ||
+        (retry_count > RETRY_COUNT_END_LIMIT))
     {
-        Zeal::EqGame::print_chat(USERCOLOR_SPELL_FAILURE, "You must first select a target for spell %i", current_gem + 1);
-        retry_count++;  // Re-use the retry logic to limit runaway spam if entire song list is target-based.
+        end();
         return;
     }
 
-    char_info->cast(current_gem, char_info->MemorizedSpell[current_gem], 0, 0);
-    start_of_cast_timestamp = current_timestamp;
+    bool cast_bar_up = !Zeal::EqGame::Windows->Casting || Zeal::EqGame::Windows->Casting->IsVisible;
+    switch (state)
+    {
+    case State::Pending:
+        if (cast_bar_up)
+        {
+            state = State::Casting;
+            return;
+        }
+        if (GetTickCount64() - pending_timestamp < PENDING_TIMEOUT_MS)
+            return;
+        retry_count++;  // The client refused the cast, try the same song again.
+        state = State::Ready;
+        break;
+    case State::Casting:
+        if (cast_bar_up)
+            return;
+        retry_count = 0;  // Completed.
+        advance();
+        state = State::Ready;
+        break;
+    default:
+        break;
+    }
+
+    if (state == State::Ready && !cast_bar_up)
+        try_cast();
 }
 
 Melody::Melody(ZealService* zeal, IO_ini* ini)
 {
     zeal->callbacks->add_generic([this]() { tick();  });
     zeal->callbacks->add_generic([this]() { end(); }, callback_type::CharacterSelect);
-    zeal->hooks->Add("StopCast", 0x4cb510, StopCast, hook_type_detour); //Hook in to end melody as well.
+    zeal->hooks->Add<StopCast>("StopCast", 0x4cb510, hook_type_detour); //Hook in to end melody as well, also feeds the cast tracker.
+    zeal->hooks->Add<CastSpell>("CastSpell", 0x4c483b, hook_type_detour); //Casts melody didn't issue end it, also feeds the cast tracker.
     zeal->commands_hook->add("/melody", {"/mel"}, "Bard only, auto cycles 5 songs of your choice.",
         [this](std::vector<std::string>& args) {
 
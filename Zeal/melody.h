@@ -8,14 +8,26 @@ public:
 	bool start(const std::vector<int>& new_songs); //returns true if no errors
 	void end();
 	void handle_stop_cast_callback(BYTE reason);
+	void handle_cast_callback(UINT gem); //every cast request, ours included
 	Melody(class ZealService* pHookWrapper, class IO_ini* ini);
 	~Melody();
 private:
+	enum class State
+	{
+		Idle,     // No melody.
+		Ready,    // Issue songs[current_index] as soon as the client allows it.
+		Pending,  // Cast requested, waiting for the cast bar to appear.
+		Casting,  // Cast bar up, the bar closing is the song completing.
+	};
 	void tick();
+	void try_cast();
+	void advance();
 	void stop_current_cast();
-	int current_index = 0;  // Active song index. -1 if not started yet.
+	State state = State::Idle;
+	int current_index = 0;  // Song to cast next (Ready) or being cast (Pending, Casting).
 	std::vector<int> songs; // Gem indices (base 0) for melody.
 	int retry_count = 0; // Tracks unsuccessful song casts.
-
+	short singing_spell_id = -1;  // Last song issued, used to stop it before the next.
+	ULONGLONG pending_timestamp = 0;
+	bool issuing = false;  // Set while our own cast request is in flight.
 };
-
@@ -1,40 +1,194 @@
 #include "memory.h"
+#include "FindPattern.h"
 #include <TlHelp32.h>
 #include <regex>
 #include <Psapi.h>
-#define INRANGE(x,a,b)  (x >= a && x <= b) 
-#define getBits( x )    (INRANGE((x&(~0x20)),'A','F') ? ((x&(~0x20)) - 'A' + 0xa) : (INRANGE(x,'0','9') ? x - '0' : 0))
-#define getByte( x )    (getBits(x[0]) << 4 | getBits(x[1]))
+#include <vector>
+#include <map>
+#include <mutex>
+#include <atomic>
 
 namespace mem
 {
-	uint64_t FindPattern(uint64_t rangeStart, uint64_t rangeEnd, const char* pattern)
+	struct staged_patch
+	{
+		int target;
+		std::vector<BYTE> bytes;
+	};
+	// a batch belongs to the thread that opened it: the lock is held from begin_batch to commit_batch, and only the owner's
+	// writes are staged, hooks added from a worker or a setting callback meanwhile write directly
+	static std::recursive_mutex batch_lock;
+	static std::atomic<DWORD> batch_owner = 0;
+	static std::vector<staged_patch> staged;
+	static constexpr int max_patch_retries = 100;
+
+	struct page_hold
+	{
+		DWORD original = 0; //0 when the VirtualProtect failed and there's nothing to put back
+		int refs = 0;
+	};
+	static std::mutex page_lock;
+	static std::map<int, page_hold> held_pages; //page start -> protection before the first holder
+	static std::unordered_map<int, size_t> held_ranges; //unprotect_memory targets, reset_memory_protection only gets the address
+
+	static int page_size()
+	{
+		static const int size = []() { SYSTEM_INFO si; GetSystemInfo(&si); return (int)si.dwPageSize; }();
+		return size;
+	}
+
+	void acquire_pages(int target, size_t size)
 	{
-		const char* pat = pattern;
-		uint64_t firstMatch = 0;
-		for (uint64_t pCur = rangeStart; pCur < rangeEnd; pCur++)
+		if (!size)
+			return;
+		const int page = page_size();
+		std::lock_guard<std::mutex> guard(page_lock);
+		for (int addr = target & ~(page - 1); addr < target + (int)size; addr += page)
 		{
-			if (!*pat) return firstMatch;
-			if (*(PBYTE)pat == '\?' || *(BYTE*)pCur == getByte(pat)) {
-				if (!firstMatch)
-				{
-					firstMatch = pCur;
-				}
-				if (!pat[2]) return firstMatch;
-				if (*(PWORD)pat == '\?\?' || *(PBYTE)pat != '\?') pat += 3;
-				else pat += 2;
-			}
-			else {
-				pat = pattern;
-				if (firstMatch != 0)
-					pCur = firstMatch + 1;
-				firstMatch = 0;
+			page_hold& hold = held_pages[addr];
+			if (hold.refs++ == 0 && !VirtualProtect((LPVOID)addr, page, PAGE_EXECUTE_READWRITE, &hold.original))
+				hold.original = 0;
+		}
+	}
+
+	void release_pages(int target, size_t size)
+	{
+		if (!size)
+			return;
+		const int page = page_size();
+		std::lock_guard<std::mutex> guard(page_lock);
+		for (int addr = target & ~(page - 1); addr < target + (int)size; addr += page)
+		{
+			auto it = held_pages.find(addr);
+			if (it == held_pages.end() || --it->second.refs > 0)
+				continue;
+			DWORD unused;
+			if (it->second.original)
+				VirtualProtect((LPVOID)addr, page, it->second.original, &unused);
+			held_pages.erase(it);
+		}
+	}
+
+	static bool is_writable(int target, size_t size)
+	{
+		MEMORY_BASIC_INFORMATION info;
+		for (int addr = target; addr < target + (int)size; addr = (int)info.BaseAddress + (int)info.RegionSize)
+		{
+			if (!VirtualQuery((LPCVOID)addr, &info, sizeof(info)))
+				return false;
+			DWORD p = info.Protect & 0xFF;
+			if (p != PAGE_READWRITE && p != PAGE_EXECUTE_READWRITE && p != PAGE_WRITECOPY && p != PAGE_EXECUTE_WRITECOPY)
+				return false;
+		}
+		return true;
+	}
+
+	void begin_batch()
+	{
+		batch_lock.lock();
+		if (batch_owner == GetCurrentThreadId())
+		{
+			batch_lock.unlock(); //already open on this thread, the lock is held once per batch
+			return;
+		}
+		batch_owner = GetCurrentThreadId();
+	}
+
+	bool stage(int target, const void* source, size_t size)
+	{
+		if (batch_owner != GetCurrentThreadId() || !size || is_writable(target, size))
+			return false;
+		staged.push_back({ target, std::vector<BYTE>((const BYTE*)source, (const BYTE*)source + size) });
+		return true;
+	}
+
+	bool is_staged(int target, size_t size)
+	{
+		if (batch_owner != GetCurrentThreadId())
+			return false;
+		for (const auto& p : staged)
+			if (p.target < target + (int)size && target < p.target + (int)p.bytes.size())
+				return true;
+		return false;
+	}
+
+	// a suspended thread stopped past the first byte of a range being rewritten would resume in the middle of the new
+	// instructions, the start is fine since it fetches the new bytes whole
+	static bool inside_staged(HANDLE thread)
+	{
+		CONTEXT context = {};
+		context.ContextFlags = CONTEXT_CONTROL;
+		if (!GetThreadContext(thread, &context))
+			return false;
+		for (const auto& p : staged)
+			if ((int)context.Eip > p.target && (int)context.Eip < p.target + (int)p.bytes.size())
+				return true;
+		return false;
+	}
+
+	static void apply_staged()
+	{
+		//everything that allocates happens before the other threads are stopped, one of them may hold the heap lock, so the
+		//pages are made writable first and put back after the threads resume
+		for (const auto& p : staged)
+			acquire_pages(p.target, p.bytes.size());
+		std::vector<HANDLE> threads;
+		HANDLE snapshot = CreateToolhelp32Snapshot(TH32CS_SNAPTHREAD, 0);
+		if (snapshot != INVALID_HANDLE_VALUE)
+		{
+			THREADENTRY32 te;
+			te.dwSize = sizeof(te);
+			for (BOOL ok = Thread32First(snapshot, &te); ok; ok = Thread32Next(snapshot, &te))
+			{
+				if (te.th32OwnerProcessID != GetCurrentProcessId() || te.th32ThreadID == GetCurrentThreadId())
+					continue;
+				HANDLE thread = OpenThread(THREAD_SUSPEND_RESUME | THREAD_GET_CONTEXT, FALSE, te.th32ThreadID);
+				if (thread)
+					threads.push_back(thread);
 			}
+			CloseHandle(snapshot);
+		}
+
+		//a thread caught inside a patched range gets a moment to run out of it, the code there is a few instructions long
+		for (int attempt = 0; ; ++attempt)
+		{
+			for (HANDLE thread : threads)
+				SuspendThread(thread);
+			bool clear = true;
+			for (HANDLE thread : threads)
+				clear = clear && !inside_staged(thread);
+			if (clear || attempt == max_patch_retries)
+				break;
+			for (HANDLE thread : threads)
+				ResumeThread(thread);
+			Sleep(1);
 		}
-		if (firstMatch != 0)
-			return firstMatch;
-		else
-			return NULL;
+		for (const auto& p : staged)
+			memcpy((void*)p.target, p.bytes.data(), p.bytes.size());
+		FlushInstructionCache(GetCurrentProcess(), nullptr, 0);
+		for (HANDLE thread : threads)
+		{
+			ResumeThread(thread);
+			CloseHandle(thread);
+		}
+		for (const auto& p : staged)
+			release_pages(p.target, p.bytes.size());
+		staged.clear();
+	}
+
+	void commit_batch()
+	{
+		if (batch_owner != GetCurrentThreadId())
+			return;
+		if (!staged.empty())
+			apply_staged();
+		batch_owner = 0;
+		batch_lock.unlock();
+	}
+
+	uint64_t FindPattern(uint64_t rangeStart, uint64_t rangeEnd, const char* pattern)
+	{
+		return (uint64_t)Zeal::Memory::Scan((const BYTE*)rangeStart, (const BYTE*)rangeEnd, Zeal::Memory::Pattern(pattern));
 	}
 
 	uint64_t find_pattern(HMODULE module, const char* pattern)
@@ -75,7 +229,6 @@ namespace mem
 
 		return nullptr;
 	}
-	std::unordered_map<PVOID, mem_protect> protections;
 	int instruction_to_absolute_address(int instruction_address) //assumes 32 bit
 	{
 		int end_of_instruction = instruction_address + 0x5;
@@ -94,49 +247,63 @@ namespace mem
 	}
 	void unprotect_memory(PVOID target, size_t size)
 	{
-		protections[target].size = size;
-		VirtualProtect((PVOID*)target, size, PAGE_EXECUTE_READWRITE, &protections[target].orig);
-
+		{
+			std::lock_guard<std::mutex> guard(page_lock);
+			auto [it, added] = held_ranges.emplace((int)target, size);
+			if (!added) //already held, a second unprotect of the same target doesn't stack
+				return;
+		}
+		acquire_pages((int)target, size);
 	}
 	void reset_memory_protection(PVOID target)
 	{
-		if (protections[target].size)
-			VirtualProtect((PVOID*)target, protections[target].size, protections[target].orig, nullptr);
+		size_t size = 0;
+		{
+			std::lock_guard<std::mutex> guard(page_lock);
+			auto it = held_ranges.find((int)target);
+			if (it == held_ranges.end())
+				return;
+			size = it->second;
+			held_ranges.erase(it);
+		}
+		release_pages((int)target, size);
 	}
 	void set(int target, int val, int size, BYTE* buffer)
 	{
-		DWORD oldprotect;
-		VirtualProtect((PVOID*)target, size, PAGE_EXECUTE_READWRITE, &oldprotect);
 		if (buffer)
 			memcpy(buffer, (void*)target, size);
+		if (batching && size > 0)
+		{
+			std::vector<BYTE> fill(size, (BYTE)val);
+			if (stage(target, fill.data(), size))
+				return;
+		}
+		writable_scope writable(target, size);
 		memset((void*)target, val, size);
-		VirtualProtect((PVOID*)target, size, oldprotect, &oldprotect);
 	}
 	void copy(int target, int source, int size, BYTE* buffer)
 	{
-		DWORD oldprotect;
-		VirtualProtect((PVOID*)target, size, PAGE_EXECUTE_READWRITE, &oldprotect);
 		if (buffer)
 			memcpy((void*)buffer, (const void*)target, size);
+		if (stage(target, (const void*)source, size))
+			return;
+		writable_scope writable(target, size);
 		memcpy((void*)target, (const void*)source, size);
-		VirtualProtect((PVOID*)target, size, oldprotect, &oldprotect);
 	}
 	void copy(int target, BYTE* source, int size, BYTE* buffer)
 	{
-		DWORD oldprotect;
-		VirtualProtect((PVOID*)target, size, PAGE_EXECUTE_READWRITE, &oldprotect);
 		if (buffer)
 			memcpy((void*)buffer, (const void*)target, size);
+		if (stage(target, (const void*)source, size))
+			return;
+		writable_scope writable(target, size);
 		memcpy((void*)target, (const void*)source, size);
-		VirtualProtect((PVOID*)target, size, oldprotect, &oldprotect);
 	}
 	void get(int target, int size, BYTE* buffer)
 	{
 		if (!buffer)
 			return;
-		DWORD oldprotect;
-		VirtualProtect((PVOID*)target, size, PAGE_EXECUTE_READWRITE, &oldprotect);
+		writable_scope writable(target, size);
 		memcpy((void*)buffer, (const void*)target, size);
-		VirtualProtect((PVOID*)target, size, oldprotect, &oldprotect);
 	}
 }
\ No newline at end of file
@@ -5,52 +5,59 @@
 #include <string>
 namespace mem
 {
-	struct mem_protect
+	// page granular protection changes. holders are counted per page, so overlapping and nested writes share one
+	// VirtualProtect per page and the last release puts back the protection the page had before the first
+	void acquire_pages(int target, size_t size);
+	void release_pages(int target, size_t size);
+	class writable_scope
 	{
-		DWORD orig;
+	public:
+		writable_scope(int target, size_t size) : target(target), size(size) { acquire_pages(target, size); }
+		~writable_scope() { release_pages(target, size); }
+		writable_scope(const writable_scope&) = delete;
+		writable_scope& operator=(const writable_scope&) = delete;
+	private:
+		int target;
 		size_t size;
-		mem_protect()
-		{
-			orig = 0;
-			size = 0;
-		}
-		mem_protect(DWORD _orig, size_t _size)
-		{
-			orig = _orig;
-			size = _size;
-		}
 	};
 
+	// while a batch is open, writes to protected pages (code) are staged and applied by commit_batch()
+	// with one protection change per page and the other threads suspended outside the ranges being rewritten; already
+	// writable memory is written directly. a batch is one thread's, others block in begin_batch until it commits
+	void begin_batch();
+	void commit_batch();
+	bool stage(int target, const void* source, size_t size); //false when not batching or the target is writable
+	bool is_staged(int target, size_t size); //true when a pending batch write overlaps the range
+
 	HMODULE find_module(std::string regex_str);
 	uint64_t find_pattern(HMODULE module, const char* pattern);
 
 	template<typename T>
 	void write(int target, const T& value)
 	{
-		DWORD oldprotect;
 		size_t size = sizeof(value);
-		VirtualProtect(reinterpret_cast<PVOID*>(target), size, PAGE_EXECUTE_READWRITE, &oldprotect);
+		if (stage(target, &value, size))
+			return;
+		writable_scope writable(target, size);
 		memcpy(reinterpret_cast<T*>(target), &value, size);
-		VirtualProtect(reinterpret_cast<PVOID*>(target), size, oldprotect, &oldprotect);
 	}
 
 	template<typename T, size_t N>
 	void write(int target, const T(&value)[N])
 	{
-		DWORD oldprotect;
 		size_t size = sizeof(value);
-		VirtualProtect(reinterpret_cast<PVOID*>(target), size, PAGE_EXECUTE_READWRITE, &oldprotect);
+		if (stage(target, value, size))
+			return;
+		writable_scope writable(target, size);
 		memcpy(reinterpret_cast<T*>(target), value, size);
-		VirtualProtect(reinterpret_cast<PVOID*>(target), size, oldprotect, &oldprotect);
 	}
 
 	void set(int target, int val, int size, BYTE* orig_buffer = nullptr);
 	void copy(int target, BYTE* source, int size, BYTE* orig_buffer = nullptr);
 	void copy(int target, int source, int size, BYTE* orig_buffer = nullptr);
 	void get(int target, int size, BYTE* buffer = nullptr);
-	void unprotect_memory(PVOID target, size_t size);
+	void unprotect_memory(PVOID target, size_t size); //holds the pages writable until reset_memory_protection(target)
 	void reset_memory_protection(PVOID target);
-	extern std::unordered_map<PVOID, mem_protect> protections;
 	int instruction_to_absolute_address(int instruction_address); //assumes 32 bit
 	
 	template<typename T>
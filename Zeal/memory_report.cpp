@@ -0,0 +1,203 @@
+#include "memory_report.h"
+#include "Zeal.h"
+#include "EqFunctions.h"
+#include "frame_arena.h"
+#include <psapi.h>
+#include <algorithm>
+#include <atomic>
+#include <new>
+
+namespace
+{
+	// constant initialized, so allocations made by other static constructors are counted too
+	std::atomic<size_t> live_bytes = 0;
+	std::atomic<size_t> live_blocks = 0;
+	std::atomic<size_t> peak_bytes = 0;
+	std::atomic<size_t> total_allocations = 0;
+
+	// zeal's small strings, functions and vector growth stay out of the crt heap the game allocates from, so they can't
+	// pepper its free space with long lived holes. the low fragmentation front end serves them from size class buckets.
+	// the heap is never destroyed, static destructors still free into it while the dll detaches
+	HANDLE private_heap()
+	{
+		static HANDLE heap = []() {
+			HANDLE h = HeapCreate(0, 0, 0);
+			ULONG low_fragmentation = 2;
+			if (h)
+				HeapSetInformation(h, HeapCompatibilityInformation, &low_fragmentation, sizeof(low_fragmentation));
+			return h ? h : GetProcessHeap();
+		}();
+		return heap;
+	}
+
+	void* counted_alloc(size_t size)
+	{
+		void* p = HeapAlloc(private_heap(), 0, size ? size : 1);
+		if (!p)
+			return nullptr;
+		size_t block = HeapSize(private_heap(), 0, p);
+		size_t now = live_bytes.fetch_add(block, std::memory_order_relaxed) + block;
+		live_blocks.fetch_add(1, std::memory_order_relaxed);
+		total_allocations.fetch_add(1, std::memory_order_relaxed);
+		size_t peak = peak_bytes.load(std::memory_order_relaxed);
+		while (now > peak && !peak_bytes.compare_exchange_weak(peak, now, std::memory_order_relaxed)) {}
+		return p;
+	}
+
+	void counted_free(void* p)
+	{
+		if (!p)
+			return;
+		live_bytes.fetch_sub(HeapSize(private_heap(), 0, p), std::memory_order_relaxed);
+		live_blocks.fetch_sub(1, std::memory_order_relaxed);
+		HeapFree(private_heap(), 0, p);
+	}
+
+	std::string size_text(size_t bytes)
+	{
+		char text[32];
+		if (bytes >= 1024 * 1024)
+			snprintf(text, sizeof(text), "%.1f MB", bytes / (1024.0 * 1024.0));
+		else if (bytes >= 1024)
+			snprintf(text, sizeof(text), "%.1f KB", bytes / 1024.0);
+		else
+			snprintf(text, sizeof(text), "%u B", static_cast<UINT>(bytes));
+		return text;
+	}
+}
+
+// the dll's own replacements, the game and the other dlls keep their allocators. everything zeal news lands in private_heap()
+void* operator new(size_t size)
+{
+	if (void* p = counted_alloc(size))
+		return p;
+	throw std::bad_alloc();
+}
+void* operator new[](size_t size)
+{
+	if (void* p = counted_alloc(size))
+		return p;
+	throw std::bad_alloc();
+}
+void* operator new(size_t size, const std::nothrow_t&) noexcept { return counted_alloc(size); }
+void* operator new[](size_t size, const std::nothrow_t&) noexcept { return counted_alloc(size); }
+void operator delete(void* p) noexcept { counted_free(p); }
+void operator delete[](void* p) noexcept { counted_free(p); }
+void operator delete(void* p, size_t) noexcept { counted_free(p); }
+void operator delete[](void* p, size_t) noexcept { counted_free(p); }
+void operator delete(void* p, const std::nothrow_t&) noexcept { counted_free(p); }
+void operator delete[](void* p, const std::nothrow_t&) noexcept { counted_free(p); }
+
+size_t Zeal::Memory::heap_bytes()
+{
+	return live_bytes.load(std::memory_order_relaxed);
+}
+
+size_t Zeal::Memory::heap_blocks()
+{
+	return live_blocks.load(std::memory_order_relaxed);
+}
+
+size_t Zeal::Memory::heap_peak()
+{
+	return peak_bytes.load(std::memory_order_relaxed);
+}
+
+size_t Zeal::Memory::allocations()
+{
+	return total_allocations.load(std::memory_order_relaxed);
+}
+
+Zeal::Memory::heap_layout Zeal::Memory::walk_heap()
+{
+	heap_layout layout;
+	HANDLE heap = private_heap();
+	if (!HeapLock(heap))
+		return layout;
+	PROCESS_HEAP_ENTRY entry = {};
+	while (HeapWalk(heap, &entry))
+	{
+		if (entry.wFlags & PROCESS_HEAP_REGION)
+		{
+			layout.committed += entry.Region.dwCommittedSize;
+			layout.uncommitted += entry.Region.dwUnCommittedSize;
+		}
+		else if (!(entry.wFlags & (PROCESS_HEAP_ENTRY_BUSY | PROCESS_HEAP_UNCOMMITTED_RANGE)))
+		{
+			layout.free += entry.cbData;
+			layout.free_blocks++;
+			if (entry.cbData > layout.largest_free)
+				layout.largest_free = entry.cbData;
+		}
+	}
+	HeapUnlock(heap);
+	return layout;
+}
+
+void MemoryReport::add(const char* name, std::function<Zeal::Memory::usage()> probe)
+{
+	probes.push_back({ name, probe });
+}
+
+void MemoryReport::print()
+{
+	PROCESS_MEMORY_COUNTERS_EX counters = {};
+	counters.cb = sizeof(counters);
+	GetProcessMemoryInfo(GetCurrentProcess(), reinterpret_cast<PROCESS_MEMORY_COUNTERS*>(&counters), sizeof(counters));
+	// a 32 bit client runs out of contiguous address space long before it runs out of memory, so the largest hole matters most
+	size_t free_bytes = 0, largest_free = 0, holes = 0, unusable = 0;
+	SYSTEM_INFO system;
+	GetSystemInfo(&system);
+	MEMORY_BASIC_INFORMATION region;
+	for (char* p = static_cast<char*>(system.lpMinimumApplicationAddress); p < static_cast<char*>(system.lpMaximumApplicationAddress) && VirtualQuery(p, &region, sizeof(region));
+		p = static_cast<char*>(region.BaseAddress) + region.RegionSize)
+	{
+		if (region.State != MEM_FREE)
+			continue;
+		free_bytes += region.RegionSize;
+		holes++;
+		if (region.RegionSize < system.dwAllocationGranularity) //too small for any new reservation
+			unusable += region.RegionSize;
+		if (region.RegionSize > largest_free)
+			largest_free = region.RegionSize;
+	}
+	Zeal::EqGame::print_chat("Process: working set %s (peak %s), private %s", size_text(counters.WorkingSetSize).c_str(), size_text(counters.PeakWorkingSetSize).c_str(),
+		size_text(counters.PrivateUsage).c_str());
+	bool large_address_aware = reinterpret_cast<size_t>(system.lpMaximumApplicationAddress) > 0x80000000u;
+	Zeal::EqGame::print_chat("Address space: %s free in %u holes (%s unusable), largest free block %s, %s", size_text(free_bytes).c_str(), static_cast<UINT>(holes),
+		size_text(unusable).c_str(), size_text(largest_free).c_str(), large_address_aware ? "large address aware" : "2 GB limit, the client isn't large address aware");
+	Zeal::Memory::heap_layout layout = Zeal::Memory::walk_heap();
+	Zeal::EqGame::print_chat("Zeal heap: %s in %u blocks, peak %s, committed %s, %s free in %u blocks (largest %s)", size_text(Zeal::Memory::heap_bytes()).c_str(),
+		static_cast<UINT>(Zeal::Memory::heap_blocks()), size_text(Zeal::Memory::heap_peak()).c_str(), size_text(layout.committed).c_str(), size_text(layout.free).c_str(),
+		static_cast<UINT>(layout.free_blocks), size_text(layout.largest_free).c_str());
+	std::vector<std::pair<const char*, Zeal::Memory::usage>> measured;
+	size_t attributed = 0;
+	for (probe& p : probes)
+	{
+		measured.push_back({ p.name, p.measure() });
+		attributed += measured.back().second.bytes;
+	}
+	std::sort(measured.begin(), measured.end(), [](const auto& a, const auto& b) { return a.second.bytes > b.second.bytes; });
+	for (const auto& [name, use] : measured)
+		Zeal::EqGame::print_chat("  %-16s %10s %8u", name, size_text(use.bytes).c_str(), static_cast<UINT>(use.count));
+	size_t heap = Zeal::Memory::heap_bytes();
+	if (heap > attributed)
+		Zeal::EqGame::print_chat("  %-16s %10s", "other", size_text(heap - attributed).c_str());
+}
+
+MemoryReport::MemoryReport(ZealService* zeal)
+{
+	add("callbacks", [zeal]() { return zeal->callbacks->memory_usage(); });
+	add("hooks", [zeal]() {
+		Zeal::Memory::usage use{ Zeal::Memory::hash_bytes(zeal->hooks->hook_map), zeal->hooks->hook_map.size() };
+		for (const auto& [name, h] : zeal->hooks->hook_map)
+			use.bytes += sizeof(hook) + Zeal::Memory::string_bytes(name) + h->orig_byte_count * 2 + 5; //saved bytes and the trampoline
+		return use;
+	});
+	add("frame arena", []() { return Zeal::Memory::usage{ Zeal::Frame::arena().high_water(), 1 }; });
+	zeal->commands_hook->add("/zealmem", {}, "Lists the memory zeal holds by module, with the process working set and free address space.",
+		[this](std::vector<std::string>& args) {
+			print();
+			return true;
+		});
+}
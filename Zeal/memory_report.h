@@ -0,0 +1,57 @@
+#pragma once
+#include <Windows.h>
+#include <functional>
+#include <string>
+#include <vector>
+
+// where zeal's memory goes in a long session. every operator new and delete in the dll goes to a private low fragmentation
+// heap and is counted, so the heap total is exact and apart from the game's, and the modules whose containers grow with
+// play register a probe that sizes them on demand
+//   zeal->memory_report->add("spawn tracker", [this]() { return Zeal::Memory::usage{ Zeal::Memory::vector_bytes(points), points.size() }; });
+namespace Zeal
+{
+	namespace Memory
+	{
+		struct usage
+		{
+			size_t bytes = 0;
+			size_t count = 0; //entries, in whatever unit the module keeps
+		};
+		size_t heap_bytes(); //live bytes from zeal's operator new
+		size_t heap_blocks();
+		size_t heap_peak();
+		size_t allocations(); //ever made, the difference across a stretch of code is its allocation count
+		struct heap_layout
+		{
+			size_t committed = 0;
+			size_t uncommitted = 0; //reserved by the heap, not backed yet
+			size_t free = 0; //committed but unused
+			size_t largest_free = 0;
+			size_t free_blocks = 0;
+		};
+		heap_layout walk_heap(); //holds the heap lock while it walks, for reports only
+		// estimates, the allocator's own block headers aren't included
+		template<typename C>
+		size_t vector_bytes(const C& c) { return c.capacity() * sizeof(typename C::value_type); }
+		template<typename C>
+		size_t node_bytes(const C& c) { return c.size() * (sizeof(typename C::value_type) + 2 * sizeof(void*)); } //map, set, list
+		template<typename C>
+		size_t hash_bytes(const C& c) { return node_bytes(c) + c.bucket_count() * 2 * sizeof(void*); }
+		inline size_t string_bytes(const std::string& s) { return s.capacity() > 15 ? s.capacity() + 1 : 0; } //past the small buffer
+	}
+}
+
+class MemoryReport
+{
+public:
+	MemoryReport(class ZealService* zeal);
+	void add(const char* name, std::function<Zeal::Memory::usage()> probe); //game thread, the probe runs on /zealmem
+	void print();
+private:
+	struct probe
+	{
+		const char* name;
+		std::function<Zeal::Memory::usage()> measure;
+	};
+	std::vector<probe> probes;
+};
@@ -4,144 +4,105 @@
 #include "EqFunctions.h"
 #include "Zeal.h"
 #include "string_util.h"
+#include "json_writer.h"
 #include <Windows.h>
 #include <thread>
+#include <algorithm>
 
-
-
-const std::map<int, std::string> LabelNames = {
-	{1, "Name"},
-	{2, "Level"},
-	{3, "Class"},
-	{4, "Deity"},
-	{5, "Strength"},
-	{6, "Stamina"},
-	{7, "Dexterity"},
-	{8, "Agility"},
-	{9, "Wisdom"},
-	{10, "Intelligence"},
-	{11, "Charisma"},
-	{12, "SaveVsPoison"},
-	{13, "SaveVsDisease"},
-	{14, "SaveVsFire"},
-	{15, "SaveVsCold"},
-	{16, "SaveVsMagic"},
-	{17, "CurrentHP"},
-	{18, "MaxHP"},
-	{19, "HPPerc"},
-	{20, "ManaPerc"},
-	{21, "STAPerc"},
-	{22, "CurrentMitigation"},
-	{23, "CurrentOffense"},
-	{24, "Weight"},
-	{25, "MaxWeight"},
-	{26, "ExpPerc"},
-	{27, "AltExpPerc"},
-	{28, "TargetName"},
-	{29, "TargetHPPerc"},
-	{30, "GroupMember1Name"},
-	{31, "GroupMember2Name"},
-	{32, "GroupMember3Name"},
-	{33, "GroupMember4Name"},
-	{34, "GroupMember5Name"},
-	{35, "GroupMember1HPPerc"},
-	{36, "GroupMember2HPPerc"},
-	{37, "GroupMember3HPPerc"},
-	{38, "GroupMember4HPPerc"},
-	{39, "GroupMember5HPPerc"},
-	{40, "GroupPet1HPPerc"},
-	{41, "GroupPet2HPPerc"},
-	{42, "GroupPet3HPPerc"},
-	{43, "GroupPet4HPPerc"},
-	{44, "GroupPet5HPPerc"},
-	{45, "Buff0"},
-	{46, "Buff1"},
-	{47, "Buff2"},
-	{48, "Buff3"},
-	{49, "Buff4"},
-	{50, "Buff5"},
-	{51, "Buff6"},
-	{52, "Buff7"},
-	{53, "Buff8"},
-	{54, "Buff9"},
-	{55, "Buff10"},
-	{56, "Buff11"},
-	{57, "Buff12"},
-	{58, "Buff13"},
-	{59, "Buff14"},
-	{60, "Spell1XMLName0"},
-	{61, "Spell2XMLName1"},
-	{62, "Spell3XMLName2"},
-	{63, "Spell4XMLName3"},
-	{64, "Spell5XMLName4"},
-	{65, "Spell6XMLName5"},
-	{66, "Spell7XMLName6"},
-	{67, "Spell8XMLName7"},
-	{68, "PlayerPetName"},
-	{69, "PlayerPetHPPerc"},
-	{70, "PlayerCurrentHPMaxHP"},
-	{71, "CurrentAAPoints"},
-	{72, "CurrentAAPerc"},
-	{73, "LastName"},
-	{74, "Title"},
-	{80, "Mana/MaxMana"},
-	{81, "ExpPH"},
-	{82, "TargetPetOwner"},
-	{124, "Mana"},
-	{125, "MaxMana"},
-	{134, "CastingName"},
-};
-const std::map<int, std::string> GaugeNames = {
-   {1, "HP"},
-   {2, "Mana"},
-   {3, "Stamina"},
-   {4, "Experience"},
-   {5, "AltExp"},
-   {6, "Target"},
-   {7, "Casting"},
-   {8, "Breath"},
-   {9, "Memorize"},
-   {10, "Scribe"},
-   {11, "Group1HP"},
-   {12, "Group2HP"},
-   {13, "Group3HP"},
-   {14, "Group4HP"},
-   {15, "Group5HP"},
-   {16, "PetHP"},
-   {17, "Group1PetHP"},
-   {18, "Group2PetHP"},
-   {19, "Group3PetHP"},
-   {20, "Group4PetHP"},
-   {21, "Group5PetHP"},
-   {23, "ExpPerHR"}
-};
-
-
-
-pipe_data::pipe_data(pipe_data_type _type, std::string _data)
-{
-	data = _data;
-	data_len = data.length();
-	if (Zeal::EqGame::is_in_game() && Zeal::EqGame::get_self())
-		character = Zeal::EqGame::get_self()->Name;
-	else
-		character = "";
+pipe_data::pipe_data(pipe_data_type _type, std::string _data, const std::string& _character)
+{
+	data = std::move(_data);
+	data_len = static_cast<UINT>(data.length());
+	character = _character;
 	type = _type;
 }
 
 void log_hook(char* data)
 {
 	ZealService* zeal = ZealService::get_instance();
-	pipe_data pd(pipe_data_type::log, data);
 	if (zeal->pipe.get())
-		zeal->pipe->write(pd.serialize().dump());
-	zeal->hooks->hook_map["logtextfile"]->original(log_hook)(data);
+		zeal->pipe->write(data, pipe_data_type::log);
+	hook_ref<log_hook>::original()(data);
+}
+
+template<typename T>
+static void append_pod(std::string& out, const T& value)
+{
+	out.append(reinterpret_cast<const char*>(&value), sizeof(T));
+}
+
+static void append_text16(std::string& out, const std::string& text)
+{
+	UINT16 len = static_cast<UINT16>(text.length() > 0xFFFF ? 0xFFFF : text.length());
+	append_pod(out, len);
+	out.append(text.c_str(), len);
+}
+
+//the pipe_data envelope, keys in the order nlohmann's sorted objects produce them
+static void append_json_envelope(std::string& out, pipe_data_type type, const std::string& character, const char* data, size_t len)
+{
+	out += "{\"character\":";
+	json_writer::append_string(out, character.c_str(), character.length());
+	out += ",\"data\":";
+	json_writer::append_string(out, data, len);
+	out += ",\"data_len\":";
+	out += std::to_string(len);
+	out += ",\"type\":";
+	out += std::to_string(static_cast<int>(type));
+	out += '}';
 }
 
 void named_pipe::chat_msg(const char* data, int color_index)
 {
-	nlohmann::json jd = { {"type", color_index }, {"text", data} };
-	write(jd.dump(), pipe_data_type::log);
+	if (!wants(pipe_data_type::log))
+		return;
+	if (has_clients(pipe_format::json))
+	{
+		scratch.clear();
+		scratch += "{\"text\":";
+		json_writer::append_string(scratch, data, strlen(data));
+		scratch += ",\"type\":";
+		scratch += std::to_string(color_index);
+		scratch += '}';
+		write(scratch, pipe_data_type::log, color_index);
+	}
+	if (has_clients(pipe_format::binary))
+	{
+		scratch.clear();
+		append_pod<INT32>(scratch, color_index);
+		scratch += data;
+		write_binary(pipe_data_type::log, scratch, color_index);
+	}
+}
+
+bool named_pipe::wants(pipe_data_type type) const
+{
+	return (wanted_types.load(std::memory_order_relaxed) >> static_cast<int>(type)) & 1;
+}
+
+bool named_pipe::wants_label(int id) const
+{
+	if (id < 0 || id >= pipe_max_label_id)
+		return true;
+	return (wanted_labels[id / 32].load(std::memory_order_relaxed) >> (id % 32)) & 1;
+}
+
+bool named_pipe::wants_gauge(int id) const
+{
+	if (id < 0 || id >= pipe_max_gauge_id)
+		return true;
+	return (wanted_gauges.load(std::memory_order_relaxed) >> id) & 1;
+}
+
+bool named_pipe::sweep_due(pipe_data_type type, ULONGLONG now)
+{
+	int t = static_cast<int>(type);
+	if (!wants(type))
+		return false;
+	if (now - last_sweep[t] < (ULONGLONG)wanted_rate[t].load(std::memory_order_relaxed))
+		return false;
+	last_sweep[t] = now;
+	return true;
 }
 
 bool IsPipeConnected(HANDLE hPipe) {
@@ -156,38 +117,279 @@ bool IsPipeConnected(HANDLE hPipe) {
 
 void named_pipe::main_loop()
 {
-	if (!pipe_handles.size()) //nothing is connected don't waste the cpu time getting values
+	ZEAL_PROFILE_SCOPE("pipe sweep");
+	bool json_out = has_clients(pipe_format::json);
+	bool binary_out = has_clients(pipe_format::binary);
+	ZealService::get_instance()->entity_manager->set_subscription_mask(entity_subscription, (json_out || binary_out) && wants(pipe_data_type::entity) ? 0xFFFFFFFF : 0);
+	if (!json_out && !binary_out) //nothing is connected don't waste the cpu time getting values
+	{
+		last_client_count = 0;
+		entity_events.clear();
 		return;
-	static auto last_output = GetTickCount64();
-	if (GetTickCount64() - last_output > pipe_delay)
+	}
+	flush_entity_events(json_out, binary_out);
+	ULONGLONG now = GetTickCount64();
+	size_t client_total = client_count[0] + client_count[1];
+	bool keyframe = keyframe_requested.exchange(false) || client_total > last_client_count || now - last_keyframe >= (ULONGLONG)keyframe_interval;
+	last_client_count = client_total;
+	if (keyframe)
+		last_keyframe = now;
+	bool labels_due = sweep_due(pipe_data_type::label, now);
+	bool gauges_due = sweep_due(pipe_data_type::gauge, now);
+	bool player_due = sweep_due(pipe_data_type::player, now);
+	// each changed label and gauge is one record, the pipe thread frames them per client so every client gets only the ids it
+	// asked for at its own rate. json records are streamed straight into the buffer, nothing goes through a DOM
+	pipe_buffer* label_records[2] = { json_out ? begin_records() : nullptr, binary_out ? begin_records() : nullptr };
+	for (int id : ZealService::get_instance()->labels_hook->label_ids())
 	{
-		nlohmann::json label_array = nlohmann::json::array();
-		for (auto& [id, name] : LabelNames)
+		if (!labels_due)
+			break;
+		if (!wants_label(id))
+			continue;
+		std::string value;
+		if (ZealService::get_instance()->labels_hook->GetLabel(id, value))
 		{
-			std::string value;
-			if (ZealService::get_instance()->labels_hook->GetLabel(id, value))
+			auto last = last_labels.find(id);
+			if (!keyframe && last != last_labels.end() && last->second == value)
+				continue;
+			last_labels[id] = value;
+			if (pipe_buffer* json = label_records[0])
+			{
+				size_t start = json->data.length();
+				json_writer(json->data).begin_object().field("type", id).field("value", value).end_object();
+				add_record(json, id, start);
+			}
+			if (pipe_buffer* binary = label_records[1])
 			{
-				label_array.push_back({ {"type", id}, {"value", value} });
+				size_t start = binary->data.length();
+				append_pod<UINT16>(binary->data, id);
+				append_text16(binary->data, value);
+				add_record(binary, id, start);
 			}
 		}
-		nlohmann::json gauge_array = nlohmann::json::array();
-		for (auto& [id, name] : GaugeNames)
+	}
+	submit_records(pipe_format::json, pipe_data_type::label, label_records[0]);
+	submit_records(pipe_format::binary, pipe_data_type::label, label_records[1]);
+
+	pipe_buffer* gauge_records[2] = { json_out ? begin_records() : nullptr, binary_out ? begin_records() : nullptr };
+	for (int id : ZealService::get_instance()->labels_hook->gauge_ids())
+	{
+		if (!gauges_due)
+			break;
+		if (!wants_gauge(id))
+			continue;
+		std::string text;
+		int val = ZealService::get_instance()->labels_hook->GetGauge(id, text);
+		auto last = last_gauges.find(id);
+		if (!keyframe && last != last_gauges.end() && last->second.first == val && last->second.second == text)
+			continue;
+		last_gauges[id] = { val, text };
+		if (pipe_buffer* json = gauge_records[0])
+		{
+			size_t start = json->data.length();
+			json_writer(json->data).begin_object().field("text", text).field("type", id).field("value", val).end_object();
+			add_record(json, id, start);
+		}
+		if (pipe_buffer* binary = gauge_records[1])
 		{
-			std::string text;
-			int val = ZealService::get_instance()->labels_hook->GetGauge(id, text);
-			gauge_array.push_back({ {"type", id}, {"text", text}, {"value", val} });
+			size_t start = binary->data.length();
+			append_pod<UINT16>(binary->data, id);
+			append_pod<INT32>(binary->data, val);
+			append_text16(binary->data, text);
+			add_record(binary, id, start);
 		}
+	}
+	submit_records(pipe_format::json, pipe_data_type::gauge, gauge_records[0]);
+	submit_records(pipe_format::binary, pipe_data_type::gauge, gauge_records[1]);
 
-		write(label_array.dump(), pipe_data_type::label);
-		write(gauge_array.dump(), pipe_data_type::gauge);
+	Zeal::EqStructures::Entity* self = Zeal::EqGame::get_self();
+	if (self && player_due)
+	{
+		if (json_out)
+		{
+			scratch.clear();
+			json_writer player(scratch);
+			player.begin_object().field("heading", self->Heading).key("location").begin_object().field("x", self->Position.x)
+				.field("y", self->Position.y).field("z", self->Position.z).end_object().field("zone", self->ZoneId).end_object();
+			write(scratch, pipe_data_type::player);
+		}
+		if (binary_out)
+		{
+			pipe_player_record player = { static_cast<INT32>(self->ZoneId), self->Position.x, self->Position.y, self->Position.z, self->Heading };
+			std::string payload;
+			append_pod(payload, player);
+			write_binary(pipe_data_type::player, payload);
+		}
+	}
+}
 
-		if (Zeal::EqGame::get_self())
+void named_pipe::motion_tick()
+{
+	if (!has_clients(pipe_format::binary) || !wants(pipe_data_type::motion))
+		return;
+	LARGE_INTEGER now;
+	QueryPerformanceCounter(&now);
+	int rate_ms = wanted_rate[static_cast<int>(pipe_data_type::motion)].load(std::memory_order_relaxed);
+	rate_ms = rate_ms ? (rate_ms < 16 ? 16 : rate_ms) : 33;
+	if (now.QuadPart - last_motion < static_cast<LONGLONG>(rate_ms * 1000 * qpc_per_us))
+		return;
+	last_motion = now.QuadPart;
+	Zeal::EqStructures::Entity* ents[2] = { Zeal::EqGame::get_self(), Zeal::EqGame::get_target() };
+	if (!ents[0])
+		return;
+	motion_payload.clear();
+	UINT16 count = 0;
+	append_pod(motion_payload, count);
+	for (int i = 0; i < 2; i++)
+	{
+		Zeal::EqStructures::Entity* ent = ents[i];
+		motion_track& track = motion_tracks[i];
+		if (!ent)
+		{
+			track.spawn_id = 0;
+			continue;
+		}
+		pipe_motion_record record = {};
+		record.time_us = static_cast<UINT64>(now.QuadPart / qpc_per_us);
+		record.spawn_id = ent->SpawnId;
+		record.role = static_cast<UINT8>(i);
+		record.zone_id = static_cast<INT32>(ents[0]->ZoneId);
+		record.x = ent->Position.x;
+		record.y = ent->Position.y;
+		record.z = ent->Position.z;
+		record.heading = ent->Heading;
+		float seconds = static_cast<float>((now.QuadPart - track.qpc) / (qpc_per_us * 1000000.0));
+		if (track.spawn_id == ent->SpawnId && seconds > 0 && seconds < 1.f) //a new spawn or a long gap starts from rest
 		{
-			nlohmann::json data = { {"zone", Zeal::EqGame::get_self()->ZoneId}, {"location", Zeal::EqGame::get_self()->Position.toJson() }, {"heading", Zeal::EqGame::get_self()->Heading} };
-			write(data.dump(), pipe_data_type::player);
+			record.vx = (record.x - track.x) / seconds;
+			record.vy = (record.y - track.y) / seconds;
+			record.vz = (record.z - track.z) / seconds;
+			float turn = record.heading - track.heading;
+			if (turn > 256.f)
+				turn -= 512.f;
+			else if (turn < -256.f)
+				turn += 512.f;
+			record.heading_rate = turn / seconds;
 		}
-		last_output = GetTickCount64();
+		track = { ent->SpawnId, now.QuadPart, record.x, record.y, record.z, record.heading };
+		append_pod(motion_payload, record);
+		count++;
+	}
+	memcpy(&motion_payload[0], &count, sizeof(count));
+	write_binary(pipe_data_type::motion, motion_payload);
+}
+
+UINT8 named_pipe::health_role(Zeal::EqStructures::Entity* ent) const
+{
+	UINT8 role = 0;
+	if (ent == Zeal::EqGame::get_self())
+		role |= pipe_health_self;
+	if (ent == Zeal::EqGame::get_target())
+		role |= pipe_health_target;
+	Zeal::EqStructures::Entity* owner = ent->PetOwnerSpawnId ? ZealService::get_instance()->pet_tracker->owner(ent) : nullptr;
+	if (owner && owner == Zeal::EqGame::get_self())
+		role |= pipe_health_pet;
+	Zeal::EqStructures::Entity** group = (Zeal::EqStructures::Entity**)Zeal::EqGame::GroupList;
+	for (int i = 0; i < EQ_NUM_GROUP_MEMBERS; ++i)
+	{
+		if (group[i] == ent)
+			role |= pipe_health_group;
+		if (owner && group[i] == owner)
+			role |= pipe_health_pet;
+	}
+	if (ent->Type == 0 && ZealService::get_instance()->raid_hook->find_member(ent->Name))
+		role |= pipe_health_raid;
+	return role;
+}
+
+void named_pipe::push_health(Zeal::EqStructures::Entity* ent, UINT8 role, UINT64 time_us)
+{
+	int hp_current = static_cast<int>(ent->HpCurrent); //negative while dying
+	int hp_max = static_cast<int>(ent->HpMax);
+	UINT8 hp = hp_max > 0 && hp_current > 0 ? static_cast<UINT8>(hp_current >= hp_max ? 100 : hp_current * 100 / hp_max) : 0;
+	UINT8 mana = 255;
+	if (role & pipe_health_self)
+	{
+		Zeal::EqStructures::EQCHARINFO* info = Zeal::EqGame::get_char_info();
+		short max_mana = info ? info->max_mana() : 0;
+		if (max_mana > 0)
+			mana = static_cast<UINT8>(info->mana() * 100 / max_mana);
+	}
+	if (mana > 100 && mana != 255)
+		mana = 100;
+	if (last_health[ent->SpawnId] == hp && (!(role & pipe_health_self) || last_self_mana == mana))
+		return;
+	last_health[ent->SpawnId] = hp;
+	if (role & pipe_health_self)
+		last_self_mana = mana;
+	if (health_events.size() < 0xFFFF)
+		health_events.push_back({ time_us, ent->SpawnId, hp, mana, role });
+}
+
+void named_pipe::health_tick()
+{
+	int binary_clients = client_count[static_cast<int>(pipe_format::binary)].load(std::memory_order_relaxed);
+	bool active = binary_clients > 0 && wants(pipe_data_type::health);
+	ZealService::get_instance()->entity_manager->set_subscription_mask(health_subscription, active ?
+		(1u << static_cast<int>(entity_event_type::hp_changed)) | (1u << static_cast<int>(entity_event_type::target_changed)) : 0);
+	Zeal::EqStructures::Entity* self = Zeal::EqGame::get_self();
+	if (!active || !self)
+	{
+		health_clients = 0;
+		health_events.clear();
+		return;
+	}
+	LARGE_INTEGER now;
+	QueryPerformanceCounter(&now);
+	UINT64 time_us = static_cast<UINT64>(now.QuadPart / qpc_per_us);
+	if (binary_clients > health_clients || last_health.empty()) //someone new, resend everyone in view
+	{
+		last_health.assign(0x10000, 255);
+		last_self_mana = 255;
+		health_events.clear();
+		for (Zeal::EqStructures::Entity* ent = Zeal::EqGame::get_entity_list(); ent; ent = ent->Next)
+			if (UINT8 role = health_role(ent))
+				push_health(ent, role, time_us);
+	}
+	else
+		push_health(self, health_role(self), time_us); //mana has no change event
+	health_clients = binary_clients;
+	if (health_events.empty())
+		return;
+	health_payload.clear();
+	UINT16 count = static_cast<UINT16>(health_events.size());
+	append_pod(health_payload, count);
+	for (const pipe_health_record& record : health_events)
+		append_pod(health_payload, record);
+	health_events.clear();
+	write_binary(pipe_data_type::health, health_payload);
+}
+
+void named_pipe::flush_entity_events(bool json_out, bool binary_out)
+{
+	if (!entity_events.size())
+		return;
+	static const char* event_names[static_cast<int>(entity_event_type::_count)] = { "spawned", "despawned", "hp_changed", "moved", "target_changed", "level_changed", "type_changed", "owner_changed" };
+	if (json_out)
+	{
+		scratch.clear();
+		json_writer events(scratch);
+		events.begin_array();
+		for (auto& e : entity_events)
+			events.begin_object().field("event", event_names[e.event]).key("location").begin_array().value(e.x).value(e.y).value(e.z).end_array()
+				.field("new", e.new_value).field("old", e.old_value).field("spawn_id", e.spawn_id).end_object();
+		events.end_array();
+		write(scratch, pipe_data_type::entity);
 	}
+	if (binary_out)
+	{
+		std::string payload;
+		append_pod<UINT16>(payload, static_cast<UINT16>(entity_events.size()));
+		for (auto& e : entity_events)
+			append_pod(payload, e);
+		write_binary(pipe_data_type::entity, payload);
+	}
+	entity_events.clear();
 }
 
 std::string ArgsToString(const std::vector<std::string>& vec, const std::string& delimiter) {
@@ -202,105 +404,734 @@ std::string ArgsToString(const std::vector<std::string>& vec, const std::string&
 	return result;
 }
 
-struct PipeData {
-	OVERLAPPED overlapped;
-	HANDLE pipe;
-	PipeData(HANDLE h) {
-		pipe = h;
-		ZeroMemory(&overlapped, sizeof(OVERLAPPED));
-		//overlapped.hEvent = CreateEvent(NULL, TRUE, FALSE, NULL);
+void named_pipe::write(const std::string& data, pipe_data_type data_type, int color_index)
+{
+	if (!has_clients(pipe_format::json) || !wants(data_type))
+		return;
+	ZEAL_PROFILE_SCOPE("pipe write");
+	pipe_buffer* buffer = acquire_buffer();
+	append_json_envelope(buffer->data, data_type, character, data.c_str(), data.length());
+	submit(pipe_format::json, data_type, buffer, color_index);
+}
+
+void named_pipe::write(const std::string& data)
+{
+	if (!has_clients(pipe_format::json))
+		return;
+	pipe_buffer* buffer = acquire_buffer();
+	buffer->data = data;
+	submit(pipe_format::json, pipe_data_type::custom, buffer);
+}
+
+void named_pipe::write_binary(pipe_data_type data_type, const std::string& payload, int color_index)
+{
+	if (!has_clients(pipe_format::binary) || !wants(data_type))
+		return;
+	pipe_frame_header header;
+	header.version = pipe_schema_version;
+	header.type = static_cast<UINT8>(data_type);
+	header.name_len = static_cast<UINT8>(character.length() > 0xFF ? 0xFF : character.length());
+	header.payload_len = static_cast<UINT32>(payload.length());
+	pipe_buffer* buffer = acquire_buffer();
+	append_pod(buffer->data, header);
+	buffer->data.append(character.c_str(), header.name_len);
+	buffer->data += payload;
+	submit(pipe_format::binary, data_type, buffer, color_index);
+}
+
+bool named_pipe::has_clients(pipe_format format) const
+{
+	return client_count[static_cast<int>(format)].load(std::memory_order_relaxed) > 0;
+}
+
+pipe_buffer* named_pipe::acquire_buffer()
+{
+	ZEAL_ASSERT_GAME_THREAD();
+	pipe_buffer* buffer = nullptr;
+	while (recycled.pop(buffer))
+		free_buffers.push_back(buffer);
+	if (free_buffers.size())
+	{
+		buffer = free_buffers.back();
+		free_buffers.pop_back();
+	}
+	else
+	{
+		buffer = new pipe_buffer();
+		buffer->data.reserve(1024);
+	}
+	buffer->data.clear();
+	buffer->records.clear();
+	buffer->character.clear();
+	buffer->refs = 0;
+	return buffer;
+}
+
+void named_pipe::release_buffer(pipe_buffer* buffer)
+{
+	if (--buffer->refs > 0)
+		return;
+	if (buffer->data.capacity() > 0x10000) //don't let one huge frame pin memory
+		delete buffer;
+	else if (buffer->pipe_owned)
+	{
+		if (spare_buffers.size() < pipe_instances * 4)
+			spare_buffers.push_back(buffer);
+		else
+			delete buffer;
+	}
+	else if (!recycled.push(std::move(buffer)))
+		delete buffer;
+}
+
+void named_pipe::submit(pipe_format format, pipe_data_type data_type, pipe_buffer* buffer, int color_index)
+{
+	ZEAL_ASSERT_GAME_THREAD();
+	pipe_frame frame = { format, data_type, buffer, color_index };
+	if (!frames.push(std::move(frame)))
+	{
+		//the pipe thread is behind, never wait on it from the game thread
+		free_buffers.push_back(buffer);
+		if (data_type == pipe_data_type::label || data_type == pipe_data_type::gauge)
+			keyframe_requested = true;
+		return;
 	}
-};
+	if (!wake_pending.exchange(true))
+		PostQueuedCompletionStatus(port, 0, 0, nullptr);
+}
 
-void CALLBACK WriteCompletion(DWORD dwErrorCode, DWORD dwNumberOfBytesTransfered, LPOVERLAPPED lpOverlapped) {
-	PipeData* pData = reinterpret_cast<PipeData*>(lpOverlapped);
-	delete pData;
+pipe_buffer* named_pipe::begin_records()
+{
+	pipe_buffer* buffer = acquire_buffer();
+	buffer->character = character;
+	return buffer;
 }
 
-bool IsValidHandle(HANDLE h) {
-	return (h != INVALID_HANDLE_VALUE) && (GetFileType(h) != FILE_TYPE_UNKNOWN || GetLastError() == NO_ERROR);
+void named_pipe::add_record(pipe_buffer* buffer, int id, size_t start)
+{
+	buffer->records.push_back({ static_cast<UINT16>(id), static_cast<UINT32>(start), static_cast<UINT32>(buffer->data.length() - start) });
+}
+
+void named_pipe::submit_records(pipe_format format, pipe_data_type data_type, pipe_buffer* buffer)
+{
+	if (!buffer)
+		return;
+	if (buffer->records.empty())
+		free_buffers.push_back(buffer);
+	else
+		submit(format, data_type, buffer);
 }
 
+void named_pipe::update_character()
+{
+	if (Zeal::EqGame::is_in_game() && Zeal::EqGame::get_self())
+		character = Zeal::EqGame::get_self()->Name;
+	else
+		character.clear();
+}
 
+//runs on the pipe thread, so no Zeal::String::tryParse (it prints to chat on failure)
+static bool parse_int(const std::string& str, int* result)
+{
+	char* end = nullptr;
+	long value = strtol(str.c_str(), &end, 10);
+	if (str.empty() || *end)
+		return false;
+	*result = static_cast<int>(value);
+	return true;
+}
 
-bool WriteDataWithRetry(HANDLE h, const std::string& data, OVERLAPPED* pData, LPOVERLAPPED_COMPLETION_ROUTINE WriteCompletion) {
-	const int maxRetries = 3;
-	int attempt = 0;
-	if (IsValidHandle(h))
+static bool parse_ids(const std::string& list, std::vector<int>& ids)
+{
+	std::vector<std::string> parts = Zeal::String::split(list, ",");
+	for (auto& p : parts)
 	{
-		//DWORD bytesAvailable;
-		//DWORD totalBytes;
-		//DWORD bytesLeftThisMessage;
-		//if (PeekNamedPipe(h, NULL, 0, NULL, &bytesAvailable, &bytesLeftThisMessage)) {
-		//	std::cout << "Bytes available in pipe: " << bytesAvailable << std::endl;
-		//	while (bytesAvailable > 1024*16) {
-		//		PeekNamedPipe(h, NULL, 0, NULL, &bytesAvailable, &bytesLeftThisMessage);
-		//		Sleep(1); // Slow down if pipe is too full
-		//	}
-		//}
-		while (attempt < maxRetries) {
-			if (WriteFileEx(h, data.c_str(), static_cast<DWORD>(data.length()), pData, WriteCompletion)) {
-				return true;
-			}
-			else {
-				DWORD errorCode = GetLastError();
-				char* errorMsg = nullptr;
-				FormatMessageA(
-					FORMAT_MESSAGE_ALLOCATE_BUFFER | FORMAT_MESSAGE_FROM_SYSTEM | FORMAT_MESSAGE_IGNORE_INSERTS,
-					nullptr,
-					errorCode,
-					MAKELANGID(LANG_NEUTRAL, SUBLANG_DEFAULT),
-					reinterpret_cast<LPSTR>(&errorMsg),
-					0,
-					nullptr
-				);
-
-				if (errorCode != 232) //the pipe is being closed -- when closing the other end abruptly
-				{
-					if (errorMsg) {
-						Zeal::EqGame::print_chat_hook("WriteFileEx failed on attempt %i with error %u: %s", attempt + 1, errorCode, errorMsg);
-						Zeal::EqGame::print_chat_hook("Parameters [%i] [%s] [%i] [%i]", h, data.c_str(), data.length(), pData);
-						LocalFree(errorMsg); // Free the buffer allocated by FormatMessage
-					}
-					else {
-						Zeal::EqGame::print_chat_hook("WriteFileEx failed on attempt %i with error %u", attempt + 1, errorCode);
-					}
-				}
-
-				Sleep(10);
-				attempt++;
+		int id = 0;
+		if (!parse_int(p, &id))
+			return false;
+		ids.push_back(id);
+	}
+	return true;
+}
+
+static int parse_type(const std::string& name)
+{
+	static const char* type_names[pipe_data_type_count] = { "log", "label", "gauge", "player", "custom", "entity", "buff", "motion", "health", "cast" };
+	for (int i = 0; i < pipe_data_type_count; i++)
+	{
+		if (Zeal::String::compare_insensitive(name, type_names[i]))
+			return i;
+	}
+	return -1;
+}
+
+template<size_t N>
+static void apply_id_filter(std::bitset<N>& set, const std::string& list)
+{
+	if (Zeal::String::compare_insensitive(list, "all"))
+	{
+		set.set();
+		return;
+	}
+	std::vector<int> ids;
+	if (!parse_ids(list, ids))
+		return;
+	set.reset();
+	for (int id : ids)
+	{
+		if (id >= 0 && id < (int)N)
+			set.set(id);
+	}
+}
+
+void named_pipe::handle_client_command(pipe_client& client, const std::string& line)
+{
+	std::vector<std::string> args = Zeal::String::split(line, " ");
+	if (args.size() < 2)
+		return;
+	if (Zeal::String::compare_insensitive(args[0], "auth"))
+	{
+		client.authenticated = !command_key.empty() && args[1] == command_key;
+		if (!client.authenticated)
+			ZEAL_LOG_WARN("pipe", "a client on %s sent the wrong command key", *client.name);
+		return;
+	}
+	if (Zeal::String::compare_insensitive(args[0], "exec") || Zeal::String::compare_insensitive(args[0], "target"))
+	{
+		if (!client.authenticated)
+			return;
+		pipe_command command;
+		if (Zeal::String::compare_insensitive(args[0], "target"))
+		{
+			int spawn_id = 0;
+			if (!parse_int(args[1], &spawn_id) || spawn_id <= 0 || spawn_id > 0xFFFF)
+				return;
+			command.kind = pipe_command::target;
+			command.spawn_id = static_cast<WORD>(spawn_id);
+		}
+		else
+		{
+			command.text = line.substr(line.find(' ') + 1);
+			if (command.text.empty() || command.text.length() > 255) //the chat line's limit
+				return;
+		}
+		queue_command(std::move(command));
+		return;
+	}
+	pipe_subscription& sub = client.subscription;
+	pipe_subscription before = sub;
+	if (Zeal::String::compare_insensitive(args[0], "types"))
+	{
+		if (Zeal::String::compare_insensitive(args[1], "all"))
+			sub.types = 0xFFFFFFFF;
+		else
+		{
+			sub.types = 0;
+			for (auto& t : Zeal::String::split(args[1], ","))
+			{
+				int type = parse_type(t);
+				if (type >= 0)
+					sub.types |= 1 << type;
 			}
 		}
 	}
+	else if (Zeal::String::compare_insensitive(args[0], "labels"))
+		apply_id_filter(sub.labels, args[1]);
+	else if (Zeal::String::compare_insensitive(args[0], "gauges"))
+		apply_id_filter(sub.gauges, args[1]);
+	else if (Zeal::String::compare_insensitive(args[0], "colors"))
+		apply_id_filter(sub.colors, args[1]);
+	else if (Zeal::String::compare_insensitive(args[0], "rate") && args.size() > 2)
+	{
+		int type = parse_type(args[1]);
+		int ms = 0;
+		if (type >= 0 && parse_int(args[2], &ms))
+			sub.rate[type] = ms > 0 ? ms : 0;
+	}
+	mark_records(client, &before); //a widened filter gets the current values of what it gained
+	publish_subscriptions();
+}
+
+void named_pipe::queue_command(pipe_command&& command)
+{
+	if (!commands.push(std::move(command)))
+		dropped_commands.fetch_add(1, std::memory_order_relaxed);
+}
+
+// a tool's commands land here within a frame of being written, in the order they were sent
+void named_pipe::run_commands()
+{
+	if (commands.empty() || !Zeal::EqGame::is_in_game())
+		return; //zoning or at character select, they keep until the client is back
+	UINT dropped = dropped_commands.exchange(0, std::memory_order_relaxed);
+	if (dropped)
+		ZEAL_LOG_WARN("pipe", "%u pipe commands were dropped, the queue was full", dropped);
+	pipe_command command;
+	for (int i = 0; i < commands_per_frame && commands.pop(command); i++)
+	{
+		if (command.kind == pipe_command::target)
+		{
+			if (Zeal::EqStructures::Entity* ent = ZealService::get_instance()->entity_manager->get(command.spawn_id))
+				Zeal::EqGame::set_target(ent);
+		}
+		else
+			Zeal::EqGame::interpret_command(command.text.c_str());
+	}
+}
+
+void named_pipe::publish_subscriptions()
+{
+	UINT32 types = 0;
+	UINT32 labels[pipe_max_label_id / 32] = { 0 };
+	UINT32 gauges = 0;
+	int rate[pipe_data_type_count];
+	for (int i = 0; i < pipe_data_type_count; i++)
+		rate[i] = INT_MAX;
+	for (auto& c : pipe_clients)
+	{
+		if (!c->connected || c->failed)
+			continue;
+		const pipe_subscription& sub = c->subscription;
+		types |= sub.types;
+		for (int id = 0; id < pipe_max_label_id; id++)
+		{
+			if (sub.labels.test(id))
+				labels[id / 32] |= 1u << (id % 32);
+		}
+		gauges |= static_cast<UINT32>(sub.gauges.to_ulong());
+		for (int i = 0; i < pipe_data_type_count; i++)
+		{
+			if ((sub.types >> i) & 1 && sub.rate[i] < rate[i])
+				rate[i] = sub.rate[i];
+		}
+	}
+	if (!std::any_of(pipe_clients.begin(), pipe_clients.end(), [](const std::unique_ptr<pipe_client>& c) { return c->connected; })) //nobody connected, the has_clients checks already short circuit so leave everything enabled for the next client
+	{
+		types = 0xFFFFFFFF;
+		for (auto& l : labels)
+			l = 0xFFFFFFFF;
+		gauges = 0xFFFFFFFF;
+	}
+	wanted_types = types;
+	for (int i = 0; i < pipe_max_label_id / 32; i++)
+		wanted_labels[i] = labels[i];
+	wanted_gauges = gauges;
+	for (int i = 0; i < pipe_data_type_count; i++)
+		wanted_rate[i] = rate[i] == INT_MAX ? 0 : rate[i];
+}
+
+void named_pipe::complete(pipe_client& client, OVERLAPPED* overlapped, DWORD error_code, DWORD bytes_transferred)
+{
+	ZEAL_ASSERT_OWNER(pipe_owner);
+	if (overlapped == &client.connect_overlapped)
+	{
+		client.connecting = false;
+		if (end_thread)
+			return;
+		if (!error_code || error_code == ERROR_PIPE_CONNECTED)
+			accept(client);
+		else //e.g. the client gave up before the connect completed
+			listen(client);
+	}
+	else if (overlapped == &client.overlapped)
+	{
+		client.writing = false;
+		if (error_code)
+			client.failed = true;
+		else if (client.queued.size())
+		{
+			release_buffer(client.queued.front().buffer);
+			client.queued.pop_front();
+		}
+	}
+	else if (overlapped == &client.read_overlapped)
+	{
+		client.reading = false;
+		if (error_code)
+		{
+			if (error_code != ERROR_OPERATION_ABORTED) //client went away, aborted reads are from our own CancelIo
+				client.failed = true;
+			return;
+		}
+		client.read_line.append(client.read_buffer, bytes_transferred);
+		size_t pos;
+		while ((pos = client.read_line.find('\n')) != std::string::npos)
+		{
+			std::string line = client.read_line.substr(0, pos);
+			client.read_line.erase(0, pos + 1);
+			if (!line.empty() && line.back() == '\r')
+				line.pop_back();
+			handle_client_command(client, line);
+		}
+		if (client.read_line.length() > sizeof(client.read_buffer) * 4) //garbage without newlines
+			client.read_line.clear();
+		if (!client.failed && !end_thread)
+			start_read(client);
+	}
+}
+
+// a read or write that finishes straight away still posts its completion to the port
+void named_pipe::start_read(pipe_client& client)
+{
+	ZeroMemory(&client.read_overlapped, sizeof(OVERLAPPED));
+	if (ReadFile(client.handle, client.read_buffer, sizeof(client.read_buffer), nullptr, &client.read_overlapped) || GetLastError() == ERROR_IO_PENDING)
+		client.reading = true;
+	else
+		client.failed = true;
+}
+
+void named_pipe::listen(pipe_client& client)
+{
+	if (client.handle == INVALID_HANDLE_VALUE)
+	{
+		client.handle = CreateNamedPipeA(client.name->c_str(), PIPE_ACCESS_DUPLEX | FILE_FLAG_OVERLAPPED, PIPE_TYPE_BYTE | PIPE_WAIT | PIPE_READMODE_BYTE | PIPE_REJECT_REMOTE_CLIENTS,
+			pipe_instances, 32768, 32768, NMPWAIT_USE_DEFAULT_WAIT, NULL);
+		if (client.handle == INVALID_HANDLE_VALUE)
+		{
+			ZEAL_LOG_WARN("pipe", "creating an instance of %s failed, error %u", *client.name, GetLastError()); //the pipe thread never blocks on a message box
+			return;
+		}
+		if (!CreateIoCompletionPort(client.handle, port, reinterpret_cast<ULONG_PTR>(&client), 0))
+		{
+			ZEAL_LOG_WARN("pipe", "attaching %s to the completion port failed, error %u", *client.name, GetLastError());
+			CloseHandle(client.handle);
+			client.handle = INVALID_HANDLE_VALUE;
+			return;
+		}
+	}
+	else
+		DisconnectNamedPipe(client.handle); //recycled from the previous client
+	ZeroMemory(&client.connect_overlapped, sizeof(OVERLAPPED));
+	if (ConnectNamedPipe(client.handle, &client.connect_overlapped))
+	{
+		client.connecting = true; //completion is queued
+		return;
+	}
+	DWORD error = GetLastError();
+	if (error == ERROR_IO_PENDING)
+		client.connecting = true;
+	else if (error == ERROR_PIPE_CONNECTED) //client connected between create and connect, nothing gets queued for it
+		accept(client);
+	else
+	{
+		ZEAL_LOG_WARN("pipe", "listening on %s failed, error %u", *client.name, error);
+		CloseHandle(client.handle);
+		client.handle = INVALID_HANDLE_VALUE;
+	}
+}
+
+void named_pipe::accept(pipe_client& client)
+{
+	client.connected = true;
+	client.failed = false;
+	client.cancelled = false;
+	client.authenticated = false;
+	client.subscription = pipe_subscription();
+	client.dirty[0].reset();
+	client.dirty[1].reset();
+	for (ULONGLONG& t : client.last_sent)
+		t = 0;
+	mark_records(client, nullptr); //the current values straight away, without waiting for the game's keyframe
+	client.read_line.clear();
+	start_read(client);
+	client_count[static_cast<int>(client.format)]++;
+	publish_subscriptions();
+}
+
+void named_pipe::queue_frame(pipe_client& client, const pipe_frame& frame)
+{
+	ZEAL_ASSERT_OWNER(pipe_owner);
+	frame.buffer->refs++;
+	client.queued.push_back(frame);
+	if (client.queued.size() <= max_queued_frames)
+		return;
+	size_t first = client.writing ? 1 : 0; //the frame in flight has to stay alive until its completion runs
+	if (drop_policy == pipe_drop_policy::coalesce)
+	{
+		size_t before = client.queued.size();
+		client.queued.erase(std::remove_if(client.queued.begin() + first, client.queued.end(), [this](const pipe_frame& f) {
+			if (f.type != pipe_data_type::label && f.type != pipe_data_type::gauge)
+				return false;
+			release_buffer(f.buffer);
+			return true;
+			}), client.queued.end());
+		if (client.queued.size() != before)
+			mark_records(client, nullptr); //resent from the latest values once the client catches up
+	}
+	while (client.queued.size() > max_queued_frames && client.queued.size() > first)
+	{
+		pipe_data_type dropped = client.queued[first].type;
+		release_buffer(client.queued[first].buffer);
+		client.queued.erase(client.queued.begin() + first);
+		if (dropped == pipe_data_type::label || dropped == pipe_data_type::gauge)
+			mark_records(client, nullptr);
+	}
+}
 
-	return false;
+static bool allows_record(const pipe_subscription& sub, int kind, int id)
+{
+	pipe_data_type type = kind ? pipe_data_type::gauge : pipe_data_type::label;
+	if (!((sub.types >> static_cast<int>(type)) & 1))
+		return false;
+	return kind ? id < pipe_max_gauge_id && sub.gauges.test(id) : sub.labels.test(id);
 }
 
-void named_pipe::write(std::string data, pipe_data_type data_type)
+// the records replace the latest value of their ids and mark them for every client whose filter allows them
+void named_pipe::take_records(const pipe_frame& frame)
 {
-	pipe_data pd(data_type, data);
-	write(pd.serialize().dump());
+	int format = static_cast<int>(frame.format);
+	int kind = frame.type == pipe_data_type::gauge ? 1 : 0;
+	int id_count = kind ? pipe_max_gauge_id : pipe_max_label_id;
+	std::string* latest = latest_records[format][kind];
+	latest_character[format] = frame.buffer->character;
+	for (const pipe_record& record : frame.buffer->records)
+	{
+		if (record.id >= id_count)
+			continue;
+		latest[record.id].assign(frame.buffer->data, record.offset, record.length);
+		for (auto& c : pipe_clients)
+		{
+			if (c->format == frame.format && c->connected && !c->failed && allows_record(c->subscription, kind, record.id))
+				c->dirty[kind].set(record.id);
+		}
+	}
 }
 
-void named_pipe::write(std::string data)
+void named_pipe::mark_records(pipe_client& client, const pipe_subscription* before)
 {
+	int format = static_cast<int>(client.format);
+	for (int kind = 0; kind < 2; kind++)
+	{
+		int id_count = kind ? pipe_max_gauge_id : pipe_max_label_id;
+		for (int id = 0; id < id_count; id++)
+		{
+			if (!latest_records[format][kind][id].empty() && allows_record(client.subscription, kind, id) && (!before || !allows_record(*before, kind, id)))
+				client.dirty[kind].set(id);
+		}
+	}
+}
 
-	for (auto& h : pipe_handles)
+// one frame with the client's marked ids, framed the way the game thread frames its other messages
+void named_pipe::flush_records(pipe_client& client, int kind, ULONGLONG now)
+{
+	std::bitset<pipe_max_label_id>& dirty = client.dirty[kind];
+	if (dirty.none())
+		return;
+	pipe_data_type type = kind ? pipe_data_type::gauge : pipe_data_type::label;
+	int t = static_cast<int>(type);
+	ULONGLONG rate = static_cast<ULONGLONG>(client.subscription.rate[t]);
+	if (now - client.last_sent[t] < rate)
+	{
+		flush_wait = std::min<DWORD>(flush_wait, static_cast<DWORD>(rate - (now - client.last_sent[t])));
+		return;
+	}
+	int format = static_cast<int>(client.format);
+	const std::string* latest = latest_records[format][kind];
+	const std::string& character = latest_character[format];
+	record_scratch.clear();
+	UINT16 count = 0;
+	if (client.format == pipe_format::json)
+		record_scratch += '[';
+	else
+		append_pod(record_scratch, count);
+	for (int id = 0; id < pipe_max_label_id; id++)
+	{
+		if (!dirty.test(id) || !allows_record(client.subscription, kind, id)) //the filter may have narrowed since it was marked
+			continue;
+		if (client.format == pipe_format::json && count)
+			record_scratch += ',';
+		record_scratch += latest[id];
+		count++;
+	}
+	dirty.reset();
+	if (!count)
+		return;
+	pipe_buffer* buffer = nullptr;
+	if (spare_buffers.size())
+	{
+		buffer = spare_buffers.back();
+		spare_buffers.pop_back();
+	}
+	else
+	{
+		buffer = new pipe_buffer();
+		buffer->pipe_owned = true;
+	}
+	buffer->data.clear();
+	buffer->refs = 0;
+	if (client.format == pipe_format::json)
+	{
+		record_scratch += ']';
+		append_json_envelope(buffer->data, type, character, record_scratch.c_str(), record_scratch.length());
+	}
+	else
 	{
-		PipeData* pData = new PipeData(h);
+		memcpy(&record_scratch[0], &count, sizeof(count));
+		pipe_frame_header header;
+		header.version = pipe_schema_version;
+		header.type = static_cast<UINT8>(type);
+		header.name_len = static_cast<UINT8>(character.length() > 0xFF ? 0xFF : character.length());
+		header.payload_len = static_cast<UINT32>(record_scratch.length());
+		append_pod(buffer->data, header);
+		buffer->data.append(character.c_str(), header.name_len);
+		buffer->data += record_scratch;
+	}
+	client.last_sent[t] = now;
+	queue_frame(client, { client.format, type, buffer });
+}
 
-		if (h != INVALID_HANDLE_VALUE) {
-			if (!WriteDataWithRetry(h, data, reinterpret_cast<LPOVERLAPPED>(pData), WriteCompletion))
+void named_pipe::service_clients()
+{
+	ZEAL_ASSERT_OWNER(pipe_owner);
+	ZEAL_PROFILE_SCOPE("pipe service");
+	ULONGLONG now = GetTickCount64();
+	pipe_frame frame;
+	while (frames.pop(frame))
+	{
+		frame.buffer->refs++; //held through the fan-out, a client coalescing the new frame away can't free it under the loop
+		if (frame.type == pipe_data_type::label || frame.type == pipe_data_type::gauge)
+			take_records(frame);
+		else
+		{
+			// player and motion frames are snapshots, a client asking for a slower rate just skips some
+			bool snapshot = frame.type == pipe_data_type::player || frame.type == pipe_data_type::motion;
+			int t = static_cast<int>(frame.type);
+			for (auto& c : pipe_clients)
 			{
-				DisconnectNamedPipe(h);
-				CloseHandle(h);
-				h = INVALID_HANDLE_VALUE;
-				delete pData;
+				if (c->format != frame.format || c->failed)
+					continue;
+				const pipe_subscription& sub = c->subscription;
+				if (!((sub.types >> t) & 1))
+					continue;
+				if (frame.color_index >= 0 && frame.color_index < pipe_max_color_index && !sub.colors.test(frame.color_index))
+					continue;
+				if (snapshot && now - c->last_sent[t] < static_cast<ULONGLONG>(sub.rate[t]))
+					continue;
+				if (snapshot)
+					c->last_sent[t] = now;
+				queue_frame(*c, frame);
 			}
 		}
+		release_buffer(frame.buffer); //frees it when nobody kept it
+	}
+	flush_wait = INFINITE;
+	for (auto& c : pipe_clients)
+	{
+		if (!c->connected || c->failed)
+			continue;
+		flush_records(*c, 0, now);
+		flush_records(*c, 1, now);
+	}
+	for (auto& c : pipe_clients)
+	{
+		if (!c->connected || c->writing || c->failed || !c->queued.size())
+			continue;
+		const std::string& data = c->queued.front().buffer->data;
+		ZeroMemory(&c->overlapped, sizeof(OVERLAPPED));
+		if (WriteFile(c->handle, data.c_str(), static_cast<DWORD>(data.length()), nullptr, &c->overlapped) || GetLastError() == ERROR_IO_PENDING)
+			c->writing = true;
+		else
+			c->failed = true;
+	}
+	bool removed = false;
+	for (auto& client : pipe_clients)
+	{
+		pipe_client& c = *client;
+		if (!c.connected || !c.failed)
+			continue;
+		if ((c.reading || c.writing) && !c.cancelled)
+		{
+			CancelIo(c.handle); //the aborted completions come back through the port
+			c.cancelled = true;
+		}
+		if (!c.writing && !c.reading)
+		{
+			for (auto& f : c.queued)
+				release_buffer(f.buffer);
+			c.queued.clear();
+			c.connected = false;
+			client_count[static_cast<int>(c.format)]--;
+			listen(c);
+			removed = true;
+		}
+	}
+	if (removed)
+		publish_subscriptions();
+}
+
+void named_pipe::pipe_thread_main()
+{
+	// a fixed pool of listening instances per endpoint, the endpoint a client opens decides the framing it receives
+	const std::string* names[2] = { &name, &binary_name };
+	const pipe_format formats[2] = { pipe_format::json, pipe_format::binary };
+	for (int i = 0; i < 2; i++)
+	{
+		for (int j = 0; j < pipe_instances; j++)
+		{
+			std::unique_ptr<pipe_client> client = std::make_unique<pipe_client>();
+			client->format = formats[i];
+			client->name = names[i];
+			pipe_clients.push_back(std::move(client));
+		}
+	}
+	for (auto& c : pipe_clients)
+		listen(*c);
+	while (!end_thread)
+	{
+		DWORD transferred = 0;
+		ULONG_PTR key = 0;
+		OVERLAPPED* overlapped = nullptr;
+		BOOL ok = GetQueuedCompletionStatus(port, &transferred, &key, &overlapped, flush_wait);
+		if (overlapped)
+			complete(*reinterpret_cast<pipe_client*>(key), overlapped, ok ? 0 : GetLastError(), transferred);
+		else if (ok)
+			wake_pending = false; //cleared before the queue is drained so a frame pushed meanwhile posts again
+		else if (GetLastError() != WAIT_TIMEOUT) //a timeout is a client's rate limited labels or gauges coming due
+		{
+			ZEAL_LOG_ERROR("pipe", "waiting on the completion port failed, error %u", GetLastError());
+			break;
+		}
+		service_clients();
+	}
+
+	for (auto& c : pipe_clients)
+	{
+		if (c->handle != INVALID_HANDLE_VALUE)
+			CancelIo(c->handle);
+	}
+	// the cancelled operations still own their OVERLAPPED, their completions have to come back before the clients are freed
+	while (std::any_of(pipe_clients.begin(), pipe_clients.end(), [](const std::unique_ptr<pipe_client>& c) { return c->connecting || c->writing || c->reading; }))
+	{
+		DWORD transferred = 0;
+		ULONG_PTR key = 0;
+		OVERLAPPED* overlapped = nullptr;
+		BOOL ok = GetQueuedCompletionStatus(port, &transferred, &key, &overlapped, 100);
+		if (overlapped)
+			complete(*reinterpret_cast<pipe_client*>(key), overlapped, ok ? 0 : GetLastError(), transferred);
+		else if (!ok && GetLastError() == WAIT_TIMEOUT)
+			break;
+	}
+	for (auto& c : pipe_clients)
+	{
+		for (auto& f : c->queued)
+			release_buffer(f.buffer);
+		if (c->handle != INVALID_HANDLE_VALUE)
+		{
+			DisconnectNamedPipe(c->handle);
+			CloseHandle(c->handle);
+		}
 	}
-	pipe_handles.erase(std::remove_if(pipe_handles.begin(), pipe_handles.end(), [](HANDLE x) { return x == INVALID_HANDLE_VALUE; }), pipe_handles.end());
+	pipe_clients.clear();
+	for (pipe_buffer* buffer : spare_buffers)
+		delete buffer;
+	spare_buffers.clear();
+	pipe_frame frame;
+	while (frames.pop(frame))
+		delete frame.buffer;
+	client_count[0] = 0;
+	client_count[1] = 0;
 }
+
 void named_pipe::write(const char* format, ...)
 {
 	va_list argptr;
@@ -315,16 +1146,73 @@ void named_pipe::update_delay(unsigned new_delay)
 {
 	ZealService::get_instance()->ini->setValue("Zeal", "PipeDelay", new_delay);
 	pipe_delay = new_delay;
+	ZealService::get_instance()->callbacks->cancel_timer(pipe_timer);
+	pipe_timer = ZealService::get_instance()->callbacks->add_work([this](int) { main_loop(); return false; }, pipe_delay);
 	Zeal::EqGame::print_chat("pipe delay is now set to %i", pipe_delay);
 }
 
 named_pipe::named_pipe(ZealService* zeal, IO_ini* ini)
 {
+	zeal->memory_report->add("pipe", [this]() { //the frames queued to the pipe thread are its own, only their count is read
+		Zeal::Memory::usage use{ Zeal::Memory::hash_bytes(last_labels) + Zeal::Memory::hash_bytes(last_gauges) + Zeal::Memory::vector_bytes(free_buffers)
+			+ Zeal::Memory::vector_bytes(entity_events) + Zeal::Memory::vector_bytes(health_events) + Zeal::Memory::vector_bytes(last_health) + Zeal::Memory::string_bytes(scratch)
+			+ Zeal::Memory::string_bytes(motion_payload) + Zeal::Memory::string_bytes(health_payload), queued_frames() };
+		for (const pipe_buffer* buffer : free_buffers)
+			use.bytes += sizeof(pipe_buffer) + Zeal::Memory::string_bytes(buffer->data);
+		for (const auto& [id, label] : last_labels)
+			use.bytes += Zeal::Memory::string_bytes(label);
+		return use;
+	});
 	if (!ini->exists("Zeal", "PipeDelay"))
 		ini->setValue<int>("Zeal", "PipeDelay", 100);
 	pipe_delay = ini->getValue<int>("Zeal", "PipeDelay");
+	if (!ini->exists("Zeal", "PipeDropPolicy"))
+		ini->setValue<int>("Zeal", "PipeDropPolicy", static_cast<int>(pipe_drop_policy::coalesce));
+	drop_policy = static_cast<pipe_drop_policy>(ini->getValue<int>("Zeal", "PipeDropPolicy"));
+	command_key = ini->getValue<std::string>("Zeal", "PipeCommandKey"); //not written back, there is no default key
+	if (ini->exists("Zeal", "PipeCommandsPerFrame"))
+		commands_per_frame = ini->getValue<int>("Zeal", "PipeCommandsPerFrame");
+	if (commands_per_frame < 1)
+		commands_per_frame = 1;
 
-	zeal->callbacks->add_generic([this]() { main_loop(); });
+	pipe_timer = zeal->callbacks->add_work([this](int) { main_loop(); return false; }, pipe_delay);
+	zeal->config_watch->on_reload([this, ini]() {
+		int delay = ini->getValue<int>("Zeal", "PipeDelay");
+		if (delay > 0 && delay != pipe_delay)
+		{
+			pipe_delay = delay;
+			ZealService::get_instance()->callbacks->cancel_timer(pipe_timer);
+			pipe_timer = ZealService::get_instance()->callbacks->add_work([this](int) { main_loop(); return false; }, pipe_delay);
+		}
+	});
+	LARGE_INTEGER frequency;
+	QueryPerformanceFrequency(&frequency);
+	qpc_per_us = frequency.QuadPart / 1000000.0;
+	zeal->callbacks->add_generic([this]() { motion_tick(); health_tick(); }, callback_type::MainLoop);
+	health_subscription = zeal->entity_manager->subscribe([this](const entity_event& e) {
+		if (!e.ent || last_health.empty())
+			return;
+		if (e.type == entity_event_type::target_changed) //a new target always goes out so overlays can show it straight away
+			last_health[e.spawn_id] = 255;
+		if (UINT8 role = health_role(e.ent))
+		{
+			LARGE_INTEGER now;
+			QueryPerformanceCounter(&now);
+			push_health(e.ent, role, static_cast<UINT64>(now.QuadPart / qpc_per_us));
+		}
+	}, 0);
+	entity_subscription = zeal->entity_manager->subscribe([this](const entity_event& e) {
+		if (entity_events.size() >= 0xFFFF) //the count is 16 bit, anything past that before the next sweep is dropped
+			return;
+		pipe_entity_record record = { static_cast<UINT8>(e.type), e.spawn_id, e.old_value, e.new_value, 0.f, 0.f, 0.f };
+		if (e.ent)
+		{
+			record.x = e.ent->Position.x;
+			record.y = e.ent->Position.y;
+			record.z = e.ent->Position.z;
+		}
+		entity_events.push_back(record);
+	}, 0);
 	zeal->commands_hook->add("/pipedelay", {}, "delay between the pipe loop output in milliseconds",
 		[this](std::vector<std::string>& args) {
 			if (args.size() > 1)
@@ -341,78 +1229,38 @@ named_pipe::named_pipe(ZealService* zeal, IO_ini* ini)
 		});
 	zeal->commands_hook->add("/pipe", {}, "outputs text to a pipe",
 		[this](std::vector<std::string>& args) {
-			nlohmann::json data = { {"text", ArgsToString(args, " ")} };
-			write(data.dump(), pipe_data_type::custom);
+			std::string text = ArgsToString(args, " ");
+			std::string data;
+			json_writer(data).begin_object().field("text", text).end_object();
+			write(data, pipe_data_type::custom);
+			if (has_clients(pipe_format::binary))
+				write_binary(pipe_data_type::custom, text);
 			return true; //return true to stop the game from processing any further on this command, false if you want to just add features to an existing cmd
 		});
 	// zeal->hooks->Add("logtextfile", 0x5240dc, log_hook, hook_type_detour); //receiving this via print chat so we can get color indexes
 	name += std::to_string(GetCurrentProcessId());
-	pipe_thread = std::thread([this]() {
-		while (!end_thread)
-		{
-			HANDLE pipe_handle = CreateNamedPipeA(name.c_str(), PIPE_ACCESS_OUTBOUND | FILE_FLAG_OVERLAPPED, PIPE_TYPE_BYTE | PIPE_WAIT | PIPE_READMODE_BYTE, PIPE_UNLIMITED_INSTANCES, 32768, 32768, NMPWAIT_USE_DEFAULT_WAIT, NULL);
-			if (pipe_handle != INVALID_HANDLE_VALUE)
-			{
-				OVERLAPPED overlapped;
-				memset(&overlapped, 0, sizeof(overlapped));
-				overlapped.hEvent = CreateEvent(NULL, TRUE, FALSE, NULL);
-				// Connect named pipe with overlapped I/O
-				if (ConnectNamedPipe(pipe_handle, &overlapped))
-				{
-					// Connection succeeded immediately
-					pipe_handles.push_back(pipe_handle);
-				}
-				else
-				{
-					// Check if connection is pending
-					DWORD error = GetLastError();
-					if (error == ERROR_IO_PENDING)
-					{
-						// Wait for the connection with a timeout
-						DWORD result = WaitForSingleObject(overlapped.hEvent, 500);
-						if (result == WAIT_OBJECT_0)
-						{
-							// Connection completed successfully
-							pipe_handles.push_back(pipe_handle);
-						}
-						else if (result == WAIT_TIMEOUT)
-						{
-							// Timeout occurred, cancel the pending operation
-							CancelIo(pipe_handle);
-							CloseHandle(pipe_handle);
-						}
-						else
-						{
-							// Handle error
-							CloseHandle(pipe_handle);
-						}
-					}
-					else
-					{
-						MessageBoxA(0, "Unhandled error in named pipe", "Pipe error", 0);
-						// Handle error
-						CloseHandle(pipe_handle);
-					}
-				}
-
-				// Cleanup
-				CloseHandle(overlapped.hEvent);
-
-			}
-		}
-		});
-	pipe_thread.detach();
+	binary_name += std::to_string(GetCurrentProcessId());
+	port = CreateIoCompletionPort(INVALID_HANDLE_VALUE, NULL, 0, 1);
+	publish_subscriptions();
+	update_character();
+	zeal->callbacks->add_generic([this]() { update_character(); last_health.clear(); }, callback_type::Zone); //spawn ids are reused across zones
+	zeal->callbacks->add_generic([this]() { ZealService::get_instance()->fast_login->defer([this]() { update_character(); }); }, callback_type::InitUI);
+	zeal->callbacks->add_generic([this]() { character.clear(); }, callback_type::CharacterSelect);
+	if (port)
+		pipe_thread = std::thread([this]() { pipe_thread_main(); });
 }
 named_pipe::~named_pipe()
 {
 	end_thread = true;
+	if (port)
+		PostQueuedCompletionStatus(port, 0, 0, nullptr);
 	if (pipe_thread.joinable())
 		pipe_thread.join();
-
-	for (auto& h : pipe_handles)
-	{
-		DisconnectNamedPipe(h);
-		CloseHandle(h);
-	}
-
-}
\ No newline at end of file
+	if (port)
+		CloseHandle(port);
+	pipe_buffer* buffer = nullptr;
+	while (recycled.pop(buffer))
+		delete buffer;
+	for (auto b : free_buffers)
+		delete b;
+}
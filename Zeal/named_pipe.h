@@ -3,13 +3,207 @@
 #include <Windows.h>
 #include <string>
 #include <thread>
+#include <unordered_map>
+#include <map>
+#include <deque>
+#include <atomic>
+#include <memory>
+#include <bitset>
+#include "spsc_queue.h"
+#include "thread_affinity.h"
+namespace Zeal { namespace EqStructures { struct Entity; } }
 enum struct pipe_data_type
 {
 	log,
 	label,
 	gauge,
 	player,
-	custom
+	custom,
+	entity,
+	buff,
+	motion,
+	health,
+	cast
+};
+enum struct pipe_format
+{
+	json,
+	binary
+};
+// binary framing, all fields little endian:
+// frame: pipe_frame_header, character name (name_len bytes), payload (payload_len bytes)
+// label payload: UINT16 count, then count * { UINT16 id, UINT16 len, char value[len] }
+// gauge payload: UINT16 count, then count * { UINT16 id, INT32 value, UINT16 len, char text[len] }
+// log payload: INT32 color_index, then the text
+// player payload: pipe_player_record
+// custom payload: the text
+// entity payload: UINT16 count, then count * pipe_entity_record
+// buff payload: UINT16 count, then count * pipe_buff_record, sent whenever a buff starts, ends, is refreshed or nears expiry
+// motion payload: UINT16 count, then count * pipe_motion_record (self, then the target if any). binary only and opt in,
+// sampled every frame at the motion rate (33ms unless a client asks for another, never under 16ms)
+// health payload: UINT16 count, then count * pipe_health_record for self, group, raid members and the target whose hp or
+// mana percent moved, every spawn in view when a client connects. binary only and opt in
+// cast payload: pipe_cast_record, sent when one of the player's casts begins, completes or is interrupted
+static constexpr UINT16 pipe_schema_version = 1;
+#pragma pack(push, 1)
+struct pipe_frame_header
+{
+	UINT16 version;
+	UINT8 type; //pipe_data_type
+	UINT8 name_len;
+	UINT32 payload_len;
+};
+struct pipe_player_record
+{
+	INT32 zone_id;
+	float x;
+	float y;
+	float z;
+	float heading;
+};
+struct pipe_entity_record
+{
+	UINT8 event; //entity_event_type
+	UINT16 spawn_id;
+	INT32 old_value;
+	INT32 new_value;
+	float x; //position when the event was raised, zero for despawned
+	float y;
+	float z;
+};
+struct pipe_buff_record
+{
+	UINT8 slot;
+	UINT8 expiring; //inside BuffWarnSeconds
+	UINT16 spell_id;
+	INT32 remaining_ms;
+};
+struct pipe_motion_record
+{
+	UINT64 time_us; //QueryPerformanceCounter in microseconds, monotonic, to place each sample when interpolating
+	UINT16 spawn_id;
+	UINT8 role; //0 self, 1 target
+	UINT8 reserved;
+	INT32 zone_id;
+	float x;
+	float y;
+	float z;
+	float heading;
+	float vx; //units per second since the previous sample of the same spawn, zero on its first
+	float vy;
+	float vz;
+	float heading_rate; //heading units per second, the shorter way around
+};
+enum pipe_health_role : UINT8
+{
+	pipe_health_self = 1,
+	pipe_health_group = 2,
+	pipe_health_raid = 4,
+	pipe_health_target = 8,
+	pipe_health_pet = 16 //the pet of self or a group member
+};
+struct pipe_health_record
+{
+	UINT64 time_us; //same clock as pipe_motion_record
+	UINT16 spawn_id;
+	UINT8 hp_percent;
+	UINT8 mana_percent; //255 when the client doesn't know it, it only knows self's
+	UINT8 role; //pipe_health_role flags
+};
+struct pipe_cast_record
+{
+	UINT8 event; //1 begin, 2 complete, 3 interrupt
+	UINT8 gem; //0 based, 255 for an item click
+	UINT16 spell_id;
+	INT32 cast_ms; //the server's cast time
+	INT32 remaining_ms; //until the cast bar ends, zero past a begin
+	INT32 ready_ms; //until the gem is back, zero for an interrupt
+	INT32 recovery_ms; //until any gem can be cast
+};
+#pragma pack(pop)
+enum struct pipe_drop_policy
+{
+	drop_oldest, //drop the oldest queued frame for a slow client
+	coalesce //drop queued label/gauge frames for a slow client and resync them with a keyframe
+};
+static constexpr int pipe_data_type_count = 10;
+static constexpr int pipe_max_label_id = 256;
+static constexpr int pipe_max_gauge_id = 32;
+static constexpr int pipe_max_color_index = 512;
+static constexpr int pipe_instances = 8; //per endpoint, past that a client waits until one frees up
+// one label or gauge inside a record frame's data
+struct pipe_record
+{
+	UINT16 id;
+	UINT32 offset;
+	UINT32 length;
+};
+// pooled frame storage, handed back to the game thread through named_pipe::recycled once every client wrote it.
+// label and gauge frames from the game thread carry unframed records instead, the pipe thread frames them per client
+struct pipe_buffer
+{
+	std::string data;
+	int refs = 0; //only touched by the pipe thread once the frame is queued
+	std::vector<pipe_record> records; //label and gauge frames only
+	std::string character; //label and gauge frames only, the name their client frames carry
+	bool pipe_owned = false; //a client frame built on the pipe thread, kept in its own pool
+};
+struct pipe_frame
+{
+	pipe_format format;
+	pipe_data_type type;
+	pipe_buffer* buffer = nullptr; //shared between every client of the format
+	int color_index = -1; //log frames only
+};
+// what a client asked for over its inbound channel, one command per line:
+//   types log,label,gauge,player,custom,entity,buff,motion,health,cast | labels 17,18 | gauges 1,2 | colors 10,15 | rate label 1000
+// any of them accept "all", a client that never sends anything gets everything except the entity, motion and health feeds, which are opt in
+// the same channel takes commands once the client has sent the PipeCommandKey from eqclient.ini, no key turns them off:
+//   auth <key> | exec /say hi | exec /zeal cam on | target 1234
+struct pipe_subscription
+{
+	UINT32 types = ~((1u << static_cast<int>(pipe_data_type::entity)) | (1u << static_cast<int>(pipe_data_type::motion)) |
+		(1u << static_cast<int>(pipe_data_type::health)));
+	std::bitset<pipe_max_label_id> labels;
+	std::bitset<pipe_max_gauge_id> gauges;
+	std::bitset<pipe_max_color_index> colors;
+	int rate[pipe_data_type_count] = { 0 }; //minimum ms between label, gauge, player and motion frames to this client
+	pipe_subscription() { labels.set(); gauges.set(); colors.set(); }
+};
+// one instance of the fixed pool, it goes back to listening when its client disconnects instead of being closed
+struct pipe_client
+{
+	OVERLAPPED overlapped; //one write in flight per client
+	OVERLAPPED read_overlapped; //one read in flight per client
+	OVERLAPPED connect_overlapped; //the pending connect while listening
+	HANDLE handle = INVALID_HANDLE_VALUE;
+	pipe_format format;
+	const std::string* name = nullptr; //endpoint the instance serves
+	bool connecting = false;
+	bool connected = false;
+	bool writing = false;
+	bool reading = false;
+	bool failed = false;
+	bool cancelled = false;
+	bool authenticated = false; //sent the command key since it connected
+	std::deque<pipe_frame> queued; //front is the frame being written while writing is set
+	pipe_subscription subscription;
+	std::bitset<pipe_max_label_id> dirty[2]; //label, gauge ids changed since this client's last frame of the type
+	ULONGLONG last_sent[pipe_data_type_count] = { 0 }; //tick of the last rate limited frame per type
+	char read_buffer[512];
+	std::string read_line;
+};
+// handed from the pipe thread to the game thread, run at the start of the next main loop
+struct pipe_command
+{
+	enum kind_type : UINT8
+	{
+		command, //typed as if on the chat line
+		target //by spawn id
+	};
+	kind_type kind = command;
+	WORD spawn_id = 0;
+	std::string text;
 };
 struct pipe_data
 {
@@ -17,7 +211,7 @@ struct pipe_data
 	UINT data_len;
 	std::string data;
 	std::string character;
-	pipe_data(pipe_data_type _type, std::string _data);
+	pipe_data(pipe_data_type _type, std::string _data, const std::string& _character);
 	pipe_data() : data{ "" }, character{ "" } {};
 	nlohmann::json serialize() const
 	{
@@ -36,16 +230,107 @@ public:
 	named_pipe(class ZealService* zeal, class IO_ini* ini);
 	~named_pipe();
 	void chat_msg(const char* data, int color_index);
-	void write(std::string data, pipe_data_type data_type);
-	void write(std::string data);
+	void write(const std::string& data, pipe_data_type data_type, int color_index = -1);
+	void write(const std::string& data);
 	void write(const char* format, ...);
+	void write_binary(pipe_data_type data_type, const std::string& payload, int color_index = -1);
 	void main_loop();
 	void update_delay(unsigned new_delay);
+	size_t queued_frames() const { return frames.size(); } //handed to the pipe thread but not yet picked up
+	void run_commands(); //game thread, at the start of main_loop_hk
 private:
 	int pipe_delay=500;
-	bool end_thread = false;
+	UINT pipe_timer = 0;
+	// labels and gauges are only sent when they change, with a full keyframe every keyframe_interval ms or when a client connects
+	int keyframe_interval = 5000;
+	ULONGLONG last_keyframe = 0;
+	size_t last_client_count = 0;
+	std::unordered_map<int, std::string> last_labels;
+	std::unordered_map<int, std::pair<int, std::string>> last_gauges;
+	std::atomic<bool> end_thread = false;
 	std::string name = "\\\\.\\pipe\\zeal_";
-	std::vector<HANDLE> pipe_handles;
+	std::string binary_name = "\\\\.\\pipe\\zeal_bin_";
+	// the game thread only pushes serialized frames, the pipe thread owns the clients and does all of the pipe io
+	spsc_queue<pipe_frame> frames{ 1024 };
+	spsc_queue<pipe_buffer*> recycled{ 1024 }; //pipe thread -> game thread
+	spsc_queue<pipe_command> commands{ 256 }; //pipe thread -> game thread
+	std::string command_key; //set before the pipe thread starts, empty refuses every command
+	int commands_per_frame = 8; //the rest wait for the next frame
+	std::atomic<UINT> dropped_commands = 0;
+	void queue_command(pipe_command&& command);
+	std::vector<pipe_buffer*> free_buffers; //game thread only
+	std::string character; //cached on zone and character select instead of read per message
+	std::string scratch; //game thread only, reused for inner json payloads
+	std::vector<pipe_entity_record> entity_events; //entity change feed gathered between sweeps
+	UINT entity_subscription = 0;
+	void flush_entity_events(bool json_out, bool binary_out);
+	struct motion_track
+	{
+		WORD spawn_id = 0;
+		LONGLONG qpc = 0;
+		float x = 0, y = 0, z = 0, heading = 0;
+	};
+	void motion_tick(); //every main loop, sends at the motion rate
+	motion_track motion_tracks[2]; //self, target
+	LONGLONG last_motion = 0;
+	double qpc_per_us = 0;
+	std::string motion_payload;
+	// health feed, hp changes arrive from the entity manager and go out once per frame, deduplicated on the sent percents
+	void health_tick(); //every main loop
+	UINT8 health_role(Zeal::EqStructures::Entity* ent) const;
+	void push_health(Zeal::EqStructures::Entity* ent, UINT8 role, UINT64 time_us);
+	UINT health_subscription = 0;
+	int health_clients = 0;
+	std::vector<UINT8> last_health; //hp percent sent per spawn id, 255 for never
+	UINT8 last_self_mana = 255;
+	std::vector<pipe_health_record> health_events;
+	std::string health_payload;
+	pipe_buffer* acquire_buffer();
+	void release_buffer(pipe_buffer* buffer);
+	void submit(pipe_format format, pipe_data_type data_type, pipe_buffer* buffer, int color_index = -1);
+	pipe_buffer* begin_records();
+	void add_record(pipe_buffer* buffer, int id, size_t start); //the record written to data from start on
+	void submit_records(pipe_format format, pipe_data_type data_type, pipe_buffer* buffer); //null or empty is dropped
+	void update_character();
+	// the pipe thread sleeps on this port, connects, reads and writes complete through it and the game thread posts a wake
+	// packet when it queues frames, so an idle pipe costs nothing
+	HANDLE port = nullptr;
+	std::atomic<bool> wake_pending = false; //one wake packet in flight at a time
+	pipe_drop_policy drop_policy = pipe_drop_policy::coalesce;
+	size_t max_queued_frames = 256;
+	std::atomic<int> client_count[2] = { 0, 0 };
+	std::atomic<bool> keyframe_requested = false;
+	// union of every client's subscription, published by the pipe thread so main_loop only gathers what someone wants
+	std::atomic<UINT32> wanted_types = 0xFFFFFFFF;
+	std::atomic<UINT32> wanted_labels[pipe_max_label_id / 32];
+	std::atomic<UINT32> wanted_gauges = 0xFFFFFFFF;
+	std::atomic<int> wanted_rate[pipe_data_type_count];
+	ULONGLONG last_sweep[pipe_data_type_count] = { 0 };
+	bool wants(pipe_data_type type) const;
+	bool wants_label(int id) const;
+	bool wants_gauge(int id) const;
+	bool sweep_due(pipe_data_type type, ULONGLONG now);
+	void publish_subscriptions();
+	void handle_client_command(pipe_client& client, const std::string& line);
+	void start_read(pipe_client& client);
+	void listen(pipe_client& client);
+	void accept(pipe_client& client);
+	void complete(pipe_client& client, OVERLAPPED* overlapped, DWORD error_code, DWORD bytes_transferred);
+	std::vector<std::unique_ptr<pipe_client>> pipe_clients; //pipe thread only
+	Zeal::Thread::owner pipe_owner;
+	bool has_clients(pipe_format format) const;
+	// the latest record per format and id, each client gets the ids its filter allows at its own rate
+	std::string latest_records[2][2][pipe_max_label_id]; //format, label or gauge, id. empty until first seen
+	std::string latest_character[2];
+	std::string record_scratch;
+	std::vector<pipe_buffer*> spare_buffers; //pipe thread only, client frames
+	DWORD flush_wait = INFINITE; //until the next client's rate limited frame comes due
+	void take_records(const pipe_frame& frame);
+	void mark_records(pipe_client& client, const pipe_subscription* before); //ids the client gained since before, all when null
+	void flush_records(pipe_client& client, int kind, ULONGLONG now);
+	void queue_frame(pipe_client& client, const pipe_frame& frame);
+	void service_clients();
+	void pipe_thread_main();
 	std::thread pipe_thread;
 };
 
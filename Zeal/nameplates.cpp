@@ -0,0 +1,340 @@
+#include "nameplates.h"
+#include "Zeal.h"
+#include "EqAddresses.h"
+#include "EqFunctions.h"
+#include "string_util.h"
+#include <algorithm>
+#include <climits>
+
+#define NAMEPLATE_FVF (D3DFVF_XYZRHW | D3DFVF_DIFFUSE | D3DFVF_TEX1)
+static constexpr UINT32 despawn_mask = 1u << static_cast<int>(entity_event_type::despawned);
+static constexpr int names_per_frame = 16;
+static constexpr float bar_width = 60.f;
+static constexpr float bar_height = 4.f;
+
+static void set_draw_states(render_state_cache& states, IDirect3DTexture8* texture)
+{
+	states.set_render_state(D3DRS_CULLMODE, D3DCULL_NONE);
+	states.set_render_state(D3DRS_ALPHABLENDENABLE, TRUE);
+	states.set_render_state(D3DRS_SRCBLEND, D3DBLEND_SRCALPHA);
+	states.set_render_state(D3DRS_DESTBLEND, D3DBLEND_INVSRCALPHA);
+	states.set_render_state(D3DRS_ZENABLE, FALSE);
+	states.set_render_state(D3DRS_ZWRITEENABLE, FALSE);
+	states.set_render_state(D3DRS_LIGHTING, FALSE);
+	states.set_render_state(D3DRS_FOGENABLE, FALSE);
+	states.set_texture_stage_state(0, D3DTSS_COLOROP, D3DTOP_MODULATE);
+	states.set_texture_stage_state(0, D3DTSS_COLORARG1, D3DTA_TEXTURE);
+	states.set_texture_stage_state(0, D3DTSS_COLORARG2, D3DTA_DIFFUSE);
+	states.set_texture_stage_state(0, D3DTSS_ALPHAOP, D3DTOP_MODULATE);
+	states.set_texture_stage_state(0, D3DTSS_ALPHAARG1, D3DTA_TEXTURE);
+	states.set_texture_stage_state(0, D3DTSS_ALPHAARG2, D3DTA_DIFFUSE);
+	states.set_texture_stage_state(0, D3DTSS_MINFILTER, D3DTEXF_POINT);
+	states.set_texture_stage_state(0, D3DTSS_MAGFILTER, D3DTEXF_POINT);
+	states.set_texture_stage_state(1, D3DTSS_COLOROP, D3DTOP_DISABLE);
+	states.set_texture(texture);
+	states.set_vertex_shader(NAMEPLATE_FVF);
+}
+
+bool NameplateAtlas::build(IDirect3DDevice8* device, int pixel_height)
+{
+	row_height = pixel_height + 2;
+	if (FAILED(device->CreateTexture(texture_size, texture_size, 1, 0, D3DFMT_A8R8G8B8, D3DPOOL_MANAGED, &texture)))
+	{
+		texture = nullptr;
+		return false;
+	}
+	dc = CreateCompatibleDC(NULL);
+	if (!dc)
+		return false;
+	font = CreateFontA(-pixel_height, 0, 0, 0, FW_BOLD, FALSE, FALSE, FALSE, ANSI_CHARSET, OUT_DEFAULT_PRECIS, CLIP_DEFAULT_PRECIS, ANTIALIASED_QUALITY, DEFAULT_PITCH, "Arial");
+	BITMAPINFO bmi = {};
+	bmi.bmiHeader.biSize = sizeof(BITMAPINFOHEADER);
+	bmi.bmiHeader.biWidth = max_name_width;
+	bmi.bmiHeader.biHeight = -row_height; //top down
+	bmi.bmiHeader.biPlanes = 1;
+	bmi.bmiHeader.biBitCount = 32;
+	bmi.bmiHeader.biCompression = BI_RGB;
+	bitmap = CreateDIBSection(dc, &bmi, DIB_RGB_COLORS, &bits, NULL, 0);
+	if (!font || !bitmap || !bits)
+		return false;
+	SelectObject(dc, font);
+	SelectObject(dc, bitmap);
+	SetTextColor(dc, RGB(255, 255, 255));
+	SetBkColor(dc, RGB(0, 0, 0));
+	SetBkMode(dc, OPAQUE);
+	clear();
+	return true;
+}
+
+bool NameplateAtlas::ready(IDirect3DDevice8* device, int pixel_height)
+{
+	if (!device || pixel_height <= 0)
+		return false;
+	if (texture && atlas_device == device && atlas_height == pixel_height)
+		return true;
+	release();
+	atlas_device = device;
+	atlas_height = pixel_height;
+	if (!build(device, pixel_height))
+	{
+		release();
+		return false;
+	}
+	return true;
+}
+
+void NameplateAtlas::clear()
+{
+	names.clear();
+	generation++;
+	D3DLOCKED_RECT rect;
+	if (texture && SUCCEEDED(texture->LockRect(0, &rect, NULL, 0)))
+	{
+		for (int y = 0; y < texture_size; y++)
+			memset((BYTE*)rect.pBits + y * rect.Pitch, 0, texture_size * 4);
+		//opaque white 4x4 in the corner, sampled at its center for the untextured bars
+		for (int y = 0; y < 4; y++)
+			for (int x = 0; x < 4; x++)
+				((DWORD*)((BYTE*)rect.pBits + y * rect.Pitch))[x] = 0xFFFFFFFF;
+		texture->UnlockRect(0);
+	}
+	float center = 2.f / texture_size;
+	white_block = { center, center, center, center, 4.f, 4.f };
+	cursor_x = 4;
+	cursor_y = 0;
+}
+
+const NameplateAtlas::entry* NameplateAtlas::find(const std::string& name)
+{
+	auto it = names.find(name);
+	if (it != names.end())
+		return &it->second;
+	if (!texture || renders_left <= 0)
+		return nullptr;
+	renders_left--;
+	SIZE size = { 0, 0 };
+	GetTextExtentPoint32A(dc, name.c_str(), static_cast<int>(name.length()), &size);
+	int width = size.cx + 2 < max_name_width ? size.cx + 2 : max_name_width;
+	if (cursor_x + width > texture_size)
+	{
+		cursor_x = 0;
+		cursor_y += row_height;
+	}
+	if (cursor_y + row_height > texture_size)
+		return nullptr; //full until the owner clears it
+	memset(bits, 0, max_name_width * row_height * 4);
+	TextOutA(dc, 1, 1, name.c_str(), static_cast<int>(name.length()));
+	GdiFlush();
+	RECT area = { cursor_x, cursor_y, cursor_x + width, cursor_y + row_height };
+	D3DLOCKED_RECT rect;
+	if (FAILED(texture->LockRect(0, &rect, &area, 0)))
+		return nullptr;
+	//white text, the gdi coverage becomes the alpha channel
+	for (int y = 0; y < row_height; y++)
+	{
+		const DWORD* src = (const DWORD*)bits + y * max_name_width;
+		DWORD* dest = (DWORD*)((BYTE*)rect.pBits + y * rect.Pitch);
+		for (int x = 0; x < width; x++)
+			dest[x] = ((src[x] & 0xFF) << 24) | 0x00FFFFFF;
+	}
+	texture->UnlockRect(0);
+	entry e = { (float)cursor_x / texture_size, (float)cursor_y / texture_size,
+		(float)(cursor_x + width) / texture_size, (float)(cursor_y + row_height) / texture_size, (float)width, (float)row_height };
+	cursor_x += width;
+	return &names.emplace(name, e).first->second;
+}
+
+void NameplateAtlas::release()
+{
+	if (texture)
+		texture->Release();
+	texture = nullptr;
+	if (dc)
+		DeleteDC(dc);
+	if (bitmap)
+		DeleteObject(bitmap);
+	if (font)
+		DeleteObject(font);
+	dc = nullptr;
+	bitmap = nullptr;
+	font = nullptr;
+	bits = nullptr;
+	atlas_device = nullptr;
+	atlas_height = 0;
+	names.clear();
+	generation++;
+}
+
+void Nameplates::add_quad(float left, float top, float right, float bottom, const NameplateAtlas::entry& e, D3DCOLOR color)
+{
+	left -= 0.5f; top -= 0.5f; right -= 0.5f; bottom -= 0.5f; //texel centers on pixel centers
+	vertex quad[6] = {
+		{ left, top, 0.f, 1.f, color, e.u0, e.v0 },
+		{ right, top, 0.f, 1.f, color, e.u1, e.v0 },
+		{ left, bottom, 0.f, 1.f, color, e.u0, e.v1 },
+		{ right, top, 0.f, 1.f, color, e.u1, e.v0 },
+		{ right, bottom, 0.f, 1.f, color, e.u1, e.v1 },
+		{ left, bottom, 0.f, 1.f, color, e.u0, e.v1 },
+	};
+	vertices.insert(vertices.end(), quad, quad + 6);
+}
+
+const NameplateAtlas::entry* Nameplates::name_for(Zeal::EqStructures::Entity* ent)
+{
+	auto it = by_spawn.find(ent->SpawnId);
+	if (it != by_spawn.end() && it->second.generation == atlas.generation)
+		return it->second.name;
+	char raw[sizeof(ent->Name) + 1];
+	memcpy(raw, ent->Name, sizeof(ent->Name));
+	raw[sizeof(ent->Name)] = 0;
+	const NameplateAtlas::entry* e = atlas.find(Zeal::EqGame::strip_name(raw));
+	if (e)
+		by_spawn[ent->SpawnId] = { atlas.generation, e };
+	return e;
+}
+
+void Nameplates::render()
+{
+	if (!enabled || !Zeal::EqGame::is_in_game())
+		return;
+	ZealService* zeal = ZealService::get_instance();
+	Zeal::EqStructures::Entity* self = Zeal::EqGame::get_self();
+	IDirect3DDevice8* device = zeal->dx->get_device();
+	if (!self || !atlas.ready(device, font_size.get()))
+		return;
+	float max_dist = static_cast<float>(distance.get());
+	zeal->entity_manager->get_visible_actors(max_dist, false, actors);
+	anchors.clear();
+	for (size_t i = 0; i < actors.size(); )
+	{
+		Zeal::EqStructures::Entity* ent = actors[i];
+		if (ent == self || ent->Type > 1) //players and npcs, no corpses
+		{
+			actors[i] = actors.back();
+			actors.pop_back();
+			continue;
+		}
+		anchors.push_back({ ent->Position.x, ent->Position.y, ent->Position.z + ent->Height * 0.5f });
+		i++;
+	}
+	if (actors.empty())
+		return;
+	ConCache* cons = zeal->con_cache.get();
+	screen.resize(anchors.size());
+	on_screen.resize(anchors.size());
+	if (!zeal->dx->WorldToScreen(anchors.data(), anchors.size(), screen.data(), on_screen.data()))
+		return;
+
+	// a box per plate from the cached name width (an estimate before the name is rendered), laid out nearest first so
+	// a crowd keeps the plates that matter and never renders names for the ones dropped
+	boxes.clear();
+	plate_actor.clear();
+	Zeal::EqStructures::Entity* target = Zeal::EqGame::get_target();
+	float line = static_cast<float>(font_size.get());
+	for (size_t i = 0; i < actors.size(); i++)
+	{
+		if (!on_screen[i])
+			continue;
+		Zeal::EqStructures::Entity* ent = actors[i];
+		float x = screen[i].y; //the projector returns rows in x, same as floating damage
+		float y = screen[i].x;
+		auto cached = by_spawn.find(ent->SpawnId);
+		float width = cached != by_spawn.end() && cached->second.generation == atlas.generation ? cached->second.name->width
+			: strnlen(ent->Name, sizeof(ent->Name)) * line * 0.55f;
+		width = std::max(width, health_bars ? bar_width + 2.f : 0.f);
+		float dx = ent->Position.x - self->Position.x, dy = ent->Position.y - self->Position.y;
+		int priority = ent == target ? INT_MAX : -static_cast<int>(std::min(dx * dx + dy * dy, 1e9f));
+		boxes.push_back({ x - width * 0.5f, y - line - 1.f, width, line + 1.f + (health_bars ? bar_height + 1.f : 0.f), priority, false });
+		plate_actor.push_back(i);
+	}
+	Vec2 screen_size = zeal->dx->GetScreenRect();
+	layout.solve(boxes, screen_size.x, screen_size.y, 2); //in place or a line up, further would leave the head it belongs to
+
+	atlas.renders_left = names_per_frame;
+	vertices.clear();
+	bool full = false;
+	for (size_t b = 0; b < boxes.size(); b++)
+	{
+		if (!boxes[b].placed)
+			continue;
+		Zeal::EqStructures::Entity* ent = actors[plate_actor[b]];
+		float x = boxes[b].left + boxes[b].width * 0.5f;
+		float y = boxes[b].top + line + 1.f;
+		if (health_bars)
+		{
+			float percent = ent->HpMax ? static_cast<float>(ent->HpCurrent) / ent->HpMax : 0.f;
+			percent = percent < 0.f ? 0.f : percent > 1.f ? 1.f : percent;
+			BYTE red = static_cast<BYTE>(255 * (1.f - percent));
+			BYTE green = static_cast<BYTE>(255 * percent);
+			float left = x - bar_width * 0.5f;
+			add_quad(left - 1.f, y - 1.f, left + bar_width + 1.f, y + bar_height + 1.f, atlas.white(), D3DCOLOR_ARGB(0xA0, 0, 0, 0));
+			add_quad(left, y, left + bar_width * percent, y + bar_height, atlas.white(), D3DCOLOR_ARGB(0xE0, red, green, 0));
+		}
+		const NameplateAtlas::entry* name = name_for(ent);
+		if (!name)
+		{
+			full = full || atlas.renders_left > 0; //no budget left is fine, no room isn't
+			continue;
+		}
+		D3DCOLOR color = ent->Type == 0 ? D3DCOLOR_ARGB(0xFF, 0x80, 0xC0, 0xFF) : D3DCOLOR_ARGB(0xFF, 0xF0, 0xF0, 0xF0);
+		if (ent->Type == 1 && cons && ConCache::hostile(cons->get(ent)))
+			color = D3DCOLOR_ARGB(0xFF, 0xFF, 0x90, 0x90);
+		float left = x - name->width * 0.5f;
+		float top = y - name->height - 1.f;
+		add_quad(left, top, left + name->width, top + name->height, *name, color);
+	}
+	if (full) //names of spawns long gone filled the texture, rebuild it from the ones on screen over the next frames
+	{
+		atlas.clear();
+		by_spawn.clear();
+	}
+	if (vertices.empty())
+		return;
+	render_state_cache& states = zeal->dx->states;
+	states.begin(device);
+	set_draw_states(states, atlas.texture);
+	device->DrawPrimitiveUP(D3DPT_TRIANGLELIST, (UINT)(vertices.size() / 3), vertices.data(), sizeof(vertex));
+	states.restore();
+}
+
+Nameplates::Nameplates(ZealService* zeal)
+{
+	zeal->callbacks->add_generic([this]() { render(); }, callback_type::AddDeferred); //behind the ui, like floating damage
+	zeal->callbacks->add_generic([this]() { atlas.release(); by_spawn.clear(); }, callback_type::DeviceReset);
+	zeal->callbacks->add_generic([this]() { by_spawn.clear(); }, callback_type::Zone);
+	despawn_subscription = zeal->entity_manager->subscribe([this](const entity_event& e) { by_spawn.erase(e.spawn_id); }, enabled ? despawn_mask : 0);
+	enabled.on_change([this](bool value) {
+		ZealService::get_instance()->entity_manager->set_subscription_mask(despawn_subscription, value ? despawn_mask : 0);
+		by_spawn.clear(); //despawns weren't tracked while off
+	});
+	font_size.on_change([this](int) { by_spawn.clear(); });
+	zeal->commands_hook->add("/nameplates", {}, "Toggles nameplates and health bars above players and npcs, also /nameplates bars, distance <n> and size <px>.",
+		[this](std::vector<std::string>& args) {
+			int value = 0;
+			if (args.size() == 1)
+			{
+				enabled.set(!enabled.get());
+				Zeal::EqGame::print_chat("Nameplates are %s", enabled ? "on" : "off");
+			}
+			else if (Zeal::String::compare_insensitive(args[1], "bars"))
+			{
+				health_bars.set(!health_bars.get());
+				Zeal::EqGame::print_chat("Nameplate health bars are %s", health_bars ? "on" : "off");
+			}
+			else if (args.size() == 3 && Zeal::String::compare_insensitive(args[1], "distance") && Zeal::String::tryParse(args[2], &value) && value > 0)
+			{
+				distance.set(value);
+				Zeal::EqGame::print_chat("Nameplate distance is now %i", value);
+			}
+			else if (args.size() == 3 && Zeal::String::compare_insensitive(args[1], "size") && Zeal::String::tryParse(args[2], &value) && value >= 8 && value <= 32)
+			{
+				font_size.set(value);
+				Zeal::EqGame::print_chat("Nameplate font size is now %i", value);
+			}
+			else
+			{
+				Zeal::EqGame::print_chat("usage: /nameplates [bars | distance <n> | size <8-32>]");
+			}
+			return true;
+		});
+}
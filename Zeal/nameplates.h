@@ -0,0 +1,81 @@
+#pragma once
+#include <Windows.h>
+#include <string>
+#include <vector>
+#include <unordered_map>
+#include "d3dx8/d3d8.h"
+#include "settings.h"
+#include "vectors.h"
+#include "EqStructures.h"
+#include "screen_layout.h"
+
+// names are rendered into a texture atlas once per distinct name with gdi, spawns map to their atlas entry until they despawn;
+// a white block in the atlas corner textures the health bars, so every plate of a frame goes out in one draw call
+class NameplateAtlas
+{
+public:
+	struct entry
+	{
+		float u0, v0, u1, v1;
+		float width, height; //pixels
+	};
+	bool ready(IDirect3DDevice8* device, int pixel_height); //builds the texture and font when needed
+	const entry* find(const std::string& name); //renders the name on a miss, nullptr if it doesn't fit until clear()
+	const entry& white() const { return white_block; }
+	void clear(); //drops every name, the texture is reused
+	void release(); //before a device reset
+	IDirect3DTexture8* texture = nullptr;
+	UINT generation = 0; //bumped by clear(), cached entry pointers from an older generation are stale
+	int renders_left = 0; //new names this frame, spreads a raid zoning in over a few frames
+private:
+	bool build(IDirect3DDevice8* device, int pixel_height);
+	static constexpr int texture_size = 1024;
+	static constexpr int max_name_width = 256;
+	IDirect3DDevice8* atlas_device = nullptr;
+	int atlas_height = 0;
+	HDC dc = nullptr;
+	HFONT font = nullptr;
+	HBITMAP bitmap = nullptr;
+	void* bits = nullptr; //max_name_width x row_height dib the names are drawn into
+	int row_height = 0;
+	int cursor_x = 0;
+	int cursor_y = 0;
+	entry white_block = {};
+	std::unordered_map<std::string, entry> names;
+};
+
+class Nameplates
+{
+public:
+	Nameplates(class ZealService* zeal);
+	Setting<bool> enabled{ "Zeal", "Nameplates", false };
+	Setting<bool> health_bars{ "Zeal", "NameplateHealthBars", true };
+	Setting<int> distance{ "Zeal", "NameplateDistance", 120 };
+	Setting<int> font_size{ "Zeal", "NameplateFontSize", 13 }; //pixels
+private:
+	struct vertex
+	{
+		float x, y, z, rhw;
+		D3DCOLOR color;
+		float u, v;
+	};
+	struct cached_plate
+	{
+		UINT generation;
+		const NameplateAtlas::entry* name;
+	};
+	void render();
+	void add_quad(float left, float top, float right, float bottom, const NameplateAtlas::entry& e, D3DCOLOR color);
+	const NameplateAtlas::entry* name_for(Zeal::EqStructures::Entity* ent);
+	NameplateAtlas atlas;
+	std::unordered_map<WORD, cached_plate> by_spawn; //names only change on spawn
+	UINT despawn_subscription = 0;
+	std::vector<Zeal::EqStructures::Entity*> actors;
+	std::vector<Vec3> anchors;
+	std::vector<Vec2> screen;
+	std::vector<BYTE> on_screen;
+	std::vector<vertex> vertices; //triangle list, reused every frame
+	std::vector<layout_box> boxes;
+	std::vector<size_t> plate_actor; //the actor of each box
+	ScreenLayout layout;
+};
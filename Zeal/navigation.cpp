@@ -0,0 +1,582 @@
+#include "navigation.h"
+#include "Zeal.h"
+#include "EqFunctions.h"
+#include "camera_math.h"
+#include "string_util.h"
+#include <algorithm>
+#include <fstream>
+#include <queue>
+
+static constexpr float probe_above = 12.f; //floor probes start this far over the neighbour's floor
+static constexpr float probe_below = 40.f; //and give up this far under it, a deeper drop is a cliff
+static constexpr float max_step = 7.f; //height change a cell to cell step may have
+static constexpr float eye_height = 3.f; //edge rays run this far over both floors
+static constexpr float waypoint_reached = 3.f;
+static constexpr float replan_distance = 20.f; //a followed spawn that moved this far from the plan gets a new one
+static constexpr ULONGLONG stuck_ms = 3000;
+static constexpr size_t max_expansions = 250000;
+static constexpr size_t probe_batch = 64;
+static constexpr UINT cmd_forward = 3; //then back, turn right and turn left
+
+static constexpr std::pair<int, int> neighbours[] = { { 1, 0 }, { -1, 0 }, { 0, 1 }, { 0, -1 } };
+
+static UINT32 chunk_key(int cx, int cy)
+{
+	return (static_cast<UINT32>(static_cast<UINT16>(cy)) << 16) | static_cast<UINT16>(cx);
+}
+
+nav_cell* Navigation::grid::find(int x, int y)
+{
+	auto it = chunks.find(chunk_key(x >> 5, y >> 5));
+	return it == chunks.end() ? nullptr : &(*it->second)[(y & (nav_chunk_cells - 1)) * nav_chunk_cells + (x & (nav_chunk_cells - 1))];
+}
+
+nav_cell& Navigation::grid::at(int x, int y)
+{
+	std::unique_ptr<chunk>& c = chunks[chunk_key(x >> 5, y >> 5)];
+	if (!c)
+		c = std::make_unique<chunk>(chunk{});
+	return (*c)[(y & (nav_chunk_cells - 1)) * nav_chunk_cells + (x & (nav_chunk_cells - 1))];
+}
+
+std::string Navigation::path_for(DWORD zone_id)
+{
+	return "nav\\" + std::to_string(zone_id) + ".znav";
+}
+
+// the file is mapped rather than streamed, a big zone is a few megabytes of fixed size records
+void Navigation::load(DWORD zone_id)
+{
+	cells = std::make_shared<grid>();
+	frontier.clear();
+	loaded_zone = zone_id;
+	changed = false;
+	std::string name = path_for(zone_id);
+	HANDLE file = CreateFileA(name.c_str(), GENERIC_READ, FILE_SHARE_READ, NULL, OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL, NULL);
+	if (file == INVALID_HANDLE_VALUE)
+		return;
+	LARGE_INTEGER size = {};
+	HANDLE mapping = GetFileSizeEx(file, &size) && size.QuadPart >= static_cast<LONGLONG>(sizeof(nav_file_header)) ?
+		CreateFileMappingA(file, NULL, PAGE_READONLY, 0, 0, NULL) : NULL;
+	const BYTE* view = mapping ? static_cast<const BYTE*>(MapViewOfFile(mapping, FILE_MAP_READ, 0, 0, 0)) : nullptr;
+	if (view)
+	{
+		const nav_file_header* header = reinterpret_cast<const nav_file_header*>(view);
+		if (header->magic == nav_file_magic && header->version == nav_file_version && header->zone_id == zone_id &&
+			sizeof(nav_file_header) + static_cast<ULONGLONG>(header->chunk_count) * sizeof(nav_chunk_record) <= static_cast<ULONGLONG>(size.QuadPart))
+		{
+			const nav_chunk_record* records = reinterpret_cast<const nav_chunk_record*>(view + sizeof(nav_file_header));
+			for (UINT32 i = 0; i < header->chunk_count; ++i)
+			{
+				auto c = std::make_unique<chunk>();
+				memcpy(c->data(), records[i].cells, sizeof(records[i].cells));
+				for (const nav_cell& cell : *c)
+					cells->known += (cell.flags & nav_known) ? 1 : 0;
+				cells->chunks[chunk_key(records[i].cx, records[i].cy)] = std::move(c);
+			}
+		}
+		UnmapViewOfFile(view);
+	}
+	if (mapping)
+		CloseHandle(mapping);
+	CloseHandle(file);
+}
+
+void Navigation::save()
+{
+	if (!changed || loaded_zone == 0xFFFFFFFF)
+		return;
+	changed = false;
+	CreateDirectoryA("nav", NULL);
+	std::ofstream out(path_for(loaded_zone), std::ios::binary | std::ios::trunc);
+	if (!out.is_open())
+	{
+		ZEAL_LOG_WARN("nav", "could not write %s", path_for(loaded_zone));
+		return;
+	}
+	nav_file_header header = { nav_file_magic, nav_file_version, loaded_zone, static_cast<UINT32>(cells->chunks.size()) };
+	out.write(reinterpret_cast<const char*>(&header), sizeof(header));
+	nav_chunk_record record;
+	for (const auto& [key, c] : cells->chunks)
+	{
+		record.cx = static_cast<INT16>(key & 0xFFFF);
+		record.cy = static_cast<INT16>(key >> 16);
+		memcpy(record.cells, c->data(), sizeof(record.cells));
+		out.write(reinterpret_cast<const char*>(&record), sizeof(record));
+	}
+}
+
+bool Navigation::ensure_zone()
+{
+	Zeal::EqStructures::Entity* self = Zeal::EqGame::get_self();
+	if (!enabled.get() || !self || !Zeal::EqGame::is_in_game())
+		return false;
+	if (self->ZoneId != loaded_zone)
+	{
+		save();
+		load(self->ZoneId);
+	}
+	return true;
+}
+
+// an unknown cell starts a flood fill there, a known one picks the fill up again along the edge of what is sampled
+void Navigation::seed(const Vec3& pos)
+{
+	seed_x = cell_of(pos.x);
+	seed_y = cell_of(pos.y);
+	nav_cell* start = cells->find(seed_x, seed_y);
+	if (!start || !(start->flags & nav_known))
+	{
+		frontier.push_back({ seed_x, seed_y, pos.z });
+		return;
+	}
+	int radius = static_cast<int>(build_radius.get() / nav_cell_size);
+	for (const auto& [key, c] : cells->chunks)
+	{
+		int base_x = static_cast<INT16>(key & 0xFFFF) * nav_chunk_cells, base_y = static_cast<INT16>(key >> 16) * nav_chunk_cells;
+		for (int i = 0; i < nav_chunk_cells * nav_chunk_cells; ++i)
+		{
+			const nav_cell& cell = (*c)[i];
+			int x = base_x + i % nav_chunk_cells, y = base_y + i / nav_chunk_cells;
+			if (!(cell.flags & nav_walkable) || abs(x - seed_x) > radius || abs(y - seed_y) > radius)
+				continue;
+			for (auto [dx, dy] : neighbours)
+			{
+				nav_cell* n = cells->find(x + dx, y + dy);
+				if (!n || !(n->flags & nav_known))
+					frontier.push_back({ x + dx, y + dy, static_cast<float>(cell.z) });
+			}
+		}
+	}
+}
+
+// floor probes for a batch of frontier cells, then the edge rays to their sampled neighbours, both through collide_batch.
+// runs as scheduler work, true while there is frontier left so the next frame picks it up ahead of fresh timers
+bool Navigation::build_step(int budget_us)
+{
+	if (searching || frontier.empty() || loaded_zone == 0xFFFFFFFF)
+		return false;
+	ZEAL_PROFILE_SCOPE("nav build");
+	LARGE_INTEGER start, now, frequency;
+	QueryPerformanceCounter(&start);
+	QueryPerformanceFrequency(&frequency);
+	LONGLONG budget = frequency.QuadPart * std::max(std::min(build_budget_us.get(), budget_us), 100) / 1000000;
+	int radius = static_cast<int>(build_radius.get() / nav_cell_size);
+	grid& g = *cells;
+	std::vector<frontier_cell> batch;
+	std::vector<Zeal::EqGame::raycast_query> probes, rays;
+	struct edge { int x, y; UINT8 bit; };
+	std::vector<edge> edges;
+	do
+	{
+		batch.clear();
+		probes.clear();
+		while (batch.size() < probe_batch && !frontier.empty())
+		{
+			frontier_cell f = frontier.front();
+			frontier.pop_front();
+			nav_cell& cell = g.at(f.x, f.y);
+			if (cell.flags & nav_known)
+				continue;
+			cell.flags = nav_known; //queued more than once, only the first probe counts
+			g.known++;
+			batch.push_back(f);
+			probes.push_back({ Vec3(center_of(f.x), center_of(f.y), f.from_z + probe_above), Vec3(center_of(f.x), center_of(f.y), f.from_z - probe_below) });
+		}
+		Zeal::EqGame::collide_batch(probes);
+		rays.clear();
+		edges.clear();
+		for (size_t i = 0; i < batch.size(); ++i)
+		{
+			if (!probes[i].hit)
+				continue;
+			const frontier_cell& f = batch[i];
+			nav_cell& cell = g.at(f.x, f.y);
+			cell.z = static_cast<INT16>(lroundf(probes[i].result.z));
+			cell.flags |= nav_walkable;
+			for (auto [dx, dy] : neighbours)
+			{
+				int nx = f.x + dx, ny = f.y + dy;
+				nav_cell* n = g.find(nx, ny);
+				if (!n || !(n->flags & nav_known))
+				{
+					if (abs(nx - seed_x) <= radius && abs(ny - seed_y) <= radius)
+						frontier.push_back({ nx, ny, static_cast<float>(cell.z) });
+					continue;
+				}
+				if (!(n->flags & nav_walkable) || abs(n->z - cell.z) > max_step)
+					continue;
+				rays.push_back({ Vec3(center_of(f.x), center_of(f.y), cell.z + eye_height), Vec3(center_of(nx), center_of(ny), n->z + eye_height) });
+				if (dx)
+					edges.push_back({ std::min(f.x, nx), f.y, nav_open_east });
+				else
+					edges.push_back({ f.x, std::min(f.y, ny), nav_open_north });
+			}
+		}
+		Zeal::EqGame::collide_batch(rays);
+		for (size_t i = 0; i < rays.size(); ++i)
+		{
+			if (!rays[i].hit)
+				g.at(edges[i].x, edges[i].y).flags |= edges[i].bit;
+		}
+		changed = true;
+		QueryPerformanceCounter(&now);
+	} while (!frontier.empty() && now.QuadPart - start.QuadPart < budget);
+	if (frontier.empty())
+	{
+		save();
+		Zeal::EqGame::print_chat("[Nav] grid for this zone has %u cells", static_cast<UINT>(g.known));
+		return false;
+	}
+	return true;
+}
+
+// 8 connected A*, a diagonal only where both of its corners can be walked around, then the collinear points dropped
+bool Navigation::search(grid& g, int sx, int sy, int dx, int dy, std::vector<Vec3>& out)
+{
+	auto key = [](int x, int y) { return (static_cast<UINT64>(static_cast<UINT32>(y)) << 32) | static_cast<UINT32>(x); };
+	auto open = [&g](int x, int y, int step_x, int step_y) {
+		if (step_x)
+		{
+			nav_cell* c = g.find(step_x > 0 ? x : x - 1, y);
+			return c && (c->flags & nav_open_east);
+		}
+		nav_cell* c = g.find(x, step_y > 0 ? y : y - 1);
+		return c && (c->flags & nav_open_north);
+	};
+	auto heuristic = [dx, dy](int x, int y) {
+		int ax = abs(x - dx), ay = abs(y - dy);
+		return static_cast<float>(std::max(ax, ay)) + 0.41421356f * std::min(ax, ay);
+	};
+	struct node { float g; UINT64 parent; bool closed; };
+	std::unordered_map<UINT64, node> nodes;
+	using entry = std::pair<float, UINT64>;
+	std::priority_queue<entry, std::vector<entry>, std::greater<entry>> queue;
+	UINT64 goal = key(dx, dy);
+	nodes[key(sx, sy)] = { 0.f, key(sx, sy), false };
+	queue.push({ heuristic(sx, sy), key(sx, sy) });
+	size_t expanded = 0;
+	bool found = false;
+	while (!queue.empty() && expanded < max_expansions)
+	{
+		UINT64 current = queue.top().second;
+		queue.pop();
+		node& n = nodes[current];
+		if (n.closed)
+			continue;
+		n.closed = true;
+		if (current == goal)
+		{
+			found = true;
+			break;
+		}
+		expanded++;
+		int x = static_cast<INT32>(current & 0xFFFFFFFF), y = static_cast<INT32>(current >> 32);
+		float base = n.g;
+		for (int step_y = -1; step_y <= 1; ++step_y)
+		{
+			for (int step_x = -1; step_x <= 1; ++step_x)
+			{
+				if (!step_x && !step_y)
+					continue;
+				bool diagonal = step_x && step_y;
+				if (!diagonal && !open(x, y, step_x, step_y))
+					continue;
+				if (diagonal && !(open(x, y, step_x, 0) && open(x + step_x, y, 0, step_y) && open(x, y, 0, step_y) && open(x, y + step_y, step_x, 0)))
+					continue;
+				UINT64 next = key(x + step_x, y + step_y);
+				float cost = base + (diagonal ? 1.41421356f : 1.f);
+				auto it = nodes.find(next);
+				if (it != nodes.end() && (it->second.closed || it->second.g <= cost))
+					continue;
+				nodes[next] = { cost, current, false };
+				queue.push({ cost + heuristic(x + step_x, y + step_y), next });
+			}
+		}
+	}
+	out.clear();
+	if (!found)
+		return false;
+	std::vector<UINT64> cells_back;
+	for (UINT64 at = goal; ; at = nodes[at].parent)
+	{
+		cells_back.push_back(at);
+		if (nodes[at].parent == at)
+			break;
+	}
+	int last_step_x = 0, last_step_y = 0;
+	for (size_t i = cells_back.size() - 1; i-- > 0;)
+	{
+		int x = static_cast<INT32>(cells_back[i] & 0xFFFFFFFF), y = static_cast<INT32>(cells_back[i] >> 32);
+		int px = static_cast<INT32>(cells_back[i + 1] & 0xFFFFFFFF), py = static_cast<INT32>(cells_back[i + 1] >> 32);
+		nav_cell* c = g.find(x, y);
+		Vec3 point(center_of(x), center_of(y), c ? static_cast<float>(c->z) : 0.f);
+		if (!out.empty() && x - px == last_step_x && y - py == last_step_y)
+			out.back() = point; //same direction, slide the waypoint along
+		else
+			out.push_back(point);
+		last_step_x = x - px;
+		last_step_y = y - py;
+	}
+	return true;
+}
+
+bool Navigation::go_to(const Vec3& target, float distance)
+{
+	if (!ensure_zone())
+	{
+		Zeal::EqGame::print_chat("[Nav] navigation is off, /nav on samples the zone as you use it");
+		return false;
+	}
+	destination = target;
+	stop_distance = distance;
+	plan();
+	return true;
+}
+
+void Navigation::follow(WORD spawn_id)
+{
+	Zeal::EqStructures::Entity* ent = ZealService::get_instance()->entity_manager->get(spawn_id);
+	if (!ent || !go_to(ent->Position, 10.f))
+		return;
+	follow_id = spawn_id;
+}
+
+void Navigation::plan()
+{
+	Zeal::EqStructures::Entity* controlled = Zeal::EqGame::get_controlled();
+	if (!controlled || searching)
+	{
+		pending = controlled != nullptr; //again once the running search is back
+		return;
+	}
+	int sx = cell_of(controlled->Position.x), sy = cell_of(controlled->Position.y);
+	int dx = cell_of(destination.x), dy = cell_of(destination.y);
+	nav_cell* goal = cells->find(dx, dy);
+	if (!goal || !(goal->flags & nav_known))
+	{
+		if (frontier.empty())
+			seed(controlled->Position);
+		if (frontier.empty())
+		{
+			stop("[Nav] the destination is outside what can be sampled from here");
+			return;
+		}
+		pending = true; //the build reaches it first
+		return;
+	}
+	pending = false;
+	searching = true;
+	UINT id = ++search_id;
+	std::shared_ptr<grid> g = cells;
+	auto result = std::make_shared<std::vector<Vec3>>();
+	auto found = std::make_shared<bool>(false);
+	ZealService::get_instance()->tasks->run([g, sx, sy, dx, dy, result, found]() { *found = search(*g, sx, sy, dx, dy, *result); },
+		[this, id, result, found]() {
+			searching = false;
+			if (id != search_id)
+				return; //stopped or zoned while it ran
+			if (!*found)
+			{
+				stop("[Nav] no path to the destination in the sampled grid");
+				return;
+			}
+			path = std::move(*result);
+			if (path.empty() || follow_id == 0)
+				path.push_back(destination); //the exact spot for the last few units
+			last_progress = GetTickCount64();
+			last_progress_pos = Zeal::EqGame::get_controlled() ? Zeal::EqGame::get_controlled()->Position : Vec3();
+		});
+}
+
+void Navigation::release_forward()
+{
+	if (!pressing)
+		return;
+	pressing = false;
+	issuing = true;
+	Zeal::EqGame::execute_cmd(cmd_forward, false, 0);
+	issuing = false;
+}
+
+void Navigation::stop(const char* reason)
+{
+	path.clear();
+	follow_id = 0;
+	pending = false;
+	search_id++;
+	release_forward();
+	if (reason)
+		Zeal::EqGame::print_chat(reason);
+}
+
+// faces the next waypoint and holds forward, the client moves and collides the player as it would for the key
+void Navigation::steer()
+{
+	if (path.empty() && !follow_id)
+		return;
+	Zeal::EqStructures::Entity* controlled = Zeal::EqGame::get_controlled();
+	if (!controlled || !Zeal::EqGame::is_in_game() || !Zeal::EqGame::can_move())
+	{
+		stop("[Nav] stopped, you can't move");
+		return;
+	}
+	Vec3 pos = controlled->Position;
+	if (follow_id)
+	{
+		Zeal::EqStructures::Entity* ent = ZealService::get_instance()->entity_manager->get(follow_id);
+		if (!ent)
+		{
+			stop("[Nav] the spawn you were following is gone");
+			return;
+		}
+		float fx = ent->Position.x - pos.x, fy = ent->Position.y - pos.y;
+		if (fx * fx + fy * fy < stop_distance * stop_distance)
+		{
+			path.clear();
+			release_forward();
+			return; //keeps following, moves again once it walks off
+		}
+		float mx = ent->Position.x - destination.x, my = ent->Position.y - destination.y;
+		if ((path.empty() || mx * mx + my * my > replan_distance * replan_distance) && !searching && !pending)
+		{
+			destination = ent->Position;
+			plan();
+		}
+	}
+	while (!path.empty())
+	{
+		float wx = path.front().x - pos.x, wy = path.front().y - pos.y;
+		float reach = path.size() == 1 && !follow_id ? stop_distance : waypoint_reached;
+		if (wx * wx + wy * wy > reach * reach)
+			break;
+		path.erase(path.begin());
+	}
+	if (path.empty())
+	{
+		if (!follow_id)
+			stop("[Nav] arrived");
+		else
+			release_forward();
+		return;
+	}
+	float heading = camera_math::radians_to_heading(atan2f(path.front().y - pos.y, path.front().x - pos.x));
+	controlled->Heading = heading < 0 ? heading + camera_math::heading_units : heading;
+	if (!pressing)
+	{
+		pressing = true;
+		issuing = true;
+		Zeal::EqGame::execute_cmd(cmd_forward, true, 0);
+		issuing = false;
+	}
+	ULONGLONG now = GetTickCount64();
+	float px = pos.x - last_progress_pos.x, py = pos.y - last_progress_pos.y;
+	if (px * px + py * py > 4.f)
+	{
+		last_progress_pos = pos;
+		last_progress = now;
+	}
+	else if (now - last_progress > stuck_ms)
+		stop("[Nav] stopped, stuck against something the grid missed");
+}
+
+Navigation::Navigation(ZealService* zeal)
+{
+	zeal->callbacks->add_generic([this]() {
+		if (!ensure_zone())
+			return;
+		Zeal::EqStructures::Entity* self = Zeal::EqGame::get_self();
+		if (!cells->known && frontier.empty() && self)
+			seed(self->Position); //first visit, the zone is sampled around wherever you are
+		if (pending && !searching)
+			plan();
+		steer();
+	});
+	zeal->callbacks->add_work([this](int budget_us) { return build_step(budget_us); }, 1, work_priority::low);
+	zeal->callbacks->add_generic([this]() { stop(); save(); loaded_zone = 0xFFFFFFFF; }, callback_type::Zone);
+	zeal->callbacks->add_generic([this]() { stop(); save(); loaded_zone = 0xFFFFFFFF; }, callback_type::CharacterSelect);
+	for (int cmd : { 3, 4, 5, 6 }) //forward, back and the turns hand control back to the player
+	{
+		zeal->binds_hook->replace_cmd(cmd, [this](int state) {
+			if (state && !issuing && (moving() || follow_id))
+				stop("[Nav] stopped");
+			return false;
+		});
+	}
+	zeal->commands_hook->add("/goto", {}, "Walks a path to a location or a spawn through the zone's navigation grid, /goto <y> <x> [z] (as /loc prints it) | target | stop.",
+		[this](std::vector<std::string>& args) {
+			if (args.size() > 1 && Zeal::String::compare_insensitive(args[1], "stop"))
+			{
+				stop("[Nav] stopped");
+				return true;
+			}
+			if (args.size() > 1 && Zeal::String::compare_insensitive(args[1], "target"))
+			{
+				Zeal::EqStructures::Entity* target = Zeal::EqGame::get_target();
+				if (target)
+					follow(target->SpawnId);
+				else
+					Zeal::EqGame::print_chat("[Nav] you have no target");
+				return true;
+			}
+			float y = 0, x = 0, z = 0;
+			Zeal::EqStructures::Entity* self = Zeal::EqGame::get_controlled();
+			if (args.size() < 3 || !Zeal::String::tryParse(args[1], &y) || !Zeal::String::tryParse(args[2], &x) || !self)
+			{
+				Zeal::EqGame::print_chat("usage: /goto <y> <x> [z] | target | stop");
+				return true;
+			}
+			if (args.size() < 4 || !Zeal::String::tryParse(args[3], &z))
+				z = self->Position.z;
+			follow_id = 0;
+			go_to(Vec3(x, y, z));
+			return true;
+		});
+	zeal->commands_hook->add("/nav", {}, "The navigation grid behind /goto, /nav on | off | status | build | clear.",
+		[this](std::vector<std::string>& args) {
+			if (args.size() > 1 && (Zeal::String::compare_insensitive(args[1], "on") || Zeal::String::compare_insensitive(args[1], "off")))
+			{
+				enabled.set(Zeal::String::compare_insensitive(args[1], "on"));
+				if (!enabled.get())
+				{
+					stop();
+					save();
+					frontier.clear();
+					loaded_zone = 0xFFFFFFFF;
+				}
+				Zeal::EqGame::print_chat("[Nav] navigation is %s", enabled.get() ? "on" : "off");
+				return true;
+			}
+			if (!ensure_zone())
+			{
+				Zeal::EqGame::print_chat("[Nav] navigation is off, /nav on to start");
+				return true;
+			}
+			if (args.size() > 1 && Zeal::String::compare_insensitive(args[1], "build"))
+			{
+				seed(Zeal::EqGame::get_self()->Position);
+				Zeal::EqGame::print_chat("[Nav] sampling %u cells around you", static_cast<UINT>(frontier.size()));
+				return true;
+			}
+			if (args.size() > 1 && Zeal::String::compare_insensitive(args[1], "clear"))
+			{
+				stop();
+				DeleteFileA(path_for(loaded_zone).c_str());
+				load(loaded_zone);
+				Zeal::EqGame::print_chat("[Nav] grid for this zone cleared");
+				return true;
+			}
+			Zeal::EqGame::print_chat("[Nav] zone %u: %u cells sampled, %u waiting, %s", loaded_zone, static_cast<UINT>(cells->known),
+				static_cast<UINT>(frontier.size()), path.empty() ? "idle" : "moving");
+			return true;
+		});
+	zeal->memory_report->add("navigation", [this]() {
+		return Zeal::Memory::usage{ Zeal::Memory::hash_bytes(cells->chunks) + cells->chunks.size() * sizeof(chunk) + frontier.size() * sizeof(frontier_cell), cells->known };
+	});
+}
+
+Navigation::~Navigation()
+{
+	stop();
+	save();
+}
@@ -0,0 +1,103 @@
+#pragma once
+#include <Windows.h>
+#include <array>
+#include <deque>
+#include <memory>
+#include <string>
+#include <unordered_map>
+#include <vector>
+#include "settings.h"
+#include "vectors.h"
+
+// nav\<zone id>.znav: a nav_file_header followed by chunk_count nav_chunk_record
+static constexpr UINT32 nav_file_magic = 0x56414E5A; //ZNAV
+static constexpr UINT32 nav_file_version = 1;
+static constexpr int nav_chunk_cells = 32; //a chunk is 32x32 cells
+static constexpr float nav_cell_size = 8.f;
+enum nav_cell_flags : UINT8
+{
+	nav_known = 1, //probed, the rest of the flags mean something
+	nav_walkable = 2, //found a floor within reach of the neighbour it was reached from
+	nav_open_east = 4, //can walk to the cell at x + 1
+	nav_open_north = 8 //can walk to the cell at y + 1
+};
+#pragma pack(push, 2)
+struct nav_cell
+{
+	INT16 z; //floor height, whole units
+	UINT8 flags;
+	UINT8 unused;
+};
+struct nav_file_header
+{
+	UINT32 magic;
+	UINT32 version;
+	UINT32 zone_id;
+	UINT32 chunk_count;
+};
+struct nav_chunk_record
+{
+	INT16 cx, cy; //chunk coordinates
+	nav_cell cells[nav_chunk_cells * nav_chunk_cells]; //row major, y then x
+};
+#pragma pack(pop)
+
+// a coarse walkable grid per zone for /goto: the zone is flood filled outwards from the player with floor probes and
+// edge rays through the shared raycast service, a budget of it each frame because the engine's collision isn't safe
+// off the game thread, and the result is kept in nav\ so the sampling happens once per zone. path queries are A* on
+// the task pool over the grid as it was when the query started, the main loop then steers and runs along the path
+class Navigation
+{
+public:
+	Setting<bool> enabled{ "Zeal", "Navigation", false }; //nothing is sampled or loaded until this is on
+	Setting<int> build_budget_us{ "Zeal", "NavBuildBudget", 1500 }; //sampling time per frame
+	Setting<int> build_radius{ "Zeal", "NavBuildRadius", 1500 }; //how far from the seed one build reaches
+	bool go_to(const Vec3& destination, float stop_distance = 2.f);
+	void follow(WORD spawn_id);
+	void stop(const char* reason = nullptr);
+	bool moving() const { return !path.empty() || searching; }
+	Navigation(class ZealService* zeal);
+	~Navigation();
+private:
+	using chunk = std::array<nav_cell, nav_chunk_cells * nav_chunk_cells>;
+	struct grid
+	{
+		std::unordered_map<UINT32, std::unique_ptr<chunk>> chunks;
+		nav_cell* find(int x, int y); //nullptr when its chunk was never touched
+		nav_cell& at(int x, int y); //creates the chunk
+		size_t known = 0;
+	};
+	struct frontier_cell
+	{
+		int x, y;
+		float from_z; //floor of the neighbour it was reached from
+	};
+	static std::string path_for(DWORD zone_id);
+	static int cell_of(float v) { return static_cast<int>(floorf(v / nav_cell_size)); }
+	static float center_of(int c) { return (c + 0.5f) * nav_cell_size; }
+	static bool search(grid& g, int sx, int sy, int dx, int dy, std::vector<Vec3>& out); //worker thread
+	void load(DWORD zone_id);
+	void save();
+	bool ensure_zone();
+	void seed(const Vec3& pos);
+	bool build_step(int budget_us); //true while the frontier has more
+	void plan();
+	void steer();
+	void release_forward();
+	std::shared_ptr<grid> cells = std::make_shared<grid>(); //a running search holds its own reference across a zone
+	std::deque<frontier_cell> frontier;
+	int seed_x = 0, seed_y = 0;
+	DWORD loaded_zone = 0xFFFFFFFF;
+	bool changed = false;
+	bool searching = false; //a query is reading the grid, sampling waits for it
+	UINT search_id = 0; //results of an abandoned search are dropped
+	std::vector<Vec3> path; //waypoints left, front first
+	Vec3 destination;
+	float stop_distance = 2.f;
+	WORD follow_id = 0;
+	bool pending = false; //destination not sampled yet, plan again once the build reaches it
+	bool pressing = false; //forward held by us
+	bool issuing = false; //inside our own execute_cmd, it must not read as the player taking over
+	Vec3 last_progress_pos;
+	ULONGLONG last_progress = 0;
+};
@@ -1,5 +1,8 @@
 #include "netstat.h"
 #include "Zeal.h"
+#include "EqPackets.h"
+#include "string_util.h"
+#include <algorithm>
 
 static BYTE* netstat_flag = (BYTE*)0x7985EC;
 static bool netstat_flag_visible() { return *netstat_flag; }
@@ -18,8 +21,9 @@ void Netstat::callback_main()
 	// uncomment the below line when character select callback functions properly.
 	// netstat_flag_was_reset = true;
 
-	// comment the below out in the event that the character select callbacks are functioning properly.
-	mem::write<byte>(0x7985EC, (int)is_visible);
+	// the client clears the flag on its own, it sits in writable data so put it back directly when it changed
+	if (netstat_flag_visible() != is_visible)
+		*netstat_flag = (BYTE)is_visible;
 }
 
 void Netstat::callback_characterselect()
@@ -27,7 +31,7 @@ void Netstat::callback_characterselect()
 	// Can't seem to trigger the character select callback into working properly. Fallback to continuous memory writes on main.
 	if (netstat_flag_was_reset)
 	{
-		mem::write<byte>(0x7985EC, 0);
+		*netstat_flag = 0;
 		netstat_flag_was_reset = false;
 	}
 }
@@ -42,15 +46,264 @@ void Netstat::load_settings()
 
 void Netstat::update_netstat_state()
 {
-	mem::write<byte>(0x7985EC, (int)is_visible);
+	*netstat_flag = (BYTE)is_visible;
+	ZealService::get_instance()->callbacks->set_active(main_callback, is_visible); //only a shown netstat needs putting back
 	ini_handle->setValue<bool>("Zeal", "NetstatVisibilityState", is_visible);
 }
 
+Netstat::opcode_stats& Netstat::stats_for(UINT opcode)
+{
+	USHORT& slot = (*opcode_slot)[opcode & 0xFFFF];
+	if (!slot)
+	{
+		entries.push_back({});
+		entries.back().opcode = opcode & 0xFFFF;
+		slot = (USHORT)entries.size();
+	}
+	return entries[slot - 1];
+}
+
+bool Netstat::on_receive(UINT opcode, UINT len)
+{
+	LARGE_INTEGER now;
+	QueryPerformanceCounter(&now);
+	opcode_stats& s = stats_for(opcode);
+	s.recv_count++;
+	s.recv_bytes += len;
+	s.window_packets++;
+	s.window_bytes += len;
+	total_recv_bytes += len;
+	if (s.last_arrival)
+	{
+		double interval = (now.QuadPart - s.last_arrival) * ms_per_tick;
+		if (s.recv_count == 2)
+			s.mean_interval_ms = interval;
+		double deviation = interval - s.mean_interval_ms;
+		s.mean_interval_ms += deviation / 16.0;
+		s.jitter_ms += ((deviation < 0 ? -deviation : deviation) - s.jitter_ms) / 16.0;
+	}
+	s.last_arrival = now.QuadPart;
+
+	for (latency_pair& pair : pairs)
+	{
+		if (pair.response != opcode || !pair.pending)
+			continue;
+		double ms = (now.QuadPart - pair.pending) * ms_per_tick;
+		pair.pending = 0;
+		pair.samples++;
+		pair.total_ms += ms;
+		pair.last_ms = ms;
+		unsigned long bucket = 0;
+		if ((UINT)ms)
+			_BitScanReverse(&bucket, (UINT)ms);
+		pair.histogram[bucket < latency_buckets ? bucket : latency_buckets - 1]++;
+	}
+	return false;
+}
+
+bool Netstat::on_send(UINT opcode, UINT len)
+{
+	opcode_stats& s = stats_for(opcode);
+	s.send_count++;
+	s.send_bytes += len;
+	total_send_bytes += len;
+	for (latency_pair& pair : pairs)
+	{
+		if (pair.request == opcode && !pair.pending)
+		{
+			LARGE_INTEGER now;
+			QueryPerformanceCounter(&now);
+			pair.pending = now.QuadPart;
+		}
+	}
+	return false;
+}
+
+void Netstat::roll_window()
+{
+	for (opcode_stats& s : entries)
+	{
+		s.packet_rate = s.window_packets;
+		s.byte_rate = s.window_bytes;
+		s.window_packets = 0;
+		s.window_bytes = 0;
+	}
+	LARGE_INTEGER now;
+	QueryPerformanceCounter(&now);
+	for (latency_pair& pair : pairs)
+		if (pair.pending && (now.QuadPart - pair.pending) * ms_per_tick > 30000)
+			pair.pending = 0; //never answered, don't let it pair with an unrelated reply later
+}
+
+void Netstat::reset()
+{
+	opcode_slot->fill(0);
+	entries.clear();
+	for (latency_pair& pair : pairs)
+		pair = { pair.request, pair.response };
+	total_recv_bytes = 0;
+	total_send_bytes = 0;
+}
+
+std::vector<const Netstat::opcode_stats*> Netstat::heaviest(size_t top) const
+{
+	std::vector<const opcode_stats*> sorted;
+	for (const opcode_stats& s : entries)
+		sorted.push_back(&s);
+	std::sort(sorted.begin(), sorted.end(), [](const opcode_stats* a, const opcode_stats* b) {
+		if (a->byte_rate != b->byte_rate)
+			return a->byte_rate > b->byte_rate;
+		return a->recv_bytes + a->send_bytes > b->recv_bytes + b->send_bytes;
+	});
+	if (sorted.size() > top)
+		sorted.resize(top);
+	return sorted;
+}
+
+void Netstat::print(size_t top)
+{
+	Zeal::EqGame::print_chat("Net: %llu bytes in, %llu bytes out over %u opcodes", total_recv_bytes, total_send_bytes, (UINT)entries.size());
+	for (const opcode_stats* s : heaviest(top))
+	{
+		Zeal::EqGame::print_chat("0x%04x: in %llu (%llu bytes), out %llu (%llu bytes), %u/s %u B/s, interval %.1fms jitter %.1fms",
+			s->opcode, s->recv_count, s->recv_bytes, s->send_count, s->send_bytes, s->packet_rate, s->byte_rate, s->mean_interval_ms, s->jitter_ms);
+	}
+	for (const latency_pair& pair : pairs)
+	{
+		if (pair.samples)
+			Zeal::EqGame::print_chat("0x%04x -> 0x%04x: last %.1fms, average %.1fms over %llu", pair.request, pair.response, pair.last_ms,
+				pair.total_ms / pair.samples, pair.samples);
+	}
+}
+
+std::string Netstat::to_json(size_t top) const
+{
+	nlohmann::json opcodes = nlohmann::json::array();
+	for (const opcode_stats* s : heaviest(top))
+	{
+		opcodes.push_back({ {"opcode", s->opcode}, {"recv_count", s->recv_count}, {"recv_bytes", s->recv_bytes}, {"send_count", s->send_count},
+			{"send_bytes", s->send_bytes}, {"packet_rate", s->packet_rate}, {"byte_rate", s->byte_rate}, {"interval_ms", s->mean_interval_ms},
+			{"jitter_ms", s->jitter_ms} });
+	}
+	nlohmann::json latency = nlohmann::json::array();
+	for (const latency_pair& pair : pairs)
+	{
+		latency.push_back({ {"request", pair.request}, {"response", pair.response}, {"samples", pair.samples}, {"last_ms", pair.last_ms},
+			{"average_ms", pair.samples ? pair.total_ms / pair.samples : 0.0},
+			{"histogram", std::vector<UINT>(pair.histogram, pair.histogram + latency_buckets)} });
+	}
+	nlohmann::json root = { {"netstat", { {"recv_bytes", total_recv_bytes}, {"send_bytes", total_send_bytes}, {"opcodes", opcodes}, {"latency", latency} }} };
+	return root.dump(-1, ' ', false, nlohmann::json::error_handler_t::replace);
+}
+
+// opcode (decimal), packets/s, bytes/s and jitter in ms for the busiest opcodes, digits only
+void Netstat::render()
+{
+	ZealService* zeal = ZealService::get_instance();
+	if (!overlay.get() || !entries.size() || !zeal->dx)
+		return;
+	IDirect3DDevice8* device = zeal->dx->get_device();
+	if (!device || !digits.ready(device, 12))
+		return;
+	Vec2 screen = zeal->dx->GetScreenRect();
+	if (screen.y <= 0)
+		return;
+	static const D3DCOLOR colors[] = { D3DCOLOR_ARGB(255, 200, 200, 200), D3DCOLOR_ARGB(255, 255, 255, 255), D3DCOLOR_ARGB(255, 120, 220, 255), D3DCOLOR_ARGB(255, 255, 200, 80) };
+	float y = screen.y * 0.3f;
+	char text[16];
+	for (const opcode_stats* s : heaviest(8))
+	{
+		UINT values[] = { s->opcode, s->packet_rate, s->byte_rate, (UINT)(s->jitter_ms + 0.5) };
+		for (int i = 0; i < 4; ++i)
+		{
+			snprintf(text, sizeof(text), "%u", values[i]);
+			digits.add(text, 10.f + i * 60.f, y, colors[i]);
+		}
+		y += 14.f;
+	}
+	for (const latency_pair& pair : pairs)
+	{
+		if (!pair.samples)
+			continue;
+		snprintf(text, sizeof(text), "%u", pair.response);
+		digits.add(text, 10.f, y, colors[0]);
+		snprintf(text, sizeof(text), "%u", (UINT)(pair.total_ms / pair.samples + 0.5));
+		digits.add(text, 70.f, y, colors[3]);
+		y += 14.f;
+	}
+	digits.flush(device);
+}
+
+static bool parse_opcode(const std::string& text, UINT& opcode)
+{
+	char* end = nullptr;
+	unsigned long value = strtoul(text.c_str(), &end, 0); //0x prefix for hex
+	if (!end || *end || value > 0xFFFF)
+		return false;
+	opcode = (UINT)value;
+	return true;
+}
+
 Netstat::Netstat(ZealService* zeal, class IO_ini* ini)
 {
 	ini_handle = ini;
 	load_settings();
+	zeal->config_watch->on_reload([this]() {
+		bool was_visible = is_visible;
+		load_settings();
+		if (is_visible != was_visible)
+		{
+			*netstat_flag = (BYTE)is_visible;
+			ZealService::get_instance()->callbacks->set_active(main_callback, is_visible);
+		}
+	});
+	LARGE_INTEGER frequency;
+	QueryPerformanceFrequency(&frequency);
+	ms_per_tick = 1000.0 / frequency.QuadPart;
+	opcode_slot = std::make_unique<std::array<USHORT, 0x10000>>();
+	opcode_slot->fill(0);
+	pairs.push_back({ Zeal::Packets::Consider, Zeal::Packets::Consider });
+	pairs.push_back({ Zeal::Packets::RequestTrade, Zeal::Packets::RequestTrade });
 
-	zeal->callbacks->add_generic([this]() { callback_main(); }, callback_type::MainLoop);
+	main_callback = zeal->callbacks->add_generic([this]() { callback_main(); }, callback_type::MainLoop, is_visible);
 	//zeal->main_loop_hook->add_callback([this]() { callback_characterselect(); }, callback_fn::CharacterSelect);
-}
\ No newline at end of file
+	zeal->callbacks->add_packet([this](UINT opcode, char* buffer, UINT len) { return on_receive(opcode, len); }, callback_type::WorldMessage);
+	zeal->callbacks->add_packet([this](UINT opcode, char* buffer, UINT len) { return on_send(opcode, len); }, callback_type::SendMessage_);
+	zeal->callbacks->add_work([this](int) { roll_window(); return false; }, 1000);
+	zeal->callbacks->add_generic([this]() { render(); }, callback_type::EndScene);
+	zeal->callbacks->add_generic([this]() { digits.release(); }, callback_type::DeviceReset);
+	zeal->commands_hook->add("/netstats", {}, "Per opcode packet statistics, /netstats [count] | overlay | reset | pipe | pair <request> <response>.",
+		[this, zeal](std::vector<std::string>& args) {
+			int count = 10;
+			if (args.size() > 1 && Zeal::String::compare_insensitive(args[1], "overlay"))
+			{
+				overlay.set(!overlay.get());
+				Zeal::EqGame::print_chat("Net stats overlay is %s", overlay.get() ? "on" : "off");
+			}
+			else if (args.size() > 1 && Zeal::String::compare_insensitive(args[1], "reset"))
+			{
+				reset();
+				Zeal::EqGame::print_chat("Net stats cleared");
+			}
+			else if (args.size() > 1 && Zeal::String::compare_insensitive(args[1], "pipe"))
+				zeal->pipe->write(to_json(entries.size()), pipe_data_type::custom);
+			else if (args.size() > 1 && Zeal::String::compare_insensitive(args[1], "pair"))
+			{
+				UINT request = 0, response = 0;
+				if (args.size() < 4 || !parse_opcode(args[2], request) || !parse_opcode(args[3], response))
+				{
+					Zeal::EqGame::print_chat("usage: /netstats pair <request opcode> <response opcode>");
+					return true;
+				}
+				pairs.push_back({ request, response });
+				Zeal::EqGame::print_chat("Timing 0x%04x -> 0x%04x", request, response);
+			}
+			else
+			{
+				if (args.size() > 1)
+					Zeal::String::tryParse(args[1], &count);
+				print(count > 0 ? count : 10);
+			}
+			return true;
+		});
+}
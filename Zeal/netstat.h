@@ -2,20 +2,71 @@
 #include "hook_wrapper.h"
 #include "memory.h"
 #include "IO_ini.h"
+#include "settings.h"
+#include "digit_batch.h"
+#include <array>
+#include <memory>
+#include <string>
+#include <vector>
 
+// counts, byte rates and arrival jitter per opcode from the world connection, plus round trip times for request/response pairs
 class Netstat
 {
 public:
 	void toggle_netstat(int keydown);
+	void reset();
+	std::string to_json(size_t top) const;
 	Netstat(class ZealService* zeal, class IO_ini* ini);
 	~Netstat() {};
+	Setting<bool> overlay{ "Zeal", "NetstatOverlay", false };
 private:
+	static constexpr int latency_buckets = 16; //log2 ms, the last one is everything from 16s up
+	struct opcode_stats
+	{
+		UINT opcode;
+		UINT64 recv_count;
+		UINT64 recv_bytes;
+		UINT64 send_count;
+		UINT64 send_bytes;
+		UINT window_packets; //this second, becomes the rate below when the window rolls
+		UINT window_bytes;
+		UINT packet_rate; //per second over the last full window
+		UINT byte_rate;
+		LONGLONG last_arrival; //qpc
+		double mean_interval_ms;
+		double jitter_ms; //smoothed deviation of the inter-arrival time, the rtp estimator
+	};
+	struct latency_pair
+	{
+		UINT request; //opcode we send
+		UINT response; //opcode the server answers with
+		LONGLONG pending; //qpc of the oldest unanswered request, 0 when none
+		UINT64 samples;
+		double total_ms;
+		double last_ms;
+		UINT histogram[latency_buckets];
+	};
 	void callback_main();
 	void callback_characterselect();
 	void load_settings();
 	void update_netstat_state();
+	void roll_window();
+	void render();
+	void print(size_t top);
+	opcode_stats& stats_for(UINT opcode);
+	bool on_receive(UINT opcode, UINT len);
+	bool on_send(UINT opcode, UINT len);
+	std::vector<const opcode_stats*> heaviest(size_t top) const;
 	bool is_visible;
 	IO_ini* ini_handle;
+	UINT main_callback = 0; //only dispatched while the netstat is shown
 
 	bool netstat_flag_was_reset = true;
+	double ms_per_tick = 0;
+	std::unique_ptr<std::array<USHORT, 0x10000>> opcode_slot; //opcode -> entries index + 1, 0 when unseen
+	std::vector<opcode_stats> entries;
+	std::vector<latency_pair> pairs;
+	UINT64 total_recv_bytes = 0;
+	UINT64 total_send_bytes = 0;
+	DigitBatch digits;
 };
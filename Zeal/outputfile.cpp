@@ -1,7 +1,7 @@
 #include "outputfile.h"
 #include "Zeal.h"
 #include "string_util.h"
-#include <fstream>
+#include <charconv>
 
 enum EquipSlot
 {
@@ -28,7 +28,7 @@ enum EquipSlot
   Ammo
 };
 
-static std::string IDToEquipSlot(int equipSlot)
+static const char* IDToEquipSlot(int equipSlot)
 {
   switch (equipSlot) {
     case LeftEar:
@@ -67,227 +67,420 @@ static bool ItemIsStackable(Zeal::EqStructures::EQITEMINFO* item)
   return ((item->Common.IsStackable) && (item->Common.SpellId == 0));
 }
 
-void OutputFile::export_inventory(std::vector<std::string>& args)
+static ULONGLONG CoinValue(DWORD platinum, DWORD gold, DWORD silver, DWORD copper)
 {
-  Zeal::EqStructures::Entity* self = Zeal::EqGame::get_self();
-
-  std::ostringstream oss;
-  std::string t = "\t"; // output spacer
-  oss << "Location" << t << "Name" << t << "ID" << t << "Count" << t << "Slots" << std::endl;
+  return static_cast<ULONGLONG>(platinum) * 1000 + static_cast<ULONGLONG>(gold) * 100 + static_cast<ULONGLONG>(silver) * 10 + copper;
+}
 
-  // Processing Equipment
-  for (size_t i = 0; i < EQ_NUM_INVENTORY_SLOTS; ++i) {
-    Zeal::EqStructures::EQITEMINFO* item = self->CharInfo->InventoryItem[i];
-    // EQITEMINFO->EquipSlot value only updates when a load happens. Don't use it for this.
-    if (item) {
-      oss << IDToEquipSlot(i) << t << item->Name << t << item->ID << t << 1 << t << 0 << std::endl;
-    }
-    else {
-      oss << IDToEquipSlot(i) << t << "Empty" << t << 0 << t << 0 << t << 0 << std::endl;
+static bool ParseFormat(const std::string& arg, export_format& format)
+{
+  static const char* names[] = { "txt", "csv", "json", "bin" };
+  for (int i = 0; i < 4; ++i) {
+    if (Zeal::String::compare_insensitive(arg, names[i])) {
+      format = static_cast<export_format>(i);
+      return true;
     }
   }
+  return false;
+}
 
-  { // Processing Inventory Slots
-    for (size_t i = 0; i < EQ_NUM_INVENTORY_PACK_SLOTS; ++i) {
-      Zeal::EqStructures::EQITEMINFO* item = self->CharInfo->InventoryPackItem[i];
-      if (item) {
-        if (ItemIsContainer(item)) {
-          int capacity = static_cast<int>(item->Container.Capacity);
-          oss << "General" << i + 1 << t << item->Name << t << item->ID << t << 1 << t << capacity << std::endl;
-          for (int j = 0; j < capacity; ++j) {
-            Zeal::EqStructures::EQITEMINFO* bag_item = item->Container.Item[j];
-            if (bag_item) {
-              int stack_count = ItemIsStackable(bag_item) ? static_cast<int>(bag_item->Common.StackCount) : 1;
-              oss << "General" << i + 1 << "-Slot" << j + 1 << t << bag_item->Name << t << bag_item->ID << t << stack_count << t << 0 << std::endl;
-            }
-            else {
-              oss << "General" << i + 1 << "-Slot" << j + 1 << t << "Empty" << t << 0 << t << 0 << t << 0 << std::endl;
-            }
-          }
-        }
-        else {
-          int stack_count = ItemIsStackable(item) ? static_cast<int>(item->Common.StackCount) : 1;
-          oss << "General" << i + 1 << t << item->Name << t << item->ID << t << stack_count << t << 0 << std::endl;
-        }
+static const char* FormatExtension(export_format format)
+{
+  switch (format) {
+    case export_format::csv:  return ".csv";
+    case export_format::json: return ".json";
+    case export_format::bin:  return ".bin";
+    default:{}break;
+  }
+  return ".txt";
+}
+
+// appends rows straight into one reserved string, no streams and no per field allocations
+// bin layout: "ZEXP", version byte, column count byte, each column name as a length byte + chars, uint32 row count,
+// then per field 's' + length byte + chars or 'n' + little endian uint64
+class export_writer
+{
+public:
+  export_writer(std::string& out, export_format format, std::initializer_list<const char*> columns, size_t row_estimate)
+    : out(out), format(format), columns(columns)
+  {
+    out.reserve(row_estimate * 96 + 256);
+    if (format == export_format::bin) {
+      out.append("ZEXP\x01", 5);
+      out.push_back(static_cast<char>(this->columns.size()));
+      for (const char* column : this->columns) {
+        size_t len = strlen(column);
+        out.push_back(static_cast<char>(len));
+        out.append(column, len);
       }
-      else {
-        oss << "General" << i + 1 << t << "Empty" << t << 0 << t << 0 << t << 0 << std::endl;
+      count_offset = out.size();
+      out.append(4, '\0');
+    }
+    else if (format == export_format::json) {
+      out += "[";
+    }
+    else {
+      for (size_t i = 0; i < this->columns.size(); ++i) {
+        if (i)
+          out += separator();
+        out += this->columns[i];
       }
+      out += "\r\n";
     }
-    ULONGLONG coin = 0;
-    coin += static_cast<ULONGLONG>(self->CharInfo->Platinum) * 1000;
-    coin += static_cast<ULONGLONG>(self->CharInfo->Gold) * 100;
-    coin += static_cast<ULONGLONG>(self->CharInfo->Silver) * 10;
-    coin += self->CharInfo->Copper;
-    oss << "General-Coin" << t << "Currency" << t << 0 << t << coin << t << 0 << std::endl;
   }
-
-  { // Process Cursor Item
-    Zeal::EqStructures::EQITEMINFO* item = self->CharInfo->CursorItem;
-    if (item) {
-      if (ItemIsContainer(item)) {
-        int capacity = static_cast<int>(item->Container.Capacity);
-        oss << "Held" << t << item->Name << t << item->ID << t << 1 << t << capacity << std::endl;
-        for (int i = 0; i < capacity; ++i) {
-          Zeal::EqStructures::EQITEMINFO* bag_item = item->Container.Item[i];
-          if (bag_item) {
-            int stack_count = ItemIsStackable(bag_item) ? static_cast<int>(bag_item->Common.StackCount) : 1;
-            oss << "Held" << "-Slot" << i + 1 << t << bag_item->Name << t << bag_item->ID << t << stack_count << t << 0 << std::endl;
+  void text(const char* value)
+  {
+    begin_field();
+    switch (format) {
+      case export_format::csv:
+        if (!strpbrk(value, ",\"\r\n")) {
+          out += value;
+          break;
+        }
+        out += '"';
+        for (const char* p = value; *p; ++p) {
+          if (*p == '"')
+            out += '"';
+          out += *p;
+        }
+        out += '"';
+        break;
+      case export_format::json:
+        out += '"';
+        for (const char* p = value; *p; ++p) {
+          unsigned char c = static_cast<unsigned char>(*p);
+          if (c == '"' || c == '\\') {
+            out += '\\';
+            out += *p;
           }
-          else {
-            oss << "Held" << "-Slot" << i + 1 << t << "Empty" << t << 0 << t << 0 << t << 0 << std::endl;
+          else if (c < 0x20) {
+            char escaped[8];
+            snprintf(escaped, sizeof(escaped), "\\u%04x", c);
+            out += escaped;
           }
+          else
+            out += *p;
         }
-      }
-      else {
-        int stack_count = ItemIsStackable(item) ? static_cast<int>(item->Common.StackCount) : 1;
-        oss << "Held" << t << item->Name << t << item->ID << t << stack_count << t << 0 << std::endl;
-      }
+        out += '"';
+        break;
+      case export_format::bin: {
+        size_t len = strlen(value);
+        len = len > 255 ? 255 : len;
+        out += 's';
+        out.push_back(static_cast<char>(len));
+        out.append(value, len);
+      } break;
+      default:
+        out += value;
+        break;
     }
-    else {
-      ULONGLONG coin = 0;
-      coin += static_cast<ULONGLONG>(self->CharInfo->CursorPlatinum) * 1000;
-      coin += static_cast<ULONGLONG>(self->CharInfo->CursorGold) * 100;
-      coin += static_cast<ULONGLONG>(self->CharInfo->CursorSilver) * 10;
-      coin += self->CharInfo->CursorCopper;
-
-      if (coin != 0)
-        oss << "Held" << t << "Currency" << t << 0 << t << coin << t << 0 << std::endl;
-      else
-        oss << "Held" << t << "Empty" << t << 0 << t << 0 << t << 0 << std::endl;
+  }
+  void number(ULONGLONG value)
+  {
+    begin_field();
+    if (format == export_format::bin) {
+      out += 'n';
+      out.append(reinterpret_cast<const char*>(&value), sizeof(value));
+      return;
     }
+    char digits[24];
+    auto result = std::to_chars(digits, digits + sizeof(digits), value);
+    out.append(digits, result.ptr);
   }
-
-  { // Process Bank Items
-    for (size_t i = 0; i < EQ_NUM_INVENTORY_BANK_SLOTS; ++i) {
-      Zeal::EqStructures::EQITEMINFO* item = self->CharInfo->InventoryBankItem[i];
-      if (item) {
-        if (ItemIsContainer(item)) {
-          int capacity = static_cast<int>(item->Container.Capacity);
-          oss << "Bank" << i + 1 << t << item->Name << t << item->ID << t << 1 << t << capacity << std::endl;
-          for (int j = 0; j < capacity; ++j) {
-            Zeal::EqStructures::EQITEMINFO* bag_item = item->Container.Item[j];
-            if (bag_item) {
-              int stack_count = ItemIsStackable(bag_item) ? static_cast<int>(bag_item->Common.StackCount) : 1;
-              oss << "Bank" << i + 1 << "-Slot" << j + 1 << t << bag_item->Name << t << bag_item->ID << t << stack_count << t << 0 << std::endl;
-            }
-            else {
-              oss << "Bank" << i + 1 << "-Slot" << j + 1 << t << "Empty" << t << 0 << t << 0 << t << 0 << std::endl;
-            }
-          }
-        }
-        else {
-          int stack_count = ItemIsStackable(item) ? static_cast<int>(item->Common.StackCount) : 1;
-          oss << "Bank" << i + 1 << t << item->Name << t << item->ID << t << stack_count << t << 0 << std::endl;
-        }
-      }
-      else {
-        oss << "Bank" << i + 1 << t << "Empty" << t << 0 << t << 0 << t << 0 << std::endl;
-      }
+  void end_row()
+  {
+    if (format == export_format::json)
+      out += "}";
+    else if (format != export_format::bin)
+      out += "\r\n";
+    column = 0;
+    rows++;
+  }
+  void finish()
+  {
+    if (format == export_format::json)
+      out += "\n]\n";
+    else if (format == export_format::bin)
+      memcpy(&out[count_offset], &rows, sizeof(rows));
+  }
+private:
+  const char* separator() const { return format == export_format::csv ? "," : "\t"; }
+  void begin_field()
+  {
+    if (format == export_format::json) {
+      out += column ? "," : rows ? ",\n{" : "\n{";
+      out += '"';
+      out += columns[column];
+      out += "\":";
     }
-    ULONGLONG coin = 0;
-    coin += static_cast<ULONGLONG>(self->CharInfo->BankPlatinum) * 1000;
-    coin += static_cast<ULONGLONG>(self->CharInfo->BankGold) * 100;
-    coin += static_cast<ULONGLONG>(self->CharInfo->BankSilver) * 10;
-    coin += self->CharInfo->BankCopper;
-    oss << "Bank-Coin" << t << "Currency" << t << 0 << t << coin << t << 0 << std::endl;
+    else if (column && format != export_format::bin)
+      out += separator();
+    column++;
+  }
+  std::string& out;
+  export_format format;
+  std::vector<const char*> columns;
+  size_t column = 0;
+  UINT32 rows = 0;
+  size_t count_offset = 0;
+};
+
+static void ItemRow(export_writer& w, const char* location, Zeal::EqStructures::EQITEMINFO* item)
+{
+  w.text(location);
+  if (!item) {
+    w.text("Empty");
+    w.number(0);
+    w.number(0);
+    w.number(0);
+  }
+  else if (ItemIsContainer(item)) {
+    w.text(item->Name);
+    w.number(item->ID);
+    w.number(1);
+    w.number(item->Container.Capacity);
+  }
+  else {
+    w.text(item->Name);
+    w.number(item->ID);
+    w.number(ItemIsStackable(item) ? item->Common.StackCount : 1);
+    w.number(0);
+  }
+  w.end_row();
+}
+
+// the item itself then, for a bag, one row per bag slot
+static void BagRows(export_writer& w, const char* location, Zeal::EqStructures::EQITEMINFO* item)
+{
+  ItemRow(w, location, item);
+  if (!item || !ItemIsContainer(item))
+    return;
+  char slot[32];
+  for (int j = 0; j < item->Container.Capacity; ++j) {
+    snprintf(slot, sizeof(slot), "%s-Slot%d", location, j + 1);
+    ItemRow(w, slot, item->Container.Item[j]);
+  }
+}
+
+static void CoinRow(export_writer& w, const char* location, ULONGLONG coin)
+{
+  w.text(location);
+  w.text("Currency");
+  w.number(0);
+  w.number(coin);
+  w.number(0);
+  w.end_row();
+}
+
+void OutputFile::export_inventory(export_format format, const std::string& optional_name)
+{
+  Zeal::EqStructures::Entity* self = Zeal::EqGame::get_self();
+  Zeal::EqStructures::EQCHARINFO* info = self->CharInfo;
+
+  constexpr size_t row_estimate = EQ_NUM_INVENTORY_SLOTS + (EQ_NUM_INVENTORY_PACK_SLOTS + EQ_NUM_INVENTORY_BANK_SLOTS + 1) * (EQ_NUM_CONTAINER_SLOTS + 1) + 2;
+  std::string data;
+  export_writer w(data, format, { "Location", "Name", "ID", "Count", "Slots" }, row_estimate);
+
+  // Processing Equipment
+  for (int i = 0; i < EQ_NUM_INVENTORY_SLOTS; ++i) {
+    Zeal::EqStructures::EQITEMINFO* item = info->InventoryItem[i];
+    // EQITEMINFO->EquipSlot value only updates when a load happens. Don't use it for this.
+    w.text(IDToEquipSlot(i));
+    w.text(item ? item->Name : "Empty");
+    w.number(item ? item->ID : 0);
+    w.number(item ? 1 : 0);
+    w.number(0);
+    w.end_row();
+  }
+
+  char location[16];
+  // Processing Inventory Slots
+  for (int i = 0; i < EQ_NUM_INVENTORY_PACK_SLOTS; ++i) {
+    snprintf(location, sizeof(location), "General%d", i + 1);
+    BagRows(w, location, info->InventoryPackItem[i]);
   }
+  CoinRow(w, "General-Coin", CoinValue(info->Platinum, info->Gold, info->Silver, info->Copper));
 
-  std::string optional_name = "";
-  if (args.size() > 2) {
-    optional_name = args[2];
+  // Process Cursor Item
+  ULONGLONG cursor_coin = CoinValue(info->CursorPlatinum, info->CursorGold, info->CursorSilver, info->CursorCopper);
+  if (info->CursorItem || cursor_coin == 0)
+    BagRows(w, "Held", info->CursorItem);
+  else
+    CoinRow(w, "Held", cursor_coin);
+
+  // Process Bank Items
+  for (int i = 0; i < EQ_NUM_INVENTORY_BANK_SLOTS; ++i) {
+    snprintf(location, sizeof(location), "Bank%d", i + 1);
+    BagRows(w, location, info->InventoryBankItem[i]);
   }
-  write_to_file(oss.str(), "Inventory", optional_name);
+  CoinRow(w, "Bank-Coin", CoinValue(info->BankPlatinum, info->BankGold, info->BankSilver, info->BankCopper));
+
+  w.finish();
+  write_to_file(std::move(data), "Inventory", optional_name, format);
 }
 
 // This function on the Titanium client prints out the spell level and actual name of the spell.
 // Unfortuantely, we currently lack functionality to figure out spell data solely based off of SpellId,
 // so we'll settle for just printing out that information for now.
-void OutputFile::export_spellbook(std::vector<std::string>& args)
+void OutputFile::export_spellbook(export_format format, const std::string& optional_name)
 {
   Zeal::EqStructures::Entity* self = Zeal::EqGame::get_self();
 
-  std::stringstream oss;
-  oss << "Index\tSpell Id" << std::endl;
-  for (size_t i = 0; i < EQ_NUM_SPELL_BOOK_SPELLS; ++i) {
+  std::string data;
+  export_writer w(data, format, { "Index", "Spell Id" }, EQ_NUM_SPELL_BOOK_SPELLS);
+  for (int i = 0; i < EQ_NUM_SPELL_BOOK_SPELLS; ++i) {
     WORD SpellId = self->CharInfo->SpellBook[i];
-    // EQITEMINFO->EquipSlot value only updates when a load happens. Don't use it for this.
     if (SpellId != USHRT_MAX) {
-      oss << i << "\t" << SpellId << std::endl;
+      w.number(i);
+      w.number(SpellId);
+      w.end_row();
     }
   }
-
-  std::string optional_name = "";
-  if (args.size() > 2) {
-    optional_name = args[2];
-  }
-  write_to_file(oss.str(), "Spellbook", optional_name);
+  w.finish();
+  write_to_file(std::move(data), "Spellbook", optional_name, format);
 }
 
-void OutputFile::export_raidlist(std::vector<std::string>& args)
+void OutputFile::export_raidlist(export_format format, const std::string& points)
 {
-    std::vector<Zeal::EqStructures::RaidMember*> raid_member_list = Zeal::EqGame::get_raid_list();
+    const std::vector<Zeal::EqStructures::RaidMember*>& raid_member_list = Zeal::EqGame::get_raid_list();
     if (raid_member_list.size() > 0) {
-        std::stringstream oss;
-
-        std::string points = "1";
-        if (args.size() > 2) { points = args[2]; }
         std::string timestamp = Zeal::EqGame::generateTimestamp();
-
-        oss << "Player\tLevel\tClass\tTimestamp\tPoints" << std::endl;
+        std::string data;
+        export_writer w(data, format, { "Player", "Level", "Class", "Timestamp", "Points" }, raid_member_list.size());
 
         for (auto& raid_member : raid_member_list)
         {
-            oss << raid_member->Name << "\t" << raid_member->PlayerLevel << "\t" << raid_member->Class << "\t" << timestamp << "\t" << points << std::endl;
+            char level[sizeof(raid_member->PlayerLevel) + 1] = {};
+            memcpy(level, raid_member->PlayerLevel, sizeof(raid_member->PlayerLevel)); // two digits fill it with no terminator
+            w.text(raid_member->Name);
+            w.text(level);
+            w.text(raid_member->Class);
+            w.text(timestamp.c_str());
+            w.text(points.c_str());
+            w.end_row();
         }
+        w.finish();
         std::string fname = "RaidTick-" + timestamp;
-        write_to_file(oss.str(), "", fname);
-        Zeal::EqGame::print_chat("Raid tick saved to: %s", fname);
+        write_to_file(std::move(data), "", fname, format);
+        Zeal::EqGame::print_chat("Raid tick saved to: %s", fname.c_str());
     }
     else {
         Zeal::EqGame::print_chat("Currently not in a raid.");
     }
 }
 
-void OutputFile::write_to_file(std::string data, std::string file_arg, std::string optional_name)
+static void WriteFileData(const std::string& path, const std::string& data)
+{
+  HANDLE file = CreateFileA(path.c_str(), GENERIC_WRITE, 0, NULL, CREATE_ALWAYS, FILE_ATTRIBUTE_NORMAL, NULL);
+  if (file == INVALID_HANDLE_VALUE)
+    return;
+  DWORD written = 0;
+  WriteFile(file, data.data(), static_cast<DWORD>(data.size()), &written, NULL);
+  CloseHandle(file);
+}
+
+void OutputFile::write_to_file(std::string&& data, const std::string& file_arg, const std::string& optional_name, export_format format)
 {
   std::string filename = optional_name;
   if (filename.empty()) {
     filename = Zeal::EqGame::get_self()->CharInfo->Name;
     filename += "-" + file_arg;
   }
-  filename += ".txt";
+  filename += FormatExtension(format);
+
+  file_job job{ filename, std::move(data) };
+  if (!jobs.push(std::move(job))) { // writer is behind, write it here rather than lose the export
+    WriteFileData(job.path, job.data);
+    return;
+  }
+  SetEvent(wake_event);
+}
+
+void OutputFile::writer_main()
+{
+  file_job job;
+  while (!end_thread) {
+    WaitForSingleObject(wake_event, INFINITE);
+    while (jobs.pop(job))
+      WriteFileData(job.path, job.data);
+  }
+  while (jobs.pop(job))
+    WriteFileData(job.path, job.data);
+}
 
-  std::ofstream file;
-  file.open(filename);
-  file << data;
-  file.close();
+void OutputFile::check_watch()
+{
+  ZealService* zeal = ZealService::get_instance();
+  Zeal::EqStructures::Entity* self = Zeal::EqGame::get_self();
+  if (!watching || !zeal->item_index || Zeal::EqGame::get_gamestate() != GAMESTATE_INGAME || !self || !self->CharInfo)
+    return;
+  Zeal::EqStructures::EQCHARINFO* info = self->CharInfo;
+  zeal->item_index->refresh();
+  UINT version = zeal->item_index->version();
+  ULONGLONG coin = CoinValue(info->Platinum, info->Gold, info->Silver, info->Copper) + CoinValue(info->BankPlatinum, info->BankGold, info->BankSilver, info->BankCopper)
+    + CoinValue(info->CursorPlatinum, info->CursorGold, info->CursorSilver, info->CursorCopper);
+  if (version == watch_version && coin == watch_coin)
+    return;
+  watch_version = version;
+  watch_coin = coin;
+  export_inventory(watch_format, watch_name);
 }
 
 OutputFile::OutputFile(ZealService* zeal)
 {
+  wake_event = CreateEvent(NULL, FALSE, FALSE, NULL);
+  writer = std::thread([this]() { writer_main(); });
+  zeal->callbacks->add_work([this](int) { check_watch(); return false; }, 1000, work_priority::low);
   zeal->commands_hook->add("/outputfile", { "/output", "/out" }, "Outputs your inventory,spellbook, or raidlist to file.",
     [this](std::vector<std::string>& args) {
-      if (args.size() == 1 || args.size() > 3)
+      export_format format = export_format::txt;
+      std::string name;
+      bool valid = args.size() > 1;
+      for (size_t i = 2; i < args.size() && valid; ++i) {
+        if (!ParseFormat(args[i], format) && !name.empty())
+          valid = false;
+        else if (!ParseFormat(args[i], format))
+          name = args[i];
+      }
+      if (!valid)
       {
-        Zeal::EqGame::print_chat("usage: /outputfile [inventory | spellbook | raidlist] [optional filename]");
+        Zeal::EqGame::print_chat("usage: /outputfile [inventory | spellbook | raidlist] [optional filename] [txt | csv | json | bin]");
+        Zeal::EqGame::print_chat("usage: /outputfile watch [off | txt | csv | json | bin] [optional filename]");
         return true;
       }
-      if (args.size() > 1) {
-        if (Zeal::String::compare_insensitive(args[1], "inventory"))
-        {
-          Zeal::EqGame::print_chat("Outputting inventory...");
-          export_inventory(args);
-        }
-        else if (Zeal::String::compare_insensitive(args[1], "spellbook"))
-        {
-          Zeal::EqGame::print_chat("Outputting spellbook...");
-          export_spellbook(args);
-        }
-        else if (Zeal::String::compare_insensitive(args[1], "raidlist"))
-          export_raidlist(args);
+      if (Zeal::String::compare_insensitive(args[1], "inventory"))
+      {
+        Zeal::EqGame::print_chat("Outputting inventory...");
+        export_inventory(format, name);
+      }
+      else if (Zeal::String::compare_insensitive(args[1], "spellbook"))
+      {
+        Zeal::EqGame::print_chat("Outputting spellbook...");
+        export_spellbook(format, name);
+      }
+      else if (Zeal::String::compare_insensitive(args[1], "raidlist"))
+        export_raidlist(format, name.empty() ? "1" : name);
+      else if (Zeal::String::compare_insensitive(args[1], "watch"))
+      {
+        watching = !(args.size() > 2 && Zeal::String::compare_insensitive(args[2], "off"));
+        watch_format = format;
+        watch_name = Zeal::String::compare_insensitive(name, "off") ? "" : name;
+        watch_coin = ULLONG_MAX; // export once right away
+        if (watching)
+          Zeal::EqGame::print_chat("Inventory is exported on every change");
+        else
+          Zeal::EqGame::print_chat("Inventory watch is off");
       }
       return true;
     }
   );
 }
+
+OutputFile::~OutputFile()
+{
+  end_thread = true;
+  SetEvent(wake_event);
+  if (writer.joinable())
+    writer.join();
+  CloseHandle(wake_event);
+}
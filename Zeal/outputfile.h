@@ -1,15 +1,44 @@
 #pragma once
 #include "hook_wrapper.h"
 #include "memory.h"
+#include <atomic>
+#include <string>
+#include <thread>
+#include "spsc_queue.h"
 
+enum struct export_format
+{
+  txt, //tab separated, the original layout
+  csv,
+  json,
+  bin //length prefixed fields, see export_writer
+};
+
+// exports are formatted on the game thread into one reserved buffer and handed to a writer thread that owns the file io
 class OutputFile
 {
 public:
   OutputFile(class ZealService* zeal);
-  ~OutputFile() {};
+  ~OutputFile();
 private:
-  void export_inventory(std::vector<std::string>& args);
-  void export_spellbook(std::vector<std::string>& args);
-  void export_raidlist(std::vector<std::string>& args);
-  void write_to_file(std::string data, std::string filename, std::string optional_name);
+  struct file_job
+  {
+    std::string path;
+    std::string data;
+  };
+  void export_inventory(export_format format, const std::string& optional_name);
+  void export_spellbook(export_format format, const std::string& optional_name);
+  void export_raidlist(export_format format, const std::string& points);
+  void write_to_file(std::string&& data, const std::string& file_arg, const std::string& optional_name, export_format format);
+  void writer_main();
+  void check_watch();
+  spsc_queue<file_job> jobs{ 16 };
+  HANDLE wake_event = nullptr;
+  std::atomic<bool> end_thread = false;
+  std::thread writer;
+  bool watching = false; //re-export the inventory whenever an item or coin changes
+  export_format watch_format = export_format::txt;
+  std::string watch_name;
+  UINT watch_version = 0;
+  ULONGLONG watch_coin = 0;
 };
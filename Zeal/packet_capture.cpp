@@ -0,0 +1,300 @@
+#include "packet_capture.h"
+#include "Zeal.h"
+#include "string_util.h"
+#include <algorithm>
+
+static bool fits_marker(UINT32 pos, UINT32 capacity) { return capacity - pos >= sizeof(UINT32); }
+
+bool PacketCapture::map(bool write, UINT capacity)
+{
+	unmap();
+	file = CreateFileA(filename.c_str(), write ? GENERIC_READ | GENERIC_WRITE : GENERIC_READ, FILE_SHARE_READ, NULL,
+		write ? CREATE_ALWAYS : OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL, NULL);
+	if (file == INVALID_HANDLE_VALUE)
+		return false;
+	DWORD size = write ? (DWORD)(sizeof(capture_header) + capacity) : 0;
+	mapping = CreateFileMappingA(file, NULL, write ? PAGE_READWRITE : PAGE_READONLY, 0, size, NULL);
+	if (mapping)
+		header = (capture_header*)MapViewOfFile(mapping, write ? FILE_MAP_WRITE : FILE_MAP_READ, 0, 0, 0);
+	if (!header)
+	{
+		unmap();
+		return false;
+	}
+	data = (BYTE*)header + sizeof(capture_header);
+	if (write)
+	{
+		LARGE_INTEGER frequency;
+		QueryPerformanceFrequency(&frequency);
+		header->magic = capture_magic;
+		header->capacity = capacity;
+		header->qpc_frequency = frequency.QuadPart;
+		header->head = 0;
+		header->tail = 0;
+		header->count = 0;
+	}
+	else
+	{
+		LARGE_INTEGER file_size;
+		if (header->magic != capture_magic || !GetFileSizeEx(file, &file_size) || file_size.QuadPart < (LONGLONG)(sizeof(capture_header) + header->capacity))
+		{
+			unmap();
+			return false;
+		}
+	}
+	return true;
+}
+
+void PacketCapture::unmap()
+{
+	if (header)
+		UnmapViewOfFile(header);
+	if (mapping)
+		CloseHandle(mapping);
+	if (file != INVALID_HANDLE_VALUE)
+		CloseHandle(file);
+	header = nullptr;
+	data = nullptr;
+	mapping = nullptr;
+	file = INVALID_HANDLE_VALUE;
+}
+
+// a wrap marker or a tail too close to the end for one continues at offset 0, where the next oldest record is
+void PacketCapture::evict(UINT32 begin, UINT32 end)
+{
+	UINT32 capacity = header->capacity;
+	while (header->count)
+	{
+		UINT32 tail = header->tail;
+		if (!fits_marker(tail, capacity) || *(UINT32*)(data + tail) == capture_wrap)
+			tail = header->tail = 0;
+		if (tail < begin || tail >= end)
+			break;
+		UINT32 next = tail + ((capture_record*)(data + tail))->size;
+		if (next <= tail || next > capacity) //a damaged record, nothing after it can be trusted
+		{
+			header->count = 0;
+			break;
+		}
+		header->tail = next;
+		header->count--;
+	}
+}
+
+void PacketCapture::record(UINT8 direction, UINT opcode, const char* buffer, UINT len)
+{
+	if (!capturing || replaying)
+		return;
+	UINT32 capacity = header->capacity;
+	UINT32 size = (UINT32)((sizeof(capture_record) + len + 3) & ~3u);
+	if (size > capacity / 2)
+		return;
+	UINT32 head = header->head;
+	if (capacity - head < size)
+	{
+		// every record from the write point to the end goes before the marker lands on the first of them
+		evict(head, capacity);
+		if (fits_marker(head, capacity))
+			*(UINT32*)(data + head) = capture_wrap;
+		head = 0;
+	}
+	evict(head, head + size); //the oldest records until the new one has room
+	if (!header->count)
+		header->tail = head;
+
+	capture_record* rec = (capture_record*)(data + head);
+	LARGE_INTEGER now;
+	QueryPerformanceCounter(&now);
+	rec->size = size;
+	rec->opcode = opcode;
+	rec->qpc = now.QuadPart;
+	rec->len = len;
+	rec->direction = direction;
+	memset(rec->padding, 0, sizeof(rec->padding));
+	if (len && buffer)
+		memcpy(rec + 1, buffer, len);
+	header->head = head + size;
+	header->count++;
+}
+
+void PacketCapture::record_key(UINT cmd, bool down)
+{
+	if (!frames)
+		return;
+	char state = down ? 1 : 0;
+	record(capture_key, cmd, &state, 1);
+}
+
+void PacketCapture::record_chat(const char* text, short color_index)
+{
+	if (frames && text)
+		record(capture_chat, static_cast<UINT>(color_index), text, static_cast<UINT>(strlen(text)));
+}
+
+bool PacketCapture::start(UINT megabytes, bool frames_mode)
+{
+	replaying = false;
+	pending.clear();
+	if (!map(true, megabytes << 20))
+		return false;
+	capturing = true;
+	frames = frames_mode;
+	return true;
+}
+
+void PacketCapture::stop()
+{
+	capturing = false;
+	frames = false;
+	if (header)
+		FlushViewOfFile(header, 0);
+	unmap();
+}
+
+void PacketCapture::deliver(const capture_event& event)
+{
+	ZealService* zeal = ZealService::get_instance();
+	if (event.kind == capture_received || event.kind == capture_sent)
+	{
+		static std::vector<char> buffer; //callbacks may rewrite the payload in place, the capture stays untouched
+		buffer.assign(event.payload.begin(), event.payload.end());
+		zeal->callbacks->invoke_packet(event.kind == capture_sent ? callback_type::SendMessage_ : callback_type::WorldMessage,
+			event.opcode, buffer.data(), (UINT)buffer.size());
+	}
+	else if (event.kind == capture_key && event.payload.size() == 1)
+		zeal->callbacks->invoke_command(callback_type::ExecuteCmd, event.opcode, event.payload[0] != 0);
+}
+
+bool PacketCapture::load(std::vector<capture_event>& out)
+{
+	if (capturing)
+		stop();
+	out.clear();
+	if (!map(false, 0))
+		return false;
+	UINT32 pos = header->tail;
+	UINT32 capacity = header->capacity;
+	double tick_scale = 1.0;
+	LARGE_INTEGER frequency;
+	QueryPerformanceFrequency(&frequency);
+	if (header->qpc_frequency)
+		tick_scale = (double)frequency.QuadPart / header->qpc_frequency; //captured on another machine
+	for (UINT32 i = 0; i < header->count; ++i)
+	{
+		if (!fits_marker(pos, capacity) || *(UINT32*)(data + pos) == capture_wrap)
+			pos = 0;
+		const capture_record* rec = (const capture_record*)(data + pos);
+		if (rec->size < sizeof(capture_record) || pos + rec->size > capacity || rec->len > rec->size - sizeof(capture_record))
+			break; //truncated or damaged, keep what was read so far
+		const char* payload = (const char*)(rec + 1);
+		out.push_back({ (LONGLONG)(rec->qpc * tick_scale), rec->direction, rec->opcode, std::vector<char>(payload, payload + rec->len) });
+		pos += rec->size;
+	}
+	unmap();
+	return !out.empty();
+}
+
+// only Zeal's packet callbacks see the replay, the client's own handlers never do
+bool PacketCapture::replay(float speed)
+{
+	if (!load(pending))
+		return false;
+	pending.erase(std::remove_if(pending.begin(), pending.end(), [](const capture_event& event) {
+		return event.kind != capture_received && event.kind != capture_sent; }), pending.end()); //a frame capture replays its packets
+	if (!pending.size())
+		return false;
+	LARGE_INTEGER frequency;
+	QueryPerformanceFrequency(&frequency);
+
+	if (speed <= 0)
+	{
+		replaying = true;
+		LARGE_INTEGER begin, end;
+		QueryPerformanceCounter(&begin);
+		for (capture_event& packet : pending)
+			deliver(packet);
+		QueryPerformanceCounter(&end);
+		replaying = false;
+		double ms = (end.QuadPart - begin.QuadPart) * 1000.0 / frequency.QuadPart;
+		Zeal::EqGame::print_chat("Replayed %u packets in %.2fms, %.0f packets/s", (UINT)pending.size(), ms, ms > 0 ? pending.size() * 1000.0 / ms : 0.0);
+		pending.clear();
+		return true;
+	}
+	LARGE_INTEGER now;
+	QueryPerformanceCounter(&now);
+	replay_speed = speed;
+	replay_start = now.QuadPart;
+	replay_base = pending.front().qpc;
+	replay_next = 0;
+	replaying = true;
+	Zeal::EqGame::print_chat("Replaying %u packets at %.1fx", (UINT)pending.size(), speed);
+	return true;
+}
+
+void PacketCapture::main_loop()
+{
+	if (capturing && frames)
+	{
+		Zeal::EqStructures::MouseDelta* delta = (Zeal::EqStructures::MouseDelta*)0x798586;
+		if (delta->x || delta->y)
+			record(capture_mouse, 0, (const char*)delta, sizeof(Zeal::EqStructures::MouseDelta));
+		record(capture_frame, 0, nullptr, 0);
+	}
+	if (!replaying || !pending.size())
+		return;
+	LARGE_INTEGER now;
+	QueryPerformanceCounter(&now);
+	LONGLONG due = replay_base + (LONGLONG)((now.QuadPart - replay_start) * replay_speed);
+	while (replay_next < pending.size() && pending[replay_next].qpc <= due)
+		deliver(pending[replay_next++]);
+	if (replay_next >= pending.size())
+	{
+		replaying = false;
+		pending.clear();
+		Zeal::EqGame::print_chat("Packet replay finished");
+	}
+}
+
+PacketCapture::PacketCapture(ZealService* zeal)
+{
+	zeal->callbacks->add_generic([this]() { main_loop(); }, callback_type::MainLoop);
+	zeal->commands_hook->add("/capture", {}, "Records world packets to zeal_capture.bin, /capture start [mb] | frames [mb] | stop | replay [speed, 0 for as fast as possible]. "
+		"frames also records keys, mouse deltas and chat per frame for /zealbench trace.",
+		[this](std::vector<std::string>& args) {
+			bool frame_capture = args.size() > 1 && Zeal::String::compare_insensitive(args[1], "frames");
+			if (args.size() > 1 && (frame_capture || Zeal::String::compare_insensitive(args[1], "start")))
+			{
+				int megabytes = 16;
+				if (args.size() > 2)
+					Zeal::String::tryParse(args[2], &megabytes);
+				if (megabytes < 1 || megabytes > 1024)
+					megabytes = 16;
+				if (start(megabytes, frame_capture))
+					Zeal::EqGame::print_chat("Capturing %s into %s (%d MB ring)", frame_capture ? "frames" : "packets", filename.c_str(), megabytes);
+				else
+					Zeal::EqGame::print_chat("Failed to create %s", filename.c_str());
+			}
+			else if (args.size() > 1 && Zeal::String::compare_insensitive(args[1], "stop"))
+			{
+				UINT count = header ? header->count : 0;
+				stop();
+				Zeal::EqGame::print_chat("Capture stopped with %u packets", count);
+			}
+			else if (args.size() > 1 && Zeal::String::compare_insensitive(args[1], "replay"))
+			{
+				float speed = 1.0f;
+				if (args.size() > 2)
+					Zeal::String::tryParse(args[2], &speed);
+				if (!replay(speed))
+					Zeal::EqGame::print_chat("Nothing to replay in %s", filename.c_str());
+			}
+			else
+				Zeal::EqGame::print_chat("Capture is %s%s", capturing ? "running" : "stopped", replaying ? ", replay in progress" : "");
+			return true;
+		});
+}
+
+PacketCapture::~PacketCapture()
+{
+	stop();
+}
@@ -0,0 +1,81 @@
+#pragma once
+#include <Windows.h>
+#include <string>
+#include <vector>
+
+// world packets in both directions recorded into a memory mapped ring file, oldest records are overwritten once it is full
+// file layout: capture_header, then capacity bytes of capture_record + payload, every record padded to 4 bytes
+// a record that would run past the end leaves a wrap marker (size capture_wrap) and starts again at offset 0
+static constexpr UINT32 capture_magic = 0x315A4350; //"PCZ1"
+static constexpr UINT32 capture_wrap = 0xFFFFFFFF;
+#pragma pack(push, 4)
+struct capture_header
+{
+	UINT32 magic;
+	UINT32 capacity; //bytes of record space after the header
+	UINT64 qpc_frequency;
+	volatile UINT32 head; //offset of the next write
+	volatile UINT32 tail; //offset of the oldest record
+	volatile UINT32 count;
+};
+struct capture_record
+{
+	UINT32 size; //header and payload including padding, capture_wrap for the marker
+	UINT32 opcode;
+	UINT64 qpc;
+	UINT32 len;
+	UINT8 direction; //capture_kind, 0 received and 1 sent for packets
+	UINT8 padding[3];
+};
+#pragma pack(pop)
+// a frame capture also records the per frame inputs, opcode holds the command id for keys and the color for chat
+enum capture_kind : UINT8
+{
+	capture_received = 0,
+	capture_sent = 1,
+	capture_key = 2, //payload one byte, 1 for down
+	capture_mouse = 3, //payload the MouseDelta at 0x798586
+	capture_chat = 4, //payload the text
+	capture_frame = 5, //end of a main loop, no payload
+};
+struct capture_event
+{
+	LONGLONG qpc;
+	UINT8 kind;
+	UINT opcode;
+	std::vector<char> payload;
+};
+
+class PacketCapture
+{
+public:
+	void record(UINT8 direction, UINT opcode, const char* buffer, UINT len);
+	void record_key(UINT cmd, bool down);
+	void record_chat(const char* text, short color_index);
+	bool start(UINT megabytes, bool frames = false); //frames adds keys, mouse deltas, chat and frame boundaries to the packets
+	void stop();
+	bool replay(float speed); //0 replays the whole capture at once and reports throughput
+	bool load(std::vector<capture_event>& out); //every record of the capture file, oldest first
+	void deliver(const capture_event& event); //packets to zeal's packet callbacks only, keys to its command callbacks
+	const std::string& file_name() const { return filename; }
+	PacketCapture(class ZealService* zeal);
+	~PacketCapture();
+private:
+	bool map(bool write, UINT capacity);
+	void unmap();
+	void evict(UINT32 begin, UINT32 end); //drops the oldest records while the tail starts inside [begin, end)
+	void main_loop();
+	std::string filename = "zeal_capture.bin";
+	HANDLE file = INVALID_HANDLE_VALUE;
+	HANDLE mapping = nullptr;
+	capture_header* header = nullptr;
+	BYTE* data = nullptr;
+	bool capturing = false;
+	bool frames = false;
+	bool replaying = false; //replayed packets are not captured again
+	std::vector<capture_event> pending; //paced replay
+	size_t replay_next = 0;
+	float replay_speed = 1.0f;
+	LONGLONG replay_start = 0;
+	LONGLONG replay_base = 0;
+};
@@ -0,0 +1,148 @@
+#include "packet_governor.h"
+#include "Zeal.h"
+#include "EqFunctions.h"
+#include "EqPackets.h"
+#include <algorithm>
+
+static constexpr float default_per_second = 5.f;
+static constexpr float default_burst = 5.f;
+static constexpr size_t max_queued = 256; //per priority, past it the oldest in that queue is dropped
+
+void PacketGovernor::bucket::refill(ULONGLONG now)
+{
+	if (refilled)
+		tokens = std::min(burst, tokens + (now - refilled) * per_second / 1000.f);
+	refilled = now;
+}
+
+PacketGovernor::bucket& PacketGovernor::bucket_for(UINT opcode)
+{
+	auto it = buckets.find(opcode);
+	if (it == buckets.end())
+		it = buckets.emplace(opcode, bucket{ default_per_second, default_burst, default_burst }).first;
+	return it->second;
+}
+
+void PacketGovernor::set_rate(UINT opcode, float per_second, float burst)
+{
+	bucket& b = bucket_for(opcode);
+	b.per_second = per_second;
+	b.burst = burst;
+	b.tokens = std::min(b.tokens, burst);
+}
+
+bool PacketGovernor::try_take(UINT opcode, ULONGLONG now)
+{
+	bucket& b = bucket_for(opcode);
+	b.refill(now);
+	global.refill(now);
+	if (b.tokens < 1.f || global.tokens < 1.f)
+		return false;
+	b.tokens -= 1.f;
+	global.tokens -= 1.f;
+	return true;
+}
+
+void PacketGovernor::transmit(const packet& p)
+{
+	sent++;
+	Zeal::EqGame::send_message(p.opcode, p.payload.empty() ? nullptr : (int*)p.payload.data(), static_cast<UINT>(p.payload.size()), 0);
+}
+
+void PacketGovernor::send(UINT opcode, const void* data, UINT size, packet_priority priority, UINT64 coalesce_key)
+{
+	int level = static_cast<int>(priority);
+	std::vector<packet>& queue = queues[level];
+	if (coalesce_key)
+	{
+		for (packet& p : queue)
+		{
+			if (p.opcode == opcode && p.coalesce_key == coalesce_key)
+			{
+				p.payload = data && size ? std::string(static_cast<const char*>(data), size) : std::string(); //the newest contents, the older place in line
+				coalesced++;
+				return;
+			}
+		}
+	}
+	bool waiting = false;
+	for (int i = 0; i <= level; ++i)
+		waiting |= !queues[i].empty();
+	packet p = { opcode, coalesce_key, data && size ? std::string(static_cast<const char*>(data), size) : std::string() };
+	if (!waiting && try_take(opcode, GetTickCount64()))
+	{
+		transmit(p);
+		return;
+	}
+	deferred++;
+	if (queue.size() >= max_queued)
+		queue.erase(queue.begin());
+	queue.push_back(std::move(p));
+}
+
+void PacketGovernor::cancel(UINT opcode, UINT64 coalesce_key)
+{
+	for (std::vector<packet>& queue : queues)
+		std::erase_if(queue, [opcode, coalesce_key](const packet& p) { return p.opcode == opcode && (!coalesce_key || p.coalesce_key == coalesce_key); });
+}
+
+// highest priority first, within a priority in order; a packet whose opcode is out of tokens doesn't hold up other opcodes
+void PacketGovernor::drain()
+{
+	if (!queued())
+		return;
+	if (!Zeal::EqGame::is_in_game())
+		return;
+	ULONGLONG now = GetTickCount64();
+	for (std::vector<packet>& queue : queues)
+	{
+		size_t kept = 0;
+		for (size_t i = 0; i < queue.size(); ++i)
+		{
+			if (try_take(queue[i].opcode, now))
+				transmit(queue[i]);
+			else if (kept != i)
+				queue[kept++] = std::move(queue[i]);
+			else
+				kept++;
+		}
+		queue.resize(kept);
+		if (global.tokens < 1.f)
+			return;
+	}
+}
+
+size_t PacketGovernor::queued() const
+{
+	size_t total = 0;
+	for (const std::vector<packet>& queue : queues)
+		total += queue.size();
+	return total;
+}
+
+void PacketGovernor::clear()
+{
+	for (std::vector<packet>& queue : queues)
+		queue.clear();
+}
+
+PacketGovernor::PacketGovernor(ZealService* zeal)
+{
+	set_rate(Zeal::Packets::opcodes::CorpseDrag, 10.f, 10.f); //a full tow re-dragged in one tick
+	set_rate(Zeal::Packets::opcodes::CorpseDrop, 5.f, 5.f);
+	set_rate(Zeal::Packets::opcodes::Consider, 4.f, 2.f);
+	set_rate(Zeal::Packets::opcodes::RequestTrade, 1.f, 2.f);
+	zeal->callbacks->add_generic([this]() { drain(); });
+	zeal->callbacks->add_generic([this]() { clear(); }, callback_type::Zone); //what was queued for the old zone means nothing in the new one
+	zeal->callbacks->add_generic([this]() { clear(); }, callback_type::CharacterSelect);
+	zeal->commands_hook->add("/packetgov", {}, "Zeal's own outgoing packets: sent, coalesced and deferred counts and what is queued.",
+		[this](std::vector<std::string>& args) {
+			Zeal::EqGame::print_chat("Packets sent %llu, coalesced %llu, deferred %llu, queued %u (combat %u, normal %u, housekeeping %u)",
+				sent, coalesced, deferred, (UINT)queued(), (UINT)queues[0].size(), (UINT)queues[1].size(), (UINT)queues[2].size());
+			return true;
+		});
+}
+
+PacketGovernor::~PacketGovernor()
+{
+}
@@ -0,0 +1,54 @@
+#pragma once
+#include <Windows.h>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+enum class packet_priority
+{
+	combat, //sent ahead of everything else waiting
+	normal, //a command the player just typed
+	housekeeping, //background work (cons, re-drags), whatever bandwidth is left
+	_count
+};
+
+// every packet zeal originates goes through here instead of straight to send_message. each opcode has a token bucket
+// and all of them share a global one; send() goes out at once when the buckets allow and nothing of equal or higher
+// priority is waiting, otherwise it queues and the main loop drains the queues in priority order as tokens come back.
+// a non zero coalesce key replaces a queued packet with the same opcode and key instead of adding another
+class PacketGovernor
+{
+public:
+	void send(UINT opcode, const void* data, UINT size, packet_priority priority = packet_priority::normal, UINT64 coalesce_key = 0);
+	void cancel(UINT opcode, UINT64 coalesce_key = 0); //drops queued packets of the opcode, only the one key when non zero
+	void set_rate(UINT opcode, float per_second, float burst);
+	size_t queued() const;
+	PacketGovernor(class ZealService* zeal);
+	~PacketGovernor();
+private:
+	struct bucket
+	{
+		float per_second;
+		float burst;
+		float tokens;
+		ULONGLONG refilled = 0;
+		void refill(ULONGLONG now);
+	};
+	struct packet
+	{
+		UINT opcode;
+		UINT64 coalesce_key;
+		std::string payload;
+	};
+	bucket& bucket_for(UINT opcode);
+	bool try_take(UINT opcode, ULONGLONG now); //takes a token from the opcode and the global bucket, or neither
+	void transmit(const packet& p);
+	void drain();
+	void clear();
+	std::unordered_map<UINT, bucket> buckets;
+	bucket global = { 20.f, 10.f, 10.f };
+	std::vector<packet> queues[static_cast<int>(packet_priority::_count)];
+	UINT64 sent = 0;
+	UINT64 coalesced = 0;
+	UINT64 deferred = 0;
+};
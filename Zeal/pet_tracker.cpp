@@ -0,0 +1,178 @@
+#include "pet_tracker.h"
+#include "Zeal.h"
+#include "EqFunctions.h"
+#include "EqAddresses.h"
+#include <algorithm>
+
+void PetTracker::link(WORD pet_id, WORD owner_id)
+{
+	unlink(pet_id);
+	if (!owner_id)
+		return;
+	owner_of[pet_id] = owner_id;
+	std::vector<WORD>& list = pets_of[owner_id];
+	list.insert(std::lower_bound(list.begin(), list.end(), pet_id), pet_id);
+}
+
+void PetTracker::unlink(WORD pet_id)
+{
+	auto it = owner_of.find(pet_id);
+	if (it == owner_of.end())
+		return;
+	auto owned = pets_of.find(it->second);
+	if (owned != pets_of.end())
+	{
+		std::erase(owned->second, pet_id);
+		if (owned->second.empty())
+			pets_of.erase(owned);
+	}
+	owner_of.erase(it);
+}
+
+void PetTracker::clear()
+{
+	owner_of.clear();
+	pets_of.clear();
+	synced = false;
+}
+
+WORD PetTracker::owner_id(WORD pet_id) const
+{
+	auto it = owner_of.find(pet_id);
+	return it == owner_of.end() ? 0 : it->second;
+}
+
+Zeal::EqStructures::Entity* PetTracker::pet(WORD owner_id)
+{
+	if (!owner_id)
+		return nullptr;
+	ZealService* zeal = ZealService::get_instance();
+	auto it = pets_of.find(owner_id);
+	if (it == pets_of.end())
+		return synced ? nullptr : zeal->entity_manager->get_pet(owner_id);
+	Zeal::EqStructures::Entity* ent = zeal->entity_manager->get(it->second.front());
+	if (ent && ent->PetOwnerSpawnId == owner_id)
+		return ent;
+	return zeal->entity_manager->get_pet(owner_id); //changed since the last diff
+}
+
+Zeal::EqStructures::Entity* PetTracker::owner(Zeal::EqStructures::Entity* pet)
+{
+	if (!pet || !pet->PetOwnerSpawnId)
+		return nullptr;
+	return ZealService::get_instance()->entity_manager->get(pet->PetOwnerSpawnId); //the pet names its owner, only the id lookup is left
+}
+
+void PetTracker::pets(WORD owner_id, std::vector<Zeal::EqStructures::Entity*>& out)
+{
+	out.clear();
+	if (!owner_id)
+		return;
+	ZealService* zeal = ZealService::get_instance();
+	auto it = pets_of.find(owner_id);
+	if (it == pets_of.end())
+	{
+		if (!synced)
+			zeal->entity_manager->get_pets(owner_id, out);
+		return;
+	}
+	for (WORD id : it->second)
+	{
+		Zeal::EqStructures::Entity* ent = zeal->entity_manager->get(id);
+		if (!ent || ent->PetOwnerSpawnId != owner_id)
+		{
+			zeal->entity_manager->get_pets(owner_id, out);
+			return;
+		}
+		out.push_back(ent);
+	}
+}
+
+// the name as the client shows it, underscores as spaces and the spawn's number suffix dropped
+static std::string display_name(const char* name)
+{
+	std::string text = name;
+	while (!text.empty() && isdigit(static_cast<unsigned char>(text.back())))
+		text.pop_back();
+	std::replace(text.begin(), text.end(), '_', ' ');
+	return text;
+}
+
+static void format_pet_hp(Zeal::EqStructures::Entity* pet, label_value& value)
+{
+	value.write_text = true;
+	if (!pet || !pet->HpMax)
+	{
+		value.text.clear();
+		return;
+	}
+	value.set_number(std::clamp(static_cast<int>(pet->HpCurrent * 100 / pet->HpMax), 0, 100));
+}
+
+static UINT64 pet_inputs(Zeal::EqStructures::Entity* pet)
+{
+	return pet ? (UINT64)(UINT_PTR)pet ^ ((UINT64)pet->HpCurrent << 32) : 0;
+}
+
+// the pet labels the client fills by walking its own list, answered from the maps instead
+void PetTracker::register_labels(ZealService* zeal)
+{
+	zeal->labels_hook->add_label(68, "PlayerPetName", { [this](label_value& value) {
+		Zeal::EqStructures::Entity* self = Zeal::EqGame::get_self();
+		Zeal::EqStructures::Entity* p = self ? pet(self->SpawnId) : nullptr;
+		value.text = p ? display_name(p->Name) : "";
+		value.write_text = true;
+	}, [this]() {
+		Zeal::EqStructures::Entity* self = Zeal::EqGame::get_self();
+		return (UINT64)(UINT_PTR)(self ? pet(self->SpawnId) : nullptr);
+	} });
+	zeal->labels_hook->add_label(69, "PlayerPetHPPerc", { [this](label_value& value) {
+		Zeal::EqStructures::Entity* self = Zeal::EqGame::get_self();
+		format_pet_hp(self ? pet(self->SpawnId) : nullptr, value);
+	}, [this]() {
+		Zeal::EqStructures::Entity* self = Zeal::EqGame::get_self();
+		return pet_inputs(self ? pet(self->SpawnId) : nullptr);
+	}, 100, true });
+	static const char* group_names[EQ_NUM_GROUP_MEMBERS] = { "GroupPet1HPPerc", "GroupPet2HPPerc", "GroupPet3HPPerc", "GroupPet4HPPerc", "GroupPet5HPPerc" };
+	for (int i = 0; i < EQ_NUM_GROUP_MEMBERS; ++i)
+	{
+		auto group_pet = [this, i]() {
+			Zeal::EqStructures::Entity* member = ((Zeal::EqStructures::Entity**)Zeal::EqGame::GroupList)[i];
+			return member ? pet(member->SpawnId) : nullptr;
+		};
+		zeal->labels_hook->add_label(40 + i, group_names[i], { [group_pet](label_value& value) { format_pet_hp(group_pet(), value); },
+			[group_pet]() { return pet_inputs(group_pet()); }, 100, true });
+	}
+}
+
+PetTracker::PetTracker(ZealService* zeal)
+{
+	zeal->entity_manager->subscribe([this](const entity_event& e) {
+		switch (e.type)
+		{
+		case entity_event_type::spawned:
+			if (e.ent->PetOwnerSpawnId)
+				link(e.spawn_id, e.ent->PetOwnerSpawnId);
+			break;
+		case entity_event_type::despawned:
+			unlink(e.spawn_id); //an owner leaving keeps its pets' entries, they go with the pets or a new owner
+			break;
+		case entity_event_type::owner_changed:
+			link(e.spawn_id, static_cast<WORD>(e.new_value));
+			break;
+		default:
+			break;
+		}
+	}, (1u << static_cast<int>(entity_event_type::spawned)) | (1u << static_cast<int>(entity_event_type::despawned)) | (1u << static_cast<int>(entity_event_type::owner_changed)));
+	zeal->callbacks->add_generic([this]() { synced = Zeal::EqGame::is_in_game(); }); //after the entity manager's diff, it registered first
+	zeal->callbacks->add_generic([this]() { clear(); }, callback_type::Zone); //the manager starts the new zone without despawns
+	zeal->callbacks->add_generic([this]() { clear(); }, callback_type::CharacterSelect);
+	zeal->memory_report->add("pets", [this]() {
+		return Zeal::Memory::usage{ Zeal::Memory::hash_bytes(owner_of) + Zeal::Memory::hash_bytes(pets_of), owner_of.size() };
+	});
+	register_labels(zeal);
+}
+
+PetTracker::~PetTracker()
+{
+}
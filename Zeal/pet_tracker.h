@@ -0,0 +1,27 @@
+#pragma once
+#include <Windows.h>
+#include <unordered_map>
+#include <vector>
+#include "EqStructures.h"
+
+// owner to pets and pet to owner, kept from the entity change feed (spawns, despawns and owner changes) so a lookup
+// is a hash probe instead of a walk of the entity list. once the feed has run in the current zone a miss means no pet,
+// a hit whose entity no longer agrees falls back to the entity manager for the one call
+class PetTracker
+{
+public:
+	Zeal::EqStructures::Entity* pet(WORD owner_id); //the first pet by spawn id, nullptr without one
+	Zeal::EqStructures::Entity* owner(Zeal::EqStructures::Entity* pet);
+	void pets(WORD owner_id, std::vector<Zeal::EqStructures::Entity*>& out);
+	WORD owner_id(WORD pet_id) const;
+	PetTracker(class ZealService* zeal);
+	~PetTracker();
+private:
+	void link(WORD pet_id, WORD owner_id);
+	void unlink(WORD pet_id);
+	void clear();
+	void register_labels(class ZealService* zeal);
+	std::unordered_map<WORD, WORD> owner_of; //pet spawn id to owner spawn id
+	std::unordered_map<WORD, std::vector<WORD>> pets_of; //owner spawn id to its pets, sorted
+	bool synced = false; //the feed has been diffed since the last zone
+};
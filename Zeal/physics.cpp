@@ -1,48 +1,264 @@
 #include "physics.h"
 #include "Zeal.h"
 #include "EqAddresses.h"
+#include "string_util.h"
+#include <thread>
 
 void ProcessPhysics(Zeal::EqStructures::Entity* ent, int missile, int effect)
 {
 	if (ent && ent->ActorInfo && missile==0)
 	{
-		if (Zeal::EqGame::get_eq_time() - ent->ActorInfo->PhysicsTimer >= 16)
+		if (Zeal::EqGame::get_eq_time() - ent->ActorInfo->PhysicsTimer >= ZealService::get_instance()->physics->interval(ent))
 		{
-			ZealService::get_instance()->hooks->hook_map["ProcessPhysics"]->original(ProcessPhysics)(ent, missile, effect);
+			hook_ref<ProcessPhysics>::original()(ent, missile, effect);
 			return;
 		}
 	}
 	else
 	{
-		ZealService::get_instance()->hooks->hook_map["ProcessPhysics"]->original(ProcessPhysics)(ent, missile, effect);
+		hook_ref<ProcessPhysics>::original()(ent, missile, effect);
 	}
 }
 
-bool Physics::can_move(short spawn_id)
+void Physics::update_frame()
 {
-	bool move = false;
-	if (move_timers.count(spawn_id) > 0)
+	frame_time = Zeal::EqGame::get_eq_time();
+	Zeal::EqStructures::Entity* self = Zeal::EqGame::get_self();
+	lod_active = lod_enabled.get() && self && Zeal::EqGame::is_in_game();
+	if (bench_left)
+		tick_bench();
+	bool was_gliding = gliding;
+	gliding = lod_active && (bench_left ? bench_left <= bench_frames / 2 : workers_enabled.get());
+	if (was_gliding && !gliding)
+		reset_glides();
+	if (!lod_active)
+		return;
+	ZealService* zeal = ZealService::get_instance();
+	self_pos = self->Position;
+	relevant.reset();
+	relevant.set(self->SpawnId);
+	if (Zeal::EqStructures::Entity* target = Zeal::EqGame::get_target())
+		relevant.set(target->SpawnId);
+	Zeal::EqStructures::Entity** group = (Zeal::EqStructures::Entity**)Zeal::EqGame::GroupList;
+	for (int i = 0; i < EQ_NUM_GROUP_MEMBERS; ++i)
 	{
-		move = Zeal::EqGame::get_eq_time() - move_timers[spawn_id] >= 16;
+		if (group[i] && zeal->entity_manager->get(group[i]->SpawnId) == group[i])
+			relevant.set(group[i]->SpawnId);
 	}
+	std::vector<Zeal::EqStructures::Entity*> pets;
+	zeal->entity_manager->get_pets(self->SpawnId, pets);
+	for (auto& pet : pets)
+		relevant.set(pet->SpawnId);
+	zeal->entity_manager->ensure_visible(lod_far.get());
+	if (gliding)
+		queue_glides();
+}
+
+void Physics::begin_step(Zeal::EqStructures::Entity* ent)
+{
+	if (!gliding)
+		return;
+	USHORT slot = (*glide_slot)[ent->SpawnId];
+	if (!slot)
+		return;
+	glide& g = glides[slot - 1];
+	if (g.active && ent->Position == g.written && ZealService::get_instance()->entity_manager->resolve(g.actor) == ent)
+		ent->Position = g.anchor; //the real step runs from where the game left the actor, not from the extrapolation
+	g.active = false;
+}
+
+void Physics::end_step(Zeal::EqStructures::Entity* ent)
+{
+	if (!gliding)
+		return;
+	USHORT& slot = (*glide_slot)[ent->SpawnId];
+	if (!(*move_tiers)[ent->SpawnId])
+	{
+		if (slot)
+			glides[slot - 1].velocity = Vec3(); //full rate actors step every frame anyway
+		return;
+	}
+	if (!slot)
+	{
+		glides.push_back({});
+		slot = (USHORT)glides.size();
+	}
+	glide& g = glides[slot - 1];
+	UINT now = frame_time ? frame_time : Zeal::EqGame::get_eq_time();
+	UINT elapsed = now - g.anchor_time;
+	Vec3 pos = ent->Position;
+	EntityHandle actor = ZealService::get_instance()->entity_manager->handle(ent);
+	if (g.actor == actor && g.anchor_time && elapsed && elapsed < 500 && pos.Dist2(g.anchor) < 50.f * 50.f)
+		g.velocity = Vec3((pos.x - g.anchor.x) / elapsed, (pos.y - g.anchor.y) / elapsed, (pos.z - g.anchor.z) / elapsed);
 	else
+		g.velocity = Vec3(); //first step or a server correction, wait for the next one
+	g.actor = actor;
+	g.anchor = pos;
+	g.anchor_time = now;
+	g.active = false;
+}
+
+void Physics::queue_glides()
+{
+	if (jobs_in_flight)
+		apply_glides();
+	jobs.clear();
+	for (size_t i = 0; i < glides.size(); ++i)
+	{
+		glide& g = glides[i];
+		if (!g.actor || (!g.velocity.x && !g.velocity.y && !g.velocity.z))
+			continue;
+		UINT elapsed = frame_time - g.anchor_time;
+		if (elapsed > tier_ms[3] * 2)
+			continue; //no real step for a while, it stopped or despawned
+		jobs.push_back({ (USHORT)i, g.anchor_time, g.anchor, g.velocity, (float)elapsed });
+	}
+	if (!jobs.size())
+		return;
+	if (!pool)
 	{
-		move_timers[spawn_id] = Zeal::EqGame::get_eq_time();
+		unsigned int cores = std::thread::hardware_concurrency();
+		pool = std::make_unique<WorkerPool>(cores > 8 ? 4 : cores > 2 ? cores / 2 : 1);
 	}
+	glide_job* batch = jobs.data();
+	pool->dispatch(jobs.size(), [batch](size_t begin, size_t end) { extrapolate(batch, begin, end); });
+	jobs_in_flight = true;
+}
 
-	if (move)
-		move_timers[spawn_id] = Zeal::EqGame::get_eq_time();
+// worker threads, touches nothing but the batch
+void Physics::extrapolate(glide_job* batch, size_t begin, size_t end)
+{
+	for (size_t i = begin; i < end; ++i)
+	{
+		glide_job& j = batch[i];
+		j.result = Vec3(j.from.x + j.velocity.x * j.ms, j.from.y + j.velocity.y * j.ms, j.from.z + j.velocity.z * j.ms);
+	}
+}
 
-	return move;
+void Physics::apply_glides()
+{
+	if (!jobs_in_flight)
+		return;
+	LARGE_INTEGER begin, end;
+	QueryPerformanceCounter(&begin);
+	pool->wait();
+	jobs_in_flight = false;
+	ZealService* zeal = ZealService::get_instance();
+	for (glide_job& job : jobs)
+	{
+		glide& g = glides[job.slot];
+		if (g.anchor_time != job.anchor_time)
+			continue; //stepped since the job was queued
+		Zeal::EqStructures::Entity* ent = zeal->entity_manager->resolve(g.actor);
+		if (!ent)
+			continue; //despawned
+		if (ent->Position != (g.active ? g.written : g.anchor))
+			continue; //the game moved it, a server update wins over the extrapolation
+		ent->Position = job.result;
+		g.written = job.result;
+		g.active = true;
+	}
+	QueryPerformanceCounter(&end);
+	if (bench_left)
+	{
+		LARGE_INTEGER frequency;
+		QueryPerformanceFrequency(&frequency);
+		bench_pass_ms += (end.QuadPart - begin.QuadPart) * 1000.0 / frequency.QuadPart;
+		bench_actors += jobs.size();
+	}
+}
+
+// puts every actor back on its last real step, the game never sees an extrapolated position once gliding stops
+void Physics::reset_glides()
+{
+	if (jobs_in_flight)
+	{
+		pool->wait();
+		jobs_in_flight = false;
+	}
+	ZealService* zeal = ZealService::get_instance();
+	for (glide& g : glides)
+	{
+		if (!g.active)
+			continue;
+		Zeal::EqStructures::Entity* ent = zeal->entity_manager->resolve(g.actor);
+		if (ent && ent->Position == g.written)
+			ent->Position = g.anchor;
+	}
+	glides.clear();
+	jobs.clear();
+	glide_slot->fill(0);
+}
+
+void Physics::tick_bench()
+{
+	LARGE_INTEGER now, frequency;
+	QueryPerformanceCounter(&now);
+	QueryPerformanceFrequency(&frequency);
+	if (bench_last)
+		bench_ms[bench_left <= bench_frames / 2 ? 1 : 0] += (now.QuadPart - bench_last) * 1000.0 / frequency.QuadPart;
+	bench_last = now.QuadPart;
+	if (--bench_left)
+		return;
+	int half = bench_frames / 2;
+	Zeal::EqGame::print_chat("Physics bench over %d frames: %.2fms per frame without the pre-pass, %.2fms with it", half, bench_ms[0] / half, bench_ms[1] / half);
+	Zeal::EqGame::print_chat("pre-pass: %.1f actors and %.3fms of game thread time per frame on %u workers", (double)bench_actors / half, bench_pass_ms / half,
+		pool ? (UINT)pool->size() : 0);
+}
+
+BYTE Physics::tier_for(Zeal::EqStructures::Entity* ent)
+{
+	if (!lod_active || relevant.test(ent->SpawnId))
+		return 0;
+	if (!ZealService::get_instance()->entity_manager->is_visible(ent->SpawnId))
+		return 3;
+	float dist2 = ent->Position.Dist2D2(self_pos);
+	float near_dist = lod_near.get(), mid_dist = lod_mid.get(), far_dist = lod_far.get();
+	if (dist2 <= near_dist * near_dist)
+		return 0;
+	if (dist2 <= mid_dist * mid_dist)
+		return 1;
+	if (dist2 <= far_dist * far_dist)
+		return 2;
+	return 3;
+}
+
+UINT Physics::interval(Zeal::EqStructures::Entity* ent)
+{
+	return tier_ms[tier_for(ent)];
+}
+
+bool Physics::can_move(Zeal::EqStructures::Entity* ent)
+{
+	UINT now = frame_time ? frame_time : Zeal::EqGame::get_eq_time();
+	UINT& last = (*move_timers)[ent->SpawnId];
+	BYTE& last_tier = (*move_tiers)[ent->SpawnId];
+	BYTE tier = tier_for(ent);
+	if (!last)
+	{
+		last = now;
+		last_tier = tier;
+		return false;
+	}
+	// an actor that just became relevant moves at once so its server position snaps in instead of waiting out the slow interval
+	if (tier >= last_tier && now - last < tier_ms[tier])
+		return false;
+	last = now;
+	last_tier = tier;
+	return true;
 }
 
 int __fastcall MovePlayer(int t, int u, Zeal::EqStructures::Entity* ent)
 {
 	if (!ent)
 		return 1;
-	if (ZealService::get_instance()->physics->can_move(ent->SpawnId))
+	Physics* physics = ZealService::get_instance()->physics.get();
+	if (physics->can_move(ent))
 	{
-		return ZealService::get_instance()->hooks->hook_map["MovePlayer"]->original(MovePlayer)(t, u, ent);
+		physics->begin_step(ent);
+		int rval = hook_ref<MovePlayer>::original()(t, u, ent);
+		physics->end_step(ent);
+		return rval;
 	}
 	else
 		return 1;
@@ -50,13 +266,80 @@ int __fastcall MovePlayer(int t, int u, Zeal::EqStructures::Entity* ent)
 
 Physics::Physics(ZealService* zeal, IO_ini* ini)
 {
-	zeal->callbacks->add_generic([this]() { move_timers.clear(); }, callback_type::Zone);
+	move_timers = std::make_unique<std::array<UINT, 0x10000>>();
+	move_timers->fill(0);
+	move_tiers = std::make_unique<std::array<BYTE, 0x10000>>();
+	move_tiers->fill(0);
+	glide_slot = std::make_unique<std::array<USHORT, 0x10000>>();
+	glide_slot->fill(0);
+	zeal->callbacks->add_generic([this]() { update_frame(); }, callback_type::MainLoop);
+	zeal->callbacks->add_generic([this]() { apply_glides(); }, callback_type::Render);
+	zeal->callbacks->add_generic([this]() {
+		if (jobs_in_flight)
+			pool->wait();
+		jobs_in_flight = false;
+		glides.clear();
+		jobs.clear();
+		glide_slot->fill(0);
+		move_timers->fill(0);
+		move_tiers->fill(0);
+	}, callback_type::Zone);
+	zeal->commands_hook->add("/physicslod", {}, "Slower physics for distant or unseen actors, /physicslod on | off | workers | bench [frames] | <near> <mid> <far>.",
+		[this](std::vector<std::string>& args) {
+			if (args.size() > 1 && Zeal::String::compare_insensitive(args[1], "on"))
+				lod_enabled.set(true);
+			else if (args.size() > 1 && Zeal::String::compare_insensitive(args[1], "off"))
+				lod_enabled.set(false);
+			else if (args.size() > 1 && Zeal::String::compare_insensitive(args[1], "workers"))
+			{
+				workers_enabled.set(!workers_enabled.get());
+				Zeal::EqGame::print_chat("Physics worker pre-pass is %s (experimental)", workers_enabled.get() ? "on" : "off");
+				return true;
+			}
+			else if (args.size() > 1 && Zeal::String::compare_insensitive(args[1], "bench"))
+			{
+				int frames = 1200;
+				if (args.size() > 2)
+					Zeal::String::tryParse(args[2], &frames);
+				if (!lod_enabled.get())
+				{
+					Zeal::EqGame::print_chat("The bench compares the pre-pass against plain lod, turn it on with /physicslod on");
+					return true;
+				}
+				bench_frames = frames < 120 ? 120 : frames;
+				bench_left = bench_frames;
+				bench_ms[0] = bench_ms[1] = 0;
+				bench_pass_ms = 0;
+				bench_actors = 0;
+				bench_last = 0;
+				Zeal::EqGame::print_chat("Timing %d frames without and %d with the physics pre-pass, stay put in a busy spot", bench_frames / 2, bench_frames / 2);
+				return true;
+			}
+			else if (args.size() > 3)
+			{
+				float near_dist = 0, mid_dist = 0, far_dist = 0;
+				if (!Zeal::String::tryParse(args[1], &near_dist) || !Zeal::String::tryParse(args[2], &mid_dist) || !Zeal::String::tryParse(args[3], &far_dist)
+					|| near_dist <= 0 || mid_dist < near_dist || far_dist < mid_dist)
+				{
+					Zeal::EqGame::print_chat("usage: /physicslod <near> <mid> <far>, increasing distances");
+					return true;
+				}
+				lod_near.set(near_dist);
+				lod_mid.set(mid_dist);
+				lod_far.set(far_dist);
+			}
+			Zeal::EqGame::print_chat("Physics lod is %s, full rate to %.0f, 33ms to %.0f, 66ms to %.0f, 132ms beyond", lod_enabled.get() ? "on" : "off",
+				lod_near.get(), lod_mid.get(), lod_far.get());
+			return true;
+		});
 
-	zeal->hooks->Add("ProcessPhysics", 0x54D964, ProcessPhysics, hook_type_detour);
-	zeal->hooks->Add("MovePlayer", 0x504765, MovePlayer, hook_type_detour);
+	zeal->hooks->Add<ProcessPhysics>("ProcessPhysics", 0x54D964, hook_type_detour);
+	zeal->hooks->Add<MovePlayer>("MovePlayer", 0x504765, hook_type_detour);
 	//zeal->hooks->Add("GetTime", 0x54dbad, GetTime, hook_type_replace_call);
 }
 
 Physics::~Physics()
 {
+	if (pool && jobs_in_flight)
+		pool->wait();
 }
\ No newline at end of file
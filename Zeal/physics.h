@@ -4,15 +4,77 @@
 #include <stdint.h>
 #include "EqStructures.h"
 #include "EqUI.h"
+#include "settings.h"
+#include "worker_pool.h"
+#include "entity_manager.h"
+#include <array>
+#include <bitset>
+#include <memory>
 class Physics
 {
 public:
 	Physics(class ZealService* zeal, class IO_ini* ini);
 	~Physics();
-	bool can_move(short spawn_id);
+	bool can_move(Zeal::EqStructures::Entity* ent);
+	void begin_step(Zeal::EqStructures::Entity* ent);
+	void end_step(Zeal::EqStructures::Entity* ent);
+	UINT interval(Zeal::EqStructures::Entity* ent); //ms between physics steps for this actor
+	// level of detail: full rate for self, target, pets, group and anything inside the near band
+	// 33/66ms past the near/mid bands, 132ms past the far band or outside the engine's visible set
+	Setting<bool> lod_enabled{ "Zeal", "PhysicsLod", false };
+	Setting<float> lod_near{ "Zeal", "PhysicsLodNear", 150.f };
+	Setting<float> lod_mid{ "Zeal", "PhysicsLodMid", 300.f };
+	Setting<float> lod_far{ "Zeal", "PhysicsLodFar", 600.f };
+	// experimental: between their slow steps decimated actors glide along their last measured motion, extrapolated on worker threads
+	// the positions are computed while the main loop runs and applied before render, no world collision
+	Setting<bool> workers_enabled{ "Zeal", "PhysicsWorkers", false };
 private:
+	static constexpr UINT tier_ms[] = { 16, 33, 66, 132 };
+	BYTE tier_for(Zeal::EqStructures::Entity* ent);
+	void update_frame();
 	bool did_physics = false;
 	ULONGLONG last_physic_calc = 0;
-	std::unordered_map<short, UINT> move_timers;
-};
+	UINT frame_time = 0; //eq time read once per main loop, 0 until the first one
+	std::unique_ptr<std::array<UINT, 0x10000>> move_timers; //last move time by spawn id, 0 when unseen
+	std::unique_ptr<std::array<BYTE, 0x10000>> move_tiers; //tier of the last move
+	bool lod_active = false; //enabled and in game this frame
+	Vec3 self_pos;
+	std::bitset<0x10000> relevant; //always full rate
 
+	struct glide
+	{
+		EntityHandle actor;
+		Vec3 anchor; //position after the last real step
+		Vec3 velocity; //units per ms between the last two real steps
+		UINT anchor_time;
+		Vec3 written; //last extrapolated position, the actor is left alone once it no longer sits there
+		bool active;
+	};
+	struct glide_job
+	{
+		USHORT slot; //glides index
+		UINT anchor_time;
+		Vec3 from;
+		Vec3 velocity;
+		float ms;
+		Vec3 result;
+	};
+	static void extrapolate(glide_job* batch, size_t begin, size_t end);
+	void queue_glides();
+	void apply_glides();
+	void reset_glides();
+	void tick_bench();
+	bool gliding = false; //glides are tracked and applied this frame
+	std::unique_ptr<std::array<USHORT, 0x10000>> glide_slot; //spawn id -> glides index + 1, 0 when untracked
+	std::vector<glide> glides;
+	std::vector<glide_job> jobs; //owned by the workers while in flight
+	bool jobs_in_flight = false;
+	std::unique_ptr<WorkerPool> pool;
+	// frame time with and without the pre-pass, see /physicslod bench
+	int bench_frames = 0;
+	int bench_left = 0; //frames to go, the first half without
+	double bench_ms[2] = { 0, 0 };
+	double bench_pass_ms = 0; //queue and apply on the game thread
+	size_t bench_actors = 0;
+	LONGLONG bench_last = 0;
+};
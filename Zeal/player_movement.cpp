@@ -57,13 +57,7 @@ void PlayerMovement::handle_movement_binds(int cmd, bool key_down)
 				}
 			}
 
-			switch (Zeal::EqGame::get_controlled()->StandingState)
-			{
-				case Zeal::EqEnums::Stance::Sitting:
-					Zeal::EqGame::get_controlled()->ChangeStance(Stance::Stand);
-					break;
-				default: { return; }
-			}
+			stand_controlled = true; //stands at the next frame if still sitting
 		}
 	}
 }
@@ -96,21 +90,17 @@ void PlayerMovement::handle_spellcast_binds(int cmd)
 			}
 		}
 
-		// not in a window, handle things normally
-		switch (Zeal::EqGame::get_self()->StandingState)
-		{
-			case Zeal::EqEnums::Stance::Sitting:
-				Zeal::EqGame::get_self()->ChangeStance(Stance::Stand);
-				break;
-			default: { return; }
-		}
+		// not in a window, stand now: the game runs the cast as soon as this bind returns, a sitting cast fails
+		Zeal::EqStructures::Entity* self = Zeal::EqGame::get_self();
+		if (self && self->StandingState == Stance::Sit)
+			self->ChangeStance(Stance::Stand);
 	}
 }
 
-void PlayerMovement::set_strafe(strafe_direction dir)
+void PlayerMovement::set_strafe(strafe_direction dir, bool can_move)
 {
 	//slightly revised so the game properly sets speed based on encumber and handles the stance checks
-	if (dir == strafe_direction::None || !Zeal::EqGame::can_move())
+	if (dir == strafe_direction::None || !can_move)
 	{
 		current_strafe = strafe_direction::None;
 		*Zeal::EqGame::strafe_direction = 0;
@@ -139,31 +129,65 @@ void PlayerMovement::set_strafe(strafe_direction dir)
 	}
 }
 
+void PlayerMovement::take_snapshot(movement_snapshot& state)
+{
+	state.self = Zeal::EqGame::get_self();
+	state.controlled = Zeal::EqGame::get_controlled();
+	if (!state.controlled)
+	{
+		state = movement_snapshot{ state.self };
+		return;
+	}
+	state.controlled_stance = state.controlled->StandingState;
+	state.can_move = Zeal::EqGame::can_move();
+	state.sneaking = state.controlled->IsSneaking != 0;
+	Zeal::EqStructures::ActorInfo* actor = state.controlled->ActorInfo;
+	state.speed_modifier = actor ? actor->MovementSpeedModifier : 0;
+	state.strafe_reduced = actor && actor->Unsure_Strafe_Calc != 0;
+	state.encumbrance = Zeal::EqGame::encum_factor();
+}
+
+float PlayerMovement::strafe_speed(const movement_snapshot& state)
+{
+	if (state.controlled_stance != Stance::Duck && state.controlled_stance != Stance::Stand)
+		return 0;
+	if (state.speed_modifier < -1000.0f) //rooted
+		return 0;
+	float speed = state.encumbrance + state.encumbrance;
+	if (state.sneaking || state.controlled_stance == Stance::Duck)
+		speed *= .5f;
+	if (state.speed_modifier < 0)
+		speed *= .5f;
+	if (state.strafe_reduced)
+		speed *= .25f;
+	return speed;
+}
+
 void PlayerMovement::callback_main()
 {
-	if (current_strafe != strafe_direction::None)
+	if (!stand_controlled && !strafe_pending && current_strafe == strafe_direction::None)
+		return;
+	movement_snapshot state;
+	take_snapshot(state);
+	if (stand_controlled && state.controlled && state.controlled_stance == Stance::Sit)
 	{
-		Zeal::EqStructures::Entity* controlled_player = Zeal::EqGame::get_controlled();
-		float encumberance = Zeal::EqGame::encum_factor();
-		*Zeal::EqGame::strafe_speed = encumberance + encumberance;
-		if (controlled_player->IsSneaking || controlled_player->StandingState == Stance::Duck)
-			*Zeal::EqGame::strafe_speed *= .5f;
-		if (controlled_player->ActorInfo && controlled_player->ActorInfo->MovementSpeedModifier < 0)
-			*Zeal::EqGame::strafe_speed *= .5f;
-		if (controlled_player->ActorInfo && controlled_player->ActorInfo->Unsure_Strafe_Calc != 0)
-			*Zeal::EqGame::strafe_speed *= .25f;
-		if (controlled_player->ActorInfo && controlled_player->ActorInfo->MovementSpeedModifier < -1000.0f)
-		{
-			*Zeal::EqGame::strafe_direction = 0;
-			*Zeal::EqGame::strafe_speed = 0;
-		}
-		if (controlled_player->StandingState != Stance::Duck && controlled_player->StandingState != Stance::Stand)
-		{
+		state.controlled->ChangeStance(Stance::Stand);
+		take_snapshot(state); //standing changes what strafing may do this frame
+	}
+	stand_controlled = false;
+	if (strafe_pending)
+	{
+		strafe_pending = false;
+		set_strafe(strafe_intent, state.can_move);
+	}
+	if (current_strafe != strafe_direction::None && state.controlled)
+	{
+		*Zeal::EqGame::strafe_speed = strafe_speed(state);
+		if (*Zeal::EqGame::strafe_speed == 0)
 			*Zeal::EqGame::strafe_direction = 0;
-			*Zeal::EqGame::strafe_speed = 0;
-		}
 	}
 }
+
 void PlayerMovement::set_spellbook_autostand(bool enabled)
 {
 	spellbook_autostand = true;
@@ -189,29 +213,34 @@ PlayerMovement::PlayerMovement(ZealService* zeal, class Binds* binds, class IO_i
 {
 	ini_handle = ini;
 	load_settings();
+	zeal->config_watch->on_reload([this]() { load_settings(); });
 
 	// ISSUE: Mapping LEFT/RIGHT arrow keys to strafe on TAKP2.1 client fails to function.
 	binds->replace_cmd(211, [this](int state) {
-		if (!state && current_strafe == strafe_direction::Left)
+		if (!state && (strafe_pending ? strafe_intent : current_strafe) == strafe_direction::Left)
 		{
-			set_strafe(strafe_direction::None);
+			strafe_intent = strafe_direction::None;
+			strafe_pending = true;
 		}
 		else if (state)
 		{
 			handle_movement_binds(211, state);
-			set_strafe(strafe_direction::Left);
+			strafe_intent = strafe_direction::Left;
+			strafe_pending = true;
 		}
 		return false;
 	}); // strafe left
 	binds->replace_cmd(212, [this](int state) {
-		if (!state && current_strafe == strafe_direction::Right)
+		if (!state && (strafe_pending ? strafe_intent : current_strafe) == strafe_direction::Right)
 		{
-			set_strafe(strafe_direction::None);
+			strafe_intent = strafe_direction::None;
+			strafe_pending = true;
 		}
 		else if (state)
 		{
 			handle_movement_binds(212, state);
-			set_strafe(strafe_direction::Right);
+			strafe_intent = strafe_direction::Right;
+			strafe_pending = true;
 		}
 		return false;
 	}); // strafe right
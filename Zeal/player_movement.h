@@ -1,6 +1,7 @@
 #pragma once
 #include "hook_wrapper.h"
 #include "memory.h"
+#include "EqStructures.h"
 
 enum strafe_direction
 {
@@ -9,9 +10,24 @@ enum strafe_direction
 	Right
 };
 
+// self state read once per frame, the movement bind handlers only record intents and callback_main applies them against
+// this. the spell gem binds stand at once instead, the game casts right after the bind returns
+struct movement_snapshot
+{
+	Zeal::EqStructures::Entity* self = nullptr;
+	Zeal::EqStructures::Entity* controlled = nullptr;
+	BYTE controlled_stance = 0;
+	bool can_move = false;
+	bool sneaking = false;
+	float speed_modifier = 0; //ActorInfo->MovementSpeedModifier, negative when snared
+	bool strafe_reduced = false; //ActorInfo->Unsure_Strafe_Calc set
+	float encumbrance = 1.f;
+};
+
 class PlayerMovement
 {
 public:
+	static float strafe_speed(const movement_snapshot& state); //0 stops strafing
 	void handle_movement_binds(int cmd, bool key_down);
 	void handle_spellcast_binds(int cmd);
 	void set_spellbook_autostand(bool enabled);
@@ -19,8 +35,12 @@ public:
 	PlayerMovement(class ZealService* zeal, class Binds* binds, class IO_ini* ini);
 	~PlayerMovement() {};
 private:
-	void set_strafe(strafe_direction dir);
+	void set_strafe(strafe_direction dir, bool can_move);
+	void take_snapshot(movement_snapshot& state);
 	void callback_main();
+	bool stand_controlled = false; //movement bind while sitting
+	bool strafe_pending = false;
+	strafe_direction strafe_intent = strafe_direction::None;
 	void load_settings();
 	strafe_direction current_strafe = strafe_direction::None;
 	BYTE orig_reset_strafe[7] = { 0 };
@@ -0,0 +1,279 @@
+#include "plugin_host.h"
+#include "Zeal.h"
+#include "EqFunctions.h"
+#include <algorithm>
+
+namespace
+{
+	constexpr callback_type event_types[ZEAL_EVENT_COUNT] = {
+		callback_type::MainLoop,
+		callback_type::Zone,
+		callback_type::CleanUI,
+		callback_type::Render,
+		callback_type::CharacterSelect,
+		callback_type::InitUI,
+		callback_type::EndMainLoop,
+		callback_type::RenderUI,
+		callback_type::EndScene,
+		callback_type::DeviceReset,
+	};
+	std::vector<UINT> event_handles; //the generic callbacks plugins own, set_event_active only switches these
+	UINT next_handle = 1; //packets, keys and commands, they can't be removed so the handle only reports success
+
+	void copy_text(char* out, size_t capacity, const char* text)
+	{
+		if (!capacity)
+			return;
+		size_t length = text ? strnlen(text, capacity - 1) : 0;
+		if (length)
+			memcpy(out, text, length);
+		out[length] = '\0';
+	}
+
+	uint32_t ZEAL_CALL add_event(zeal_event event, zeal_event_fn fn, void* context)
+	{
+		if (!fn || event < 0 || event >= ZEAL_EVENT_COUNT)
+			return 0;
+		UINT handle = ZealService::get_instance()->callbacks->add_generic([fn, context]() { fn(context); }, event_types[event]);
+		event_handles.push_back(handle);
+		return handle;
+	}
+
+	void ZEAL_CALL set_event_active(uint32_t handle, int active)
+	{
+		if (std::find(event_handles.begin(), event_handles.end(), handle) != event_handles.end())
+			ZealService::get_instance()->callbacks->set_active(handle, active != 0);
+	}
+
+	uint32_t ZEAL_CALL add_packet(zeal_packet_direction direction, zeal_packet_fn fn, void* context)
+	{
+		if (!fn || (direction != ZEAL_PACKET_RECEIVED && direction != ZEAL_PACKET_SENT))
+			return 0;
+		ZealService::get_instance()->callbacks->add_packet([fn, context](UINT opcode, char* buffer, UINT len) { return fn(context, opcode, buffer, len) != 0; },
+			direction == ZEAL_PACKET_RECEIVED ? callback_type::WorldMessage : callback_type::SendMessage_);
+		return next_handle++;
+	}
+
+	uint32_t ZEAL_CALL add_key(zeal_key_fn fn, void* context)
+	{
+		if (!fn)
+			return 0;
+		ZealService::get_instance()->callbacks->add_command([fn, context](UINT command, BOOL down) { return fn(context, command, down) != 0; });
+		return next_handle++;
+	}
+
+	uint32_t ZEAL_CALL add_command(const char* name, const char* help, zeal_command_fn fn, void* context)
+	{
+		if (!fn || !name || name[0] != '/' || !name[1])
+			return 0;
+		ZealService::get_instance()->commands_hook->add(name, {}, help ? help : "", [fn, context](std::vector<std::string>& args) {
+			std::vector<const char*> argv;
+			argv.reserve(args.size());
+			for (const std::string& arg : args)
+				argv.push_back(arg.c_str());
+			return fn(context, static_cast<int>(argv.size()), argv.data()) != 0;
+		});
+		return next_handle++;
+	}
+
+	int ZEAL_CALL get_entity(uint16_t spawn_id, zeal_entity* out)
+	{
+		ZealService* zeal = ZealService::get_instance();
+		Zeal::EqStructures::Entity* ent = out && spawn_id ? zeal->entity_manager->get(spawn_id) : nullptr;
+		if (!ent)
+			return 0;
+		out->spawn_id = ent->SpawnId;
+		out->owner_id = ent->PetOwnerSpawnId;
+		out->type = ent->Type;
+		out->class_id = ent->Class;
+		out->level = ent->Level;
+		out->reserved = 0;
+		out->race = ent->Race;
+		out->hp_current = ent->HpCurrent;
+		out->hp_max = ent->HpMax;
+		out->x = ent->Position.x;
+		out->y = ent->Position.y;
+		out->z = ent->Position.z;
+		out->heading = ent->Heading;
+		copy_text(out->name, sizeof(out->name), ent->Name);
+		return 1;
+	}
+
+	uint16_t ZEAL_CALL self_id()
+	{
+		Zeal::EqStructures::Entity* self = Zeal::EqGame::is_in_game() ? Zeal::EqGame::get_self() : nullptr;
+		return self ? self->SpawnId : 0;
+	}
+
+	uint16_t ZEAL_CALL target_id()
+	{
+		Zeal::EqStructures::Entity* target = Zeal::EqGame::is_in_game() ? Zeal::EqGame::get_target() : nullptr;
+		return target ? target->SpawnId : 0;
+	}
+
+	size_t ZEAL_CALL query_radius(float x, float y, float z, float radius, uint16_t* spawn_ids, size_t capacity)
+	{
+		if (!Zeal::EqGame::is_in_game())
+			return 0;
+		static std::vector<Zeal::EqStructures::Entity*> found; //game thread only, keeps its capacity between calls
+		found.clear();
+		ZealService::get_instance()->entity_manager->query_radius(Vec3(x, y, z), radius, found);
+		for (size_t i = 0; i < found.size() && i < capacity; i++)
+			spawn_ids[i] = found[i]->SpawnId;
+		return found.size();
+	}
+
+	int ZEAL_CALL get_spell(int spell_id, zeal_spell* out)
+	{
+		Zeal::EqStructures::SPELL* spell = out ? ZealService::get_instance()->spell_index->get(spell_id) : nullptr;
+		if (!spell)
+			return 0;
+		out->id = spell->ID;
+		out->cast_ms = spell->CastTime;
+		out->recast_ms = spell->RecastTime;
+		out->mana = spell->Mana;
+		out->range = spell->Range;
+		out->target_type = spell->TargetType;
+		out->resist = spell->Resist;
+		out->beneficial = spell->SpellType != 0;
+		out->reserved = 0;
+		memset(out->level, 255, sizeof(out->level));
+		memcpy(out->level, spell->Level, sizeof(spell->Level));
+		copy_text(out->name, sizeof(out->name), spell->Name);
+		return 1;
+	}
+
+	int ZEAL_CALL find_spell(const char* name)
+	{
+		return name ? ZealService::get_instance()->spell_index->find(name) : -1;
+	}
+
+	size_t ZEAL_CALL get_label(int label_type, char* text, size_t capacity)
+	{
+		const label_value* value = ZealService::get_instance()->labels_hook->get_cached(label_type);
+		if (!value || !value->cached || !value->write_text)
+			return 0;
+		copy_text(text, capacity, value->text.c_str());
+		return value->text.length();
+	}
+
+	void ZEAL_CALL print_chat(int color, const char* text)
+	{
+		if (text && Zeal::EqGame::is_in_game())
+			Zeal::EqGame::print_chat(static_cast<short>(color ? color : USERCOLOR_DEFAULT), "%s", text);
+	}
+
+	void ZEAL_CALL log(int level, const char* text)
+	{
+		if (!text)
+			return;
+		switch (level)
+		{
+		case 0: ZEAL_LOG_DEBUG("plugin", "%s", text); break;
+		case 1: ZEAL_LOG_INFO("plugin", "%s", text); break;
+		case 2: ZEAL_LOG_WARN("plugin", "%s", text); break;
+		default: ZEAL_LOG_ERROR("plugin", "%s", text); break;
+		}
+	}
+
+	const zeal_api host_api = {
+		sizeof(zeal_api),
+		ZEAL_PLUGIN_ABI,
+		ZEAL_VERSION,
+		add_event,
+		set_event_active,
+		add_packet,
+		add_key,
+		add_command,
+		get_entity,
+		self_id,
+		target_id,
+		query_radius,
+		get_spell,
+		find_spell,
+		get_label,
+		print_chat,
+		log,
+	};
+}
+
+const zeal_api& PluginHost::api()
+{
+	return host_api;
+}
+
+PluginHost::PluginHost(ZealService* zeal, const std::string& folder)
+{
+	WIN32_FIND_DATAA found;
+	HANDLE search = FindFirstFileA((folder + "\\*.dll").c_str(), &found);
+	if (search != INVALID_HANDLE_VALUE)
+	{
+		do
+		{
+			if (!(found.dwFileAttributes & FILE_ATTRIBUTE_DIRECTORY))
+				load(folder + "\\" + found.cFileName);
+		} while (FindNextFileA(search, &found));
+		FindClose(search);
+	}
+	zeal->commands_hook->add("/zealplugins", {}, "Lists the plugins loaded from zeal_plugins.",
+		[this](std::vector<std::string>& args) {
+			list();
+			return true;
+		});
+}
+
+PluginHost::~PluginHost()
+{
+	if (Shutdown::process_exiting()) //the loader tears the dlls down itself
+		return;
+	for (auto it = plugins.rbegin(); it != plugins.rend(); ++it)
+	{
+		if (it->unload)
+			it->unload();
+		FreeLibrary(it->module);
+	}
+}
+
+void PluginHost::load(const std::string& path)
+{
+	HMODULE module = LoadLibraryA(path.c_str());
+	if (!module)
+	{
+		ZEAL_LOG_WARN("plugin", "loading %s failed, error %u", path, GetLastError());
+		return;
+	}
+	zeal_plugin_load_fn load_fn = reinterpret_cast<zeal_plugin_load_fn>(GetProcAddress(module, "zeal_plugin_load"));
+	if (!load_fn)
+	{
+		ZEAL_LOG_WARN("plugin", "%s doesn't export zeal_plugin_load", path);
+		FreeLibrary(module);
+		return;
+	}
+	plugin p = { module, {}, reinterpret_cast<zeal_plugin_unload_fn>(GetProcAddress(module, "zeal_plugin_unload")) };
+	p.info.size = sizeof(p.info);
+	p.info.abi = ZEAL_PLUGIN_ABI;
+	int result = load_fn(&host_api, &p.info);
+	if (result || p.info.abi > ZEAL_PLUGIN_ABI)
+	{
+		// whatever it registered before refusing stays in the dispatch lists, so the dll has to stay loaded
+		ZEAL_LOG_WARN("plugin", "%s refused to load (%d, abi %u, zeal has %u)", path, result, p.info.abi, ZEAL_PLUGIN_ABI);
+		return;
+	}
+	p.info.name[sizeof(p.info.name) - 1] = '\0';
+	p.info.version[sizeof(p.info.version) - 1] = '\0';
+	if (!p.info.name[0])
+		copy_text(p.info.name, sizeof(p.info.name), path.substr(path.find_last_of('\\') + 1).c_str());
+	ZEAL_LOG_INFO("plugin", "loaded %s %s from %s", p.info.name, p.info.version, path);
+	plugins.push_back(p);
+}
+
+void PluginHost::list()
+{
+	if (plugins.empty())
+	{
+		Zeal::EqGame::print_chat("No plugins loaded, zeal looks for dlls in zeal_plugins");
+		return;
+	}
+	for (const plugin& p : plugins)
+		Zeal::EqGame::print_chat("%s %s (abi %u)", p.info.name, p.info.version, p.info.abi);
+}
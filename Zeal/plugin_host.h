@@ -0,0 +1,25 @@
+#pragma once
+#include <Windows.h>
+#include <string>
+#include <vector>
+#include "zeal_plugin.h"
+
+// loads the dlls in zeal_plugins\ at startup and hands each one the zeal_api from zeal_plugin.h. a plugin's callbacks
+// are ordinary entries in zeal's dispatch lists, so it adds no detours of its own and pays only for the events it asks for
+class PluginHost
+{
+public:
+	PluginHost(class ZealService* zeal, const std::string& folder);
+	~PluginHost(); //after the hooks are gone, nothing can call into a plugin any more
+	static const zeal_api& api();
+private:
+	struct plugin
+	{
+		HMODULE module;
+		zeal_plugin_info info;
+		zeal_plugin_unload_fn unload;
+	};
+	void load(const std::string& path);
+	void list();
+	std::vector<plugin> plugins;
+};
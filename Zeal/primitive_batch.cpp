@@ -0,0 +1,214 @@
+#include "primitive_batch.h"
+#include "Zeal.h"
+#include "camera_math.h"
+#include <cmath>
+
+static constexpr UINT buffer_vertices = 16384; //ring buffer size, a frame that needs more draws in several chunks
+static constexpr DWORD vertex_fvf = D3DFVF_XYZ | D3DFVF_DIFFUSE;
+static constexpr DWORD screen_fvf = D3DFVF_XYZRHW | D3DFVF_DIFFUSE;
+
+static void set_draw_states(render_state_cache& states)
+{
+    states.set_render_state(D3DRS_CULLMODE, D3DCULL_NONE);
+    states.set_render_state(D3DRS_ALPHABLENDENABLE, TRUE);
+    states.set_render_state(D3DRS_SRCBLEND, D3DBLEND_SRCALPHA);
+    states.set_render_state(D3DRS_DESTBLEND, D3DBLEND_INVSRCALPHA);
+    states.set_render_state(D3DRS_ZENABLE, TRUE);
+    states.set_render_state(D3DRS_ZWRITEENABLE, FALSE); //translucent overlays shouldn't hide each other
+    states.set_render_state(D3DRS_LIGHTING, FALSE);
+    // colors come from the vertices, nothing is textured
+    states.set_texture_stage_state(0, D3DTSS_COLOROP, D3DTOP_SELECTARG1);
+    states.set_texture_stage_state(0, D3DTSS_COLORARG1, D3DTA_DIFFUSE);
+    states.set_texture_stage_state(0, D3DTSS_ALPHAOP, D3DTOP_SELECTARG1);
+    states.set_texture_stage_state(0, D3DTSS_ALPHAARG1, D3DTA_DIFFUSE);
+    states.set_texture(nullptr);
+    states.set_vertex_shader(vertex_fvf);
+}
+
+void PrimitiveBatch::line(const Vec3& a, const Vec3& b, D3DCOLOR color)
+{
+    lines.push_back({ a.x, a.y, a.z, color });
+    lines.push_back({ b.x, b.y, b.z, color });
+}
+
+void PrimitiveBatch::triangle(const Vec3& a, const Vec3& b, const Vec3& c, D3DCOLOR color)
+{
+    triangles.push_back({ a.x, a.y, a.z, color });
+    triangles.push_back({ b.x, b.y, b.z, color });
+    triangles.push_back({ c.x, c.y, c.z, color });
+}
+
+void PrimitiveBatch::circle(const Vec3& center, float radius, D3DCOLOR color, int segments)
+{
+    if (segments < 3)
+        return;
+    float step = static_cast<float>(camera_math::heading_units) / segments;
+    Vec3 last = { center.x + radius, center.y, center.z };
+    for (int i = 1; i <= segments; ++i)
+    {
+        Vec3 next = { center.x + radius * camera_math::heading_cos(i * step), center.y + radius * camera_math::heading_sin(i * step), center.z };
+        line(last, next, color);
+        last = next;
+    }
+}
+
+void PrimitiveBatch::ring(const Vec3& center, float outer, float inner, D3DCOLOR color, int segments)
+{
+    if (segments < 3)
+        return;
+    float step = static_cast<float>(camera_math::heading_units) / segments;
+    float c0 = 1.f, s0 = 0.f;
+    for (int i = 1; i <= segments; ++i)
+    {
+        float c1 = camera_math::heading_cos(i * step), s1 = camera_math::heading_sin(i * step);
+        Vec3 o0 = { center.x + outer * c0, center.y + outer * s0, center.z };
+        Vec3 o1 = { center.x + outer * c1, center.y + outer * s1, center.z };
+        if (inner <= 0.f)
+        {
+            triangle(center, o0, o1, color);
+        }
+        else
+        {
+            Vec3 i0 = { center.x + inner * c0, center.y + inner * s0, center.z };
+            Vec3 i1 = { center.x + inner * c1, center.y + inner * s1, center.z };
+            triangle(i0, o0, o1, color);
+            triangle(i0, o1, i1, color);
+        }
+        c0 = c1;
+        s0 = s1;
+    }
+}
+
+void PrimitiveBatch::quad(const Vec3& a, const Vec3& b, const Vec3& c, const Vec3& d, D3DCOLOR color)
+{
+    triangle(a, b, c, color);
+    triangle(a, c, d, color);
+}
+
+void PrimitiveBatch::billboard(const Vec3& center, float size, D3DCOLOR color)
+{
+    directx* dx = ZealService::get_instance()->dx.get();
+    if (!dx)
+        return;
+    const frame_state& fs = dx->get_frame_state();
+    if (!fs.valid)
+        return;
+    // camera right and up are the first two columns of the view matrix
+    float h = size * 0.5f;
+    Vec3 right = { fs.view._11 * h, fs.view._21 * h, fs.view._31 * h };
+    Vec3 up = { fs.view._12 * h, fs.view._22 * h, fs.view._32 * h };
+    quad({ center.x - right.x - up.x, center.y - right.y - up.y, center.z - right.z - up.z },
+        { center.x + right.x - up.x, center.y + right.y - up.y, center.z + right.z - up.z },
+        { center.x + right.x + up.x, center.y + right.y + up.y, center.z + right.z + up.z },
+        { center.x - right.x + up.x, center.y - right.y + up.y, center.z - right.z + up.z }, color);
+}
+
+void PrimitiveBatch::screen_line(float x0, float y0, float x1, float y1, D3DCOLOR color)
+{
+    screen_segments.push_back({ x0, y0, 0.f, 1.f, color });
+    screen_segments.push_back({ x1, y1, 0.f, 1.f, color });
+}
+
+void PrimitiveBatch::screen_rect(float left, float top, float right, float bottom, D3DCOLOR color)
+{
+    screen_vertex quad[6] = {
+        { left, top, 0.f, 1.f, color },
+        { right, top, 0.f, 1.f, color },
+        { left, bottom, 0.f, 1.f, color },
+        { right, top, 0.f, 1.f, color },
+        { right, bottom, 0.f, 1.f, color },
+        { left, bottom, 0.f, 1.f, color },
+    };
+    screen_tris.insert(screen_tris.end(), quad, quad + 6);
+}
+
+bool PrimitiveBatch::create_resources(IDirect3DDevice8* device)
+{
+    if (resource_device == device && buffer)
+        return true;
+    release();
+    if (FAILED(device->CreateVertexBuffer(sizeof(vertex) * buffer_vertices, D3DUSAGE_DYNAMIC | D3DUSAGE_WRITEONLY,
+        vertex_fvf, D3DPOOL_DEFAULT, &buffer)))
+    {
+        buffer = nullptr;
+        return false;
+    }
+    resource_device = device;
+    buffer_offset = buffer_vertices; //first lock discards
+    return true;
+}
+
+void PrimitiveBatch::release()
+{
+    if (buffer)
+        buffer->Release();
+    buffer = nullptr;
+    resource_device = nullptr;
+}
+
+void PrimitiveBatch::flush(IDirect3DDevice8* device)
+{
+    if (triangles.empty() && lines.empty() && screen_tris.empty() && screen_segments.empty())
+        return;
+    if (!device || !create_resources(device))
+    {
+        triangles.clear();
+        lines.clear();
+        screen_tris.clear();
+        screen_segments.clear();
+        return;
+    }
+    D3DXMATRIX identity;
+    D3DXMatrixIdentity(&identity);
+    render_state_cache& states = ZealService::get_instance()->dx->states;
+    states.begin(device);
+    set_draw_states(states);
+    states.set_world(identity);
+    states.set_stream_source(buffer, sizeof(vertex));
+    struct pass
+    {
+        std::vector<vertex>* vertices;
+        D3DPRIMITIVETYPE type;
+        UINT per_primitive;
+    };
+    for (const pass& p : { pass{ &triangles, D3DPT_TRIANGLELIST, 3 }, pass{ &lines, D3DPT_LINELIST, 2 } })
+    {
+        const std::vector<vertex>& v = *p.vertices;
+        size_t done = 0;
+        while (done < v.size())
+        {
+            UINT chunk = static_cast<UINT>(v.size() - done);
+            if (chunk > buffer_vertices)
+                chunk = buffer_vertices - buffer_vertices % p.per_primitive;
+            // append behind what the gpu may still be reading, start over on a fresh buffer once it is full
+            DWORD flags = D3DLOCK_NOOVERWRITE;
+            if (buffer_offset + chunk > buffer_vertices)
+            {
+                flags = D3DLOCK_DISCARD;
+                buffer_offset = 0;
+            }
+            BYTE* data = nullptr;
+            if (FAILED(buffer->Lock(buffer_offset * sizeof(vertex), chunk * sizeof(vertex), &data, flags)))
+                break;
+            memcpy(data, &v[done], chunk * sizeof(vertex));
+            buffer->Unlock();
+            device->DrawPrimitive(p.type, buffer_offset, chunk / p.per_primitive);
+            buffer_offset += chunk;
+            done += chunk;
+        }
+    }
+    if (!screen_tris.empty() || !screen_segments.empty())
+    {
+        states.set_render_state(D3DRS_ZENABLE, FALSE);
+        states.set_vertex_shader(screen_fvf);
+        if (!screen_tris.empty())
+            device->DrawPrimitiveUP(D3DPT_TRIANGLELIST, static_cast<UINT>(screen_tris.size() / 3), screen_tris.data(), sizeof(screen_vertex));
+        if (!screen_segments.empty())
+            device->DrawPrimitiveUP(D3DPT_LINELIST, static_cast<UINT>(screen_segments.size() / 2), screen_segments.data(), sizeof(screen_vertex));
+    }
+    states.restore();
+    triangles.clear();
+    lines.clear();
+    screen_tris.clear();
+    screen_segments.clear();
+}
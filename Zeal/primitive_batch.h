@@ -0,0 +1,44 @@
+#pragma once
+#include <vector>
+#include "vectors.h"
+#include "d3dx8/d3d8.h"
+#include "d3dx8/d3dx8math.h"
+
+// immediate mode world (and screen) space primitives, queued by any RenderUI callback and drawn by flush() right after them:
+// triangles and lines each go out in one DrawPrimitive from a shared dynamic vertex buffer, with the states set once
+class PrimitiveBatch
+{
+public:
+	struct vertex
+	{
+		float x, y, z;
+		D3DCOLOR color;
+	};
+	void line(const Vec3& a, const Vec3& b, D3DCOLOR color);
+	void circle(const Vec3& center, float radius, D3DCOLOR color, int segments = 32); //outline
+	void ring(const Vec3& center, float outer, float inner, D3DCOLOR color, int segments = 32); //flat on the ground, inner 0 for a disc
+	void quad(const Vec3& a, const Vec3& b, const Vec3& c, const Vec3& d, D3DCOLOR color); //corners in order around the edge
+	void billboard(const Vec3& center, float size, D3DCOLOR color); //square facing the camera
+	// screen space in pixels, drawn after the world primitives and on top of them
+	struct screen_vertex
+	{
+		float x, y, z, rhw;
+		D3DCOLOR color;
+	};
+	void screen_line(float x0, float y0, float x1, float y1, D3DCOLOR color);
+	void screen_rect(float left, float top, float right, float bottom, D3DCOLOR color);
+	void screen_triangles(const std::vector<screen_vertex>& v) { screen_tris.insert(screen_tris.end(), v.begin(), v.end()); } //prebuilt lists
+	void screen_lines(const std::vector<screen_vertex>& v) { screen_segments.insert(screen_segments.end(), v.begin(), v.end()); }
+	void flush(IDirect3DDevice8* device);
+	void release(); //before a device reset
+private:
+	bool create_resources(IDirect3DDevice8* device);
+	void triangle(const Vec3& a, const Vec3& b, const Vec3& c, D3DCOLOR color);
+	std::vector<vertex> triangles;
+	std::vector<vertex> lines;
+	std::vector<screen_vertex> screen_tris;
+	std::vector<screen_vertex> screen_segments;
+	IDirect3DDevice8* resource_device = nullptr;
+	IDirect3DVertexBuffer8* buffer = nullptr;
+	UINT buffer_offset = 0; //vertices used since the last DISCARD
+};
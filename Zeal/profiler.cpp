@@ -0,0 +1,271 @@
+#include "profiler.h"
+#include "json.hpp"
+#include <algorithm>
+#include <atomic>
+#include <mutex>
+#include <fstream>
+
+namespace Zeal
+{
+	namespace Profiler
+	{
+		bool enabled = false;
+		bool tracing = false;
+		static LARGE_INTEGER qpc_start = {};
+		static UINT64 tsc_start = 0;
+		static std::recursive_mutex registry_lock; //entries are created from the pipe thread too
+
+		struct trace_event
+		{
+			stats* target;
+			UINT64 begin;
+			UINT64 end;
+		};
+		struct trace_buffer
+		{
+			DWORD thread_id;
+			std::vector<trace_event> events; //sized once, the owning thread is the only writer
+			std::atomic<size_t> count{ 0 };
+			std::atomic<size_t> dropped{ 0 };
+		};
+		static constexpr size_t trace_capacity = 1 << 18; //per thread, a couple of minutes of a busy game thread
+		static std::vector<trace_buffer*> trace_buffers;
+		static UINT64 trace_tsc_start = 0;
+		static LARGE_INTEGER trace_qpc_start = {};
+
+		std::vector<stats*>& all()
+		{
+			static std::vector<stats*> entries;
+			return entries;
+		}
+
+		stats* create(const std::string& name)
+		{
+			std::lock_guard<std::recursive_mutex> guard(registry_lock);
+			for (stats* s : all())
+				if (s->name == name)
+					return s;
+			stats* s = new stats();
+			s->name = name;
+			all().push_back(s);
+			return s;
+		}
+
+		void stats::reset()
+		{
+			calls = 0;
+			cycles = 0;
+			min = ~0ull;
+			max = 0;
+			memset(histogram, 0, sizeof(histogram));
+		}
+
+		UINT64 stats::percentile(double p) const
+		{
+			UINT64 total = 0;
+			for (UINT32 count : histogram)
+				total += count;
+			if (!total)
+				return 0;
+			UINT64 wanted = (UINT64)(total * p);
+			UINT64 seen = 0;
+			for (int i = 0; i < histogram_buckets; ++i)
+			{
+				seen += histogram[i];
+				if (seen > wanted)
+					return (2ull << i) - 1;
+			}
+			return max;
+		}
+
+		void set_enabled(bool on)
+		{
+			if (on && !enabled)
+			{
+				QueryPerformanceCounter(&qpc_start);
+				tsc_start = __rdtsc();
+			}
+			enabled = on;
+		}
+
+		void reset()
+		{
+			std::lock_guard<std::recursive_mutex> guard(registry_lock);
+			for (stats* s : all())
+				s->reset();
+			QueryPerformanceCounter(&qpc_start);
+			tsc_start = __rdtsc();
+		}
+
+		void decay()
+		{
+			std::lock_guard<std::recursive_mutex> guard(registry_lock);
+			for (stats* s : all())
+				for (UINT32& count : s->histogram)
+					count >>= 1;
+		}
+
+		void snapshot(std::vector<std::pair<UINT64, UINT64>>& out)
+		{
+			std::lock_guard<std::recursive_mutex> guard(registry_lock);
+			out.resize(all().size());
+			for (size_t i = 0; i < out.size(); ++i)
+				out[i] = { all()[i]->calls, all()[i]->cycles };
+		}
+
+		double cycles_per_ms()
+		{
+			LARGE_INTEGER now, frequency;
+			QueryPerformanceCounter(&now);
+			QueryPerformanceFrequency(&frequency);
+			double ms = (now.QuadPart - qpc_start.QuadPart) * 1000.0 / frequency.QuadPart;
+			if (ms < 1.0)
+				return 0;
+			return (__rdtsc() - tsc_start) / ms;
+		}
+
+		static std::vector<stats*> heaviest(size_t top)
+		{
+			std::vector<stats*> sorted;
+			for (stats* s : all())
+				if (s->calls)
+					sorted.push_back(s);
+			std::sort(sorted.begin(), sorted.end(), [](const stats* a, const stats* b) { return a->cycles > b->cycles; });
+			if (sorted.size() > top)
+				sorted.resize(top);
+			return sorted;
+		}
+
+		std::vector<std::string> report(size_t top)
+		{
+			std::lock_guard<std::recursive_mutex> guard(registry_lock);
+			std::vector<std::string> lines;
+			double per_us = cycles_per_ms() / 1000.0;
+			if (per_us <= 0)
+				per_us = 1; //not calibrated yet, the figures below are raw cycles
+			UINT64 grand_total = 0;
+			for (stats* s : all())
+				grand_total += s->cycles;
+			for (stats* s : heaviest(top))
+			{
+				char line[256];
+				snprintf(line, sizeof(line), "%s: %llu calls, avg %.1fus, p99 %.1fus, max %.1fus, total %.2fms (%.1f%%)",
+					s->name.c_str(), s->calls, s->cycles / (double)s->calls / per_us, s->percentile(0.99) / per_us,
+					s->max / per_us, s->cycles / per_us / 1000.0, grand_total ? s->cycles * 100.0 / grand_total : 0.0);
+				lines.push_back(line);
+			}
+			return lines;
+		}
+
+		std::string to_json(size_t top)
+		{
+			std::lock_guard<std::recursive_mutex> guard(registry_lock);
+			nlohmann::json entries = nlohmann::json::array();
+			for (stats* s : heaviest(top))
+			{
+				entries.push_back({ {"name", s->name}, {"calls", s->calls}, {"cycles", s->cycles}, {"min", s->min}, {"max", s->max},
+					{"histogram", std::vector<UINT32>(s->histogram, s->histogram + histogram_buckets)} });
+			}
+			nlohmann::json root = { {"profile", entries}, {"cycles_per_ms", cycles_per_ms()} };
+			return root.dump(-1, ' ', false, nlohmann::json::error_handler_t::replace);
+		}
+
+		void record(stats* target, UINT64 begin, UINT64 end)
+		{
+			thread_local trace_buffer* buffer = nullptr;
+			if (!buffer)
+			{
+				buffer = new trace_buffer();
+				buffer->thread_id = GetCurrentThreadId();
+				buffer->events.resize(trace_capacity);
+				std::lock_guard<std::recursive_mutex> guard(registry_lock);
+				trace_buffers.push_back(buffer);
+			}
+			size_t index = buffer->count.load(std::memory_order_relaxed);
+			if (index >= trace_capacity)
+			{
+				buffer->dropped.fetch_add(1, std::memory_order_relaxed);
+				return;
+			}
+			buffer->events[index] = { target, begin, end };
+			buffer->count.store(index + 1, std::memory_order_release);
+		}
+
+		void start_trace()
+		{
+			std::lock_guard<std::recursive_mutex> guard(registry_lock);
+			tracing = false;
+			for (trace_buffer* buffer : trace_buffers)
+			{
+				buffer->count.store(0, std::memory_order_relaxed);
+				buffer->dropped.store(0, std::memory_order_relaxed);
+			}
+			QueryPerformanceCounter(&trace_qpc_start);
+			trace_tsc_start = __rdtsc();
+			tracing = true;
+		}
+
+		static void append_escaped(std::string& out, const std::string& text)
+		{
+			for (char c : text)
+			{
+				if (c == '"' || c == '\\')
+					out += '\\';
+				if ((unsigned char)c >= 0x20)
+					out += c;
+			}
+		}
+
+		std::string stop_trace()
+		{
+			if (!tracing)
+				return "";
+			tracing = false;
+			LARGE_INTEGER now, frequency;
+			QueryPerformanceCounter(&now);
+			QueryPerformanceFrequency(&frequency);
+			double elapsed_us = (now.QuadPart - trace_qpc_start.QuadPart) * 1000000.0 / frequency.QuadPart;
+			double cycles_per_us = elapsed_us > 0 ? (__rdtsc() - trace_tsc_start) / elapsed_us : 1.0;
+			if (cycles_per_us <= 0)
+				cycles_per_us = 1.0;
+
+			SYSTEMTIME time;
+			GetLocalTime(&time);
+			char filename[64];
+			snprintf(filename, sizeof(filename), "zeal_trace_%04d%02d%02d_%02d%02d%02d.json", time.wYear, time.wMonth, time.wDay, time.wHour, time.wMinute, time.wSecond);
+			std::ofstream file(filename, std::ios::binary);
+			if (!file.is_open())
+				return "";
+
+			std::lock_guard<std::recursive_mutex> guard(registry_lock);
+			DWORD pid = GetCurrentProcessId();
+			std::string out = "{\"displayTimeUnit\":\"ms\",\"traceEvents\":[";
+			bool first = true;
+			char numbers[128];
+			for (trace_buffer* buffer : trace_buffers)
+			{
+				size_t count = buffer->count.load(std::memory_order_acquire);
+				for (size_t i = 0; i < count; ++i)
+				{
+					const trace_event& e = buffer->events[i];
+					if (e.begin < trace_tsc_start)
+						continue;
+					out += first ? "{\"name\":\"" : ",\n{\"name\":\"";
+					first = false;
+					append_escaped(out, e.target->name);
+					snprintf(numbers, sizeof(numbers), "\",\"ph\":\"X\",\"ts\":%.3f,\"dur\":%.3f,\"pid\":%u,\"tid\":%u}",
+						(e.begin - trace_tsc_start) / cycles_per_us, (e.end - e.begin) / cycles_per_us, (UINT)pid, (UINT)buffer->thread_id);
+					out += numbers;
+					if (out.size() > (1 << 20))
+					{
+						file.write(out.data(), out.size());
+						out.clear();
+					}
+				}
+			}
+			out += "]}";
+			file.write(out.data(), out.size());
+			return file.good() ? filename : "";
+		}
+	}
+}
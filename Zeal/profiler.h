@@ -0,0 +1,93 @@
+#pragma once
+#include <Windows.h>
+#include <intrin.h>
+#include <string>
+#include <vector>
+
+// 0 compiles the hook and callback timing out, the detours are then installed without the wrapper
+#ifndef ZEAL_PROFILER
+#define ZEAL_PROFILER 1
+#endif
+
+// call count and rdtsc cycles for one hook detour or registered callback, timings are inclusive of anything nested
+namespace Zeal
+{
+	namespace Profiler
+	{
+		static constexpr int histogram_buckets = 32;
+		struct stats
+		{
+			std::string name;
+			UINT64 calls = 0;
+			UINT64 cycles = 0;
+			UINT64 min = ~0ull;
+			UINT64 max = 0;
+			UINT32 histogram[histogram_buckets] = {}; //calls by log2 of their cycles, halved by decay() so it follows recent frames
+			void add(UINT64 elapsed)
+			{
+				calls++;
+				cycles += elapsed;
+				if (elapsed < min)
+					min = elapsed;
+				if (elapsed > max)
+					max = elapsed;
+				unsigned long bucket = 0;
+				if (elapsed >> 32)
+				{
+					_BitScanReverse(&bucket, (unsigned long)(elapsed >> 32));
+					bucket += 32;
+				}
+				else if (elapsed)
+					_BitScanReverse(&bucket, (unsigned long)elapsed);
+				histogram[bucket < histogram_buckets ? bucket : histogram_buckets - 1]++;
+			}
+			UINT64 percentile(double p) const; //upper bound in cycles of the bucket holding the p quantile
+			void reset();
+		};
+
+		extern bool enabled; //runtime switch, off by default so an idle wrapper costs one predictable branch
+		extern bool tracing; //spans are being recorded for a trace file
+		stats* create(const std::string& name); //same name returns the same entry, entries live until exit
+		std::vector<stats*>& all();
+		void set_enabled(bool on);
+		void reset();
+		void decay();
+		void snapshot(std::vector<std::pair<UINT64, UINT64>>& out); //calls and cycles of every entry, in all() order
+		double cycles_per_ms(); //measured against QueryPerformanceCounter since the profiler was enabled
+		std::vector<std::string> report(size_t top); //printable lines, heaviest total first
+		std::string to_json(size_t top);
+
+		// every scope that closes while tracing lands in a buffer owned by its thread, stop_trace writes them all
+		// out as chrome trace_event json (chrome://tracing, perfetto) and returns the file name, empty on failure
+		void start_trace();
+		std::string stop_trace();
+		void record(stats* target, UINT64 begin, UINT64 end);
+
+#if ZEAL_PROFILER
+		struct scope
+		{
+			stats* target;
+			UINT64 start;
+			scope(stats* s) : target(enabled || tracing ? s : nullptr), start(target ? __rdtsc() : 0) {}
+			~scope()
+			{
+				if (!target)
+					return;
+				UINT64 end = __rdtsc();
+				if (enabled)
+					target->add(end - start);
+				if (tracing)
+					record(target, start, end);
+			}
+		};
+#else
+		struct scope
+		{
+			scope(stats*) {}
+		};
+#endif
+	}
+}
+
+// times the rest of the enclosing block under a fixed name, for work that is not a hook or callback of its own
+#define ZEAL_PROFILE_SCOPE(label) static Zeal::Profiler::stats* zeal_profile_stats = Zeal::Profiler::create(label); Zeal::Profiler::scope zeal_profile_scope(zeal_profile_stats)
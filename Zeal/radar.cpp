@@ -0,0 +1,302 @@
+#include "radar.h"
+#include "Zeal.h"
+#include "EqAddresses.h"
+#include "EqFunctions.h"
+#include "camera_math.h"
+#include "string_util.h"
+#include <cmath>
+#include <fstream>
+
+static constexpr D3DCOLOR background_color = D3DCOLOR_ARGB(140, 0, 0, 0);
+static constexpr D3DCOLOR border_color = D3DCOLOR_ARGB(200, 160, 160, 160);
+static constexpr float dot_half = 1.5f;
+
+std::string ZoneMap::path(DWORD zone_id)
+{
+	return "map\\" + std::to_string(zone_id) + ".zmap";
+}
+
+bool ZoneMap::open(DWORD zone_id)
+{
+	close();
+	file = CreateFileA(path(zone_id).c_str(), GENERIC_READ, FILE_SHARE_READ, NULL, OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL, NULL);
+	if (file == INVALID_HANDLE_VALUE)
+		return false;
+	LARGE_INTEGER file_size;
+	if (GetFileSizeEx(file, &file_size) && file_size.QuadPart >= (LONGLONG)sizeof(zone_map_header))
+		mapping = CreateFileMappingA(file, NULL, PAGE_READONLY, 0, 0, NULL);
+	if (mapping)
+		header = (const zone_map_header*)MapViewOfFile(mapping, FILE_MAP_READ, 0, 0, 0);
+	if (!header || header->magic != zone_map_magic || header->version != zone_map_version || header->zone_id != zone_id ||
+		file_size.QuadPart < (LONGLONG)(sizeof(zone_map_header) + (ULONGLONG)header->line_count * sizeof(zone_map_line)))
+	{
+		close();
+		return false;
+	}
+	lines = (const zone_map_line*)(header + 1);
+	count = header->line_count;
+	return true;
+}
+
+void ZoneMap::close()
+{
+	if (header)
+		UnmapViewOfFile(header);
+	if (mapping)
+		CloseHandle(mapping);
+	if (file != INVALID_HANDLE_VALUE)
+		CloseHandle(file);
+	header = nullptr;
+	mapping = nullptr;
+	file = INVALID_HANDLE_VALUE;
+	lines = nullptr;
+	count = 0;
+}
+
+bool ZoneMap::import(const std::string& text_file, DWORD zone_id, UINT& line_count)
+{
+	std::ifstream in(text_file);
+	if (!in.is_open())
+		return false;
+	std::vector<zone_map_line> parsed;
+	std::string text;
+	while (std::getline(in, text))
+	{
+		float x0, y0, z0, x1, y1, z1;
+		int r, g, b;
+		if (text.size() < 2 || (text[0] != 'L' && text[0] != 'l') ||
+			sscanf_s(text.c_str() + 1, " %f , %f , %f , %f , %f , %f , %d , %d , %d", &x0, &y0, &z0, &x1, &y1, &z1, &r, &g, &b) != 9)
+			continue; //points, labels and anything malformed
+		if (!r && !g && !b)
+			r = g = b = 200; //black lines vanish on the dark background
+		parsed.push_back({ x0, y0, z0, x1, y1, z1, D3DCOLOR_ARGB(200, r & 0xFF, g & 0xFF, b & 0xFF) });
+	}
+	CreateDirectoryA("map", NULL);
+	std::ofstream out(path(zone_id), std::ios::binary | std::ios::trunc);
+	if (!out.is_open())
+		return false;
+	zone_map_header header = { zone_map_magic, zone_map_version, zone_id, static_cast<UINT32>(parsed.size()) };
+	out.write(reinterpret_cast<const char*>(&header), sizeof(header));
+	if (parsed.size())
+		out.write(reinterpret_cast<const char*>(parsed.data()), parsed.size() * sizeof(zone_map_line));
+	line_count = header.line_count;
+	return out.good();
+}
+
+// liang barsky against the radar square, in pixels relative to its center
+static bool clip_line(float half, float& x0, float& y0, float& x1, float& y1)
+{
+	float t0 = 0.f, t1 = 1.f;
+	float dx = x1 - x0, dy = y1 - y0;
+	const float p[4] = { -dx, dx, -dy, dy };
+	const float q[4] = { x0 + half, half - x0, y0 + half, half - y0 };
+	for (int i = 0; i < 4; i++)
+	{
+		if (p[i] == 0.f)
+		{
+			if (q[i] < 0.f)
+				return false;
+			continue;
+		}
+		float t = q[i] / p[i];
+		if (p[i] < 0.f)
+		{
+			if (t > t1)
+				return false;
+			if (t > t0)
+				t0 = t;
+		}
+		else
+		{
+			if (t < t0)
+				return false;
+			if (t < t1)
+				t1 = t;
+		}
+	}
+	float sx = x0, sy = y0;
+	x0 = sx + t0 * dx;
+	y0 = sy + t0 * dy;
+	x1 = sx + t1 * dx;
+	y1 = sy + t1 * dy;
+	return true;
+}
+
+void Radar::load_zone(DWORD zone_id)
+{
+	loaded_zone = zone_id;
+	zone_map.open(zone_id);
+	dirty = true;
+}
+
+D3DCOLOR Radar::color_for(Zeal::EqStructures::Entity* ent, Zeal::EqStructures::Entity* target) const
+{
+	if (ent == target)
+		return D3DCOLOR_ARGB(255, 255, 230, 40);
+	if (ent->Type > 1)
+		return D3DCOLOR_ARGB(255, 130, 130, 130); //corpses
+	Zeal::EqStructures::Entity** group = (Zeal::EqStructures::Entity**)Zeal::EqGame::GroupList;
+	for (int i = 0; i < EQ_NUM_GROUP_MEMBERS; ++i)
+		if (group[i] == ent)
+			return D3DCOLOR_ARGB(255, 60, 230, 60);
+	if (ent->Type == 0)
+		return D3DCOLOR_ARGB(255, 90, 150, 255);
+	ConCache* cons = ZealService::get_instance()->con_cache.get();
+	UINT8 faction = cons ? cons->get(ent) : ConCache::unknown;
+	if (faction != ConCache::unknown && !ConCache::hostile(faction))
+		return D3DCOLOR_ARGB(255, 230, 190, 70); //conned and won't aggro on sight
+	return D3DCOLOR_ARGB(255, 255, 70, 70);
+}
+
+void Radar::rebuild(float center_x, float center_y, float self_x, float self_y, float scale, float heading)
+{
+	float half = size.get() * 0.5f;
+	triangles.clear();
+	lines.clear();
+	auto tri_quad = [this](float l, float t, float r, float b, D3DCOLOR color) {
+		PrimitiveBatch::screen_vertex quad[6] = {
+			{ l, t, 0.f, 1.f, color }, { r, t, 0.f, 1.f, color }, { l, b, 0.f, 1.f, color },
+			{ r, t, 0.f, 1.f, color }, { r, b, 0.f, 1.f, color }, { l, b, 0.f, 1.f, color },
+		};
+		triangles.insert(triangles.end(), quad, quad + 6);
+	};
+	auto line = [this](float x0, float y0, float x1, float y1, D3DCOLOR color) {
+		lines.push_back({ x0, y0, 0.f, 1.f, color });
+		lines.push_back({ x1, y1, 0.f, 1.f, color });
+	};
+	tri_quad(center_x - half, center_y - half, center_x + half, center_y + half, background_color);
+	line(center_x - half, center_y - half, center_x + half, center_y - half, border_color);
+	line(center_x + half, center_y - half, center_x + half, center_y + half, border_color);
+	line(center_x + half, center_y + half, center_x - half, center_y + half, border_color);
+	line(center_x - half, center_y + half, center_x - half, center_y - half, border_color);
+
+	float world_half = half / scale;
+	for (UINT i = 0; i < zone_map.count; i++)
+	{
+		const zone_map_line& l = zone_map.lines[i];
+		// cheap reject on the box before clipping
+		if ((l.x0 < self_x - world_half && l.x1 < self_x - world_half) || (l.x0 > self_x + world_half && l.x1 > self_x + world_half) ||
+			(l.y0 < self_y - world_half && l.y1 < self_y - world_half) || (l.y0 > self_y + world_half && l.y1 > self_y + world_half))
+			continue;
+		float x0 = (l.x0 - self_x) * scale, y0 = (l.y0 - self_y) * scale;
+		float x1 = (l.x1 - self_x) * scale, y1 = (l.y1 - self_y) * scale;
+		if (clip_line(half, x0, y0, x1, y1))
+			line(center_x + x0, center_y + y0, center_x + x1, center_y + y1, l.color);
+	}
+
+	for (const dot& d : dots)
+	{
+		float x = center_x + d.x, y = center_y + d.y;
+		tri_quad(x - dot_half, y - dot_half, x + dot_half + 1.f, y + dot_half + 1.f, d.color);
+	}
+	// self in the middle with a heading tick, heading counts counter clockwise from north in 512ths of a turn
+	tri_quad(center_x - 2.f, center_y - 2.f, center_x + 3.f, center_y + 3.f, D3DCOLOR_ARGB(255, 255, 255, 255));
+	line(center_x, center_y, center_x - camera_math::heading_sin(heading) * 10.f, center_y - camera_math::heading_cos(heading) * 10.f, D3DCOLOR_ARGB(255, 255, 255, 255));
+}
+
+void Radar::render()
+{
+	if (!enabled || !Zeal::EqGame::is_in_game())
+		return;
+	ZealService* zeal = ZealService::get_instance();
+	Zeal::EqStructures::Entity* self = Zeal::EqGame::get_self();
+	if (!self || !zeal->dx)
+		return;
+	if (self->ZoneId != loaded_zone)
+	{
+		// the map is opened on a quiet frame after the zone in rather than during it
+		DWORD zone = self->ZoneId;
+		loaded_zone = zone;
+		zeal->zone_warmup->post_zone([this, zone]() { if (loaded_zone == zone) load_zone(zone); });
+	}
+	float half = size.get() * 0.5f;
+	float world_range = static_cast<float>(range.get() > 0 ? range.get() : 1);
+	float scale = half / world_range;
+	// map files use x east and y south, the game's y is west and x north
+	float self_x = -self->Position.y, self_y = -self->Position.x;
+
+	next_dots.clear();
+	zeal->entity_manager->query_radius(self->Position, world_range * 1.415f, nearby); //the square's corners
+	Zeal::EqStructures::Entity* target = Zeal::EqGame::get_target();
+	for (Zeal::EqStructures::Entity* ent : nearby)
+	{
+		if (ent == self)
+			continue;
+		float x = (-ent->Position.y - self_x) * scale, y = (-ent->Position.x - self_y) * scale;
+		if (fabsf(x) > half - dot_half || fabsf(y) > half - dot_half)
+			continue;
+		next_dots.push_back({ static_cast<short>(floorf(x + 0.5f)), static_cast<short>(floorf(y + 0.5f)), color_for(ent, target) });
+	}
+	if (next_dots.size() != dots.size() || (dots.size() && memcmp(next_dots.data(), dots.data(), dots.size() * sizeof(dot))))
+	{
+		dots.swap(next_dots);
+		dirty = true;
+	}
+	if (fabsf(self_x - built_x) * scale >= 1.f || fabsf(self_y - built_y) * scale >= 1.f || fabsf(self->Heading - built_heading) >= 2.f)
+		dirty = true;
+	if (dirty)
+	{
+		built_x = self_x;
+		built_y = self_y;
+		built_heading = self->Heading;
+		rebuild(left.get() + half, top.get() + half, self_x, self_y, scale, self->Heading);
+		dirty = false;
+	}
+	zeal->dx->primitives.screen_triangles(triangles);
+	zeal->dx->primitives.screen_lines(lines);
+}
+
+Radar::Radar(ZealService* zeal)
+{
+	zeal->callbacks->add_generic([this]() { render(); }, callback_type::RenderUI);
+	zeal->callbacks->add_generic([this]() { zone_map.close(); loaded_zone = 0xFFFFFFFF; dots.clear(); dirty = true; }, callback_type::Zone);
+	range.on_change([this](int) { dirty = true; });
+	size.on_change([this](int) { dirty = true; });
+	left.on_change([this](int) { dirty = true; });
+	top.on_change([this](int) { dirty = true; });
+	zeal->commands_hook->add("/radar", {}, "Toggles the radar, /radar range <n>, size <px>, pos <x> <y>, import <map.txt> converts a text map for the current zone.",
+		[this](std::vector<std::string>& args) {
+			int value = 0, value2 = 0;
+			if (args.size() == 1)
+			{
+				enabled.set(!enabled.get());
+				Zeal::EqGame::print_chat("Radar is %s", enabled ? "on" : "off");
+			}
+			else if (args.size() == 3 && Zeal::String::compare_insensitive(args[1], "range") && Zeal::String::tryParse(args[2], &value) && value > 0)
+			{
+				range.set(value);
+				Zeal::EqGame::print_chat("Radar range is now %i", value);
+			}
+			else if (args.size() == 3 && Zeal::String::compare_insensitive(args[1], "size") && Zeal::String::tryParse(args[2], &value) && value >= 50)
+			{
+				size.set(value);
+				Zeal::EqGame::print_chat("Radar size is now %i", value);
+			}
+			else if (args.size() == 4 && Zeal::String::compare_insensitive(args[1], "pos") && Zeal::String::tryParse(args[2], &value) && Zeal::String::tryParse(args[3], &value2))
+			{
+				left.set(value);
+				top.set(value2);
+				Zeal::EqGame::print_chat("Radar moved to %i, %i", value, value2);
+			}
+			else if (args.size() >= 3 && Zeal::String::compare_insensitive(args[1], "import"))
+			{
+				Zeal::EqStructures::Entity* self = Zeal::EqGame::get_self();
+				std::string file = args[2];
+				for (size_t i = 3; i < args.size(); i++)
+					file += " " + args[i];
+				UINT lines_read = 0;
+				if (!self || !ZoneMap::import(file, self->ZoneId, lines_read))
+				{
+					Zeal::EqGame::print_chat("Could not import %s", file.c_str());
+					return true;
+				}
+				load_zone(self->ZoneId);
+				Zeal::EqGame::print_chat("Imported %u lines to %s", lines_read, ZoneMap::path(self->ZoneId).c_str());
+			}
+			else
+			{
+				Zeal::EqGame::print_chat("usage: /radar [range <n> | size <px> | pos <x> <y> | import <map.txt>]");
+			}
+			return true;
+		});
+}
@@ -0,0 +1,74 @@
+#pragma once
+#include <Windows.h>
+#include <string>
+#include <vector>
+#include "settings.h"
+#include "primitive_batch.h"
+#include "EqStructures.h"
+
+// map\<zone id>.zmap: a zone_map_header followed by line_count zone_map_line, in map file coordinates (x east, y south)
+static constexpr UINT32 zone_map_magic = 0x50414D5A; //ZMAP
+static constexpr UINT32 zone_map_version = 1;
+struct zone_map_header
+{
+	UINT32 magic;
+	UINT32 version;
+	UINT32 zone_id;
+	UINT32 line_count;
+};
+struct zone_map_line
+{
+	float x0, y0, z0;
+	float x1, y1, z1;
+	D3DCOLOR color;
+};
+
+// the current zone's outlines, mapped read only while in the zone so nothing is parsed or copied per frame
+class ZoneMap
+{
+public:
+	bool open(DWORD zone_id);
+	void close();
+	static std::string path(DWORD zone_id);
+	// one time conversion of a text map ("L x0, y0, z0, x1, y1, z1, r, g, b" lines) to the mapped format
+	static bool import(const std::string& text_file, DWORD zone_id, UINT& line_count);
+	const zone_map_line* lines = nullptr;
+	UINT count = 0;
+	~ZoneMap() { close(); }
+private:
+	HANDLE file = INVALID_HANDLE_VALUE;
+	HANDLE mapping = nullptr;
+	const zone_map_header* header = nullptr;
+};
+
+// north up radar of nearby spawns over the zone outlines, drawn through dx->primitives in screen space;
+// the vertices are cached and only rebuilt once something on it moved by at least a pixel
+class Radar
+{
+public:
+	Radar(class ZealService* zeal);
+	Setting<bool> enabled{ "Zeal", "Radar", false };
+	Setting<int> range{ "Zeal", "RadarRange", 300 }; //world units from the center to an edge
+	Setting<int> size{ "Zeal", "RadarSize", 200 }; //pixels
+	Setting<int> left{ "Zeal", "RadarLeft", 10 };
+	Setting<int> top{ "Zeal", "RadarTop", 60 };
+private:
+	struct dot
+	{
+		short x, y; //pixels from the radar center
+		D3DCOLOR color;
+	};
+	void render();
+	void rebuild(float center_x, float center_y, float self_x, float self_y, float scale, float heading);
+	void load_zone(DWORD zone_id);
+	D3DCOLOR color_for(Zeal::EqStructures::Entity* ent, Zeal::EqStructures::Entity* target) const;
+	ZoneMap zone_map;
+	DWORD loaded_zone = 0xFFFFFFFF;
+	std::vector<Zeal::EqStructures::Entity*> nearby;
+	std::vector<dot> dots; //what the cache was built from
+	std::vector<dot> next_dots;
+	std::vector<PrimitiveBatch::screen_vertex> triangles;
+	std::vector<PrimitiveBatch::screen_vertex> lines;
+	float built_x = 0, built_y = 0, built_heading = 0; //self in map coordinates when the cache was built
+	bool dirty = true;
+};
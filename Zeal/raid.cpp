@@ -2,11 +2,76 @@
 #include "EqStructures.h"
 #include "EqAddresses.h"
 #include "EqFunctions.h"
+#include "EqPackets.h"
 #include "Zeal.h"
 
-void raid::callback_main()
+bool raid::roster_changed()
 {
+	short size = Zeal::EqGame::get_raid_size();
+	if (dirty || size != raid_size)
+		return true;
+	if (size <= 0)
+		return false;
+	for (int i = 0; i < raid_max_members; i++)
+	{
+		Zeal::EqStructures::RaidMember* member = Zeal::EqGame::get_raid_slot(i);
+		if (member->Name[0] != slots[i].first || member->GroupNumber != slots[i].group)
+			return true;
+	}
+	return false;
+}
+
+void raid::rebuild_roster()
+{
+	ZEAL_ASSERT_GAME_THREAD();
+	roster.clear();
+	by_name.clear();
+	for (auto& group : by_group)
+		group.clear();
+	raid_size = Zeal::EqGame::get_raid_size();
+	for (int i = 0; i < raid_max_members; i++) // sometimes gaps so need to check all
+	{
+		Zeal::EqStructures::RaidMember* member = Zeal::EqGame::get_raid_slot(i);
+		slots[i] = { member->Name[0], member->GroupNumber };
+		if (raid_size <= 0 || member->Name[0] == '\0')
+			continue;
+		roster.push_back(member);
+		by_name[member->Name] = member;
+		by_group[member->GroupNumber < raid_max_groups ? member->GroupNumber : raid_max_groups].push_back(member);
+	}
+	roster_generation++;
+	dirty = false;
+}
+
+const std::vector<Zeal::EqStructures::RaidMember*>& raid::get_roster()
+{
+	if (roster_changed())
+		rebuild_roster();
+	return roster;
+}
+
+Zeal::EqStructures::RaidMember* raid::find_member(const std::string& name)
+{
+	if (roster_changed())
+		rebuild_roster();
+	auto it = by_name.find(name);
+	return it != by_name.end() ? it->second : nullptr;
+}
 
+const std::vector<Zeal::EqStructures::RaidMember*>& raid::get_group(int group_number)
+{
+	if (roster_changed())
+		rebuild_roster();
+	if (group_number < 0 || group_number > raid_max_groups)
+		group_number = raid_max_groups;
+	return by_group[group_number];
+}
+
+UINT raid::generation()
+{
+	if (roster_changed())
+		rebuild_roster();
+	return roster_generation;
 }
 
 raid::~raid()
@@ -25,7 +90,7 @@ void __fastcall SetLootTypeResponse(void* t, int unused, int p1)
 	}
 	else
 	{
-		zeal->hooks->hook_map["SetLootTypeResponse"]->original(SetLootTypeResponse)(t, unused, p1);
+		hook_ref<SetLootTypeResponse>::original()(t, unused, p1);
 	}
 }
 
@@ -33,6 +98,9 @@ raid::raid(ZealService* zeal)
 {
 	mem::write<byte>(0x49E182, 4); // allow for 4 types in setloottype
 	mem::write<byte>(0x42FAB3, 4); // allow for 4 types being set from the options window
-	zeal->hooks->Add("SetLootTypeResponse", 0x49dbc1, SetLootTypeResponse, hook_type_detour); //add extra prints for new loot types
-	zeal->callbacks->add_generic([this]() { callback_main(); });
+	zeal->hooks->Add<SetLootTypeResponse>("SetLootTypeResponse", 0x49dbc1, hook_type_detour); //add extra prints for new loot types
+	zeal->callbacks->add_packet([this](UINT opcode, char* buffer, UINT len) { dirty = true; return false; }, { Zeal::Packets::RaidUpdate }); //the slot check in roster_changed catches raid changes this misses
+	zeal->callbacks->add_generic([this]() { dirty = true; }, callback_type::Zone);
+	zeal->callbacks->add_generic([this]() { dirty = true; }, callback_type::CharacterSelect);
+	roster.reserve(raid_max_members);
 }
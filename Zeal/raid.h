@@ -1,13 +1,39 @@
 #pragma once
 #include "hook_wrapper.h"
 #include "memory.h"
+#include "EqStructures.h"
+#include <vector>
+#include <array>
+#include <string>
+#include <unordered_map>
 
+static constexpr int raid_max_members = 72; //12 groups x 6
+static constexpr int raid_max_groups = 12;
 class raid
 {
 public:
 	raid(class ZealService* zeal);
 	~raid();
+	// roster cache over the client's raid member array, only rebuilt when the roster changed
+	const std::vector<Zeal::EqStructures::RaidMember*>& get_roster();
+	Zeal::EqStructures::RaidMember* find_member(const std::string& name);
+	const std::vector<Zeal::EqStructures::RaidMember*>& get_group(int group_number); //0 based, raid_max_groups for ungrouped
+	UINT generation(); //bumped on every rebuild
+	void invalidate() { dirty = true; }
 private:
-	void callback_main();
+	struct slot_state
+	{
+		char first; //first character of the name, 0 for an empty slot
+		DWORD group;
+	};
+	bool roster_changed();
+	void rebuild_roster();
+	std::vector<Zeal::EqStructures::RaidMember*> roster;
+	std::unordered_map<std::string, Zeal::EqStructures::RaidMember*> by_name;
+	std::array<std::vector<Zeal::EqStructures::RaidMember*>, raid_max_groups + 1> by_group;
+	std::array<slot_state, raid_max_members> slots = {};
+	short raid_size = 0;
+	UINT roster_generation = 0;
+	bool dirty = true;
 };
 
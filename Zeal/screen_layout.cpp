@@ -0,0 +1,88 @@
+#include "screen_layout.h"
+#include <algorithm>
+
+// steps in box sizes: up first since floating text rises, then down, then beside
+static constexpr float spot_steps[ScreenLayout::max_spots][2] = { { 0.f, 0.f }, { 0.f, -1.f }, { 0.f, 1.f }, { 0.f, -2.f }, { 0.f, 2.f }, { -1.f, 0.f }, { 1.f, 0.f } };
+
+bool ScreenLayout::fits(float left, float top, float right, float bottom) const
+{
+	int c0 = std::max(static_cast<int>(left) / tile_size, 0), c1 = std::min(static_cast<int>(right) / tile_size, columns - 1);
+	int r0 = std::max(static_cast<int>(top) / tile_size, 0), r1 = std::min(static_cast<int>(bottom) / tile_size, rows - 1);
+	const std::vector<layout_box>& boxes = *current;
+	for (int r = r0; r <= r1; ++r)
+	{
+		for (int c = c0; c <= c1; ++c)
+		{
+			int tile = r * columns + c;
+			if (tile_counts[tile] >= tile_capacity)
+				return false;
+			const UINT16* slots = &tile_boxes[tile * tile_capacity];
+			for (int s = 0; s < tile_counts[tile]; ++s)
+			{
+				const layout_box& b = boxes[slots[s]];
+				if (left < b.left + b.width && b.left < right && top < b.top + b.height && b.top < bottom)
+					return false;
+			}
+		}
+	}
+	return true;
+}
+
+void ScreenLayout::insert(UINT16 box)
+{
+	const layout_box& b = (*current)[box];
+	int c0 = std::max(static_cast<int>(b.left) / tile_size, 0), c1 = std::min(static_cast<int>(b.left + b.width) / tile_size, columns - 1);
+	int r0 = std::max(static_cast<int>(b.top) / tile_size, 0), r1 = std::min(static_cast<int>(b.top + b.height) / tile_size, rows - 1);
+	for (int r = r0; r <= r1; ++r)
+	{
+		for (int c = c0; c <= c1; ++c)
+		{
+			int tile = r * columns + c;
+			if (tile_counts[tile] < tile_capacity) //fits() checked every tile, a full one here is one it only brushes
+				tile_boxes[tile * tile_capacity + tile_counts[tile]++] = box;
+		}
+	}
+}
+
+void ScreenLayout::solve(std::vector<layout_box>& boxes, float screen_width, float screen_height, int spots)
+{
+	dropped = 0;
+	if (boxes.empty())
+		return;
+	current = &boxes;
+	columns = std::max(static_cast<int>(screen_width) / tile_size + 1, 1);
+	rows = std::max(static_cast<int>(screen_height) / tile_size + 1, 1);
+	tile_counts.assign(static_cast<size_t>(columns) * rows, 0);
+	tile_boxes.resize(tile_counts.size() * tile_capacity);
+	order.clear();
+	for (size_t i = 0; i < boxes.size() && i < 0xFFFF; ++i)
+	{
+		layout_box& b = boxes[i];
+		b.placed = false;
+		if (b.left + b.width > 0.f && b.left < screen_width && b.top + b.height > 0.f && b.top < screen_height)
+			order.push_back(static_cast<UINT16>(i));
+	}
+	std::stable_sort(order.begin(), order.end(), [&boxes](UINT16 a, UINT16 b) { return boxes[a].priority > boxes[b].priority; });
+	spots = std::clamp(spots, 1, static_cast<int>(max_spots));
+	for (UINT16 i : order)
+	{
+		layout_box& b = boxes[i];
+		for (int s = 0; s < spots; ++s)
+		{
+			float left = b.left + spot_steps[s][0] * b.width;
+			float top = b.top + spot_steps[s][1] * b.height;
+			if (left + b.width <= 0.f || left >= screen_width || top + b.height <= 0.f || top >= screen_height)
+				continue;
+			if (!fits(left, top, left + b.width, top + b.height))
+				continue;
+			b.left = left;
+			b.top = top;
+			b.placed = true;
+			insert(i);
+			break;
+		}
+	}
+	for (const layout_box& b : boxes)
+		dropped += !b.placed;
+	current = nullptr;
+}
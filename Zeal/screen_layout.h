@@ -0,0 +1,35 @@
+#pragma once
+#include <Windows.h>
+#include <vector>
+
+// a piece of overlay text to place, in pixels with x across and y down (the projector's rows are y here)
+struct layout_box
+{
+	float left, top; //where it wants to go in, where it went out
+	float width, height;
+	int priority; //higher is placed first, and so kept when space runs out
+	bool placed; //out, false for boxes off screen, overlapping everything tried or in a saturated tile
+};
+
+// screen space layout for overlay text, rebuilt every frame: boxes are placed in priority order into a coarse tile grid
+// over the screen, each one at the first of a few spots stepped away from its anchor that overlaps nothing placed so
+// far. a tile holding tile_capacity boxes takes no more, so a crowd around one target costs a handful of overlap tests
+// and drops its least important text instead of drawing it. boxes entirely off screen never reach the grid
+class ScreenLayout
+{
+public:
+	void solve(std::vector<layout_box>& boxes, float screen_width, float screen_height, int spots = max_spots);
+	static constexpr int max_spots = 7; //in place, then up and down a line at a time, then to either side
+	static constexpr int tile_size = 64; //pixels
+	static constexpr int tile_capacity = 8;
+	UINT dropped = 0; //boxes of the last solve that weren't placed
+private:
+	bool fits(float left, float top, float right, float bottom) const;
+	void insert(UINT16 box);
+	int columns = 0;
+	int rows = 0;
+	std::vector<UINT16> order; //box indexes by priority
+	std::vector<BYTE> tile_counts;
+	std::vector<UINT16> tile_boxes; //tile_capacity slots per tile
+	std::vector<layout_box>* current = nullptr;
+};
@@ -0,0 +1,210 @@
+#include "screenshot.h"
+#include "Zeal.h"
+#include "EqFunctions.h"
+#include "string_util.h"
+#include <algorithm>
+namespace Gdiplus
+{
+	using std::min; //gdiplus expects the windows min/max macros
+	using std::max;
+}
+#include <gdiplus.h>
+
+static bool encoder_clsid(const WCHAR* mime, CLSID& out)
+{
+	UINT count = 0, size = 0;
+	if (Gdiplus::GetImageEncodersSize(&count, &size) != Gdiplus::Ok || !size)
+		return false;
+	std::vector<BYTE> buffer(size);
+	Gdiplus::ImageCodecInfo* codecs = reinterpret_cast<Gdiplus::ImageCodecInfo*>(buffer.data());
+	if (Gdiplus::GetImageEncoders(count, size, codecs) != Gdiplus::Ok)
+		return false;
+	for (UINT i = 0; i < count; ++i)
+	{
+		if (!wcscmp(codecs[i].MimeType, mime))
+		{
+			out = codecs[i].Clsid;
+			return true;
+		}
+	}
+	return false;
+}
+
+// gdi+ is started once by the first encode and left running, it is cheap idle and unloading it races a running job
+static bool start_gdiplus()
+{
+	static bool started = []() {
+		Gdiplus::GdiplusStartupInput input;
+		ULONG_PTR token = 0;
+		return Gdiplus::GdiplusStartup(&token, &input, nullptr) == Gdiplus::Ok;
+	}();
+	return started;
+}
+
+bool Screenshot::encode(const frame& shot)
+{
+	if (!start_gdiplus())
+		return false;
+	CLSID clsid;
+	if (!encoder_clsid(shot.jpeg ? L"image/jpeg" : L"image/png", clsid))
+		return false;
+	Gdiplus::Bitmap bitmap(shot.width, shot.height, shot.width * 4, PixelFormat32bppRGB, const_cast<BYTE*>(shot.pixels.data()));
+	std::wstring name(shot.filename.begin(), shot.filename.end());
+	if (!shot.jpeg)
+		return bitmap.Save(name.c_str(), &clsid, nullptr) == Gdiplus::Ok;
+	ULONG quality = static_cast<ULONG>(std::clamp(shot.quality, 1, 100));
+	Gdiplus::EncoderParameters params;
+	params.Count = 1;
+	params.Parameter[0].Guid = Gdiplus::EncoderQuality;
+	params.Parameter[0].Type = Gdiplus::EncoderParameterValueTypeLong;
+	params.Parameter[0].NumberOfValues = 1;
+	params.Parameter[0].Value = &quality;
+	return bitmap.Save(name.c_str(), &clsid, &params) == Gdiplus::Ok;
+}
+
+std::string Screenshot::next_filename(bool jpeg)
+{
+	SYSTEMTIME time;
+	GetLocalTime(&time);
+	char filename[96];
+	snprintf(filename, sizeof(filename), "screenshots\\zeal_%04d%02d%02d_%02d%02d%02d_%03d.%s", time.wYear, time.wMonth, time.wDay,
+		time.wHour, time.wMinute, time.wSecond, time.wMilliseconds, jpeg ? "jpg" : "png");
+	return filename;
+}
+
+// the common back buffer formats widened to 32 bit rows, anything else is refused
+bool Screenshot::convert(const D3DLOCKED_RECT& locked, D3DFORMAT format, frame& out)
+{
+	out.pixels.resize(static_cast<size_t>(out.width) * out.height * 4);
+	for (UINT y = 0; y < out.height; ++y)
+	{
+		const BYTE* src = static_cast<const BYTE*>(locked.pBits) + static_cast<size_t>(y) * locked.Pitch;
+		DWORD* dst = reinterpret_cast<DWORD*>(out.pixels.data() + static_cast<size_t>(y) * out.width * 4);
+		switch (format)
+		{
+		case D3DFMT_X8R8G8B8:
+		case D3DFMT_A8R8G8B8:
+			memcpy(dst, src, out.width * 4);
+			break;
+		case D3DFMT_R5G6B5:
+			for (UINT x = 0; x < out.width; ++x)
+			{
+				WORD p = reinterpret_cast<const WORD*>(src)[x];
+				DWORD r = (p >> 11) & 0x1F, g = (p >> 5) & 0x3F, b = p & 0x1F;
+				dst[x] = ((r << 3 | r >> 2) << 16) | ((g << 2 | g >> 4) << 8) | (b << 3 | b >> 2);
+			}
+			break;
+		case D3DFMT_X1R5G5B5:
+		case D3DFMT_A1R5G5B5:
+			for (UINT x = 0; x < out.width; ++x)
+			{
+				WORD p = reinterpret_cast<const WORD*>(src)[x];
+				DWORD r = (p >> 10) & 0x1F, g = (p >> 5) & 0x1F, b = p & 0x1F;
+				dst[x] = ((r << 3 | r >> 2) << 16) | ((g << 3 | g >> 2) << 8) | (b << 3 | b >> 2);
+			}
+			break;
+		default:
+			return false;
+		}
+	}
+	return true;
+}
+
+// EndScene, after the ui drew: one CopyRects into system memory and a row copy, the rest happens on the pool
+void Screenshot::capture()
+{
+	if (!requested.exchange(false))
+		return;
+	ZealService* zeal = ZealService::get_instance();
+	if (in_flight >= max_in_flight)
+	{
+		Zeal::EqGame::print_chat("Screenshot skipped, %i are still being written", max_in_flight);
+		return;
+	}
+	IDirect3DDevice8* device = zeal->dx->get_device();
+	IDirect3DSurface8* back = nullptr;
+	if (!device || FAILED(device->GetBackBuffer(0, D3DBACKBUFFER_TYPE_MONO, &back)) || !back)
+		return;
+	D3DSURFACE_DESC desc;
+	if (FAILED(back->GetDesc(&desc)))
+	{
+		back->Release();
+		return;
+	}
+	if (readback && (readback_desc.Width != desc.Width || readback_desc.Height != desc.Height || readback_desc.Format != desc.Format))
+		release();
+	if (!readback && SUCCEEDED(device->CreateImageSurface(desc.Width, desc.Height, desc.Format, &readback)))
+		readback_desc = desc;
+	bool copied = readback && SUCCEEDED(device->CopyRects(back, nullptr, 0, readback, nullptr));
+	back->Release();
+	D3DLOCKED_RECT locked;
+	if (!copied || FAILED(readback->LockRect(&locked, NULL, D3DLOCK_READONLY)))
+	{
+		Zeal::EqGame::print_chat("Screenshot failed, the back buffer could not be read");
+		return;
+	}
+	auto shot = std::make_shared<frame>();
+	shot->width = desc.Width;
+	shot->height = desc.Height;
+	shot->jpeg = jpeg.get();
+	shot->quality = jpeg_quality.get();
+	shot->filename = next_filename(shot->jpeg);
+	bool converted = convert(locked, desc.Format, *shot);
+	readback->UnlockRect();
+	if (!converted)
+	{
+		Zeal::EqGame::print_chat("Screenshot failed, back buffer format %i is not supported", desc.Format);
+		return;
+	}
+	in_flight++;
+	zeal->tasks->post([this, shot]() {
+		CreateDirectoryA("screenshots", NULL);
+		bool ok = encode(*shot);
+		in_flight--;
+		ZealService::get_instance()->tasks->post_to_main([shot, ok]() {
+			if (ok)
+				Zeal::EqGame::print_chat("Screenshot saved to %s", shot->filename.c_str());
+			else
+				Zeal::EqGame::print_chat("Screenshot could not be written to %s", shot->filename.c_str());
+		});
+	});
+}
+
+void Screenshot::release()
+{
+	if (readback)
+		readback->Release();
+	readback = nullptr;
+	readback_desc = {};
+}
+
+Screenshot::Screenshot(ZealService* zeal)
+{
+	zeal->callbacks->add_generic([this]() { capture(); }, callback_type::EndScene);
+	zeal->callbacks->add_generic([this]() { release(); }, callback_type::DeviceReset);
+	zeal->commands_hook->add("/zealshot", { "/zss" }, "Saves a screenshot without stalling the frame on the encode, /zealshot png|jpg [quality] sets the format.",
+		[this](std::vector<std::string>& args) {
+			if (args.size() > 1 && Zeal::String::compare_insensitive(args[1], "png"))
+			{
+				jpeg.set(false);
+				Zeal::EqGame::print_chat("Screenshots are saved as png");
+				return true;
+			}
+			if (args.size() > 1 && (Zeal::String::compare_insensitive(args[1], "jpg") || Zeal::String::compare_insensitive(args[1], "jpeg")))
+			{
+				jpeg.set(true);
+				int quality = 0;
+				if (args.size() > 2 && Zeal::String::tryParse(args[2], &quality))
+					jpeg_quality.set(std::clamp(quality, 1, 100));
+				Zeal::EqGame::print_chat("Screenshots are saved as jpg at quality %i", jpeg_quality.get());
+				return true;
+			}
+			request();
+			return true;
+		});
+}
+
+Screenshot::~Screenshot()
+{
+	release();
+}
@@ -0,0 +1,39 @@
+#pragma once
+#include <Windows.h>
+#include <atomic>
+#include <string>
+#include <vector>
+#include "d3dx8/d3d8.h"
+#include "settings.h"
+
+// the frame is copied out of the back buffer at the next EndScene and handed to the task pool, which encodes it with
+// gdi+ and writes screenshots\zeal_<date time>.png|jpg; the game thread only pays for the copy, never the encode or disk
+class Screenshot
+{
+public:
+	void request() { requested = true; } //any thread, taken at the next rendered frame
+	Setting<bool> jpeg{ "Zeal", "ScreenshotJpeg", false }; //png otherwise
+	Setting<int> jpeg_quality{ "Zeal", "ScreenshotQuality", 90 };
+	Screenshot(class ZealService* zeal);
+	~Screenshot();
+private:
+	struct frame
+	{
+		std::vector<BYTE> pixels; //32 bit bgrx rows, tightly packed
+		UINT width = 0;
+		UINT height = 0;
+		std::string filename;
+		bool jpeg = false;
+		int quality = 90;
+	};
+	void capture();
+	void release();
+	static bool convert(const D3DLOCKED_RECT& locked, D3DFORMAT format, frame& out);
+	static bool encode(const frame& shot); //task pool thread
+	static std::string next_filename(bool jpeg);
+	IDirect3DSurface8* readback = nullptr; //system memory copy target, kept while the back buffer size and format hold
+	D3DSURFACE_DESC readback_desc = {};
+	std::atomic<bool> requested = false;
+	std::atomic<int> in_flight = 0; //a burst beyond max_in_flight is dropped rather than queuing frames of memory
+	static constexpr int max_in_flight = 4;
+};
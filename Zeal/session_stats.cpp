@@ -0,0 +1,280 @@
+#include "session_stats.h"
+#include "Zeal.h"
+#include "EqPackets.h"
+#include "string_util.h"
+#include <time.h>
+
+static UINT32 now_minute() { return (UINT32)(_time64(nullptr) / 60); }
+
+void SessionStats::totals::add(const stats_bucket& b)
+{
+	if (b.minute != last_minute) //zoning splits a minute into two records
+		minutes++;
+	last_minute = b.minute;
+	exp += b.exp;
+	damage_dealt += b.damage_dealt;
+	damage_taken += b.damage_taken;
+	hits_dealt += b.hits_dealt;
+	hits_taken += b.hits_taken;
+	kills += b.kills;
+	deaths += b.deaths;
+	loot += b.loot;
+}
+
+nlohmann::json SessionStats::totals::to_json() const
+{
+	return { {"minutes", minutes}, {"exp", exp}, {"exp_per_hour_pct", minutes ? exp * 60.0 / minutes / 330.0 * 100.0 : 0.0},
+		{"damage_dealt", damage_dealt}, {"damage_taken", damage_taken}, {"hits_dealt", hits_dealt}, {"hits_taken", hits_taken},
+		{"kills", kills}, {"deaths", deaths}, {"loot", loot} };
+}
+
+void SessionStats::open_file(const std::string& name)
+{
+	close_file();
+	character = name;
+	CreateDirectoryA("stats", NULL);
+	path = "stats\\" + name + ".bin";
+	file = CreateFileA(path.c_str(), FILE_APPEND_DATA | FILE_READ_DATA, FILE_SHARE_READ, NULL, OPEN_ALWAYS, FILE_ATTRIBUTE_NORMAL, NULL);
+	if (file == INVALID_HANDLE_VALUE)
+		return;
+	LARGE_INTEGER size;
+	if (GetFileSizeEx(file, &size) && size.QuadPart == 0)
+	{
+		stats_file_header header = { stats_magic, sizeof(stats_bucket) };
+		DWORD written = 0;
+		WriteFile(file, &header, sizeof(header), &written, NULL);
+	}
+	session_start = now_minute();
+}
+
+void SessionStats::close_file()
+{
+	if (current_open)
+		append(current);
+	current_open = false;
+	if (file != INVALID_HANDLE_VALUE)
+		CloseHandle(file);
+	file = INVALID_HANDLE_VALUE;
+}
+
+void SessionStats::append(const stats_bucket& b)
+{
+	if (file == INVALID_HANDLE_VALUE)
+		return;
+	DWORD written = 0;
+	WriteFile(file, &b, sizeof(b), &written, NULL);
+}
+
+stats_bucket& SessionStats::bucket()
+{
+	UINT32 minute = now_minute();
+	Zeal::EqStructures::Entity* self = Zeal::EqGame::get_self();
+	UINT16 zone = self ? (UINT16)self->ZoneId : 0;
+	if (current_open && (current.minute != minute || current.zone_id != zone))
+	{
+		append(current);
+		current_open = false;
+	}
+	if (!current_open)
+	{
+		current = {};
+		current.minute = minute;
+		current.zone_id = zone;
+		current.level = self ? self->Level : 0;
+		current_open = true;
+	}
+	return current;
+}
+
+bool SessionStats::is_ours(WORD spawn_id)
+{
+	Zeal::EqStructures::Entity* self = Zeal::EqGame::get_self();
+	if (!self || !spawn_id)
+		return false;
+	if (spawn_id == self->SpawnId)
+		return true;
+	Zeal::EqStructures::Entity* ent = ZealService::get_instance()->entity_manager->get(spawn_id);
+	return ent && ent->PetOwnerSpawnId == self->SpawnId;
+}
+
+void SessionStats::on_damage(const char* buffer, UINT len)
+{
+	if (len < sizeof(Zeal::Packets::Damage_Struct) || !current_open)
+		return;
+	const Zeal::Packets::Damage_Struct* dmg = (const Zeal::Packets::Damage_Struct*)buffer;
+	if (dmg->damage <= 0)
+		return;
+	Zeal::EqStructures::Entity* self = Zeal::EqGame::get_self();
+	if (self && dmg->target == self->SpawnId)
+	{
+		stats_bucket& b = bucket();
+		b.damage_taken += dmg->damage;
+		b.hits_taken++;
+	}
+	else if (is_ours(dmg->source))
+	{
+		stats_bucket& b = bucket();
+		b.damage_dealt += dmg->damage;
+		b.hits_dealt++;
+	}
+}
+
+void SessionStats::on_death(const char* buffer, UINT len)
+{
+	if (len < sizeof(Zeal::Packets::Death_Struct) || !current_open)
+		return;
+	const Zeal::Packets::Death_Struct* death = (const Zeal::Packets::Death_Struct*)buffer;
+	Zeal::EqStructures::Entity* self = Zeal::EqGame::get_self();
+	if (self && death->spawn_id == self->SpawnId)
+		bucket().deaths++;
+	else if (is_ours(death->killer_id))
+		bucket().kills++;
+}
+
+void SessionStats::note_chat(const char* text)
+{
+	if (current_open && text && strncmp(text, "--You have looted ", 18) == 0)
+		bucket().loot++;
+}
+
+void SessionStats::callback_main()
+{
+	Zeal::EqStructures::Entity* self = Zeal::EqGame::get_self();
+	if (!self || !self->CharInfo || !Zeal::EqGame::is_in_game())
+		return;
+	if (character != self->Name)
+	{
+		open_file(self->Name);
+		last_exp = -1;
+		last_level = -1;
+	}
+	stats_bucket& b = bucket(); //every minute in game gets a record, the rates need the time too
+	int exp = self->CharInfo->Experience;
+	int level = self->Level;
+	if (last_exp >= 0 && (exp != last_exp || level != last_level))
+	{
+		if (level == last_level)
+			b.exp += exp - last_exp;
+		else if (level == last_level + 1)
+			b.exp += exp + 330 - last_exp; //ding
+		else if (level == last_level - 1)
+			b.exp -= last_exp + 330 - exp; //delevel
+		b.level = (UINT8)level;
+	}
+	last_exp = exp;
+	last_level = level;
+}
+
+SessionStats::totals SessionStats::query(scope range)
+{
+	totals t;
+	UINT32 from = 0;
+	UINT16 zone = 0;
+	Zeal::EqStructures::Entity* self = Zeal::EqGame::get_self();
+	if (range == scope::session)
+		from = session_start;
+	else if (range == scope::today)
+	{
+		__time64_t now = _time64(nullptr);
+		tm local;
+		_localtime64_s(&local, &now);
+		local.tm_hour = local.tm_min = local.tm_sec = 0;
+		from = (UINT32)(_mktime64(&local) / 60);
+	}
+	else if (self)
+		zone = (UINT16)self->ZoneId;
+	auto matches = [&](const stats_bucket& b) { return b.minute >= from && (!zone || b.zone_id == zone); };
+
+	HANDLE reader = CreateFileA(path.c_str(), GENERIC_READ, FILE_SHARE_READ | FILE_SHARE_WRITE, NULL, OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL, NULL);
+	if (reader != INVALID_HANDLE_VALUE)
+	{
+		LARGE_INTEGER size;
+		HANDLE mapping = GetFileSizeEx(reader, &size) && size.QuadPart > (LONGLONG)sizeof(stats_file_header)
+			? CreateFileMappingA(reader, NULL, PAGE_READONLY, 0, 0, NULL) : NULL;
+		const BYTE* view = mapping ? (const BYTE*)MapViewOfFile(mapping, FILE_MAP_READ, 0, 0, 0) : nullptr;
+		const stats_file_header* header = (const stats_file_header*)view;
+		if (header && header->magic == stats_magic && header->record_size == sizeof(stats_bucket))
+		{
+			const stats_bucket* records = (const stats_bucket*)(view + sizeof(stats_file_header));
+			size_t count = (size_t)((size.QuadPart - sizeof(stats_file_header)) / sizeof(stats_bucket));
+			// appended in time order, so a time bounded query starts with a binary search
+			size_t first = 0;
+			if (from)
+			{
+				size_t lo = 0, hi = count;
+				while (lo < hi)
+				{
+					size_t mid = (lo + hi) / 2;
+					if (records[mid].minute < from)
+						lo = mid + 1;
+					else
+						hi = mid;
+				}
+				first = lo;
+			}
+			for (size_t i = first; i < count; ++i)
+				if (matches(records[i]))
+					t.add(records[i]);
+		}
+		if (view)
+			UnmapViewOfFile(view);
+		if (mapping)
+			CloseHandle(mapping);
+		CloseHandle(reader);
+	}
+	if (current_open && matches(current))
+		t.add(current);
+	return t;
+}
+
+void SessionStats::print(const char* label, const totals& t)
+{
+	double hours = t.minutes / 60.0;
+	Zeal::EqGame::print_chat("--- %s: %u minutes ---", label, t.minutes);
+	Zeal::EqGame::print_chat("Exp: %.2f%% of a level, %.2f%% per hour", t.exp / 330.0 * 100.0, hours > 0 ? t.exp / 330.0 * 100.0 / hours : 0.0);
+	Zeal::EqGame::print_chat("Damage: %llu dealt in %u hits (%.0f per minute), %llu taken in %u hits", t.damage_dealt, t.hits_dealt,
+		t.minutes ? (double)t.damage_dealt / t.minutes : 0.0, t.damage_taken, t.hits_taken);
+	Zeal::EqGame::print_chat("Kills: %u, deaths: %u, items looted: %u", t.kills, t.deaths, t.loot);
+}
+
+SessionStats::SessionStats(ZealService* zeal)
+{
+	zeal->callbacks->add_generic([this]() { callback_main(); }, callback_type::MainLoop);
+	zeal->callbacks->add_generic([this]() { if (current_open) { append(current); current_open = false; } }, callback_type::Zone);
+	zeal->callbacks->add_generic([this]() { close_file(); character.clear(); }, callback_type::CharacterSelect);
+	zeal->callbacks->add_packet([this](UINT opcode, char* buffer, UINT len) { on_damage(buffer, len); return false; }, { Zeal::Packets::Damage });
+	zeal->callbacks->add_packet([this](UINT opcode, char* buffer, UINT len) { on_death(buffer, len); return false; }, { Zeal::Packets::DeathDamage });
+	zeal->commands_hook->add("/stats", {}, "Exp, damage, kills and loot from the stats file, /stats session | today | zone | pipe [session | today | zone].",
+		[this, zeal](std::vector<std::string>& args) {
+			static const char* scope_names[] = { "session", "today", "zone" };
+			bool pipe = args.size() > 1 && Zeal::String::compare_insensitive(args[1], "pipe");
+			size_t arg = pipe ? 2 : 1;
+			int range = 0;
+			if (args.size() > arg)
+			{
+				range = -1;
+				for (int i = 0; i < 3; ++i)
+					if (Zeal::String::compare_insensitive(args[arg], scope_names[i]))
+						range = i;
+				if (range < 0)
+				{
+					Zeal::EqGame::print_chat("usage: /stats session | today | zone | pipe [session | today | zone]");
+					return true;
+				}
+			}
+			totals t = query((scope)range);
+			if (pipe)
+			{
+				nlohmann::json root = { {"stats", { {"character", character}, {"scope", scope_names[range]}, {"totals", t.to_json()} }} };
+				zeal->pipe->write(root.dump(-1, ' ', false, nlohmann::json::error_handler_t::replace), pipe_data_type::custom);
+			}
+			else
+				print(scope_names[range], t);
+			return true;
+		});
+}
+
+SessionStats::~SessionStats()
+{
+	close_file();
+}
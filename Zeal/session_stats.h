@@ -0,0 +1,74 @@
+#pragma once
+#include <Windows.h>
+#include <string>
+#include "json.hpp"
+
+// per minute totals of exp, damage, kills, deaths and loot, appended to stats\<character>.bin as each minute closes
+// the file is only ever appended to and is mapped read only to answer queries
+static constexpr UINT32 stats_magic = 0x31545A53; //"SZT1"
+#pragma pack(push, 4)
+struct stats_file_header
+{
+	UINT32 magic;
+	UINT32 record_size; //sizeof(stats_bucket) when written, records are skipped when it differs
+};
+struct stats_bucket
+{
+	UINT32 minute; //unix time / 60
+	UINT16 zone_id;
+	UINT8 level;
+	UINT8 flags; //reserved
+	INT32 exp; //in 330ths of a level, negative for exp lost
+	UINT32 damage_dealt; //by us or our pet
+	UINT32 damage_taken;
+	UINT16 hits_dealt;
+	UINT16 hits_taken;
+	UINT16 kills;
+	UINT16 deaths;
+	UINT16 loot;
+	UINT16 reserved;
+};
+#pragma pack(pop)
+
+class SessionStats
+{
+public:
+	SessionStats(class ZealService* zeal);
+	~SessionStats();
+	void note_chat(const char* text); //PrintChat, picks up loot messages
+	struct totals
+	{
+		UINT minutes = 0;
+		long long exp = 0;
+		unsigned long long damage_dealt = 0;
+		unsigned long long damage_taken = 0;
+		UINT hits_dealt = 0;
+		UINT hits_taken = 0;
+		UINT kills = 0;
+		UINT deaths = 0;
+		UINT loot = 0;
+		UINT32 last_minute = 0;
+		void add(const stats_bucket& b);
+		nlohmann::json to_json() const;
+	};
+	enum struct scope { session, today, zone };
+	totals query(scope range);
+private:
+	void callback_main();
+	void on_damage(const char* buffer, UINT len);
+	void on_death(const char* buffer, UINT len);
+	bool is_ours(WORD spawn_id); //self or our pet
+	stats_bucket& bucket(); //the open minute, rolls the previous one to disk
+	void open_file(const std::string& character);
+	void close_file();
+	void append(const stats_bucket& b);
+	void print(const char* label, const totals& t);
+	std::string character;
+	std::string path;
+	HANDLE file = INVALID_HANDLE_VALUE;
+	stats_bucket current = {};
+	bool current_open = false;
+	UINT32 session_start = 0; //minute the character was first seen
+	int last_exp = -1;
+	int last_level = -1;
+};
@@ -0,0 +1,41 @@
+#include "settings.h"
+#include <algorithm>
+
+static std::vector<SettingBase*>& registry()
+{
+	static std::vector<SettingBase*> settings;
+	return settings;
+}
+static IO_ini* bound_ini = nullptr;
+
+SettingBase::SettingBase(const char* section, const char* key) : section(section), key(key)
+{
+	registry().push_back(this);
+}
+
+SettingBase::~SettingBase()
+{
+	auto& settings = registry();
+	settings.erase(std::remove(settings.begin(), settings.end(), this), settings.end());
+}
+
+namespace Settings
+{
+	void bind(IO_ini* ini)
+	{
+		bound_ini = ini;
+		if (ini)
+			reload();
+	}
+	void reload()
+	{
+		if (!bound_ini)
+			return;
+		for (SettingBase* setting : registry())
+			setting->load(bound_ini);
+	}
+	IO_ini* ini()
+	{
+		return bound_ini;
+	}
+}
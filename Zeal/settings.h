@@ -0,0 +1,68 @@
+#pragma once
+#include <atomic>
+#include <functional>
+#include <vector>
+#include <type_traits>
+#include "IO_ini.h"
+
+// a value persisted in eqclient.ini, declared once with its section, key and default
+// every setting loads from the in-memory ini when it is bound, get() is an atomic load after that
+class SettingBase
+{
+public:
+	SettingBase(const char* section, const char* key);
+	virtual ~SettingBase();
+	SettingBase(const SettingBase&) = delete;
+	SettingBase& operator=(const SettingBase&) = delete;
+	const char* const section;
+	const char* const key;
+	virtual void load(IO_ini* ini) = 0; //reads the ini value, writing the default when the key is missing
+};
+
+namespace Settings
+{
+	void bind(IO_ini* ini); //loads everything declared so far, later settings load as they are constructed
+	void reload(); //after an external edit of the ini, fires change callbacks for values that differ
+	IO_ini* ini();
+}
+
+template<typename T>
+class Setting : public SettingBase
+{
+	static_assert(std::is_arithmetic_v<T>, "settings are stored in a std::atomic");
+public:
+	Setting(const char* section, const char* key, T default_value) : SettingBase(section, key), default_value(default_value), value(default_value)
+	{
+		if (IO_ini* ini = Settings::ini())
+			load(ini);
+	}
+	T get() const { return value.load(std::memory_order_relaxed); }
+	operator T() const { return get(); }
+	void set(T new_value, bool persist = true)
+	{
+		T old = value.exchange(new_value);
+		if (persist && Settings::ini())
+			Settings::ini()->setValue<T>(section, key, new_value);
+		if (old != new_value)
+			notify(new_value);
+	}
+	void on_change(std::function<void(T)> callback) { callbacks.push_back(callback); }
+	void load(IO_ini* ini) override
+	{
+		if (!ini->exists(section, key))
+			ini->setValue<T>(section, key, default_value);
+		T loaded = ini->getValue<T>(section, key);
+		T old = value.exchange(loaded);
+		if (old != loaded)
+			notify(loaded);
+	}
+	const T default_value;
+private:
+	void notify(T new_value)
+	{
+		for (auto& callback : callbacks)
+			callback(new_value);
+	}
+	std::atomic<T> value;
+	std::vector<std::function<void(T)>> callbacks;
+};
@@ -0,0 +1,364 @@
+#include "shared_state.h"
+#include "EqStructures.h"
+#include "EqAddresses.h"
+#include "EqFunctions.h"
+#include "Zeal.h"
+#include "string_util.h"
+
+static void copy_text(char* dest, size_t size, const char* src)
+{
+	strncpy_s(dest, size, src ? src : "", _TRUNCATE);
+}
+
+void SharedState::begin_write()
+{
+	InterlockedIncrement(&view->sequence); //odd, readers retry
+}
+
+void SharedState::end_write()
+{
+	view->tick = GetTickCount64();
+	InterlockedIncrement(&view->sequence); //even again, full barrier
+	mirror();
+}
+
+static bool process_alive(DWORD pid)
+{
+	HANDLE process = OpenProcess(SYNCHRONIZE, FALSE, pid);
+	if (!process)
+		return false;
+	bool alive = WaitForSingleObject(process, 0) == WAIT_TIMEOUT;
+	CloseHandle(process);
+	return alive;
+}
+
+void SharedState::open_registry()
+{
+	registry_lock = CreateMutexA(NULL, FALSE, "Local\\zeal_registry_lock");
+	registry_mapping = CreateFileMappingA(INVALID_HANDLE_VALUE, NULL, PAGE_READWRITE, 0, sizeof(shared_registry), "Local\\zeal_registry");
+	if (!registry_lock || !registry_mapping)
+		return;
+	registry = reinterpret_cast<shared_registry*>(MapViewOfFile(registry_mapping, FILE_MAP_ALL_ACCESS, 0, 0, sizeof(shared_registry)));
+	if (!registry)
+		return;
+	DWORD wait = WaitForSingleObject(registry_lock, 1000);
+	if (wait != WAIT_OBJECT_0 && wait != WAIT_ABANDONED) //abandoned: an instance died holding it, the slots are still consistent
+		return;
+	if (registry->version != shared_registry_version) //new section, zero filled
+	{
+		registry->version = shared_registry_version;
+		registry->slot_count = shared_registry_slots;
+	}
+	DWORD pid = GetCurrentProcessId();
+	for (shared_registry_slot& s : registry->slots)
+	{
+		if (s.pid == pid || !s.pid || !process_alive(s.pid))
+		{
+			memset(&s.state, 0, sizeof(s.state));
+			s.state.version = shared_state_version;
+			s.heartbeat = GetTickCount64();
+			s.pid = pid;
+			slot = &s;
+			break;
+		}
+	}
+	InterlockedIncrement(&registry->generation);
+	ReleaseMutex(registry_lock);
+}
+
+void SharedState::close_registry()
+{
+	if (slot && WaitForSingleObject(registry_lock, 1000) != WAIT_TIMEOUT)
+	{
+		slot->pid = 0;
+		InterlockedIncrement(&registry->generation);
+		ReleaseMutex(registry_lock);
+	}
+	slot = nullptr;
+	if (registry)
+		UnmapViewOfFile(registry);
+	registry = nullptr;
+	for (HANDLE* h : { &registry_mapping, &registry_lock })
+	{
+		if (*h)
+			CloseHandle(*h);
+		*h = nullptr;
+	}
+}
+
+void SharedState::mirror()
+{
+	if (!slot)
+		return;
+	shared_state_data& dest = slot->state;
+	LONG sequence = dest.sequence;
+	InterlockedExchange(&dest.sequence, sequence + 1); //odd
+	constexpr size_t start = offsetof(shared_state_data, tick);
+	memcpy(reinterpret_cast<char*>(&dest) + start, reinterpret_cast<const char*>(view) + start, sizeof(shared_state_data) - start);
+	slot->heartbeat = GetTickCount64();
+	InterlockedExchange(&dest.sequence, sequence + 2);
+}
+
+void SharedState::list_instances()
+{
+	if (!registry)
+	{
+		Zeal::EqGame::print_chat("The instance registry isn't available");
+		return;
+	}
+	ULONGLONG now = GetTickCount64();
+	for (const shared_registry_slot& s : registry->slots)
+	{
+		if (!s.pid)
+			continue;
+		char character[sizeof(s.state.character)];
+		memcpy(character, s.state.character, sizeof(character)); //another process may be writing it
+		character[sizeof(character) - 1] = 0;
+		Zeal::EqGame::print_chat("pid %u: %s, zone %i, updated %llums ago%s", s.pid, character[0] ? character : "(not in game)", s.state.zone_id,
+			now - s.heartbeat, &s == slot ? " (this client)" : "");
+	}
+}
+
+bool SharedState::read_leader(INT32& zone_id, INT32& target_spawn_id)
+{
+	if (!registry || leader.empty())
+		return false;
+	if (registry->generation != leader_generation) //slots were claimed or released, look the leader up again
+	{
+		leader_generation = registry->generation;
+		leader_slot = nullptr;
+		for (const shared_registry_slot& s : registry->slots)
+		{
+			char character[sizeof(s.state.character)];
+			memcpy(character, s.state.character, sizeof(character));
+			character[sizeof(character) - 1] = 0;
+			if (s.pid && &s != slot && Zeal::String::compare_insensitive(character, leader))
+			{
+				leader_slot = &s;
+				break;
+			}
+		}
+	}
+	if (!leader_slot || !leader_slot->pid)
+	{
+		leader_generation = -1; //the leader may log in on a slot that was claimed earlier, keep looking
+		return false;
+	}
+	const shared_state_data& state = leader_slot->state;
+	for (int attempt = 0; attempt < 4; ++attempt)
+	{
+		LONG before = state.sequence;
+		if (before & 1)
+			continue;
+		MemoryBarrier();
+		zone_id = state.zone_id;
+		target_spawn_id = state.target_spawn_id;
+		MemoryBarrier();
+		if (state.sequence == before)
+			return true;
+	}
+	return false;
+}
+
+// the leader's main loop already writes its target into the registry every frame, so a follower in the same zone picks
+// a new one up on its next main loop and targets it locally; nothing goes to the server the way /assist does
+void SharedState::sync_target()
+{
+	INT32 zone_id = 0, target_id = 0;
+	if (leader.empty() || !Zeal::EqGame::is_in_game() || !read_leader(zone_id, target_id))
+		return;
+	Zeal::EqStructures::Entity* self = Zeal::EqGame::get_self();
+	if (!self || zone_id != static_cast<INT32>(self->ZoneId) || target_id == leader_target)
+		return;
+	leader_target = target_id;
+	if (!target_id)
+		return; //the leader dropping a target leaves ours alone
+	Zeal::EqStructures::Entity* ent = ZealService::get_instance()->entity_manager->get(static_cast<WORD>(target_id));
+	if (ent && ent != self && ent != Zeal::EqGame::get_target())
+		Zeal::EqGame::set_target(ent);
+}
+
+void SharedState::update()
+{
+	if (!view)
+		return;
+	Zeal::EqStructures::Entity* self = Zeal::EqGame::get_self();
+	Zeal::EqStructures::Entity* target = Zeal::EqGame::get_target();
+	begin_write();
+	if (self && Zeal::EqGame::is_in_game())
+	{
+		copy_text(view->character, sizeof(view->character), self->Name);
+		view->zone_id = static_cast<INT32>(self->ZoneId);
+		view->x = self->Position.x;
+		view->y = self->Position.y;
+		view->z = self->Position.z;
+		view->heading = self->Heading;
+		view->hp_current = static_cast<INT32>(self->HpCurrent);
+		view->hp_max = static_cast<INT32>(self->HpMax);
+	}
+	else
+	{
+		view->character[0] = 0;
+		view->zone_id = 0;
+	}
+	if (target && self)
+	{
+		view->target_spawn_id = target->SpawnId;
+		view->target_hp_percent = target->HpMax ? static_cast<INT32>(target->HpCurrent * 100 / target->HpMax) : 0;
+		copy_text(view->target_name, sizeof(view->target_name), target->Name);
+	}
+	else
+	{
+		view->target_spawn_id = 0;
+		view->target_hp_percent = 0;
+		view->target_name[0] = 0;
+	}
+	end_write();
+}
+
+void SharedState::update_labels()
+{
+	if (!view || !Zeal::EqGame::is_in_game())
+		return;
+	labels* l = ZealService::get_instance()->labels_hook.get();
+	if (!l)
+		return;
+	// gathered outside of the write window so readers are only held off for the copies
+	shared_label label_values[shared_state_max_labels];
+	shared_gauge gauge_values[shared_state_max_gauges];
+	shared_group_member group[5];
+	int label_count = 0;
+	int gauge_count = 0;
+	std::string value;
+	for (int id : l->label_ids())
+	{
+		if (label_count >= shared_state_max_labels)
+			break;
+		value.clear();
+		if (!l->GetLabel(id, value))
+			continue;
+		label_values[label_count].id = id;
+		copy_text(label_values[label_count].value, sizeof(label_values[label_count].value), value.c_str());
+		label_count++;
+	}
+	for (int id : l->gauge_ids())
+	{
+		if (gauge_count >= shared_state_max_gauges)
+			break;
+		value.clear();
+		gauge_values[gauge_count].id = id;
+		gauge_values[gauge_count].value = l->GetGauge(id, value);
+		copy_text(gauge_values[gauge_count].text, sizeof(gauge_values[gauge_count].text), value.c_str());
+		gauge_count++;
+	}
+	for (int i = 0; i < 5; i++)
+	{
+		value.clear();
+		l->GetLabel(30 + i, value); //GroupMember1Name
+		copy_text(group[i].name, sizeof(group[i].name), value.c_str());
+		value.clear();
+		l->GetLabel(35 + i, value); //GroupMember1HPPerc
+		group[i].hp_percent = atoi(value.c_str());
+	}
+
+	begin_write();
+	view->label_count = label_count;
+	memcpy(view->labels, label_values, sizeof(shared_label) * label_count);
+	view->gauge_count = gauge_count;
+	memcpy(view->gauges, gauge_values, sizeof(shared_gauge) * gauge_count);
+	memcpy(view->group, group, sizeof(group));
+	end_write();
+}
+
+void SharedState::update_buffs()
+{
+	BuffTimers* timers = ZealService::get_instance()->buff_timers.get();
+	if (!view || !timers || timers->version() == buff_version)
+		return;
+	buff_version = timers->version();
+	shared_buff buffs[shared_state_max_buffs];
+	int count = 0;
+	const auto& tracked = timers->get();
+	for (size_t i = 0; i < tracked.size() && count < shared_state_max_buffs; i++)
+	{
+		if (tracked[i].empty())
+			continue;
+		Zeal::EqStructures::SPELL* spell = ZealService::get_instance()->spell_index->get(tracked[i].spell_id);
+		buffs[count].slot = static_cast<INT32>(i + 1);
+		buffs[count].spell_id = tracked[i].spell_id;
+		buffs[count].expires = tracked[i].expires;
+		copy_text(buffs[count].name, sizeof(buffs[count].name), spell ? spell->Name : nullptr);
+		count++;
+	}
+	begin_write();
+	view->buff_count = count;
+	memcpy(view->buffs, buffs, sizeof(shared_buff) * count);
+	end_write();
+}
+
+SharedState::SharedState(ZealService* zeal, IO_ini* ini)
+{
+	name += std::to_string(GetCurrentProcessId());
+	mapping = CreateFileMappingA(INVALID_HANDLE_VALUE, NULL, PAGE_READWRITE, 0, sizeof(shared_state_data), name.c_str());
+	if (!mapping)
+		return;
+	view = reinterpret_cast<shared_state_data*>(MapViewOfFile(mapping, FILE_MAP_ALL_ACCESS, 0, 0, sizeof(shared_state_data)));
+	if (!view)
+	{
+		CloseHandle(mapping);
+		mapping = nullptr;
+		return;
+	}
+	memset(view, 0, sizeof(shared_state_data));
+	view->version = shared_state_version;
+	open_registry();
+	zeal->commands_hook->add("/zealinstances", {}, "Lists the Zeal clients on this machine from the shared registry.",
+		[this](std::vector<std::string>& args) {
+			list_instances();
+			return true;
+		});
+	zeal->commands_hook->add("/targetsync", { "/tsync" }, "Follows another Zeal client's target on this machine without assist packets, /targetsync <character> | off.",
+		[this](std::vector<std::string>& args) {
+			if (args.size() < 2)
+			{
+				if (leader.empty())
+					Zeal::EqGame::print_chat("Not following a target, usage: /targetsync <character> | off");
+				else
+					Zeal::EqGame::print_chat("Following %s's target", leader.c_str());
+				return true;
+			}
+			if (Zeal::String::compare_insensitive(args[1], "off"))
+			{
+				leader.clear();
+				Zeal::EqGame::print_chat("Target sync is off");
+				return true;
+			}
+			leader = args[1];
+			leader_slot = nullptr;
+			leader_generation = -1;
+			leader_target = 0;
+			Zeal::EqGame::print_chat("Following %s's target", leader.c_str());
+			return true;
+		});
+	zeal->callbacks->add_generic([this]() { update(); sync_target(); }, callback_type::MainLoop);
+	zeal->callbacks->add_generic([this]() { leader_target = 0; }, callback_type::Zone); //spawn ids mean something else in the new zone
+	zeal->callbacks->add_work([this](int) { update_labels(); update_buffs(); return false; }, 100); //labels are ui strings, every frame would mostly rebuild identical text
+	zeal->callbacks->add_generic([this]() {
+		if (!view)
+			return;
+		begin_write();
+		view->label_count = 0;
+		view->gauge_count = 0;
+		memset(view->group, 0, sizeof(view->group));
+		end_write();
+		}, callback_type::CharacterSelect);
+}
+
+SharedState::~SharedState()
+{
+	close_registry();
+	if (view)
+		UnmapViewOfFile(view);
+	if (mapping)
+		CloseHandle(mapping);
+}
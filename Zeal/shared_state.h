@@ -0,0 +1,109 @@
+#pragma once
+#include <Windows.h>
+#include <string>
+
+// fixed layout state published in the named section Local\zeal_<pid> for overlays on the same machine
+// readers: read sequence, copy the struct, read sequence again; retry if it changed or was odd
+static constexpr UINT32 shared_state_version = 2;
+static constexpr int shared_state_max_labels = 96;
+static constexpr int shared_state_max_gauges = 32;
+static constexpr int shared_state_max_buffs = 15;
+#pragma pack(push, 4)
+struct shared_label
+{
+	INT32 id;
+	char value[64];
+};
+struct shared_gauge
+{
+	INT32 id;
+	INT32 value; //0-1000
+	char text[32];
+};
+struct shared_buff
+{
+	INT32 slot; //1 based
+	INT32 spell_id;
+	UINT64 expires; //GetTickCount64 time it fades, rewritten only when the buff starts or is refreshed
+	char name[32];
+};
+struct shared_group_member
+{
+	char name[64];
+	INT32 hp_percent;
+};
+struct shared_state_data
+{
+	UINT32 version;
+	volatile LONG sequence; //odd while the game thread is writing
+	UINT64 tick; //GetTickCount64 of the last update
+	char character[64];
+	INT32 zone_id;
+	float x;
+	float y;
+	float z;
+	float heading;
+	INT32 hp_current;
+	INT32 hp_max;
+	INT32 target_spawn_id; //0 when there is no target
+	INT32 target_hp_percent;
+	char target_name[64];
+	shared_group_member group[5];
+	INT32 label_count;
+	shared_label labels[shared_state_max_labels];
+	INT32 gauge_count;
+	shared_gauge gauges[shared_state_max_gauges];
+	INT32 buff_count;
+	shared_buff buffs[shared_state_max_buffs];
+};
+
+// every instance on the machine also claims a slot in Local\zeal_registry (guarded by the named mutex Local\zeal_registry_lock)
+// and mirrors its state there, so an overlay finds and reads all clients through one mapping
+// a slot whose pid is 0 is free, a slot whose process is gone is reclaimed by the next instance that starts
+static constexpr UINT32 shared_registry_version = 2; //slots embed shared_state_data, bumped with it
+static constexpr int shared_registry_slots = 16;
+struct shared_registry_slot
+{
+	UINT32 pid;
+	UINT64 heartbeat; //GetTickCount64 of the last mirror, a stalled client stops moving
+	shared_state_data state; //same sequence protocol as the per process section
+};
+struct shared_registry
+{
+	UINT32 version;
+	UINT32 slot_count;
+	volatile LONG generation; //bumped whenever a slot is claimed or released
+	shared_registry_slot slots[shared_registry_slots];
+};
+#pragma pack(pop)
+
+class SharedState
+{
+public:
+	SharedState(class ZealService* zeal, class IO_ini* ini);
+	~SharedState();
+private:
+	void update();
+	void update_labels();
+	void update_buffs();
+	void begin_write();
+	void end_write();
+	void open_registry();
+	void close_registry();
+	void mirror(); //copies the state into our registry slot
+	void list_instances();
+	bool read_leader(INT32& zone_id, INT32& target_spawn_id); //a consistent copy from the leader's registry slot
+	void sync_target();
+	HANDLE mapping = nullptr;
+	shared_state_data* view = nullptr;
+	std::string name = "Local\\zeal_";
+	HANDLE registry_mapping = nullptr;
+	HANDLE registry_lock = nullptr;
+	shared_registry* registry = nullptr;
+	shared_registry_slot* slot = nullptr;
+	UINT buff_version = 0; //BuffTimers::version() last copied
+	std::string leader; //the character whose target this client follows, empty when not following
+	const shared_registry_slot* leader_slot = nullptr;
+	LONG leader_generation = -1; //registry generation leader_slot was found in
+	INT32 leader_target = 0; //the leader's target id last acted on, only changes are followed
+};
@@ -0,0 +1,302 @@
+#include "spawn_tracker.h"
+#include "Zeal.h"
+#include "EqFunctions.h"
+#include "EqPackets.h"
+#include "string_util.h"
+#include <algorithm>
+#include <climits>
+#include <ctime>
+#include <fstream>
+
+static constexpr float point_radius = 10.f; //a respawn this close to a point is the same point
+static constexpr UINT32 max_interval = 7 * 24 * 3600; //longer gaps are a missed respawn, not a timer
+
+static bool contains_insensitive(const char* text, const std::string& lowered_needle)
+{
+	const char* end = text + strlen(text);
+	return std::search(text, end, lowered_needle.begin(), lowered_needle.end(),
+		[](char a, char b) { return tolower((unsigned char)a) == b; }) != end;
+}
+
+static UINT32 now_seconds()
+{
+	return static_cast<UINT32>(time(nullptr));
+}
+
+std::string SpawnTracker::path(DWORD zone_id)
+{
+	return "spawns\\" + std::to_string(zone_id) + ".zspn";
+}
+
+void SpawnTracker::load(DWORD zone_id)
+{
+	points.clear();
+	timers.clear();
+	live.clear();
+	loaded_zone = zone_id;
+	changed = false;
+	std::ifstream in(path(zone_id), std::ios::binary);
+	spawn_file_header header = {};
+	if (in.is_open() && in.read(reinterpret_cast<char*>(&header), sizeof(header)) && header.magic == spawn_file_magic &&
+		header.version == spawn_file_version && header.zone_id == zone_id && header.point_count < 0x10000)
+	{
+		points.resize(header.point_count);
+		if (!in.read(reinterpret_cast<char*>(points.data()), points.size() * sizeof(spawn_point)))
+			points.clear();
+	}
+	timers.resize(points.size(), 0);
+	for (size_t i = 0; i < points.size(); i++)
+		schedule(static_cast<int>(i));
+}
+
+void SpawnTracker::save()
+{
+	if (!changed || loaded_zone == 0xFFFFFFFF)
+		return;
+	changed = false;
+	CreateDirectoryA("spawns", NULL);
+	std::ofstream out(path(loaded_zone), std::ios::binary | std::ios::trunc);
+	if (!out.is_open())
+	{
+		ZEAL_LOG_WARN("spawns", "could not write %s", path(loaded_zone));
+		return;
+	}
+	spawn_file_header header = { spawn_file_magic, spawn_file_version, loaded_zone, static_cast<UINT32>(points.size()) };
+	out.write(reinterpret_cast<const char*>(&header), sizeof(header));
+	if (points.size())
+		out.write(reinterpret_cast<const char*>(points.data()), points.size() * sizeof(spawn_point));
+}
+
+bool SpawnTracker::ensure_zone()
+{
+	Zeal::EqStructures::Entity* self = Zeal::EqGame::get_self();
+	if (!self)
+		return false;
+	if (self->ZoneId != loaded_zone)
+		load(self->ZoneId);
+	return true;
+}
+
+int SpawnTracker::find_point(const Vec3& pos) const
+{
+	int best = -1;
+	float best_dist = point_radius * point_radius;
+	for (size_t i = 0; i < points.size(); i++)
+	{
+		float dist = Vec3(points[i].x, points[i].y, points[i].z).Dist2(pos);
+		if (dist <= best_dist)
+		{
+			best = static_cast<int>(i);
+			best_dist = dist;
+		}
+	}
+	return best;
+}
+
+UINT32 SpawnTracker::predicted(const spawn_point& p)
+{
+	if (!p.samples)
+		return 0;
+	UINT32 sorted[spawn_samples];
+	std::copy(p.intervals, p.intervals + p.samples, sorted);
+	std::sort(sorted, sorted + p.samples);
+	return sorted[p.samples / 2];
+}
+
+void SpawnTracker::on_spawned(Zeal::EqStructures::Entity* ent)
+{
+	if (ent->Type != Zeal::EqEnums::NPC || ent->PetOwnerSpawnId || !ensure_zone())
+		return;
+	std::string pattern = ent->Name;
+	while (pattern.length() && isdigit(static_cast<unsigned char>(pattern.back())))
+		pattern.pop_back();
+	int index = find_point(ent->Position);
+	if (index < 0)
+	{
+		spawn_point p = {};
+		p.x = static_cast<INT16>(ent->Position.x);
+		p.y = static_cast<INT16>(ent->Position.y);
+		p.z = static_cast<INT16>(ent->Position.z);
+		points.push_back(p);
+		timers.push_back(0);
+		index = static_cast<int>(points.size() - 1);
+	}
+	spawn_point& p = points[index];
+	UINT32 now = now_seconds();
+	// a down from before the zone in came back at some unknown point while we were away
+	if (p.down_since && p.down_since >= entered && now > p.down_since && now - p.down_since < max_interval)
+	{
+		std::copy_backward(p.intervals, p.intervals + spawn_samples - 1, p.intervals + spawn_samples);
+		p.intervals[0] = now - p.down_since;
+		if (p.samples < spawn_samples)
+			p.samples++;
+		publish("up", p, static_cast<int>(p.intervals[0]));
+	}
+	p.down_since = 0;
+	strncpy_s(p.pattern, pattern.c_str(), _TRUNCATE);
+	p.level = ent->Level;
+	if (timers[index])
+		ZealService::get_instance()->callbacks->cancel_timer(timers[index]);
+	timers[index] = 0;
+	live[ent->SpawnId] = index;
+	changed = true;
+}
+
+void SpawnTracker::on_down(WORD spawn_id, WORD killer_id)
+{
+	auto it = live.find(spawn_id);
+	if (it == live.end())
+		return;
+	spawn_point& p = points[it->second];
+	live.erase(it);
+	p.down_since = now_seconds();
+	Zeal::EqStructures::Entity* killer = killer_id ? ZealService::get_instance()->entity_manager->get(killer_id) : nullptr;
+	strncpy_s(p.killer, killer ? killer->Name : "", _TRUNCATE);
+	changed = true;
+	publish("down", p, static_cast<int>(predicted(p)));
+	schedule(static_cast<int>(&p - points.data()));
+}
+
+// the warning timer fires first and arms the respawn one, a point without samples only has its down recorded
+void SpawnTracker::schedule(int index)
+{
+	CallbackManager* callbacks = ZealService::get_instance()->callbacks.get();
+	if (timers[index])
+		callbacks->cancel_timer(timers[index]);
+	timers[index] = 0;
+	const spawn_point& p = points[index];
+	UINT32 interval = predicted(p);
+	if (!p.down_since || !interval)
+		return;
+	LONGLONG due = static_cast<LONGLONG>(p.down_since) + interval - now_seconds();
+	LONGLONG warn = due - (warn_seconds.get() > 0 ? warn_seconds.get() : 0);
+	if (due < 0)
+		return; //overdue, it spawned while nobody was here to see it
+	bool warning = warn > 0 && warn_seconds.get() > 0;
+	timers[index] = callbacks->add_delayed([this, index, warning]() { timers[index] = 0; fire(index, warning); }, static_cast<int>((warning ? warn : due) * 1000));
+}
+
+void SpawnTracker::fire(int index, bool warning)
+{
+	spawn_point& p = points[index];
+	if (!p.down_since)
+		return;
+	int due = static_cast<int>(static_cast<LONGLONG>(p.down_since) + predicted(p) - now_seconds());
+	if (announce.get())
+	{
+		if (warning)
+			Zeal::EqGame::print_chat("[Spawn] %s (%i, %i) in %is", p.pattern, p.y, p.x, due);
+		else
+			Zeal::EqGame::print_chat("[Spawn] %s (%i, %i) is due", p.pattern, p.y, p.x);
+	}
+	publish(warning ? "warning" : "due", p, due);
+	if (warning)
+	{
+		int ms = due > 0 ? due * 1000 : 0;
+		timers[index] = ZealService::get_instance()->callbacks->add_delayed([this, index]() { timers[index] = 0; fire(index, false); }, ms);
+	}
+}
+
+void SpawnTracker::publish(const char* event, const spawn_point& p, int seconds) const
+{
+	ZealService* zeal = ZealService::get_instance();
+	if (!zeal->pipe)
+		return;
+	nlohmann::json root = { {"spawn", { {"event", event}, {"name", p.pattern}, {"killer", p.killer}, {"level", p.level}, {"zone", loaded_zone},
+		{"x", p.x}, {"y", p.y}, {"z", p.z}, {"seconds", seconds}, {"samples", p.samples} }} };
+	zeal->pipe->write(root.dump(-1, ' ', false, nlohmann::json::error_handler_t::replace), pipe_data_type::custom);
+}
+
+void SpawnTracker::print_list(const std::string& filter)
+{
+	UINT32 now = now_seconds();
+	std::string needle = filter;
+	std::transform(needle.begin(), needle.end(), needle.begin(), [](char c) { return (char)tolower((unsigned char)c); });
+	std::vector<int> shown;
+	for (size_t i = 0; i < points.size(); i++)
+	{
+		const spawn_point& p = points[i];
+		if (needle.length() ? contains_insensitive(p.pattern, needle) : p.down_since != 0)
+			shown.push_back(static_cast<int>(i));
+	}
+	// soonest respawn first, points without a prediction after them
+	auto remaining = [&](int i) {
+		const spawn_point& p = points[i];
+		UINT32 interval = predicted(p);
+		return p.down_since && interval ? static_cast<LONGLONG>(p.down_since) + interval - now : LLONG_MAX;
+	};
+	std::sort(shown.begin(), shown.end(), [&](int a, int b) { return remaining(a) < remaining(b); });
+	Zeal::EqGame::print_chat("--- spawn points (%u known, %u listed) ---", (UINT)points.size(), (UINT)shown.size());
+	for (int i : shown)
+	{
+		const spawn_point& p = points[i];
+		UINT32 interval = predicted(p);
+		LONGLONG left = remaining(i);
+		if (!p.down_since)
+			Zeal::EqGame::print_chat("%s L%u (%i, %i) up, respawn %us over %u", p.pattern, p.level, p.y, p.x, interval, p.samples);
+		else if (!interval)
+			Zeal::EqGame::print_chat("%s L%u (%i, %i) down %us, no timer yet", p.pattern, p.level, p.y, p.x, now - p.down_since);
+		else
+			Zeal::EqGame::print_chat("%s L%u (%i, %i) %s %llis, respawn %us over %u", p.pattern, p.level, p.y, p.x, left >= 0 ? "due in" : "overdue", left >= 0 ? left : -left,
+				interval, p.samples);
+	}
+}
+
+SpawnTracker::SpawnTracker(ZealService* zeal)
+{
+	zeal->memory_report->add("spawn tracker", [this]() {
+		return Zeal::Memory::usage{ Zeal::Memory::vector_bytes(points) + Zeal::Memory::vector_bytes(timers) + Zeal::Memory::hash_bytes(live), points.size() };
+	});
+	entered = now_seconds();
+	subscription = zeal->entity_manager->subscribe([this](const entity_event& e) { if (e.ent) on_spawned(e.ent); }, 1u << (int)entity_event_type::spawned);
+	zeal->callbacks->add_packet([this](UINT opcode, char* buffer, UINT len) {
+		if (len >= sizeof(Zeal::Packets::Death_Struct))
+		{
+			const Zeal::Packets::Death_Struct* death = reinterpret_cast<const Zeal::Packets::Death_Struct*>(buffer);
+			on_down(death->spawn_id, death->killer_id);
+		}
+		return false;
+	}, { Zeal::Packets::DeathDamage });
+	zeal->callbacks->add_packet([this](UINT opcode, char* buffer, UINT len) {
+		if (len >= sizeof(Zeal::Packets::DeleteSpawn_Struct)) //a corpse rotting was already down at the death, only npcs that depop get here
+			on_down(reinterpret_cast<const Zeal::Packets::DeleteSpawn_Struct*>(buffer)->spawn_id, 0);
+		return false;
+	}, { Zeal::Packets::DeleteSpawn });
+	zeal->callbacks->add_generic([this]() {
+		save();
+		for (UINT id : timers)
+			if (id)
+				ZealService::get_instance()->callbacks->cancel_timer(id);
+		points.clear();
+		timers.clear();
+		live.clear();
+		loaded_zone = 0xFFFFFFFF;
+		entered = now_seconds();
+	}, callback_type::Zone);
+	zeal->callbacks->add_work([this](int) { save(); return false; }, 60000, work_priority::low);
+	zeal->commands_hook->add("/spawns", {}, "Spawn points seen in this zone and their respawn timers, /spawns <name> to search, /spawns clear to forget the zone.",
+		[this](std::vector<std::string>& args) {
+			if (!ensure_zone())
+				return true;
+			if (args.size() > 1 && Zeal::String::compare_insensitive(args[1], "clear"))
+			{
+				for (UINT id : timers)
+					if (id)
+						ZealService::get_instance()->callbacks->cancel_timer(id);
+				points.clear();
+				timers.clear();
+				live.clear();
+				changed = true;
+				save();
+				Zeal::EqGame::print_chat("Spawn points for this zone cleared");
+				return true;
+			}
+			print_list(args.size() > 1 ? args[1] : "");
+			return true;
+		});
+}
+
+SpawnTracker::~SpawnTracker()
+{
+	save();
+}
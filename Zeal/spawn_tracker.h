@@ -0,0 +1,60 @@
+#pragma once
+#include <Windows.h>
+#include <string>
+#include <vector>
+#include <unordered_map>
+#include "settings.h"
+#include "entity_manager.h"
+
+// spawns\<zone id>.zspn: a spawn_file_header followed by point_count spawn_point
+static constexpr UINT32 spawn_file_magic = 0x4E50535A; //ZSPN
+static constexpr UINT32 spawn_file_version = 1;
+static constexpr int spawn_samples = 4;
+struct spawn_file_header
+{
+	UINT32 magic;
+	UINT32 version;
+	UINT32 zone_id;
+	UINT32 point_count;
+};
+struct spawn_point
+{
+	char pattern[32]; //the last npc up here without its trailing digits, a placeholder and its named share the point
+	char killer[32];
+	INT16 x, y, z; //where it spawned, whole units
+	UINT8 level;
+	UINT8 samples;
+	UINT32 down_since; //unix time of the kill or despawn, 0 while up
+	UINT32 intervals[spawn_samples]; //seconds from down to up again, newest first
+};
+
+// npc spawn points per zone from spawn, death and despawn traffic. every respawn seen while in the zone is a sample
+// of the point's timer, a point that is down gets a one shot callback timer for the warning and for its predicted respawn
+class SpawnTracker
+{
+public:
+	SpawnTracker(class ZealService* zeal);
+	~SpawnTracker();
+	static UINT32 predicted(const spawn_point& p); //median seconds from down to up, 0 without samples
+	Setting<int> warn_seconds{ "Zeal", "SpawnWarnSeconds", 30 };
+	Setting<bool> announce{ "Zeal", "SpawnAnnounce", true }; //chat lines when a timer fires, the pipe gets them either way
+private:
+	static std::string path(DWORD zone_id);
+	void load(DWORD zone_id);
+	void save();
+	bool ensure_zone();
+	int find_point(const Vec3& pos) const;
+	void on_spawned(Zeal::EqStructures::Entity* ent);
+	void on_down(WORD spawn_id, WORD killer_id);
+	void schedule(int index);
+	void fire(int index, bool warning);
+	void publish(const char* event, const spawn_point& p, int seconds) const;
+	void print_list(const std::string& filter);
+	std::vector<spawn_point> points; //only ever appended to while the zone is loaded, timers hold indices
+	std::vector<UINT> timers; //parallel to points, pending callback id or 0
+	std::unordered_map<WORD, int> live; //spawn id of an npc that is up -> its point
+	DWORD loaded_zone = 0xFFFFFFFF;
+	UINT32 entered = 0; //unix time of the zone in, downs before it can't give a sample
+	bool changed = false;
+	UINT subscription = 0;
+};
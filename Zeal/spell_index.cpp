@@ -0,0 +1,180 @@
+#include "spell_index.h"
+#include "Zeal.h"
+#include "string_util.h"
+#include <algorithm>
+
+static std::string to_lower(const char* text)
+{
+	std::string lower = text ? text : "";
+	std::transform(lower.begin(), lower.end(), lower.begin(), [](unsigned char c) { return (char)std::tolower(c); });
+	return lower;
+}
+
+void SpellIndex::build()
+{
+	Zeal::EqStructures::SPELLMGR* mgr = Zeal::EqGame::get_spell_mgr();
+	if (!mgr)
+		return;
+	ZEAL_PROFILE_SCOPE("spell index build");
+	names.clear();
+	for (auto& list : by_class)
+		list.clear();
+	for (int id = 0; id < max_spells; ++id)
+	{
+		Zeal::EqStructures::SPELL* spell = mgr->Spells[id];
+		spells[id] = (spell && spell->Name && spell->Name[0]) ? spell : nullptr;
+		if (!spells[id])
+			continue;
+		names.push_back({ to_lower(spell->Name), (WORD)id });
+		for (int c = 0; c < class_count; ++c)
+		{
+			if (spell->Level[c] && spell->Level[c] < 255) //255 is unusable by the class
+				by_class[c].push_back((WORD)id);
+		}
+	}
+	std::sort(names.begin(), names.end(), [](const name_entry& a, const name_entry& b) {
+		if (int c = a.name.compare(b.name))
+			return c < 0;
+		return a.spell_id < b.spell_id;
+	});
+	for (int c = 0; c < class_count; ++c)
+	{
+		std::stable_sort(by_class[c].begin(), by_class[c].end(), [this, c](WORD a, WORD b) { return spells[a]->Level[c] < spells[b]->Level[c]; });
+	}
+	built = names.size() > 0;
+}
+
+void SpellIndex::ensure()
+{
+	if (!built && Zeal::EqGame::is_in_game())
+		build();
+}
+
+Zeal::EqStructures::SPELL* SpellIndex::get(int spell_id)
+{
+	if (spell_id < 0 || spell_id >= max_spells)
+		return nullptr;
+	ensure();
+	return spells[spell_id];
+}
+
+int SpellIndex::find(const std::string& name)
+{
+	ensure();
+	std::string lower = to_lower(name.c_str());
+	auto it = std::lower_bound(names.begin(), names.end(), lower, [](const name_entry& e, const std::string& key) { return e.name < key; });
+	return it != names.end() && it->name == lower ? it->spell_id : -1;
+}
+
+void SpellIndex::find_prefix(const std::string& prefix, std::vector<WORD>& out, size_t limit)
+{
+	out.clear();
+	ensure();
+	std::string lower = to_lower(prefix.c_str());
+	auto it = std::lower_bound(names.begin(), names.end(), lower, [](const name_entry& e, const std::string& key) { return e.name < key; });
+	for (; it != names.end() && out.size() < limit && it->name.compare(0, lower.size(), lower) == 0; ++it)
+		out.push_back(it->spell_id);
+}
+
+const std::vector<WORD>& SpellIndex::class_spells(int class_id)
+{
+	static const std::vector<WORD> empty;
+	ensure();
+	if (class_id < 1 || class_id > class_count)
+		return empty;
+	return by_class[class_id - 1];
+}
+
+int SpellIndex::level(int spell_id, int class_id)
+{
+	Zeal::EqStructures::SPELL* spell = get(spell_id);
+	if (!spell || class_id < 1 || class_id > class_count || spell->Level[class_id - 1] == 255)
+		return 0;
+	return spell->Level[class_id - 1];
+}
+
+// an exact name wins, otherwise the prefix has to pick out a single memorized spell
+bool SpellIndex::cast(const std::string& name)
+{
+	Zeal::EqStructures::Entity* self = Zeal::EqGame::get_self();
+	if (!self || !self->CharInfo)
+		return false;
+	Zeal::EqStructures::EQCHARINFO* char_info = self->CharInfo;
+	std::vector<WORD> matches;
+	int exact = find(name);
+	if (exact != -1)
+		matches.push_back((WORD)exact);
+	else
+		find_prefix(name, matches, max_spells);
+	int gem = -1;
+	int found = 0;
+	for (int i = 0; i < EQ_NUM_SPELL_GEMS; ++i)
+	{
+		short memorized = char_info->MemorizedSpell[i];
+		if (memorized >= 0 && std::find(matches.begin(), matches.end(), (WORD)memorized) != matches.end())
+		{
+			if (!found++)
+				gem = i;
+		}
+	}
+	if (!found)
+	{
+		if (!matches.size())
+			Zeal::EqGame::print_chat("No spell named [%s]", name.c_str());
+		else
+			Zeal::EqGame::print_chat("[%s] is not memorized", matches.size() == 1 ? spells[matches[0]]->Name : name.c_str());
+		return false;
+	}
+	if (found > 1 && exact == -1)
+	{
+		Zeal::EqGame::print_chat("[%s] matches %i memorized spells, be more specific", name.c_str(), found);
+		return false;
+	}
+	char_info->cast(gem, char_info->MemorizedSpell[gem], 0, 0);
+	return true;
+}
+
+SpellIndex::SpellIndex(ZealService* zeal)
+{
+	zeal->callbacks->add_generic([this]() { if (!built) build(); }, callback_type::InitUI); //the spells load once per client run, an index warmed at character select stays valid
+	zeal->commands_hook->add("/cast", {}, "Casts a memorized spell by gem or by name, a unique prefix is enough, /cast <gem | spell name>.",
+		[this](std::vector<std::string>& args) {
+			int gem = 0;
+			if (args.size() < 2 || (args.size() == 2 && Zeal::String::tryParse(args[1], &gem)))
+				return false; //the client's own /cast <gem>
+			std::string name = args[1];
+			for (size_t i = 2; i < args.size(); ++i)
+				name += " " + args[i];
+			cast(name);
+			return true;
+		});
+	zeal->commands_hook->add("/findspell", {}, "Lists spells starting with a name and the level your class gets them, /findspell <partial name>.",
+		[this](std::vector<std::string>& args) {
+			if (args.size() < 2)
+			{
+				Zeal::EqGame::print_chat("usage: /findspell <partial name>");
+				return true;
+			}
+			std::string name = args[1];
+			for (size_t i = 2; i < args.size(); ++i)
+				name += " " + args[i];
+			std::vector<WORD> matches;
+			find_prefix(name, matches, 20);
+			Zeal::EqStructures::Entity* self = Zeal::EqGame::get_self();
+			int class_id = self && self->CharInfo ? self->CharInfo->Class : 0;
+			for (WORD id : matches)
+			{
+				int lvl = level(id, class_id);
+				if (lvl)
+					Zeal::EqGame::print_chat("%s (%i), level %i", spells[id]->Name, id, lvl);
+				else
+					Zeal::EqGame::print_chat("%s (%i)", spells[id]->Name, id);
+			}
+			Zeal::EqGame::print_chat("%i matches", (int)matches.size());
+			return true;
+		});
+}
+
+SpellIndex::~SpellIndex()
+{
+}
@@ -0,0 +1,37 @@
+#pragma once
+#include <Windows.h>
+#include <array>
+#include <string>
+#include <vector>
+#include "EqStructures.h"
+
+// read only views over the game's spell table, built once the spells are loaded (InitUI) and shared by every feature
+// the id table is bounds checked, names are searched by lowercase prefix in a sorted vector and each class has its spells sorted by level
+class SpellIndex
+{
+public:
+	SpellIndex(class ZealService* zeal);
+	~SpellIndex();
+	static constexpr int max_spells = 4000;
+	static constexpr int class_count = 15;
+	Zeal::EqStructures::SPELL* get(int spell_id); //nullptr for out of range or unused ids
+	int find(const std::string& name); //exact, case insensitive, -1 when unknown
+	void find_prefix(const std::string& prefix, std::vector<WORD>& out, size_t limit = 32); //alphabetical
+	const std::vector<WORD>& class_spells(int class_id); //ascending level, class_id 1 based like EQCHARINFO::Class
+	int level(int spell_id, int class_id); //0 when the class can't use it
+	size_t size() { ensure(); return names.size(); }
+	void warm() { if (!built) build(); } //at character select, the spell file is already loaded
+private:
+	struct name_entry
+	{
+		std::string name; //lowercase
+		WORD spell_id;
+	};
+	void build();
+	void ensure(); //builds on first use when Zeal was loaded in game, after InitUI already fired
+	bool cast(const std::string& name);
+	bool built = false;
+	std::array<Zeal::EqStructures::SPELL*, max_spells> spells = {};
+	std::vector<name_entry> names; //sorted by name then id
+	std::array<std::vector<WORD>, class_count> by_class;
+};
@@ -4,80 +4,107 @@
 #include "EqAddresses.h"
 #include "SpellCategories.h"
 #include <algorithm>
+#include <array>
+
+static const std::string spellset_prefix = "spellset/";
 
 void SpellSets::save(const std::string& name)
 {
-    set_ini();
+    import_ini();
     Zeal::EqGame::print_chat("Saving spellset [%s]", name.c_str());
+    std::array<short, EQ_NUM_SPELL_GEMS> gems;
     for (size_t i = 0; i < EQ_NUM_SPELL_GEMS; i++)
-    {
-        ini->setValue(name, std::to_string(i), Zeal::EqGame::get_self()->CharInfo->MemorizedSpell[i]);
-    }
-    destroy_context_menus();
+        gems[i] = Zeal::EqGame::get_self()->CharInfo->MemorizedSpell[i];
+    ZealService::get_instance()->character_store->set(spellset_prefix + name, gems);
     create_context_menus(true);
 }
 void SpellSets::remove(const std::string& name)
 {
-    set_ini();
+    import_ini();
     Zeal::EqGame::print_chat("Removing spellset [%s]", name.c_str());
-    if (!ini->deleteSection(name))
+    if (!ZealService::get_instance()->character_store->erase(spellset_prefix + name))
         Zeal::EqGame::print_chat("Error removing spellset [%s]", name.c_str());
-    destroy_context_menus();
     create_context_menus(true);
 }
+std::vector<std::string> SpellSets::set_names()
+{
+    import_ini();
+    std::vector<std::string> names = ZealService::get_instance()->character_store->keys(spellset_prefix);
+    for (std::string& name : names)
+        name.erase(0, spellset_prefix.length());
+    return names;
+}
 void SpellSets::remove_selected()
 {
     remove(ui_selected_name);
 }
 void SpellSets::load(const std::string& name)
 {
-    set_ini();
+    import_ini();
     mem_buffer.clear();
 
-
-    if (!ini->exists(name, "0"))
+    std::array<short, EQ_NUM_SPELL_GEMS> gems;
+    if (!ZealService::get_instance()->character_store->get(spellset_prefix + name, gems))
     {
         Zeal::EqGame::print_chat("The spellset [%s] does not exist", name.c_str());
         return;
     }
     Zeal::EqGame::print_chat("Loading spellset [%s]", name.c_str());
 
+    Zeal::EqStructures::EQCHARINFO* self_char = Zeal::EqGame::get_self()->CharInfo;
+    int skipped = 0;
     for (size_t gem_index = 0; gem_index < EQ_NUM_SPELL_GEMS; gem_index++)
     {
-      short spell_id = ini->getValue<WORD>(name, std::to_string(gem_index));
+      short spell_id = gems[gem_index];
       if (spell_id == 0)
       {
           Zeal::EqGame::print_chat("Error loading spellset [%s] spell id at index [%i] is 0", name.c_str(), gem_index);
           break;
       }
-      short memmed_spell = Zeal::EqGame::get_self()->CharInfo->MemorizedSpell[gem_index];
-      if (memmed_spell != spell_id && spell_id!=-1)
+      short memmed_spell = self_char->MemorizedSpell[gem_index];
+      if (memmed_spell == spell_id || spell_id == -1)
       {
-          if (memmed_spell != -1) 
-              Zeal::EqGame::Spells::Forget(gem_index);
-                
-          for (size_t book_index = 0; book_index < EQ_NUM_SPELL_BOOK_SPELLS; book_index++)
+          skipped++;
+          continue;
+      }
+      int book_index = -1;
+      for (int i = 0; i < EQ_NUM_SPELL_BOOK_SPELLS; i++)
+      {
+          if (self_char->SpellBook[i] == (WORD)spell_id)
           {
-              if (Zeal::EqGame::get_self()->CharInfo->SpellBook[book_index] == spell_id)
-              {
-                  mem_buffer.push_back({ book_index,gem_index });
-                  break;
-              }
-
+              book_index = i;
+              break;
           }
       }
+      if (book_index == -1)
+      {
+          Zeal::EqGame::print_chat("Spell [%i] for gem %i is not in your spellbook", spell_id, gem_index + 1);
+          continue; //leave the gem as it is rather than forgetting it for nothing
+      }
+      if (memmed_spell != -1)
+          Zeal::EqGame::Spells::Forget(gem_index);
+      mem_buffer.push_back({ book_index, gem_index });
     }
+    // memorized from the back, descending book order walks the book forward page by page instead of flipping around
+    std::sort(mem_buffer.begin(), mem_buffer.end(), [](const std::pair<int, int>& a, const std::pair<int, int>& b) { return a.first > b.first; });
     if (mem_buffer.size())
     {
+        LARGE_INTEGER now;
+        QueryPerformanceCounter(&now);
+        mem_started = now.QuadPart;
+        mem_total = (int)mem_buffer.size();
         original_stance = (Stance)Zeal::EqGame::get_self()->StandingState;
+        if (skipped)
+            Zeal::EqGame::print_chat("%i gems already match, memorizing %i", skipped, mem_total);
         Zeal::EqGame::Spells::Memorize(mem_buffer.back().first, mem_buffer.back().second);
     }
+    else
+        Zeal::EqGame::print_chat("Spellset [%s] is already memorized", name.c_str());
 }
 
 
 void SpellSets::finished_scribing(int a1, int a2)
 {
-    destroy_context_menus();
     create_context_menus(true);
 }
 
@@ -92,10 +119,20 @@ void SpellSets::finished_memorizing(int a1, int a2)
         mem_buffer.pop_back();
         if (mem_buffer.size())
             Zeal::EqGame::Spells::Memorize(mem_buffer.back().first, mem_buffer.back().second);
-        else if (Zeal::EqGame::Windows->SpellBook->IsVisible)
+        else
         {
-            Zeal::EqGame::get_self()->ChangeStance(original_stance);
-            Zeal::EqGame::Windows->SpellBook->IsVisible = false;
+            LARGE_INTEGER now, frequency;
+            QueryPerformanceCounter(&now);
+            QueryPerformanceFrequency(&frequency);
+            if (mem_started && mem_total)
+                Zeal::EqGame::print_chat("Memorized %i spells in %.1fs", mem_total, (now.QuadPart - mem_started) / (double)frequency.QuadPart);
+            mem_started = 0;
+            mem_total = 0;
+            if (Zeal::EqGame::Windows->SpellBook->IsVisible)
+            {
+                Zeal::EqGame::get_self()->ChangeStance(original_stance);
+                Zeal::EqGame::Windows->SpellBook->IsVisible = false;
+            }
         }
     }
 }
@@ -104,12 +141,12 @@ void __fastcall FinishMemorizing(int t, int u, int a1, int a2)
 {
     ZealService* zeal = ZealService::get_instance();
     zeal->spell_sets->finished_memorizing(a1, a2);
-    zeal->hooks->hook_map["FinishMemorizing"]->original(FinishMemorizing)(t, u, a1, a2);
+    hook_ref<FinishMemorizing>::original()(t, u, a1, a2);
 }
 void __fastcall FinishScribing(int t, int u, int a1, int a2)
 {
     ZealService* zeal = ZealService::get_instance();
-    zeal->hooks->hook_map["FinishScribing"]->original(FinishScribing)(t, u, a1, a2);
+    hook_ref<FinishScribing>::original()(t, u, a1, a2);
     zeal->spell_sets->finished_scribing(a1, a2);
 }
 
@@ -121,14 +158,6 @@ void SpellSets::callback_main()
     create_context_menus();
 }
 
-static Zeal::EqStructures::SPELL* GetSpell(int id)
-{
-    Zeal::EqStructures::EQCHARINFO* self_char = Zeal::EqGame::get_self()->CharInfo;
-    id = self_char->SpellBook[id];
-    if (id == 0 || id >= 4000)
-        return 0;
-    return Zeal::EqGame::get_spell_mgr()->Spells[id];
-}
 void SpellSets::handle_menu_mem(int book_index, int gem_index)
 {
     original_stance = (Stance)Zeal::EqGame::get_self()->StandingState;
@@ -222,27 +251,30 @@ static int __fastcall SpellGemWnd_HandleRButtonUp(Zeal::EqUI::SpellGem* gem, int
         zeal->spell_sets->last_gem_clicked = gem;
         Zeal::EqGame::Windows->ContextMenuManager->PopupMenu(zeal->spell_sets->SpellMenuIndex, pt, (Zeal::EqUI::EQWND*)zeal->spell_sets->menu);
     }
-    return zeal->hooks->hook_map["SpellGemRbutton"]->original(SpellGemWnd_HandleRButtonUp)(gem, unused, pt, flag);
+    return hook_ref<SpellGemWnd_HandleRButtonUp>::original()(gem, unused, pt, flag);
 }
 
+// only the spell gem window's book button is attached to this shadow, the other buttons keep the game's table
+static shadow_vtable<Zeal::EqUI::BaseVTable>* spell_book_vtable = nullptr;
 static int __fastcall SpellGemWnd_Book_HandleRButtonUp(Zeal::EqUI::EQWND* btn, int unused, Zeal::EqUI::CXPoint pt, unsigned int flag)
 {
     ZealService* zeal = ZealService::get_instance();
-    if (btn == Zeal::EqGame::Windows->SpellGems->SpellBook)
-    {
+    if (zeal && zeal->spell_sets && zeal->spell_sets->spellset_menu)
         Zeal::EqGame::Windows->ContextMenuManager->PopupMenu(zeal->spell_sets->SpellSetMenuIndex, pt, (Zeal::EqUI::EQWND*)zeal->spell_sets->spellset_menu);
-    }
-    return zeal->hooks->hook_map["SpellGemWnd_Book_HandleRButtonUp"]->original(SpellGemWnd_Book_HandleRButtonUp)(btn, unused, pt, flag);
+    using handler = int(__fastcall*)(Zeal::EqUI::EQWND*, int, Zeal::EqUI::CXPoint, unsigned int);
+    return spell_book_vtable->original<handler>(&Zeal::EqUI::BaseVTable::HandleRButtonUp)(btn, unused, pt, flag);
 }
 
 
-bool compareBySpellLevel(const Zeal::EqStructures::SPELL* a, const Zeal::EqStructures::SPELL* b) {
-    Zeal::EqStructures::EQCHARINFO* self_char = Zeal::EqGame::get_self()->CharInfo;
-    int aLevel = a->Level[self_char->Class - 1];
-    int bLevel = b->Level[self_char->Class - 1];
-    if (aLevel != bLevel)
-        return aLevel > bLevel;
-    return a->Name > b->Name;
+static bool spell_entry_before(const spell_entry& a, const spell_entry& b)
+{
+    if (int c = a.Category.compare(b.Category))
+        return c < 0;
+    if (int c = a.SubCategory.compare(b.SubCategory))
+        return c < 0;
+    if (a.Level != b.Level)
+        return a.Level > b.Level;
+    return a.Name > b.Name;
 }
 
 void SpellSets::destroy_context_menus()
@@ -266,120 +298,222 @@ void SpellSets::destroy_context_menus()
         menu = 0;
         spellset_menu = 0;
         MenuMap.clear();
+        category_menus.clear();
+        spell_menus.clear();
+        spell_menu_registered = false;
+        spellset_menu_registered = false;
     }
 }
 
-void SpellSets::set_ini()
+// the sets move into the character store the first time the character asks for them, the ini is left as it was
+void SpellSets::import_ini()
 {
-    std::stringstream ss;
-    ss << ".\\" << Zeal::EqGame::get_self()->Name << "_spellsets.ini";
-    ini->set(ss.str());
+    CharacterStore* store = ZealService::get_instance()->character_store.get();
+    std::string imported;
+    if (store->character().empty() || store->get("spellsets.imported", imported))
+        return;
+    std::string path = ".\\" + store->character() + "_spellsets.ini";
+    if (GetFileAttributesA(path.c_str()) != INVALID_FILE_ATTRIBUTES)
+    {
+        IO_ini ini(path);
+        for (const std::string& name : ini.getSectionNames())
+        {
+            std::array<short, EQ_NUM_SPELL_GEMS> gems;
+            for (size_t i = 0; i < EQ_NUM_SPELL_GEMS; i++)
+                gems[i] = ini.exists(name, std::to_string(i)) ? (short)ini.getValue<WORD>(name, std::to_string(i)) : 0;
+            std::array<short, EQ_NUM_SPELL_GEMS> existing;
+            if (!store->get(spellset_prefix + name, existing))
+                store->set(spellset_prefix + name, gems);
+        }
+    }
+    store->set("spellsets.imported", std::string("1"));
 }
 
-void SpellSets::create_context_menus(bool force)
+// only spells that were scribed or overwritten since the last call are looked up, formatted and inserted
+void SpellSets::refresh_book()
 {
-    if (!Zeal::EqGame::is_new_ui()) { return; } // prevent callback crashing oldui
-
-    if ((!menu || force)  && Zeal::EqGame::get_self() && Zeal::EqGame::is_in_game())
+    Zeal::EqStructures::Entity* self = Zeal::EqGame::get_self();
+    Zeal::EqStructures::EQCHARINFO* self_char = self->CharInfo;
+    if (book_owner != self->Name)
     {
-        ZealService* zeal = ZealService::get_instance();
-        set_ini();
+        book.clear();
+        in_book.reset();
+        book_owner = self->Name;
+    }
+    std::bitset<4000> seen;
+    for (int N = 0; N < EQ_NUM_SPELL_BOOK_SPELLS; N++)
+    {
+        WORD id = self_char->SpellBook[N];
+        if (id == 0 || id >= 4000)
+            continue;
+        seen.set(id);
+        if (in_book.test(id))
+            continue;
+        Zeal::EqStructures::SPELL* spell = ZealService::get_instance()->spell_index->get(id);
+        if (!spell)
+            continue;
+        spell_entry entry;
+        entry.ID = id;
+        entry.Level = spell->Level[self_char->Class - 1];
+        entry.Name = spell->Name ? spell->Name : "";
+        entry.Category = GetSpellCategoryName(GetSpellCategory(id));
+        entry.SubCategory = GetSpellSubCategoryName(GetSpellSubCategory(id));
+        entry.Label = std::to_string(entry.Level) + " - " + entry.Name;
+        book.insert(std::upper_bound(book.begin(), book.end(), entry, spell_entry_before), std::move(entry));
+        in_book.set(id);
+    }
+    if (seen != in_book)
+    {
+        book.erase(std::remove_if(book.begin(), book.end(), [&seen](const spell_entry& e) { return !seen.test(e.ID); }), book.end());
+        in_book &= seen;
+    }
+}
 
-        if (zeal->hooks->hook_map.count("SpellGemWnd_Book_HandleRButtonUp")==0)
-            zeal->hooks->Add("SpellGemWnd_Book_HandleRButtonUp", &Zeal::EqGame::Windows->SpellGems->SpellBook->vtbl->HandleRButtonUp, SpellGemWnd_Book_HandleRButtonUp, hook_type_vtable);
+// a pooled menu is emptied for reuse, a new one is created once the pool runs out
+SpellSets::pooled_menu& SpellSets::acquire_menu(std::vector<pooled_menu>& pool, size_t& used)
+{
+    if (used == pool.size())
+        pool.push_back({ new Zeal::EqUI::ContextMenu(0, 0, { 100,100,100,100 }), -1 });
+    else
+        pool[used].menu->RemoveAllMenuItems();
+    return pool[used++];
+}
 
-        Zeal::EqStructures::EQCHARINFO* self_char = Zeal::EqGame::get_self()->CharInfo;
-        std::vector<Zeal::EqStructures::SPELL*> spells;
-        for (int N = 0; N < EQ_NUM_SPELL_BOOK_SPELLS; N++) {
-            if (Zeal::EqStructures::SPELL* pSpell = GetSpell(N))
-            {
-                spells.push_back(pSpell);
-            }
-        }
-        std::sort(spells.begin(), spells.end(), compareBySpellLevel);
-        SpellCategory.clear();
-        for (auto& s : spells) 
-        {
-            menudata md;
-            md.ID = s->ID;
-            int Level = s->Level[self_char->Class - 1];
-            std::stringstream ss;
-            ss << Level << " - " << s->Name;
-            md.Name = ss.str();
-            DWORD categoryID = GetSpellCategory(s->ID);
-            DWORD subcategoryID = GetSpellSubCategory(s->ID);
-            std::string category = GetSpellCategoryName(categoryID);
-            std::string subcategory = GetSpellSubCategoryName(subcategoryID);
-            SpellCategory[category][subcategory].push_back(md);
-        }
-        if (!menu)
-            menu = new Zeal::EqUI::ContextMenu(0, 0, { 100,100,100,100 });
-        menu->HasChildren = 1;
-        menu->HasSiblings = 1;
-        menu->Unknown0x015 = 0;
-        menu->Unknown0x016 = 0;
-        menu->Unknown0x017 = 0;
-        menu->fnTable->basic.WndNotification = SpellsMenuNotification;
-        for (auto& [cat, sub] : SpellCategory)
-        {
-            Zeal::EqUI::ContextMenu* SubCategoryMenu = new Zeal::EqUI::ContextMenu(0, 0, { 100,100,100,100 });
-            for (auto& [subcat, spells] : sub)
-            {
-                Zeal::EqUI::ContextMenu* SpellMenu = new Zeal::EqUI::ContextMenu(0, 0, { 100,100,100,100 });
+void SpellSets::register_menu(pooled_menu& slot)
+{
+    if (slot.index != -1)
+        return;
+    slot.index = Zeal::EqGame::Windows->ContextMenuManager->AddMenu(slot.menu);
+    MenuMap[slot.index] = slot.menu;
+}
 
-                for (auto& sp : spells)
-                {
-                    SpellMenu->AddMenuItem(sp.Name, 0x10000 + sp.ID);
-                }
-                int addedindex = Zeal::EqGame::Windows->ContextMenuManager->AddMenu(SpellMenu);
-                MenuMap[addedindex] = SpellMenu;
-                addedindex |= 0x80000000;
-                SubCategoryMenu->AddMenuItem(subcat, addedindex);
-            }
-            int addedindex = Zeal::EqGame::Windows->ContextMenuManager->AddMenu(SubCategoryMenu);
-            MenuMap[addedindex] = SubCategoryMenu;
-            addedindex |= 0x80000000;
-            menu->AddMenuItem(cat, addedindex);
+void SpellSets::build_spell_menus()
+{
+    if (!menu)
+    {
+        menu = new Zeal::EqUI::ContextMenu(0, 0, { 100,100,100,100 });
+        spell_menu_registered = false;
+    }
+    else
+        menu->RemoveAllMenuItems();
+    menu->HasChildren = 1;
+    menu->HasSiblings = 1;
+    menu->Unknown0x015 = 0;
+    menu->Unknown0x016 = 0;
+    menu->Unknown0x017 = 0;
+    auto& menu_vtable = ZealService::get_instance()->hooks->ShadowVTable<Zeal::EqUI::ContextMenuVTable>("SpellSets.SpellsMenu", menu->fnTable);
+    menu_vtable.table.basic.WndNotification = SpellsMenuNotification;
+    menu_vtable.attach(menu);
+    size_t categories_used = 0;
+    size_t spells_used = 0;
+    for (size_t i = 0; i < book.size();)
+    {
+        pooled_menu& category = acquire_menu(category_menus, categories_used);
+        const std::string& category_name = book[i].Category;
+        while (i < book.size() && book[i].Category == category_name)
+        {
+            pooled_menu& subcategory = acquire_menu(spell_menus, spells_used);
+            const std::string& subcategory_name = book[i].SubCategory;
+            size_t first = i;
+            for (; i < book.size() && book[i].Category == category_name && book[i].SubCategory == subcategory_name; ++i)
+                subcategory.menu->AddMenuItem(book[i].Label, 0x10000 + book[i].ID);
+            register_menu(subcategory);
+            category.menu->AddMenuItem(book[first].SubCategory, subcategory.index | 0x80000000);
         }
+        register_menu(category);
+        menu->AddMenuItem(category_name, category.index | 0x80000000);
+    }
+    // spare menus from a bigger book stay registered but empty
+    for (size_t i = categories_used; i < category_menus.size(); ++i)
+        category_menus[i].menu->RemoveAllMenuItems();
+    for (size_t i = spells_used; i < spell_menus.size(); ++i)
+        spell_menus[i].menu->RemoveAllMenuItems();
+    if (!spell_menu_registered)
+    {
         SpellMenuIndex = Zeal::EqGame::Windows->ContextMenuManager->AddMenu(menu);
         MenuMap[SpellMenuIndex] = menu;
-        if (!spellset_menu)
-            spellset_menu = new Zeal::EqUI::ContextMenu(0, 0, { 100,100,100,100 });
-        spellset_menu->HasChildren = 1;
-        spellset_menu->fnTable->basic.WndNotification = SpellSetMenuNotification;
-        //spellset_menu->fnTable->basic.HandleRButtonUp = SpellSetRButtonUp;
-        //spellset_menu->fnTable->basic.Deactivate = SpellSetDeactivate;
-        spellsets.clear();
-        spellsets = ini->getSectionNames();
-        std::sort(spellsets.begin(), spellsets.end());
-        int header_index = spellset_menu->AddMenuItem("Spell Sets", 0x30000, false);
-        spellset_menu->EnableLine(header_index, false);
-        //spellset_menu->SetItemColor(header_index, { 255,255,255,255 });
-        spellset_menu->AddSeparator();
-        for (int i = 0; auto & s : spellsets)
-        {
-            spellset_map[0x20000 + i] = s;
-            spellset_menu->AddMenuItem(s, 0x20000 + i);
-            i++;
-        }
+        spell_menu_registered = true;
+    }
+}
+
+void SpellSets::build_spellset_menu()
+{
+    if (!spellset_menu)
+    {
+        spellset_menu = new Zeal::EqUI::ContextMenu(0, 0, { 100,100,100,100 });
+        spellset_menu_registered = false;
+    }
+    else
+        spellset_menu->RemoveAllMenuItems();
+    spellset_menu->HasChildren = 1;
+    auto& menu_vtable = ZealService::get_instance()->hooks->ShadowVTable<Zeal::EqUI::ContextMenuVTable>("SpellSets.SpellSetMenu", spellset_menu->fnTable);
+    menu_vtable.table.basic.WndNotification = SpellSetMenuNotification;
+    menu_vtable.attach(spellset_menu);
+    //spellset_menu->fnTable->basic.HandleRButtonUp = SpellSetRButtonUp;
+    //spellset_menu->fnTable->basic.Deactivate = SpellSetDeactivate;
+    spellsets.clear();
+    spellsets = set_names();
+    int header_index = spellset_menu->AddMenuItem("Spell Sets", 0x30000, false);
+    spellset_menu->EnableLine(header_index, false);
+    //spellset_menu->SetItemColor(header_index, { 255,255,255,255 });
+    spellset_menu->AddSeparator();
+    spellset_map.clear();
+    for (int i = 0; auto & s : spellsets)
+    {
+        spellset_map[0x20000 + i] = s;
+        spellset_menu->AddMenuItem(s, 0x20000 + i);
+        i++;
+    }
+    if (!spellset_menu_registered)
+    {
         SpellSetMenuIndex = Zeal::EqGame::Windows->ContextMenuManager->AddMenu(spellset_menu);
         MenuMap[SpellSetMenuIndex] = spellset_menu;
+        spellset_menu_registered = true;
+    }
 
+    //this idea caused weird bugs
+    //if (!spellset_delete)
+    //    spellset_delete = new Zeal::EqUI::ContextMenu(0, 0, { 100,100,100,100 });
+    //spellset_delete->HasChildren = 1;
+    //spellset_delete->fnTable->basic.WndNotification = SpellSetDeleteMenuNotification;
+    //spellset_delete->AddMenuItem("Delete", 0x40000); //i'm just making up numbers
+    //SpellSetDeleteIndex = Zeal::EqGame::Windows->ContextMenuManager->AddMenu(spellset_delete);
+    //MenuMap[SpellSetDeleteIndex] = spellset_delete;
+}
 
-        //this idea caused weird bugs
-        //if (!spellset_delete)
-        //    spellset_delete = new Zeal::EqUI::ContextMenu(0, 0, { 100,100,100,100 });
-        //spellset_delete->HasChildren = 1;
-        //spellset_delete->fnTable->basic.WndNotification = SpellSetDeleteMenuNotification;
-        //spellset_delete->AddMenuItem("Delete", 0x40000); //i'm just making up numbers
-        //SpellSetDeleteIndex = Zeal::EqGame::Windows->ContextMenuManager->AddMenu(spellset_delete);
-        //MenuMap[SpellSetDeleteIndex] = spellset_delete;
+// rebuilding refills the registered menus in place, nothing is created unless the book grew past the pool
+void SpellSets::create_context_menus(bool force)
+{
+    if (!Zeal::EqGame::is_new_ui()) { return; } // prevent callback crashing oldui
 
+    if ((!menu || force) && Zeal::EqGame::get_self() && Zeal::EqGame::is_in_game() && Zeal::EqGame::Windows->ContextMenuManager)
+    {
+        ZEAL_PROFILE_SCOPE("spell set rebuild");
+        ZealService* zeal = ZealService::get_instance();
+
+        detach_book();
+        book_button = Zeal::EqGame::Windows->SpellGems->SpellBook;
+        spell_book_vtable = &zeal->hooks->ShadowVTable<Zeal::EqUI::BaseVTable>("SpellGemWnd.SpellBook", book_button->vtbl);
+        spell_book_vtable->patch(&Zeal::EqUI::BaseVTable::HandleRButtonUp, SpellGemWnd_Book_HandleRButtonUp).attach(book_button);
+
+        refresh_book();
+        build_spell_menus();
+        build_spellset_menu();
     }
 }
 
+// the game's button goes back to the game's table while it still exists: before the ui reload destroys it, and on unload
+// so a right click afterwards doesn't call into a zeal that's gone
+void SpellSets::detach_book()
+{
+    if (book_button && spell_book_vtable && Zeal::EqGame::Windows && Zeal::EqGame::Windows->SpellGems && Zeal::EqGame::Windows->SpellGems->SpellBook == book_button)
+        spell_book_vtable->detach(book_button);
+    book_button = nullptr;
+}
+
 void SpellSets::CleanUI()
 {
+    detach_book();
     destroy_context_menus();
 }
 void SpellSets::callback_characterselect()
@@ -390,13 +524,12 @@ SpellSets::SpellSets(ZealService* zeal)
     menu = 0;
     original_stance = Stand;
     spellset_menu = 0;
-    ini = std::shared_ptr<IO_ini>(new IO_ini(".\\spellsets.ini"));
     zeal->callbacks->add_generic([this]() { callback_main();  }, callback_type::Render);
     zeal->callbacks->add_generic([this]() { CleanUI();  }, callback_type::CleanUI);
     zeal->callbacks->add_generic([this]() { callback_characterselect();  }, callback_type::CharacterSelect);
-    zeal->hooks->Add("FinishMemorizing", 0x434b38, FinishMemorizing, hook_type_detour);
-    zeal->hooks->Add("FinishScribing", 0x43501f, FinishScribing, hook_type_detour);
-    zeal->hooks->Add("SpellGemRbutton", 0x5A67B0, SpellGemWnd_HandleRButtonUp, hook_type_detour);
+    zeal->hooks->Add<FinishMemorizing>("FinishMemorizing", 0x434b38, hook_type_detour);
+    zeal->hooks->Add<FinishScribing>("FinishScribing", 0x43501f, hook_type_detour);
+    zeal->hooks->Add<SpellGemWnd_HandleRButtonUp>("SpellGemRbutton", 0x5A67B0, hook_type_detour);
     // wrap it for now to prevent users form crashing themselves on oldui until functionality potentially gets added.
     if (Zeal::EqGame::is_new_ui())
     {
@@ -427,8 +560,7 @@ SpellSets::SpellSets(ZealService* zeal)
                     }
                     if (Zeal::String::compare_insensitive(args[1], "list"))
                     {
-                        set_ini();
-                        std::vector<std::string> sets = ini->getSectionNames();
+                        std::vector<std::string> sets = set_names();
                         Zeal::EqGame::print_chat("--- spell sets (%i) ---", sets.size());
                         for (auto& set : sets)
                         {
@@ -444,5 +576,6 @@ SpellSets::SpellSets(ZealService* zeal)
 }
 SpellSets::~SpellSets()
 {
+    detach_book();
     destroy_context_menus();
 }
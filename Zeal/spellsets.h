@@ -3,13 +3,17 @@
 #include "hook_wrapper.h"
 #include "memory.h"
 #include "IO_ini.h"
+#include <bitset>
 
-struct menudata
+// a scribed spell as it appears in the gem menu, the book is kept sorted by category, subcategory, then level and name descending
+struct spell_entry
 {
+	WORD ID;
+	int Level;
 	std::string Name;
 	std::string Category;
 	std::string SubCategory;
-	DWORD ID;
+	std::string Label; //"level - name"
 };
 
 class SpellSets
@@ -19,8 +23,7 @@ public:
 	void load(const std::string& name);
 	void remove(const std::string& name);
 	void remove_selected();//from ui
-	void set_ini();
-	std::shared_ptr<IO_ini> ini = nullptr;
+	std::vector<std::string> set_names(); //sorted
 	void finished_memorizing(int a1, int a2);
 	void finished_scribing(int a1, int a2);
 	void create_context_menus(bool force = false);
@@ -33,20 +36,42 @@ public:
 	int SpellMenuIndex = 0;
 	int SpellSetMenuIndex = 0;
 	int SpellSetDeleteIndex = 0;
-	std::map<std::string, std::map<std::string, std::list<menudata>>>  SpellCategory;
+	std::vector<spell_entry> book; //built once per character, updated from the spellbook after scribing
 	std::map<int, Zeal::EqUI::ContextMenu*> MenuMap;
 	std::map<int, std::string> spellset_map;
 	std::vector<std::string> spellsets;
 	Zeal::EqUI::SpellGem* last_gem_clicked=0;
-	std::vector<std::pair<int, int>> mem_buffer;
+	std::vector<std::pair<int, int>> mem_buffer; //book index, gem index, memorized from the back
 	void handle_menu_mem(int book_index, int gem_index);
 	SpellSets(class ZealService* zeal);
 	~SpellSets();
 private:
 	Stance original_stance;
+	LONGLONG mem_started = 0; //qpc when the current load began
+	int mem_total = 0;
 	void CleanUI();
+	void detach_book();
+	Zeal::EqUI::EQWND* book_button = nullptr; //the game's spell book button while it points at the book shadow
 	void callback_main();
 	void callback_characterselect();
+	struct pooled_menu
+	{
+		Zeal::EqUI::ContextMenu* menu;
+		int index; //in the menu manager, -1 until it is added
+	};
+	void import_ini(); //once per character, from the <name>_spellsets.ini older versions wrote
+	void refresh_book();
+	void build_spell_menus();
+	void build_spellset_menu();
+	pooled_menu& acquire_menu(std::vector<pooled_menu>& pool, size_t& used);
+	void register_menu(pooled_menu& slot);
+	std::string book_owner;
+	std::bitset<4000> in_book; //spell ids present in book
+	// menus stay registered and are refilled on rebuild, only destroy_context_menus releases them
+	std::vector<pooled_menu> category_menus; //one per category, lists its subcategories
+	std::vector<pooled_menu> spell_menus; //one per subcategory, lists its spells
+	bool spell_menu_registered = false;
+	bool spellset_menu_registered = false;
 };
 
 
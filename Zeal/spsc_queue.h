@@ -0,0 +1,45 @@
+#pragma once
+#include <atomic>
+#include <vector>
+
+// single producer / single consumer ring buffer, push and pop never block or allocate
+template<typename T>
+class spsc_queue
+{
+public:
+	explicit spsc_queue(size_t capacity) : buffer(capacity + 1) {}
+	bool push(T&& item)
+	{
+		size_t h = head.load(std::memory_order_relaxed);
+		size_t next = (h + 1) % buffer.size();
+		if (next == tail.load(std::memory_order_acquire)) //full
+			return false;
+		buffer[h] = std::move(item);
+		head.store(next, std::memory_order_release);
+		return true;
+	}
+	bool pop(T& item)
+	{
+		size_t t = tail.load(std::memory_order_relaxed);
+		if (t == head.load(std::memory_order_acquire)) //empty
+			return false;
+		item = std::move(buffer[t]);
+		buffer[t] = T();
+		tail.store((t + 1) % buffer.size(), std::memory_order_release);
+		return true;
+	}
+	size_t size() const //approximate while the other side is running
+	{
+		size_t h = head.load(std::memory_order_acquire);
+		size_t t = tail.load(std::memory_order_acquire);
+		return h >= t ? h - t : h + buffer.size() - t;
+	}
+	bool empty() const
+	{
+		return head.load(std::memory_order_acquire) == tail.load(std::memory_order_acquire);
+	}
+private:
+	std::vector<T> buffer;
+	std::atomic<size_t> head{ 0 };
+	std::atomic<size_t> tail{ 0 };
+};
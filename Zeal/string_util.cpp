@@ -1,5 +1,6 @@
 #include "string_util.h"
 #include <algorithm>
+#include <charconv>
 #include <sstream>
 #include "Zeal.h"
 namespace Zeal
@@ -39,25 +40,121 @@ namespace Zeal
 			return result;
 		}
 
-		bool compare_insensitive(const std::string& str1, const std::string& str2) {
-			// Check if the strings are of different lengths, if so, they can't match
-			if (str1.length() != str2.length()) {
-				return false;
+		static bool is_space(char c)
+		{
+			return c == ' ' || c == '\t' || c == '\n' || c == '\r' || c == '\f' || c == '\v';
+		}
+
+		static char fold(char c)
+		{
+			return c >= 'A' && c <= 'Z' ? static_cast<char>(c + ('a' - 'A')) : c;
+		}
+
+		static std::string_view trim(std::string_view str)
+		{
+			size_t begin = 0, end = str.size();
+			while (begin < end && is_space(str[begin]))
+				begin++;
+			while (end > begin && is_space(str[end - 1]))
+				end--;
+			return str.substr(begin, end - begin);
+		}
+
+		bool tokenize(std::string_view str, char delim, token_list& out)
+		{
+			out.count = 0;
+			out.truncated = false;
+			size_t pos = 0;
+			if (is_space(delim))
+			{
+				while (true)
+				{
+					while (pos < str.size() && is_space(str[pos]))
+						pos++;
+					if (pos == str.size())
+						return true;
+					if (out.count == token_list::capacity - 1)
+						break;
+					size_t begin = pos;
+					while (pos < str.size() && !is_space(str[pos]))
+						pos++;
+					out.tokens[out.count++] = str.substr(begin, pos - begin);
+				}
+			}
+			else
+			{
+				while (true)
+				{
+					size_t next = str.find(delim, pos);
+					if (next == std::string_view::npos)
+					{
+						out.tokens[out.count++] = trim(str.substr(pos));
+						return true;
+					}
+					if (out.count == token_list::capacity - 1)
+						break;
+					out.tokens[out.count++] = trim(str.substr(pos, next - pos));
+					pos = next + 1;
+				}
 			}
+			out.tokens[out.count++] = trim(str.substr(pos));
+			out.truncated = true;
+			return false;
+		}
 
-			// Convert both strings to lowercase and then compare
-			std::string str1Lower = str1;
-			std::string str2Lower = str2;
-			std::transform(str1Lower.begin(), str1Lower.end(), str1Lower.begin(), ::tolower);
-			std::transform(str2Lower.begin(), str2Lower.end(), str2Lower.begin(), ::tolower);
+		bool equals_insensitive(std::string_view str1, std::string_view str2)
+		{
+			if (str1.size() != str2.size())
+				return false;
+			for (size_t i = 0; i < str1.size(); i++)
+				if (fold(str1[i]) != fold(str2[i]))
+					return false;
+			return true;
+		}
 
-			// Now, perform a case-insensitive comparison
-			return str1Lower == str2Lower;
+		template<typename T>
+		static bool parse_number(std::string_view str, T& result)
+		{
+			str = trim(str);
+			if (!str.empty() && str.front() == '+') //from_chars takes a minus but not a plus
+				str.remove_prefix(1);
+			if (str.empty())
+				return false;
+			T value{};
+			auto [ptr, ec] = std::from_chars(str.data(), str.data() + str.size(), value);
+			if (ec != std::errc() || ptr != str.data() + str.size())
+				return false;
+			result = value;
+			return true;
+		}
+
+		bool parse(std::string_view str, int& result)
+		{
+			return parse_number(str, result);
+		}
+
+		bool parse(std::string_view str, float& result)
+		{
+			return parse_number(str, result);
+		}
+
+		bool compare_insensitive(const std::string& str1, const std::string& str2) {
+			return equals_insensitive(str1, str2);
 		}
 
 		std::vector<std::string> split(const std::string& str, const std::string& delim) {
-			std::string trimmed = trim_and_reduce_spaces(str);
+			token_list list;
 			std::vector<std::string> tokens;
+			if (delim == " " && tokenize(str, delim[0], list))
+			{
+				tokens.reserve(list.size() ? list.size() : 1);
+				for (std::string_view token : list)
+					tokens.emplace_back(token);
+				if (tokens.empty())
+					tokens.emplace_back(); //an empty or blank string still gives one empty token
+				return tokens;
+			}
+			std::string trimmed = trim_and_reduce_spaces(str);
 			size_t start = 0, end = 0;
 			while ((end = trimmed.find(delim, start)) != std::string::npos) {
 				tokens.push_back(trimmed.substr(start, end - start));
@@ -67,36 +164,14 @@ namespace Zeal
 			return tokens;
 		}
 
-
 		bool tryParse(const std::string& str, int* result) {
-			try {
-				*result = std::stoi(str);
-				return true;
-			}
-			catch (const std::invalid_argument& e) {
-				Zeal::EqGame::print_chat("Invalid Argument %s", e.what());
-				return false;
-			}
-			catch (const std::out_of_range& e) {
-				Zeal::EqGame::print_chat("Out of range: %s", e.what());
-				return false;
-			}
+			return parse(str, *result);
 		}
 
 		bool tryParse(const std::string& str, float* result) {
-			try {
-				*result = std::stof(str);
-				return true;
-			}
-			catch (const std::invalid_argument& e) {
-				Zeal::EqGame::print_chat("Invalid Argument %s", e.what());
-				return false;
-			}
-			catch (const std::out_of_range& e) {
-				Zeal::EqGame::print_chat("Out of range: %s", e.what());
-				return false;
-			}
+			return parse(str, *result);
 		}
+
 		std::string bytes_to_hex(const char* byteArray, size_t length) {
 			std::ostringstream oss;
 			oss << std::hex << std::setfill('0');
@@ -1,10 +1,30 @@
 #pragma once
 #include <string>
+#include <string_view>
 #include <vector>
 namespace Zeal
 {
 	namespace String
 	{
+		// views into the source string, which has to outlive them
+		struct token_list
+		{
+			static constexpr size_t capacity = 32;
+			std::string_view tokens[capacity];
+			size_t count = 0;
+			bool truncated = false; //more tokens than capacity, the last one holds the rest of the input
+			size_t size() const { return count; }
+			std::string_view operator[](size_t i) const { return tokens[i]; }
+			const std::string_view* begin() const { return tokens; }
+			const std::string_view* end() const { return tokens + count; }
+		};
+		// a whitespace delim splits on runs of whitespace and drops empty tokens, any other delim keeps empty tokens and
+		// trims the whitespace around each one. returns false when truncated
+		bool tokenize(std::string_view str, char delim, token_list& out);
+		bool equals_insensitive(std::string_view str1, std::string_view str2); //ascii case folding
+		bool parse(std::string_view str, int& result); //no exceptions, the whole token has to be the number
+		bool parse(std::string_view str, float& result);
+
 		std::string trim_and_reduce_spaces(const std::string& input);
 		bool compare_insensitive(const std::string& str1, const std::string& str2);
 		std::vector<std::string> split(const std::string& str, const std::string& delim);
@@ -0,0 +1,110 @@
+#include "task_pool.h"
+#include "thread_affinity.h"
+
+size_t TaskPool::spare_cores()
+{
+	unsigned int cores = std::thread::hardware_concurrency();
+	return cores > 6 ? 4 : cores > 2 ? cores - 2 : 1;
+}
+
+TaskPool::TaskPool(size_t thread_count)
+{
+	for (size_t i = 0; i < thread_count; ++i)
+		workers.push_back(std::make_unique<worker>());
+	for (size_t i = 0; i < thread_count; ++i)
+		workers[i]->thread = std::thread([this, i]() { worker_main(i); });
+}
+
+TaskPool::~TaskPool()
+{
+	{
+		std::lock_guard<std::mutex> guard(wake_lock);
+		end_threads = true;
+	}
+	wake.notify_all();
+	for (auto& w : workers)
+		if (w->thread.joinable())
+			w->thread.join();
+}
+
+void TaskPool::post(std::function<void()> job)
+{
+	if (workers.empty())
+	{
+		job();
+		return;
+	}
+	worker& w = *workers[next++ % workers.size()];
+	{
+		std::lock_guard<std::mutex> guard(w.lock);
+		w.jobs.push_back(std::move(job));
+		queued++; //under the queue lock, so take() can't count the job out before it is counted in
+	}
+	{
+		std::lock_guard<std::mutex> guard(wake_lock); //a worker between its check and its sleep holds this, so the notify isn't lost
+	}
+	wake.notify_one();
+}
+
+// own queue from the front, otherwise the back of another thread's queue
+bool TaskPool::take(size_t index, std::function<void()>& job)
+{
+	for (size_t n = 0; n < workers.size(); ++n)
+	{
+		worker& w = *workers[(index + n) % workers.size()];
+		std::lock_guard<std::mutex> guard(w.lock);
+		if (w.jobs.empty())
+			continue;
+		if (n == 0)
+		{
+			job = std::move(w.jobs.front());
+			w.jobs.pop_front();
+		}
+		else
+		{
+			job = std::move(w.jobs.back());
+			w.jobs.pop_back();
+		}
+		queued--;
+		return true;
+	}
+	return false;
+}
+
+void TaskPool::worker_main(size_t index)
+{
+	std::function<void()> job;
+	while (true)
+	{
+		if (take(index, job))
+		{
+			job();
+			job = nullptr;
+			continue;
+		}
+		std::unique_lock<std::mutex> guard(wake_lock);
+		wake.wait(guard, [this]() { return end_threads || queued > 0; });
+		if (end_threads)
+			return; //jobs still queued are dropped, their owners are being torn down too
+	}
+}
+
+void TaskPool::post_to_main(std::function<void()> job)
+{
+	std::lock_guard<std::mutex> guard(main_lock);
+	main_jobs.push_back(std::move(job));
+}
+
+void TaskPool::drain_main()
+{
+	ZEAL_ASSERT_GAME_THREAD();
+	{
+		std::lock_guard<std::mutex> guard(main_lock);
+		if (main_jobs.empty())
+			return;
+		main_running.swap(main_jobs);
+	}
+	for (auto& job : main_running)
+		job();
+	main_running.clear();
+}
@@ -0,0 +1,47 @@
+#pragma once
+#include <Windows.h>
+#include <atomic>
+#include <condition_variable>
+#include <deque>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+// background threads for work that doesn't touch game state: file io, aggregation, scans
+// post() spreads jobs over per thread queues and an idle thread steals from the back of the others,
+// post_to_main() queues a continuation that main_loop_hk runs on the game thread, where game state may be changed
+class TaskPool
+{
+public:
+	TaskPool(size_t thread_count = spare_cores());
+	~TaskPool();
+	void post(std::function<void()> job); //any thread
+	void post_to_main(std::function<void()> job); //any thread, runs at the next drain_main()
+	void run(std::function<void()> job, std::function<void()> then) //job in the pool, then on the game thread
+	{
+		post([this, job = std::move(job), then = std::move(then)]() { job(); post_to_main(then); });
+	}
+	void drain_main(); //game thread
+	size_t size() const { return workers.size(); }
+	static size_t spare_cores(); //cores left once the game and render threads have theirs
+private:
+	struct worker
+	{
+		std::mutex lock;
+		std::deque<std::function<void()>> jobs;
+		std::thread thread;
+	};
+	bool take(size_t index, std::function<void()>& job);
+	void worker_main(size_t index);
+	std::vector<std::unique_ptr<worker>> workers;
+	std::mutex wake_lock;
+	std::condition_variable wake;
+	std::atomic<size_t> queued = 0;
+	std::atomic<size_t> next = 0; //round robin target for post()
+	bool end_threads = false;
+	std::mutex main_lock;
+	std::vector<std::function<void()>> main_jobs;
+	std::vector<std::function<void()>> main_running; //swapped with main_jobs so posting during a drain is safe
+};
@@ -0,0 +1,15 @@
+#include "thread_affinity.h"
+
+static std::atomic<DWORD> game_thread_id = 0;
+
+void Zeal::Thread::set_game_thread()
+{
+	if (!game_thread_id.load(std::memory_order_relaxed))
+		game_thread_id = GetCurrentThreadId();
+}
+
+bool Zeal::Thread::is_game_thread()
+{
+	DWORD id = game_thread_id.load(std::memory_order_relaxed);
+	return !id || id == GetCurrentThreadId();
+}
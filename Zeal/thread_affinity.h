@@ -0,0 +1,43 @@
+#pragma once
+#include <Windows.h>
+#include <atomic>
+#include <cassert>
+
+// thread ownership:
+// - game thread: every hook, callback and command, so all module state belongs to it unless a module says otherwise.
+//   ZealService itself is built and torn down on the loader thread in dllmain while the game thread is parked in hooks
+// - pipe thread: named_pipe's clients and instance pool, fed frames through an spsc_queue and woken through its port
+// - chat_log/outputfile writers: their own files, fed through their locked queues
+// - task_pool/worker_pool jobs: only what the job captured, results go back with post_to_main
+// IO_ini and Setting<T> are the only shared state read from any thread (a lock and atomics). anything else crossing
+// threads goes through spsc_queue, an atomic or post_to_main, never a plain member. the asserts below check it in debug builds
+namespace Zeal
+{
+	namespace Thread
+	{
+		void set_game_thread(); //main_loop_hk, every frame
+		bool is_game_thread(); //true until the first frame has run, init code runs before the game thread is known
+		// latches onto the first thread that checks it, for state owned by a thread zeal starts itself
+		class owner
+		{
+		public:
+			bool check()
+			{
+				DWORD current = GetCurrentThreadId();
+				DWORD expected = 0;
+				return id.compare_exchange_strong(expected, current) || expected == current;
+			}
+			void release() { id = 0; } //hand the state to whichever thread checks next, e.g. after joining the owner
+		private:
+			std::atomic<DWORD> id = 0;
+		};
+	}
+}
+
+#ifdef _DEBUG
+#define ZEAL_ASSERT_GAME_THREAD() assert(Zeal::Thread::is_game_thread())
+#define ZEAL_ASSERT_OWNER(owner) assert((owner).check())
+#else
+#define ZEAL_ASSERT_GAME_THREAD() ((void)0)
+#define ZEAL_ASSERT_OWNER(owner) ((void)0)
+#endif
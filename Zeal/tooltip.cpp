@@ -53,6 +53,15 @@ tooltip::tooltip(ZealService* zeal, IO_ini* ini)
 	LoadSettings(ini);
     set_alt_all_containers(all_containers);
     set_timer(hover_timeout);
+    zeal->config_watch->on_reload([this, ini]() {
+        bool was_all = all_containers;
+        int was_timeout = hover_timeout;
+        LoadSettings(ini);
+        if (all_containers != was_all)
+            set_alt_all_containers(all_containers);
+        if (hover_timeout != was_timeout)
+            set_timer(hover_timeout);
+    });
     zeal->commands_hook->add("/tooltipall", {}, "Toggle showing all open containers tooltips when holding alt.",
         [this](std::vector<std::string>& args) {
             set_alt_all_containers(!all_containers);
@@ -3,76 +3,159 @@
 #include "EqAddresses.h"
 #include "EqFunctions.h"
 #include "Zeal.h"
+#include "string_util.h"
+#include <unordered_map>
 
 
+static DWORD coins(const Zeal::EqStructures::EQCHARINFO* info, bool bank, int denomination)
+{
+	const DWORD* base = bank ? &info->BankPlatinum : &info->Platinum;
+	return base[denomination];
+}
+
+// the same conversions the button always made, gold and silver step down once and copper tries every slot
 void ui_bank::change()
 {
-	if (Zeal::EqGame::Windows->Bank && Zeal::EqGame::Windows->Bank->IsVisible)
+	if (!Zeal::EqGame::Windows->Bank || !Zeal::EqGame::Windows->Bank->IsVisible || !moves.empty())
+		return;
+	for (bool bank : { true, false })
 	{
-		if (Zeal::EqGame::get_char_info()->BankGold > 0)
-		{
-			reinterpret_cast<void(__thiscall*)(Zeal::EqUI::BasicWnd*, int, int)>(0x404aec)(Zeal::EqGame::Windows->Bank, 1, Zeal::EqGame::get_char_info()->BankGold);
-			reinterpret_cast<void(__thiscall*)(Zeal::EqUI::BasicWnd*, int, int)>(0x404aec)(Zeal::EqGame::Windows->Bank, 2, -1);
-		}
-		if (Zeal::EqGame::get_char_info()->BankSilver > 0)
-		{
-			reinterpret_cast<void(__thiscall*)(Zeal::EqUI::BasicWnd*, int, int)>(0x404aec)(Zeal::EqGame::Windows->Bank, 2, Zeal::EqGame::get_char_info()->BankSilver);
-			reinterpret_cast<void(__thiscall*)(Zeal::EqUI::BasicWnd*, int, int)>(0x404aec)(Zeal::EqGame::Windows->Bank, 3, -1);
-		}
-		if (Zeal::EqGame::get_char_info()->BankCopper > 0)
-		{
-			reinterpret_cast<void(__thiscall*)(Zeal::EqUI::BasicWnd*, int, int)>(0x404aec)(Zeal::EqGame::Windows->Bank, 3, Zeal::EqGame::get_char_info()->BankCopper);
-			reinterpret_cast<void(__thiscall*)(Zeal::EqUI::BasicWnd*, int, int)>(0x404aec)(Zeal::EqGame::Windows->Bank, 0, -1);
-			reinterpret_cast<void(__thiscall*)(Zeal::EqUI::BasicWnd*, int, int)>(0x404aec)(Zeal::EqGame::Windows->Bank, 1, -1);
-			reinterpret_cast<void(__thiscall*)(Zeal::EqUI::BasicWnd*, int, int)>(0x404aec)(Zeal::EqGame::Windows->Bank, 2, -1);
-			reinterpret_cast<void(__thiscall*)(Zeal::EqUI::BasicWnd*, int, int)>(0x404aec)(Zeal::EqGame::Windows->Bank, 3, -1);
-		}
+		moves.push_back({ bank, 1, { 2 } });
+		moves.push_back({ bank, 2, { 3 } });
+		moves.push_back({ bank, 3, { 0, 1, 2, 3 } });
+	}
+	pump();
+}
 
-		if (Zeal::EqGame::get_char_info()->Gold > 0)
-		{
-			reinterpret_cast<void(__thiscall*)(Zeal::EqUI::BasicWnd*, int, int)>(0x421876)(Zeal::EqGame::Windows->Inventory, 1, Zeal::EqGame::get_char_info()->Gold);
-			reinterpret_cast<void(__thiscall*)(Zeal::EqUI::BasicWnd*, int, int)>(0x421876)(Zeal::EqGame::Windows->Inventory, 2, -1);
-		}
-		if (Zeal::EqGame::get_char_info()->Silver > 0)
-		{
-			reinterpret_cast<void(__thiscall*)(Zeal::EqUI::BasicWnd*, int, int)>(0x421876)(Zeal::EqGame::Windows->Inventory, 2, Zeal::EqGame::get_char_info()->Silver);
-			reinterpret_cast<void(__thiscall*)(Zeal::EqUI::BasicWnd*, int, int)>(0x421876)(Zeal::EqGame::Windows->Inventory, 3, -1);
-		}
-		if (Zeal::EqGame::get_char_info()->Copper > 0)
+void ui_bank::pump()
+{
+	if (moves.empty())
+		return;
+	Zeal::EqStructures::EQCHARINFO* info = Zeal::EqGame::get_char_info();
+	if (!info || !Zeal::EqGame::Windows->Bank || !Zeal::EqGame::Windows->Bank->IsVisible)
+	{
+		moves.clear(); //the window closed, whatever is left waits for the next click
+		return;
+	}
+	ULONGLONG now = GetTickCount64();
+	while (!moves.empty() && now >= next_move)
+	{
+		if (info->CursorPlatinum || info->CursorGold || info->CursorSilver || info->CursorCopper) //the last drop hasn't landed yet
 		{
-			reinterpret_cast<void(__thiscall*)(Zeal::EqUI::BasicWnd*, int, int)>(0x421876)(Zeal::EqGame::Windows->Inventory, 3, Zeal::EqGame::get_char_info()->Copper);
-			reinterpret_cast<void(__thiscall*)(Zeal::EqUI::BasicWnd*, int, int)>(0x421876)(Zeal::EqGame::Windows->Inventory, 0, -1);
-			reinterpret_cast<void(__thiscall*)(Zeal::EqUI::BasicWnd*, int, int)>(0x421876)(Zeal::EqGame::Windows->Inventory, 1, -1);
-			reinterpret_cast<void(__thiscall*)(Zeal::EqUI::BasicWnd*, int, int)>(0x421876)(Zeal::EqGame::Windows->Inventory, 2, -1);
-			reinterpret_cast<void(__thiscall*)(Zeal::EqUI::BasicWnd*, int, int)>(0x421876)(Zeal::EqGame::Windows->Inventory, 3, -1);
+			if (!cursor_busy_since)
+				cursor_busy_since = now;
+			else if (now - cursor_busy_since > 3000)
+			{
+				Zeal::EqGame::print_chat("Coin change stopped, the cursor is still holding coins");
+				moves.clear();
+			}
+			return;
 		}
+		cursor_busy_since = 0;
+		coin_move move = moves.front();
+		moves.pop_front();
+		DWORD amount = coins(info, move.bank, move.denomination); //read when issued, earlier moves feed the later ones
+		if (!amount)
+			continue;
+		auto handler = reinterpret_cast<void(__thiscall*)(Zeal::EqUI::BasicWnd*, int, int)>(move.bank ? 0x404aec : 0x421876);
+		Zeal::EqUI::BasicWnd* wnd = move.bank ? (Zeal::EqUI::BasicWnd*)Zeal::EqGame::Windows->Bank : (Zeal::EqUI::BasicWnd*)Zeal::EqGame::Windows->Inventory;
+		handler(wnd, move.denomination, amount);
+		for (int target : move.targets)
+			handler(wnd, target, -1);
+		if (move_interval_ms.get() > 0)
+			next_move = now + move_interval_ms.get();
 	}
 }
 
+std::vector<ui_bank::stack_merge> ui_bank::plan_stacks(bool bank) const
+{
+	std::vector<stack_merge> merges;
+	Zeal::EqStructures::EQCHARINFO* info = Zeal::EqGame::get_char_info();
+	if (!info)
+		return merges;
+	struct partial
+	{
+		const char* name;
+		int stacks;
+		int count;
+	};
+	std::unordered_map<WORD, partial> partials;
+	auto add = [&](const Zeal::EqStructures::EQITEMINFO* item) {
+		if (!item || item->Type == 1 || !item->Common.IsStackable || item->Common.SpellId || item->Common.StackCount >= 20) //charges aren't a stack
+			return;
+		partial& p = partials.try_emplace(item->ID, partial{ item->Name, 0, 0 }).first->second;
+		p.stacks++;
+		p.count += item->Common.StackCount ? item->Common.StackCount : 1;
+	};
+	Zeal::EqStructures::EQITEMINFO** slots = bank ? info->InventoryBankItem : info->InventoryPackItem;
+	int slot_count = bank ? EQ_NUM_INVENTORY_BANK_SLOTS : EQ_NUM_INVENTORY_PACK_SLOTS;
+	for (int i = 0; i < slot_count; i++)
+	{
+		Zeal::EqStructures::EQITEMINFO* item = slots[i];
+		if (item && item->Type == 1)
+			for (int j = 0; j < item->Container.Capacity && j < EQ_NUM_CONTAINER_SLOTS; j++)
+				add(item->Container.Item[j]);
+		else
+			add(item);
+	}
+	for (auto& [id, p] : partials)
+		if (p.stacks > (p.count + 19) / 20)
+			merges.push_back({ p.name, p.stacks, p.count });
+	return merges;
+}
+
 static int __fastcall ChangeButtonDown(Zeal::EqUI::BasicWnd* pWnd, int unused, Zeal::EqUI::CXPoint pt, unsigned int flag)
 {
 	int rval = reinterpret_cast<int(__fastcall*)(Zeal::EqUI::BasicWnd * pWnd, int unused, Zeal::EqUI::CXPoint pt, unsigned int flag)>(0x0595330)(pWnd, unused, pt, flag);
 	
-	ZealService::get_instance()->ui->bank->change();
+	ZealService* zeal = ZealService::get_instance();
+	if (zeal && zeal->ui && zeal->ui->bank)
+		zeal->ui->bank->change();
 	return rval;
 }
 
 void ui_bank::InitUI()
 {
-	Zeal::EqUI::BasicWnd* btn = Zeal::EqGame::Windows->Bank->GetChildItem("ChangeButton");
-	if (btn)
-	{
-		btn->SetupCustomVTable();
-		btn->vtbl->HandleLButtonDown = ChangeButtonDown;
-	}
+	CleanUI();
+	if (!Zeal::EqGame::Windows->Bank)
+		return;
+	Zeal::EqUI::BasicWnd* btn = ui->GetChild(Zeal::EqGame::Windows->Bank, "ChangeButton");
+	if (!btn)
+		return;
+	change_shadow = &ZealService::get_instance()->hooks->ShadowVTable<Zeal::EqUI::BaseVTable>("BankWnd.ChangeButton", btn->vtbl);
+	change_shadow->patch(&Zeal::EqUI::BaseVTable::HandleLButtonDown, ChangeButtonDown).attach(btn);
+	change_button = btn;
+	attached_wnd = Zeal::EqGame::Windows->Bank;
+}
+
+// the game's button goes back to the game's table while its window is still the game's, before a ui reload and on unload
+void ui_bank::CleanUI()
+{
+	if (change_button && attached_wnd && Zeal::EqGame::Windows && Zeal::EqGame::Windows->Bank == attached_wnd)
+		change_shadow->detach(change_button);
+	change_button = nullptr;
+	attached_wnd = nullptr;
 }
 ui_bank::ui_bank(ZealService* zeal, IO_ini* ini, ui_manager* mgr)
 {
 	ui = mgr;
 	zeal->callbacks->add_generic([this]() { InitUI(); }, callback_type::InitUI);
+	zeal->callbacks->add_generic([this]() { CleanUI(); }, callback_type::CleanUI);
+	zeal->callbacks->add_generic([this]() { pump(); }, callback_type::MainLoop);
+	zeal->callbacks->add_generic([this]() { moves.clear(); }, callback_type::Zone);
+	zeal->commands_hook->add("/stacks", {}, "Lists the partial stacks in your bags (or /stacks bank) that would combine into fewer slots.",
+		[this](std::vector<std::string>& args) {
+			bool bank = args.size() > 1 && Zeal::String::compare_insensitive(args[1], "bank");
+			std::vector<stack_merge> merges = plan_stacks(bank);
+			if (merges.empty())
+				Zeal::EqGame::print_chat("Nothing to combine in your %s", bank ? "bank" : "bags");
+			for (const stack_merge& merge : merges)
+				Zeal::EqGame::print_chat("%s: %i stacks of %i combine into %i", merge.name.c_str(), merge.stacks, merge.count, (merge.count + 19) / 20);
+			return true;
+		});
 	if (Zeal::EqGame::is_in_game()) InitUI();
 }
 ui_bank::~ui_bank()
 {
-
+	CleanUI();
 }
@@ -2,14 +2,42 @@
 #include "hook_wrapper.h"
 #include "memory.h"
 #include "EqUI.h"
+#include "settings.h"
+#include <deque>
+#include <string>
+#include <vector>
 
+// the change button plans every coin conversion for the bank and the inventory up front, then a main loop pump
+// issues them as soon as the cursor is free, several in one frame when the pacing allows
 class ui_bank
 {
 public:
 	void change();
+	struct stack_merge
+	{
+		std::string name;
+		int stacks; //partial stacks of the item in the bank or the bags
+		int count; //items across them
+	};
+	std::vector<stack_merge> plan_stacks(bool bank) const; //partial stacks that would combine into fewer
+	Setting<int> move_interval_ms{ "Zeal", "BankMoveIntervalMs", 50 }; //between coin moves, for the server's rate limit
 	ui_bank(class ZealService* zeal, class IO_ini* ini, class ui_manager* mgr);
 	~ui_bank();
 private:
+	struct coin_move
+	{
+		bool bank;
+		int denomination; //0 platinum to 3 copper, everything of it is picked up when the move is issued
+		std::vector<int> targets; //slots clicked with the coins on the cursor
+	};
 	void InitUI();
+	void CleanUI();
+	void pump();
+	Zeal::EqUI::BasicWnd* change_button = nullptr; //the game's change button while it points at change_shadow
+	shadow_vtable<Zeal::EqUI::BaseVTable>* change_shadow = nullptr; //shadows are never freed
+	Zeal::EqUI::BasicWnd* attached_wnd = nullptr; //the bank window the button was found in
+	std::deque<coin_move> moves;
+	ULONGLONG next_move = 0;
+	ULONGLONG cursor_busy_since = 0;
 	ui_manager* ui;
 };
\ No newline at end of file
@@ -3,7 +3,9 @@
 #include "EqAddresses.h"
 #include "EqFunctions.h"
 #include "Zeal.h"
+#include "string_util.h"
 #include <algorithm>
+#include <ctime>
 
 
 
@@ -15,6 +17,7 @@ void ui_guild::CleanUI()
 		guild->IsVisible = false;
 		delete guild;
 	}
+	roster.detach();
 	members = nullptr;
 }
 
@@ -25,6 +28,20 @@ void ui_guild::InitUI()
 	reinterpret_cast<int* (__thiscall*)(Zeal::EqUI::BasicWnd*, Zeal::EqUI::BasicWnd*, Zeal::EqUI::CXSTR name, int, int)>(0x56e1e0)(guild, 0, Zeal::EqUI::CXSTR("GuildManagementWnd"), -1, 0);
 	guild->CreateChildren();
 	members = (Zeal::EqUI::ListWnd*)guild->GetChildItem("MemberList");
+	if (members)
+		roster.attach(members);
+}
+
+// name, level, class, rank, last on, zone, note like the GuildManagementWnd columns
+std::vector<std::string> ui_guild::member_row(const guild_member& m)
+{
+	char last_on[16] = "";
+	time_t t = m.last_on;
+	tm local;
+	if (m.last_on && !localtime_s(&local, &t))
+		strftime(last_on, sizeof(last_on), "%m/%d/%Y", &local);
+	GuildRoster* guild_roster = ZealService::get_instance()->guild_roster.get();
+	return { m.name, m.level ? std::to_string(m.level) : "", m.class_name, "", last_on, guild_roster->zone_name(m.zone), "" };
 }
 
 ui_guild::ui_guild(ZealService* zeal, IO_ini* ini, ui_manager* mgr)
@@ -33,21 +50,19 @@ ui_guild::ui_guild(ZealService* zeal, IO_ini* ini, ui_manager* mgr)
 	guild = nullptr;
 	zeal->callbacks->add_generic([this]() { CleanUI(); }, callback_type::CleanUI);
 	zeal->callbacks->add_generic([this]() { InitUI(); }, callback_type::InitUI);
+	zeal->callbacks->add_generic([this]() { roster.update(); }, callback_type::RenderUI);
+	zeal->guild_roster->on_change = [this](size_t index) {
+		//only once the window was filled, opening it loads the whole roster
+		if (roster.column_count())
+			roster.set_row(index, member_row(ZealService::get_instance()->guild_roster->members()[index]));
+	};
 		zeal->commands_hook->add("/read", {}, "",
 			[this](std::vector<std::string>& args) {
-				if (members)
+				//from the roster itself, rows of the list that were never on screen are still blank
+				if (roster.column_count() >= 3)
 				{
-
-					for (int i = 1; i < members->ItemCount; i++)
-					{
-						Zeal::EqUI::CXSTR name;
-						Zeal::EqUI::CXSTR level;
-						Zeal::EqUI::CXSTR _class;
-						members->GetItemText(&name, i, 0);
-						members->GetItemText(&level, i, 1);
-						members->GetItemText(&_class, i, 2);
-						Zeal::EqGame::print_chat("%s %s %s", name.Data->Text, level.Data->Text, _class.Data->Text);
-					}
+					for (size_t i = 0; i < roster.row_count(); i++)
+						Zeal::EqGame::print_chat("%s %s %s", roster.cell(i, 0).c_str(), roster.cell(i, 1).c_str(), roster.cell(i, 2).c_str());
 				}
 				return true;
 			});
@@ -64,29 +79,29 @@ ui_guild::ui_guild(ZealService* zeal, IO_ini* ini, ui_manager* mgr)
 				}
 			return true;
 			});
-		zeal->commands_hook->add("/guildwindow", {}, "Toggle guild management window",
+		zeal->commands_hook->add("/guildwindow", {}, "Toggle guild management window, /guildwindow sort <column> [desc] | filter [text].",
 			[this, mgr](std::vector<std::string>& args) {
+					if (args.size() > 2 && Zeal::String::compare_insensitive(args[1], "sort"))
+					{
+						int column = 0;
+						Zeal::String::tryParse(args[2], &column);
+						roster.sort(column, !(args.size() > 3 && Zeal::String::compare_insensitive(args[3], "desc")));
+						return true;
+					}
+					if (args.size() > 1 && Zeal::String::compare_insensitive(args[1], "filter"))
+					{
+						roster.filter(args.size() > 2 ? args[2] : "");
+						return true;
+					}
 					if (guild)
 					{
 						// Zeal::EqGame::print_chat("Attempting to show guild window");
 						guild->IsVisible=true;
-						//some mock data -->
 						std::vector<std::vector<std::string>> players;
-						Zeal::EqStructures::Entity* ent = Zeal::EqGame::get_entity_list();
-						while (ent->Next)
-						{
-							if (ent->Type == 0)
-							{
-								players.push_back(
-									{
-										ent->Name, std::to_string(ent->Level),Zeal::EqGame::class_name_short(ent->Class),"Peasant", "5/7/2024", "Commons", ""
-									}
-								);
-							}
-							ent = ent->Next;
-
-						}
-						mgr->AddListItems(members, players);
+						GuildRoster* guild_roster = ZealService::get_instance()->guild_roster.get();
+						for (const guild_member& m : guild_roster->members())
+							players.push_back(member_row(m));
+						roster.set_rows(players);
 					}
 					else
 					{
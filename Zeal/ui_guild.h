@@ -2,17 +2,20 @@
 #include "hook_wrapper.h"
 #include "memory.h"
 #include "EqUI.h"
+#include "ui_list.h"
 class ui_guild
 {
 public:
 	Zeal::EqUI::BasicWnd* guild=nullptr;
 	Zeal::EqUI::ListWnd* members=nullptr;
+	ui_list roster;
 	ui_guild(class ZealService* zeal, class IO_ini* ini, class ui_manager* mgr);
 	~ui_guild();
 private:
 	void InitUI();
 	void CleanUI();
 	void LoadSettings(class IO_ini* ini);
+	static std::vector<std::string> member_row(const struct guild_member& m);
 	ui_manager* ui;
 };
 
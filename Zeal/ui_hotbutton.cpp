@@ -4,23 +4,38 @@
 #include "EqFunctions.h"
 #include "string_util.h"
 #include "Zeal.h"
+#include <algorithm>
+#include <ctime>
 
 void hotbutton_state::tick() { if (wnd) wnd->Checked = active(); }
 bool hotbutton_state::active() { return GetTickCount64() < start_time + duration; }
 void hotbutton_state::set(int _duration) { duration = _duration; start_time = GetTickCount64(); }
+ULONGLONG hotbutton_state::remaining() const { ULONGLONG now = GetTickCount64(); return now < start_time + duration ? start_time + duration - now : 0; }
 hotbutton_state::hotbutton_state(Zeal::EqUI::BasicWnd* btn) { wnd = btn; }
+
+struct saved_timer
+{
+	UINT8 page;
+	UINT8 slot;
+	UINT16 unused;
+	UINT32 remaining; //ms when saved
+	INT64 saved_at; //unix time, the time away counts against the timer
+};
 void __fastcall DoHotButton(Zeal::EqUI::EQWND* wnd, int unused, int p1, int p2)
 {
 	ZealService::get_instance()->ui->hotbutton->last_button = p1;
 	ZealService::get_instance()->ui->hotbutton->last_page=Zeal::EqGame::Windows->HotButton->GetPage();
-	ZealService::get_instance()->hooks->hook_map["DoHotButton"]->original(DoHotButton)(wnd, unused, p1, p2);
+	ui_hotbutton* hotbutton = ZealService::get_instance()->ui->hotbutton.get();
+	hotbutton->pressing = hotbutton->last_page * 10 + p1;
+	hook_ref<DoHotButton>::original()(wnd, unused, p1, p2);
+	hotbutton->pressing = -1;
 }
 
 void __fastcall SetCheck(Zeal::EqUI::EQWND* wnd, int unused, int checked)
 {
 	if (ZealService::get_instance()->ui->hotbutton->is_btn_active(wnd))
 		return;
-	ZealService::get_instance()->hooks->hook_map["SetCheck"]->original(SetCheck)(wnd, unused, checked);
+	hook_ref<SetCheck>::original()(wnd, unused, checked);
 }
 
 bool ui_hotbutton::is_btn_active(Zeal::EqUI::BasicWnd* btn)
@@ -43,7 +58,7 @@ void ui_hotbutton::InitUI()
 	states.clear();
 	for (int i = 0; i < 10; i++)
 	{
-		Zeal::EqUI::BasicWnd* btn = Zeal::EqGame::Windows->HotButton->GetChildItem("HB_Button" + std::to_string(i+1));
+		Zeal::EqUI::BasicWnd* btn = ui->GetChild(Zeal::EqGame::Windows->HotButton, "HB_Button" + std::to_string(i+1));
 		if (btn)
 		{
 			buttons[i] = btn;
@@ -60,11 +75,53 @@ void ui_hotbutton::InitUI()
 	}
 }
 
+void ui_hotbutton::save_timers()
+{
+	std::string packed;
+	INT64 now = time(nullptr);
+	for (auto& [page, slots] : states)
+	{
+		for (auto& [slot, state] : slots)
+		{
+			if (ULONGLONG left = state.remaining())
+			{
+				saved_timer t = { static_cast<UINT8>(page), static_cast<UINT8>(slot), 0, static_cast<UINT32>(left), now };
+				packed.append(reinterpret_cast<const char*>(&t), sizeof(t));
+			}
+		}
+	}
+	ZealService* zeal = ZealService::get_instance();
+	if (packed.length())
+		zeal->character_store->set("hotbutton.timers", packed);
+	else
+		zeal->character_store->erase("hotbutton.timers");
+}
+
+void ui_hotbutton::restore_timers()
+{
+	std::string packed;
+	if (!ZealService::get_instance()->character_store->get("hotbutton.timers", packed))
+		return;
+	INT64 now = time(nullptr);
+	for (size_t offset = 0; offset + sizeof(saved_timer) <= packed.length(); offset += sizeof(saved_timer))
+	{
+		saved_timer t;
+		memcpy(&t, packed.data() + offset, sizeof(t));
+		INT64 left = static_cast<INT64>(t.remaining) - (now - t.saved_at) * 1000;
+		if (left > 0 && states.count(t.page) && states[t.page].count(t.slot))
+			states[t.page][t.slot].set(static_cast<int>(left));
+	}
+}
+
 void ui_hotbutton::Render()
 {
 	if (Zeal::EqGame::is_in_game())
 	{
-		if (!states.size()) InitUI();
+		if (!states.size())
+		{
+			InitUI();
+			restore_timers();
+		}
 		int current_page = Zeal::EqGame::Windows->HotButton->GetPage();
 		if (states.count(current_page))
 		{
@@ -77,13 +134,148 @@ void ui_hotbutton::Render()
 	}
 }
 
+static int percent(const Zeal::EqStructures::Entity* ent)
+{
+	return ent && ent->HpMax ? static_cast<int>(ent->HpCurrent * 100 / ent->HpMax) : 0;
+}
+
+// target, !target, hp<n, hp>n, thp<n, thp>n (percentages of yourself or the target), lands:spell and !lands:spell
+// (a buff that would or wouldn't take hold, underscores for spaces in the name, a target it can't see counts as landing)
+bool ui_hotbutton::check_condition(const std::string& condition)
+{
+	Zeal::EqStructures::Entity* target = Zeal::EqGame::get_target();
+	if (condition == "target")
+		return target != nullptr;
+	if (condition == "!target")
+		return target == nullptr;
+	bool negate = condition.rfind("!lands:", 0) == 0;
+	if (negate || condition.rfind("lands:", 0) == 0)
+	{
+		std::string name = condition.substr(negate ? 7 : 6);
+		std::replace(name.begin(), name.end(), '_', ' ');
+		int spell_id = ZealService::get_instance()->spell_index->find(name);
+		if (spell_id < 0)
+			return false;
+		bool blocked = ZealService::get_instance()->buff_stacking->will_land(static_cast<WORD>(spell_id)).fit == buff_fit::blocked;
+		return negate ? blocked : !blocked;
+	}
+	size_t op = condition.find_first_of("<>");
+	int value = 0;
+	if (op == std::string::npos || !Zeal::String::tryParse(condition.substr(op + 1), &value))
+		return false;
+	std::string what = condition.substr(0, op);
+	int hp;
+	if (what == "hp")
+		hp = percent(Zeal::EqGame::get_self());
+	else if (what == "thp" && target)
+		hp = percent(target);
+	else
+		return false;
+	return condition[op] == '<' ? hp < value : hp > value;
+}
+
+void ui_hotbutton::start_macro(int key, const std::string& text)
+{
+	stop_macro(key);
+	hotbutton_macro& macro = macros[key];
+	macro.run_id = next_run_id++;
+	int total_wait = 0;
+	for (const std::string& part : Zeal::String::split(text, ";"))
+	{
+		std::string step = Zeal::String::trim_and_reduce_spaces(part);
+		if (step.empty())
+			continue;
+		int ms = 0;
+		if (step.rfind("wait ", 0) == 0 && Zeal::String::tryParse(step.substr(5), &ms))
+			total_wait += ms;
+		macro.steps.push_back(step);
+	}
+	if (key >= 0 && total_wait > 0)
+		states[key / 10][key % 10].set(total_wait); //held down until the last wait ends
+	run_macro(key, macro.run_id);
+}
+
+void ui_hotbutton::run_macro(int key, UINT run_id)
+{
+	while (true)
+	{
+		auto it = macros.find(key);
+		if (it == macros.end() || it->second.run_id != run_id)
+			return; //stopped or restarted by one of its own steps
+		hotbutton_macro& macro = it->second;
+		macro.timer = 0;
+		if (macro.next >= macro.steps.size())
+		{
+			macros.erase(it);
+			return;
+		}
+		std::string step = macro.steps[macro.next++];
+		int ms = 0;
+		if (step == "waitcast" || step.rfind("waitgem ", 0) == 0)
+		{
+			// a cast requested by an earlier step has no begin from the server yet, look again shortly
+			const CastTracker* casts = ZealService::get_instance()->cast_tracker.get();
+			int gem = 0;
+			if (casts->pending())
+			{
+				ms = 50;
+				macro.next--;
+			}
+			else if (step == "waitcast")
+				ms = casts->cast_remaining();
+			else if (Zeal::String::tryParse(step.substr(8), &gem))
+				ms = casts->ready_in(gem - 1);
+			if (ms <= 0)
+				continue;
+			macro.timer = ZealService::get_instance()->callbacks->add_delayed([this, key, run_id]() { run_macro(key, run_id); }, ms);
+			return;
+		}
+		if (step.rfind("wait ", 0) == 0 && Zeal::String::tryParse(step.substr(5), &ms))
+		{
+			macro.timer = ZealService::get_instance()->callbacks->add_delayed([this, key, run_id]() { run_macro(key, run_id); }, ms);
+			return;
+		}
+		if (step.front() == '?')
+		{
+			size_t space = step.find(' ');
+			if (space == std::string::npos || !check_condition(step.substr(1, space - 1)))
+				continue;
+			step = step.substr(space + 1);
+		}
+		if (step.rfind("/zmacro", 0) == 0)
+			continue; //no nesting
+		Zeal::EqGame::interpret_command(step.c_str());
+	}
+}
+
+void ui_hotbutton::stop_macro(int key)
+{
+	auto it = macros.find(key);
+	if (it == macros.end())
+		return;
+	if (it->second.timer)
+		ZealService::get_instance()->callbacks->cancel_timer(it->second.timer);
+	if (key >= 0)
+		states[key / 10][key % 10].set(0);
+	macros.erase(it);
+}
+
+void ui_hotbutton::stop_macros()
+{
+	while (!macros.empty())
+		stop_macro(macros.begin()->first);
+}
+
 ui_hotbutton::ui_hotbutton(ZealService* zeal, IO_ini* ini, ui_manager* mgr)
 {
 	ui = mgr;
 	zeal->callbacks->add_generic([this]() { Render();  }, callback_type::Render);
-	zeal->callbacks->add_generic([this]() { InitUI(); }, callback_type::InitUI);
-	zeal->hooks->Add("DoHotButton", 0x4209bd, DoHotButton, hook_type_detour);
-	zeal->hooks->Add("SetCheck", 0x595790, SetCheck, hook_type_detour);
+	zeal->callbacks->add_generic([this]() { InitUI(); restore_timers(); }, callback_type::InitUI);
+	zeal->callbacks->add_generic([this]() { save_timers(); }, callback_type::CleanUI);
+	zeal->callbacks->add_generic([this]() { stop_macros(); }, callback_type::Zone);
+	zeal->callbacks->add_generic([this]() { stop_macros(); }, callback_type::CharacterSelect);
+	zeal->hooks->Add<DoHotButton>("DoHotButton", 0x4209bd, hook_type_detour);
+	zeal->hooks->Add<SetCheck>("SetCheck", 0x595790, hook_type_detour);
 	zeal->commands_hook->add("/timer", { }, "Sets a timer for the last pressed hotbutton to keep it visually pressed in duration is in deciseconds (10=1 second).",
 		[this](std::vector<std::string>& args) {
 
@@ -99,6 +291,24 @@ ui_hotbutton::ui_hotbutton(ZealService* zeal, IO_ini* ini, ui_manager* mgr)
 			}
 			return true; //return true to stop the game from processing any further on this command, false if you want to just add features to an existing cmd
 		});
+	zeal->commands_hook->add("/zmacro", { }, "Runs ; separated steps from a hotbutton: a command, wait <ms>, waitcast (until your cast lands), waitgem <n> (until gem n is ready), or ?target, ?!target, ?hp<n, ?thp<n (also >) before a command. /zmacro stop cancels them all.",
+		[this](std::vector<std::string>& args) {
+			if (args.size() < 2)
+			{
+				Zeal::EqGame::print_chat("usage: /zmacro <step>; wait 250; ?target <step>  or  /zmacro stop");
+				return true;
+			}
+			if (Zeal::String::compare_insensitive(args[1], "stop"))
+			{
+				stop_macros();
+				return true;
+			}
+			std::string text;
+			for (size_t i = 1; i < args.size(); i++)
+				text += (i > 1 ? " " : "") + args[i];
+			start_macro(pressing, text);
+			return true;
+		});
 }
 ui_hotbutton::~ui_hotbutton()
 {
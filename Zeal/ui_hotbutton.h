@@ -10,6 +10,7 @@ public:
 	void tick();
 	bool active();
 	void set(int _duration);
+	ULONGLONG remaining() const;
 	Zeal::EqUI::BasicWnd* wnd = 0;
 	hotbutton_state(Zeal::EqUI::BasicWnd* btn);
 	hotbutton_state() {};
@@ -18,11 +19,22 @@ private:
 	int duration = 0;
 };
 
+// a /zmacro line queues its steps on the button that ran it, steps run back to back in one frame
+// until a wait, which resumes from the callback timer heap; pressing the button again restarts it
+struct hotbutton_macro
+{
+	std::vector<std::string> steps;
+	size_t next = 0;
+	UINT timer = 0; //pending wait, 0 when none
+	UINT run_id = 0;
+};
+
 class ui_hotbutton
 {
 public:
 	int last_button = 0;
 	int last_page = 0;
+	int pressing = -1; //page * 10 + button while the game runs a hotbutton, -1 for typed commands
 	bool is_btn_active(Zeal::EqUI::BasicWnd* btn);
 	ui_hotbutton(class ZealService* zeal, class IO_ini* ini, class ui_manager* mgr);
 	~ui_hotbutton();
@@ -31,6 +43,15 @@ private:
 	std::unordered_map<int, std::unordered_map<int, hotbutton_state>> states;
 	void InitUI();
 	void Render();
+	void save_timers(); //running /timer states go to the character store over a zone or camp
+	void restore_timers();
+	void start_macro(int key, const std::string& text);
+	void run_macro(int key, UINT run_id);
+	void stop_macro(int key);
+	void stop_macros();
+	bool check_condition(const std::string& condition);
+	std::unordered_map<int, hotbutton_macro> macros;
+	UINT next_run_id = 1;
 	
 	ui_manager* ui;
 };
@@ -0,0 +1,176 @@
+#include "ui_list.h"
+#include <algorithm>
+#include <cctype>
+
+static bool contains_insensitive(const std::string& text, const std::string& lowered_needle)
+{
+	auto it = std::search(text.begin(), text.end(), lowered_needle.begin(), lowered_needle.end(),
+		[](char a, char b) { return tolower((unsigned char)a) == b; });
+	return it != text.end();
+}
+
+// numbers compare by value so levels and dates in d/m/y columns order sensibly, everything else case insensitive
+static bool cell_less(const std::string& a, const std::string& b)
+{
+	if (a.size() && b.size() && isdigit((unsigned char)a[0]) && isdigit((unsigned char)b[0]))
+	{
+		long x = strtol(a.c_str(), nullptr, 10);
+		long y = strtol(b.c_str(), nullptr, 10);
+		if (x != y)
+			return x < y;
+	}
+	return _stricmp(a.c_str(), b.c_str()) < 0;
+}
+
+void ui_list::set_rows(const std::vector<std::vector<std::string>>& rows)
+{
+	size_t column_total = 0;
+	for (const auto& row : rows)
+		column_total = row.size() > column_total ? row.size() : column_total;
+	columns.assign(column_total, {});
+	for (auto& column : columns)
+		column.reserve(rows.size());
+	for (const auto& row : rows)
+		for (size_t c = 0; c < column_total; ++c)
+			columns[c].push_back(c < row.size() ? row[c] : std::string());
+	std::fill(shown.begin(), shown.end(), -1);
+	apply_filter();
+}
+
+void ui_list::set_row(size_t data_row, const std::vector<std::string>& values)
+{
+	size_t rows = columns.size() ? columns[0].size() : 0;
+	if (data_row > rows)
+		return;
+	while (columns.size() < values.size())
+		columns.push_back(std::vector<std::string>(rows));
+	for (size_t c = 0; c < columns.size(); ++c)
+	{
+		const std::string& value = c < values.size() ? values[c] : std::string();
+		if (data_row == rows)
+			columns[c].push_back(value);
+		else
+			columns[c][data_row] = value;
+	}
+	for (int& row : shown)
+		if (row == (int)data_row)
+			row = -1;
+	if (data_row == rows && filter_text.empty() && sort_column < 0)
+	{
+		order.push_back((int)data_row);
+		needs_rebuild = true;
+	}
+	else if (!filter_text.empty() || sort_column >= 0)
+		apply_filter(); //the row may have moved or dropped out
+}
+
+void ui_list::clear()
+{
+	columns.clear();
+	order.clear();
+	needs_rebuild = true;
+}
+
+void ui_list::apply_filter()
+{
+	size_t rows = columns.size() ? columns[0].size() : 0;
+	order.clear();
+	order.reserve(rows);
+	for (size_t r = 0; r < rows; ++r)
+	{
+		bool keep = filter_text.empty();
+		for (size_t c = 0; !keep && c < columns.size(); ++c)
+			keep = (filter_column < 0 || filter_column == (int)c) && contains_insensitive(columns[c][r], filter_text);
+		if (keep)
+			order.push_back((int)r);
+	}
+	if (sort_column >= 0)
+		sort(sort_column, sort_ascending);
+	needs_rebuild = true;
+}
+
+void ui_list::sort(int column, bool ascending)
+{
+	if (column < 0 || column >= (int)columns.size())
+		return;
+	sort_column = column;
+	sort_ascending = ascending;
+	const std::vector<std::string>& keys = columns[column];
+	std::stable_sort(order.begin(), order.end(), [&keys, ascending](int a, int b) {
+		return ascending ? cell_less(keys[a], keys[b]) : cell_less(keys[b], keys[a]);
+	});
+	//same row count, the visible rows get rewritten by the shown check
+}
+
+void ui_list::filter(const std::string& text, int column)
+{
+	filter_text = text;
+	std::transform(filter_text.begin(), filter_text.end(), filter_text.begin(), [](char c) { return (char)tolower((unsigned char)c); });
+	filter_column = column;
+	apply_filter();
+}
+
+void ui_list::attach(Zeal::EqUI::ListWnd* wnd)
+{
+	list = wnd;
+	list_rows = -1; //unknown contents, the first rebuild starts over
+	needs_rebuild = true;
+}
+
+void ui_list::detach()
+{
+	list = nullptr;
+	list_rows = 0;
+	shown.clear();
+}
+
+// empty rows only, text is written by fill() once a row is on screen; a list that only grew keeps its rows
+void ui_list::rebuild()
+{
+	needs_rebuild = false;
+	if ((int)order.size() < list_rows || (int)shown.size() != list_rows)
+	{
+		list->DeleteAll();
+		list_rows = 0;
+		shown.clear();
+	}
+	shown.resize(order.size(), -1);
+	for (; list_rows < (int)order.size(); ++list_rows)
+	{
+		list->AddString("");
+		list->SetItemData(list_rows);
+	}
+}
+
+void ui_list::fill(int first, int last)
+{
+	for (int row = first; row < last; ++row)
+	{
+		if (shown[row] == order[row])
+			continue;
+		for (size_t c = 0; c < columns.size(); ++c)
+			list->SetItemText(columns[c][order[row]], row, (int)c);
+		shown[row] = order[row];
+	}
+}
+
+void ui_list::update()
+{
+	if (!list)
+		return;
+	if (needs_rebuild)
+		rebuild();
+	if (!list->IsVisible || !order.size())
+		return;
+	// the list scrolls in pixels, the row height follows from the total scroll range over the row count
+	int rows = (int)order.size();
+	int height = list->Location.Bottom - list->Location.Top;
+	if (height <= 0)
+		return;
+	int row_height = ((int)list->VScrollMax + height) / rows;
+	if (row_height < 1)
+		row_height = 1;
+	int first = (int)list->VScrollPos / row_height - 1;
+	int last = first + height / row_height + 3;
+	fill(first < 0 ? 0 : first, last > rows ? rows : last);
+}
@@ -0,0 +1,37 @@
+#pragma once
+#include "EqUI.h"
+#include <string>
+#include <vector>
+
+// keeps a table's text column by column and only writes the rows of the game's ListWnd that are scrolled into view
+// the list gets one empty row per shown data row so its own scrollbar keeps working, update() fills in what became visible
+// sorting and filtering reorder the data only, the list rows are rewritten lazily as they come into view
+class ui_list
+{
+public:
+	void set_rows(const std::vector<std::vector<std::string>>& rows);
+	void clear();
+	void set_row(size_t data_row, const std::vector<std::string>& values); //data_row == the row total appends, only the touched row is rewritten
+	void sort(int column, bool ascending = true);
+	void filter(const std::string& text, int column = -1); //case insensitive substring, -1 searches every column, empty clears
+	void attach(Zeal::EqUI::ListWnd* wnd);
+	void detach();
+	void update(); //once a frame while attached
+	size_t row_count() const { return order.size(); }
+	size_t column_count() const { return columns.size(); }
+	const std::string& cell(size_t row, size_t column) const { return columns[column][order[row]]; } //row in filtered and sorted order
+private:
+	void rebuild();
+	void apply_filter();
+	void fill(int first, int last);
+	std::vector<std::vector<std::string>> columns; //columns[column][data row]
+	std::vector<int> order; //data rows that pass the filter, in sort order
+	std::vector<int> shown; //list row -> data row whose text it holds, -1 when blank
+	std::string filter_text;
+	int filter_column = -1;
+	int sort_column = -1;
+	bool sort_ascending = true;
+	Zeal::EqUI::ListWnd* list = nullptr;
+	bool needs_rebuild = false;
+	int list_rows = 0; //rows currently in the ListWnd
+};
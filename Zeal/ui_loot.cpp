@@ -35,31 +35,47 @@ static int __fastcall LootAllButtonDown(Zeal::EqUI::LootWnd* pWnd, int unused, Z
 {
 	int rval = reinterpret_cast<int(__fastcall*)(Zeal::EqUI::LootWnd * pWnd, int unused, Zeal::EqUI::CXPoint pt, unsigned int flag)>(0x0595330)(pWnd, unused, pt, flag);
 	ZealService* zeal = ZealService::get_instance();
-	zeal->looting_hook->loot_all = true;
-	zeal->looting_hook->looted_item();
+	if (zeal && zeal->looting_hook)
+		zeal->looting_hook->queue_loot(false);
 	return rval;
 }
 
+void ui_loot::attach(Zeal::EqUI::BasicWnd* btn, const char* name, LPVOID handler)
+{
+	if (!btn)
+		return;
+	auto& shadow = ZealService::get_instance()->hooks->ShadowVTable<Zeal::EqUI::BaseVTable>(name, btn->vtbl);
+	shadow.patch(&Zeal::EqUI::BaseVTable::HandleLButtonDown, handler).attach(btn);
+	attached.push_back({ btn, &shadow });
+}
+
 void ui_loot::InitUI()
 {
-	Zeal::EqUI::BasicWnd* btn = Zeal::EqGame::Windows->Loot->GetChildItem("LinkAllButton");
-	if (btn)
-	{
-		btn->SetupCustomVTable();
-		btn->vtbl->HandleLButtonDown = LinkAllButtonDown;
-	}
+	CleanUI();
+	attached_wnd = Zeal::EqGame::Windows->Loot;
+	if (!attached_wnd)
+		return;
+	attach(ui->GetChild(attached_wnd, "LinkAllButton"), "LootWnd.LinkAllButton", reinterpret_cast<LPVOID>(LinkAllButtonDown));
+	attach(ui->GetChild(attached_wnd, "LootAllButton"), "LootWnd.LootAllButton", reinterpret_cast<LPVOID>(LootAllButtonDown));
+}
 
-	btn = Zeal::EqGame::Windows->Loot->GetChildItem("LootAllButton");
-	if (btn)
+// only while the loot window they were found in is still the game's, after a ui reload they are gone with it
+void ui_loot::CleanUI()
+{
+	if (attached_wnd && Zeal::EqGame::Windows && Zeal::EqGame::Windows->Loot == attached_wnd)
 	{
-		btn->SetupCustomVTable();
-		btn->vtbl->HandleLButtonDown = LootAllButtonDown;
+		for (attached_button& a : attached)
+			a.shadow->detach(a.btn);
 	}
+	attached.clear();
+	attached_wnd = nullptr;
 }
+
 ui_loot::ui_loot(ZealService* zeal, IO_ini* ini, ui_manager* mgr)
 {
 	ui = mgr;
 	zeal->callbacks->add_generic([this]() { InitUI(); }, callback_type::InitUI);
+	zeal->callbacks->add_generic([this]() { CleanUI(); }, callback_type::CleanUI);
 	if (Zeal::EqGame::is_in_game()) InitUI();
 	/*zeal->callbacks->add_packet([this](UINT opcode, char* buffer, UINT size) {
 		Zeal::EqGame::print_chat("Opcode: 0x%x Size: %i Buffer: %s", opcode, size, StringUtil::byteArrayToHexString(buffer, size).c_str());
@@ -68,5 +84,5 @@ ui_loot::ui_loot(ZealService* zeal, IO_ini* ini, ui_manager* mgr)
 }
 ui_loot::~ui_loot()
 {
-
+	CleanUI();
 }
@@ -2,6 +2,7 @@
 #include "hook_wrapper.h"
 #include "memory.h"
 #include "EqUI.h"
+#include <vector>
 
 class ui_loot
 {
@@ -10,5 +11,15 @@ public:
 	~ui_loot();
 private:
 	void InitUI();
+	void CleanUI();
+	void attach(Zeal::EqUI::BasicWnd* btn, const char* name, LPVOID handler);
 	ui_manager* ui;
+	// the game's buttons while they point at zeal's shadows, put back before the window goes away and on unload
+	struct attached_button
+	{
+		Zeal::EqUI::BasicWnd* btn;
+		shadow_vtable<Zeal::EqUI::BaseVTable>* shadow;
+	};
+	std::vector<attached_button> attached;
+	Zeal::EqUI::LootWnd* attached_wnd = nullptr;
 };
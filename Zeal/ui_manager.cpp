@@ -7,7 +7,7 @@
 static int __fastcall CheckboxClick_hook(Zeal::EqUI::BasicWnd* pWnd, int unused, Zeal::EqUI::CXPoint pt, unsigned int flag)
 {
 	ui_manager* ui = ZealService::get_instance()->ui.get();
-	int rval = ZealService::get_instance()->hooks->hook_map["CheckboxClick"]->original(CheckboxClick_hook)(pWnd, unused, pt, flag);
+	int rval = hook_ref<CheckboxClick_hook>::original()(pWnd, unused, pt, flag);
 	if (ui->checkbox_callbacks.count(pWnd) > 0)
 		ui->checkbox_callbacks[pWnd](pWnd);
 	return rval;
@@ -15,7 +15,7 @@ static int __fastcall CheckboxClick_hook(Zeal::EqUI::BasicWnd* pWnd, int unused,
 static void __fastcall SetSliderValue_hook(Zeal::EqUI::SliderWnd* pWnd, int unused, int value)
 {
 	ui_manager* ui = ZealService::get_instance()->ui.get();
-	ZealService::get_instance()->hooks->hook_map["SetSliderValue"]->original(SetSliderValue_hook)(pWnd, unused, value);
+	hook_ref<SetSliderValue_hook>::original()(pWnd, unused, value);
 
 	if (value < 0)
 		value = 0;
@@ -27,80 +27,116 @@ static void __fastcall SetSliderValue_hook(Zeal::EqUI::SliderWnd* pWnd, int unus
 static void __fastcall SetComboValue_hook(Zeal::EqUI::BasicWnd* pWnd, int unused, int value)
 {
 	ui_manager* ui = ZealService::get_instance()->ui.get();
-	ZealService::get_instance()->hooks->hook_map["SetComboValue"]->original(SetComboValue_hook)(pWnd, unused, value);
+	hook_ref<SetComboValue_hook>::original()(pWnd, unused, value);
 	if (ui->combo_callbacks.count(pWnd) > 0)
 		ui->combo_callbacks[pWnd](pWnd, value);
 	else if (ui->combo_callbacks.count(pWnd->ParentWnd) > 0)
 		ui->combo_callbacks[pWnd->ParentWnd](pWnd->ParentWnd, value);
 }
 
-void ui_manager::AddCheckboxCallback(Zeal::EqUI::BasicWnd* wnd, std::string name, std::function<void(Zeal::EqUI::BasicWnd*)> callback)
+ui_handle ui_manager::AddControl(Zeal::EqUI::BasicWnd* wnd, const std::string& name, ui_control_type type)
+{
+	auto it = control_handles.find(name);
+	if (it != control_handles.end())
+	{
+		controls[it->second].wnd = wnd;
+		return it->second;
+	}
+	controls.push_back({ wnd, type, false, 0, "" });
+	ui_handle handle = (ui_handle)controls.size() - 1;
+	control_handles[name] = handle;
+	return handle;
+}
+
+ui_handle ui_manager::GetHandle(const std::string& name) const
+{
+	auto it = control_handles.find(name);
+	return it != control_handles.end() ? it->second : -1;
+}
+
+ui_handle ui_manager::AddCheckboxCallback(Zeal::EqUI::BasicWnd* wnd, std::string name, std::function<void(Zeal::EqUI::BasicWnd*)> callback)
 {
 	if (wnd)
 	{
-		Zeal::EqUI::BasicWnd* btn = wnd->GetChildItem(name);
+		Zeal::EqUI::BasicWnd* btn = GetChild(wnd, name);
 		if (btn)
 		{
 			checkbox_callbacks[btn] = callback;
-			checkbox_names[name] = btn;
+			return AddControl(btn, name, ui_control_type::checkbox);
 		}
 	}
+	return -1;
 }
 
-void ui_manager::AddSliderCallback(Zeal::EqUI::BasicWnd* wnd, std::string name, std::function<void(Zeal::EqUI::SliderWnd*, int)> callback)
+ui_handle ui_manager::AddSliderCallback(Zeal::EqUI::BasicWnd* wnd, std::string name, std::function<void(Zeal::EqUI::SliderWnd*, int)> callback)
 {
 	if (wnd)
 	{
-		Zeal::EqUI::SliderWnd* btn = (Zeal::EqUI::SliderWnd*)wnd->GetChildItem(name);
+		Zeal::EqUI::SliderWnd* btn = (Zeal::EqUI::SliderWnd*)GetChild(wnd, name);
 		if (btn)
 		{
 			slider_callbacks[btn] = callback;
-			slider_names[name] = btn;
 			btn->max_val = 100;
+			return AddControl(btn, name, ui_control_type::slider);
 		}
 	}
+	return -1;
 }
 
-void ui_manager::AddComboCallback(Zeal::EqUI::BasicWnd* wnd, std::string name, std::function<void(Zeal::EqUI::BasicWnd*, int)> callback)
+ui_handle ui_manager::AddComboCallback(Zeal::EqUI::BasicWnd* wnd, std::string name, std::function<void(Zeal::EqUI::BasicWnd*, int)> callback)
 {
 	if (wnd)
 	{
-		Zeal::EqUI::BasicWnd* btn = (Zeal::EqUI::BasicWnd*)wnd->GetChildItem(name);
+		Zeal::EqUI::BasicWnd* btn = (Zeal::EqUI::BasicWnd*)GetChild(wnd, name);
 		if (btn)
 		{
 			combo_callbacks[btn] = callback;
-			combo_names[name] = btn;
+			return AddControl(btn, name, ui_control_type::combo);
 		}
 	}
+	return -1;
 }
 
-void ui_manager::AddLabel(Zeal::EqUI::BasicWnd* wnd, std::string name)
+ui_handle ui_manager::AddLabel(Zeal::EqUI::BasicWnd* wnd, std::string name)
 {
 	if (wnd)
 	{
-		Zeal::EqUI::BasicWnd* btn = wnd->GetChildItem(name);
+		Zeal::EqUI::BasicWnd* btn = GetChild(wnd, name);
 		if (btn)
-		{
-			label_names[name] = btn;
-		}
+			return AddControl(btn, name, ui_control_type::label);
 	}
+	return -1;
 }
 
-void ui_manager::SetSliderValue(std::string name, int value)
+void ui_manager::MarkDirty(ui_handle handle)
 {
-	if (slider_names.count(name) > 0)
+	if (!controls[handle].dirty)
 	{
-		ZealService::get_instance()->hooks->hook_map["SetSliderValue"]->original(SetSliderValue_hook)(slider_names[name], 0, value);
+		controls[handle].dirty = true;
+		dirty_controls.push_back(handle);
 	}
 }
-void ui_manager::SetSliderValue(std::string name, float value)
+
+void ui_manager::SetSliderValue(ui_handle handle, int value)
 {
-	if (slider_names.count(name) > 0)
-	{
-		ZealService::get_instance()->hooks->hook_map["SetSliderValue"]->original(SetSliderValue_hook)(slider_names[name], 0, static_cast<int>(value));
-	}
+	if (handle < 0 || handle >= (ui_handle)controls.size() || controls[handle].type != ui_control_type::slider)
+		return;
+	controls[handle].value = value;
+	MarkDirty(handle);
+}
+void ui_manager::SetSliderValue(ui_handle handle, float value)
+{
+	SetSliderValue(handle, static_cast<int>(value));
 }
-void ui_manager::AddListItems(Zeal::EqUI::ListWnd* wnd, const std::vector<std::vector<std::string>>data)
+void ui_manager::SetSliderValue(const std::string& name, int value)
+{
+	SetSliderValue(GetHandle(name), value);
+}
+void ui_manager::SetSliderValue(const std::string& name, float value)
+{
+	SetSliderValue(GetHandle(name), static_cast<int>(value));
+}
+void ui_manager::AddListItems(Zeal::EqUI::ListWnd* wnd, const std::vector<std::vector<std::string>>& data)
 {
 
 	for (int row = 0; auto& current_row : data)
@@ -116,68 +152,168 @@ void ui_manager::AddListItems(Zeal::EqUI::ListWnd* wnd, const std::vector<std::v
 		row++;
 	}
 }
-void ui_manager::SetChecked(std::string name, bool checked)
+void ui_manager::SetChecked(ui_handle handle, bool checked)
 {
-	if (checkbox_names.count(name) > 0)
-		checkbox_names[name]->Checked = checked;
+	if (handle < 0 || handle >= (ui_handle)controls.size() || controls[handle].type != ui_control_type::checkbox)
+		return;
+	controls[handle].value = checked;
+	MarkDirty(handle);
+}
+void ui_manager::SetChecked(const std::string& name, bool checked)
+{
+	SetChecked(GetHandle(name), checked);
 }
 
-void ui_manager::SetLabelValue(std::string name, const char* format, ...)
+void ui_manager::SetLabelText(ui_handle handle, const char* text)
+{
+	if (handle < 0 || handle >= (ui_handle)controls.size() || controls[handle].type != ui_control_type::label)
+		return;
+	controls[handle].text = text;
+	MarkDirty(handle);
+}
+void ui_manager::SetLabelValue(ui_handle handle, const char* format, ...)
 {
+	if (handle < 0 || handle >= (ui_handle)controls.size())
+		return;
 	va_list argptr;
 	char buffer[512];
 	va_start(argptr, format);
 	vsnprintf(buffer, 511, format, argptr);
 	va_end(argptr);
-	if (label_names.count(name) > 0)
-	{
-		Zeal::EqGame::EqGameInternal::CXStr_PrintString(&label_names[name]->Text, buffer);
-	}
+	SetLabelText(handle, buffer);
+}
+void ui_manager::SetLabelValue(const std::string& name, const char* format, ...)
+{
+	ui_handle handle = GetHandle(name);
+	if (handle < 0)
+		return;
+	va_list argptr;
+	char buffer[512];
+	va_start(argptr, format);
+	vsnprintf(buffer, 511, format, argptr);
+	va_end(argptr);
+	SetLabelText(handle, buffer);
+}
+
+void ui_manager::SetComboValue(ui_handle handle, int value)
+{
+	if (handle < 0 || handle >= (ui_handle)controls.size() || controls[handle].type != ui_control_type::combo)
+		return;
+	controls[handle].value = value;
+	MarkDirty(handle);
+}
+void ui_manager::SetComboValue(const std::string& name, int value)
+{
+	SetComboValue(GetHandle(name), value);
 }
 
-void ui_manager::SetComboValue(std::string name, int value)
+// the last value set on each dirty control since the previous frame, checkboxes and labels already showing it are left alone
+void ui_manager::FlushUpdates()
 {
-	if (combo_names.count(name) > 0)
+	for (ui_handle handle : dirty_controls)
 	{
-		ZealService::get_instance()->hooks->hook_map["SetComboValue"]->original(SetComboValue_hook)(combo_names[name]->FirstChildWnd, 0, value);
+		ui_control& c = controls[handle];
+		c.dirty = false;
+		switch (c.type)
+		{
+		case ui_control_type::checkbox:
+			if (c.wnd->Checked != (BYTE)(c.value != 0))
+				c.wnd->Checked = (BYTE)(c.value != 0);
+			break;
+		case ui_control_type::slider:
+			hook_ref<SetSliderValue_hook>::original()((Zeal::EqUI::SliderWnd*)c.wnd, 0, c.value);
+			break;
+		case ui_control_type::combo:
+			hook_ref<SetComboValue_hook>::original()(c.wnd->FirstChildWnd, 0, c.value);
+			break;
+		case ui_control_type::label:
+			if (!c.wnd->Text.Data || strcmp(c.wnd->Text.Data->Text, c.text.c_str()))
+				Zeal::EqGame::EqGameInternal::CXStr_PrintString(&c.wnd->Text, "%s", c.text.c_str());
+			break;
+		}
 	}
+	dirty_controls.clear();
 }
 
 
 void ui_manager::CleanUI()
 {
 	Zeal::EqGame::print_debug("Clean UI UIMANAGER");
-	combo_names.clear();
 	combo_callbacks.clear();
-	checkbox_names.clear();
 	checkbox_callbacks.clear();
-	slider_names.clear();
 	slider_callbacks.clear();
-	label_names.clear();
+	controls.clear();
+	control_handles.clear();
+	dirty_controls.clear();
+	WindowChildren.clear(); //the atoms stay valid, only the windows go away
 }
 
 void ui_manager::init_ui()
 {
 
 }
-//Zeal::EqUI::BasicWnd* ui_manager::GetChild(Zeal::EqUI::BasicWnd* parent, std::string name) 
-//{
-//	return WindowChildren[parent][name];
-//}
-//
-//static Zeal::EqUI::BasicWnd* __fastcall CreateXWndFromTemplate_hook(int sidlmgr, int unused, Zeal::EqUI::BasicWnd* parent, Zeal::EqUI::ControlTemplate* control_template)
-//{
-//	Zeal::EqUI::BasicWnd* rval = ZealService::get_instance()->hooks->hook_map["CreateXWndFromTemplate"]->original(CreateXWndFromTemplate_hook)(sidlmgr, unused, parent, control_template);
-//	ui_manager* ui = ZealService::get_instance()->ui.get();
-//	if (control_template && control_template->Item)
-//		ui->WindowChildren[parent][control_template->Item->Text] = rval;
-//	return rval;
-//}
+UINT32 ui_manager::Intern(const std::string& name)
+{
+	auto it = atoms.find(name);
+	if (it != atoms.end())
+		return it->second;
+	UINT32 atom = (UINT32)atoms.size() + 1;
+	atoms[name] = atom;
+	return atom;
+}
+
+UINT32 ui_manager::FindAtom(const std::string& name) const
+{
+	auto it = atoms.find(name);
+	return it != atoms.end() ? it->second : 0;
+}
+
+void ui_manager::AddChild(Zeal::EqUI::BasicWnd* parent, const char* name, Zeal::EqUI::BasicWnd* child)
+{
+	UINT32 atom = Intern(name);
+	// registered on every ancestor so a lookup from the top level window finds nested controls like GetChildItem does
+	for (int depth = 0; parent && depth < 32; ++depth, parent = parent->ParentWnd)
+	{
+		std::vector<child_entry>& children = WindowChildren[parent];
+		auto it = std::lower_bound(children.begin(), children.end(), atom, [](const child_entry& e, UINT32 a) { return e.atom < a; });
+		if (it == children.end() || it->atom != atom) //the first window created with a name wins
+			children.insert(it, { atom, child });
+	}
+}
+
+Zeal::EqUI::BasicWnd* ui_manager::GetChild(Zeal::EqUI::BasicWnd* parent, UINT32 atom) const
+{
+	auto table = WindowChildren.find(parent);
+	if (!atom || table == WindowChildren.end())
+		return nullptr;
+	const std::vector<child_entry>& children = table->second;
+	auto it = std::lower_bound(children.begin(), children.end(), atom, [](const child_entry& e, UINT32 a) { return e.atom < a; });
+	return it != children.end() && it->atom == atom ? it->wnd : nullptr;
+}
+
+Zeal::EqUI::BasicWnd* ui_manager::GetChild(Zeal::EqUI::BasicWnd* parent, const std::string& name)
+{
+	if (!parent)
+		return nullptr;
+	Zeal::EqUI::BasicWnd* child = GetChild(parent, FindAtom(name));
+	return child ? child : parent->GetChildItem(name);
+}
+
+static Zeal::EqUI::BasicWnd* __fastcall CreateXWndFromTemplate_hook(int sidlmgr, int unused, Zeal::EqUI::BasicWnd* parent, Zeal::EqUI::ControlTemplate* control_template)
+{
+	Zeal::EqUI::BasicWnd* rval = hook_ref<CreateXWndFromTemplate_hook>::original()(sidlmgr, unused, parent, control_template);
+	ui_manager* ui = ZealService::get_instance()->ui.get();
+	if (ui && rval && parent && control_template && control_template->Item)
+		ui->AddChild(parent, control_template->Item->Text, rval);
+	return rval;
+}
 
 ui_manager::ui_manager(ZealService* zeal, IO_ini* ini)
 {
 	zeal->callbacks->add_generic([this]() { CleanUI(); }, callback_type::CleanUI);
 	zeal->callbacks->add_generic([this]() { init_ui(); }, callback_type::InitUI);
+	zeal->callbacks->add_generic([this]() { FlushUpdates(); }, callback_type::RenderUI);
+	zeal->callbacks->add_generic([this]() { FlushUpdates(); }, callback_type::EndMainLoop); //nothing left by then unless the render ui hook is missing
 
 	bank = std::make_shared<ui_bank>(zeal, ini, this);
 	options = std::make_shared<ui_options>(zeal, ini, this);
@@ -186,9 +322,9 @@ ui_manager::ui_manager(ZealService* zeal, IO_ini* ini)
 	raid = std::make_shared<ui_raid>(zeal, ini, this);
 	hotbutton = std::make_shared<ui_hotbutton>(zeal, ini, this);
 
-//	zeal->hooks->Add("CreateXWndFromTemplate", 0x59bc40, CreateXWndFromTemplate_hook, hook_type_detour);
-	zeal->hooks->Add("CheckboxClick", 0x5c3480, CheckboxClick_hook, hook_type_detour);
-	zeal->hooks->Add("SetSliderValue", 0x5a6c70, SetSliderValue_hook, hook_type_detour);
-	zeal->hooks->Add("SetComboValue", 0x579af0, SetComboValue_hook, hook_type_detour);
+	zeal->hooks->Add<CreateXWndFromTemplate_hook>("CreateXWndFromTemplate", 0x59bc40, hook_type_detour);
+	zeal->hooks->Add<CheckboxClick_hook>("CheckboxClick", 0x5c3480, hook_type_detour);
+	zeal->hooks->Add<SetSliderValue_hook>("SetSliderValue", 0x5a6c70, hook_type_detour);
+	zeal->hooks->Add<SetComboValue_hook>("SetComboValue", 0x579af0, hook_type_detour);
 }
 
@@ -9,31 +9,67 @@
 #include "memory.h"
 #include "EqUI.h"
 
+using ui_handle = int; //index into ui_manager::controls, -1 when the control wasn't found
+
+enum class ui_control_type
+{
+	checkbox,
+	slider,
+	combo,
+	label
+};
+
+// a named control resolved once when it is added, setters only record the value and mark it dirty
+// dirty controls are written once per frame right before the client renders the ui
+struct ui_control
+{
+	Zeal::EqUI::BasicWnd* wnd;
+	ui_control_type type;
+	bool dirty;
+	int value;
+	std::string text;
+};
+
 class ui_manager
 {
 public:
 
 	std::unordered_map<Zeal::EqUI::BasicWnd*, std::function<void(Zeal::EqUI::BasicWnd*)>> checkbox_callbacks;
-	std::unordered_map<std::string, Zeal::EqUI::BasicWnd*> checkbox_names;
 	std::unordered_map<Zeal::EqUI::SliderWnd*, std::function<void(Zeal::EqUI::SliderWnd*, int)>> slider_callbacks;
-	std::unordered_map<std::string, Zeal::EqUI::SliderWnd*> slider_names;
 	std::unordered_map<Zeal::EqUI::BasicWnd*, std::function<void(Zeal::EqUI::BasicWnd*, int)>> combo_callbacks;
-	std::unordered_map<std::string, Zeal::EqUI::BasicWnd*> combo_names;
-	std::unordered_map<std::string, Zeal::EqUI::BasicWnd*> label_names;
-
-	std::unordered_map<Zeal::EqUI::BasicWnd*, std::unordered_map<std::string, Zeal::EqUI::BasicWnd*>> WindowChildren;
-
-	Zeal::EqUI::BasicWnd* GetChild(Zeal::EqUI::BasicWnd* parent, std::string name);
-	void SetLabelValue(std::string name, const char* format, ...);
-	void SetSliderValue(std::string name, int value);
-	void SetSliderValue(std::string name, float value);
-	void SetComboValue(std::string name, int value);
-	void SetChecked(std::string name, bool checked);
-	void AddCheckboxCallback(Zeal::EqUI::BasicWnd* wnd, std::string name, std::function<void(Zeal::EqUI::BasicWnd*)> callback);
-	void AddSliderCallback(Zeal::EqUI::BasicWnd* wnd, std::string name, std::function<void(Zeal::EqUI::SliderWnd*, int)> callback);
-	void AddComboCallback(Zeal::EqUI::BasicWnd* wnd, std::string name, std::function<void(Zeal::EqUI::BasicWnd*, int)> callback);
-	void AddLabel(Zeal::EqUI::BasicWnd* wnd, std::string name);
-	void AddListItems(Zeal::EqUI::ListWnd* wnd, const std::vector<std::vector<std::string>> data);
+	std::vector<ui_control> controls;
+	std::unordered_map<std::string, ui_handle> control_handles;
+
+	// every window created from a template, listed under each of its ancestors by interned name, sorted by atom
+	struct child_entry
+	{
+		UINT32 atom;
+		Zeal::EqUI::BasicWnd* wnd;
+	};
+	std::unordered_map<Zeal::EqUI::BasicWnd*, std::vector<child_entry>> WindowChildren;
+
+	UINT32 Intern(const std::string& name); //stable id for a control name, 0 is never handed out
+	UINT32 FindAtom(const std::string& name) const; //0 when the name was never interned
+	void AddChild(Zeal::EqUI::BasicWnd* parent, const char* name, Zeal::EqUI::BasicWnd* child);
+	Zeal::EqUI::BasicWnd* GetChild(Zeal::EqUI::BasicWnd* parent, UINT32 atom) const;
+	Zeal::EqUI::BasicWnd* GetChild(Zeal::EqUI::BasicWnd* parent, const std::string& name); //falls back to the client's search for windows created before the hook
+	ui_handle GetHandle(const std::string& name) const;
+	void SetLabelValue(ui_handle handle, const char* format, ...);
+	void SetSliderValue(ui_handle handle, int value);
+	void SetSliderValue(ui_handle handle, float value);
+	void SetComboValue(ui_handle handle, int value);
+	void SetChecked(ui_handle handle, bool checked);
+	void SetLabelValue(const std::string& name, const char* format, ...);
+	void SetSliderValue(const std::string& name, int value);
+	void SetSliderValue(const std::string& name, float value);
+	void SetComboValue(const std::string& name, int value);
+	void SetChecked(const std::string& name, bool checked);
+	ui_handle AddCheckboxCallback(Zeal::EqUI::BasicWnd* wnd, std::string name, std::function<void(Zeal::EqUI::BasicWnd*)> callback);
+	ui_handle AddSliderCallback(Zeal::EqUI::BasicWnd* wnd, std::string name, std::function<void(Zeal::EqUI::SliderWnd*, int)> callback);
+	ui_handle AddComboCallback(Zeal::EqUI::BasicWnd* wnd, std::string name, std::function<void(Zeal::EqUI::BasicWnd*, int)> callback);
+	ui_handle AddLabel(Zeal::EqUI::BasicWnd* wnd, std::string name);
+	void FlushUpdates();
+	void AddListItems(Zeal::EqUI::ListWnd* wnd, const std::vector<std::vector<std::string>>& data); //writes every cell, ui_list only writes the visible rows
 
 	ui_manager(class ZealService* zeal, class IO_ini* ini);
 
@@ -46,5 +82,10 @@ public:
 private:
 	void CleanUI();
 	void init_ui();
+	ui_handle AddControl(Zeal::EqUI::BasicWnd* wnd, const std::string& name, ui_control_type type);
+	void MarkDirty(ui_handle handle);
+	void SetLabelText(ui_handle handle, const char* text);
+	std::vector<ui_handle> dirty_controls;
+	std::unordered_map<std::string, UINT32> atoms;
 };
 
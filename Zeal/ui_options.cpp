@@ -22,60 +22,54 @@ int GetSensitivityForSlider(float* value)
 void ui_options::InitUI()
 {
 	/*add callbacks when the buttons are pressed in the options window*/
-	ui->AddCheckboxCallback(Zeal::EqGame::Windows->Options, "Zeal_HideCorpse", [](Zeal::EqUI::BasicWnd* wnd) { ZealService::get_instance()->looting_hook->set_hide_looted(wnd->Checked); });
-	ui->AddCheckboxCallback(Zeal::EqGame::Windows->Options, "Zeal_Cam", [](Zeal::EqUI::BasicWnd* wnd) { ZealService::get_instance()->camera_mods->set_smoothing(wnd->Checked); });
-	ui->AddCheckboxCallback(Zeal::EqGame::Windows->Options, "Zeal_BlueCon", [](Zeal::EqUI::BasicWnd* wnd) { ZealService::get_instance()->chat_hook->set_bluecon(wnd->Checked); });
+	handles.hide_corpse = ui->AddCheckboxCallback(Zeal::EqGame::Windows->Options, "Zeal_HideCorpse", [](Zeal::EqUI::BasicWnd* wnd) { ZealService::get_instance()->looting_hook->set_hide_looted(wnd->Checked); });
+	handles.cam = ui->AddCheckboxCallback(Zeal::EqGame::Windows->Options, "Zeal_Cam", [](Zeal::EqUI::BasicWnd* wnd) { ZealService::get_instance()->camera_mods->set_smoothing(wnd->Checked); });
+	handles.blue_con = ui->AddCheckboxCallback(Zeal::EqGame::Windows->Options, "Zeal_BlueCon", [](Zeal::EqUI::BasicWnd* wnd) { ZealService::get_instance()->chat_hook->set_bluecon(wnd->Checked); });
 	//ui->AddCheckboxCallback(Zeal::EqGame::Windows->Options, "Zeal_Timestamp", [](Zeal::EqUI::BasicWnd* wnd) { ZealService::get_instance()->chat_hook->set_timestamp(wnd->Checked); });
-	ui->AddCheckboxCallback(Zeal::EqGame::Windows->Options, "Zeal_Input", [](Zeal::EqUI::BasicWnd* wnd) { ZealService::get_instance()->chat_hook->set_input(wnd->Checked); });
-	ui->AddCheckboxCallback(Zeal::EqGame::Windows->Options, "Zeal_Escape", [](Zeal::EqUI::BasicWnd* wnd) { ZealService::get_instance()->ini->setValue<bool>("Zeal", "Escape", wnd->Checked); });
+	handles.input = ui->AddCheckboxCallback(Zeal::EqGame::Windows->Options, "Zeal_Input", [](Zeal::EqUI::BasicWnd* wnd) { ZealService::get_instance()->chat_hook->set_input(wnd->Checked); });
+	handles.escape = ui->AddCheckboxCallback(Zeal::EqGame::Windows->Options, "Zeal_Escape", [](Zeal::EqUI::BasicWnd* wnd) { ZealService::get_instance()->escape_keeps_windows.set(wnd->Checked); });
 	ui->AddCheckboxCallback(Zeal::EqGame::Windows->Options, "Zeal_ShowHelm", [](Zeal::EqUI::BasicWnd* wnd) { Zeal::EqGame::print_chat("Show helm toggle"); });
-	ui->AddCheckboxCallback(Zeal::EqGame::Windows->Options, "Zeal_AltContainerTooltips", [](Zeal::EqUI::BasicWnd* wnd) { ZealService::get_instance()->tooltips->set_alt_all_containers(wnd->Checked); });
-	ui->AddCheckboxCallback(Zeal::EqGame::Windows->Options, "Zeal_SpellbookAutoStand", [](Zeal::EqUI::BasicWnd* wnd) { ZealService::get_instance()->movement->set_spellbook_autostand(wnd->Checked); });
-	ui->AddCheckboxCallback(Zeal::EqGame::Windows->Options, "Zeal_FloatingDamage", [](Zeal::EqUI::BasicWnd* wnd) { ZealService::get_instance()->floating_damage->set_enabled(wnd->Checked); });
-	ui->AddCheckboxCallback(Zeal::EqGame::Windows->Options, "Zeal_UseOldSens", [](Zeal::EqUI::BasicWnd* wnd) {ZealService::get_instance()->camera_mods->set_old_sens(wnd->Checked); });
-	ui->AddComboCallback(Zeal::EqGame::Windows->Options, "Zeal_Timestamps_Combobox", [this](Zeal::EqUI::BasicWnd* wnd, int value) { ZealService::get_instance()->chat_hook->set_timestamp(value); });
-	ui->AddSliderCallback(Zeal::EqGame::Windows->Options, "Zeal_PanDelaySlider", [this](Zeal::EqUI::SliderWnd* wnd, int value) {
+	handles.alt_container_tooltips = ui->AddCheckboxCallback(Zeal::EqGame::Windows->Options, "Zeal_AltContainerTooltips", [](Zeal::EqUI::BasicWnd* wnd) { ZealService::get_instance()->tooltips->set_alt_all_containers(wnd->Checked); });
+	handles.spellbook_autostand = ui->AddCheckboxCallback(Zeal::EqGame::Windows->Options, "Zeal_SpellbookAutoStand", [](Zeal::EqUI::BasicWnd* wnd) { ZealService::get_instance()->movement->set_spellbook_autostand(wnd->Checked); });
+	handles.floating_damage = ui->AddCheckboxCallback(Zeal::EqGame::Windows->Options, "Zeal_FloatingDamage", [](Zeal::EqUI::BasicWnd* wnd) { ZealService::get_instance()->floating_damage->set_enabled(wnd->Checked); });
+	handles.use_old_sens = ui->AddCheckboxCallback(Zeal::EqGame::Windows->Options, "Zeal_UseOldSens", [](Zeal::EqUI::BasicWnd* wnd) {ZealService::get_instance()->camera_mods->set_old_sens(wnd->Checked); });
+	handles.timestamps_combo = ui->AddComboCallback(Zeal::EqGame::Windows->Options, "Zeal_Timestamps_Combobox", [this](Zeal::EqUI::BasicWnd* wnd, int value) { ZealService::get_instance()->chat_hook->set_timestamp(value); });
+	handles.pan_delay = ui->AddSliderCallback(Zeal::EqGame::Windows->Options, "Zeal_PanDelaySlider", [this](Zeal::EqUI::SliderWnd* wnd, int value) {
 		ZealService::get_instance()->camera_mods->set_pan_delay(value*4); 
-		ui->SetLabelValue("Zeal_PanDelayValueLabel", "%d ms", ZealService::get_instance()->camera_mods->pan_delay);
 	});
-	ui->AddSliderCallback(Zeal::EqGame::Windows->Options, "Zeal_FirstPersonSlider_X", [this](Zeal::EqUI::SliderWnd* wnd, int value) {
+	handles.first_person_x = ui->AddSliderCallback(Zeal::EqGame::Windows->Options, "Zeal_FirstPersonSlider_X", [this](Zeal::EqUI::SliderWnd* wnd, int value) {
 		ZealService::get_instance()->camera_mods->user_sensitivity_x = GetSensitivityFromSlider(value);
 		ZealService::get_instance()->camera_mods->update_sensitivity();
-		ui->SetLabelValue("Zeal_FirstPersonLabel_X", "%.2f", ZealService::get_instance()->camera_mods->user_sensitivity_x);
 	});
-	ui->AddSliderCallback(Zeal::EqGame::Windows->Options, "Zeal_FirstPersonSlider_Y", [this](Zeal::EqUI::SliderWnd* wnd, int value) {
+	handles.first_person_y = ui->AddSliderCallback(Zeal::EqGame::Windows->Options, "Zeal_FirstPersonSlider_Y", [this](Zeal::EqUI::SliderWnd* wnd, int value) {
 		ZealService::get_instance()->camera_mods->user_sensitivity_y = GetSensitivityFromSlider(value);
 		ZealService::get_instance()->camera_mods->update_sensitivity();
-		ui->SetLabelValue("Zeal_FirstPersonLabel_Y", "%.2f", ZealService::get_instance()->camera_mods->user_sensitivity_y);
 	});
-	ui->AddSliderCallback(Zeal::EqGame::Windows->Options, "Zeal_ThirdPersonSlider_X", [this](Zeal::EqUI::SliderWnd* wnd, int value) {
+	handles.third_person_x = ui->AddSliderCallback(Zeal::EqGame::Windows->Options, "Zeal_ThirdPersonSlider_X", [this](Zeal::EqUI::SliderWnd* wnd, int value) {
 		ZealService::get_instance()->camera_mods->user_sensitivity_x_3rd = GetSensitivityFromSlider(value);
 		ZealService::get_instance()->camera_mods->update_sensitivity();
-		ui->SetLabelValue("Zeal_ThirdPersonLabel_X", "%.2f", ZealService::get_instance()->camera_mods->user_sensitivity_x_3rd);
 	});
-	ui->AddSliderCallback(Zeal::EqGame::Windows->Options, "Zeal_ThirdPersonSlider_Y", [this](Zeal::EqUI::SliderWnd* wnd, int value) {
+	handles.third_person_y = ui->AddSliderCallback(Zeal::EqGame::Windows->Options, "Zeal_ThirdPersonSlider_Y", [this](Zeal::EqUI::SliderWnd* wnd, int value) {
 		ZealService::get_instance()->camera_mods->user_sensitivity_y_3rd = GetSensitivityFromSlider(value);
 		ZealService::get_instance()->camera_mods->update_sensitivity();
-		ui->SetLabelValue("Zeal_ThirdPersonLabel_Y", "%.2f", ZealService::get_instance()->camera_mods->user_sensitivity_y_3rd);
 	});
-	ui->AddSliderCallback(Zeal::EqGame::Windows->Options, "Zeal_FoVSlider", [this](Zeal::EqUI::SliderWnd* wnd, int value) {
+	handles.fov = ui->AddSliderCallback(Zeal::EqGame::Windows->Options, "Zeal_FoVSlider", [this](Zeal::EqUI::SliderWnd* wnd, int value) {
 		float val = 45.0f + (static_cast<float>(value) / 100.0f) * 45.0f;
 		ZealService::get_instance()->camera_mods->set_fov(val);
-		ui->SetLabelValue("Zeal_FoVValueLabel", "%.0f", val);
 	});
-	ui->AddSliderCallback(Zeal::EqGame::Windows->Options, "Zeal_HoverTimeout_Slider", [this](Zeal::EqUI::SliderWnd* wnd, int value) {
+	handles.hover_timeout = ui->AddSliderCallback(Zeal::EqGame::Windows->Options, "Zeal_HoverTimeout_Slider", [this](Zeal::EqUI::SliderWnd* wnd, int value) {
 		int val = value * 5;
 		ZealService::get_instance()->tooltips->set_timer(val);
-		ui->SetLabelValue("Zeal_HoverTimeout_Value", "%i ms", val);
+		ui->SetLabelValue(handles.hover_timeout_label, "%i ms", val);
 	});
 
-	ui->AddLabel(Zeal::EqGame::Windows->Options, "Zeal_PanDelayValueLabel");
-	ui->AddLabel(Zeal::EqGame::Windows->Options, "Zeal_FirstPersonLabel_X");
-	ui->AddLabel(Zeal::EqGame::Windows->Options, "Zeal_FirstPersonLabel_Y");
-	ui->AddLabel(Zeal::EqGame::Windows->Options, "Zeal_ThirdPersonLabel_X");
-	ui->AddLabel(Zeal::EqGame::Windows->Options, "Zeal_ThirdPersonLabel_Y");
-	ui->AddLabel(Zeal::EqGame::Windows->Options, "Zeal_FoVValueLabel");
-	ui->AddLabel(Zeal::EqGame::Windows->Options, "Zeal_HoverTimeout_Value");
+	handles.pan_delay_label = ui->AddLabel(Zeal::EqGame::Windows->Options, "Zeal_PanDelayValueLabel");
+	handles.first_person_label_x = ui->AddLabel(Zeal::EqGame::Windows->Options, "Zeal_FirstPersonLabel_X");
+	handles.first_person_label_y = ui->AddLabel(Zeal::EqGame::Windows->Options, "Zeal_FirstPersonLabel_Y");
+	handles.third_person_label_x = ui->AddLabel(Zeal::EqGame::Windows->Options, "Zeal_ThirdPersonLabel_X");
+	handles.third_person_label_y = ui->AddLabel(Zeal::EqGame::Windows->Options, "Zeal_ThirdPersonLabel_Y");
+	handles.fov_label = ui->AddLabel(Zeal::EqGame::Windows->Options, "Zeal_FoVValueLabel");
+	handles.hover_timeout_label = ui->AddLabel(Zeal::EqGame::Windows->Options, "Zeal_HoverTimeout_Value");
 	
 	/*set the current states*/
 	UpdateOptions();
@@ -88,38 +82,73 @@ void ui_options::CleanUI()
 }
 
 
-void ui_options::UpdateOptions()
+void ui_options::changed(option which)
 {
-	ui->SetComboValue("Zeal_Timestamps_Combobox", ZealService::get_instance()->chat_hook->timestamps);
-	ui->SetComboValue("Zeal_HideCorpseCombobox", 2);
-	ui->SetSliderValue("Zeal_PanDelaySlider", ZealService::get_instance()->camera_mods->pan_delay > 0.f ? ZealService::get_instance()->camera_mods->pan_delay / 4 : 0.f);
-	ui->SetSliderValue("Zeal_HoverTimeout_Slider", ZealService::get_instance()->tooltips->hover_timeout > 0 ? ZealService::get_instance()->tooltips->hover_timeout / 5 : 0);
-	ui->SetSliderValue("Zeal_ThirdPersonSlider_Y", GetSensitivityForSlider(&ZealService::get_instance()->camera_mods->user_sensitivity_y_3rd));
-	ui->SetSliderValue("Zeal_ThirdPersonSlider_X", GetSensitivityForSlider(&ZealService::get_instance()->camera_mods->user_sensitivity_x_3rd));
-	ui->SetSliderValue("Zeal_FirstPersonSlider_Y", GetSensitivityForSlider(&ZealService::get_instance()->camera_mods->user_sensitivity_y));
-	ui->SetSliderValue("Zeal_FirstPersonSlider_X", GetSensitivityForSlider(&ZealService::get_instance()->camera_mods->user_sensitivity_x));
-	ui->SetSliderValue("Zeal_FoVSlider", static_cast<int>((ZealService::get_instance()->camera_mods->fov - 45.0f) / 45.0f * 100.0f));
-	ui->SetLabelValue("Zeal_FoVValueLabel", "%.0f", ZealService::get_instance()->camera_mods->fov);
-	ui->SetLabelValue("Zeal_FirstPersonLabel_X", "%.2f", ZealService::get_instance()->camera_mods->user_sensitivity_x);
-	ui->SetLabelValue("Zeal_FirstPersonLabel_Y", "%.2f", ZealService::get_instance()->camera_mods->user_sensitivity_y);
-	ui->SetLabelValue("Zeal_ThirdPersonLabel_X", "%.2f", ZealService::get_instance()->camera_mods->user_sensitivity_x_3rd);
-	ui->SetLabelValue("Zeal_ThirdPersonLabel_Y", "%.2f", ZealService::get_instance()->camera_mods->user_sensitivity_y_3rd);
-	ui->SetLabelValue("Zeal_PanDelayValueLabel", "%d ms", ZealService::get_instance()->camera_mods->pan_delay);
-	ui->SetLabelValue("Zeal_HoverTimeout_Value", "%d ms", ZealService::get_instance()->tooltips->hover_timeout);
-	ui->SetChecked("Zeal_HideCorpse", ZealService::get_instance()->looting_hook->hide_looted);
-	ui->SetChecked("Zeal_Cam", ZealService::get_instance()->camera_mods->enabled);
-	ui->SetChecked("Zeal_BlueCon", ZealService::get_instance()->chat_hook->bluecon);
-	ui->SetChecked("Zeal_Timestamp", ZealService::get_instance()->chat_hook->timestamps);
-	ui->SetChecked("Zeal_Input", ZealService::get_instance()->chat_hook->zealinput);
-	ui->SetChecked("Zeal_Escape", ZealService::get_instance()->ini->getValue<bool>("Zeal", "Escape"));
-	ui->SetChecked("Zeal_AltContainerTooltips", ZealService::get_instance()->tooltips->all_containers);
-	ui->SetChecked("Zeal_SpellbookAutoStand", ZealService::get_instance()->movement->spellbook_autostand);
-	ui->SetChecked("Zeal_FloatingDamage", ZealService::get_instance()->floating_damage->enabled);
-	ui->SetChecked("Zeal_UseOldSens", ZealService::get_instance()->camera_mods->use_old_sens);
-
+	ZealService* zeal = ZealService::get_instance();
+	switch (which)
+	{
+	case option::hide_corpse:
+		ui->SetChecked(handles.hide_corpse, zeal->looting_hook->hide_looted);
+		break;
+	case option::cam:
+		ui->SetChecked(handles.cam, zeal->camera_mods->enabled);
+		break;
+	case option::blue_con:
+		ui->SetChecked(handles.blue_con, zeal->chat_hook->bluecon);
+		break;
+	case option::timestamps:
+		ui->SetComboValue(handles.timestamps_combo, zeal->chat_hook->timestamps);
+		break;
+	case option::input:
+		ui->SetChecked(handles.input, zeal->chat_hook->zealinput);
+		break;
+	case option::escape:
+		ui->SetChecked(handles.escape, zeal->escape_keeps_windows);
+		break;
+	case option::alt_container_tooltips:
+		ui->SetChecked(handles.alt_container_tooltips, zeal->tooltips->all_containers);
+		break;
+	case option::spellbook_autostand:
+		ui->SetChecked(handles.spellbook_autostand, zeal->movement->spellbook_autostand);
+		break;
+	case option::floating_damage:
+		ui->SetChecked(handles.floating_damage, zeal->floating_damage->enabled);
+		break;
+	case option::use_old_sens:
+		ui->SetChecked(handles.use_old_sens, zeal->camera_mods->use_old_sens);
+		break;
+	case option::pan_delay:
+		ui->SetSliderValue(handles.pan_delay, zeal->camera_mods->pan_delay > 0.f ? zeal->camera_mods->pan_delay / 4 : 0.f);
+		ui->SetLabelValue(handles.pan_delay_label, "%d ms", zeal->camera_mods->pan_delay);
+		break;
+	case option::sensitivity:
+		ui->SetSliderValue(handles.third_person_y, GetSensitivityForSlider(&zeal->camera_mods->user_sensitivity_y_3rd));
+		ui->SetSliderValue(handles.third_person_x, GetSensitivityForSlider(&zeal->camera_mods->user_sensitivity_x_3rd));
+		ui->SetSliderValue(handles.first_person_y, GetSensitivityForSlider(&zeal->camera_mods->user_sensitivity_y));
+		ui->SetSliderValue(handles.first_person_x, GetSensitivityForSlider(&zeal->camera_mods->user_sensitivity_x));
+		ui->SetLabelValue(handles.first_person_label_x, "%.2f", zeal->camera_mods->user_sensitivity_x);
+		ui->SetLabelValue(handles.first_person_label_y, "%.2f", zeal->camera_mods->user_sensitivity_y);
+		ui->SetLabelValue(handles.third_person_label_x, "%.2f", zeal->camera_mods->user_sensitivity_x_3rd);
+		ui->SetLabelValue(handles.third_person_label_y, "%.2f", zeal->camera_mods->user_sensitivity_y_3rd);
+		break;
+	case option::fov:
+		ui->SetSliderValue(handles.fov, static_cast<int>((zeal->camera_mods->fov - 45.0f) / 45.0f * 100.0f));
+		ui->SetLabelValue(handles.fov_label, "%.0f", zeal->camera_mods->fov);
+		break;
+	case option::hover_timeout:
+		ui->SetSliderValue(handles.hover_timeout, zeal->tooltips->hover_timeout > 0 ? zeal->tooltips->hover_timeout / 5 : 0);
+		ui->SetLabelValue(handles.hover_timeout_label, "%d ms", zeal->tooltips->hover_timeout);
+		break;
+	default:
+		break;
+	}
 }
 
-
+void ui_options::UpdateOptions()
+{
+	for (int i = 0; i < static_cast<int>(option::_count); i++)
+		changed(static_cast<option>(i));
+}
 
 ui_options::ui_options(ZealService* zeal, IO_ini* ini, ui_manager* mgr)
 {
@@ -6,7 +6,27 @@
 class ui_options
 {
 public:
-	void UpdateOptions();
+	// one entry per setting the options window shows, a setter names the one it changed so only its controls are written
+	enum class option
+	{
+		hide_corpse,
+		cam,
+		blue_con,
+		timestamps,
+		input,
+		escape,
+		alt_container_tooltips,
+		spellbook_autostand,
+		floating_damage,
+		use_old_sens,
+		pan_delay,
+		sensitivity,
+		fov,
+		hover_timeout,
+		_count
+	};
+	void changed(option which); //the values land on the controls at the next RenderUI
+	void UpdateOptions(); //every option, after InitUI or a reload of the ini
 	ui_options(class ZealService* zeal, class IO_ini* ini, class ui_manager* mgr);
 	~ui_options();
 private:
@@ -14,4 +34,13 @@ private:
 	void CleanUI();
 	void LoadSettings(class IO_ini* ini);
 	ui_manager* ui;
+	// resolved in InitUI, -1 until then
+	struct
+	{
+		int hide_corpse = -1, cam = -1, blue_con = -1, input = -1, escape = -1, alt_container_tooltips = -1, spellbook_autostand = -1,
+			floating_damage = -1, use_old_sens = -1, timestamps_combo = -1;
+		int pan_delay = -1, first_person_x = -1, first_person_y = -1, third_person_x = -1, third_person_y = -1, fov = -1, hover_timeout = -1;
+		int pan_delay_label = -1, first_person_label_x = -1, first_person_label_y = -1, third_person_label_x = -1, third_person_label_y = -1,
+			fov_label = -1, hover_timeout_label = -1;
+	} handles;
 };
@@ -1,6 +1,7 @@
 #pragma once
 #define _USE_MATH_DEFINES
 #include <math.h>
+#include <xmmintrin.h>
 #include <sstream>
 #include <iomanip>
 #include "json.hpp"
@@ -24,21 +25,23 @@ public:
 	inline Vec2 operator / (const Vec2& v) const { return Vec2(x / v.x, y / v.y); }
 	inline Vec2 operator * (const Vec2& v) const { return Vec2(x * v.x, y * v.y); }
 	inline bool operator == (const Vec2& v) const { return x == v.x && y == v.y; }
-	inline bool operator != (const Vec2& v) const { return x != v.x && y != v.y; }
+	inline bool operator != (const Vec2& v) const { return x != v.x || y != v.y; }
 	inline Vec2& operator += (const Vec2& v) { this->x += v.x; this->y += v.y; return *this; }
-	inline Vec2& operator -= (const Vec2& v) { this->x += v.x; this->y += v.y; return *this; }
+	inline Vec2& operator -= (const Vec2& v) { this->x -= v.x; this->y -= v.y; return *this; }
 	inline Vec2& operator *= (const Vec2& v) { this->x *= v.x, this->y *= v.y; return *this; }
-	inline Vec2& operator /= (const Vec2& v) { this->x += v.x; this->y += v.y; return *this; }
+	inline Vec2& operator /= (const Vec2& v) { this->x /= v.x; this->y /= v.y; return *this; }
 	inline float& operator [] (int index) { float f = FLT_MIN; if (index == 0) return x;  if (index == 1) return y; return f; }
 	const float& operator [] (int index) const { if (index == 0) return x;  if (index == 1) return y; return FLT_MIN; }
 	//ImVec2 toImVec2() const { return ImVec2(x, y); }
-	inline double Length() { return sqrt(pow(x,2) + pow(y,2)); }
+	inline double Length() const { return sqrtf(x * x + y * y); }
 	//static Vec2 toVec2(const ImVec2& v) { return Vec2(v.x, v.y); }
-	inline double Dist(const Vec2 v) { return (*this - v).Length(); }
+	inline double Dist(const Vec2 v) const { return (*this - v).Length(); }
+	inline float Dist2(const Vec2& v) const { float dx = x - v.x, dy = y - v.y; return dx * dx + dy * dy; } //squared, compare against a squared range instead of taking the root
 	float x, y;
 };
 
 
+// plain 12 byte layout, it is embedded in the game's own structures so it can't be padded or aligned
 struct Vec3
 {
 	float x, y, z;
@@ -61,17 +64,20 @@ struct Vec3
 	inline nlohmann::json toJson() { nlohmann::json data = { {"x", x}, {"y", y}, {"z", z} }; return data; }
 	inline std::string toString() { std::stringstream ss; ss << std::fixed << std::setprecision(6) << x << " " << y << " " << z; return ss.str(); }
 	inline double LengthSquared() const { return x * x + y * y + z * z;	}
-	inline double Length() { return sqrt(pow(x,2) + pow(y,2) + pow(z,2)); }
-	inline double Length2D() { return sqrt(pow(x,2) + pow(y,2)); }
-	inline double Length2DRounded() { return sqrt(pow(roundf(x), 2) + pow(roundf(y), 2)); }
-	inline double LengthZ() { return sqrt(pow(y,2)); }
+	inline double Length() const { return sqrtf(x * x + y * y + z * z); }
+	inline double Length2D() const { return sqrtf(x * x + y * y); }
+	inline double Length2DRounded() const { float rx = roundf(x), ry = roundf(y); return sqrtf(rx * rx + ry * ry); }
+	inline double LengthZ() const { return fabsf(y); }
 	inline Vec3 CrossProduct(const Vec3 v) const {	return Vec3(y * v.z - z * v.y, z * v.x - x * v.z, x * v.y - y * v.x); }
 	inline float DotProduct(const Vec3 v) { return (x * v.x + y * v.y + z * v.z); }
 	inline Vec3 Rounded() { return Vec3(roundf(this->x), roundf(this->y), roundf(this->z)); }
 	inline Vec3 Floored() { return Vec3(floorf(this->x), floorf(this->y), floorf(this->z)); }
 	inline Vec3 Ceiled() { return Vec3(ceilf(this->x), ceilf(this->y), ceilf(this->z)); }
-	inline double Dist(const Vec3 v) { return (*this - v).Length(); }
-	inline double Dist2D(const Vec3 v) { return (Vec2(x, y) - Vec2(v.x, v.y)).Length(); }
+	inline double Dist(const Vec3 v) const { return sqrtf(Dist2(v)); }
+	inline double Dist2D(const Vec3 v) const { return sqrtf(Dist2D2(v)); }
+	// squared distances in float, compare against a squared range instead of taking the root
+	inline float Dist2(const Vec3& v) const { float dx = x - v.x, dy = y - v.y, dz = z - v.z; return dx * dx + dy * dy + dz * dz; }
+	inline float Dist2D2(const Vec3& v) const { float dx = x - v.x, dy = y - v.y; return dx * dx + dy * dy; }
 	inline float* v3t() { float x[3]; x[0] = this->x; x[1] = this->y; x[2] = this->z;  return x; }
 	inline Vec3 normalize360() { return Vec3(fmodf(this->x + 360, 360),fmodf(this->y + 360, 360),fmodf(this->z + 360, 360)); }
 	inline Vec3 getFractional() { float whole; return { std::modf(x, &whole), std::modf(y, &whole),std::modf(z, &whole) }; }
@@ -81,29 +87,61 @@ struct Vec3
 };
 
 
-struct Vec4
+// 16 byte aligned so the arithmetic is a single sse op
+struct alignas(16) Vec4
 {
 	float x, y, z, w;
 	Vec4() { x = 0; y = 0; z = 0; w = 0; };
 	Vec4(vec4_t vec) { x = vec[0]; y = vec[1]; z = vec[2]; w = vec[3]; }
 	Vec4(float vec_x, float vec_y, float vec_z, float vec_w) { x = vec_x; y = vec_y; z = vec_z; w = vec_w; }
 	Vec4(const Vec4& v) { x = v.x; y = v.y; z = v.z; w = v.w; }
-	inline Vec4 operator + (const Vec4& v) { return Vec4(x + v.x, y + v.y, z + v.z, w+v.w); }
-	inline Vec4 operator - (const Vec4& v) { return Vec4(x - v.x, y - v.y, z - v.z, w - v.w); }
-	inline Vec4 operator / (const Vec4& v) { return Vec4(x / v.x, y / v.y, z / v.z, w / v.w); }
-	inline Vec4 operator * (const Vec4& v) { return Vec4(x * v.x, y * v.y, z * v.z, w * v.w); }
+	Vec4(__m128 v) { _mm_store_ps(&x, v); }
+	inline __m128 m128() const { return _mm_load_ps(&x); }
+	inline Vec4 operator + (const Vec4& v) const { return Vec4(_mm_add_ps(m128(), v.m128())); }
+	inline Vec4 operator - (const Vec4& v) const { return Vec4(_mm_sub_ps(m128(), v.m128())); }
+	inline Vec4 operator / (const Vec4& v) const { return Vec4(_mm_div_ps(m128(), v.m128())); }
+	inline Vec4 operator * (const Vec4& v) const { return Vec4(_mm_mul_ps(m128(), v.m128())); }
 	inline bool operator == (const Vec4& v) { return x == v.x && y == v.y && z == v.z && w == v.w;	}
 	inline bool operator != (const Vec4& v) { return x != v.x || y != v.y || z != v.z || w != v.w; }
 	inline float& operator [] (int index) { if (index == 0) return x;  if (index == 1) return y; if (index == 2) return z; if (index == 3) return w; return w; }
 	const float& operator [] (int index) const { if (index == 0) return x;  if (index == 1) return y; if (index == 2) return z; if (index == 3) return w; return FLT_MIN; }
-	inline Vec4& operator += (const Vec4& v) { this->x += v.x; this->y += v.y; this->z += v.z; this->w += v.w; return *this; }
-	inline Vec4& operator -= (const Vec4& v) { this->x -= v.x; this->y -= v.y; this->z -= v.z; this->w -= v.w; return *this; }
-	inline Vec4& operator *= (const Vec4& v) { this->x *= v.x; this->y *= v.y; this->z *= v.z; this->w *= v.w; return *this; }
-	inline Vec4& operator /= (const Vec4& v) { this->x /= v.x; this->y /= v.y; this->z /= v.z; this->w /= v.w; return *this; }
+	inline Vec4& operator += (const Vec4& v) { _mm_store_ps(&x, _mm_add_ps(m128(), v.m128())); return *this; }
+	inline Vec4& operator -= (const Vec4& v) { _mm_store_ps(&x, _mm_sub_ps(m128(), v.m128())); return *this; }
+	inline Vec4& operator *= (const Vec4& v) { _mm_store_ps(&x, _mm_mul_ps(m128(), v.m128())); return *this; }
+	inline Vec4& operator /= (const Vec4& v) { _mm_store_ps(&x, _mm_div_ps(m128(), v.m128())); return *this; }
+	inline float Dot(const Vec4& v) const
+	{
+		__m128 m = _mm_mul_ps(m128(), v.m128());
+		m = _mm_add_ps(m, _mm_movehl_ps(m, m));
+		m = _mm_add_ss(m, _mm_shuffle_ps(m, m, 1));
+		return _mm_cvtss_f32(m);
+	}
 	inline float* v4t() { float x[4]; x[0] = this->x; x[1] = this->y; x[2] = this->z; x[3] = this->w; return x; }
 	//inline ImVec4 toImVec4() { return { x, y, z, w }; }
 //	inline ImColor toImColor() { return { x, y, z, w }; }
 };
 
-
-
+// squared distance from point to each of count positions, four at a time: three unaligned loads cover four Vec3s,
+// the shuffles transpose them to x/y/z lanes. with_z false gives the 2d distance the game uses for most ranges
+inline void dist2_to_point(const Vec3* positions, size_t count, const Vec3& point, float* out, bool with_z = true)
+{
+	const __m128 px = _mm_set1_ps(point.x), py = _mm_set1_ps(point.y), pz = _mm_set1_ps(point.z);
+	const __m128 zscale = _mm_set1_ps(with_z ? 1.f : 0.f);
+	size_t i = 0;
+	for (; i + 4 <= count; i += 4)
+	{
+		const float* f = &positions[i].x;
+		__m128 a = _mm_loadu_ps(f); //x0 y0 z0 x1
+		__m128 b = _mm_loadu_ps(f + 4); //y1 z1 x2 y2
+		__m128 c = _mm_loadu_ps(f + 8); //z2 x3 y3 z3
+		__m128 x = _mm_shuffle_ps(a, _mm_shuffle_ps(b, c, _MM_SHUFFLE(1, 1, 2, 2)), _MM_SHUFFLE(2, 0, 3, 0));
+		__m128 y = _mm_shuffle_ps(_mm_shuffle_ps(a, b, _MM_SHUFFLE(0, 0, 1, 1)), _mm_shuffle_ps(b, c, _MM_SHUFFLE(2, 2, 3, 3)), _MM_SHUFFLE(2, 0, 2, 0));
+		__m128 z = _mm_shuffle_ps(_mm_shuffle_ps(a, b, _MM_SHUFFLE(1, 1, 2, 2)), _mm_shuffle_ps(c, c, _MM_SHUFFLE(3, 3, 0, 0)), _MM_SHUFFLE(2, 0, 2, 0));
+		x = _mm_sub_ps(x, px);
+		y = _mm_sub_ps(y, py);
+		z = _mm_mul_ps(_mm_sub_ps(z, pz), zscale);
+		_mm_storeu_ps(out + i, _mm_add_ps(_mm_add_ps(_mm_mul_ps(x, x), _mm_mul_ps(y, y)), _mm_mul_ps(z, z)));
+	}
+	for (; i < count; ++i)
+		out[i] = with_z ? positions[i].Dist2(point) : positions[i].Dist2D2(point);
+}
@@ -0,0 +1,55 @@
+#include "window_stack.h"
+#include "Zeal.h"
+
+void WindowStack::raise(Zeal::EqUI::EQWND* wnd)
+{
+	if (!wnd)
+		return;
+	auto it = positions.find(wnd);
+	if (it != positions.end())
+		order.splice(order.end(), order, it->second);
+	else
+		positions.emplace(wnd, order.insert(order.end(), wnd));
+}
+
+void WindowStack::lower(Zeal::EqUI::EQWND* wnd)
+{
+	auto it = positions.find(wnd);
+	if (it == positions.end())
+		return;
+	order.erase(it->second);
+	positions.erase(it);
+}
+
+Zeal::EqUI::EQWND* WindowStack::top()
+{
+	while (!order.empty() && !order.back()->IsVisible)
+		lower(order.back());
+	return order.empty() ? nullptr : order.back();
+}
+
+bool WindowStack::close_top()
+{
+	Zeal::EqUI::EQWND* wnd = top();
+	if (!wnd)
+		return false;
+	wnd->IsVisible = false;
+	lower(wnd);
+	return true;
+}
+
+void WindowStack::clear()
+{
+	order.clear();
+	positions.clear();
+}
+
+WindowStack::WindowStack(ZealService* zeal)
+{
+	zeal->callbacks->add_generic([this]() { clear(); }, callback_type::CleanUI); //the ui reload destroys the windows
+	zeal->callbacks->add_generic([this]() { clear(); }, callback_type::CharacterSelect);
+}
+
+WindowStack::~WindowStack()
+{
+}
@@ -0,0 +1,23 @@
+#pragma once
+#include <Windows.h>
+#include <list>
+#include <unordered_map>
+#include "EqUI.h"
+
+// zeal's closable windows in the order they were last brought forward, back is the top. windows raise themselves when
+// shown or activated and drop out when deactivated, so escape closes the topmost one without scanning anything. a
+// window the game hid behind our back is skipped (and forgotten) when it reaches the top
+class WindowStack
+{
+public:
+	void raise(Zeal::EqUI::EQWND* wnd); //adds it or moves it to the top
+	void lower(Zeal::EqUI::EQWND* wnd); //no longer open
+	bool close_top(); //hides the topmost open window, false when none is (escape falls through to the game)
+	Zeal::EqUI::EQWND* top();
+	void clear();
+	WindowStack(class ZealService* zeal);
+	~WindowStack();
+private:
+	std::list<Zeal::EqUI::EQWND*> order;
+	std::unordered_map<Zeal::EqUI::EQWND*, std::list<Zeal::EqUI::EQWND*>::iterator> positions;
+};
@@ -0,0 +1,70 @@
+#include "worker_pool.h"
+
+WorkerPool::WorkerPool(size_t thread_count)
+{
+	for (size_t i = 0; i < thread_count; ++i)
+		threads.push_back(std::thread([this, i]() { worker_main(i); }));
+}
+
+WorkerPool::~WorkerPool()
+{
+	{
+		std::lock_guard<std::mutex> guard(lock);
+		end_threads = true;
+	}
+	wake.notify_all();
+	for (std::thread& thread : threads)
+		if (thread.joinable())
+			thread.join();
+}
+
+void WorkerPool::worker_main(size_t index)
+{
+	UINT seen = 0;
+	while (true)
+	{
+		std::function<void(size_t, size_t)> job;
+		size_t count = 0;
+		{
+			std::unique_lock<std::mutex> guard(lock);
+			wake.wait(guard, [this, seen]() { return end_threads || generation != seen; });
+			if (end_threads)
+				return;
+			seen = generation;
+			job = current_job;
+			count = job_count;
+		}
+		size_t begin = count * index / threads.size();
+		size_t end = count * (index + 1) / threads.size();
+		if (begin < end)
+			job(begin, end);
+		std::lock_guard<std::mutex> guard(lock);
+		if (--pending == 0)
+			done.notify_all();
+	}
+}
+
+void WorkerPool::dispatch(size_t count, std::function<void(size_t begin, size_t end)> job)
+{
+	wait();
+	if (!threads.size())
+	{
+		if (count)
+			job(0, count);
+		return;
+	}
+	{
+		std::lock_guard<std::mutex> guard(lock);
+		current_job = job;
+		job_count = count;
+		pending = threads.size();
+		generation++;
+	}
+	wake.notify_all();
+}
+
+void WorkerPool::wait()
+{
+	std::unique_lock<std::mutex> guard(lock);
+	done.wait(guard, [this]() { return pending == 0; });
+}
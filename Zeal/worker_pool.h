@@ -0,0 +1,31 @@
+#pragma once
+#include <Windows.h>
+#include <atomic>
+#include <condition_variable>
+#include <functional>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+// a few threads splitting an index range between them, dispatch() returns at once and wait() blocks until every chunk is done
+// one job at a time, dispatch() waits out the previous one
+class WorkerPool
+{
+public:
+	WorkerPool(size_t thread_count);
+	~WorkerPool();
+	void dispatch(size_t count, std::function<void(size_t begin, size_t end)> job);
+	void wait();
+	size_t size() const { return threads.size(); }
+private:
+	void worker_main(size_t index);
+	std::vector<std::thread> threads;
+	std::mutex lock;
+	std::condition_variable wake;
+	std::condition_variable done;
+	std::function<void(size_t, size_t)> current_job;
+	size_t job_count = 0;
+	UINT generation = 0;
+	size_t pending = 0; //workers still on the current job
+	bool end_threads = false;
+};
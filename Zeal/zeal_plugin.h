@@ -0,0 +1,116 @@
+#pragma once
+#include <stddef.h>
+#include <stdint.h>
+
+// the c interface a third party dll in zeal_plugins\ builds against. it only needs this header, zeal hands it plain
+// function pointers and calls it back through plain function pointers with the plugin's own context, so any compiler
+// works. the plugin rides on zeal's hooks instead of detouring the same game functions again.
+//   extern "C" __declspec(dllexport) int ZEAL_CALL zeal_plugin_load(const zeal_api* api, zeal_plugin_info* info)
+//   extern "C" __declspec(dllexport) void ZEAL_CALL zeal_plugin_unload(void) //optional
+// zeal_plugin_load runs once at startup on zeal's init thread: fill info, register callbacks, don't touch the game yet.
+// a non zero return refuses the load. every callback and every api call other than log runs on the game thread.
+// the abi only grows: new api entries go at the end and api->size tells a plugin which ones it has
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#define ZEAL_PLUGIN_ABI 1
+#define ZEAL_CALL __cdecl //spelled out so a plugin built with another default convention still matches
+
+// stable values, independent of zeal's own callback order
+enum zeal_event
+{
+	ZEAL_EVENT_MAIN_LOOP = 0,
+	ZEAL_EVENT_ZONE = 1,
+	ZEAL_EVENT_CLEAN_UI = 2,
+	ZEAL_EVENT_RENDER = 3,
+	ZEAL_EVENT_CHARACTER_SELECT = 4,
+	ZEAL_EVENT_INIT_UI = 5,
+	ZEAL_EVENT_END_MAIN_LOOP = 6,
+	ZEAL_EVENT_RENDER_UI = 7,
+	ZEAL_EVENT_END_SCENE = 8,
+	ZEAL_EVENT_DEVICE_RESET = 9,
+	ZEAL_EVENT_COUNT
+};
+
+enum zeal_packet_direction
+{
+	ZEAL_PACKET_RECEIVED = 0, //from the world server, before the client handles it
+	ZEAL_PACKET_SENT = 1
+};
+
+// copies, a plugin never holds a pointer into the game's memory
+typedef struct zeal_entity
+{
+	uint16_t spawn_id;
+	uint16_t owner_id; //pets, 0 otherwise
+	uint8_t type; //0 player, 1 npc, 2 and 3 corpses
+	uint8_t class_id;
+	uint8_t level;
+	uint8_t reserved;
+	uint16_t race;
+	uint32_t hp_current;
+	uint32_t hp_max;
+	float x, y, z;
+	float heading;
+	char name[32];
+} zeal_entity;
+
+typedef struct zeal_spell
+{
+	uint32_t id;
+	uint32_t cast_ms;
+	uint32_t recast_ms;
+	uint32_t mana;
+	float range;
+	uint8_t target_type;
+	uint8_t resist;
+	uint8_t beneficial;
+	uint8_t reserved;
+	uint8_t level[16]; //by class id - 1, 255 when the class can't use it
+	char name[64];
+} zeal_spell;
+
+typedef void (ZEAL_CALL *zeal_event_fn)(void* context);
+typedef int (ZEAL_CALL *zeal_packet_fn)(void* context, uint32_t opcode, const char* data, uint32_t length); //non zero drops the packet
+typedef int (ZEAL_CALL *zeal_key_fn)(void* context, uint32_t command, int down); //non zero keeps the game from seeing it
+typedef int (ZEAL_CALL *zeal_command_fn)(void* context, int argc, const char** argv); //argv[0] is the command, non zero when handled
+
+typedef struct zeal_api
+{
+	uint32_t size; //sizeof(zeal_api) of the zeal that loaded the plugin
+	uint32_t abi;
+	const char* zeal_version;
+	// registration, returns a handle or 0 when the arguments are invalid
+	uint32_t (ZEAL_CALL *add_event)(enum zeal_event event, zeal_event_fn fn, void* context);
+	void (ZEAL_CALL *set_event_active)(uint32_t handle, int active); //an inactive callback costs nothing per frame
+	uint32_t (ZEAL_CALL *add_packet)(enum zeal_packet_direction direction, zeal_packet_fn fn, void* context);
+	uint32_t (ZEAL_CALL *add_key)(zeal_key_fn fn, void* context);
+	uint32_t (ZEAL_CALL *add_command)(const char* name, const char* help, zeal_command_fn fn, void* context); //"/name"
+	// read only access to zeal's caches, non zero when found
+	int (ZEAL_CALL *get_entity)(uint16_t spawn_id, zeal_entity* out);
+	uint16_t (ZEAL_CALL *self_id)(void); //0 outside the game
+	uint16_t (ZEAL_CALL *target_id)(void);
+	size_t (ZEAL_CALL *query_radius)(float x, float y, float z, float radius, uint16_t* spawn_ids, size_t capacity); //full count, ids up to capacity
+	int (ZEAL_CALL *get_spell)(int spell_id, zeal_spell* out);
+	int (ZEAL_CALL *find_spell)(const char* name); //case insensitive, -1 when unknown
+	size_t (ZEAL_CALL *get_label)(int label_type, char* text, size_t capacity); //zeal's cached label text, 0 when it has none
+	// output
+	void (ZEAL_CALL *print_chat)(int color, const char* text);
+	void (ZEAL_CALL *log)(int level, const char* text); //any thread, 0 debug 1 info 2 warn 3 error, to Logs\zeal_debug.txt
+} zeal_api;
+
+typedef struct zeal_plugin_info
+{
+	uint32_t size; //set by zeal
+	uint32_t abi; //the plugin's ZEAL_PLUGIN_ABI, a newer one than zeal knows is refused
+	char name[32];
+	char version[16];
+} zeal_plugin_info;
+
+typedef int (ZEAL_CALL *zeal_plugin_load_fn)(const zeal_api* api, zeal_plugin_info* info);
+typedef void (ZEAL_CALL *zeal_plugin_unload_fn)(void);
+
+#ifdef __cplusplus
+}
+#endif
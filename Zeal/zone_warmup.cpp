@@ -0,0 +1,615 @@
+#include "zone_warmup.h"
+#include "Zeal.h"
+#include "EqFunctions.h"
+#include "string_util.h"
+#include <algorithm>
+#include <fstream>
+#include <sstream>
+
+static constexpr const char* history_file = "cache\\zones.txt";
+static constexpr const char* skin_file = "cache\\skin.txt";
+static constexpr ULONGLONG record_ms = 5000; //zone in to the end of recording, models and sounds trickle in after the zone in
+static constexpr float quiet_ms = 25.f; //a post_zone job runs on a frame shorter than this
+static constexpr int max_wait_frames = 60; //or after this many busy frames regardless
+static constexpr size_t prefetch_zones = 3; //most likely next zones to read ahead
+
+static constexpr LONGLONG max_mapped_file = 128 << 20; //the client is 32 bit, views this large or larger stay plain reads
+static constexpr LONGLONG max_mapped_total = 384 << 20;
+
+// PrefetchVirtualMemory is windows 8 and later, looked up rather than linked
+struct prefetch_range
+{
+	PVOID address;
+	SIZE_T bytes;
+};
+typedef BOOL(WINAPI* prefetch_virtual_memory)(HANDLE process, ULONG_PTR count, prefetch_range* ranges, ULONG flags);
+
+HANDLE WINAPI Local_CreateFileA(LPCSTR name, DWORD access, DWORD share, LPSECURITY_ATTRIBUTES security, DWORD disposition, DWORD flags, HANDLE template_file)
+{
+	HANDLE file = hook_ref<Local_CreateFileA>::original()(name, access, share, security, disposition, flags, template_file);
+	ZealService* zeal = ZealService::get_instance();
+	if (name && file != INVALID_HANDLE_VALUE && !(access & GENERIC_WRITE) && zeal->zone_warmup && zeal->zone_warmup->watching())
+		zeal->zone_warmup->opened(name, file, flags);
+	return file;
+}
+
+BOOL WINAPI Local_ReadFile(HANDLE file, LPVOID buffer, DWORD bytes, LPDWORD read, LPOVERLAPPED overlapped)
+{
+	ZealService* zeal = ZealService::get_instance();
+	if (!overlapped && zeal->zone_warmup && zeal->zone_warmup->mapping() && zeal->zone_warmup->read_mapped(file, buffer, bytes, read))
+		return TRUE;
+	return hook_ref<Local_ReadFile>::original()(file, buffer, bytes, read, overlapped);
+}
+
+BOOL WINAPI Local_CloseHandle(HANDLE handle)
+{
+	ZealService* zeal = ZealService::get_instance();
+	if (zeal->zone_warmup && zeal->zone_warmup->mapping())
+		zeal->zone_warmup->closing(handle);
+	return hook_ref<Local_CloseHandle>::original()(handle);
+}
+
+static bool zone_asset(const char* name, std::string& file)
+{
+	// zone assets are opened relative to the game folder
+	file = name;
+	if (file.size() < 5 || file.find(':') != std::string::npos || file[0] == '\\' || file[0] == '/')
+		return false;
+	std::transform(file.begin(), file.end(), file.begin(), [](unsigned char c) { return static_cast<char>(tolower(c)); });
+	static const char* extensions[] = { ".s3d", ".eqg", ".wld", ".emt", ".zon", ".ter", ".mod" };
+	for (const char* ext : extensions)
+		if (file.size() > strlen(ext) && file.compare(file.size() - strlen(ext), std::string::npos, ext) == 0)
+			return true;
+	return false;
+}
+
+static bool copy_view(void* dest, const void* src, DWORD bytes)
+{
+	// a mapped read that fails on disk raises instead of returning an error
+	__try
+	{
+		memcpy(dest, src, bytes);
+		return true;
+	}
+	__except (GetExceptionCode() == EXCEPTION_IN_PAGE_ERROR ? EXCEPTION_EXECUTE_HANDLER : EXCEPTION_CONTINUE_SEARCH)
+	{
+		return false;
+	}
+}
+
+static bool skin_asset(const char* name, std::string& file)
+{
+	file = name;
+	std::transform(file.begin(), file.end(), file.begin(), [](unsigned char c) { return static_cast<char>(tolower(c)); });
+	std::replace(file.begin(), file.end(), '/', '\\');
+	return file.find(':') == std::string::npos && file.rfind("uifiles\\", 0) == 0;
+}
+
+static ULONGLONG write_time(const std::string& file)
+{
+	WIN32_FILE_ATTRIBUTE_DATA data;
+	if (!GetFileAttributesExA(file.c_str(), GetFileExInfoStandard, &data))
+		return 0;
+	return (static_cast<ULONGLONG>(data.ftLastWriteTime.dwHighDateTime) << 32) | data.ftLastWriteTime.dwLowDateTime;
+}
+
+// sequential reads pull the files into the os cache, the wide api keeps them out of the recording
+void ZoneWarmup::read_ahead(const std::vector<std::string>& list)
+{
+	std::vector<char> buffer(1 << 20);
+	for (const std::string& file : list)
+	{
+		wchar_t wide[MAX_PATH];
+		if (!MultiByteToWideChar(CP_ACP, 0, file.c_str(), -1, wide, MAX_PATH))
+			continue;
+		HANDLE handle = CreateFileW(wide, GENERIC_READ, FILE_SHARE_READ, NULL, OPEN_EXISTING, FILE_FLAG_SEQUENTIAL_SCAN, NULL);
+		if (handle == INVALID_HANDLE_VALUE)
+			continue;
+		DWORD read = 0;
+		while (ReadFile(handle, buffer.data(), static_cast<DWORD>(buffer.size()), &read, NULL) && read)
+			;
+		CloseHandle(handle);
+	}
+}
+
+void ZoneWarmup::record(const std::string& file)
+{
+	std::lock_guard<std::mutex> lock(recorded_lock);
+	if (std::find(recorded.begin(), recorded.end(), file) == recorded.end())
+		recorded.push_back(file);
+}
+
+void ZoneWarmup::opened(const char* name, HANDLE file, DWORD flags)
+{
+	std::string asset;
+	if (skin_loading && skin_asset(name, asset))
+	{
+		std::lock_guard<std::mutex> lock(recorded_lock);
+		if (std::find(skin_recorded.begin(), skin_recorded.end(), asset) == skin_recorded.end())
+			skin_recorded.push_back(asset);
+		return;
+	}
+	if (!zone_asset(name, asset))
+		return;
+	if (map_archives.get() && !(flags & FILE_FLAG_OVERLAPPED) && map_file(asset, file))
+		return; //recorded on its first read instead, which is the order the load actually wants it in
+	if (loading)
+		record(asset);
+}
+
+bool ZoneWarmup::map_file(const std::string& name, HANDLE file)
+{
+	LARGE_INTEGER size;
+	if (!GetFileSizeEx(file, &size) || size.QuadPart <= 0 || size.QuadPart > max_mapped_file)
+		return false;
+	{
+		std::lock_guard<std::mutex> lock(mapped_lock);
+		if (mapped_bytes + size.QuadPart > max_mapped_total)
+			return false;
+	}
+	// the handles are created and closed outside the lock, closing them goes back through Local_CloseHandle
+	HANDLE mapping = CreateFileMappingA(file, NULL, PAGE_READONLY, 0, 0, NULL);
+	if (!mapping)
+		return false;
+	const BYTE* view = static_cast<const BYTE*>(MapViewOfFile(mapping, FILE_MAP_READ, 0, 0, 0));
+	if (!view)
+	{
+		CloseHandle(mapping);
+		return false;
+	}
+	// the whole archive in one sequential pass ahead of the reads rather than a page fault per small read
+	static prefetch_virtual_memory prefetch_memory = reinterpret_cast<prefetch_virtual_memory>(GetProcAddress(GetModuleHandleA("kernel32.dll"), "PrefetchVirtualMemory"));
+	if (prefetch_memory)
+	{
+		prefetch_range range = { const_cast<BYTE*>(view), static_cast<SIZE_T>(size.QuadPart) };
+		prefetch_memory(GetCurrentProcess(), 1, &range, 0);
+	}
+	auto shared = std::make_shared<mapped_view>();
+	shared->mapping = mapping;
+	shared->view = view;
+	shared->size = size.QuadPart;
+	std::lock_guard<std::mutex> lock(mapped_lock);
+	mapped_file& entry = mapped[file];
+	if (entry.view) //a value reused without the close being seen, kept alive by shared so it unmaps after the lock
+		mapped_bytes -= entry.view->size;
+	entry.view.swap(shared);
+	entry.name = name;
+	entry.read = false;
+	mapped_bytes += size.QuadPart;
+	mapped_count = static_cast<LONG>(mapped.size());
+	return true;
+}
+
+bool ZoneWarmup::read_mapped(HANDLE file, LPVOID buffer, DWORD bytes, LPDWORD read)
+{
+	std::shared_ptr<mapped_view> shared;
+	std::string first_read;
+	{
+		std::lock_guard<std::mutex> lock(mapped_lock);
+		auto it = mapped.find(file);
+		if (it == mapped.end())
+			return false;
+		shared = it->second.view;
+		if (!it->second.read)
+		{
+			it->second.read = true;
+			first_read = it->second.name;
+		}
+	}
+	if (!first_read.empty() && loading)
+		record(first_read);
+	const BYTE* view = shared->view;
+	LONGLONG size = shared->size;
+	// the file pointer stays the kernel's, so seeks through any api keep working without hooking them all
+	LARGE_INTEGER position, zero = {};
+	if (!SetFilePointerEx(file, zero, &position, FILE_CURRENT))
+		return false;
+	LONGLONG left = position.QuadPart < size ? size - position.QuadPart : 0;
+	DWORD count = left < bytes ? static_cast<DWORD>(left) : bytes;
+	if (count && !copy_view(buffer, view + position.QuadPart, count))
+		return false; //the real read reports the error
+	LARGE_INTEGER advance;
+	advance.QuadPart = count;
+	SetFilePointerEx(file, advance, NULL, FILE_CURRENT);
+	if (read)
+		*read = count;
+	return true;
+}
+
+void ZoneWarmup::closing(HANDLE file)
+{
+	std::shared_ptr<mapped_view> released;
+	{
+		std::lock_guard<std::mutex> lock(mapped_lock);
+		auto it = mapped.find(file);
+		if (it == mapped.end())
+			return;
+		released = std::move(it->second.view);
+		mapped_bytes -= released->size;
+		mapped.erase(it);
+		mapped_count = static_cast<LONG>(mapped.size());
+	}
+}
+
+// reads of the dropped handles go to the kernel from here, and a later close of one finds nothing to match
+void ZoneWarmup::release_mappings()
+{
+	std::map<HANDLE, mapped_file> released;
+	{
+		std::lock_guard<std::mutex> lock(mapped_lock);
+		released.swap(mapped);
+		mapped_bytes = 0;
+		mapped_count = 0;
+	}
+}
+
+// installed once from the constructor, inside zeal's startup batch with the other threads suspended, and left in place
+// until the unload: the settings only gate what the detours do. the handle map is only emptied while they are installed,
+// so it never holds an entry for a handle value whose close the detours didn't see
+void ZoneWarmup::install_hooks()
+{
+	ZealService* zeal = ZealService::get_instance();
+	HMODULE kernel = GetModuleHandleA("kernel32.dll");
+	if (!kernel)
+		return;
+	FARPROC create_file = GetProcAddress(kernel, "CreateFileA");
+	FARPROC read_file = GetProcAddress(kernel, "ReadFile");
+	FARPROC close_handle = GetProcAddress(kernel, "CloseHandle");
+	if (create_file)
+		zeal->hooks->Add<Local_CreateFileA>("CreateFileA", (int)create_file, hook_type_detour);
+	if (read_file && close_handle)
+	{
+		zeal->hooks->Add<Local_ReadFile>("ReadFile", (int)read_file, hook_type_detour);
+		zeal->hooks->Add<Local_CloseHandle>("CloseHandle", (int)close_handle, hook_type_detour);
+	}
+}
+
+void ZoneWarmup::post_zone(std::function<void()> job)
+{
+	if (!zoning && pending.empty())
+		job();
+	else
+		pending.push_back(std::move(job));
+}
+
+void ZoneWarmup::prefetch(DWORD from_zone)
+{
+	auto from = zones.find(from_zone);
+	if (from == zones.end() || from->second.next.empty())
+		return;
+	std::vector<std::pair<UINT, DWORD>> ranked;
+	for (auto& next : from->second.next)
+		ranked.push_back({ next.second, next.first });
+	std::sort(ranked.begin(), ranked.end(), [](const auto& a, const auto& b) { return a.first > b.first; });
+	std::set<std::string> files;
+	std::vector<std::string> list;
+	UINT spawns = 0;
+	for (size_t i = 0; i < ranked.size() && i < prefetch_zones; i++)
+	{
+		auto zone = zones.find(ranked[i].second);
+		if (zone == zones.end())
+			continue;
+		for (const std::string& file : zone->second.order)
+			if (files.insert(file).second)
+				list.push_back(file);
+		spawns = zone->second.spawns > spawns ? zone->second.spawns : spawns;
+	}
+	ZealService* zeal = ZealService::get_instance();
+	if (spawns)
+		zeal->entity_manager->reserve(spawns); //sized once here instead of growing through the zone in
+	if (list.empty() || !zeal->tasks)
+		return;
+	zeal->tasks->post([list]() { read_ahead(list); });
+}
+
+void ZoneWarmup::begin_transition()
+{
+	if (!loaded)
+		load();
+	{
+		std::lock_guard<std::mutex> lock(recorded_lock);
+		recorded.clear();
+	}
+	loading = true;
+	zoning = true;
+	zoned_in_at = 0;
+	if (last_zone != 0xFFFFFFFF)
+		prefetch(last_zone);
+}
+
+void ZoneWarmup::zoned_in()
+{
+	Zeal::EqStructures::Entity* self = Zeal::EqGame::get_self();
+	if (!self)
+		return;
+	DWORD zone = self->ZoneId;
+	if (last_zone != 0xFFFFFFFF && last_zone != zone)
+		zones[last_zone].next[zone]++;
+	last_zone = zone;
+	zoned_in_at = GetTickCount64();
+	zoning = false;
+}
+
+void ZoneWarmup::finish_recording()
+{
+	loading = false;
+	zoned_in_at = 0;
+	if (last_zone == 0xFFFFFFFF)
+		return;
+	zone_history& zone = zones[last_zone];
+	{
+		std::lock_guard<std::mutex> lock(recorded_lock);
+		for (const std::string& file : recorded)
+			if (zone.files.insert(file).second)
+				zone.order.push_back(file);
+		recorded.clear();
+	}
+	save();
+}
+
+void ZoneWarmup::load()
+{
+	loaded = true;
+	std::ifstream in(history_file);
+	std::string line;
+	while (std::getline(in, line))
+	{
+		std::istringstream fields(line);
+		std::string kind;
+		DWORD zone = 0;
+		fields >> kind >> zone;
+		if (kind == "zone")
+			fields >> zones[zone].spawns;
+		else if (kind == "file")
+		{
+			std::string name;
+			fields >> name;
+			if (!name.empty() && zones[zone].files.insert(name).second)
+				zones[zone].order.push_back(name);
+		}
+		else if (kind == "next")
+		{
+			DWORD to = 0;
+			UINT count = 0;
+			fields >> to >> count;
+			zones[zone].next[to] = count;
+		}
+	}
+}
+
+void ZoneWarmup::save()
+{
+	std::ostringstream out;
+	for (auto& zone : zones)
+	{
+		out << "zone " << zone.first << " " << zone.second.spawns << "\n";
+		for (auto& file : zone.second.order)
+			out << "file " << zone.first << " " << file << "\n";
+		for (auto& next : zone.second.next)
+			out << "next " << zone.first << " " << next.first << " " << next.second << "\n";
+	}
+	std::string text = out.str();
+	auto write = [text]() {
+		CreateDirectoryA("cache", NULL);
+		std::ofstream file(history_file, std::ios::trunc);
+		file << text;
+	};
+	ZealService* zeal = ZealService::get_instance();
+	if (zeal->tasks)
+		zeal->tasks->post(write);
+	else
+		write();
+}
+
+void ZoneWarmup::load_skin_files()
+{
+	skin_files_loaded = true;
+	std::ifstream in(skin_file);
+	std::string line;
+	while (std::getline(in, line))
+	{
+		std::istringstream fields(line);
+		ULONGLONG time = 0;
+		std::string name;
+		fields >> time >> name;
+		if (!name.empty())
+			skin_files[name] = time;
+	}
+}
+
+void ZoneWarmup::save_skin_files()
+{
+	std::ostringstream out;
+	for (auto& [name, time] : skin_files)
+		out << time << " " << name << "\n";
+	std::string text = out.str();
+	ZealService::get_instance()->tasks->post([text]() {
+		CreateDirectoryA("cache", NULL);
+		std::ofstream file(skin_file, std::ios::trunc);
+		file << text;
+	});
+}
+
+// recording starts with the load, the previous load's files are read ahead while the client cleans up the old ui
+void ZoneWarmup::begin_skin_load(bool timed)
+{
+	if (!skin_files_loaded)
+		load_skin_files();
+	{
+		std::lock_guard<std::mutex> lock(recorded_lock);
+		skin_recorded.clear();
+	}
+	skin_loading = true;
+	skin_load_start = 0;
+	if (timed)
+	{
+		LARGE_INTEGER now;
+		QueryPerformanceCounter(&now);
+		skin_load_start = now.QuadPart;
+	}
+}
+
+void ZoneWarmup::reload_skin()
+{
+	auto start_reload = []() {
+		mem::write<BYTE>(0x8092d9, 1); //reload skin
+		mem::write<BYTE>(0x8092da, 1); //reload with ui
+	};
+	if (!skin_prefetch.get())
+	{
+		start_reload();
+		return;
+	}
+	begin_skin_load(true);
+	std::vector<std::string> list;
+	for (auto& [name, time] : skin_files)
+		list.push_back(name);
+	if (!list.empty())
+		ZealService::get_instance()->tasks->post([list]() { read_ahead(list); }); //races the parser, never holds it
+	start_reload();
+}
+
+// InitUI, the last window of the load is created
+void ZoneWarmup::skin_loaded()
+{
+	if (!skin_loading)
+		return;
+	skin_loading = false;
+	std::vector<std::string> files;
+	{
+		std::lock_guard<std::mutex> lock(recorded_lock);
+		files.swap(skin_recorded);
+	}
+	if (files.empty())
+		return;
+	std::vector<std::string> changed;
+	std::map<std::string, ULONGLONG> current;
+	for (const std::string& file : files)
+	{
+		ULONGLONG time = write_time(file);
+		auto known = skin_files.find(file);
+		if (known != skin_files.end() && known->second != time)
+			changed.push_back(file);
+		current[file] = time;
+	}
+	bool first = skin_files.empty();
+	skin_files.swap(current);
+	save_skin_files();
+	if (!skin_load_start)
+		return;
+	LARGE_INTEGER now;
+	QueryPerformanceCounter(&now);
+	double ms = (now.QuadPart - skin_load_start) * ms_per_tick;
+	skin_load_start = 0;
+	if (first)
+		Zeal::EqGame::print_chat("Skin loaded in %.0f ms from %u files, the next reload reads them ahead", ms, (UINT)files.size());
+	else
+		Zeal::EqGame::print_chat("Skin loaded in %.0f ms from %u files, %u changed since the last load", ms, (UINT)files.size(), (UINT)changed.size());
+	for (size_t i = 0; i < changed.size() && i < 5; ++i)
+		Zeal::EqGame::print_chat("  changed: %s", changed[i].c_str());
+}
+
+void ZoneWarmup::main_loop()
+{
+	LARGE_INTEGER now;
+	QueryPerformanceCounter(&now);
+	float frame_ms = last_frame ? static_cast<float>((now.QuadPart - last_frame) * ms_per_tick) : 0.f;
+	last_frame = now.QuadPart;
+	int state = Zeal::EqGame::get_gamestate();
+	bool now_in_game = state == GAMESTATE_INGAME;
+	if (enabled.get())
+	{
+		// leaving the world for anything but character select or an unload is a zone transition
+		if (in_game && !now_in_game && state != GAMESTATE_CHARSELECT && state != GAMESTATE_UNLOADING)
+			begin_transition();
+		if (now_in_game)
+		{
+			Zeal::EqStructures::Entity* self = Zeal::EqGame::get_self();
+			size_t spawns = ZealService::get_instance()->entity_manager->spawn_count();
+			if (self && self->ZoneId == last_zone && spawns > zones[last_zone].spawns)
+				zones[last_zone].spawns = static_cast<UINT>(spawns);
+		}
+		if (loading && zoned_in_at && GetTickCount64() - zoned_in_at > record_ms)
+			finish_recording();
+	}
+	in_game = now_in_game;
+	if (skin_prefetch.get() && last_state == GAMESTATE_CHARSELECT && state != GAMESTATE_CHARSELECT && state != GAMESTATE_UNLOADING)
+	{
+		// entering the world loads the skin, read last time's files ahead of it
+		begin_skin_load(false);
+		std::vector<std::string> list;
+		for (auto& [name, time] : skin_files)
+			list.push_back(name);
+		if (!list.empty())
+			ZealService::get_instance()->tasks->post([list]() { read_ahead(list); });
+	}
+	last_state = state;
+	if (state == GAMESTATE_CHARSELECT)
+	{
+		zoning = false;
+		loading = false;
+		last_zone = 0xFFFFFFFF;
+	}
+
+	// one deferred rebuild per frame once the zone is in, on a quiet frame or after waiting long enough for one
+	if (pending.empty() || zoning || !now_in_game)
+		return;
+	if (frame_ms > quiet_ms && ++busy_frames < max_wait_frames)
+		return;
+	busy_frames = 0;
+	std::function<void()> job = std::move(pending.front());
+	pending.erase(pending.begin());
+	job();
+}
+
+ZoneWarmup::ZoneWarmup(ZealService* zeal)
+{
+	LARGE_INTEGER frequency;
+	QueryPerformanceFrequency(&frequency);
+	ms_per_tick = 1000.0 / frequency.QuadPart;
+	install_hooks();
+	enabled.on_change([this](bool value) {
+		if (!value)
+			loading = false;
+	});
+	map_archives.on_change([this](bool value) {
+		if (!value)
+			release_mappings();
+	});
+	skin_prefetch.on_change([this](bool value) {
+		if (!value)
+			skin_loading = false;
+	});
+	zeal->callbacks->add_generic([this]() { skin_loaded(); }, callback_type::InitUI);
+	zeal->callbacks->add_generic([this]() { main_loop(); }, callback_type::MainLoop);
+	zeal->callbacks->add_generic([this]() { if (enabled.get()) zoned_in(); else zoning = false; }, callback_type::Zone);
+	zeal->commands_hook->add("/zoneprefetch", {}, "Learns which files each zone loads and reads the likely next zone's files ahead while zoning, /zoneprefetch map serves archive reads from memory mapped views, "
+		"/zoneprefetch skin does the same for the ui files of skin loads.",
+		[this](std::vector<std::string>& args) {
+			if (args.size() == 2 && Zeal::String::compare_insensitive(args[1], "skin"))
+			{
+				skin_prefetch.set(!skin_prefetch.get());
+				Zeal::EqGame::print_chat("Skin prefetch is %s", skin_prefetch.get() ? "on, /reloadskin reads the skin's files ahead and reports what changed" : "off");
+				return true;
+			}
+			if (args.size() == 2 && Zeal::String::compare_insensitive(args[1], "map"))
+			{
+				map_archives.set(!map_archives.get());
+				Zeal::EqGame::print_chat("Archive mapping is %s", map_archives.get() ? "on" : "off");
+				return true;
+			}
+			enabled.set(!enabled.get());
+			Zeal::EqGame::print_chat("Zone prefetch is %s", enabled.get() ? "on" : "off");
+			return true;
+		});
+}
+
+// the detours are gone by now (the unload restores the game's code before destroying modules), so nothing looks a handle
+// up again; handles still open read through the kernel from here on
+ZoneWarmup::~ZoneWarmup()
+{
+	std::map<HANDLE, mapped_file> released;
+	std::lock_guard<std::mutex> lock(mapped_lock);
+	released.swap(mapped);
+	mapped_count = 0;
+}
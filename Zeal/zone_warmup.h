@@ -0,0 +1,99 @@
+#pragma once
+#include <Windows.h>
+#include <functional>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <set>
+#include <string>
+#include <vector>
+#include "settings.h"
+
+// zone transitions: the asset files each zone opened are learned while it loads (a CreateFileA detour that only records during
+// a load, installed at startup and gated by the settings), and when leaving a zone the files of the zones usually entered from it are read ahead on the task pool so the
+// load finds them in the os file cache. post_zone() spreads rebuild work over the first quiet frames after the zone in.
+// optionally the archives are memory mapped when opened and synchronous ReadFile calls on them are served from the view.
+// skin loads get the same treatment: the uifiles a load opened are recorded with their write times, a /reloadskin reads
+// them ahead alongside the client's parse and reports the load time and which files changed since the last load
+class ZoneWarmup
+{
+public:
+	ZoneWarmup(class ZealService* zeal);
+	~ZoneWarmup();
+	void post_zone(std::function<void()> job); //runs after zoning on a frame that isn't busy, right away when not zoning
+	void opened(const char* name, HANDLE file, DWORD flags); //from the CreateFileA detour after it succeeded, any thread
+	bool read_mapped(HANDLE file, LPVOID buffer, DWORD bytes, LPDWORD read); //false when the handle isn't mapped
+	void closing(HANDLE file);
+	bool mapping() const { return mapped_count > 0; }
+	bool watching() const { return enabled.get() || skin_prefetch.get() || map_archives.get(); } //the detours stay installed, this gates them
+	void reload_skin(); //the /reloadskin command, the files are read ahead while the client reloads
+	static void read_ahead(const std::vector<std::string>& list); //reads each file through once into the os cache, on the calling thread
+	Setting<bool> enabled{ "Zeal", "ZonePrefetch", false };
+	Setting<bool> skin_prefetch{ "Zeal", "SkinPrefetch", false };
+	Setting<bool> map_archives{ "Zeal", "ZoneArchiveMapping", false };
+private:
+	struct zone_history
+	{
+		std::set<std::string> files;
+		std::vector<std::string> order; //the files in the order the load first read them, prefetched the same way
+		std::map<DWORD, UINT> next; //zones entered from this one, and how often
+		UINT spawns = 0;
+	};
+	void main_loop();
+	void begin_transition();
+	void zoned_in();
+	void finish_recording();
+	void prefetch(DWORD from_zone);
+	void load();
+	void save();
+	void install_hooks();
+	void record(const std::string& file);
+	void begin_skin_load(bool timed);
+	void skin_loaded();
+	void load_skin_files();
+	void save_skin_files();
+	bool map_file(const std::string& name, HANDLE file);
+	void release_mappings(); //drops every entry, only while the detours are installed
+	// shared so a read copying out of a view keeps it mapped through a close or release on another thread. the last
+	// owner unmaps, outside mapped_lock since closing the mapping handle comes back through Local_CloseHandle
+	struct mapped_view
+	{
+		HANDLE mapping = nullptr;
+		const BYTE* view = nullptr;
+		LONGLONG size = 0;
+		~mapped_view()
+		{
+			UnmapViewOfFile(view);
+			CloseHandle(mapping);
+		}
+	};
+	struct mapped_file
+	{
+		std::shared_ptr<mapped_view> view;
+		std::string name;
+		bool read = false;
+	};
+	std::map<DWORD, zone_history> zones;
+	std::mutex recorded_lock;
+	std::vector<std::string> recorded; //files read during the current load, in order
+	std::mutex mapped_lock;
+	std::map<HANDLE, mapped_file> mapped;
+	volatile LONG mapped_count = 0;
+	LONGLONG mapped_bytes = 0;
+	std::map<std::string, ULONGLONG> skin_files; //uifiles the last skin load opened, with their write times
+	std::vector<std::string> skin_recorded;
+	volatile bool skin_loading = false;
+	bool skin_files_loaded = false;
+	LONGLONG skin_load_start = 0; //qpc of a /reloadskin, 0 for loads nobody is timing
+	std::vector<std::function<void()>> pending; //post_zone jobs
+	volatile bool loading = false;
+	bool in_game = false;
+	bool zoning = false; //left a zone, the next zone in hasn't settled yet
+	bool loaded = false;
+	DWORD last_zone = 0xFFFFFFFF;
+	ULONGLONG zoned_in_at = 0;
+	LONGLONG last_frame = 0; //qpc of the previous main loop, for the quiet frame test
+	int busy_frames = 0; //frames a post_zone job has waited for a quiet one
+	int last_state = -1; //game state of the previous main loop
+	double ms_per_tick = 0;
+};